@@ -0,0 +1,352 @@
+/// @brief Small benchmark runner with registration in the style of Google Benchmark.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+  // Every allocation of the process is counted, so that allocations per request can be reported.
+  std::atomic<uint64_t> AllocationCount(0);
+
+  double RealNow()
+  {
+    using namespace std::chrono;
+    return duration_cast<duration<double>>(steady_clock::now().time_since_epoch()).count();
+  }
+
+  double CpuNow()
+  {
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+  }
+
+  std::vector<OpcUa::Bench::Benchmark*>& Benchmarks()
+  {
+    static std::vector<OpcUa::Bench::Benchmark*> benchmarks;
+    return benchmarks;
+  }
+
+  struct Options
+  {
+    std::string Filter = ".";
+    double MinTime = 0.5;
+    bool Json = false;
+    std::string OutPath;
+  };
+
+  struct Result
+  {
+    std::string Name;
+    int64_t Iterations = 0;
+    double RealNs = 0;
+    double CpuNs = 0;
+    double AllocationsPerIteration = 0;
+    double ItemsPerSecond = 0;
+    double BytesPerSecond = 0;
+  };
+
+  bool GetOption(const std::string& arg, const char* name, std::string& value)
+  {
+    const std::string prefix = std::string("--") + name + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0)
+    {
+      return false;
+    }
+    value = arg.substr(prefix.size());
+    return true;
+  }
+
+  Options ParseOptions(int argc, char** argv)
+  {
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+      std::string value;
+      if (GetOption(arg, "benchmark_filter", value))
+      {
+        options.Filter = value;
+      }
+      else if (GetOption(arg, "benchmark_min_time", value))
+      {
+        options.MinTime = std::atof(value.c_str());
+      }
+      else if (GetOption(arg, "benchmark_format", value))
+      {
+        options.Json = value == "json";
+      }
+      else if (GetOption(arg, "benchmark_out", value))
+      {
+        options.OutPath = value;
+      }
+      else
+      {
+        throw std::invalid_argument("Unknown option '" + arg + "'.");
+      }
+    }
+    return options;
+  }
+
+  Result Measure(const OpcUa::Bench::Benchmark& benchmark, int64_t arg, const std::string& name, double minTime)
+  {
+    int64_t iterations = 1;
+    while (true)
+    {
+      OpcUa::Bench::State state(iterations, arg);
+      benchmark.Run(state);
+      const int64_t done = state.Iterations() ? state.Iterations() : 1;
+      if (state.RealSeconds >= minTime || iterations >= 1000000000)
+      {
+        Result result;
+        result.Name = name;
+        result.Iterations = done;
+        result.RealNs = state.RealSeconds * 1e9 / done;
+        result.CpuNs = state.CpuSeconds * 1e9 / done;
+        result.AllocationsPerIteration = static_cast<double>(state.Allocations) / done;
+        if (state.RealSeconds > 0)
+        {
+          result.ItemsPerSecond = state.Items / state.RealSeconds;
+          result.BytesPerSecond = state.Bytes / state.RealSeconds;
+        }
+        return result;
+      }
+      // Predict iterations needed for the minimal time with some margin, but grow at most 10 times.
+      const double predicted = state.RealSeconds > 0 ? iterations * minTime * 1.4 / state.RealSeconds : iterations * 10.0;
+      const double limit = iterations * 10.0;
+      iterations = static_cast<int64_t>(std::max(iterations + 1.0, std::min(predicted, limit)));
+    }
+  }
+
+  std::string CurrentDate()
+  {
+    const std::time_t now = std::time(nullptr);
+    char buf[64] = {0};
+    std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+    return buf;
+  }
+
+  std::string EscapeJson(const std::string& str)
+  {
+    std::string result;
+    for (char c : str)
+    {
+      if (c == '"' || c == '\\')
+      {
+        result += '\\';
+      }
+      result += c;
+    }
+    return result;
+  }
+
+  void WriteJson(std::ostream& os, const std::vector<Result>& results)
+  {
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": \"" << CurrentDate() << "\",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+    os << "    \"library_build_type\": \"release\"\n";
+#else
+    os << "    \"library_build_type\": \"debug\"\n";
+#endif
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      const Result& result = results[i];
+      os << (i ? ",\n" : "\n");
+      os << "    {\n";
+      os << "      \"name\": \"" << EscapeJson(result.Name) << "\",\n";
+      os << "      \"iterations\": " << result.Iterations << ",\n";
+      os << "      \"real_time\": " << result.RealNs << ",\n";
+      os << "      \"cpu_time\": " << result.CpuNs << ",\n";
+      os << "      \"time_unit\": \"ns\",\n";
+      os << "      \"allocations_per_iteration\": " << result.AllocationsPerIteration;
+      if (result.ItemsPerSecond > 0)
+      {
+        os << ",\n      \"items_per_second\": " << result.ItemsPerSecond;
+      }
+      if (result.BytesPerSecond > 0)
+      {
+        os << ",\n      \"bytes_per_second\": " << result.BytesPerSecond;
+      }
+      os << "\n    }";
+    }
+    os << "\n  ]\n";
+    os << "}\n";
+  }
+
+  void WriteConsoleHeader(std::ostream& os)
+  {
+    os << std::left << std::setw(48) << "Benchmark" << std::right
+       << std::setw(14) << "Time ns" << std::setw(14) << "CPU ns" << std::setw(12) << "Iterations"
+       << std::setw(12) << "Allocs/it" << std::setw(14) << "Items/s" << std::setw(14) << "MB/s" << std::endl;
+  }
+
+  void WriteConsole(std::ostream& os, const Result& result)
+  {
+    os << std::left << std::setw(48) << result.Name << std::right << std::fixed << std::setprecision(0)
+       << std::setw(14) << result.RealNs << std::setw(14) << result.CpuNs << std::setw(12) << result.Iterations
+       << std::setprecision(1) << std::setw(12) << result.AllocationsPerIteration
+       << std::setprecision(0) << std::setw(14) << result.ItemsPerSecond
+       << std::setprecision(1) << std::setw(14) << result.BytesPerSecond / 1e6 << std::endl;
+  }
+}
+
+void* operator new(std::size_t size)
+{
+  ++AllocationCount;
+  if (void* ptr = std::malloc(size ? size : 1))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+namespace OpcUa
+{
+  namespace Bench
+  {
+
+    State::State(int64_t maxIterations, int64_t arg)
+      : Max(maxIterations)
+      , Arg(arg)
+    {
+    }
+
+    bool State::KeepRunning()
+    {
+      if (!Started)
+      {
+        Started = true;
+        ResumeTiming();
+      }
+      if (Done < Max)
+      {
+        ++Done;
+        return true;
+      }
+      PauseTiming();
+      return false;
+    }
+
+    void State::PauseTiming()
+    {
+      RealSeconds += RealNow() - RealStart;
+      CpuSeconds += CpuNow() - CpuStart;
+      Allocations += AllocationCount - AllocationsStart;
+    }
+
+    void State::ResumeTiming()
+    {
+      AllocationsStart = AllocationCount;
+      CpuStart = CpuNow();
+      RealStart = RealNow();
+    }
+
+    Benchmark::Benchmark(const std::string& name, Function function)
+      : Name(name)
+      , Run(function)
+    {
+    }
+
+    Benchmark* Benchmark::Arg(int64_t arg)
+    {
+      Args.push_back(arg);
+      return this;
+    }
+
+    Benchmark* Register(const char* name, Function function)
+    {
+      Benchmarks().push_back(new Benchmark(name, function));
+      return Benchmarks().back();
+    }
+
+    int RunBenchmarks(int argc, char** argv)
+    {
+      const Options options = ParseOptions(argc, argv);
+      const std::regex filter(options.Filter);
+
+      if (!options.Json)
+      {
+        WriteConsoleHeader(std::cout);
+      }
+      std::vector<Result> results;
+      for (const Benchmark* benchmark : Benchmarks())
+      {
+        const std::vector<int64_t> args = benchmark->Args.empty() ? std::vector<int64_t>(1, 0) : benchmark->Args;
+        for (int64_t arg : args)
+        {
+          std::string name = benchmark->Name;
+          if (!benchmark->Args.empty())
+          {
+            name += "/" + std::to_string(arg);
+          }
+          if (!std::regex_search(name, filter))
+          {
+            continue;
+          }
+          results.push_back(Measure(*benchmark, arg, name, options.MinTime));
+          if (!options.Json)
+          {
+            WriteConsole(std::cout, results.back());
+          }
+        }
+      }
+
+      if (options.Json)
+      {
+        WriteJson(std::cout, results);
+      }
+      if (!options.OutPath.empty())
+      {
+        std::ofstream out(options.OutPath.c_str());
+        WriteJson(out, results);
+        if (!out)
+        {
+          std::cerr << "Cannot write results to '" << options.OutPath << "'." << std::endl;
+          return 1;
+        }
+      }
+      return 0;
+    }
+
+  } // namespace Bench
+} // namespace OpcUa
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return OpcUa::Bench::RunBenchmarks(argc, argv);
+  }
+  catch (const std::exception& exc)
+  {
+    std::cerr << exc.what() << std::endl;
+  }
+  return 1;
+}
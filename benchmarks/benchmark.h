@@ -0,0 +1,102 @@
+/// @brief Small benchmark runner with registration in the style of Google Benchmark.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace OpcUa
+{
+  namespace Bench
+  {
+
+    class State
+    {
+    public:
+      State(int64_t maxIterations, int64_t arg);
+
+      /// @brief Loop condition of a benchmark: while (state.KeepRunning()) {...}
+      /// Time and allocations are measured from the first to the last call.
+      bool KeepRunning();
+
+      /// @brief Argument passed with Benchmark::Arg(), e.g. number of items in a message.
+      int64_t Range() const
+      {
+        return Arg;
+      }
+
+      /// @brief Exclude preparation done inside the loop from measured time and allocations.
+      void PauseTiming();
+      void ResumeTiming();
+
+      void SetItemsProcessed(int64_t items)
+      {
+        Items = items;
+      }
+
+      void SetBytesProcessed(int64_t bytes)
+      {
+        Bytes = bytes;
+      }
+
+      int64_t Iterations() const
+      {
+        return Done;
+      }
+
+    public:
+      double RealSeconds = 0;
+      double CpuSeconds = 0;
+      uint64_t Allocations = 0;
+      int64_t Items = 0;
+      int64_t Bytes = 0;
+
+    private:
+      int64_t Max;
+      int64_t Arg;
+      int64_t Done = 0;
+      bool Started = false;
+      double RealStart = 0;
+      double CpuStart = 0;
+      uint64_t AllocationsStart = 0;
+    };
+
+    typedef void (*Function)(State&);
+
+    class Benchmark
+    {
+    public:
+      Benchmark(const std::string& name, Function function);
+
+      Benchmark* Arg(int64_t arg);
+
+    public:
+      std::string Name;
+      Function Run;
+      std::vector<int64_t> Args;
+    };
+
+    Benchmark* Register(const char* name, Function function);
+
+    /// @brief Options:
+    /// --benchmark_filter=<regex> run only benchmarks with matching names,
+    /// --benchmark_min_time=<seconds> minimal measured time of every benchmark,
+    /// --benchmark_format=<console|json> format of results printed to stdout,
+    /// --benchmark_out=<file> also write results as json to the file.
+    int RunBenchmarks(int argc, char** argv);
+
+  } // namespace Bench
+} // namespace OpcUa
+
+#define OPCUA_BENCHMARK_CONCAT2(a, b) a##b
+#define OPCUA_BENCHMARK_CONCAT(a, b) OPCUA_BENCHMARK_CONCAT2(a, b)
+
+#define BENCHMARK(function) \
+  static OpcUa::Bench::Benchmark* OPCUA_BENCHMARK_CONCAT(function##_benchmark_, __LINE__) = OpcUa::Bench::Register(#function, function)
@@ -0,0 +1,403 @@
+/// @brief Benchmarks of binary encoding and decoding of protocol types and messages.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "benchmark.h"
+
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/input_from_buffer.h>
+#include <opc/ua/protocol/protocol.h>
+#include <opc/ua/protocol/string_utils.h>
+
+#include <vector>
+
+using namespace OpcUa;
+using namespace OpcUa::Binary;
+
+namespace
+{
+
+  class BufferChannel : public OpcUa::OutputChannel
+  {
+  public:
+    virtual void Send(const char* message, std::size_t size)
+    {
+      Data.insert(Data.end(), message, message + size);
+    }
+
+    virtual void Stop()
+    {
+    }
+
+    std::vector<char> Data;
+  };
+
+  template <typename T>
+  std::vector<char> Encode(const T& value)
+  {
+    BufferChannel channel;
+    OStreamBinary out(channel);
+    out << value << flush;
+    return channel.Data;
+  }
+
+  template <typename T>
+  void EncodeBenchmark(Bench::State& state, const T& value)
+  {
+    BufferChannel channel;
+    OStreamBinary out(channel);
+    while (state.KeepRunning())
+    {
+      channel.Data.clear();
+      out << value << flush;
+    }
+    state.SetBytesProcessed(state.Iterations() * channel.Data.size());
+  }
+
+  template <typename T>
+  void DecodeBenchmark(Bench::State& state, const T& value)
+  {
+    const std::vector<char> data = Encode(value);
+    while (state.KeepRunning())
+    {
+      InputFromBuffer input(data.data(), data.size());
+      IStreamBinary in(input);
+      T decoded;
+      in >> decoded;
+    }
+    state.SetBytesProcessed(state.Iterations() * data.size());
+  }
+
+  // Whole secure message as sent by the server, headers and size backpatching included.
+  template <typename T>
+  void WriteMessageBenchmark(Bench::State& state, const T& response)
+  {
+    const SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, 1);
+    const SymmetricAlgorithmHeader algorithmHeader;
+    const SequenceHeader sequence;
+    BufferChannel channel;
+    OStreamBinary out(channel);
+    while (state.KeepRunning())
+    {
+      channel.Data.clear();
+      WriteMessage(out, secureHeader, algorithmHeader, sequence, response);
+    }
+    state.SetBytesProcessed(state.Iterations() * channel.Data.size());
+  }
+
+  // Same message with its size computed by RawSize before encoding, as sent before WriteMessage.
+  template <typename T>
+  void SizeAndSerializeBenchmark(Bench::State& state, const T& response)
+  {
+    const SymmetricAlgorithmHeader algorithmHeader;
+    const SequenceHeader sequence;
+    BufferChannel channel;
+    OStreamBinary out(channel);
+    while (state.KeepRunning())
+    {
+      channel.Data.clear();
+      SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, 1);
+      secureHeader.AddSize(RawSize(algorithmHeader));
+      secureHeader.AddSize(RawSize(sequence));
+      secureHeader.AddSize(RawSize(response));
+      out << secureHeader << algorithmHeader << sequence << response << flush;
+    }
+    state.SetBytesProcessed(state.Iterations() * channel.Data.size());
+  }
+
+  DataValue MakeDataValue(double value)
+  {
+    DataValue result(value);
+    result.Status = StatusCode::Good;
+    result.Encoding |= DATA_VALUE_STATUS_CODE;
+    result.SetSourceTimestamp(DateTime(131000000000000000LL));
+    result.SetServerTimestamp(DateTime(131000000000000001LL));
+    return result;
+  }
+
+  std::vector<double> MakeDoubles(int64_t count)
+  {
+    std::vector<double> values(count);
+    for (int64_t i = 0; i < count; ++i)
+    {
+      values[i] = i * 0.5;
+    }
+    return values;
+  }
+
+  NodeId MakeNodeId(int64_t kind)
+  {
+    switch (kind)
+    {
+      case 0:
+        return TwoByteNodeId(85);
+      case 1:
+        return FourByteNodeId(2253, 1);
+      case 2:
+        return NumericNodeId(1000000, 2);
+      case 3:
+        return StringNodeId("Objects.Boiler1.Drum.Level", 2);
+      default:
+        return ToNodeId("ns=1;g=01020304-0506-0708-090A0B0C0D0E0F10;");
+    }
+  }
+
+  ReadRequest MakeReadRequest(int64_t count)
+  {
+    ReadRequest request;
+    request.Parameters.AttributesToRead.resize(count);
+    for (int64_t i = 0; i < count; ++i)
+    {
+      ReadValueId& id = request.Parameters.AttributesToRead[i];
+      id.NodeId = NumericNodeId(static_cast<uint32_t>(1000 + i), 2);
+      id.AttributeId = AttributeId::Value;
+    }
+    return request;
+  }
+
+  ReadResponse MakeReadResponse(int64_t count)
+  {
+    ReadResponse response;
+    response.Results.reserve(count);
+    for (int64_t i = 0; i < count; ++i)
+    {
+      response.Results.push_back(MakeDataValue(i * 0.5));
+    }
+    return response;
+  }
+
+  BrowseResponse MakeBrowseResponse(int64_t count)
+  {
+    BrowseResponse response;
+    response.Results.resize(1);
+    std::vector<ReferenceDescription>& refs = response.Results[0].Referencies;
+    refs.resize(count);
+    for (int64_t i = 0; i < count; ++i)
+    {
+      ReferenceDescription& ref = refs[i];
+      ref.ReferenceTypeId = NumericNodeId(35);
+      ref.TargetNodeId = NumericNodeId(static_cast<uint32_t>(1000 + i), 2);
+      ref.BrowseName = QualifiedName(2, "Variable" + std::to_string(i));
+      ref.DisplayName = LocalizedText(ref.BrowseName.Name);
+      ref.TargetNodeClass = NodeClass::Variable;
+      ref.TargetNodeTypeDefinition = NumericNodeId(63);
+    }
+    return response;
+  }
+
+  PublishResponse MakePublishResponse(int64_t count)
+  {
+    DataChangeNotification notification;
+    notification.Notification.resize(count);
+    for (int64_t i = 0; i < count; ++i)
+    {
+      notification.Notification[i].ClientHandle = static_cast<IntegerId>(i + 1);
+      notification.Notification[i].Value = MakeDataValue(i * 0.5);
+    }
+    PublishResponse response;
+    response.Parameters.SubscriptionId = 1;
+    response.Parameters.NotificationMessage.SequenceNumber = 1;
+    response.Parameters.NotificationMessage.NotificationData.push_back(NotificationData(notification));
+    return response;
+  }
+
+} // namespace
+
+static void BM_EncodeVariantDouble(Bench::State& state)
+{
+  EncodeBenchmark(state, Variant(1.5));
+}
+BENCHMARK(BM_EncodeVariantDouble);
+
+static void BM_DecodeVariantDouble(Bench::State& state)
+{
+  DecodeBenchmark(state, Variant(1.5));
+}
+BENCHMARK(BM_DecodeVariantDouble);
+
+static void BM_EncodeVariantString(Bench::State& state)
+{
+  EncodeBenchmark(state, Variant(std::string("Objects.Boiler1.Drum.Level")));
+}
+BENCHMARK(BM_EncodeVariantString);
+
+static void BM_DecodeVariantString(Bench::State& state)
+{
+  DecodeBenchmark(state, Variant(std::string("Objects.Boiler1.Drum.Level")));
+}
+BENCHMARK(BM_DecodeVariantString);
+
+static void BM_EncodeVariantDoubleArray(Bench::State& state)
+{
+  EncodeBenchmark(state, Variant(MakeDoubles(state.Range())));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_EncodeVariantDoubleArray)->Arg(1)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void BM_DecodeVariantDoubleArray(Bench::State& state)
+{
+  DecodeBenchmark(state, Variant(MakeDoubles(state.Range())));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_DecodeVariantDoubleArray)->Arg(1)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void BM_EncodeDataValue(Bench::State& state)
+{
+  EncodeBenchmark(state, MakeDataValue(1.5));
+}
+BENCHMARK(BM_EncodeDataValue);
+
+static void BM_DecodeDataValue(Bench::State& state)
+{
+  DecodeBenchmark(state, MakeDataValue(1.5));
+}
+BENCHMARK(BM_DecodeDataValue);
+
+// Argument selects the encoding: two byte, four byte, numeric, string and guid.
+static void BM_EncodeNodeId(Bench::State& state)
+{
+  EncodeBenchmark(state, MakeNodeId(state.Range()));
+}
+BENCHMARK(BM_EncodeNodeId)->Arg(0)->Arg(1)->Arg(2)->Arg(3)->Arg(4);
+
+static void BM_DecodeNodeId(Bench::State& state)
+{
+  DecodeBenchmark(state, MakeNodeId(state.Range()));
+}
+BENCHMARK(BM_DecodeNodeId)->Arg(0)->Arg(1)->Arg(2)->Arg(3)->Arg(4);
+
+static void BM_EncodeReadRequest(Bench::State& state)
+{
+  EncodeBenchmark(state, MakeReadRequest(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_EncodeReadRequest)->Arg(1)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void BM_DecodeReadRequest(Bench::State& state)
+{
+  DecodeBenchmark(state, MakeReadRequest(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_DecodeReadRequest)->Arg(1)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void BM_EncodeReadResponse(Bench::State& state)
+{
+  EncodeBenchmark(state, MakeReadResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_EncodeReadResponse)->Arg(1)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void BM_DecodeReadResponse(Bench::State& state)
+{
+  DecodeBenchmark(state, MakeReadResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_DecodeReadResponse)->Arg(1)->Arg(100)->Arg(10000)->Arg(100000);
+
+// Pairs of whole secure messages encoded with RawSize first and with WriteMessage.
+static void BM_SizeAndSerializeReadResponseMessage(Bench::State& state)
+{
+  SizeAndSerializeBenchmark(state, MakeReadResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_SizeAndSerializeReadResponseMessage)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_WriteReadResponseMessage(Bench::State& state)
+{
+  WriteMessageBenchmark(state, MakeReadResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_WriteReadResponseMessage)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_SizeAndSerializeBrowseResponseMessage(Bench::State& state)
+{
+  SizeAndSerializeBenchmark(state, MakeBrowseResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_SizeAndSerializeBrowseResponseMessage)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_WriteBrowseResponseMessage(Bench::State& state)
+{
+  WriteMessageBenchmark(state, MakeBrowseResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_WriteBrowseResponseMessage)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_SizeAndSerializePublishResponseMessage(Bench::State& state)
+{
+  SizeAndSerializeBenchmark(state, MakePublishResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_SizeAndSerializePublishResponseMessage)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_WritePublishResponseMessage(Bench::State& state)
+{
+  WriteMessageBenchmark(state, MakePublishResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_WritePublishResponseMessage)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_EncodeBrowseResponse(Bench::State& state)
+{
+  EncodeBenchmark(state, MakeBrowseResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_EncodeBrowseResponse)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_DecodeBrowseResponse(Bench::State& state)
+{
+  DecodeBenchmark(state, MakeBrowseResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_DecodeBrowseResponse)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_EncodePublishResponse(Bench::State& state)
+{
+  EncodeBenchmark(state, MakePublishResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_EncodePublishResponse)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_DecodePublishResponse(Bench::State& state)
+{
+  DecodeBenchmark(state, MakePublishResponse(state.Range()));
+  state.SetItemsProcessed(state.Iterations() * state.Range());
+}
+BENCHMARK(BM_DecodePublishResponse)->Arg(1)->Arg(100)->Arg(10000);
+
+// Argument selects the encoding as for BM_EncodeNodeId.
+static void BM_ParseNodeId(Bench::State& state)
+{
+  const std::string text = ToString(MakeNodeId(state.Range()));
+  NodeId id;
+  while (state.KeepRunning())
+  {
+    ParseNodeId(text.data(), text.data() + text.size(), id);
+  }
+}
+BENCHMARK(BM_ParseNodeId)->Arg(0)->Arg(2)->Arg(3)->Arg(4);
+
+static void BM_FormatNodeId(Bench::State& state)
+{
+  const NodeId id = MakeNodeId(state.Range());
+  char buf[128];
+  while (state.KeepRunning())
+  {
+    FormatNodeId(buf, buf + sizeof(buf), id);
+  }
+}
+BENCHMARK(BM_FormatNodeId)->Arg(0)->Arg(2)->Arg(3)->Arg(4);
+
+static void BM_NodeIdToString(Bench::State& state)
+{
+  const NodeId id = MakeNodeId(state.Range());
+  while (state.KeepRunning())
+  {
+    ToString(id);
+  }
+}
+BENCHMARK(BM_NodeIdToString)->Arg(0)->Arg(2)->Arg(3)->Arg(4);
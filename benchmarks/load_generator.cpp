@@ -0,0 +1,433 @@
+/// @brief Load generator driving a server through the binary client over TCP.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/common/histogram.h>
+#include <opc/ua/client/client.h>
+#include <opc/ua/node.h>
+#include <opc/ua/protocol/string_utils.h>
+#include <opc/ua/server/server.h>
+#include <opc/ua/subscription.h>
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+using namespace OpcUa;
+
+namespace
+{
+  namespace po = boost::program_options;
+
+  typedef std::chrono::steady_clock Clock;
+
+  struct Options
+  {
+    std::string Endpoint;
+    std::string ListenEndpoint = "opc.tcp://127.0.0.1:4850/freeopcua/load";
+    std::vector<std::string> Nodes;
+    unsigned Variables = 1000;
+    unsigned Sessions = 4;
+    double Duration = 10;
+    unsigned Batch = 10;
+    double WriteRatio = 0.2;
+    unsigned Subscriptions = 0;
+    unsigned Items = 100;
+    unsigned PublishInterval = 100;
+    std::string JsonPath;
+    bool Debug = false;
+  };
+
+  bool ParseOptions(int argc, char** argv, Options& options)
+  {
+    po::options_description desc("Parameters");
+    desc.add_options()
+      ("help,h", "Print help message and exit.")
+      ("endpoint,e", po::value<std::string>(&options.Endpoint), "Endpoint of the server under load. In-process server is started if not set.")
+      ("listen", po::value<std::string>(&options.ListenEndpoint)->default_value(options.ListenEndpoint), "Endpoint of the in-process server.")
+      ("nodes,n", po::value<std::vector<std::string>>(&options.Nodes)->multitoken(), "Ids of Double variables to read and write on the server set with --endpoint.")
+      ("variables", po::value<unsigned>(&options.Variables)->default_value(options.Variables), "Number of variables created in the in-process server.")
+      ("sessions,s", po::value<unsigned>(&options.Sessions)->default_value(options.Sessions), "Number of sessions, each one with own connection and thread.")
+      ("duration,d", po::value<double>(&options.Duration)->default_value(options.Duration), "Seconds of measured load.")
+      ("batch,b", po::value<unsigned>(&options.Batch)->default_value(options.Batch), "Number of nodes in every Read and Write request.")
+      ("write-ratio,w", po::value<double>(&options.WriteRatio)->default_value(options.WriteRatio), "Part of requests which are Write, from 0 to 1.")
+      ("subscriptions", po::value<unsigned>(&options.Subscriptions)->default_value(options.Subscriptions), "Number of subscriptions in every session.")
+      ("items", po::value<unsigned>(&options.Items)->default_value(options.Items), "Number of monitored items in every subscription.")
+      ("publish-interval", po::value<unsigned>(&options.PublishInterval)->default_value(options.PublishInterval), "Publishing interval of subscriptions in milliseconds.")
+      ("json", po::value<std::string>(&options.JsonPath), "Write results as json to the file.")
+      ("debug", po::bool_switch(&options.Debug), "Print debug messages of client and server.");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help"))
+    {
+      std::cout << desc << std::endl;
+      return false;
+    }
+    if (!options.Endpoint.empty() && options.Nodes.empty())
+    {
+      throw std::invalid_argument("Nodes to load must be set with --nodes when --endpoint is used.");
+    }
+    if (options.Sessions == 0 || options.Batch == 0 || options.Duration <= 0)
+    {
+      throw std::invalid_argument("Sessions, batch and duration must be positive.");
+    }
+    return true;
+  }
+
+  uint64_t Microseconds(Clock::duration duration)
+  {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  }
+
+  // Latency of a notification is measured from server timestamp of the value,
+  // so with a remote server it is only meaningful when both clocks are synchronized.
+  class NotificationRecorder : public SubscriptionHandler
+  {
+  public:
+    explicit NotificationRecorder(Common::Histogram& latency)
+      : Latency(latency)
+    {
+    }
+
+    virtual bool BatchDataChanges() const
+    {
+      return true;
+    }
+
+    virtual void DataChanges(uint32_t, const DataChangeBatch& changes)
+    {
+      const int64_t now = DateTime::Current().Value;
+      for (const DateTime& timestamp : changes.ServerTimestamps)
+      {
+        // Initial values of variables may come without timestamp.
+        if (timestamp.Value)
+        {
+          Latency.Record(now > timestamp.Value ? static_cast<uint64_t>(now - timestamp.Value) / 10 : 0);
+        }
+      }
+    }
+
+  private:
+    Common::Histogram& Latency;
+  };
+
+  class Session
+  {
+  public:
+    Session(const Options& options, const std::vector<NodeId>& nodes, unsigned index)
+      : Params(options)
+      , Nodes(nodes)
+      , Index(index)
+      , Cursor(index * options.Batch % nodes.size())
+      , Random(index)
+      , Notifications(NotificationLatency)
+      , Client(options.Debug)
+    {
+    }
+
+    void Connect(const std::string& endpoint)
+    {
+      Client.SetSessionName("Load generator session " + std::to_string(Index));
+      Client.Connect(endpoint);
+      Server = Client.GetRootNode().GetServices();
+
+      for (unsigned i = 0; i < Params.Subscriptions; ++i)
+      {
+        std::vector<ReadValueId> items(Params.Items);
+        for (unsigned j = 0; j < Params.Items; ++j)
+        {
+          items[j].NodeId = Nodes[(Index * Params.Subscriptions * Params.Items + i * Params.Items + j) % Nodes.size()];
+          items[j].AttributeId = AttributeId::Value;
+        }
+        Subscriptions.push_back(Client.CreateSubscription(Params.PublishInterval, Notifications));
+        Subscriptions.back()->SubscribeDataChange(items);
+      }
+    }
+
+    void Run(Clock::time_point deadline)
+    {
+      std::bernoulli_distribution isWrite(Params.WriteRatio);
+      while (Clock::now() < deadline)
+      {
+        const bool write = isWrite(Random);
+        const Clock::time_point start = Clock::now();
+        try
+        {
+          const std::size_t bad = write ? Write() : Read();
+          (write ? WriteLatency : ReadLatency).Record(Microseconds(Clock::now() - start));
+          BadResults += bad;
+        }
+        catch (const std::exception& exc)
+        {
+          ++Errors;
+          if (Params.Debug) std::cout << "load_generator| Session " << Index << " request failed: " << exc.what() << std::endl;
+        }
+      }
+    }
+
+    void Disconnect()
+    {
+      for (std::unique_ptr<Subscription>& subscription : Subscriptions)
+      {
+        subscription->Delete();
+      }
+      Subscriptions.clear();
+      Client.Disconnect();
+    }
+
+  private:
+    const NodeId& NextNode()
+    {
+      const NodeId& node = Nodes[Cursor];
+      Cursor = (Cursor + 1) % Nodes.size();
+      return node;
+    }
+
+    std::size_t Read()
+    {
+      ReadParameters params;
+      params.AttributesToRead.resize(Params.Batch);
+      for (ReadValueId& id : params.AttributesToRead)
+      {
+        id.NodeId = NextNode();
+        id.AttributeId = AttributeId::Value;
+      }
+      const std::vector<DataValue> results = Server->Attributes()->Read(params);
+      std::size_t bad = params.AttributesToRead.size() - std::min(results.size(), params.AttributesToRead.size());
+      for (const DataValue& value : results)
+      {
+        if ((value.Encoding & DATA_VALUE_STATUS_CODE) && value.Status != StatusCode::Good)
+        {
+          ++bad;
+        }
+      }
+      return bad;
+    }
+
+    std::size_t Write()
+    {
+      std::vector<WriteValue> values(Params.Batch);
+      for (WriteValue& value : values)
+      {
+        value.NodeId = NextNode();
+        value.AttributeId = AttributeId::Value;
+        value.Value = DataValue(static_cast<double>(++Counter));
+      }
+      const std::vector<StatusCode> results = Server->Attributes()->Write(values);
+      std::size_t bad = values.size() - std::min(results.size(), values.size());
+      for (StatusCode status : results)
+      {
+        if (status != StatusCode::Good)
+        {
+          ++bad;
+        }
+      }
+      return bad;
+    }
+
+  public:
+    Common::Histogram ReadLatency;
+    Common::Histogram WriteLatency;
+    Common::Histogram NotificationLatency;
+    uint64_t Errors = 0;
+    uint64_t BadResults = 0;
+
+  private:
+    const Options& Params;
+    const std::vector<NodeId>& Nodes;
+    const unsigned Index;
+    std::size_t Cursor;
+    uint64_t Counter = 0;
+    std::mt19937 Random;
+    NotificationRecorder Notifications;
+    UaClient Client;
+    Services::SharedPtr Server;
+    std::vector<std::unique_ptr<Subscription>> Subscriptions;
+  };
+
+  std::vector<NodeId> CreateVariables(UaServer& server, unsigned count)
+  {
+    const uint32_t ns = server.RegisterNamespace("http://freeopcua.github.io/load");
+    Node objects = server.GetObjectsNode();
+    std::vector<NodeId> nodes;
+    nodes.reserve(count);
+    for (unsigned i = 0; i < count; ++i)
+    {
+      nodes.push_back(objects.AddVariable(ns, "Variable" + std::to_string(i), Variant(0.0)).GetId());
+    }
+    return nodes;
+  }
+
+  struct Summary
+  {
+    const char* Name;
+    const Common::Histogram& Latency;
+    uint64_t Items;
+  };
+
+  void WriteConsole(std::ostream& os, const std::vector<Summary>& summaries, double seconds)
+  {
+    os << std::left << std::setw(16) << "Operation" << std::right
+       << std::setw(12) << "Count" << std::setw(12) << "Per second" << std::setw(14) << "Items/s"
+       << std::setw(10) << "p50 us" << std::setw(10) << "p99 us" << std::setw(10) << "p999 us" << std::setw(10) << "max us" << std::endl;
+    for (const Summary& summary : summaries)
+    {
+      const Common::Histogram& latency = summary.Latency;
+      os << std::left << std::setw(16) << summary.Name << std::right << std::fixed << std::setprecision(0)
+         << std::setw(12) << latency.Count() << std::setw(12) << latency.Count() / seconds << std::setw(14) << summary.Items / seconds
+         << std::setw(10) << latency.Percentile(0.5) << std::setw(10) << latency.Percentile(0.99)
+         << std::setw(10) << latency.Percentile(0.999) << std::setw(10) << latency.Max() << std::endl;
+    }
+  }
+
+  void WriteJson(std::ostream& os, const Options& options, const std::vector<Summary>& summaries, double seconds, uint64_t errors, uint64_t badResults)
+  {
+    os << "{\n";
+    os << "  \"sessions\": " << options.Sessions << ",\n";
+    os << "  \"batch\": " << options.Batch << ",\n";
+    os << "  \"write_ratio\": " << options.WriteRatio << ",\n";
+    os << "  \"subscriptions\": " << options.Subscriptions << ",\n";
+    os << "  \"items\": " << options.Items << ",\n";
+    os << "  \"publish_interval\": " << options.PublishInterval << ",\n";
+    os << "  \"seconds\": " << seconds << ",\n";
+    os << "  \"errors\": " << errors << ",\n";
+    os << "  \"bad_results\": " << badResults << ",\n";
+    os << "  \"operations\": {";
+    for (std::size_t i = 0; i < summaries.size(); ++i)
+    {
+      const Common::Histogram& latency = summaries[i].Latency;
+      os << (i ? ",\n" : "\n");
+      os << "    \"" << summaries[i].Name << "\": {\n";
+      os << "      \"count\": " << latency.Count() << ",\n";
+      os << "      \"per_second\": " << latency.Count() / seconds << ",\n";
+      os << "      \"items_per_second\": " << summaries[i].Items / seconds << ",\n";
+      os << "      \"time_unit\": \"us\",\n";
+      os << "      \"mean\": " << latency.Mean() << ",\n";
+      os << "      \"p50\": " << latency.Percentile(0.5) << ",\n";
+      os << "      \"p99\": " << latency.Percentile(0.99) << ",\n";
+      os << "      \"p999\": " << latency.Percentile(0.999) << ",\n";
+      os << "      \"max\": " << latency.Max() << "\n";
+      os << "    }";
+    }
+    os << "\n  }\n";
+    os << "}\n";
+  }
+
+  int Run(const Options& options)
+  {
+    std::unique_ptr<UaServer> server;
+    std::vector<NodeId> nodes;
+    std::string endpoint = options.Endpoint;
+    if (endpoint.empty())
+    {
+      endpoint = options.ListenEndpoint;
+      server.reset(new UaServer(options.Debug));
+      server->SetEndpoint(endpoint);
+      server->Start();
+      nodes = CreateVariables(*server, std::max(options.Variables, 1u));
+    }
+    else
+    {
+      for (const std::string& id : options.Nodes)
+      {
+        nodes.push_back(ToNodeId(id));
+      }
+    }
+
+    std::vector<std::unique_ptr<Session>> sessions;
+    for (unsigned i = 0; i < options.Sessions; ++i)
+    {
+      sessions.push_back(std::unique_ptr<Session>(new Session(options, nodes, i)));
+      sessions.back()->Connect(endpoint);
+    }
+    std::cout << "Connected " << sessions.size() << " sessions to " << endpoint << ", running for " << options.Duration << " seconds." << std::endl;
+
+    // Sessions start together after all of them are connected and subscribed.
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.Duration));
+    std::vector<std::future<void>> workers;
+    for (std::unique_ptr<Session>& session : sessions)
+    {
+      workers.push_back(std::async(std::launch::async, &Session::Run, session.get(), deadline));
+    }
+    for (std::future<void>& worker : workers)
+    {
+      worker.get();
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    Common::Histogram reads;
+    Common::Histogram writes;
+    Common::Histogram notifications;
+    uint64_t errors = 0;
+    uint64_t badResults = 0;
+    for (std::unique_ptr<Session>& session : sessions)
+    {
+      session->Disconnect();
+      reads.Merge(session->ReadLatency);
+      writes.Merge(session->WriteLatency);
+      notifications.Merge(session->NotificationLatency);
+      errors += session->Errors;
+      badResults += session->BadResults;
+    }
+    if (server)
+    {
+      server->Stop();
+    }
+
+    std::vector<Summary> summaries;
+    summaries.push_back(Summary{"read", reads, reads.Count() * options.Batch});
+    summaries.push_back(Summary{"write", writes, writes.Count() * options.Batch});
+    summaries.push_back(Summary{"notification", notifications, notifications.Count()});
+
+    WriteConsole(std::cout, summaries, seconds);
+    std::cout << "Errors: " << errors << ", bad results: " << badResults << std::endl;
+    if (!options.JsonPath.empty())
+    {
+      std::ofstream out(options.JsonPath.c_str());
+      WriteJson(out, options, summaries, seconds, errors, badResults);
+      if (!out)
+      {
+        std::cerr << "Cannot write results to '" << options.JsonPath << "'." << std::endl;
+        return 1;
+      }
+    }
+    return errors ? 1 : 0;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+      return 0;
+    }
+    return Run(options);
+  }
+  catch (const std::exception& exc)
+  {
+    std::cerr << exc.what() << std::endl;
+  }
+  return 1;
+}
@@ -0,0 +1,144 @@
+/// @brief Histogram of integer values like latencies with bounded relative error.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+
+namespace Common
+{
+
+  /// @brief Values are counted in buckets which split every power of two into 16 parts,
+  /// so percentiles are exact below 16 and within 1/16 of the value above.
+  /// Record can be called from many threads at once, it takes no locks.
+  class Histogram
+  {
+  public:
+    static const std::size_t SubBuckets = 16;
+    static const std::size_t BucketsCount = SubBuckets + 60 * SubBuckets;
+
+  public:
+    Histogram()
+    {
+      Reset();
+    }
+
+    Histogram(const Histogram&) = delete;
+    Histogram& operator=(const Histogram&) = delete;
+
+    void Record(uint64_t value)
+    {
+      Buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+      Total.fetch_add(1, std::memory_order_relaxed);
+      Sum.fetch_add(value, std::memory_order_relaxed);
+      uint64_t max = Maximum.load(std::memory_order_relaxed);
+      while (value > max && !Maximum.compare_exchange_weak(max, value, std::memory_order_relaxed))
+      {
+      }
+    }
+
+    void Merge(const Histogram& other)
+    {
+      for (std::size_t i = 0; i < BucketsCount; ++i)
+      {
+        Buckets[i].fetch_add(other.Buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+      }
+      Total.fetch_add(other.Count(), std::memory_order_relaxed);
+      Sum.fetch_add(other.Sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      const uint64_t otherMax = other.Max();
+      uint64_t max = Maximum.load(std::memory_order_relaxed);
+      while (otherMax > max && !Maximum.compare_exchange_weak(max, otherMax, std::memory_order_relaxed))
+      {
+      }
+    }
+
+    void Reset()
+    {
+      for (std::size_t i = 0; i < BucketsCount; ++i)
+      {
+        Buckets[i].store(0, std::memory_order_relaxed);
+      }
+      Total.store(0, std::memory_order_relaxed);
+      Sum.store(0, std::memory_order_relaxed);
+      Maximum.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t Count() const
+    {
+      return Total.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Max() const
+    {
+      return Maximum.load(std::memory_order_relaxed);
+    }
+
+    double Mean() const
+    {
+      const uint64_t count = Count();
+      return count ? static_cast<double>(Sum.load(std::memory_order_relaxed)) / count : 0;
+    }
+
+    /// @brief Smallest bucket bound which is not less than the given part of values, part is from 0 to 1.
+    uint64_t Percentile(double part) const
+    {
+      const uint64_t count = Count();
+      if (!count)
+      {
+        return 0;
+      }
+      uint64_t rank = static_cast<uint64_t>(part * count + 0.5);
+      rank = rank ? rank : 1;
+      uint64_t seen = 0;
+      for (std::size_t i = 0; i < BucketsCount; ++i)
+      {
+        seen += Buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+          const uint64_t upper = i + 1 < BucketsCount ? BucketLowerBound(i + 1) - 1 : ~uint64_t(0);
+          return upper < Max() ? upper : Max();
+        }
+      }
+      return Max();
+    }
+
+  private:
+    static std::size_t BucketIndex(uint64_t value)
+    {
+      if (value < SubBuckets)
+      {
+        return static_cast<std::size_t>(value);
+      }
+      unsigned exponent = 4;
+      while (exponent < 63 && (value >> (exponent + 1)))
+      {
+        ++exponent;
+      }
+      return (exponent - 3) * SubBuckets + ((value >> (exponent - 4)) & (SubBuckets - 1));
+    }
+
+    static uint64_t BucketLowerBound(std::size_t index)
+    {
+      if (index < SubBuckets)
+      {
+        return index;
+      }
+      const unsigned exponent = static_cast<unsigned>(index / SubBuckets) + 3;
+      return (SubBuckets + index % SubBuckets) << (exponent - 4);
+    }
+
+  private:
+    std::atomic<uint64_t> Buckets[BucketsCount];
+    std::atomic<uint64_t> Total;
+    std::atomic<uint64_t> Sum;
+    std::atomic<uint64_t> Maximum;
+  };
+
+} // namespace Common
@@ -0,0 +1,67 @@
+/// @brief Batching of attribute reads and writes on client side.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/services/services.h>
+
+#include <chrono>
+#include <future>
+#include <vector>
+
+namespace OpcUa
+{
+
+  /// @brief Operation limits of the server, 0 means no limit.
+  struct BatchLimits
+  {
+    uint32_t MaxNodesPerRead = 0;
+    uint32_t MaxNodesPerWrite = 0;
+  };
+
+  /// @brief Read limits from OperationLimits node of the server.
+  /// Limits the server does not expose are left to 0.
+  BatchLimits GetBatchLimits(Services& services);
+
+  /// @brief Read or write in as many requests as needed to respect limit.
+  std::vector<DataValue> ReadInBatches(AttributeServices& attributes, const ReadParameters& params, uint32_t maxNodesPerRead);
+  std::vector<StatusCode> WriteInBatches(AttributeServices& attributes, const std::vector<WriteValue>& values, uint32_t maxNodesPerWrite);
+
+  /// @brief Services whose Read and Write calls made by different threads while a previous
+  /// request is being sent are sent together in a single request, and results split back to callers.
+  /// A call is sent at once when no request is being sent, otherwise it waits at most window.
+  /// Reads are only gathered with reads which have the same MaxAge and TimestampsToReturn.
+  /// Other services are forwarded unchanged.
+  Services::SharedPtr CreateBatchingServices(Services::SharedPtr services, std::chrono::milliseconds window, const BatchLimits& limits = BatchLimits());
+
+  /// @brief Reads and writes collected explicitly and sent together by Flush or destructor.
+  /// Reads are sent before writes.
+  class AttributeBatch
+  {
+  public:
+    explicit AttributeBatch(Services::SharedPtr services, const BatchLimits& limits = BatchLimits());
+    ~AttributeBatch();
+
+    AttributeBatch(const AttributeBatch&) = delete;
+    AttributeBatch& operator=(const AttributeBatch&) = delete;
+
+    std::shared_future<DataValue> Read(const NodeId& node, AttributeId attribute);
+    std::shared_future<StatusCode> Write(const NodeId& node, AttributeId attribute, const DataValue& value);
+
+    void Flush();
+
+  private:
+    Services::SharedPtr Server;
+    BatchLimits Limits;
+    ReadParameters Reads;
+    std::vector<std::promise<DataValue>> ReadResults;
+    std::vector<WriteValue> Writes;
+    std::vector<std::promise<StatusCode>> WriteResults;
+  };
+
+} // namespace OpcUa
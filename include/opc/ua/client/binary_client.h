@@ -10,10 +10,13 @@
 
 #pragma once
 
+#include <opc/ua/client/callback_dispatcher.h>
 #include <opc/ua/protocol/channel.h>
 #include <opc/ua/services/services.h>
 
 
+#include <chrono>
+#include <map>
 #include <memory>
 
 namespace OpcUa
@@ -26,13 +29,48 @@ namespace OpcUa
       std::vector<uint8_t> SenderCertificate;
       std::vector<uint8_t> ReceiverCertificateThumbPrint;
       uint32_t SecureChannelId;
+      // Threads calling subscription and asynchronous request callbacks.
+      // If not set the client calls them from a single thread of its own.
+      CallbackDispatcher::SharedPtr Dispatcher;
+      // Upper limit of publish requests kept in flight. The client sizes its publish pipeline
+      // from round-trip time and publishing intervals of its subscriptions, up to this limit.
+      unsigned MaxPublishRequests;
+      // Called from the receive thread when the connection breaks. Pending requests
+      // are completed with BadConnectionClosed before.
+      std::function<void ()> ConnectionLost;
 
       SecureConnectionParams()
         : SecureChannelId(0)
+        , MaxPublishRequests(10)
       {
       }
     };
 
+    // Number of publish requests a client keeps in flight for the subscriptions of its session.
+    // Server needs a publish request for every publishing interval of every subscription,
+    // including those passing while a response travels back to the client. Not thread safe.
+    class PublishWindow
+    {
+    public:
+      explicit PublishWindow(unsigned limit);
+
+      void SetInterval(uint32_t subscriptionId, Duration interval);
+      void RemoveInterval(uint32_t subscriptionId);
+      bool IsEmpty() const;
+
+      // One request per subscription and one more per publishing interval passing during
+      // a round trip, at least two and at most the limit. 0 without subscriptions.
+      unsigned GetSize(std::chrono::steady_clock::duration roundTrip) const;
+
+      // Server answered BadTooManyPublishRequests while it held inFlight other requests.
+      void LowerLimit(unsigned inFlight);
+      unsigned GetLimit() const;
+
+    private:
+      std::map<uint32_t, Duration> Intervals;
+      unsigned Limit;
+    };
+
     /// @brief Create server based on opc ua binary protocol.
     /// @param channel channel wich will be used for sending requests data.
     Services::SharedPtr CreateBinaryClient(IOChannel::SharedPtr channel, const SecureConnectionParams& params, bool debug = false);
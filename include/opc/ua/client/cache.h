@@ -0,0 +1,60 @@
+/// @brief Cache of node attributes on client side.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/services/services.h>
+
+#include <chrono>
+#include <vector>
+
+namespace OpcUa
+{
+
+  struct AttributeCacheParameters
+  {
+    /// @brief Time after which a cached attribute is read again, 0 for no expiry.
+    std::chrono::milliseconds TimeToLive = std::chrono::minutes(10);
+    /// @brief Maximum number of cached attributes, least recently used ones are dropped first.
+    std::size_t MaxEntries = 100000;
+    /// @brief Attributes which are cached. Value is only cached when SubscribeValues is set.
+    std::vector<AttributeId> Attributes = {
+      AttributeId::NodeClass,
+      AttributeId::BrowseName,
+      AttributeId::DisplayName,
+      AttributeId::Description,
+      AttributeId::DataType,
+      AttributeId::ValueRank,
+      AttributeId::AccessLevel,
+      AttributeId::UserAccessLevel
+    };
+    /// @brief Keep cached values up to date with a subscription instead of expiring them.
+    bool SubscribeValues = false;
+    Duration PublishingInterval = 500;
+  };
+
+  /// @brief Services which answer reads of cached attributes without a request to the server.
+  /// Attributes are cached by NodeId and AttributeId when read with no index range nor data encoding.
+  /// Writes through these services invalidate the written attributes.
+  class CachingServices : public Services
+  {
+  public:
+    DEFINE_CLASS_POINTERS(CachingServices)
+
+  public:
+    /// @brief Read cached attributes of node and its hierarchical children up to maxDepth levels below,
+    /// with as few requests as possible.
+    virtual void Prefetch(const NodeId& root, uint32_t maxDepth) = 0;
+    virtual void Invalidate(const NodeId& node) = 0;
+    virtual void Clear() = 0;
+    virtual std::size_t GetSize() const = 0;
+  };
+
+  CachingServices::SharedPtr CreateCachingServices(Services::SharedPtr services, const AttributeCacheParameters& params = AttributeCacheParameters());
+
+} // namespace OpcUa
@@ -0,0 +1,113 @@
+/// @brief Pool of threads calling client callbacks.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/class_pointers.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpcUa
+{
+
+  struct CallbackMetrics
+  {
+    /// @brief Callbacks waiting for a thread.
+    std::size_t QueueDepth = 0;
+    std::size_t MaxQueueDepth = 0;
+    uint64_t Dispatched = 0;
+    /// @brief Time between post of a callback and its call.
+    std::chrono::microseconds AverageLatency{0};
+    std::chrono::microseconds MaxLatency{0};
+  };
+
+  /// @brief Calls posted callbacks from a pool of threads.
+  /// Callbacks posted with the same key are called one at a time in post order,
+  /// callbacks with different keys run in parallel. Key 0 gives no ordering.
+  class CallbackDispatcher
+  {
+  public:
+    DEFINE_CLASS_POINTERS(CallbackDispatcher)
+
+  public:
+    explicit CallbackDispatcher(unsigned threads = 1, bool debug = false);
+    ~CallbackDispatcher();
+
+    CallbackDispatcher(const CallbackDispatcher&) = delete;
+    CallbackDispatcher& operator=(const CallbackDispatcher&) = delete;
+
+    void Post(uint32_t key, std::function<void()> callback);
+
+    /// @brief Wait for running callbacks and stop threads. Callbacks not yet called are dropped.
+    /// Called from a callback, it only requests threads to stop: they are joined
+    /// by a later Stop from another thread or by the destructor.
+    void Stop();
+
+    /// @brief True if called from a callback of this dispatcher.
+    bool IsCallbackThread() const;
+
+    CallbackMetrics GetMetrics() const;
+
+  private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Task
+    {
+      std::function<void()> Callback;
+      Clock::time_point Posted;
+    };
+
+    struct Strand
+    {
+      std::deque<Task> Tasks;
+      bool Scheduled = false;
+    };
+
+    // Shared with threads, so that a dispatcher destroyed by one of its callbacks
+    // is not used by the thread calling it once the callback returns.
+    struct State
+    {
+      std::mutex Mutex;
+      std::condition_variable Condition;
+      bool StopRequest = false;
+      // Unordered tasks and keys of strands having a task to call, in post order
+      std::deque<std::pair<uint32_t, Task>> Ready;
+      std::map<uint32_t, Strand> Strands;
+
+      std::size_t QueueDepth = 0;
+      std::size_t MaxQueueDepth = 0;
+      uint64_t Dispatched = 0;
+      Clock::duration TotalLatency = Clock::duration::zero();
+      Clock::duration MaxLatency = Clock::duration::zero();
+    };
+
+    static void Run(std::shared_ptr<State> state, bool debug);
+    static void Call(Task& task);
+    // Set stop request and drop callbacks not yet called
+    void RequestStop();
+    // Join threads other than the calling one
+    void Join();
+
+  private:
+    const bool Debug;
+    const std::shared_ptr<State> Shared;
+    std::mutex JoinMutex;
+    std::vector<std::thread> Threads;
+    std::vector<std::thread::id> ThreadIds;
+  };
+
+} // namespace OpcUa
@@ -23,12 +23,17 @@
 #include <opc/ua/node.h>
 #include <opc/ua/services/services.h>
 #include <opc/ua/subscription.h>
+#include <opc/ua/client/batch.h>
 #include <opc/ua/client/binary_client.h>
+#include <opc/ua/client/cache.h>
+#include <opc/ua/client/pool.h>
+#include <opc/ua/client/reconnect.h>
 #include <opc/ua/server_operations.h>
 
 #include <thread>
 #include <condition_variable>
 #include <chrono>
+#include <future>
 #include <atomic>
 
 
@@ -116,6 +121,22 @@ namespace OpcUa
     std::string GetProductURI() const { return ProductUri; }
     void SetProductURI(std::string uri) { ProductUri = uri; }
 
+    /// @brief Open a new session when the connection breaks, set before Connect.
+    // subscriptions are moved to the new session or created again, nodes and subscriptions
+    // created before stay usable, see ReconnectingServices
+    void EnableAutoReconnect(const ReconnectParameters& params = ReconnectParameters()) { AutoReconnect = true; ReconnectParams = params; }
+
+    /// @brief Number of sessions requests are spread over, set before Connect.
+    // every session has its own connection, see PooledServices
+    void SetChannels(unsigned channels) { Channels = channels ? channels : 1; }
+    unsigned GetChannels() const { return Channels; }
+
+    /// @brief Number of threads calling subscription and asynchronous callbacks, set before Connect.
+    // notifications of one subscription are always delivered in order
+    void SetCallbackThreads(unsigned threads) { CallbackThreads = threads; }
+    unsigned GetCallbackThreads() const { return CallbackThreads; }
+    CallbackMetrics GetCallbackMetrics() const;
+
     /// @brief  set security policy
     // anyway freeopcua currently only support MessageSecurityMode::None
     void SetSecurityPolicy(std::string sec) {SecurityPolicy = sec;}
@@ -150,9 +171,37 @@ namespace OpcUa
 	/// @brief Create a server operations object
 	ServerOperations CreateServerOperations();
 
+    /// @brief Gather Read and Write calls made by different threads while a request is in flight, waiting at most window
+    // must be called after Connect, requests are split according to server operation limits
+    void EnableBatching(std::chrono::milliseconds window);
+
+    /// @brief Create a batch of reads and writes sent together on Flush
+    std::unique_ptr<AttributeBatch> CreateAttributeBatch();
+
+    /// @brief Answer reads of static attributes from a local cache
+    // must be called after Connect, nodes got after this call use the cache
+    void EnableAttributeCache(const AttributeCacheParameters& params = AttributeCacheParameters());
+    /// @brief Fill the attribute cache with attributes of node and its children up to maxDepth levels below
+    void PrefetchAttributes(const NodeId& root, uint32_t maxDepth);
+
+    /// @brief Asynchronous services
+    // requests are sent without waiting for previous responses,
+    // callbacks are called from the client callback thread with the service result
+    // futures are set from the same thread, they hold an exception if service result is not Good
+    void ReadAsync(const ReadParameters& params, AsyncServices::ReadCallback callback);
+    std::future<std::vector<DataValue>> ReadAsync(const ReadParameters& params);
+    void WriteAsync(const std::vector<WriteValue>& values, AsyncServices::WriteCallback callback);
+    std::future<std::vector<StatusCode>> WriteAsync(const std::vector<WriteValue>& values);
+    void BrowseAsync(const NodesQuery& query, AsyncServices::BrowseCallback callback);
+    std::future<std::vector<BrowseResult>> BrowseAsync(const NodesQuery& query);
+    void CallAsync(const std::vector<CallMethodRequest>& methodsToCall, AsyncServices::CallCallback callback);
+    std::future<std::vector<CallMethodResult>> CallAsync(const std::vector<CallMethodRequest>& methodsToCall);
+
   private:
-    void OpenSecureChannel();
+    Services::SharedPtr OpenSession(std::function<void ()> connectionLost);
+    void OpenSecureChannel(Services& server);
     void CloseSecureChannel();
+    void StopReconnect();
 
     std::vector<OpcUa::Node> AddChilds(std::vector<OpcUa::Node> nodes);
 
@@ -167,6 +216,15 @@ namespace OpcUa
     bool Debug = false;
     uint32_t DefaultTimeout = 3600000;
 
+    CachingServices::SharedPtr Cache;
+    unsigned CallbackThreads = 1;
+    CallbackDispatcher::SharedPtr Dispatcher;
+    bool AutoReconnect = false;
+    ReconnectParameters ReconnectParams;
+    std::vector<ReconnectingServices::SharedPtr> Reconnectors;
+    unsigned Channels = 1;
+    std::mutex SessionMutex;
+
   protected:
     Services::SharedPtr Server;
 
@@ -0,0 +1,37 @@
+/// @brief Services spreading requests over several sessions.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/services/services.h>
+
+#include <vector>
+
+namespace OpcUa
+{
+
+  /// @brief Services which send every request through the session with fewest outstanding requests.
+  /// Sessions should be opened to the same server over separate connections, so that sending,
+  /// receiving and decoding of responses are spread over several sockets and threads.
+  /// A subscription stays on the session where it was created, with all its monitored items,
+  /// publish requests and acknowledgements. Browse continuation is kept on the session which
+  /// answered the last Browse of the calling thread, registered nodes are kept on the first session.
+  class PooledServices : public Services
+  {
+  public:
+    DEFINE_CLASS_POINTERS(PooledServices)
+
+  public:
+    virtual std::size_t GetSize() const = 0;
+    /// @brief Requests in flight on every session.
+    virtual std::vector<unsigned> GetOutstanding() const = 0;
+  };
+
+  PooledServices::SharedPtr CreatePooledServices(const std::vector<Services::SharedPtr>& sessions);
+
+} // namespace OpcUa
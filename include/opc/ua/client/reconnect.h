@@ -0,0 +1,57 @@
+/// @brief Client services surviving broken connections.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/services/services.h>
+
+#include <chrono>
+#include <functional>
+
+namespace OpcUa
+{
+
+  struct ReconnectParameters
+  {
+    /// @brief Delay before the first attempt, doubled after every failed attempt up to MaxDelay.
+    std::chrono::milliseconds InitialDelay = std::chrono::milliseconds(500);
+    std::chrono::milliseconds MaxDelay = std::chrono::seconds(30);
+    /// @brief Called with BadConnectionClosed when the connection breaks
+    /// and with Good when session and subscriptions are resumed.
+    /// It is called, as notifications of subscriptions, from a thread of the services
+    /// which calls them one at a time: the services may be stopped or released from it.
+    std::function<void (StatusCode)> StateChanged;
+  };
+
+  /// @brief Open a connection and return services of an activated session on it.
+  /// lost must be called when this connection breaks.
+  /// It is called again from the thread watching the connection and must not release the services.
+  typedef std::function<Services::SharedPtr (std::function<void ()> lost)> ConnectFunction;
+
+  /// @brief Services which open a new session when their connection breaks.
+  /// Subscriptions created through them are moved to the new session with TransferSubscriptions
+  /// and notifications missed meanwhile are republished. Subscriptions which cannot be transferred
+  /// are created again with all their monitored items in one request per subscription.
+  /// When notifications were lost the subscription callback gets a StatusChangeNotification with BadDataLost.
+  /// Ids of subscriptions and monitored items do not change for the application.
+  class ReconnectingServices : public Services
+  {
+  public:
+    DEFINE_CLASS_POINTERS(ReconnectingServices)
+
+  public:
+    /// @brief Open a new connection now and resume subscriptions on it.
+    virtual void Reconnect() = 0;
+    /// @brief Stop watching the connection, current services stay usable.
+    virtual void Stop() = 0;
+  };
+
+  /// @brief Open first connection with connect, exceptions of connect are passed to the caller.
+  ReconnectingServices::SharedPtr CreateReconnectingServices(ConnectFunction connect, const ReconnectParameters& params = ReconnectParameters(), bool debug = false);
+
+} // namespace OpcUa
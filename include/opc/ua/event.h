@@ -60,7 +60,7 @@ namespace OpcUa
       Variant GetValue(const std::string& qualifiedname) const; //helper method for the most common case
 
       //Get the list of available values in this event
-      std::vector<std::vector<QualifiedName>> GetValueKeys();
+      std::vector<std::vector<QualifiedName>> GetValueKeys() const;
 
     protected:
       PathMap PathValues; 
@@ -51,6 +51,27 @@ namespace OpcUa
       template<typename T>
       void Serialize(const T& value);
 
+      /// @brief Append already encoded bytes.
+      void Write(const char* data, std::size_t size)
+      {
+        Buffer.insert(Buffer.end(), data, data + size);
+      }
+
+      /// @brief Bytes encoded since the last flush.
+      std::size_t GetSize() const
+      {
+        return Buffer.size();
+      }
+
+      /// @brief Overwrite an encoded UInt32, e.g. a size known only after the data behind it is encoded.
+      void Patch(std::size_t offset, uint32_t value)
+      {
+        for (std::size_t i = 0; i < sizeof(value); ++i)
+        {
+          Buffer[offset + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+      }
+
     private:
       std::vector<char> Buffer;
     };
@@ -83,6 +104,9 @@ namespace OpcUa
       template <typename T>
       void Deserialize(T&);
 
+      /// @brief Read encoded bytes, throws if less than size bytes are available.
+      void Read(char* data, std::size_t size);
+
     private:
       DataSupplier& In;
     };
@@ -137,6 +161,16 @@ namespace OpcUa
         Serializer.Flush(Out);
       }
 
+      std::size_t GetEncodedSize() const
+      {
+        return Serializer.GetSize();
+      }
+
+      void Patch(std::size_t offset, uint32_t value)
+      {
+        Serializer.Patch(offset, value);
+      }
+
     private:
       OutputChannelType& Out;
       std::shared_ptr<OutputChannelType> Holder;
@@ -150,6 +184,36 @@ namespace OpcUa
       return os;
     }
 
+    namespace Details
+    {
+      template <typename StreamType>
+      inline void WriteParts(StreamType&)
+      {
+      }
+
+      template <typename StreamType, typename Part, typename... Parts>
+      inline void WriteParts(StreamType& out, const Part& part, const Parts&... parts)
+      {
+        out << part;
+        WriteParts(out, parts...);
+      }
+    }
+
+    /// @brief Encode a message and send it. Size of the message is written into the header
+    /// after encoding, so the parts are walked once and RawSize is not needed.
+    /// Header must start with type, chunk type and size like Header and SecureHeader.
+    template <typename OutputChannelType, typename HeaderType, typename... Parts>
+    void WriteMessage(OStream<OutputChannelType>& out, const HeaderType& header, const Parts&... parts)
+    {
+      // three bytes of message type and one of chunk type come before the size
+      const std::size_t sizeOffset = 4;
+      const std::size_t start = out.GetEncodedSize();
+      out << header;
+      Details::WriteParts(out, parts...);
+      out.Patch(start + sizeOffset, static_cast<uint32_t>(out.GetEncodedSize() - start));
+      out.Flush();
+    }
+
     struct RawBuffer
     {
       char* Data;
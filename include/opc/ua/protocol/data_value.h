@@ -44,6 +44,9 @@ namespace OpcUa
     }
 
     DataValue(const DataValue& data) = default;
+    DataValue(DataValue&& data) noexcept = default;
+    DataValue& operator= (const DataValue& data) = default;
+    DataValue& operator= (DataValue&& data) noexcept = default;
 
     explicit DataValue(const Variant& value)
       : DataValue()
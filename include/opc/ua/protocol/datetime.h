@@ -29,7 +29,11 @@ namespace OpcUa
     {
     }
 
+    /// @brief Current time with full resolution of 100 nanoseconds.
     static DateTime Current();
+    /// @brief Current time read from coarse system clock which is much cheaper
+    /// but advances only every few milliseconds. Same as Current() if system has no coarse clock.
+    static DateTime CurrentCoarse();
     static DateTime FromTimeT(time_t t, unsigned usec = 0);
     static time_t ToTimeT(DateTime dateTime);
 
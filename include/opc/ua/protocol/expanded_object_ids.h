@@ -37,7 +37,15 @@ namespace OpcUa
     ElementOperand = 594,
     LiteralOperand = 597,
     AttributeOperand = 600,
-    SimpleAttributeOperand = 603
+    SimpleAttributeOperand = 603,
+
+    ReadEventDetails = 646,
+    ReadRawModifiedDetails = 649,
+    ReadProcessedDetails = 652,
+    ReadAtTimeDetails = 655,
+    HistoryData = 658,
+    HistoryEvent = 661,
+    HistoryModifiedData = 11227,
       
 
   };
@@ -0,0 +1,125 @@
+/// @brief Opc Ua Binary. History read service.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#ifndef __OPC_UA_BINARY_HISTORY_H__
+#define __OPC_UA_BINARY_HISTORY_H__
+
+#include <opc/ua/protocol/protocol.h>
+
+namespace OpcUa
+{
+
+  //---------------------------------------------------
+  // HistoryRead
+  //---------------------------------------------------
+
+  struct HistoryReadValueId
+  {
+    OpcUa::NodeId NodeId;
+    std::string IndexRange;
+    QualifiedName DataEncoding;
+    ByteString ContinuationPoint;
+  };
+
+  struct ReadRawModifiedDetails
+  {
+    bool IsReadModified = false;
+    DateTime StartTime;
+    DateTime EndTime;
+    uint32_t NumValuesPerNode = 0; // 0 means all values
+    bool ReturnBounds = false;
+  };
+
+  struct ReadAtTimeDetails
+  {
+    std::vector<DateTime> ReqTimes;
+    bool UseSimpleBounds = false;
+  };
+
+  struct AggregateConfiguration
+  {
+    bool UseServerCapabilitiesDefaults = true;
+    bool TreatUncertainAsBad = true;
+    uint8_t PercentDataBad = 100;
+    uint8_t PercentDataGood = 100;
+    bool UseSlopedExtrapolation = false;
+  };
+
+  struct ReadProcessedDetails
+  {
+    DateTime StartTime;
+    DateTime EndTime;
+    Duration ProcessingInterval = 0; // 0 means one interval from StartTime to EndTime
+    std::vector<NodeId> AggregateType; // one aggregate per node to read
+    OpcUa::AggregateConfiguration AggregateConfiguration;
+  };
+
+  // HistoryReadDetails is an extension object, Header.TypeId tells which details are set
+  struct HistoryReadDetails
+  {
+    ExtensionObjectHeader Header;
+    ReadRawModifiedDetails RawModified;
+    ReadAtTimeDetails AtTime;
+    ReadProcessedDetails Processed;
+
+    HistoryReadDetails() {}
+    HistoryReadDetails(const ReadRawModifiedDetails& details);
+    HistoryReadDetails(const ReadAtTimeDetails& details);
+    HistoryReadDetails(const ReadProcessedDetails& details);
+  };
+
+  struct ModificationInfo
+  {
+    DateTime ModificationTime;
+    HistoryUpdateType UpdateType = HistoryUpdateType::Insert;
+    std::string UserName;
+  };
+
+  // Result data is an extension object, either HistoryData or HistoryModifiedData.
+  // ModificationInfos are only encoded with HistoryModifiedData.
+  struct HistoryReadResult
+  {
+    StatusCode Status;
+    ByteString ContinuationPoint;
+    ExtensionObjectHeader Header;
+    std::vector<DataValue> DataValues;
+    std::vector<ModificationInfo> ModificationInfos;
+
+    HistoryReadResult();
+  };
+
+  struct HistoryReadParameters
+  {
+    HistoryReadDetails Details;
+    TimestampsToReturn Timestamps = TimestampsToReturn::Source;
+    bool ReleaseContinuationPoints = false;
+    std::vector<HistoryReadValueId> NodesToRead;
+  };
+
+  struct HistoryReadRequest
+  {
+    NodeId TypeId;
+    RequestHeader Header;
+    HistoryReadParameters Parameters;
+
+    HistoryReadRequest();
+  };
+
+  struct HistoryReadResponse
+  {
+    NodeId TypeId;
+    ResponseHeader Header;
+    std::vector<HistoryReadResult> Results;
+    DiagnosticInfoList Diagnostics;
+
+    HistoryReadResponse();
+  };
+
+} // namespace OpcUa
+
+#endif // __OPC_UA_BINARY_HISTORY_H__
@@ -58,6 +58,9 @@ namespace OpcUa
 	READ_REQUEST  = 0x277, // 631
     READ_RESPONSE = 0x27A, // 634
 
+    HISTORY_READ_REQUEST  = 0x298, // 664
+    HISTORY_READ_RESPONSE = 0x29B, // 667
+
     WRITE_REQUEST  = 0x2A1, //673
     WRITE_RESPONSE = 0x2A4, // 676
 
@@ -23,6 +23,21 @@
 
 namespace OpcUa
 {
+    // Structures left in /* DISABLED */ comments below have no generated code:
+    // - NodeId and its encodings, ExpandedNodeId, QualifiedName, LocalizedText, DataValue, Variant,
+    //   DiagnosticInfo, RequestHeader, ResponseHeader and Node are written by hand in types.h,
+    //   nodeid.h, variant.h and data_value.h for a better interface.
+    // - Requests, responses and their parts are written by hand in their service header:
+    //   secure_channel.h and session.h (OpenSecureChannel, CloseSecureChannel, CloseSession),
+    //   endpoints.h (FindServers), node_management.h (AddNodes, AddReferences, *Attributes),
+    //   view.h (Browse, BrowseNext, TranslateBrowsePathsToNodeIds, RegisterNodes, UnregisterNodes),
+    //   history.h (HistoryRead and its details, ModificationInfo, AggregateConfiguration) and
+    //   types_manual.h (notifications, monitoring filters and filter operands).
+    //   BrowseParameters, BrowseNextResult, TranslateBrowsePathsToNodeIdsParameters and
+    //   HistoryModifiedData are encoded inline by those types.
+    // - ContentFilter is encoded inline as the WhereClause elements of EventFilter,
+    //   so QueryFirstRequest and QueryFirstParameters using it are disabled too.
+    // - AggregateFilterResult needs the AggregateConfiguration encoder, not visible to generated code.
 
     // An XML element encoded as a UTF-8 string.
     struct XmlElement 
@@ -209,8 +224,6 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     // Specifies a reference which belongs to a node.
     struct ReferenceNode 
     {
@@ -218,7 +231,6 @@ namespace OpcUa
          bool IsInverse;
          OpcUa::ExpandedNodeId TargetId;
     };
-*/
 
 /* DISABLED
 
@@ -236,8 +248,6 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct InstanceNode 
     {
          OpcUa::NodeId NodeId;
@@ -249,9 +259,6 @@ namespace OpcUa
          uint32_t UserWriteMask;
          std::vector<OpcUa::ReferenceNode> References;
     };
-*/
-
-/* DISABLED
 
     struct TypeNode 
     {
@@ -264,9 +271,6 @@ namespace OpcUa
          uint32_t UserWriteMask;
          std::vector<OpcUa::ReferenceNode> References;
     };
-*/
-
-/* DISABLED
 
     // Specifies the attributes which belong to object nodes.
     struct ObjectNode 
@@ -281,9 +285,6 @@ namespace OpcUa
          std::vector<OpcUa::ReferenceNode> References;
          uint8_t EventNotifier;
     };
-*/
-
-/* DISABLED
 
     // Specifies the attributes which belong to object type nodes.
     struct ObjectTypeNode 
@@ -298,9 +299,6 @@ namespace OpcUa
          std::vector<OpcUa::ReferenceNode> References;
          bool IsAbstract;
     };
-*/
-
-/* DISABLED
 
     // Specifies the attributes which belong to variable nodes.
     struct VariableNode 
@@ -322,9 +320,6 @@ namespace OpcUa
          double MinimumSamplingInterval;
          bool Historizing;
     };
-*/
-
-/* DISABLED
 
     // Specifies the attributes which belong to variable type nodes.
     struct VariableTypeNode 
@@ -343,9 +338,6 @@ namespace OpcUa
          std::vector<uint32_t> ArrayDimensions;
          bool IsAbstract;
     };
-*/
-
-/* DISABLED
 
     // Specifies the attributes which belong to reference type nodes.
     struct ReferenceTypeNode 
@@ -362,9 +354,6 @@ namespace OpcUa
          bool Symmetric;
          OpcUa::LocalizedText InverseName;
     };
-*/
-
-/* DISABLED
 
     // Specifies the attributes which belong to method nodes.
     struct MethodNode 
@@ -380,9 +369,6 @@ namespace OpcUa
          bool Executable;
          bool UserExecutable;
     };
-*/
-
-/* DISABLED
 
     struct ViewNode 
     {
@@ -397,9 +383,6 @@ namespace OpcUa
          bool ContainsNoLoops;
          uint8_t EventNotifier;
     };
-*/
-
-/* DISABLED
 
     struct DataTypeNode 
     {
@@ -413,9 +396,6 @@ namespace OpcUa
          std::vector<OpcUa::ReferenceNode> References;
          bool IsAbstract;
     };
-*/
-
-/* DISABLED
 
     // An argument for a method.
     struct Argument 
@@ -426,9 +406,6 @@ namespace OpcUa
          std::vector<uint32_t> ArrayDimensions;
          OpcUa::LocalizedText Description;
     };
-*/
-
-/* DISABLED
 
     // A mapping between a value of an enumerated type and a name and description.
     struct EnumValueType 
@@ -437,16 +414,12 @@ namespace OpcUa
          OpcUa::LocalizedText DisplayName;
          OpcUa::LocalizedText Description;
     };
-*/
-
-/* DISABLED
 
     struct TimeZoneDataType 
     {
          int16_t Offset;
          bool DaylightSavingInOffset;
     };
-*/
 
     // Describes an application and how to find it.
     struct ApplicationDescription 
@@ -493,8 +466,6 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     // The response returned by all services when there is a service level error.
     struct ServiceFault 
     {
@@ -503,7 +474,6 @@ namespace OpcUa
 
          ServiceFault();
     };
-*/
 
 /* DISABLED
 
@@ -528,13 +498,10 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct FindServersResult 
     {
          std::vector<OpcUa::ApplicationDescription> Servers;
     };
-*/
 
 /* DISABLED
 
@@ -599,8 +566,6 @@ namespace OpcUa
          GetEndpointsResponse();
     };
 
-/* DISABLED
-
     // The information required to register a server with a discovery server.
     struct RegisteredServer 
     {
@@ -613,17 +578,11 @@ namespace OpcUa
          std::string SemaphoreFilePath;
          bool IsOnline;
     };
-*/
-
-/* DISABLED
 
     struct RegisterServerParameters 
     {
          OpcUa::RegisteredServer Server;
     };
-*/
-
-/* DISABLED
 
     // Registers a server with the discovery server.
     struct RegisterServerRequest 
@@ -634,9 +593,6 @@ namespace OpcUa
 
          RegisterServerRequest();
     };
-*/
-
-/* DISABLED
 
     // Registers a server with the discovery server.
     struct RegisterServerResponse 
@@ -646,9 +602,6 @@ namespace OpcUa
 
          RegisterServerResponse();
     };
-*/
-
-/* DISABLED
 
     // The token that identifies a set of keys for an active secure channel.
     struct ChannelSecurityToken 
@@ -658,7 +611,6 @@ namespace OpcUa
          OpcUa::DateTime CreatedAt;
          uint32_t RevisedLifetime;
     };
-*/
 
 /* DISABLED
 
@@ -687,15 +639,12 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct OpenSecureChannelResult 
     {
          uint32_t ServerProtocolVersion;
          OpcUa::ChannelSecurityToken SecurityToken;
          OpcUa::ByteString ServerNonce;
     };
-*/
 
 /* DISABLED
 
@@ -722,8 +671,6 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     // Closes a secure channel.
     struct CloseSecureChannelResponse 
     {
@@ -732,7 +679,6 @@ namespace OpcUa
 
          CloseSecureChannelResponse();
     };
-*/
 
     // A software certificate with a digital signature.
     struct SignedSoftwareCertificate 
@@ -793,8 +739,6 @@ namespace OpcUa
          CreateSessionResponse();
     };
 
-/* DISABLED
-
     // A base type for a user identity token.
     struct UserIdentityToken 
     {
@@ -805,9 +749,6 @@ namespace OpcUa
 
          UserIdentityToken();
     };
-*/
-
-/* DISABLED
 
     // A token representing an anonymous user.
     struct AnonymousIdentityToken 
@@ -817,9 +758,6 @@ namespace OpcUa
          int32_t BodyLength;
          std::string PolicyId;
     };
-*/
-
-/* DISABLED
 
     // A token representing a user identified by a user name and password.
     struct UserNameIdentityToken 
@@ -832,9 +770,6 @@ namespace OpcUa
          OpcUa::ByteString Password;
          std::string EncryptionAlgorithm;
     };
-*/
-
-/* DISABLED
 
     // A token representing a user identified by an X509 certificate.
     struct X509IdentityToken 
@@ -845,9 +780,6 @@ namespace OpcUa
          std::string PolicyId;
          OpcUa::ByteString CertificateData;
     };
-*/
-
-/* DISABLED
 
     // A token representing a user identified by a WS-Security XML token.
     struct IssuedIdentityToken 
@@ -859,7 +791,6 @@ namespace OpcUa
          OpcUa::ByteString TokenData;
          std::string EncryptionAlgorithm;
     };
-*/
 
     struct ActivateSessionParameters 
     {
@@ -922,15 +853,10 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct CancelParameters 
     {
          uint32_t RequestHandle;
     };
-*/
-
-/* DISABLED
 
     // Cancels an outstanding request.
     struct CancelRequest 
@@ -941,17 +867,11 @@ namespace OpcUa
 
          CancelRequest();
     };
-*/
-
-/* DISABLED
 
     struct CancelResult 
     {
          uint32_t CancelCount;
     };
-*/
-
-/* DISABLED
 
     // Cancels an outstanding request.
     struct CancelResponse 
@@ -962,7 +882,6 @@ namespace OpcUa
 
          CancelResponse();
     };
-*/
 
 /* DISABLED
 
@@ -1260,8 +1179,6 @@ namespace OpcUa
          DeleteNodesResponse();
     };
 
-/* DISABLED
-
     // A request to delete a node from the server address space.
     struct DeleteReferencesItem 
     {
@@ -1271,17 +1188,11 @@ namespace OpcUa
          OpcUa::ExpandedNodeId TargetNodeId;
          bool DeleteBidirectional;
     };
-*/
-
-/* DISABLED
 
     struct DeleteReferencesParameters 
     {
          std::vector<OpcUa::DeleteReferencesItem> ReferencesToDelete;
     };
-*/
-
-/* DISABLED
 
     // Delete one or more references from the server address space.
     struct DeleteReferencesRequest 
@@ -1292,18 +1203,12 @@ namespace OpcUa
 
          DeleteReferencesRequest();
     };
-*/
-
-/* DISABLED
 
     struct DeleteReferencesResult 
     {
          std::vector<OpcUa::StatusCode> Results;
          std::vector<OpcUa::DiagnosticInfo> DiagnosticInfos;
     };
-*/
-
-/* DISABLED
 
     // Delete one or more references from the server address space.
     struct DeleteReferencesResponse 
@@ -1314,7 +1219,6 @@ namespace OpcUa
 
          DeleteReferencesResponse();
     };
-*/
 
 /* DISABLED
 
@@ -1408,14 +1312,11 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct BrowseNextParameters 
     {
          bool ReleaseContinuationPoints;
          std::vector<OpcUa::ByteString> ContinuationPoints;
     };
-*/
 
 /* DISABLED
 
@@ -1540,13 +1441,10 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct RegisterNodesParameters 
     {
          std::vector<OpcUa::NodeId> NodesToRegister;
     };
-*/
 
 /* DISABLED
 
@@ -1561,13 +1459,10 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct RegisterNodesResult 
     {
          std::vector<OpcUa::NodeId> RegisteredNodeIds;
     };
-*/
 
 /* DISABLED
 
@@ -1582,13 +1477,10 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct UnregisterNodesParameters 
     {
          std::vector<OpcUa::NodeId> NodesToUnregister;
     };
-*/
 
 /* DISABLED
 
@@ -1615,8 +1507,6 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct EndpointConfiguration 
     {
          int32_t OperationTimeout;
@@ -1629,9 +1519,6 @@ namespace OpcUa
          int32_t ChannelLifetime;
          int32_t SecurityTokenLifetime;
     };
-*/
-
-/* DISABLED
 
     struct SupportedProfile 
     {
@@ -1642,9 +1529,6 @@ namespace OpcUa
          OpcUa::ComplianceLevel ComplianceLevel;
          std::vector<std::string> UnsupportedUnitIds;
     };
-*/
-
-/* DISABLED
 
     struct SoftwareCertificate 
     {
@@ -1659,9 +1543,6 @@ namespace OpcUa
          OpcUa::DateTime IssueDate;
          std::vector<OpcUa::SupportedProfile> SupportedProfiles;
     };
-*/
-
-/* DISABLED
 
     struct QueryDataDescription 
     {
@@ -1669,9 +1550,6 @@ namespace OpcUa
          OpcUa::AttributeId AttributeId;
          std::string IndexRange;
     };
-*/
-
-/* DISABLED
 
     struct NodeTypeDescription 
     {
@@ -1679,9 +1557,6 @@ namespace OpcUa
          bool IncludeSubTypes;
          std::vector<OpcUa::QueryDataDescription> DataToReturn;
     };
-*/
-
-/* DISABLED
 
     struct QueryDataSet 
     {
@@ -1689,9 +1564,6 @@ namespace OpcUa
          OpcUa::ExpandedNodeId TypeDefinitionNode;
          std::vector<OpcUa::Variant> Values;
     };
-*/
-
-/* DISABLED
 
     struct NodeReference 
     {
@@ -1700,7 +1572,6 @@ namespace OpcUa
          bool IsForward;
          std::vector<OpcUa::NodeId> ReferencedNodeIds;
     };
-*/
 
 /* DISABLED
 
@@ -1780,26 +1651,18 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct ContentFilterElementResult 
     {
          OpcUa::StatusCode Status;
          std::vector<OpcUa::StatusCode> OperandStatusCodes;
          std::vector<OpcUa::DiagnosticInfo> OperandDiagnosticInfos;
     };
-*/
-
-/* DISABLED
 
     struct ContentFilterResult 
     {
          std::vector<OpcUa::ContentFilterElementResult> ElementResults;
          std::vector<OpcUa::DiagnosticInfo> ElementDiagnosticInfos;
     };
-*/
-
-/* DISABLED
 
     struct ParsingResult 
     {
@@ -1807,7 +1670,6 @@ namespace OpcUa
          std::vector<OpcUa::StatusCode> DataStatusCodes;
          std::vector<OpcUa::DiagnosticInfo> DataDiagnosticInfos;
     };
-*/
 
 /* DISABLED
 
@@ -1833,8 +1695,6 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct QueryFirstResult 
     {
          std::vector<OpcUa::QueryDataSet> QueryDataSets;
@@ -1843,9 +1703,6 @@ namespace OpcUa
          std::vector<OpcUa::DiagnosticInfo> DiagnosticInfos;
          OpcUa::ContentFilterResult FilterResult;
     };
-*/
-
-/* DISABLED
 
     struct QueryFirstResponse 
     {
@@ -1855,18 +1712,12 @@ namespace OpcUa
 
          QueryFirstResponse();
     };
-*/
-
-/* DISABLED
 
     struct QueryNextParameters 
     {
          bool ReleaseContinuationPoint;
          OpcUa::ByteString ContinuationPoint;
     };
-*/
-
-/* DISABLED
 
     struct QueryNextRequest 
     {
@@ -1876,18 +1727,12 @@ namespace OpcUa
 
          QueryNextRequest();
     };
-*/
-
-/* DISABLED
 
     struct QueryNextResult 
     {
          std::vector<OpcUa::QueryDataSet> QueryDataSets;
          OpcUa::ByteString RevisedContinuationPoint;
     };
-*/
-
-/* DISABLED
 
     struct QueryNextResponse 
     {
@@ -1897,7 +1742,6 @@ namespace OpcUa
 
          QueryNextResponse();
     };
-*/
 
     struct ReadValueId 
     {
@@ -1993,13 +1837,10 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct HistoryData 
     {
          std::vector<OpcUa::DataValue> DataValues;
     };
-*/
 
 /* DISABLED
 
@@ -2088,15 +1929,10 @@ namespace OpcUa
          WriteResponse();
     };
 
-/* DISABLED
-
     struct HistoryUpdateDetails 
     {
          OpcUa::NodeId NodeId;
     };
-*/
-
-/* DISABLED
 
     struct UpdateDataDetails 
     {
@@ -2104,9 +1940,6 @@ namespace OpcUa
          OpcUa::PerformUpdateType PerformInsertReplace;
          std::vector<OpcUa::DataValue> UpdateValues;
     };
-*/
-
-/* DISABLED
 
     struct UpdateStructureDataDetails 
     {
@@ -2114,9 +1947,6 @@ namespace OpcUa
          OpcUa::PerformUpdateType PerformInsertReplace;
          std::vector<OpcUa::DataValue> UpdateValues;
     };
-*/
-
-/* DISABLED
 
     struct DeleteRawModifiedDetails 
     {
@@ -2125,27 +1955,18 @@ namespace OpcUa
          OpcUa::DateTime StartTime;
          OpcUa::DateTime EndTime;
     };
-*/
-
-/* DISABLED
 
     struct DeleteAtTimeDetails 
     {
          OpcUa::NodeId NodeId;
          std::vector<OpcUa::DateTime> ReqTimes;
     };
-*/
-
-/* DISABLED
 
     struct DeleteEventDetails 
     {
          OpcUa::NodeId NodeId;
          std::vector<OpcUa::ByteString> EventIds;
     };
-*/
-
-/* DISABLED
 
     struct HistoryUpdateResult 
     {
@@ -2153,17 +1974,11 @@ namespace OpcUa
          std::vector<OpcUa::StatusCode> OperationResults;
          std::vector<OpcUa::DiagnosticInfo> DiagnosticInfos;
     };
-*/
-
-/* DISABLED
 
     struct HistoryUpdateParameters 
     {
          std::vector<OpcUa::ExtensionObject> HistoryUpdateDetails;
     };
-*/
-
-/* DISABLED
 
     struct HistoryUpdateRequest 
     {
@@ -2173,9 +1988,6 @@ namespace OpcUa
 
          HistoryUpdateRequest();
     };
-*/
-
-/* DISABLED
 
     struct HistoryUpdateResponse 
     {
@@ -2186,7 +1998,6 @@ namespace OpcUa
 
          HistoryUpdateResponse();
     };
-*/
 
     struct CallMethodRequest 
     {
@@ -2262,8 +2073,6 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct ReadEventDetails 
     {
          OpcUa::NodeId TypeId;
@@ -2274,7 +2083,6 @@ namespace OpcUa
          OpcUa::DateTime EndTime;
          OpcUa::EventFilter Filter;
     };
-*/
 
 /* DISABLED
 
@@ -2317,17 +2125,12 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct MonitoringFilterResult 
     {
          OpcUa::NodeId TypeId;
          uint8_t Encoding;
          OpcUa::ByteString Body;
     };
-*/
-
-/* DISABLED
 
     struct EventFilterResult 
     {
@@ -2338,16 +2141,12 @@ namespace OpcUa
          std::vector<OpcUa::DiagnosticInfo> SelectClauseDiagnosticInfos;
          OpcUa::ContentFilterResult WhereClauseResult;
     };
-*/
-
-/* DISABLED
 
     struct HistoryUpdateEventResult 
     {
          OpcUa::StatusCode Status;
          OpcUa::EventFilterResult EventFilterResult;
     };
-*/
 
 /* DISABLED
 
@@ -2413,16 +2212,11 @@ namespace OpcUa
          CreateMonitoredItemsResponse();
     };
 
-/* DISABLED
-
     struct MonitoredItemModifyRequest 
     {
          uint32_t MonitoredItemId;
          OpcUa::MonitoringParameters RequestedParameters;
     };
-*/
-
-/* DISABLED
 
     struct MonitoredItemModifyResult 
     {
@@ -2431,9 +2225,6 @@ namespace OpcUa
          uint32_t RevisedQueueSize;
          OpcUa::ExtensionObject FilterResult;
     };
-*/
-
-/* DISABLED
 
     struct ModifyMonitoredItemsParameters 
     {
@@ -2441,9 +2232,6 @@ namespace OpcUa
          OpcUa::TimestampsToReturn TimestampsToReturn;
          std::vector<OpcUa::MonitoredItemModifyRequest> ItemsToModify;
     };
-*/
-
-/* DISABLED
 
     struct ModifyMonitoredItemsRequest 
     {
@@ -2453,9 +2241,6 @@ namespace OpcUa
 
          ModifyMonitoredItemsRequest();
     };
-*/
-
-/* DISABLED
 
     struct ModifyMonitoredItemsResponse 
     {
@@ -2466,9 +2251,6 @@ namespace OpcUa
 
          ModifyMonitoredItemsResponse();
     };
-*/
-
-/* DISABLED
 
     struct SetMonitoringModeParameters 
     {
@@ -2476,9 +2258,6 @@ namespace OpcUa
          OpcUa::MonitoringMode MonitoringMode;
          std::vector<uint32_t> MonitoredItemIds;
     };
-*/
-
-/* DISABLED
 
     struct SetMonitoringModeRequest 
     {
@@ -2488,18 +2267,12 @@ namespace OpcUa
 
          SetMonitoringModeRequest();
     };
-*/
-
-/* DISABLED
 
     struct SetMonitoringModeResult 
     {
          std::vector<OpcUa::StatusCode> Results;
          std::vector<OpcUa::DiagnosticInfo> DiagnosticInfos;
     };
-*/
-
-/* DISABLED
 
     struct SetMonitoringModeResponse 
     {
@@ -2509,9 +2282,6 @@ namespace OpcUa
 
          SetMonitoringModeResponse();
     };
-*/
-
-/* DISABLED
 
     struct SetTriggeringParameters 
     {
@@ -2520,9 +2290,6 @@ namespace OpcUa
          std::vector<uint32_t> LinksToAdd;
          std::vector<uint32_t> LinksToRemove;
     };
-*/
-
-/* DISABLED
 
     struct SetTriggeringRequest 
     {
@@ -2532,9 +2299,6 @@ namespace OpcUa
 
          SetTriggeringRequest();
     };
-*/
-
-/* DISABLED
 
     struct SetTriggeringResult 
     {
@@ -2543,9 +2307,6 @@ namespace OpcUa
          std::vector<OpcUa::StatusCode> RemoveResults;
          std::vector<OpcUa::DiagnosticInfo> RemoveDiagnosticInfos;
     };
-*/
-
-/* DISABLED
 
     struct SetTriggeringResponse 
     {
@@ -2555,7 +2316,6 @@ namespace OpcUa
 
          SetTriggeringResponse();
     };
-*/
 
     struct DeleteMonitoredItemsParameters 
     {
@@ -2622,8 +2382,6 @@ namespace OpcUa
          CreateSubscriptionResponse();
     };
 
-/* DISABLED
-
     struct ModifySubscriptionParameters 
     {
          uint32_t SubscriptionId;
@@ -2633,9 +2391,6 @@ namespace OpcUa
          uint32_t MaxNotificationsPerPublish;
          uint8_t Priority;
     };
-*/
-
-/* DISABLED
 
     struct ModifySubscriptionRequest 
     {
@@ -2645,9 +2400,6 @@ namespace OpcUa
 
          ModifySubscriptionRequest();
     };
-*/
-
-/* DISABLED
 
     struct ModifySubscriptionResult 
     {
@@ -2655,9 +2407,6 @@ namespace OpcUa
          uint32_t RevisedLifetimeCount;
          uint32_t RevisedMaxKeepAliveCount;
     };
-*/
-
-/* DISABLED
 
     struct ModifySubscriptionResponse 
     {
@@ -2667,7 +2416,6 @@ namespace OpcUa
 
          ModifySubscriptionResponse();
     };
-*/
 
     struct PublishingModeParameters 
     {
@@ -2718,14 +2466,11 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct MonitoredItemNotification 
     {
          uint32_t ClientHandle;
          OpcUa::DataValue Value;
     };
-*/
 
 /* DISABLED
 
@@ -2759,23 +2504,15 @@ namespace OpcUa
     };
 */
 
-/* DISABLED
-
     struct HistoryEventFieldList 
     {
          std::vector<OpcUa::Variant> EventFields;
     };
-*/
-
-/* DISABLED
 
     struct HistoryEvent 
     {
          std::vector<OpcUa::HistoryEventFieldList> Events;
     };
-*/
-
-/* DISABLED
 
     struct UpdateEventDetails 
     {
@@ -2784,7 +2521,6 @@ namespace OpcUa
          OpcUa::EventFilter Filter;
          std::vector<OpcUa::HistoryEventFieldList> EventData;
     };
-*/
 
 /* DISABLED
 
@@ -2858,25 +2594,17 @@ namespace OpcUa
          RepublishResponse();
     };
 
-/* DISABLED
-
     struct TransferResult 
     {
          OpcUa::StatusCode Status;
          std::vector<uint32_t> AvailableSequenceNumbers;
     };
-*/
-
-/* DISABLED
 
     struct TransferSubscriptionsParameters 
     {
          std::vector<uint32_t> SubscriptionIds;
          bool SendInitialValues;
     };
-*/
-
-/* DISABLED
 
     struct TransferSubscriptionsRequest 
     {
@@ -2886,18 +2614,12 @@ namespace OpcUa
 
          TransferSubscriptionsRequest();
     };
-*/
-
-/* DISABLED
 
     struct TransferSubscriptionsResult 
     {
          std::vector<OpcUa::TransferResult> Results;
          std::vector<OpcUa::DiagnosticInfo> DiagnosticInfos;
     };
-*/
-
-/* DISABLED
 
     struct TransferSubscriptionsResponse 
     {
@@ -2907,7 +2629,6 @@ namespace OpcUa
 
          TransferSubscriptionsResponse();
     };
-*/
 
     struct DeleteSubscriptionsRequest 
     {
@@ -2928,8 +2649,6 @@ namespace OpcUa
          DeleteSubscriptionsResponse();
     };
 
-/* DISABLED
-
     // A complex type containing all possible scalar types used for testing.
     struct ScalarTestType 
     {
@@ -2959,9 +2678,6 @@ namespace OpcUa
          OpcUa::DataValue DataValue;
          OpcUa::EnumeratedTestType EnumeratedValue;
     };
-*/
-
-/* DISABLED
 
     // A complex type containing all possible array types used for testing.
     struct ArrayTestType 
@@ -2992,18 +2708,12 @@ namespace OpcUa
          std::vector<OpcUa::Variant> Variants;
          std::vector<OpcUa::EnumeratedTestType> EnumeratedValues;
     };
-*/
-
-/* DISABLED
 
     struct CompositeTestType 
     {
          OpcUa::ScalarTestType Field1;
          OpcUa::ArrayTestType Field2;
     };
-*/
-
-/* DISABLED
 
     struct TestStackParameters 
     {
@@ -3011,9 +2721,6 @@ namespace OpcUa
          int32_t Iteration;
          OpcUa::Variant Input;
     };
-*/
-
-/* DISABLED
 
     struct TestStackRequest 
     {
@@ -3023,17 +2730,11 @@ namespace OpcUa
 
          TestStackRequest();
     };
-*/
-
-/* DISABLED
 
     struct TestStackResult 
     {
          OpcUa::Variant Output;
     };
-*/
-
-/* DISABLED
 
     struct TestStackResponse 
     {
@@ -3043,9 +2744,6 @@ namespace OpcUa
 
          TestStackResponse();
     };
-*/
-
-/* DISABLED
 
     struct TestStackExParameters 
     {
@@ -3053,9 +2751,6 @@ namespace OpcUa
          int32_t Iteration;
          OpcUa::CompositeTestType Input;
     };
-*/
-
-/* DISABLED
 
     struct TestStackExRequest 
     {
@@ -3065,17 +2760,11 @@ namespace OpcUa
 
          TestStackExRequest();
     };
-*/
-
-/* DISABLED
 
     struct TestStackExResult 
     {
          OpcUa::CompositeTestType Output;
     };
-*/
-
-/* DISABLED
 
     struct TestStackExResponse 
     {
@@ -3085,9 +2774,6 @@ namespace OpcUa
 
          TestStackExResponse();
     };
-*/
-
-/* DISABLED
 
     struct BuildInfo 
     {
@@ -3098,9 +2784,6 @@ namespace OpcUa
          std::string BuildNumber;
          OpcUa::DateTime BuildDate;
     };
-*/
-
-/* DISABLED
 
     struct RedundantServerDataType 
     {
@@ -3108,26 +2791,17 @@ namespace OpcUa
          uint8_t ServiceLevel;
          OpcUa::ServerState ServerState;
     };
-*/
-
-/* DISABLED
 
     struct EndpointUrlListDataType 
     {
          std::vector<std::string> EndpointUrlList;
     };
-*/
-
-/* DISABLED
 
     struct NetworkGroupDataType 
     {
          std::string ServerUri;
          std::vector<OpcUa::EndpointUrlListDataType> NetworkPaths;
     };
-*/
-
-/* DISABLED
 
     struct SamplingIntervalDiagnosticsDataType 
     {
@@ -3136,9 +2810,6 @@ namespace OpcUa
          uint32_t MaxMonitoredItemCount;
          uint32_t DisabledMonitoredItemCount;
     };
-*/
-
-/* DISABLED
 
     struct ServerDiagnosticsSummaryDataType 
     {
@@ -3155,9 +2826,6 @@ namespace OpcUa
          uint32_t SecurityRejectedRequestsCount;
          uint32_t RejectedRequestsCount;
     };
-*/
-
-/* DISABLED
 
     struct ServerStatusDataType 
     {
@@ -3168,9 +2836,6 @@ namespace OpcUa
          uint32_t SecondsTillShutdown;
          OpcUa::LocalizedText ShutdownReason;
     };
-*/
-
-/* DISABLED
 
     struct SessionSecurityDiagnosticsDataType 
     {
@@ -3184,18 +2849,12 @@ namespace OpcUa
          std::string SecurityPolicyUri;
          OpcUa::ByteString ClientCertificate;
     };
-*/
-
-/* DISABLED
 
     struct ServiceCounterDataType 
     {
          uint32_t TotalCount;
          uint32_t ErrorCount;
     };
-*/
-
-/* DISABLED
 
     struct SessionDiagnosticsDataType 
     {
@@ -3243,18 +2902,12 @@ namespace OpcUa
          OpcUa::ServiceCounterDataType RegisterNodesCount;
          OpcUa::ServiceCounterDataType UnregisterNodesCount;
     };
-*/
-
-/* DISABLED
 
     struct StatusResult 
     {
          OpcUa::StatusCode Status;
          OpcUa::DiagnosticInfo DiagnosticInfo;
     };
-*/
-
-/* DISABLED
 
     struct SubscriptionDiagnosticsDataType 
     {
@@ -3290,9 +2943,6 @@ namespace OpcUa
          uint32_t NextSequenceNumber;
          uint32_t EventQueueOverFlowCount;
     };
-*/
-
-/* DISABLED
 
     struct ModelChangeStructureDataType 
     {
@@ -3300,27 +2950,18 @@ namespace OpcUa
          OpcUa::NodeId AffectedType;
          uint8_t Verb;
     };
-*/
-
-/* DISABLED
 
     struct SemanticChangeStructureDataType 
     {
          OpcUa::NodeId Affected;
          OpcUa::NodeId AffectedType;
     };
-*/
-
-/* DISABLED
 
     struct Range 
     {
          double Low;
          double High;
     };
-*/
-
-/* DISABLED
 
     struct EUInformation 
     {
@@ -3329,27 +2970,18 @@ namespace OpcUa
          OpcUa::LocalizedText DisplayName;
          OpcUa::LocalizedText Description;
     };
-*/
-
-/* DISABLED
 
     struct ComplexNumberType 
     {
          float Real;
          float Imaginary;
     };
-*/
-
-/* DISABLED
 
     struct DoubleComplexNumberType 
     {
          double Real;
          double Imaginary;
     };
-*/
-
-/* DISABLED
 
     struct AxisInformation 
     {
@@ -3359,18 +2991,12 @@ namespace OpcUa
          OpcUa::AxisScaleEnumeration AxisScaleType;
          std::vector<double> AxisSteps;
     };
-*/
-
-/* DISABLED
 
     struct XVType 
     {
          double X;
          float Value;
     };
-*/
-
-/* DISABLED
 
     struct ProgramDiagnosticDataType 
     {
@@ -3385,7 +3011,6 @@ namespace OpcUa
          OpcUa::DateTime LastMethodCallTime;
          OpcUa::StatusResult LastMethodReturnStatus;
     };
-*/
 
     struct Annotation 
     {
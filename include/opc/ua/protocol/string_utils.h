@@ -23,6 +23,7 @@
 #include <opc/ua/protocol/view.h>
 #include <ostream>
 #include <limits>
+#include <system_error>
 
 namespace OpcUa
 {
@@ -36,6 +37,29 @@ namespace OpcUa
 
   Guid ToGuid(const std::string& str);
   NodeId ToNodeId(const std::string& str, uint32_t defaultNamespace=0);
+
+  /// @brief Result of ParseNodeId and FormatNodeId in the style of std::from_chars and std::to_chars.
+  /// Error is std::errc() on success and Ptr points past the parsed or written text.
+  /// Otherwise Ptr points to the field which could not be parsed or to the end of the buffer.
+  struct NodeIdParseResult
+  {
+    const char* Ptr;
+    std::errc Error;
+  };
+
+  struct NodeIdFormatResult
+  {
+    char* Ptr;
+    std::errc Error;
+  };
+
+  /// @brief Parse text like 'ns=2;i=1;' in one pass without temporary strings.
+  /// id is changed only on success. Errors are std::errc::invalid_argument for malformed text
+  /// and std::errc::result_out_of_range for numbers which do not fit.
+  NodeIdParseResult ParseNodeId(const char* first, const char* last, NodeId& id, uint32_t defaultNamespace=0);
+  /// @brief Write the same text as ToString(NodeId), without terminating zero.
+  /// Error is std::errc::value_too_large if buffer is too small.
+  NodeIdFormatResult FormatNodeId(char* first, char* last, const NodeId& id);
   QualifiedName ToQualifiedName(const std::string& str, uint32_t default_ns=0);
 
   inline std::ostream& operator<<(std::ostream& os, const OpcUa::NodeId& nodeid)
@@ -17,6 +17,8 @@
 
 #include <boost/any.hpp>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <stdexcept>
 
@@ -165,11 +167,21 @@ namespace OpcUa
     Variant(){}
     Variant(const Variant& var)
       : Value(var.Value)
+      , Dimensions(var.Dimensions)
+    {
+    }
+
+    Variant(Variant&& var) noexcept
+      : Value(std::move(var.Value))
+      , Dimensions(std::move(var.Dimensions))
     {
     }
 
     template <typename T>
     Variant(const T& value) : Value(value){}
+    /// @brief Takes over an array without copying its elements.
+    template <typename T>
+    Variant(std::vector<T>&& value) : Value(std::move(value)){}
     Variant(MessageId id) : Variant(NodeId(id)){}
     Variant(ReferenceId id) : Variant(NodeId(id)){}
     Variant(ObjectId id) : Variant(NodeId(id)){}
@@ -179,6 +191,14 @@ namespace OpcUa
     Variant& operator= (const Variant& variant)
     {
       this->Value = variant.Value;
+      this->Dimensions = variant.Dimensions;
+      return *this;
+    }
+
+    Variant& operator= (Variant&& variant) noexcept
+    {
+      this->Value = std::move(variant.Value);
+      this->Dimensions = std::move(variant.Dimensions);
       return *this;
     }
 
@@ -189,6 +209,13 @@ namespace OpcUa
       return *this;
     }
 
+    template <typename T>
+    Variant& operator=(std::vector<T>&& value)
+    {
+      Value = std::move(value);
+      return *this;
+    }
+
     Variant& operator=(MessageId value)
     {
       Value = NodeId(value);
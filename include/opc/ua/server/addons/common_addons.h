@@ -39,6 +39,13 @@ namespace OpcUa
       EndpointDescription Endpoint;
       unsigned ThreadsCount = 1;
       bool Debug = false;
+      /// @Directory where values of historizing variables are stored.
+      /// History is disabled if empty.
+      std::string HistoryPath;
+      /// @Server timestamps of written values, publish times, response headers and server status
+      /// are taken from the coarse system clock.
+      /// It is much cheaper under heavy load but advances only every few milliseconds.
+      bool CoarseTimestamps = false;
     };
 
     /// @brief parameters of server.
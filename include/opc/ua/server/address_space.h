@@ -11,6 +11,7 @@
 #pragma once
 
 #include <opc/ua/event.h>
+#include <opc/ua/server/history.h>
 #include <opc/ua/services/attributes.h>
 #include <opc/ua/services/node_management.h>
 #include <opc/ua/services/view.h>
@@ -38,6 +39,11 @@ namespace OpcUa
       virtual void DeleteDataChangeCallback(uint32_t clienthandle) = 0;
       virtual StatusCode SetValueCallback(const NodeId& node, AttributeId attribute, std::function<DataValue(void)> callback) = 0;
       virtual void SetMethod(const NodeId& node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback) = 0;
+      //Values of variables with Historizing attribute set are recorded to backend and served by HistoryRead
+      virtual void SetHistoryBackend(HistoryBackend::SharedPtr backend) = 0;
+      //Timestamps set by the server (written values, publish times, response headers, server status) are taken
+      //from the coarse system clock for the whole process, all values of one Write share a timestamp
+      virtual void SetCoarseTimestamps(bool coarse) = 0;
       //FIXME : SHould we also expose SetValue and GetValue on server side? then we need to lock them ...
     };
 
@@ -0,0 +1,75 @@
+/// @brief Storage of historical values of variables.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/class_pointers.h>
+#include <opc/common/interface.h>
+#include <opc/ua/protocol/data_value.h>
+#include <opc/ua/protocol/nodeid.h>
+
+#include <string>
+#include <vector>
+
+namespace OpcUa
+{
+  namespace Server
+  {
+
+    //Statistics of numeric scalar values
+    struct HistoryStatistics
+    {
+      uint32_t NumericCount = 0;
+      double Sum = 0;
+      DataValue Minimum;         //values with lowest and highest value, earliest one if several
+      DataValue Maximum;
+    };
+
+    //Statistics of successive stored values, lets aggregates be computed without decoding each value.
+    //Good and uncertain values are told apart by the severity of their status code.
+    struct HistorySummary
+    {
+      uint32_t Count = 0;
+      uint32_t GoodCount = 0;
+      uint32_t UncertainCount = 0;
+      HistoryStatistics Good;    //of good values, when uncertain values are treated as bad
+      HistoryStatistics Usable;  //of good and uncertain values
+      DataValue First;           //values with lowest and highest timestamp, whatever their status
+      DataValue Last;
+    };
+
+    //Backend used by the address space to record values of historizing variables
+    //and to serve HistoryRead requests.
+    //Values of a node are stored with their source timestamp, or server timestamp if not set.
+    class HistoryBackend : private Common::Interface
+    {
+    public:
+      DEFINE_CLASS_POINTERS(HistoryBackend)
+
+      virtual void Append(const NodeId& node, const DataValue& value) = 0;
+
+      //Values with timestamp in [start, end] in time order.
+      //If maxValues is not zero at most maxValues values are returned.
+      virtual std::vector<DataValue> Read(const NodeId& node, const DateTime& start, const DateTime& end, uint32_t maxValues) const = 0;
+
+      //Last value with timestamp lower or equal to time, false if there is none
+      virtual bool ReadBefore(const NodeId& node, const DateTime& time, DataValue& value) const = 0;
+      //First value with timestamp greater or equal to time, false if there is none
+      virtual bool ReadAfter(const NodeId& node, const DateTime& time, DataValue& value) const = 0;
+
+      //Values with timestamp in [start, end] in any order, some of them may be returned as summaries.
+      //Default implementation returns all values.
+      virtual void ReadSummaries(const NodeId& node, const DateTime& start, const DateTime& end, std::vector<HistorySummary>& summaries, std::vector<DataValue>& values) const;
+    };
+
+    //Embedded store keeping compressed values in one file per node in directory.
+    //If directory is empty values are only kept in memory.
+    HistoryBackend::UniquePtr CreateHistoryStore(const std::string& directory);
+
+  } // namespace Server
+} // namespace OpcUa
@@ -34,6 +34,16 @@ namespace OpcUa
       void SetServerURI(const std::string& uri);
       void SetServerName(const std::string& name);
 
+      /// @brief set directory where values of historizing variables are stored.
+      // history of a variable is recorded when its Historizing attribute is true
+      // and can be read by clients with HistoryRead
+      void SetHistoryPath(const std::string& path);
+
+      /// @brief take server timestamps of written values, publish times, response headers
+      // and server status from the coarse system clock.
+      // it is much cheaper under heavy load but advances only every few milliseconds
+      void SetCoarseTimestamps(bool coarse);
+
       /// @brief load xml addressspace. This is not implemented yet!!!
       void AddAddressSpace(const std::string& path);
 
@@ -94,6 +104,8 @@ namespace OpcUa
       std::string ServerUri = "urn:freeopcua:server"; 
       std::string ProductUri = "urn:freeopcua.github.no:server";
       std::string Name = "FreeOpcUa Server";
+      std::string HistoryPath;
+      bool CoarseTimestamps = false;
       bool Debug = false;
       bool LoadCppAddressSpace = true;
       OpcUa::MessageSecurityMode SecurityMode = OpcUa::MessageSecurityMode::None;
@@ -34,6 +34,13 @@ namespace OpcUa
       DEFINE_CLASS_POINTERS(SubscriptionService)
 
       virtual void TriggerEvent(NodeId node, Event event) = 0;
+      //Send again to a subscription the events triggered during the last period (in milliseconds),
+      //or all retained events if period is zero. Replayed events are enclosed by
+      //RefreshStartEvent and RefreshEndEvent.
+      virtual StatusCode ReplayEvents(uint32_t subscriptionId, Duration period) = 0;
+      //Send to a subscription the last state of every condition with Retain set, enclosed by
+      //RefreshStartEvent and RefreshEndEvent. This is the ConditionRefresh method.
+      virtual StatusCode RefreshConditions(uint32_t subscriptionId) = 0;
     };
 
     SubscriptionService::UniquePtr CreateSubscriptionService(std::shared_ptr<AddressSpace> addressspace, boost::asio::io_service& io, bool debug);
@@ -19,6 +19,8 @@ namespace OpcUa{
 
 	public:
 		void WriteAttributes(std::vector<WriteValue>&);
+		//Write values of nodes with one request, all values get the same source timestamp
+		void WriteValues(const std::vector<Node>& nodes, const std::vector<Variant>& values);
 		std::vector<DataValue> ReadAttributes(std::vector<ReadValueId>& attributes);
 		std::vector<DataValue> ReadAttributes(std::vector<Node>& nodes, AttributeId attr);
 		std::vector<Node> RegisterNodes(std::vector<Node>&);
@@ -0,0 +1,48 @@
+/// @brief Asynchronous services interface.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#ifndef OPC_UA_Client_ASYNC_H
+#define OPC_UA_Client_ASYNC_H
+
+#include <opc/common/class_pointers.h>
+#include <opc/common/interface.h>
+#include <opc/ua/protocol/data_value.h>
+#include <opc/ua/protocol/protocol.h>
+#include <opc/ua/protocol/view.h>
+
+#include <functional>
+#include <vector>
+
+namespace OpcUa
+{
+
+  /// @brief Services which return immediately and report result through a callback.
+  /// Any number of requests may be in flight at the same time.
+  /// Callback gets service result of the response, results are empty if it is not Good.
+  /// A request which gets no response is completed with BadTimeout,
+  /// requests pending when the client is destroyed are completed with BadShutdown.
+  class AsyncServices : private Common::Interface
+  {
+  public:
+    DEFINE_CLASS_POINTERS(AsyncServices)
+
+    typedef std::function<void (StatusCode, std::vector<DataValue>)> ReadCallback;
+    typedef std::function<void (StatusCode, std::vector<StatusCode>)> WriteCallback;
+    typedef std::function<void (StatusCode, std::vector<BrowseResult>)> BrowseCallback;
+    typedef std::function<void (StatusCode, std::vector<CallMethodResult>)> CallCallback;
+
+  public:
+    virtual void Read(const ReadParameters& params, ReadCallback callback) = 0;
+    virtual void Write(const std::vector<WriteValue>& values, WriteCallback callback) = 0;
+    virtual void Browse(const NodesQuery& query, BrowseCallback callback) = 0;
+    virtual void Call(const std::vector<CallMethodRequest>& methodsToCall, CallCallback callback) = 0;
+  };
+
+} // namespace OpcUa
+
+#endif // OPC_UA_Client_ASYNC_H
@@ -15,6 +15,7 @@
 #include <opc/common/interface.h>
 #include <opc/ua/protocol/attribute_ids.h>
 #include <opc/ua/protocol/data_value.h>
+#include <opc/ua/protocol/history.h>
 #include <opc/ua/protocol/protocol.h>
 
 #include <vector>
@@ -30,6 +31,16 @@ namespace OpcUa
     public:
       virtual std::vector<DataValue> Read(const OpcUa::ReadParameters& filter) const = 0;
       virtual std::vector<StatusCode> Write(const std::vector<OpcUa::WriteValue>& filter) = 0;
+      //Services without history report every node as not supporting it
+      virtual std::vector<HistoryReadResult> HistoryRead(const OpcUa::HistoryReadParameters& params) const
+      {
+        std::vector<HistoryReadResult> results(params.NodesToRead.size());
+        for (HistoryReadResult& result : results)
+        {
+          result.Status = StatusCode::BadHistoryOperationUnsupported;
+        }
+        return results;
+      }
     };
 
 } // namespace OpcUa
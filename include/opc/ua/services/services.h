@@ -13,6 +13,7 @@
 #include <opc/common/class_pointers.h>
 #include <opc/ua/protocol/session.h>
 #include <opc/ua/protocol/secure_channel.h>
+#include <opc/ua/services/async.h>
 #include <opc/ua/services/attributes.h>
 #include <opc/ua/services/endpoints.h>
 #include <opc/ua/services/method.h>
@@ -58,6 +59,7 @@ namespace OpcUa
     virtual NodeManagementServices::SharedPtr NodeManagement() = 0;
     virtual SubscriptionServices::SharedPtr Subscriptions() = 0;
     virtual ViewServices::SharedPtr Views() = 0;
+    virtual AsyncServices::SharedPtr Async() = 0;
   };
 
 }
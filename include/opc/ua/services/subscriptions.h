@@ -30,6 +30,8 @@ namespace OpcUa
       virtual std::vector<StatusCode> DeleteSubscriptions(const std::vector<uint32_t>& subscriptions) = 0;
       virtual void Publish(const PublishRequest& request) = 0;
       virtual RepublishResponse Republish(const RepublishParameters& params) = 0;
+      // Move subscriptions of another session to the current one, their publish results are passed to callbackPublish.
+      virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsParameters& params, std::function<void (PublishResult)> callbackPublish) = 0;
 
       //FIXME: Spec says MonitoredItems methods should be in their own service
       virtual std::vector<MonitoredItemCreateResult> CreateMonitoredItems(const MonitoredItemsParameters& parameters) = 0;
@@ -29,6 +29,11 @@ namespace OpcUa
   public:
     virtual std::vector<BrowseResult> Browse(const OpcUa::NodesQuery& query) const = 0;
     virtual std::vector<BrowseResult> BrowseNext() const = 0;
+    /// @brief Free continuation points left by the last Browse or BrowseNext without browsing further.
+    /// Services which keep none have nothing to do.
+    virtual void ReleaseContinuationPoints() const
+    {
+    }
     virtual std::vector<BrowsePathResult> TranslateBrowsePathsToNodeIds(const TranslateBrowsePathsParameters& params) const = 0;
 	virtual std::vector<NodeId> RegisterNodes(const std::vector<NodeId>& params) const = 0;
 	virtual void UnregisterNodes(const std::vector<NodeId>& params) const = 0;
@@ -47,6 +47,19 @@ namespace OpcUa
   };
 
   typedef std::map<uint32_t, MonitoredItemData> AttValMap;
+
+  /// @brief Data changes of one notification message as parallel arrays, one entry per change.
+  /// Missing status is Good, missing timestamps are null.
+  struct DataChangeBatch
+  {
+    std::vector<uint32_t> ClientHandles;
+    std::vector<Variant> Values;
+    std::vector<StatusCode> Statuses;
+    std::vector<DateTime> SourceTimestamps;
+    std::vector<DateTime> ServerTimestamps;
+
+    std::size_t Size() const { return ClientHandles.size(); }
+  };
   typedef std::map<uint32_t, EventFilter> SimpleAttOpMap;
 
   class SubscriptionHandler
@@ -83,6 +96,17 @@ namespace OpcUa
       {
         OPCUA_UNUSED(status);
       }
+      /// @brief Return true to get all data changes of a notification message with one DataChanges call.
+      /// DataChange and DataValueChange are then not called.
+      virtual bool BatchDataChanges() const
+      {
+        return false;
+      }
+      virtual void DataChanges(uint32_t subscriptionId, const DataChangeBatch& changes)
+      {
+        OPCUA_UNUSED(subscriptionId);
+        OPCUA_UNUSED(changes);
+      }
   };
 
 
@@ -111,6 +135,9 @@ namespace OpcUa
       uint32_t SubscribeDataChange(const Node& node, AttributeId attr=AttributeId::Value);
       std::vector<uint32_t> SubscribeDataChange(const std::vector<ReadValueId>& attributes);
       
+      /// @brief Client handle used in DataChangeBatch for a monitored item, 0 if unknown.
+      uint32_t GetClientHandle(uint32_t monitoredItemId);
+
       // UserData pointer to have acces to user data in callback functions DataChange(),DataValueChange()
       void setUsrPtr(uint32_t handle,UserData *usr);
       UserData* getUsrPtr(uint32_t handle);
@@ -131,7 +158,7 @@ namespace OpcUa
       
       // Override this method if you want raw publish results from server
       // for example if you want to make sure you do not miss any packets, etc, ...
-      virtual void PublishCallback( Services::SharedPtr serverLocalPtr, const PublishResult result); 
+      virtual void PublishCallback( Services::SharedPtr serverLocalPtr, PublishResult result); 
 
       //Request republish of a notification from server
       //SequenceNumber are send by server in PublishResult struct
@@ -140,7 +167,8 @@ namespace OpcUa
 
 
     private:
-      void CallDataChangeCallback(const NotificationData& data);
+      void CallDataChangeCallback(NotificationData& data);
+      void CallDataChangeBatchCallback(NotificationData& data);
       void CallEventCallback(const NotificationData& data);
       void CallStatusChangeCallback(const NotificationData& data);
 
@@ -149,6 +177,7 @@ namespace OpcUa
       SubscriptionHandler& Client;
       uint32_t LastMonitoredItemHandle = 1;
       AttValMap AttributeValueMap; 
+      DataChangeBatch Changes; //reused between notifications, publish callbacks of a subscription never overlap
       SimpleAttOpMap SimpleAttributeOperandMap; //Not used currently
       std::mutex Mutex;
       bool Debug;
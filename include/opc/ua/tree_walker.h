@@ -0,0 +1,47 @@
+/// @brief Walking large address spaces with batched Browse requests.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/reference_ids.h>
+#include <opc/ua/services/view.h>
+
+#include <functional>
+
+namespace OpcUa
+{
+
+  struct TreeWalkParameters
+  {
+    NodeId ReferenceTypeId = ReferenceId::HierarchicalReferences;
+    bool IncludeSubtypes = true;
+    NodeClass NodeClasses = NodeClass::Unspecified;
+    /// @brief Fields of references filled by the server, TargetNodeId is always filled.
+    BrowseResultMask ResultMask = BrowseResultMask::BrowseName | BrowseResultMask::NodeClass;
+    /// @brief Number of nodes browsed with one request.
+    unsigned NodesPerRequest = 200;
+    uint32_t MaxReferencesPerNode = 1000;
+    /// @brief Levels below root to visit, 0 is unlimited.
+    unsigned MaxDepth = 0;
+    /// @brief Nodes waiting to be browsed. When more are queued the walk goes deeper first,
+    /// which stops the queue growing on address spaces narrowing down with depth.
+    /// It is no hard limit: all children of a browsed node are queued.
+    std::size_t MaxQueued = 100000;
+  };
+
+  /// @brief Called for every reference found, depth of references of root is 1.
+  /// Return false to not browse below the target of the reference.
+  typedef std::function<bool (const NodeId& parent, const ReferenceDescription& reference, unsigned depth)> TreeVisitor;
+
+  /// @brief Walk the tree below root level by level and pass every reference to the visitor
+  /// while responses arrive. Every node is browsed once even when it is referenced several times:
+  /// ids of all nodes found are kept until the walk ends, memory grows with the number of nodes.
+  /// @return number of references visited.
+  std::size_t WalkTree(ViewServices& views, const NodeId& root, TreeVisitor visitor, const TreeWalkParameters& params = TreeWalkParameters());
+
+} // namespace OpcUa
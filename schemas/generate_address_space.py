@@ -221,12 +221,12 @@ namespace OpcUa
 
     def make_node_code(self, obj, indent):
         self.writecode(indent, 'AddNodesItem node;')
-        self.writecode(indent, 'node.RequestedNewNodeId = ToNodeId("{}");'.format(obj.nodeid))
+        self.writecode(indent, 'node.RequestedNewNodeId = {};'.format(self.to_nodeid(obj.nodeid)))
         self.writecode(indent, 'node.BrowseName = ToQualifiedName("{}");'.format(obj.browsename))
         self.writecode(indent, 'node.Class = NodeClass::{};'.format(obj.nodetype))
-        if obj.parent: self.writecode(indent, 'node.ParentNodeId = ToNodeId("{}");'.format(obj.parent))
+        if obj.parent: self.writecode(indent, 'node.ParentNodeId = {};'.format(self.to_nodeid(obj.parent)))
         if obj.parent: self.writecode(indent, 'node.ReferenceTypeId = {};'.format(self.to_ref_type(obj.parentlink)))
-        if obj.typedef: self.writecode(indent, 'node.TypeDefinition = ToNodeId("{}");'.format(obj.typedef))
+        if obj.typedef: self.writecode(indent, 'node.TypeDefinition = {};'.format(self.to_nodeid(obj.typedef)))
 
     def to_vector(self, dims):
         s = "std::vector<uint32_t>{"
@@ -234,17 +234,32 @@ namespace OpcUa
         s+= "}"
         return s
 
+    def to_nodeid(self, nodeid):
+        # numeric ids are built directly so that nothing is parsed at startup
+        ns = 0
+        ident = nodeid
+        if nodeid.startswith("ns=") and ";" in nodeid:
+            nsstr, ident = nodeid[3:].split(";", 1)
+            if not nsstr.isdigit():
+                return 'ToNodeId("{}")'.format(nodeid)
+            ns = int(nsstr)
+        if ident.startswith("i=") and ident[2:].isdigit():
+            if ns:
+                return 'NumericNodeId({}, {})'.format(ident[2:], ns)
+            return 'NumericNodeId({})'.format(ident[2:])
+        return 'ToNodeId("{}")'.format(nodeid)
+
     def to_data_type(self, nodeid):
         if not nodeid:
             return "ObjectId::String"
         if "=" in nodeid:
-            return 'ToNodeId("{}")'.format(nodeid)
+            return self.to_nodeid(nodeid)
         else:
             return 'ObjectId::{}'.format(nodeid)
 
     def to_ref_type(self, nodeid):
         if "=" in nodeid:
-            return 'ToNodeId("{}")'.format(nodeid)
+            return self.to_nodeid(nodeid)
         else:
             return 'ReferenceId::{}'.format(nodeid)
 
@@ -356,9 +371,9 @@ namespace OpcUa
             self.writecode(indent, 'AddReferencesItem ref;')
             self.writecode(indent, 'ref.IsForward = true;')
             self.writecode(indent, 'ref.ReferenceTypeId = {};'.format(self.to_ref_type(ref.reftype)))
-            self.writecode(indent, 'ref.SourceNodeId = ToNodeId("{}");'.format(obj.nodeid))
+            self.writecode(indent, 'ref.SourceNodeId = {};'.format(self.to_nodeid(obj.nodeid)))
             self.writecode(indent, 'ref.TargetNodeClass = NodeClass::DataType;')
-            self.writecode(indent, 'ref.TargetNodeId = ToNodeId("{}");'.format(ref.target))
+            self.writecode(indent, 'ref.TargetNodeId = {};'.format(self.to_nodeid(ref.target)))
             self.writecode(indent, "refs.push_back(ref);")
             self.writecode(indent, "}")
         self.writecode(indent, 'registry.AddReferences(refs);')
@@ -0,0 +1,416 @@
+/// @brief Batching of attribute reads and writes on client side.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/batch.h>
+
+#include <opc/ua/protocol/object_ids.h>
+
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+  using namespace OpcUa;
+
+  template <typename Item, typename Result, typename Send>
+  std::vector<Result> SendInBatches(const std::vector<Item>& items, uint32_t limit, Send send)
+  {
+    if (limit == 0 || items.size() <= limit)
+    {
+      return send(items);
+    }
+
+    std::vector<Result> results;
+    results.reserve(items.size());
+    for (std::size_t begin = 0; begin < items.size(); begin += limit)
+    {
+      const std::size_t end = std::min<std::size_t>(begin + limit, items.size());
+      const std::vector<Result> part = send(std::vector<Item>(items.begin() + begin, items.begin() + end));
+      results.insert(results.end(), part.begin(), part.end());
+    }
+    return results;
+  }
+
+  // Gathers items of concurrent calls into one batch, the way Nagle's algorithm does.
+  // First caller of a batch sends it at once if no other batch is being sent.
+  // Otherwise it waits until the batch being sent is done, the batch reaches limit or window expires.
+  // Other callers wait until results are there. A lone caller is never delayed.
+  template <typename Key, typename Item, typename Result>
+  class Coalescer
+  {
+  public:
+    typedef std::function<std::vector<Result> (const Key&, const std::vector<Item>&)> SendFunction;
+
+    Coalescer(std::chrono::milliseconds window, uint32_t limit, SendFunction send)
+      : Window(window)
+      , Limit(limit)
+      , Send(send)
+    {
+    }
+
+    std::vector<Result> Process(const Key& key, const std::vector<Item>& items)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      if (Open && !(Open->BatchKey == key))
+      {
+        lock.unlock();
+        return Send(key, items);
+      }
+
+      std::shared_ptr<Batch> batch = Open;
+      const bool leader = !batch;
+      if (leader)
+      {
+        batch.reset(new Batch());
+        batch->BatchKey = key;
+        Open = batch;
+      }
+      const std::size_t offset = batch->Items.size();
+      batch->Items.insert(batch->Items.end(), items.begin(), items.end());
+
+      if (leader)
+      {
+        BatchFull.wait_for(lock, Window, [this, &batch]() { return Sending == 0 || IsFull(*batch); });
+        Open.reset();
+        ++Sending;
+        lock.unlock();
+        try
+        {
+          batch->Results = Send(batch->BatchKey, batch->Items);
+        }
+        catch (...)
+        {
+          batch->Error = std::current_exception();
+        }
+        lock.lock();
+        --Sending;
+        batch->Done = true;
+        BatchDone.notify_all();
+        // Next open batch can be sent now.
+        BatchFull.notify_all();
+      }
+      else
+      {
+        if (IsFull(*batch))
+        {
+          BatchFull.notify_all();
+        }
+        BatchDone.wait(lock, [&batch]() { return batch->Done; });
+      }
+      lock.unlock();
+
+      if (batch->Error)
+      {
+        std::rethrow_exception(batch->Error);
+      }
+      if (batch->Results.size() < offset + items.size())
+      {
+        throw std::runtime_error("Server returned less results than requested.");
+      }
+      return std::vector<Result>(batch->Results.begin() + offset, batch->Results.begin() + offset + items.size());
+    }
+
+  private:
+    struct Batch
+    {
+      Key BatchKey;
+      std::vector<Item> Items;
+      std::vector<Result> Results;
+      std::exception_ptr Error;
+      bool Done = false;
+    };
+
+    bool IsFull(const Batch& batch) const
+    {
+      return Limit != 0 && batch.Items.size() >= Limit;
+    }
+
+  private:
+    const std::chrono::milliseconds Window;
+    const uint32_t Limit;
+    const SendFunction Send;
+    std::mutex Mutex;
+    std::condition_variable BatchFull;
+    std::condition_variable BatchDone;
+    std::shared_ptr<Batch> Open;
+    unsigned Sending = 0;
+  };
+
+  typedef std::pair<double, TimestampsToReturn> ReadKey;
+
+  class BatchingServices
+    : public Services
+    , public AttributeServices
+    , public std::enable_shared_from_this<BatchingServices>
+  {
+  public:
+    BatchingServices(Services::SharedPtr services, std::chrono::milliseconds window, const BatchLimits& limits)
+      : Server(services)
+      , Attribute(services->Attributes())
+      , Reads(window, limits.MaxNodesPerRead, [this, limits](const ReadKey& key, const std::vector<ReadValueId>& ids)
+          {
+            ReadParameters params;
+            params.MaxAge = key.first;
+            params.TimestampsToReturn = key.second;
+            params.AttributesToRead = ids;
+            return ReadInBatches(*Attribute, params, limits.MaxNodesPerRead);
+          })
+      , Writes(window, limits.MaxNodesPerWrite, [this, limits](const int&, const std::vector<WriteValue>& values)
+          {
+            return WriteInBatches(*Attribute, values, limits.MaxNodesPerWrite);
+          })
+    {
+    }
+
+    virtual OpenSecureChannelResponse OpenSecureChannel(const OpenSecureChannelParameters& parameters) override
+    {
+      return Server->OpenSecureChannel(parameters);
+    }
+
+    virtual void CloseSecureChannel(uint32_t channelId) override
+    {
+      Server->CloseSecureChannel(channelId);
+    }
+
+    virtual CreateSessionResponse CreateSession(const RemoteSessionParameters& parameters) override
+    {
+      return Server->CreateSession(parameters);
+    }
+
+    virtual ActivateSessionResponse ActivateSession(const ActivateSessionParameters& parameters) override
+    {
+      return Server->ActivateSession(parameters);
+    }
+
+    virtual CloseSessionResponse CloseSession() override
+    {
+      return Server->CloseSession();
+    }
+
+    virtual void AbortSession() override
+    {
+      Server->AbortSession();
+    }
+
+    virtual DeleteNodesResponse DeleteNodes(const std::vector<OpcUa::DeleteNodesItem>& nodesToDelete) override
+    {
+      return Server->DeleteNodes(nodesToDelete);
+    }
+
+    virtual AttributeServices::SharedPtr Attributes() override
+    {
+      return shared_from_this();
+    }
+
+    virtual EndpointServices::SharedPtr Endpoints() override
+    {
+      return Server->Endpoints();
+    }
+
+    virtual MethodServices::SharedPtr Method() override
+    {
+      return Server->Method();
+    }
+
+    virtual NodeManagementServices::SharedPtr NodeManagement() override
+    {
+      return Server->NodeManagement();
+    }
+
+    virtual SubscriptionServices::SharedPtr Subscriptions() override
+    {
+      return Server->Subscriptions();
+    }
+
+    virtual ViewServices::SharedPtr Views() override
+    {
+      return Server->Views();
+    }
+
+    virtual AsyncServices::SharedPtr Async() override
+    {
+      return Server->Async();
+    }
+
+    virtual std::vector<DataValue> Read(const ReadParameters& params) const override
+    {
+      return Reads.Process(ReadKey(params.MaxAge, params.TimestampsToReturn), params.AttributesToRead);
+    }
+
+    virtual std::vector<StatusCode> Write(const std::vector<WriteValue>& values) override
+    {
+      return Writes.Process(0, values);
+    }
+
+    virtual std::vector<HistoryReadResult> HistoryRead(const HistoryReadParameters& params) const override
+    {
+      return Attribute->HistoryRead(params);
+    }
+
+  private:
+    Services::SharedPtr Server;
+    AttributeServices::SharedPtr Attribute;
+    mutable Coalescer<ReadKey, ReadValueId, DataValue> Reads;
+    Coalescer<int, WriteValue, StatusCode> Writes;
+  };
+
+  uint32_t ReadLimit(const DataValue& value)
+  {
+    if (value.Status != StatusCode::Good || value.Value.Type() != VariantType::UINT32 || value.Value.IsArray())
+    {
+      return 0;
+    }
+    return value.Value.As<uint32_t>();
+  }
+
+}
+
+namespace OpcUa
+{
+
+  BatchLimits GetBatchLimits(Services& services)
+  {
+    ReadParameters params;
+    params.AttributesToRead.push_back(ToReadValueId(ObjectId::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead, AttributeId::Value));
+    params.AttributesToRead.push_back(ToReadValueId(ObjectId::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite, AttributeId::Value));
+
+    BatchLimits limits;
+    const std::vector<DataValue> values = services.Attributes()->Read(params);
+    if (values.size() == 2)
+    {
+      limits.MaxNodesPerRead = ReadLimit(values[0]);
+      limits.MaxNodesPerWrite = ReadLimit(values[1]);
+    }
+    return limits;
+  }
+
+  std::vector<DataValue> ReadInBatches(AttributeServices& attributes, const ReadParameters& params, uint32_t maxNodesPerRead)
+  {
+    return SendInBatches<ReadValueId, DataValue>(params.AttributesToRead, maxNodesPerRead, [&attributes, &params](const std::vector<ReadValueId>& ids)
+    {
+      ReadParameters part;
+      part.MaxAge = params.MaxAge;
+      part.TimestampsToReturn = params.TimestampsToReturn;
+      part.AttributesToRead = ids;
+      return attributes.Read(part);
+    });
+  }
+
+  std::vector<StatusCode> WriteInBatches(AttributeServices& attributes, const std::vector<WriteValue>& values, uint32_t maxNodesPerWrite)
+  {
+    return SendInBatches<WriteValue, StatusCode>(values, maxNodesPerWrite, [&attributes](const std::vector<WriteValue>& part)
+    {
+      return attributes.Write(part);
+    });
+  }
+
+  Services::SharedPtr CreateBatchingServices(Services::SharedPtr services, std::chrono::milliseconds window, const BatchLimits& limits)
+  {
+    return Services::SharedPtr(new BatchingServices(services, window, limits));
+  }
+
+  AttributeBatch::AttributeBatch(Services::SharedPtr services, const BatchLimits& limits)
+    : Server(services)
+    , Limits(limits)
+  {
+  }
+
+  AttributeBatch::~AttributeBatch()
+  {
+    try
+    {
+      Flush();
+    }
+    catch (const std::exception& exc)
+    {
+      std::cerr << "AttributeBatch | Failed to flush batch: " << exc.what() << std::endl;
+    }
+  }
+
+  std::shared_future<DataValue> AttributeBatch::Read(const NodeId& node, AttributeId attribute)
+  {
+    Reads.AttributesToRead.push_back(ToReadValueId(node, attribute));
+    ReadResults.push_back(std::promise<DataValue>());
+    return ReadResults.back().get_future().share();
+  }
+
+  std::shared_future<StatusCode> AttributeBatch::Write(const NodeId& node, AttributeId attribute, const DataValue& value)
+  {
+    WriteValue write;
+    write.NodeId = node;
+    write.AttributeId = attribute;
+    write.Value = value;
+    Writes.push_back(write);
+    WriteResults.push_back(std::promise<StatusCode>());
+    return WriteResults.back().get_future().share();
+  }
+
+  void AttributeBatch::Flush()
+  {
+    ReadParameters reads;
+    std::swap(reads, Reads);
+    std::vector<std::promise<DataValue>> readResults;
+    std::swap(readResults, ReadResults);
+    std::vector<WriteValue> writes;
+    std::swap(writes, Writes);
+    std::vector<std::promise<StatusCode>> writeResults;
+    std::swap(writeResults, WriteResults);
+
+    std::exception_ptr error;
+    if (!readResults.empty())
+    {
+      try
+      {
+        const std::vector<DataValue> values = ReadInBatches(*Server->Attributes(), reads, Limits.MaxNodesPerRead);
+        for (std::size_t i = 0; i < readResults.size(); ++i)
+        {
+          if (i < values.size())
+            readResults[i].set_value(values[i]);
+          else
+            readResults[i].set_exception(std::make_exception_ptr(std::runtime_error("Server returned less results than requested.")));
+        }
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+        for (std::promise<DataValue>& result : readResults)
+          result.set_exception(error);
+      }
+    }
+
+    if (!writeResults.empty())
+    {
+      try
+      {
+        const std::vector<StatusCode> codes = WriteInBatches(*Server->Attributes(), writes, Limits.MaxNodesPerWrite);
+        for (std::size_t i = 0; i < writeResults.size(); ++i)
+        {
+          if (i < codes.size())
+            writeResults[i].set_value(codes[i]);
+          else
+            writeResults[i].set_exception(std::make_exception_ptr(std::runtime_error("Server returned less results than requested.")));
+        }
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+        for (std::promise<StatusCode>& result : writeResults)
+          result.set_exception(error);
+      }
+    }
+
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+} // namespace OpcUa
@@ -10,6 +10,7 @@
 
 #include <opc/ua/protocol/utils.h>
 #include <opc/ua/client/binary_client.h>
+#include <opc/ua/client/callback_dispatcher.h>
 #include <opc/ua/client/remote_connection.h>
 
 #include <opc/common/uri_facade.h>
@@ -20,11 +21,16 @@
 #include <opc/ua/protocol/string_utils.h>
 #include <opc/ua/services/services.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <thread>
 #include <iostream>
 
@@ -37,43 +43,105 @@ namespace
 
   typedef std::map<uint32_t, std::function<void (PublishResult)>> SubscriptionCallbackMap;
 
-  class BufferInputChannel : public OpcUa::InputChannel
+  const Duration DefaultPublishingInterval = 1000;
+
+  typedef std::function<ChunkType (std::vector<char>& body)> ChunkSource;
+
+  // Reads a message straight from the bodies of its chunks. When the body in the buffer
+  // is used up the next chunk is received into the same buffer, so large responses are
+  // decoded while they arrive and never held in memory at once.
+  class ChunkInputChannel : public OpcUa::InputChannel
   {
   public:
-     BufferInputChannel(const std::vector<char>& buffer)
-       : Buffer(buffer)
-       , Pos(0)
-     {
-       Reset();
-     }
-
-     virtual std::size_t Receive(char* data, std::size_t size)
-     {
-       if (Pos >= Buffer.size())
-       {
-         return 0;
-       }
-
-       size = std::min(size, Buffer.size() - Pos);
-       std::vector<char>::const_iterator begin = Buffer.begin() + Pos;
-       std::vector<char>::const_iterator end = begin + size;
-       std::copy(begin, end, data);
-       Pos += size;
-       return size;
-     }
-
-     void Reset()
-     {
-       Pos = 0;
-     }
-
-     virtual void Stop()
-     {
-     }
+    ChunkInputChannel(std::vector<char>& body, ChunkType chunk, ChunkSource next)
+      : Body(body)
+      , Chunk(chunk)
+      , Next(next)
+    {
+    }
+
+    virtual std::size_t Receive(char* data, std::size_t size)
+    {
+      std::size_t received = 0;
+      while (received < size)
+      {
+        if (!Recording && HeadPos < Head.size())
+        {
+          const std::size_t count = std::min(size - received, Head.size() - HeadPos);
+          std::memcpy(data + received, Head.data() + HeadPos, count);
+          HeadPos += count;
+          received += count;
+          continue;
+        }
+        if (Pos == Body.size())
+        {
+          if (IsLast())
+          {
+            break;
+          }
+          ReceiveNext();
+          continue;
+        }
+        const std::size_t count = std::min(size - received, Body.size() - Pos);
+        std::memcpy(data + received, Body.data() + Pos, count);
+        Pos += count;
+        received += count;
+      }
+      return received;
+    }
+
+    // Read again from the start of the message. Chunks passed while reading the headers
+    // were kept aside, usually the headers fit into the first chunk and nothing is copied.
+    void ReplayHeaders()
+    {
+      Recording = false;
+      HeadPos = 0;
+      Pos = 0;
+    }
+
+    // Skip what was not read, the next message starts after the last chunk.
+    void Drain()
+    {
+      while (!IsLast())
+      {
+        ReceiveNext();
+      }
+      Pos = Body.size();
+    }
+
+    virtual void Stop()
+    {
+    }
+
+  private:
+    bool IsLast() const
+    {
+      // CHT_FINAL is the abort chunk, the message ends without its remaining data
+      return Chunk == CHT_SINGLE || Chunk == CHT_FINAL;
+    }
+
+    void ReceiveNext()
+    {
+      if (Recording)
+      {
+        Head.insert(Head.end(), Body.begin(), Body.end());
+      }
+      Chunk = Next(Body);
+      if (Chunk == CHT_FINAL)
+      {
+        Body.clear();
+      }
+      Pos = 0;
+    }
 
   private:
-    const std::vector<char>& Buffer;
-    std::size_t Pos;
+    std::vector<char>& Body;
+    ChunkType Chunk;
+    ChunkSource Next;
+    std::size_t Pos = 0;
+    std::vector<char> Head;
+    std::size_t HeadPos = 0;
+    bool Recording = true;
   };
 
 
@@ -86,100 +154,62 @@ namespace
     {
     }
 
-    void OnData(std::vector<char> data, ResponseHeader h)
+    // Called from the receive thread, the response is decoded there while it arrives.
+    void OnData(IStreamBinary* response, ResponseHeader h)
     {
-      //PrintBlob(data);
-      Data = std::move(data);
-	  this->header = std::move(h);
+      T result;
+      std::exception_ptr error;
+      if (!response)
+      {
+        if (h.ServiceResult == StatusCode::Good)
+          std::cout << "Error: received empty packet from server" << std::endl;
+        result.Header = std::move(h);
+      }
+      else
+      {
+        try
+        {
+          *response >> result;
+        }
+        catch (const std::exception&)
+        {
+          error = std::current_exception();
+        }
+      }
+
+      std::unique_lock<std::mutex> dataLock(m);
+      Result = std::move(result);
+      Error = error;
+      Ready = true;
       doneEvent.notify_all();
     }
 
     T WaitForData(std::chrono::milliseconds msec)
     {
-	  if (doneEvent.wait_for(lock, msec) == std::cv_status::timeout)
+	  // response may come before waiting starts
+	  const bool ready = doneEvent.wait_for(lock, msec, [this]() { return Ready; });
+	  // the receive thread may release this object last
+	  lock.unlock();
+	  if (!ready)
+	  {
 		  throw std::runtime_error("Response timed out");
-
-      T result;
-	  result.Header = std::move(this->header);
-      if ( Data.empty() )
-      {
-        std::cout << "Error: received empty packet from server" << std::endl;
-      }
-	  else
+	  }
+	  if (Error)
 	  {
-		  BufferInputChannel bufferInput(Data);
-		  IStreamBinary in(bufferInput);
-		  in >> result;
+		  std::rethrow_exception(Error);
 	  }
-      return result;
+      return std::move(Result);
     }
 
   private:
-    std::vector<char> Data;
-	ResponseHeader	  header;
+    T Result;
+    std::exception_ptr Error;
+    bool Ready = false;
     std::mutex m;
     std::unique_lock<std::mutex> lock;
     std::condition_variable doneEvent;
   };
 
-  class CallbackThread
-  {
-    public:
-      CallbackThread(bool debug=false) : Debug(debug), StopRequest(false)
-      {
-
-      }
-
-      void post(std::function<void()> callback)
-      {
-        if (Debug)  { std::cout << "binary_client| CallbackThread :  start post" << std::endl; }
-        std::unique_lock<std::mutex> lock(Mutex);
-        Queue.push(callback);
-        Condition.notify_one();
-        if (Debug)  { std::cout << "binary_client| CallbackThread :  end post" << std::endl; }
-      }
-
-      void Run()
-      {
-        while (true)
-        {
-          if (Debug)  { std::cout << "binary_client| CallbackThread : waiting for next post" << std::endl; }
-          std::unique_lock<std::mutex> lock(Mutex);
-          Condition.wait(lock, [&]() { return (StopRequest == true) || ( ! Queue.empty() ) ;} );
-          if (StopRequest)
-          {
-            if (Debug)  { std::cout << "binary_client| CallbackThread : exited." << std::endl; }
-            return;
-          }
-          while ( ! Queue.empty() ) //to avoid crashing on spurious events
-          {
-            if (Debug)  { std::cout << "binary_client| CallbackThread : condition has triggered copying callback and poping. queue size is  " << Queue.size() << std::endl; }
-            std::function<void()> callbackcopy = Queue.front();
-            Queue.pop();
-            lock.unlock();
-            if (Debug)  { std::cout << "binary_client| CallbackThread : now calling callback." << std::endl; }
-            callbackcopy();
-            if (Debug)  { std::cout << "binary_client| CallbackThread : callback called." << std::endl; }
-            lock.lock();
-          }
-        }
-      }
-
-      void Stop()
-      {
-        if (Debug)  { std::cout << "binary_client| CallbackThread : stopping." << std::endl; }
-        StopRequest = true;
-        Condition.notify_all();
-      }
-
-    private:
-      bool Debug = false;
-      std::mutex Mutex;
-      std::condition_variable Condition;
-      std::atomic<bool> StopRequest;
-      std::queue<std::function<void()>> Queue;
-  };
-
   class BinaryClient
     : public Services
     , public AttributeServices
@@ -188,12 +218,14 @@ namespace
     , public NodeManagementServices
     , public SubscriptionServices
     , public ViewServices
+    , public AsyncServices
     , public std::enable_shared_from_this<BinaryClient>
   {
   private:
-    typedef std::function<void(std::vector<char>, ResponseHeader)> ResponseCallback;
+    // Response is null when only the header is known, e.g. on timeout or closed connection.
+    typedef std::function<void(IStreamBinary* response, ResponseHeader)> ResponseCallback;
     typedef std::map<uint32_t, ResponseCallback> CallbackMap;
-		std::vector<char> messageBuffer;
+    typedef std::map<uint32_t, std::chrono::steady_clock::time_point> DeadlineMap;
 
   public:
     BinaryClient(std::shared_ptr<IOChannel> channel, const SecureConnectionParams& params, bool debug)
@@ -204,11 +236,13 @@ namespace
       , RequestNumber(1)
       , RequestHandle(0)
       , Debug(debug)
-      , CallbackService(debug)
+      , Dispatcher(params.Dispatcher ? params.Dispatcher : std::make_shared<CallbackDispatcher>(1, debug))
+      , OwnDispatcher(!params.Dispatcher)
+      , Pending(std::make_shared<PendingState>())
+      , Window(params.MaxPublishRequests)
 
     {
-      //Initialize the worker thread for subscriptions
-      callback_thread = std::thread([&](){ CallbackService.Run(); });
+      timeout_thread = std::thread([this](){ CheckTimeouts(); });
 
       HelloServer(params);
 
@@ -223,6 +257,7 @@ namespace
           if (Finished) return;
           if (Debug)  { std::cerr << "binary_client| ReceiveThread : Error receiving data: "; }
           std::cerr << exc.what() << std::endl;
+          OnConnectionLost();
         }
       }));
     }
@@ -231,16 +266,30 @@ namespace
     {
       Finished = true;
 
-      if (Debug) std::cout << "binary_client| Stopping callback thread." << std::endl;
-      CallbackService.Stop();
-      if (Debug) std::cout << "binary_client| Joining service thread." << std::endl;
-      callback_thread.join(); //Not sure it is necessary
+      if (OwnDispatcher)
+      {
+        if (Debug) std::cout << "binary_client| Stopping callback dispatcher." << std::endl;
+        Dispatcher->Stop();
+      }
 
       Channel->Stop();
       if (Debug) std::cout << "binary_client| Joining receive thread." << std::endl;
       ReceiveThread.join();
       if (Debug) std::cout << "binary_client| Receive thread stopped." << std::endl;
 
+      {
+        std::unique_lock<std::mutex> lock(Mutex);
+        TimeoutCondition.notify_all();
+      }
+      timeout_thread.join();
+      CompletePending(StatusCode::BadShutdown, [](const std::chrono::steady_clock::time_point&) { return true; });
+
+      // Client may be destroyed by one of its callbacks, which cannot be waited for
+      if (Debug) std::cout << "binary_client| Waiting for callbacks posted to dispatcher." << std::endl;
+      std::unique_lock<std::mutex> lock(Pending->Mutex);
+      const std::thread::id self = std::this_thread::get_id();
+      Pending->Condition.wait(lock, [this, self]() { return Pending->Count == Pending->Calling.count(self); });
+
       if (Debug) std::cout << "binary_client| Destroyed." << std::endl;
     }
 
@@ -348,6 +397,64 @@ namespace
       return response.Results;
     }
 
+    virtual std::vector<HistoryReadResult> HistoryRead(const HistoryReadParameters& params) const
+    {
+      if (Debug)  { std::cout << "binary_client| HistoryRead -->" << std::endl; }
+      HistoryReadRequest request;
+      request.Parameters = params;
+      const HistoryReadResponse response = Send<HistoryReadResponse>(request);
+      if (Debug)  { std::cout << "binary_client| HistoryRead <--" << std::endl; }
+      return response.Results;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Asynchronous Services
+    ////////////////////////////////////////////////////////////////
+    virtual std::shared_ptr<AsyncServices> Async() override
+    {
+      return shared_from_this();
+    }
+
+    virtual void Read(const ReadParameters& params, ReadCallback callback)
+    {
+      if (Debug)  { std::cout << "binary_client| Async Read -->" << std::endl; }
+      ReadRequest request;
+      request.Parameters = params;
+      SendAsync<ReadResponse>(request, [callback](const ReadResponse& response){
+        callback(response.Header.ServiceResult, response.Results);
+      });
+    }
+
+    virtual void Write(const std::vector<WriteValue>& values, WriteCallback callback)
+    {
+      if (Debug)  { std::cout << "binary_client| Async Write -->" << std::endl; }
+      WriteRequest request;
+      request.Parameters.NodesToWrite = values;
+      SendAsync<WriteResponse>(request, [callback](const WriteResponse& response){
+        callback(response.Header.ServiceResult, response.Results);
+      });
+    }
+
+    virtual void Browse(const NodesQuery& query, BrowseCallback callback)
+    {
+      if (Debug)  { std::cout << "binary_client| Async Browse -->" << std::endl; }
+      BrowseRequest request;
+      request.Query = query;
+      SendAsync<BrowseResponse>(request, [callback](const BrowseResponse& response){
+        callback(response.Header.ServiceResult, response.Results);
+      });
+    }
+
+    virtual void Call(const std::vector<CallMethodRequest>& methodsToCall, CallCallback callback)
+    {
+      if (Debug)  { std::cout << "binary_client| Async Call -->" << std::endl; }
+      CallRequest request;
+      request.Parameters.MethodsToCall = methodsToCall;
+      SendAsync<CallResponse>(request, [callback](const CallResponse& response){
+        callback(response.Header.ServiceResult, response.Results);
+      });
+    }
+
     ////////////////////////////////////////////////////////////////
     /// Endpoint Services
     ////////////////////////////////////////////////////////////////
@@ -454,7 +561,12 @@ namespace
       if (Debug)  { std::cout << "binary_client| CreateSubscription -->" << std::endl; }
       const CreateSubscriptionResponse response = Send<CreateSubscriptionResponse>(request);
       if (Debug) std::cout << "BinaryClient | got CreateSubscriptionResponse" << std::endl;
+      std::unique_lock<std::mutex> lock(Mutex);
       PublishCallbacks[response.Data.SubscriptionId] = callback;// TODO Pass calback to the Publish method.
+      lock.unlock();
+      std::unique_lock<std::mutex> publishLock(PublishMutex);
+      Window.SetInterval(response.Data.SubscriptionId, response.Data.RevisedPublishingInterval);
+      publishLock.unlock();
       if (Debug)  { std::cout << "binary_client| CreateSubscription <--" << std::endl; }
       return response.Data;
     }
@@ -465,6 +577,16 @@ namespace
       DeleteSubscriptionsRequest request;
       request.SubscriptionIds = subscriptions;
       const DeleteSubscriptionsResponse response = Send<DeleteSubscriptionsResponse>(request);
+      std::unique_lock<std::mutex> publishLock(PublishMutex);
+      for (uint32_t id : subscriptions)
+      {
+        Window.RemoveInterval(id);
+      }
+      PendingAcks.erase(std::remove_if(PendingAcks.begin(), PendingAcks.end(), [&subscriptions](const SubscriptionAcknowledgement& ack)
+        {
+          return std::find(subscriptions.begin(), subscriptions.end(), ack.SubscriptionId) != subscriptions.end();
+        }), PendingAcks.end());
+      publishLock.unlock();
       if (Debug)  { std::cout << "binary_client| DeleteSubscriptions <--" << std::endl; }
       return response.Results;
     }
@@ -489,66 +611,59 @@ namespace
       return response.Results;
     }
 
+    // Acknowledgements are sent with the next publish request, the client itself keeps
+    // the publish pipeline filled. Requests are only sent when the pipeline has room.
     virtual void Publish(const PublishRequest& originalrequest)
     {
       if (Debug) {std::cout << "binary_client| Publish -->" << "request with " << originalrequest.SubscriptionAcknowledgements.size() << " acks" << std::endl;}
-      PublishRequest request(originalrequest);
-      request.Header = CreateRequestHeader();
-      request.Header.Timeout = 0; //We do not want the request to timeout!
+      std::unique_lock<std::mutex> lock(PublishMutex);
+      PendingAcks.insert(PendingAcks.end(), originalrequest.SubscriptionAcknowledgements.begin(), originalrequest.SubscriptionAcknowledgements.end());
+      PublishFailed = false;
+      lock.unlock();
 
-      ResponseCallback responseCallback = [this](std::vector<char> buffer, ResponseHeader h){
-        if (Debug) {std::cout << "BinaryClient | Got Publish Response, from server " << std::endl;}
-		PublishResponse response;
-		if (h.ServiceResult != OpcUa::StatusCode::Good)
+      SendPublishRequests(true);
+      if (Debug) { std::cout << "binary_client| Publish  <--" << std::endl; }
+    }
+
+	virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsParameters& params, std::function<void (PublishResult)> callback)
+	{
+		if (Debug) { std::cout << "binary_client| TransferSubscriptions -->" << std::endl; }
+		TransferSubscriptionsRequest request;
+		request.Parameters = params;
+		TransferSubscriptionsResponse response;
+		try
 		{
-			response.Header = std::move(h);
+			response = Send<TransferSubscriptionsResponse>(request);
 		}
-		else
+		catch (const std::exception& exc)
 		{
-			BufferInputChannel bufferInput(buffer);
-			IStreamBinary in(bufferInput);
-			in >> response;
+			// Servers without the service answer with a fault
+			if (Debug) { std::cout << "binary_client| TransferSubscriptions failed: " << exc.what() << std::endl; }
+			response.Header.ServiceResult = StatusCode::BadServiceUnsupported;
+		}
+		std::vector<TransferResult> results = response.Parameters.Results;
+		if (response.Header.ServiceResult != StatusCode::Good || results.size() != params.SubscriptionIds.size())
+		{
+			TransferResult failed;
+			failed.Status = response.Header.ServiceResult != StatusCode::Good ? response.Header.ServiceResult : StatusCode::BadUnexpectedError;
+			results.assign(params.SubscriptionIds.size(), failed);
 		}
 
-        CallbackService.post([this, response]()
-            {
-			if (response.Header.ServiceResult == OpcUa::StatusCode::Good)
-			{
-				if (Debug) { std::cout << "BinaryClient | Calling callback for Subscription " << response.Parameters.SubscriptionId << std::endl; }
-				SubscriptionCallbackMap::const_iterator callbackIt = this->PublishCallbacks.find(response.Parameters.SubscriptionId);
-				if (callbackIt == this->PublishCallbacks.end())
-				{
-					std::cout << "BinaryClient | Error Unknown SubscriptionId " << response.Parameters.SubscriptionId << std::endl;
-				}
-				else
-				{
-					try { //calling client code, better put it under try/catch otherwise we crash entire client
-						callbackIt->second(response.Parameters);
-					}
-					catch (const std::exception& ex)
-					{
-						std::cout << "Error calling application callback " << ex.what() << std::endl;
-					}
-				}
-			}
-			else if (response.Header.ServiceResult == OpcUa::StatusCode::BadSessionClosed)
-			{
-				if (Debug)
-				{
-					std::cout << "BinaryClient | Session is closed";
-				}
-			}
-			else
+		std::unique_lock<std::mutex> lock(Mutex);
+		std::unique_lock<std::mutex> publishLock(PublishMutex);
+		for (std::size_t i = 0; i < results.size(); ++i)
+		{
+			if (results[i].Status == StatusCode::Good)
 			{
-				// TODO
+				PublishCallbacks[params.SubscriptionIds[i]] = callback;
+				// Publishing interval of a transferred subscription is not known here
+				Window.SetInterval(params.SubscriptionIds[i], DefaultPublishingInterval);
 			}
-			});
-	  };
-	  std::unique_lock<std::mutex> lock(Mutex);
-	  Callbacks.insert(std::make_pair(request.Header.RequestHandle, responseCallback));
-	  lock.unlock();
-	  Send(request);
-	  if (Debug) { std::cout << "binary_client| Publish  <--" << std::endl; }
+		}
+		publishLock.unlock();
+		lock.unlock();
+		if (Debug) { std::cout << "binary_client| TransferSubscriptions <--" << std::endl; }
+		return results;
 	}
 
 	virtual RepublishResponse Republish(const RepublishParameters& params)
@@ -676,16 +791,20 @@ namespace
 		}
 	}
 
-  private:
-    //FIXME: this method should be removed, better add realease option to BrowseNext
-    void Release() const
+    virtual void ReleaseContinuationPoints() const override
     {
-      ContinuationPoints.clear();
-      BrowseNext();
+      if (ContinuationPoints.empty())
+      {
+        return;
+      }
+      if (Debug)  { std::cout << "binary_client| BrowseNext release -->" << std::endl; }
+      BrowseNextRequest request;
+      request.ReleaseContinuationPoints = true;
+      request.ContinuationPoints.swap(ContinuationPoints);
+      Send<BrowseNextResponse>(request);
+      if (Debug)  { std::cout << "binary_client| BrowseNext release <--" << std::endl; }
     }
 
-  public:
-
     ////////////////////////////////////////////////////////////////
     /// SecureChannel Services
     ////////////////////////////////////////////////////////////////
@@ -712,16 +831,10 @@ namespace
         SecureHeader hdr(MT_SECURE_CLOSE, CHT_SINGLE, ChannelSecurityToken.SecureChannelId);
 
         const SymmetricAlgorithmHeader algorithmHeader = CreateAlgorithmHeader();
-        hdr.AddSize(RawSize(algorithmHeader));
-
         const SequenceHeader sequence = CreateSequenceHeader();
-        hdr.AddSize(RawSize(sequence));
-
         CloseSecureChannelRequest request;
         //request. ChannelId = channelId; FIXME: spec says it hsould be here, in practice it is not even sent?!?!
-        hdr.AddSize(RawSize(request));
-
-        Stream << hdr << algorithmHeader << sequence << request << flush;
+        WriteMessage(Stream, hdr, algorithmHeader, sequence, request);
         if (Debug) {std::cout << "binary_client| Secure channel closed." << std::endl;}
       }
       catch (const std::exception& exc)
@@ -735,21 +848,32 @@ private:
     template <typename Response, typename Request>
     Response Send(Request request) const
     {
+      if (Broken)
+      {
+        throw std::runtime_error("binary_client| Connection closed");
+      }
       request.Header = CreateRequestHeader();
 
-      RequestCallback<Response> requestCallback;
-      ResponseCallback responseCallback = [&requestCallback](std::vector<char> buffer, ResponseHeader h){
-        requestCallback.OnData(std::move(buffer), std::move(h));
+      // shared with the receive thread which may still decode after a timeout
+      std::shared_ptr<RequestCallback<Response>> requestCallback(new RequestCallback<Response>());
+      ResponseCallback responseCallback = [requestCallback](IStreamBinary* response, ResponseHeader h){
+        requestCallback->OnData(response, std::move(h));
       };
       std::unique_lock<std::mutex> lock(Mutex);
       Callbacks.insert(std::make_pair(request.Header.RequestHandle, responseCallback));
       lock.unlock();
 
+      const std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
       Send(request);
 
 	  Response res;
 	  try {
-      res = requestCallback.WaitForData(std::chrono::milliseconds(request.Header.Timeout));
+      res = requestCallback->WaitForData(std::chrono::milliseconds(request.Header.Timeout));
+      if (res.Header.ServiceResult == StatusCode::BadConnectionClosed)
+      {
+        throw std::runtime_error("binary_client| Connection closed");
+      }
+      UpdateRoundTrip(std::chrono::steady_clock::now() - sent);
 	  }
 	  catch (std::exception &ex)
 	  {
@@ -763,6 +887,323 @@ private:
 	  return res;
     }
 
+    // Send request without waiting for the response. Handler is called from the callback thread
+    // with the decoded response, or with a response holding only an error status in its header.
+    template <typename Response, typename Request>
+    void SendAsync(Request request, std::function<void (const Response&)> handler) const
+    {
+      if (Finished || Broken)
+      {
+        throw std::runtime_error("binary_client| Client is stopped");
+      }
+      request.Header = CreateRequestHeader();
+      const uint32_t handle = request.Header.RequestHandle;
+
+      ResponseCallback responseCallback = [this, handler](IStreamBinary* in, ResponseHeader h){
+        std::shared_ptr<Response> response(new Response());
+        if (!in || h.ServiceResult != StatusCode::Good)
+        {
+          response->Header = std::move(h);
+        }
+        else
+        {
+          try
+          {
+            *in >> *response;
+          }
+          catch (const std::exception& exc)
+          {
+            if (Debug)  { std::cerr << "binary_client| Failed to decode response: " << exc.what() << std::endl; }
+            *response = Response();
+            response->Header = std::move(h);
+            response->Header.ServiceResult = StatusCode::BadDecodingError;
+          }
+        }
+        Dispatch([handler, response](){ handler(*response); });
+      };
+
+      std::unique_lock<std::mutex> lock(Mutex);
+      Callbacks.insert(std::make_pair(handle, responseCallback));
+      Deadlines.insert(std::make_pair(handle, std::chrono::steady_clock::now() + std::chrono::milliseconds(request.Header.Timeout)));
+      lock.unlock();
+
+      try
+      {
+        Send(request);
+      }
+      catch (const std::exception&)
+      {
+        lock.lock();
+        Callbacks.erase(handle);
+        Deadlines.erase(handle);
+        throw;
+      }
+    }
+
+    // Completion of asynchronous requests must not run in receive thread: callbacks may send new requests.
+    void Dispatch(std::function<void()> completion) const
+    {
+      if (Finished)
+      {
+        completion();
+        return;
+      }
+      Post(0, completion);
+    }
+
+    // Callbacks posted to the dispatcher and not yet called or dropped.
+    // Shared with callbacks since a client destroyed by one of them is gone when it returns.
+    struct PendingState
+    {
+      std::mutex Mutex;
+      std::condition_variable Condition;
+      unsigned Count = 0;
+      std::multiset<std::thread::id> Calling; // threads running a callback of the client
+    };
+
+    // Callbacks may still be queued in a shared dispatcher when the client is destroyed,
+    // destructor waits until all of them are called or dropped.
+    class PendingCallback
+    {
+    public:
+      explicit PendingCallback(std::shared_ptr<PendingState> state)
+        : State(state)
+      {
+        std::unique_lock<std::mutex> lock(State->Mutex);
+        ++State->Count;
+      }
+
+      ~PendingCallback()
+      {
+        std::unique_lock<std::mutex> lock(State->Mutex);
+        --State->Count;
+        State->Condition.notify_all();
+      }
+
+      void Call(const std::function<void()>& callback)
+      {
+        {
+          std::unique_lock<std::mutex> lock(State->Mutex);
+          State->Calling.insert(std::this_thread::get_id());
+        }
+        try
+        {
+          callback();
+        }
+        catch (...)
+        {
+          Called();
+          throw;
+        }
+        Called();
+      }
+
+    private:
+      void Called()
+      {
+        std::unique_lock<std::mutex> lock(State->Mutex);
+        State->Calling.erase(State->Calling.find(std::this_thread::get_id()));
+        State->Condition.notify_all();
+      }
+
+    private:
+      std::shared_ptr<PendingState> State;
+    };
+
+    void Post(uint32_t key, std::function<void()> callback) const
+    {
+      std::shared_ptr<PendingCallback> pending(new PendingCallback(Pending));
+      Dispatcher->Post(key, [pending, callback]() { pending->Call(callback); });
+    }
+
+    // Complete asynchronous requests whose deadline matches with an error status.
+    template <typename Predicate>
+    void CompletePending(StatusCode status, Predicate expired)
+    {
+      std::vector<ResponseCallback> completed;
+      std::unique_lock<std::mutex> lock(Mutex);
+      for (DeadlineMap::iterator it = Deadlines.begin(); it != Deadlines.end();)
+      {
+        if (!expired(it->second))
+        {
+          ++it;
+          continue;
+        }
+        CallbackMap::iterator callbackIt = Callbacks.find(it->first);
+        if (callbackIt != Callbacks.end())
+        {
+          completed.push_back(std::move(callbackIt->second));
+          Callbacks.erase(callbackIt);
+        }
+        it = Deadlines.erase(it);
+      }
+      lock.unlock();
+
+      for (ResponseCallback& callback : completed)
+      {
+        ResponseHeader header;
+        header.ServiceResult = status;
+        callback(nullptr, header);
+      }
+    }
+
+    // Complete every pending request, nothing will be received anymore.
+    void OnConnectionLost()
+    {
+      Broken = true;
+      CallbackMap pending;
+      std::unique_lock<std::mutex> lock(Mutex);
+      pending.swap(Callbacks);
+      Deadlines.clear();
+      lock.unlock();
+
+      for (CallbackMap::value_type& callback : pending)
+      {
+        ResponseHeader header;
+        header.ServiceResult = StatusCode::BadConnectionClosed;
+        callback.second(nullptr, header);
+      }
+      if (Params.ConnectionLost)
+      {
+        Params.ConnectionLost();
+      }
+    }
+
+    void CheckTimeouts()
+    {
+      while (!Finished)
+      {
+        {
+          std::unique_lock<std::mutex> lock(Mutex);
+          TimeoutCondition.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        CompletePending(StatusCode::BadTimeout, [now](const std::chrono::steady_clock::time_point& deadline) { return deadline <= now; });
+      }
+    }
+
+    void UpdateRoundTrip(std::chrono::steady_clock::duration sample) const
+    {
+      std::unique_lock<std::mutex> lock(PublishMutex);
+      RoundTrip = RoundTrip == std::chrono::steady_clock::duration::zero() ? sample : (RoundTrip * 7 + sample) / 8;
+    }
+
+    // Fill the publish pipeline up to its window, first request carries all pending acknowledgements.
+    // Explicit publish calls without known subscriptions send one request as before.
+    void SendPublishRequests(bool requested)
+    {
+      std::vector<PublishRequest> requests;
+      std::unique_lock<std::mutex> lock(PublishMutex);
+      if (Finished || Broken || (PublishFailed && !requested))
+      {
+        return;
+      }
+      const unsigned window = Window.GetSize(RoundTrip);
+      unsigned count = PublishInFlight < window ? window - PublishInFlight : 0;
+      if (requested && Window.IsEmpty())
+      {
+        count = 1;
+      }
+      for (unsigned i = 0; i < count; ++i)
+      {
+        requests.push_back(PublishRequest());
+      }
+      if (!requests.empty())
+      {
+        requests.front().SubscriptionAcknowledgements.swap(PendingAcks);
+      }
+      PublishInFlight += count;
+      if (Debug && count) { std::cout << "binary_client| Sending " << count << " publish requests, window " << window << ", in flight " << PublishInFlight << std::endl; }
+      lock.unlock();
+
+      for (PublishRequest& request : requests)
+      {
+        SendPublish(request);
+      }
+    }
+
+    void OnPublishResponse(StatusCode status)
+    {
+      std::unique_lock<std::mutex> lock(PublishMutex);
+      if (PublishInFlight)
+      {
+        --PublishInFlight;
+      }
+      if (status == StatusCode::BadTooManyPublishRequests)
+      {
+        // Server limit reached, stay below it
+        Window.LowerLimit(PublishInFlight);
+        if (Debug) { std::cout << "binary_client| Server holds at most " << Window.GetLimit() << " publish requests" << std::endl; }
+      }
+      else if (status != StatusCode::Good)
+      {
+        PublishFailed = true;
+      }
+    }
+
+    void SendPublish(PublishRequest& request)
+    {
+      request.Header = CreateRequestHeader();
+      request.Header.Timeout = 0; //We do not want the request to timeout!
+
+      ResponseCallback responseCallback = [this](IStreamBinary* in, ResponseHeader h){
+        if (Debug) {std::cout << "BinaryClient | Got Publish Response, from server " << std::endl;}
+        OnPublishResponse(h.ServiceResult);
+		std::shared_ptr<PublishResponse> response(new PublishResponse());
+		if (!in || h.ServiceResult != OpcUa::StatusCode::Good)
+		{
+			response->Header = std::move(h);
+		}
+		else
+		{
+			try
+			{
+				*in >> *response;
+			}
+			catch (const std::exception& exc)
+			{
+				std::cerr << "BinaryClient | Failed to decode publish response: " << exc.what() << std::endl;
+				return;
+			}
+		}
+
+		if (response->Header.ServiceResult != OpcUa::StatusCode::Good)
+		{
+			if (Debug && response->Header.ServiceResult == OpcUa::StatusCode::BadSessionClosed)
+			{
+				std::cout << "BinaryClient | Session is closed";
+			}
+			return;
+		}
+		if (Finished)
+		{
+			return;
+		}
+
+		// Notifications of a subscription are delivered in order, different subscriptions in parallel
+		const uint32_t subscriptionId = response->Parameters.SubscriptionId;
+		Post(subscriptionId, [this, response, subscriptionId]()
+			{
+			std::unique_lock<std::mutex> lock(Mutex);
+			SubscriptionCallbackMap::const_iterator callbackIt = this->PublishCallbacks.find(subscriptionId);
+			if (callbackIt == this->PublishCallbacks.end())
+			{
+				std::cout << "BinaryClient | Error Unknown SubscriptionId " << subscriptionId << std::endl;
+				return;
+			}
+			const std::function<void (PublishResult)> callback = callbackIt->second;
+			lock.unlock();
+
+			if (Debug) { std::cout << "BinaryClient | Calling callback for Subscription " << subscriptionId << std::endl; }
+			callback(std::move(response->Parameters));
+			});
+	  };
+	  std::unique_lock<std::mutex> lock(Mutex);
+	  Callbacks.insert(std::make_pair(request.Header.RequestHandle, responseCallback));
+	  lock.unlock();
+	  Send(request);
+    }
+
     // Prevent multiple threads from sending parts of different packets at the same time.
     mutable std::mutex send_mutex;
 
@@ -772,19 +1213,63 @@ private:
       // TODO add support for breaking message into multiple chunks
       SecureHeader hdr(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelSecurityToken.SecureChannelId);
       const SymmetricAlgorithmHeader algorithmHeader = CreateAlgorithmHeader();
-      hdr.AddSize(RawSize(algorithmHeader));
-
       const SequenceHeader sequence = CreateSequenceHeader();
-      hdr.AddSize(RawSize(sequence));
-      hdr.AddSize(RawSize(request));
 
 	  std::unique_lock<std::mutex> send_lock(send_mutex);
-      Stream << hdr << algorithmHeader << sequence << request << flush;
+      WriteMessage(Stream, hdr, algorithmHeader, sequence, request);
     }
 
 
 
     void Receive()
+    {
+      const ChunkType chunk = ReceiveChunk(ChunkBuffer);
+      ChunkInputChannel body(ChunkBuffer, chunk, [this](std::vector<char>& buffer) { return ReceiveChunk(buffer); });
+      IStreamBinary in(body);
+
+      NodeId id;
+      ResponseHeader header;
+      in >> id;
+      in >> header;
+      body.ReplayHeaders();
+
+      if ( Debug )std::cout << "binary_client| Got response id: " << id << " and handle " << header.RequestHandle<< std::endl;
+
+      if (header.ServiceResult != StatusCode::Good) {
+        std::cout << "binary_client| Received a response from server with error status: " << OpcUa::ToString(header.ServiceResult) <<  std::endl;
+      }
+
+      if (id == SERVICE_FAULT)
+      {
+        std::cerr << std::endl;
+        std::cerr << "Receive ServiceFault from Server with StatusCode " << OpcUa::ToString(header.ServiceResult) << std::endl;
+        std::cerr << std::endl;
+      }
+
+      std::unique_lock<std::mutex> lock(Mutex);
+      CallbackMap::iterator callbackIt = Callbacks.find(header.RequestHandle);
+      if (callbackIt == Callbacks.end())
+      {
+        lock.unlock();
+        std::cout << "binary_client| No callback found for message with id: " << id << " and handle " << header.RequestHandle << std::endl;
+        body.Drain();
+        return;
+      }
+      // Remaining chunks are received while the callback decodes, other requests can be sent meanwhile
+      const ResponseCallback callback = std::move(callbackIt->second);
+      Deadlines.erase(callbackIt->first);
+      Callbacks.erase(callbackIt);
+      lock.unlock();
+
+      callback(&in, std::move(header));
+      body.Drain();
+
+      // Replace answered publish requests and follow changes of round-trip time
+      SendPublishRequests(false);
+    }
+
+    // Receive headers of the next chunk and its body into the buffer, capacity of the buffer is kept.
+    ChunkType ReceiveChunk(std::vector<char>& body)
     {
       Binary::SecureHeader responseHeader;
       Stream >> responseHeader;
@@ -812,8 +1297,7 @@ private:
         Stream >> responseAlgo;
         algo_size = RawSize(responseAlgo);
       }
-			
-      NodeId id;
+
       Binary::SequenceHeader responseSequence;
       Stream >> responseSequence; // TODO Check for request Number
 
@@ -825,64 +1309,11 @@ private:
         throw std::runtime_error(stream.str());
       }
 
-      std::size_t dataSize = responseHeader.Size - expectedHeaderSize;
-      if(responseHeader.Chunk == CHT_SINGLE)
-      {
-        parseMessage(dataSize, id);			  
-        firstMsgParsed = false;
-
-        std::unique_lock<std::mutex> lock(Mutex);
-        CallbackMap::const_iterator callbackIt = Callbacks.find(header.RequestHandle);
-        if (callbackIt == Callbacks.end())
-        {
-          std::cout << "binary_client| No callback found for message with id: " << id << " and handle " << header.RequestHandle << std::endl;
-          return;
-        }
-        callbackIt->second(std::move(messageBuffer), std::move(header));
-        messageBuffer.clear();
-        Callbacks.erase(callbackIt);
-			}
-      else if(responseHeader.Chunk == CHT_INTERMEDIATE)
-      {
-        parseMessage(dataSize, id);
-        firstMsgParsed = true;		  
-      }	  
-    }
-
-    ResponseHeader parseMessage(std::size_t &dataSize, NodeId &id)
-    {
-      std::vector<char> buffer(dataSize);
-      BufferInputChannel bufferInput(buffer);
-      Binary::RawBuffer raw(&buffer[0], dataSize);
-
+      const std::size_t dataSize = responseHeader.Size - expectedHeaderSize;
+      body.resize(dataSize);
+      Binary::RawBuffer raw(body.data(), dataSize);
       Stream >> raw;
-
-      if(!firstMsgParsed)
-      {
-        IStreamBinary in(bufferInput);
-        in >> id;
-        in >> header;
-
-        if ( Debug )std::cout << "binary_client| Got response id: " << id << " and handle " << header.RequestHandle<< std::endl;
-
-        if (header.ServiceResult != StatusCode::Good) {
-          std::cout << "binary_client| Received a response from server with error status: " << OpcUa::ToString(header.ServiceResult) <<  std::endl;
-        }
-
-        if (id == SERVICE_FAULT)
-        {
-          std::cerr << std::endl;
-          std::cerr << "Receive ServiceFault from Server with StatusCode " << OpcUa::ToString(header.ServiceResult) << std::endl;
-          std::cerr << std::endl;
-        }
-
-        messageBuffer.insert(messageBuffer.end(), buffer.begin(), buffer.end());
-        return header;
-      }
-      else
-      {
-        messageBuffer.insert(messageBuffer.end(), buffer.begin(), buffer.end());
-      }
+      return responseHeader.Chunk;
     }
 
     Binary::Acknowledge HelloServer(const SecureConnectionParams& params)
@@ -897,9 +1328,7 @@ private:
       hello.EndpointUrl = params.EndpointUrl;
 
       Binary::Header hdr(Binary::MT_HELLO, Binary::CHT_SINGLE);
-      hdr.AddSize(RawSize(hello));
-
-      Stream << hdr << hello << flush;
+      WriteMessage(Stream, hdr, hello);
 
       Header respHeader;
       Stream >> respHeader; // TODO add check for acknowledge header
@@ -945,6 +1374,7 @@ private:
     void RemoveSelfReferences()
     {
       if (Debug)  { std::cout << "binary_client| Clearing cached references to server" << std::endl; }
+      std::unique_lock<std::mutex> lock(Mutex);
       PublishCallbacks.clear();
     }
 
@@ -962,15 +1392,27 @@ private:
     mutable std::atomic<uint32_t> RequestHandle;
     mutable std::vector<std::vector<uint8_t>> ContinuationPoints;
     mutable CallbackMap Callbacks;
+    mutable DeadlineMap Deadlines;
     const bool Debug = true;
-    bool Finished = false;
+    std::atomic<bool> Finished{false};
+    std::atomic<bool> Broken{false};
 
-    std::thread callback_thread;
-    CallbackThread CallbackService;
+    CallbackDispatcher::SharedPtr Dispatcher;
+    const bool OwnDispatcher;
+    const std::shared_ptr<PendingState> Pending;
     mutable std::mutex Mutex;
-    
-		bool firstMsgParsed = false;
-		ResponseHeader header;
+    std::thread timeout_thread;
+    std::condition_variable TimeoutCondition;
+
+    mutable std::mutex PublishMutex;
+    PublishWindow Window;
+    std::vector<SubscriptionAcknowledgement> PendingAcks;
+    unsigned PublishInFlight = 0;
+    bool PublishFailed = false;
+    mutable std::chrono::steady_clock::duration RoundTrip = std::chrono::steady_clock::duration::zero();
+
+    // Body of the chunk being decoded, only used by the receive thread
+    std::vector<char> ChunkBuffer;
   };
 
   template <>
@@ -981,12 +1423,9 @@ private:
     algorithmHeader.SecurityPolicyUri = Params.SecurePolicy;
     algorithmHeader.SenderCertificate = Params.SenderCertificate;
     algorithmHeader.ReceiverCertificateThumbPrint = Params.ReceiverCertificateThumbPrint;
-    hdr.AddSize(RawSize(algorithmHeader));
-    hdr.AddSize(RawSize(request));
 
     const SequenceHeader sequence = CreateSequenceHeader();
-    hdr.AddSize(RawSize(sequence));
-    Stream << hdr << algorithmHeader << sequence << request << flush;
+    WriteMessage(Stream, hdr, algorithmHeader, sequence, request);
   }
 
 } // namespace
@@ -1006,3 +1445,49 @@ OpcUa::Services::SharedPtr OpcUa::CreateBinaryClient(const std::string& endpoint
   params.SecurePolicy = "http://opcfoundation.org/UA/SecurityPolicy#None";
   return CreateBinaryClient(channel, params, debug);
 }
+
+OpcUa::PublishWindow::PublishWindow(unsigned limit)
+  : Limit(std::max(limit, 1u))
+{
+}
+
+void OpcUa::PublishWindow::SetInterval(uint32_t subscriptionId, Duration interval)
+{
+  Intervals[subscriptionId] = interval;
+}
+
+void OpcUa::PublishWindow::RemoveInterval(uint32_t subscriptionId)
+{
+  Intervals.erase(subscriptionId);
+}
+
+bool OpcUa::PublishWindow::IsEmpty() const
+{
+  return Intervals.empty();
+}
+
+unsigned OpcUa::PublishWindow::GetSize(std::chrono::steady_clock::duration roundTrip) const
+{
+  if (Intervals.empty())
+  {
+    return 0;
+  }
+  const double roundTripMs = std::chrono::duration<double, std::milli>(roundTrip).count();
+  double window = 0;
+  for (const std::pair<const uint32_t, Duration>& interval : Intervals)
+  {
+    window += 1 + std::ceil(roundTripMs / std::max(interval.second, 1.0));
+  }
+  return static_cast<unsigned>(std::min<double>(std::max(window, 2.0), Limit));
+}
+
+void OpcUa::PublishWindow::LowerLimit(unsigned inFlight)
+{
+  // Stay below the number the server accepted
+  Limit = std::max(std::min(inFlight, Limit), 1u);
+}
+
+unsigned OpcUa::PublishWindow::GetLimit() const
+{
+  return Limit;
+}
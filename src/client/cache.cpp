@@ -0,0 +1,487 @@
+/// @brief Cache of node attributes on client side.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/cache.h>
+
+#include <opc/ua/client/batch.h>
+#include <opc/ua/protocol/reference_ids.h>
+#include <opc/ua/subscription.h>
+
+#include <algorithm>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+
+namespace
+{
+  using namespace OpcUa;
+
+  // Number of attributes read by one request during prefetch
+  const uint32_t PrefetchReadSize = 1000;
+
+  typedef std::pair<NodeId, AttributeId> CacheKey;
+  typedef std::chrono::steady_clock Clock;
+
+  class AttributeCache
+    : public CachingServices
+    , public AttributeServices
+    , public std::enable_shared_from_this<AttributeCache>
+  {
+  public:
+    AttributeCache(Services::SharedPtr services, const AttributeCacheParameters& params)
+      : Server(services)
+      , Attribute(services->Attributes())
+      , Params(params)
+      , Cached(params.Attributes.begin(), params.Attributes.end())
+      , Handler(*this)
+    {
+      if (Params.SubscribeValues)
+      {
+        Cached.insert(AttributeId::Value);
+      }
+    }
+
+    ~AttributeCache()
+    {
+      if (!ValueSubscription)
+      {
+        return;
+      }
+      try
+      {
+        ValueSubscription->Delete();
+      }
+      catch (const std::exception& exc)
+      {
+        std::cerr << "AttributeCache | Failed to delete subscription: " << exc.what() << std::endl;
+      }
+    }
+
+    virtual OpenSecureChannelResponse OpenSecureChannel(const OpenSecureChannelParameters& parameters) override
+    {
+      return Server->OpenSecureChannel(parameters);
+    }
+
+    virtual void CloseSecureChannel(uint32_t channelId) override
+    {
+      Server->CloseSecureChannel(channelId);
+    }
+
+    virtual CreateSessionResponse CreateSession(const RemoteSessionParameters& parameters) override
+    {
+      return Server->CreateSession(parameters);
+    }
+
+    virtual ActivateSessionResponse ActivateSession(const ActivateSessionParameters& parameters) override
+    {
+      return Server->ActivateSession(parameters);
+    }
+
+    virtual CloseSessionResponse CloseSession() override
+    {
+      return Server->CloseSession();
+    }
+
+    virtual void AbortSession() override
+    {
+      Server->AbortSession();
+    }
+
+    virtual DeleteNodesResponse DeleteNodes(const std::vector<OpcUa::DeleteNodesItem>& nodesToDelete) override
+    {
+      for (const DeleteNodesItem& item : nodesToDelete)
+      {
+        Invalidate(item.NodeId);
+      }
+      return Server->DeleteNodes(nodesToDelete);
+    }
+
+    virtual AttributeServices::SharedPtr Attributes() override
+    {
+      return shared_from_this();
+    }
+
+    virtual EndpointServices::SharedPtr Endpoints() override
+    {
+      return Server->Endpoints();
+    }
+
+    virtual MethodServices::SharedPtr Method() override
+    {
+      return Server->Method();
+    }
+
+    virtual NodeManagementServices::SharedPtr NodeManagement() override
+    {
+      return Server->NodeManagement();
+    }
+
+    virtual SubscriptionServices::SharedPtr Subscriptions() override
+    {
+      return Server->Subscriptions();
+    }
+
+    virtual ViewServices::SharedPtr Views() override
+    {
+      return Server->Views();
+    }
+
+    virtual AsyncServices::SharedPtr Async() override
+    {
+      return Server->Async();
+    }
+
+  public: // AttributeServices
+    virtual std::vector<DataValue> Read(const ReadParameters& params) const override
+    {
+      return const_cast<AttributeCache*>(this)->ReadThrough(params);
+    }
+
+    virtual std::vector<StatusCode> Write(const std::vector<WriteValue>& values) override
+    {
+      std::vector<StatusCode> results = Attribute->Write(values);
+      std::unique_lock<std::mutex> lock(Mutex);
+      for (const WriteValue& value : values)
+      {
+        Erase(CacheKey(value.NodeId, value.AttributeId));
+      }
+      return results;
+    }
+
+    virtual std::vector<HistoryReadResult> HistoryRead(const HistoryReadParameters& params) const override
+    {
+      return Attribute->HistoryRead(params);
+    }
+
+  public: // CachingServices
+    virtual void Prefetch(const NodeId& root, uint32_t maxDepth) override
+    {
+      std::set<NodeId> visited;
+      std::vector<NodeId> level(1, root);
+      visited.insert(root);
+      std::vector<NodeId> nodes(level);
+
+      for (uint32_t depth = 0; depth < maxDepth && !level.empty(); ++depth)
+      {
+        NodesQuery query;
+        for (const NodeId& node : level)
+        {
+          BrowseDescription description;
+          description.NodeToBrowse = node;
+          description.Direction = BrowseDirection::Forward;
+          description.ReferenceTypeId = ReferenceId::HierarchicalReferences;
+          description.IncludeSubtypes = true;
+          description.NodeClasses = NodeClass::Unspecified;
+          description.ResultMask = BrowseResultMask::All;
+          query.NodesToBrowse.push_back(description);
+        }
+
+        std::vector<NodeId> next;
+        std::vector<BrowseResult> results = Server->Views()->Browse(query);
+        while (!results.empty())
+        {
+          for (const BrowseResult& result : results)
+          {
+            for (const ReferenceDescription& reference : result.Referencies)
+            {
+              if (visited.insert(reference.TargetNodeId).second)
+              {
+                next.push_back(reference.TargetNodeId);
+              }
+            }
+          }
+          results = Server->Views()->BrowseNext();
+        }
+        nodes.insert(nodes.end(), next.begin(), next.end());
+        level.swap(next);
+      }
+
+      ReadParameters params;
+      for (const NodeId& node : nodes)
+      {
+        for (AttributeId attribute : Cached)
+        {
+          params.AttributesToRead.push_back(ToReadValueId(node, attribute));
+        }
+      }
+      ReadInBatches(*this, params, PrefetchReadSize);
+    }
+
+    virtual void Invalidate(const NodeId& node) override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      for (AttributeId attribute : Cached)
+      {
+        Erase(CacheKey(node, attribute));
+      }
+    }
+
+    virtual void Clear() override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      Entries.clear();
+      Usage.clear();
+    }
+
+    virtual std::size_t GetSize() const override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      return Entries.size();
+    }
+
+  private:
+    class ValueHandler : public SubscriptionHandler
+    {
+    public:
+      explicit ValueHandler(AttributeCache& cache)
+        : Cache(cache)
+      {
+      }
+
+      virtual void DataChange(uint32_t handle, const Node& node, const Variant& val, AttributeId attribute) override
+      {
+      }
+
+      virtual void DataValueChange(uint32_t handle, const Node& node, const DataValue& value, AttributeId attribute) override
+      {
+        std::unique_lock<std::mutex> lock(Cache.Mutex);
+        Cache.Store(CacheKey(node.GetId(), attribute), value);
+      }
+
+    private:
+      AttributeCache& Cache;
+    };
+
+    struct CacheEntry
+    {
+      DataValue Value;
+      Clock::time_point Expires;
+      std::list<CacheKey>::iterator Use;
+    };
+
+    bool IsCacheable(const ReadValueId& id) const
+    {
+      return id.IndexRange.empty() && id.DataEncoding.Name.empty() && Cached.count(id.AttributeId);
+    }
+
+    // Server answer which will not change as long as the node exists
+    static bool IsStable(const DataValue& value)
+    {
+      return value.Status == StatusCode::Good || value.Status == StatusCode::BadAttributeIdInvalid;
+    }
+
+    std::vector<DataValue> ReadThrough(const ReadParameters& params)
+    {
+      std::vector<DataValue> results(params.AttributesToRead.size());
+      std::vector<std::size_t> missing;
+      ReadParameters missed;
+      missed.MaxAge = params.MaxAge;
+      missed.TimestampsToReturn = params.TimestampsToReturn;
+
+      std::unique_lock<std::mutex> lock(Mutex);
+      const Clock::time_point now = Clock::now();
+      for (std::size_t i = 0; i < params.AttributesToRead.size(); ++i)
+      {
+        const ReadValueId& id = params.AttributesToRead[i];
+        if (!IsCacheable(id) || !Find(CacheKey(id.NodeId, id.AttributeId), now, results[i]))
+        {
+          missing.push_back(i);
+          missed.AttributesToRead.push_back(id);
+        }
+        else if (id.AttributeId == AttributeId::Value)
+        {
+          FilterTimestamps(results[i], params.TimestampsToReturn);
+        }
+      }
+      lock.unlock();
+
+      if (missing.empty())
+      {
+        return results;
+      }
+
+      const std::vector<DataValue> values = Attribute->Read(missed);
+      std::vector<NodeId> subscribe;
+      lock.lock();
+      for (std::size_t i = 0; i < missing.size() && i < values.size(); ++i)
+      {
+        const ReadValueId& id = missed.AttributesToRead[i];
+        results[missing[i]] = values[i];
+        if (!IsCacheable(id) || !IsStable(values[i]))
+        {
+          continue;
+        }
+        if (id.AttributeId != AttributeId::Value)
+        {
+          Store(CacheKey(id.NodeId, id.AttributeId), values[i]);
+        }
+        else if (values[i].Status != StatusCode::Good)
+        {
+          continue;
+        }
+        else if (Monitored.insert(id.NodeId).second)
+        {
+          subscribe.push_back(id.NodeId);
+        }
+        else if (!Entries.count(CacheKey(id.NodeId, id.AttributeId)))
+        {
+          // Entry of a monitored value was evicted, notifications only come back on change.
+          // A notification received since the read is newer and is kept.
+          Store(CacheKey(id.NodeId, id.AttributeId), values[i]);
+        }
+      }
+      lock.unlock();
+
+      Subscribe(subscribe);
+      return results;
+    }
+
+    // Cached value is filled by the first notification of a new monitored item.
+    // Monitored items are created by one request for up to PrefetchReadSize nodes.
+    void Subscribe(const std::vector<NodeId>& nodes)
+    {
+      if (nodes.empty())
+      {
+        return;
+      }
+
+      std::unique_lock<std::mutex> lock(SubscriptionMutex);
+      if (!ValueSubscription)
+      {
+        CreateSubscriptionParameters params;
+        params.RequestedPublishingInterval = Params.PublishingInterval;
+        ValueSubscription.reset(new Subscription(Server, params, Handler));
+      }
+      for (std::size_t begin = 0; begin < nodes.size(); begin += PrefetchReadSize)
+      {
+        const std::size_t end = std::min<std::size_t>(begin + PrefetchReadSize, nodes.size());
+        std::vector<ReadValueId> ids;
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          ids.push_back(ToReadValueId(nodes[i], AttributeId::Value));
+        }
+        try
+        {
+          ValueSubscription->SubscribeDataChange(ids);
+        }
+        catch (const std::exception& exc)
+        {
+          std::cerr << "AttributeCache | Failed to subscribe to values of " << ids.size() << " nodes: " << exc.what() << std::endl;
+          // Values of these nodes are read from server, not from notifications
+          std::unique_lock<std::mutex> cacheLock(Mutex);
+          for (const ReadValueId& id : ids)
+          {
+            Monitored.erase(id.NodeId);
+          }
+        }
+      }
+    }
+
+    bool Find(const CacheKey& key, Clock::time_point now, DataValue& value)
+    {
+      std::map<CacheKey, CacheEntry>::iterator it = Entries.find(key);
+      if (it == Entries.end())
+      {
+        return false;
+      }
+      if (Expires(key) && it->second.Expires <= now)
+      {
+        Usage.erase(it->second.Use);
+        Entries.erase(it);
+        return false;
+      }
+      Usage.splice(Usage.begin(), Usage, it->second.Use);
+      value = it->second.Value;
+      return true;
+    }
+
+    void Store(const CacheKey& key, const DataValue& value)
+    {
+      std::map<CacheKey, CacheEntry>::iterator it = Entries.find(key);
+      if (it == Entries.end())
+      {
+        Usage.push_front(key);
+        it = Entries.insert(std::make_pair(key, CacheEntry())).first;
+        it->second.Use = Usage.begin();
+      }
+      else
+      {
+        Usage.splice(Usage.begin(), Usage, it->second.Use);
+      }
+      it->second.Value = value;
+      it->second.Expires = Clock::now() + Params.TimeToLive;
+
+      while (Entries.size() > Params.MaxEntries && !Usage.empty())
+      {
+        Entries.erase(Usage.back());
+        Usage.pop_back();
+      }
+    }
+
+    void Erase(const CacheKey& key)
+    {
+      std::map<CacheKey, CacheEntry>::iterator it = Entries.find(key);
+      if (it != Entries.end())
+      {
+        Usage.erase(it->second.Use);
+        Entries.erase(it);
+      }
+    }
+
+    // Values kept fresh by the subscription do not expire
+    bool Expires(const CacheKey& key) const
+    {
+      if (Params.TimeToLive.count() == 0)
+      {
+        return false;
+      }
+      return key.second != AttributeId::Value || !Monitored.count(key.first);
+    }
+
+    static void FilterTimestamps(DataValue& value, TimestampsToReturn timestamps)
+    {
+      if (timestamps != TimestampsToReturn::Source && timestamps != TimestampsToReturn::Both)
+      {
+        value.Encoding &= ~(DATA_VALUE_SOURCE_TIMESTAMP | DATA_VALUE_SOURCE_PICOSECONDS);
+      }
+      if (timestamps != TimestampsToReturn::Server && timestamps != TimestampsToReturn::Both)
+      {
+        value.Encoding &= ~(DATA_VALUE_Server_TIMESTAMP | DATA_VALUE_Server_PICOSECONDS);
+      }
+    }
+
+  private:
+    Services::SharedPtr Server;
+    AttributeServices::SharedPtr Attribute;
+    const AttributeCacheParameters Params;
+    std::set<AttributeId> Cached;
+
+    mutable std::mutex Mutex;
+    std::map<CacheKey, CacheEntry> Entries;
+    std::list<CacheKey> Usage; // most recently used first
+    std::set<NodeId> Monitored;
+
+    ValueHandler Handler;
+    std::mutex SubscriptionMutex;
+    std::unique_ptr<Subscription> ValueSubscription;
+  };
+
+}
+
+namespace OpcUa
+{
+
+  CachingServices::SharedPtr CreateCachingServices(Services::SharedPtr services, const AttributeCacheParameters& params)
+  {
+    return CachingServices::SharedPtr(new AttributeCache(services, params));
+  }
+
+} // namespace OpcUa
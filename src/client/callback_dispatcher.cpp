@@ -0,0 +1,198 @@
+/// @brief Pool of threads calling client callbacks.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/callback_dispatcher.h>
+
+#include <algorithm>
+#include <iostream>
+
+namespace OpcUa
+{
+
+  CallbackDispatcher::CallbackDispatcher(unsigned threads, bool debug)
+    : Debug(debug)
+    , Shared(std::make_shared<State>())
+  {
+    for (unsigned i = 0; i < std::max(threads, 1u); ++i)
+    {
+      Threads.push_back(std::thread(&CallbackDispatcher::Run, Shared, debug));
+      ThreadIds.push_back(Threads.back().get_id());
+    }
+  }
+
+  CallbackDispatcher::~CallbackDispatcher()
+  {
+    RequestStop();
+    Join();
+    // Destroyed from a callback: its thread keeps the shared state and exits when the callback returns
+    for (std::thread& thread : Threads)
+    {
+      if (thread.joinable())
+        thread.detach();
+    }
+  }
+
+  void CallbackDispatcher::Post(uint32_t key, std::function<void()> callback)
+  {
+    Task task;
+    task.Callback = std::move(callback);
+    task.Posted = Clock::now();
+
+    State& state = *Shared;
+    std::unique_lock<std::mutex> lock(state.Mutex);
+    if (state.StopRequest)
+    {
+      return;
+    }
+    ++state.QueueDepth;
+    state.MaxQueueDepth = std::max(state.MaxQueueDepth, state.QueueDepth);
+    if (key == 0)
+    {
+      state.Ready.push_back(std::make_pair(key, std::move(task)));
+    }
+    else
+    {
+      Strand& strand = state.Strands[key];
+      strand.Tasks.push_back(std::move(task));
+      if (strand.Scheduled)
+      {
+        return;
+      }
+      strand.Scheduled = true;
+      state.Ready.push_back(std::make_pair(key, Task()));
+    }
+    state.Condition.notify_one();
+  }
+
+  void CallbackDispatcher::Stop()
+  {
+    RequestStop();
+    // A thread cannot join itself, nor the threads which may be joining it
+    if (IsCallbackThread())
+    {
+      return;
+    }
+    Join();
+  }
+
+  bool CallbackDispatcher::IsCallbackThread() const
+  {
+    return std::find(ThreadIds.begin(), ThreadIds.end(), std::this_thread::get_id()) != ThreadIds.end();
+  }
+
+  void CallbackDispatcher::RequestStop()
+  {
+    std::deque<std::pair<uint32_t, Task>> ready;
+    std::map<uint32_t, Strand> strands;
+    {
+      std::unique_lock<std::mutex> lock(Shared->Mutex);
+      if (!Shared->StopRequest)
+      {
+        if (Debug)  { std::cout << "callback_dispatcher| stopping." << std::endl; }
+        Shared->StopRequest = true;
+        Shared->Condition.notify_all();
+      }
+      Shared->QueueDepth = 0;
+      ready.swap(Shared->Ready);
+      strands.swap(Shared->Strands);
+    }
+    // dropped callbacks are destroyed without lock, they may post again
+  }
+
+  void CallbackDispatcher::Join()
+  {
+    std::unique_lock<std::mutex> lock(JoinMutex);
+    for (std::thread& thread : Threads)
+    {
+      if (thread.joinable() && thread.get_id() != std::this_thread::get_id())
+        thread.join();
+    }
+  }
+
+  CallbackMetrics CallbackDispatcher::GetMetrics() const
+  {
+    const State& state = *Shared;
+    std::unique_lock<std::mutex> lock(Shared->Mutex);
+    CallbackMetrics metrics;
+    metrics.QueueDepth = state.QueueDepth;
+    metrics.MaxQueueDepth = state.MaxQueueDepth;
+    metrics.Dispatched = state.Dispatched;
+    if (state.Dispatched)
+    {
+      metrics.AverageLatency = std::chrono::duration_cast<std::chrono::microseconds>(state.TotalLatency / state.Dispatched);
+    }
+    metrics.MaxLatency = std::chrono::duration_cast<std::chrono::microseconds>(state.MaxLatency);
+    return metrics;
+  }
+
+  void CallbackDispatcher::Run(std::shared_ptr<State> shared, bool debug)
+  {
+    State& state = *shared;
+    std::unique_lock<std::mutex> lock(state.Mutex);
+    while (true)
+    {
+      state.Condition.wait(lock, [&state]() { return state.StopRequest || !state.Ready.empty(); });
+      if (state.StopRequest)
+      {
+        if (debug)  { std::cout << "callback_dispatcher| thread exited." << std::endl; }
+        return;
+      }
+
+      const uint32_t key = state.Ready.front().first;
+      Task task = std::move(state.Ready.front().second);
+      state.Ready.pop_front();
+      if (key != 0)
+      {
+        Strand& strand = state.Strands[key];
+        task = std::move(strand.Tasks.front());
+        strand.Tasks.pop_front();
+      }
+      --state.QueueDepth;
+      const Clock::duration latency = Clock::now() - task.Posted;
+      state.TotalLatency += latency;
+      state.MaxLatency = std::max(state.MaxLatency, latency);
+      ++state.Dispatched;
+
+      lock.unlock();
+      Call(task);
+      // callback is destroyed without lock, destroying what it captured may post again
+      task = Task();
+      lock.lock();
+
+      // Strands were dropped if the callback stopped the dispatcher
+      if (key == 0 || state.StopRequest)
+      {
+        continue;
+      }
+      // Strand stays on this thread until it is rescheduled, so its callbacks never overlap
+      std::map<uint32_t, Strand>::iterator strandIt = state.Strands.find(key);
+      if (strandIt->second.Tasks.empty())
+      {
+        state.Strands.erase(strandIt);
+      }
+      else
+      {
+        state.Ready.push_back(std::make_pair(key, Task()));
+        state.Condition.notify_one();
+      }
+    }
+  }
+
+  void CallbackDispatcher::Call(Task& task)
+  {
+    try
+    {
+      task.Callback();
+    }
+    catch (const std::exception& ex)
+    {
+      std::cout << "Error calling application callback " << ex.what() << std::endl;
+    }
+  }
+
+} // namespace OpcUa
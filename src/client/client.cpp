@@ -25,6 +25,30 @@
 #include <opc/ua/node.h>
 #include <opc/ua/protocol/string_utils.h>
 
+#include <future>
+
+namespace
+{
+
+  // Callback which sets value of a promise, or an exception if status is not Good
+  template <typename Results>
+  std::function<void (OpcUa::StatusCode, Results)> MakePromiseCallback(std::shared_ptr<std::promise<Results>> promise)
+  {
+    return [promise](OpcUa::StatusCode status, Results results)
+    {
+      try
+      {
+        OpcUa::CheckStatusCode(status);
+        promise->set_value(std::move(results));
+      }
+      catch (...)
+      {
+        promise->set_exception(std::current_exception());
+      }
+    };
+  }
+
+}
 
 namespace OpcUa
 {
@@ -108,7 +132,7 @@ namespace OpcUa
 
     Server = OpcUa::CreateBinaryClient(channel, params, Debug);
 
-    OpenSecureChannel();
+    OpenSecureChannel(*Server);
     std::vector<EndpointDescription> endpoints = UaClient::GetServerEndpoints();
     CloseSecureChannel();
 
@@ -176,16 +200,42 @@ namespace OpcUa
   void UaClient::Connect(const EndpointDescription& endpoint)
   {
     Endpoint = endpoint;
+    if ( ! Dispatcher ) { Dispatcher = std::make_shared<CallbackDispatcher>(CallbackThreads, Debug); }
+
+    std::vector<Services::SharedPtr> sessions;
+    for (unsigned i = 0; i < Channels; ++i)
+    {
+      if (AutoReconnect)
+      {
+        ReconnectingServices::SharedPtr reconnector = CreateReconnectingServices([this](std::function<void ()> lost) { return OpenSession(lost); }, ReconnectParams, Debug);
+        Reconnectors.push_back(reconnector);
+        sessions.push_back(reconnector);
+      }
+      else
+      {
+        sessions.push_back(OpenSession(std::function<void ()>()));
+      }
+    }
+    Server = sessions.size() == 1 ? sessions.front() : CreatePooledServices(sessions);
+    KeepAlive.Start(Server, Node(Server, ObjectId::Server_ServerStatus_State), DefaultTimeout);
+  }
+
+  Services::SharedPtr UaClient::OpenSession(std::function<void ()> connectionLost)
+  {
+    // reconnecting sessions of a pool may open concurrently
+    std::unique_lock<std::mutex> lock(SessionMutex);
     const Common::Uri serverUri(Endpoint.EndpointUrl);
     OpcUa::IOChannel::SharedPtr channel = OpcUa::Connect(serverUri.Host(), serverUri.Port());
 
     OpcUa::SecureConnectionParams params;
     params.EndpointUrl = Endpoint.EndpointUrl;
     params.SecurePolicy = "http://opcfoundation.org/UA/SecurityPolicy#None";
+    params.Dispatcher = Dispatcher;
+    params.ConnectionLost = connectionLost;
 
-    Server = OpcUa::CreateBinaryClient(channel, params, Debug);
+    Services::SharedPtr server = OpcUa::CreateBinaryClient(channel, params, Debug);
 
-    OpenSecureChannel();
+    OpenSecureChannel(*server);
 
 
     if (Debug)  { std::cout << "UaClient | Creating session ..." <<  std::endl; }
@@ -195,11 +245,11 @@ namespace OpcUa
     session.ClientDescription.ApplicationName = LocalizedText(SessionName);
     session.ClientDescription.ApplicationType = OpcUa::ApplicationType::Client;
     session.SessionName = SessionName;
-    session.EndpointUrl = endpoint.EndpointUrl;
+    session.EndpointUrl = Endpoint.EndpointUrl;
     session.Timeout = DefaultTimeout;
-    session.ServerURI = endpoint.Server.ApplicationUri;
+    session.ServerURI = Endpoint.Server.ApplicationUri;
 
-    CreateSessionResponse response = Server->CreateSession(session);
+    CreateSessionResponse response = server->CreateSession(session);
     CheckStatusCode(response.Header.ServiceResult);
     if (Debug)  { std::cout << "UaClient | Create session OK" <<  std::endl; }
 
@@ -237,7 +287,7 @@ namespace OpcUa
         throw std::runtime_error("Cannot find suitable user identify token for session");
       }
     }
-    ActivateSessionResponse aresponse = Server->ActivateSession(session_parameters);
+    ActivateSessionResponse aresponse = server->ActivateSession(session_parameters);
     CheckStatusCode(aresponse.Header.ServiceResult);
     if (Debug)  { std::cout << "UaClient | Activate session OK" <<  std::endl; }
 
@@ -245,10 +295,10 @@ namespace OpcUa
     {
       DefaultTimeout = response.Parameters.RevisedSessionTimeout;
     }
-    KeepAlive.Start(Server, Node(Server, ObjectId::Server_ServerStatus_State), DefaultTimeout);
+    return server;
   }
 
-  void UaClient::OpenSecureChannel()
+  void UaClient::OpenSecureChannel(Services& server)
   {
     OpenSecureChannelParameters channelparams;
     channelparams.ClientProtocolVersion = 0;
@@ -256,7 +306,7 @@ namespace OpcUa
     channelparams.SecurityMode = MessageSecurityMode::None;
     channelparams.ClientNonce = std::vector<uint8_t>(1, 0);
     channelparams.RequestLifeTime = DefaultTimeout;
-    const OpenSecureChannelResponse& response = Server->OpenSecureChannel(channelparams);
+    const OpenSecureChannelResponse& response = server.OpenSecureChannel(channelparams);
 
     CheckStatusCode(response.Header.ServiceResult);
 
@@ -277,15 +327,26 @@ namespace OpcUa
     Disconnect();//Do not leave any thread or connection running
   }
 
+  void UaClient::StopReconnect()
+  {
+    for (const ReconnectingServices::SharedPtr& reconnector : Reconnectors)
+    {
+      reconnector->Stop();
+    }
+    Reconnectors.clear();
+  }
+
   void UaClient::Disconnect()
   {
     KeepAlive.Stop();
+    StopReconnect();
 
     if ( Server.get() )
     {
       CloseSessionResponse response = Server->CloseSession();
       if (Debug) { std::cout << "CloseSession response is " << ToString(response.Header.ServiceResult) << std::endl; }
       CloseSecureChannel();
+      Cache.reset();
       Server.reset();
     }
   
@@ -294,7 +355,9 @@ namespace OpcUa
   void UaClient::Abort()
   {
     KeepAlive.Stop();
+    StopReconnect();
 
+    Cache.reset();
     Server.reset(); //FIXME: check if we still need this
   }
 
@@ -404,5 +467,84 @@ namespace OpcUa
   {
 	  return std::move(ServerOperations(Server));
   }
+
+  CallbackMetrics UaClient::GetCallbackMetrics() const
+  {
+    if ( ! Dispatcher ) { return CallbackMetrics(); }
+    return Dispatcher->GetMetrics();
+  }
+
+  void UaClient::EnableBatching(std::chrono::milliseconds window)
+  {
+    if ( ! Server ) { throw std::runtime_error("Not connected");}
+    Server = CreateBatchingServices(Server, window, GetBatchLimits(*Server));
+  }
+
+  std::unique_ptr<AttributeBatch> UaClient::CreateAttributeBatch()
+  {
+    if ( ! Server ) { throw std::runtime_error("Not connected");}
+    return std::unique_ptr<AttributeBatch>(new AttributeBatch(Server, GetBatchLimits(*Server)));
+  }
+
+  void UaClient::EnableAttributeCache(const AttributeCacheParameters& params)
+  {
+    if ( ! Server ) { throw std::runtime_error("Not connected");}
+    Cache = CreateCachingServices(Server, params);
+    Server = Cache;
+  }
+
+  void UaClient::PrefetchAttributes(const NodeId& root, uint32_t maxDepth)
+  {
+    if ( ! Cache ) { throw std::runtime_error("Attribute cache is not enabled");}
+    Cache->Prefetch(root, maxDepth);
+  }
+
+  void UaClient::ReadAsync(const ReadParameters& params, AsyncServices::ReadCallback callback)
+  {
+    Server->Async()->Read(params, callback);
+  }
+
+  std::future<std::vector<DataValue>> UaClient::ReadAsync(const ReadParameters& params)
+  {
+    std::shared_ptr<std::promise<std::vector<DataValue>>> promise(new std::promise<std::vector<DataValue>>());
+    Server->Async()->Read(params, MakePromiseCallback(promise));
+    return promise->get_future();
+  }
+
+  void UaClient::WriteAsync(const std::vector<WriteValue>& values, AsyncServices::WriteCallback callback)
+  {
+    Server->Async()->Write(values, callback);
+  }
+
+  std::future<std::vector<StatusCode>> UaClient::WriteAsync(const std::vector<WriteValue>& values)
+  {
+    std::shared_ptr<std::promise<std::vector<StatusCode>>> promise(new std::promise<std::vector<StatusCode>>());
+    Server->Async()->Write(values, MakePromiseCallback(promise));
+    return promise->get_future();
+  }
+
+  void UaClient::BrowseAsync(const NodesQuery& query, AsyncServices::BrowseCallback callback)
+  {
+    Server->Async()->Browse(query, callback);
+  }
+
+  std::future<std::vector<BrowseResult>> UaClient::BrowseAsync(const NodesQuery& query)
+  {
+    std::shared_ptr<std::promise<std::vector<BrowseResult>>> promise(new std::promise<std::vector<BrowseResult>>());
+    Server->Async()->Browse(query, MakePromiseCallback(promise));
+    return promise->get_future();
+  }
+
+  void UaClient::CallAsync(const std::vector<CallMethodRequest>& methodsToCall, AsyncServices::CallCallback callback)
+  {
+    Server->Async()->Call(methodsToCall, callback);
+  }
+
+  std::future<std::vector<CallMethodResult>> UaClient::CallAsync(const std::vector<CallMethodRequest>& methodsToCall)
+  {
+    std::shared_ptr<std::promise<std::vector<CallMethodResult>>> promise(new std::promise<std::vector<CallMethodResult>>());
+    Server->Async()->Call(methodsToCall, MakePromiseCallback(promise));
+    return promise->get_future();
+  }
 } // namespace OpcUa
 
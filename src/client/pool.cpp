@@ -0,0 +1,548 @@
+/// @brief Services spreading requests over several sessions.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/pool.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace
+{
+  using namespace OpcUa;
+
+  class ServicesPool
+    : public PooledServices
+    , public AttributeServices
+    , public EndpointServices
+    , public MethodServices
+    , public NodeManagementServices
+    , public SubscriptionServices
+    , public ViewServices
+    , public AsyncServices
+    , public std::enable_shared_from_this<ServicesPool>
+  {
+  public:
+    explicit ServicesPool(const std::vector<Services::SharedPtr>& sessions)
+      : Sessions(sessions)
+      , Outstanding(sessions.size(), 0)
+      , SubscriptionCount(sessions.size(), 0)
+    {
+      if (Sessions.empty())
+      {
+        throw std::invalid_argument("Pool of services needs at least one session");
+      }
+    }
+
+    virtual std::size_t GetSize() const override
+    {
+      return Sessions.size();
+    }
+
+    virtual std::vector<unsigned> GetOutstanding() const override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      return Outstanding;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Session level requests go to every session
+    ////////////////////////////////////////////////////////////////
+    virtual OpenSecureChannelResponse OpenSecureChannel(const OpenSecureChannelParameters& parameters) override
+    {
+      return ForEach([&parameters](Services& session) { return session.OpenSecureChannel(parameters); });
+    }
+
+    virtual void CloseSecureChannel(uint32_t channelId) override
+    {
+      for (const Services::SharedPtr& session : Sessions)
+      {
+        session->CloseSecureChannel(channelId);
+      }
+    }
+
+    virtual CreateSessionResponse CreateSession(const RemoteSessionParameters& parameters) override
+    {
+      return ForEach([&parameters](Services& session) { return session.CreateSession(parameters); });
+    }
+
+    virtual ActivateSessionResponse ActivateSession(const ActivateSessionParameters& parameters) override
+    {
+      return ForEach([&parameters](Services& session) { return session.ActivateSession(parameters); });
+    }
+
+    virtual CloseSessionResponse CloseSession() override
+    {
+      return ForEach([](Services& session) { return session.CloseSession(); });
+    }
+
+    virtual void AbortSession() override
+    {
+      for (const Services::SharedPtr& session : Sessions)
+      {
+        session->AbortSession();
+      }
+    }
+
+    virtual DeleteNodesResponse DeleteNodes(const std::vector<OpcUa::DeleteNodesItem>& nodesToDelete) override
+    {
+      return Forward([&nodesToDelete](Services& session) { return session.DeleteNodes(nodesToDelete); });
+    }
+
+    virtual AttributeServices::SharedPtr Attributes() override
+    {
+      return shared_from_this();
+    }
+
+    virtual EndpointServices::SharedPtr Endpoints() override
+    {
+      return shared_from_this();
+    }
+
+    virtual MethodServices::SharedPtr Method() override
+    {
+      return shared_from_this();
+    }
+
+    virtual NodeManagementServices::SharedPtr NodeManagement() override
+    {
+      return shared_from_this();
+    }
+
+    virtual SubscriptionServices::SharedPtr Subscriptions() override
+    {
+      return shared_from_this();
+    }
+
+    virtual ViewServices::SharedPtr Views() override
+    {
+      return shared_from_this();
+    }
+
+    virtual AsyncServices::SharedPtr Async() override
+    {
+      return shared_from_this();
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Attribute Services
+    ////////////////////////////////////////////////////////////////
+    virtual std::vector<DataValue> Read(const ReadParameters& params) const override
+    {
+      return Forward([&params](Services& session) { return session.Attributes()->Read(params); });
+    }
+
+    virtual std::vector<StatusCode> Write(const std::vector<WriteValue>& values) override
+    {
+      return Forward([&values](Services& session) { return session.Attributes()->Write(values); });
+    }
+
+    virtual std::vector<HistoryReadResult> HistoryRead(const HistoryReadParameters& params) const override
+    {
+      return Forward([&params](Services& session) { return session.Attributes()->HistoryRead(params); });
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Endpoint Services
+    ////////////////////////////////////////////////////////////////
+    virtual std::vector<ApplicationDescription> FindServers(const FindServersParameters& params) const override
+    {
+      return Forward([&params](Services& session) { return session.Endpoints()->FindServers(params); });
+    }
+
+    virtual std::vector<EndpointDescription> GetEndpoints(const GetEndpointsParameters& filter) const override
+    {
+      return Forward([&filter](Services& session) { return session.Endpoints()->GetEndpoints(filter); });
+    }
+
+    virtual void RegisterServer(const ServerParameters& parameters) override
+    {
+      Sessions.front()->Endpoints()->RegisterServer(parameters);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Method Services
+    ////////////////////////////////////////////////////////////////
+    virtual std::vector<CallMethodResult> Call(const std::vector<CallMethodRequest>& methodsToCall) override
+    {
+      return Forward([&methodsToCall](Services& session) { return session.Method()->Call(methodsToCall); });
+    }
+
+    virtual void SetMethod(const NodeId& node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback) override
+    {
+      for (const Services::SharedPtr& session : Sessions)
+      {
+        session->Method()->SetMethod(node, callback);
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Node Management Services
+    ////////////////////////////////////////////////////////////////
+    virtual std::vector<AddNodesResult> AddNodes(const std::vector<AddNodesItem>& items) override
+    {
+      return Forward([&items](Services& session) { return session.NodeManagement()->AddNodes(items); });
+    }
+
+    virtual std::vector<StatusCode> AddReferences(const std::vector<AddReferencesItem>& items) override
+    {
+      return Forward([&items](Services& session) { return session.NodeManagement()->AddReferences(items); });
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// View Services
+    ////////////////////////////////////////////////////////////////
+    virtual std::vector<BrowseResult> Browse(const OpcUa::NodesQuery& query) const override
+    {
+      const std::size_t index = Acquire();
+      Lease lease(*this, index);
+      std::vector<BrowseResult> results = Sessions[index]->Views()->Browse(query);
+      SetBrowsing(index, results);
+      return results;
+    }
+
+    // Continuation points belong to the session which answered Browse
+    virtual std::vector<BrowseResult> BrowseNext() const override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      std::map<std::thread::id, std::size_t>::const_iterator browsingIt = Browsing.find(std::this_thread::get_id());
+      const std::size_t index = browsingIt == Browsing.end() ? 0 : browsingIt->second;
+      lock.unlock();
+      Lease lease(*this, Acquire(index));
+      std::vector<BrowseResult> results = Sessions[index]->Views()->BrowseNext();
+      SetBrowsing(index, results);
+      return results;
+    }
+
+    virtual void ReleaseContinuationPoints() const override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      std::map<std::thread::id, std::size_t>::const_iterator browsingIt = Browsing.find(std::this_thread::get_id());
+      if (browsingIt == Browsing.end())
+      {
+        return;
+      }
+      const std::size_t index = browsingIt->second;
+      Browsing.erase(browsingIt);
+      lock.unlock();
+      Lease lease(*this, Acquire(index));
+      Sessions[index]->Views()->ReleaseContinuationPoints();
+    }
+
+    virtual std::vector<BrowsePathResult> TranslateBrowsePathsToNodeIds(const TranslateBrowsePathsParameters& params) const override
+    {
+      return Forward([&params](Services& session) { return session.Views()->TranslateBrowsePathsToNodeIds(params); });
+    }
+
+    // Registered ids are only valid in the session which registered them
+    virtual std::vector<NodeId> RegisterNodes(const std::vector<NodeId>& params) const override
+    {
+      return Sessions.front()->Views()->RegisterNodes(params);
+    }
+
+    virtual void UnregisterNodes(const std::vector<NodeId>& params) const override
+    {
+      Sessions.front()->Views()->UnregisterNodes(params);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Subscription Services, every subscription is pinned to one session
+    ////////////////////////////////////////////////////////////////
+    virtual SubscriptionData CreateSubscription(const CreateSubscriptionRequest& request, std::function<void (PublishResult)> callback) override
+    {
+      const std::size_t index = Acquire(GetLeastSubscribed());
+      Lease lease(*this, index);
+      const SubscriptionData data = Sessions[index]->Subscriptions()->CreateSubscription(request, callback);
+      Pin(data.SubscriptionId, index);
+      return data;
+    }
+
+    virtual std::vector<StatusCode> DeleteSubscriptions(const std::vector<uint32_t>& subscriptions) override
+    {
+      std::map<std::size_t, std::vector<std::size_t>> positions;
+      std::unique_lock<std::mutex> lock(Mutex);
+      for (std::size_t i = 0; i < subscriptions.size(); ++i)
+      {
+        positions[GetPinned(subscriptions[i])].push_back(i);
+      }
+      lock.unlock();
+
+      std::vector<StatusCode> results(subscriptions.size(), StatusCode::BadSubscriptionIdInvalid);
+      for (const std::map<std::size_t, std::vector<std::size_t>>::value_type& session : positions)
+      {
+        std::vector<uint32_t> ids;
+        for (std::size_t position : session.second)
+        {
+          ids.push_back(subscriptions[position]);
+        }
+        Lease lease(*this, Acquire(session.first));
+        const std::vector<StatusCode> sessionResults = Sessions[session.first]->Subscriptions()->DeleteSubscriptions(ids);
+        for (std::size_t i = 0; i < sessionResults.size() && i < session.second.size(); ++i)
+        {
+          results[session.second[i]] = sessionResults[i];
+        }
+      }
+
+      lock.lock();
+      for (uint32_t id : subscriptions)
+      {
+        std::map<uint32_t, std::size_t>::iterator pinnedIt = Pinned.find(id);
+        if (pinnedIt != Pinned.end())
+        {
+          --SubscriptionCount[pinnedIt->second];
+          Pinned.erase(pinnedIt);
+        }
+      }
+      return results;
+    }
+
+    // Acknowledgements go to the session of their subscription. Publish without them
+    // keeps publish requests pending on every session having subscriptions.
+    virtual void Publish(const PublishRequest& request) override
+    {
+      std::map<std::size_t, PublishRequest> requests;
+      std::unique_lock<std::mutex> lock(Mutex);
+      for (std::size_t index = 0; index < Sessions.size(); ++index)
+      {
+        if (SubscriptionCount[index])
+        {
+          requests[index] = PublishRequest();
+        }
+      }
+      for (const SubscriptionAcknowledgement& ack : request.SubscriptionAcknowledgements)
+      {
+        requests[GetPinned(ack.SubscriptionId)].SubscriptionAcknowledgements.push_back(ack);
+      }
+      lock.unlock();
+
+      for (std::map<std::size_t, PublishRequest>::value_type& sessionRequest : requests)
+      {
+        Sessions[sessionRequest.first]->Subscriptions()->Publish(sessionRequest.second);
+      }
+    }
+
+    virtual RepublishResponse Republish(const RepublishParameters& params) override
+    {
+      const std::size_t index = Acquire(GetPinned(params.SubscriptionId));
+      Lease lease(*this, index);
+      return Sessions[index]->Subscriptions()->Republish(params);
+    }
+
+    virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsParameters& params, std::function<void (PublishResult)> callback) override
+    {
+      const std::size_t index = Acquire(GetLeastSubscribed());
+      Lease lease(*this, index);
+      const std::vector<TransferResult> results = Sessions[index]->Subscriptions()->TransferSubscriptions(params, callback);
+      for (std::size_t i = 0; i < results.size() && i < params.SubscriptionIds.size(); ++i)
+      {
+        if (results[i].Status == StatusCode::Good)
+        {
+          Pin(params.SubscriptionIds[i], index);
+        }
+      }
+      return results;
+    }
+
+    virtual std::vector<MonitoredItemCreateResult> CreateMonitoredItems(const MonitoredItemsParameters& parameters) override
+    {
+      const std::size_t index = Acquire(GetPinned(parameters.SubscriptionId));
+      Lease lease(*this, index);
+      return Sessions[index]->Subscriptions()->CreateMonitoredItems(parameters);
+    }
+
+    virtual std::vector<StatusCode> DeleteMonitoredItems(const DeleteMonitoredItemsParameters& params) override
+    {
+      const std::size_t index = Acquire(GetPinned(params.SubscriptionId));
+      Lease lease(*this, index);
+      return Sessions[index]->Subscriptions()->DeleteMonitoredItems(params);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    /// Asynchronous Services, requests are outstanding until their callback
+    ////////////////////////////////////////////////////////////////
+    virtual void Read(const ReadParameters& params, ReadCallback callback) override
+    {
+      ForwardAsync(callback, [&params](AsyncServices& async, ReadCallback released) { async.Read(params, released); });
+    }
+
+    virtual void Write(const std::vector<WriteValue>& values, WriteCallback callback) override
+    {
+      ForwardAsync(callback, [&values](AsyncServices& async, WriteCallback released) { async.Write(values, released); });
+    }
+
+    virtual void Browse(const NodesQuery& query, BrowseCallback callback) override
+    {
+      ForwardAsync(callback, [&query](AsyncServices& async, BrowseCallback released) { async.Browse(query, released); });
+    }
+
+    virtual void Call(const std::vector<CallMethodRequest>& methodsToCall, CallCallback callback) override
+    {
+      ForwardAsync(callback, [&methodsToCall](AsyncServices& async, CallCallback released) { async.Call(methodsToCall, released); });
+    }
+
+  private:
+    // Counts a request as outstanding on a session while alive.
+    class Lease
+    {
+    public:
+      Lease(const ServicesPool& pool, std::size_t index)
+        : Pool(pool)
+        , Index(index)
+      {
+      }
+
+      ~Lease()
+      {
+        Pool.Release(Index);
+      }
+
+    private:
+      const ServicesPool& Pool;
+      const std::size_t Index;
+    };
+
+    // Session with fewest outstanding requests, ties are broken in turn.
+    std::size_t Acquire() const
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      std::size_t best = Next;
+      for (std::size_t i = 1; i < Sessions.size(); ++i)
+      {
+        const std::size_t index = (Next + i) % Sessions.size();
+        if (Outstanding[index] < Outstanding[best])
+        {
+          best = index;
+        }
+      }
+      Next = (best + 1) % Sessions.size();
+      ++Outstanding[best];
+      return best;
+    }
+
+    std::size_t Acquire(std::size_t index) const
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      ++Outstanding[index];
+      return index;
+    }
+
+    void Release(std::size_t index) const
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      --Outstanding[index];
+    }
+
+    template <typename Function>
+    auto Forward(Function function) const -> decltype(function(std::declval<Services&>()))
+    {
+      const std::size_t index = Acquire();
+      Lease lease(*this, index);
+      return function(*Sessions[index]);
+    }
+
+    template <typename Function>
+    auto ForEach(Function function) const -> decltype(function(std::declval<Services&>()))
+    {
+      for (std::size_t i = 1; i < Sessions.size(); ++i)
+      {
+        function(*Sessions[i]);
+      }
+      return function(*Sessions.front());
+    }
+
+    template <typename Results, typename Function>
+    void ForwardAsync(std::function<void (StatusCode, Results)> callback, Function function)
+    {
+      const std::size_t index = Acquire();
+      std::weak_ptr<const ServicesPool> self = shared_from_this();
+      std::function<void (StatusCode, Results)> released = [self, index, callback](StatusCode status, Results results)
+      {
+        if (std::shared_ptr<const ServicesPool> pool = self.lock())
+        {
+          pool->Release(index);
+        }
+        callback(status, std::move(results));
+      };
+      try
+      {
+        function(*Sessions[index]->Async(), released);
+      }
+      catch (...)
+      {
+        Release(index);
+        throw;
+      }
+    }
+
+    std::size_t GetLeastSubscribed() const
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      std::size_t best = 0;
+      for (std::size_t index = 1; index < Sessions.size(); ++index)
+      {
+        if (SubscriptionCount[index] < SubscriptionCount[best] ||
+            (SubscriptionCount[index] == SubscriptionCount[best] && Outstanding[index] < Outstanding[best]))
+        {
+          best = index;
+        }
+      }
+      return best;
+    }
+
+    // Threads are remembered only while they have continuation points to browse further,
+    // the map does not grow with every thread which ever browsed.
+    void SetBrowsing(std::size_t index, const std::vector<BrowseResult>& results) const
+    {
+      const bool more = std::any_of(results.begin(), results.end(), [](const BrowseResult& result) { return !result.ContinuationPoint.empty(); });
+      std::unique_lock<std::mutex> lock(Mutex);
+      if (more)
+        Browsing[std::this_thread::get_id()] = index;
+      else
+        Browsing.erase(std::this_thread::get_id());
+    }
+
+    // Mutex must be locked. Unknown subscriptions go to first session.
+    std::size_t GetPinned(uint32_t subscriptionId) const
+    {
+      std::map<uint32_t, std::size_t>::const_iterator pinnedIt = Pinned.find(subscriptionId);
+      return pinnedIt == Pinned.end() ? 0 : pinnedIt->second;
+    }
+
+    void Pin(uint32_t subscriptionId, std::size_t index)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      Pinned[subscriptionId] = index;
+      ++SubscriptionCount[index];
+    }
+
+  private:
+    const std::vector<Services::SharedPtr> Sessions;
+    mutable std::mutex Mutex;
+    mutable std::vector<unsigned> Outstanding;
+    mutable std::size_t Next = 0;
+    std::vector<unsigned> SubscriptionCount;
+    std::map<uint32_t, std::size_t> Pinned;
+    // Session of the last Browse of threads having continuation points
+    mutable std::map<std::thread::id, std::size_t> Browsing;
+  };
+
+}
+
+namespace OpcUa
+{
+
+  PooledServices::SharedPtr CreatePooledServices(const std::vector<Services::SharedPtr>& sessions)
+  {
+    return std::make_shared<ServicesPool>(sessions);
+  }
+
+} // namespace OpcUa
@@ -0,0 +1,636 @@
+/// @brief Client services surviving broken connections.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/reconnect.h>
+
+#include <opc/ua/client/callback_dispatcher.h>
+
+#include <opc/ua/protocol/string_utils.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+  using namespace OpcUa;
+
+  struct MonitoredItemState
+  {
+    TimestampsToReturn Timestamps;
+    MonitoredItemCreateRequest Request;
+    uint32_t ServerId;
+  };
+
+  // Subscription as created by the application. Ids known to the application are kept
+  // while ids on the server change when the subscription is created again.
+  struct SubscriptionState
+  {
+    CreateSubscriptionRequest Request;
+    std::function<void (PublishResult)> Callback;
+    uint32_t ServerId = 0;
+    uint32_t LastSequenceNumber = 0;
+    std::map<uint32_t, MonitoredItemState> Items;
+  };
+
+  typedef std::map<uint32_t, SubscriptionState> SubscriptionStateMap;
+
+  // Return id if it is not used yet, otherwise the next free one.
+  template <typename Map>
+  uint32_t GetFreeId(const Map& used, uint32_t id)
+  {
+    while (id == 0 || used.count(id))
+    {
+      ++id;
+    }
+    return id;
+  }
+
+  class ReconnectingClient
+    : public ReconnectingServices
+    , public SubscriptionServices
+    , public std::enable_shared_from_this<ReconnectingClient>
+  {
+  public:
+    ReconnectingClient(ConnectFunction connect, const ReconnectParameters& params, bool debug)
+      : Connect(connect)
+      , Params(params)
+      , Debug(debug)
+      , Callbacks(1, debug)
+    {
+    }
+
+    ~ReconnectingClient()
+    {
+      Stop();
+    }
+
+    void Start()
+    {
+      // Supervisor keeps no reference: services are never released by it, so never destroyed on its thread
+      Self = shared_from_this();
+      Current = Open();
+      std::unique_lock<std::mutex> lock(Mutex);
+      Supervisor = std::thread([this](){ Run(); });
+      SupervisorId = Supervisor.get_id();
+    }
+
+    virtual void Reconnect() override
+    {
+      std::unique_lock<std::mutex> reconnectLock(ReconnectMutex);
+      if (Debug) { std::cout << "reconnect| Opening new connection." << std::endl; }
+      std::unique_lock<std::mutex> lock(Mutex);
+      Lost = false;
+      lock.unlock();
+
+      Services::SharedPtr server = Open();
+
+      // Previous connection is kept until subscriptions are transferred from its session
+      lock.lock();
+      Services::SharedPtr previous = Current;
+      Current = server;
+      std::vector<uint32_t> ids;
+      std::vector<uint32_t> serverIds;
+      for (const SubscriptionStateMap::value_type& state : States)
+      {
+        ids.push_back(state.first);
+        serverIds.push_back(state.second.ServerId);
+      }
+      lock.unlock();
+
+      if (!ids.empty())
+      {
+        Resume(*server, ids, serverIds);
+      }
+      if (Debug) { std::cout << "reconnect| Connection replaced, " << ids.size() << " subscriptions resumed." << std::endl; }
+    }
+
+    virtual void Stop() override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      StopRequest = true;
+      Condition.notify_all();
+      lock.unlock();
+
+      // Application callbacks are called from Callbacks thread, supervisor calls only the connect function.
+      // Stopped from there it exits by itself and is joined by a later Stop or by the destructor.
+      if (std::this_thread::get_id() == SupervisorId)
+      {
+        return;
+      }
+      std::unique_lock<std::mutex> joinLock(JoinMutex);
+      if (Supervisor.joinable())
+      {
+        Supervisor.join();
+      }
+    }
+
+    virtual OpenSecureChannelResponse OpenSecureChannel(const OpenSecureChannelParameters& parameters) override
+    {
+      return GetCurrent()->OpenSecureChannel(parameters);
+    }
+
+    virtual void CloseSecureChannel(uint32_t channelId) override
+    {
+      GetCurrent()->CloseSecureChannel(channelId);
+    }
+
+    virtual CreateSessionResponse CreateSession(const RemoteSessionParameters& parameters) override
+    {
+      return GetCurrent()->CreateSession(parameters);
+    }
+
+    virtual ActivateSessionResponse ActivateSession(const ActivateSessionParameters& parameters) override
+    {
+      return GetCurrent()->ActivateSession(parameters);
+    }
+
+    virtual CloseSessionResponse CloseSession() override
+    {
+      return GetCurrent()->CloseSession();
+    }
+
+    virtual void AbortSession() override
+    {
+      GetCurrent()->AbortSession();
+    }
+
+    virtual DeleteNodesResponse DeleteNodes(const std::vector<OpcUa::DeleteNodesItem>& nodesToDelete) override
+    {
+      return GetCurrent()->DeleteNodes(nodesToDelete);
+    }
+
+    virtual AttributeServices::SharedPtr Attributes() override
+    {
+      return GetCurrent()->Attributes();
+    }
+
+    virtual EndpointServices::SharedPtr Endpoints() override
+    {
+      return GetCurrent()->Endpoints();
+    }
+
+    virtual MethodServices::SharedPtr Method() override
+    {
+      return GetCurrent()->Method();
+    }
+
+    virtual NodeManagementServices::SharedPtr NodeManagement() override
+    {
+      return GetCurrent()->NodeManagement();
+    }
+
+    virtual SubscriptionServices::SharedPtr Subscriptions() override
+    {
+      return shared_from_this();
+    }
+
+    virtual ViewServices::SharedPtr Views() override
+    {
+      return GetCurrent()->Views();
+    }
+
+    virtual AsyncServices::SharedPtr Async() override
+    {
+      return GetCurrent()->Async();
+    }
+
+    virtual SubscriptionData CreateSubscription(const CreateSubscriptionRequest& request, std::function<void (PublishResult)> callback) override
+    {
+      SubscriptionData data = GetCurrent()->Subscriptions()->CreateSubscription(request, GetPublishCallback());
+
+      std::unique_lock<std::mutex> lock(Mutex);
+      const uint32_t id = GetFreeId(States, data.SubscriptionId);
+      SubscriptionState& state = States[id];
+      state.Request = request;
+      state.Callback = callback;
+      state.ServerId = data.SubscriptionId;
+      Ids[data.SubscriptionId] = id;
+      data.SubscriptionId = id;
+      return data;
+    }
+
+    virtual std::vector<StatusCode> DeleteSubscriptions(const std::vector<uint32_t>& subscriptions) override
+    {
+      std::vector<uint32_t> serverIds;
+      std::unique_lock<std::mutex> lock(Mutex);
+      for (uint32_t id : subscriptions)
+      {
+        SubscriptionStateMap::iterator stateIt = States.find(id);
+        if (stateIt == States.end())
+        {
+          serverIds.push_back(id);
+          continue;
+        }
+        serverIds.push_back(stateIt->second.ServerId);
+        Ids.erase(stateIt->second.ServerId);
+        States.erase(stateIt);
+      }
+      lock.unlock();
+      return GetCurrent()->Subscriptions()->DeleteSubscriptions(serverIds);
+    }
+
+    virtual void Publish(const PublishRequest& originalrequest) override
+    {
+      PublishRequest request(originalrequest);
+      request.SubscriptionAcknowledgements.clear();
+      std::unique_lock<std::mutex> lock(Mutex);
+      for (const SubscriptionAcknowledgement& ack : originalrequest.SubscriptionAcknowledgements)
+      {
+        // Status changes made up on reconnection have no sequence number
+        SubscriptionStateMap::const_iterator stateIt = States.find(ack.SubscriptionId);
+        if (ack.SequenceNumber == 0 || stateIt == States.end())
+        {
+          continue;
+        }
+        SubscriptionAcknowledgement serverAck = ack;
+        serverAck.SubscriptionId = stateIt->second.ServerId;
+        request.SubscriptionAcknowledgements.push_back(serverAck);
+      }
+      lock.unlock();
+      GetCurrent()->Subscriptions()->Publish(request);
+    }
+
+    virtual RepublishResponse Republish(const RepublishParameters& originalparams) override
+    {
+      RepublishParameters params(originalparams);
+      params.SubscriptionId = GetServerId(params.SubscriptionId);
+      return GetCurrent()->Subscriptions()->Republish(params);
+    }
+
+    virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsParameters& params, std::function<void (PublishResult)> callback) override
+    {
+      return GetCurrent()->Subscriptions()->TransferSubscriptions(params, callback);
+    }
+
+    virtual std::vector<MonitoredItemCreateResult> CreateMonitoredItems(const MonitoredItemsParameters& originalparams) override
+    {
+      MonitoredItemsParameters params(originalparams);
+      params.SubscriptionId = GetServerId(params.SubscriptionId);
+      std::vector<MonitoredItemCreateResult> results = GetCurrent()->Subscriptions()->CreateMonitoredItems(params);
+
+      std::unique_lock<std::mutex> lock(Mutex);
+      SubscriptionStateMap::iterator stateIt = States.find(originalparams.SubscriptionId);
+      if (stateIt == States.end())
+      {
+        return results;
+      }
+      for (std::size_t i = 0; i < results.size() && i < params.ItemsToCreate.size(); ++i)
+      {
+        if (results[i].Status != StatusCode::Good)
+        {
+          continue;
+        }
+        const uint32_t id = GetFreeId(stateIt->second.Items, results[i].MonitoredItemId);
+        MonitoredItemState& item = stateIt->second.Items[id];
+        item.Timestamps = params.TimestampsToReturn;
+        item.Request = params.ItemsToCreate[i];
+        item.ServerId = results[i].MonitoredItemId;
+        results[i].MonitoredItemId = id;
+      }
+      return results;
+    }
+
+    virtual std::vector<StatusCode> DeleteMonitoredItems(const DeleteMonitoredItemsParameters& originalparams) override
+    {
+      DeleteMonitoredItemsParameters params(originalparams);
+      std::unique_lock<std::mutex> lock(Mutex);
+      SubscriptionStateMap::iterator stateIt = States.find(originalparams.SubscriptionId);
+      if (stateIt != States.end())
+      {
+        params.SubscriptionId = stateIt->second.ServerId;
+        for (uint32_t& id : params.MonitoredItemIds)
+        {
+          std::map<uint32_t, MonitoredItemState>::iterator itemIt = stateIt->second.Items.find(id);
+          if (itemIt != stateIt->second.Items.end())
+          {
+            id = itemIt->second.ServerId;
+            stateIt->second.Items.erase(itemIt);
+          }
+        }
+      }
+      lock.unlock();
+      return GetCurrent()->Subscriptions()->DeleteMonitoredItems(params);
+    }
+
+  private:
+    Services::SharedPtr GetCurrent() const
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      return Current;
+    }
+
+    uint32_t GetServerId(uint32_t id) const
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      SubscriptionStateMap::const_iterator stateIt = States.find(id);
+      return stateIt == States.end() ? id : stateIt->second.ServerId;
+    }
+
+    Services::SharedPtr Open()
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      const uint64_t generation = ++Generation;
+      lock.unlock();
+
+      std::weak_ptr<ReconnectingClient> self = Self;
+      return Connect([self, generation]()
+        {
+          if (std::shared_ptr<ReconnectingClient> client = self.lock())
+          {
+            client->OnConnectionLost(generation);
+          }
+        });
+    }
+
+    void OnConnectionLost(uint64_t generation)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      // Only the current connection matters
+      if (generation != Generation)
+      {
+        return;
+      }
+      if (Debug) { std::cout << "reconnect| Connection lost." << std::endl; }
+      Lost = true;
+      Condition.notify_all();
+    }
+
+    void Run()
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      while (true)
+      {
+        Condition.wait(lock, [this]() { return StopRequest || Lost; });
+        if (StopRequest)
+        {
+          return;
+        }
+        lock.unlock();
+        NotifyState(StatusCode::BadConnectionClosed);
+
+        std::chrono::milliseconds delay = Params.InitialDelay;
+        while (true)
+        {
+          lock.lock();
+          if (Condition.wait_for(lock, delay, [this]() { return StopRequest; }))
+          {
+            return;
+          }
+          lock.unlock();
+          try
+          {
+            Reconnect();
+            break;
+          }
+          catch (const std::exception& exc)
+          {
+            std::cerr << "reconnect| Failed to reconnect: " << exc.what() << std::endl;
+          }
+          delay = std::min(delay * 2, Params.MaxDelay);
+        }
+        NotifyState(StatusCode::Good);
+        lock.lock();
+      }
+    }
+
+    void NotifyState(StatusCode status)
+    {
+      if (!Params.StateChanged)
+      {
+        return;
+      }
+      const std::function<void (StatusCode)> callback = Params.StateChanged;
+      Callbacks.Post(0, [callback, status]() { callback(status); });
+    }
+
+    std::function<void (PublishResult)> GetPublishCallback()
+    {
+      std::weak_ptr<ReconnectingClient> self = Self;
+      return [self](PublishResult result)
+        {
+          if (std::shared_ptr<ReconnectingClient> client = self.lock())
+          {
+            client->OnPublish(std::move(result));
+          }
+        };
+    }
+
+    void OnPublish(PublishResult result)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      std::map<uint32_t, uint32_t>::const_iterator idIt = Ids.find(result.SubscriptionId);
+      if (idIt == Ids.end())
+      {
+        if (Debug) { std::cout << "reconnect| Dropping notification of unknown subscription " << result.SubscriptionId << std::endl; }
+        return;
+      }
+      SubscriptionState& state = States[idIt->second];
+      // Keep alive messages carry the number of the next message
+      if (!result.NotificationMessage.NotificationData.empty())
+      {
+        state.LastSequenceNumber = result.NotificationMessage.SequenceNumber;
+      }
+      result.SubscriptionId = idIt->second;
+      Post(state.Callback, std::move(result));
+    }
+
+    void NotifyDataLost(uint32_t id)
+    {
+      StatusChangeNotification notification;
+      notification.Status = StatusCode::BadDataLost;
+      PublishResult result;
+      result.SubscriptionId = id;
+      result.NotificationMessage.SequenceNumber = 0;
+      result.NotificationMessage.PublishTime = DateTime::Current();
+      result.NotificationMessage.NotificationData.push_back(NotificationData(notification));
+
+      std::unique_lock<std::mutex> lock(Mutex);
+      SubscriptionStateMap::const_iterator stateIt = States.find(id);
+      if (stateIt == States.end())
+      {
+        return;
+      }
+      Post(stateIt->second.Callback, std::move(result));
+    }
+
+    // Notifications go through the thread of state callbacks too: republished ones
+    // are then called before those of the new session, all in the order they came.
+    void Post(const std::function<void (PublishResult)>& callback, PublishResult result)
+    {
+      const uint32_t id = result.SubscriptionId;
+      std::shared_ptr<PublishResult> shared = std::make_shared<PublishResult>(std::move(result));
+      Callbacks.Post(id, [callback, shared]() { callback(std::move(*shared)); });
+    }
+
+    void Resume(Services& server, const std::vector<uint32_t>& ids, const std::vector<uint32_t>& serverIds)
+    {
+      TransferSubscriptionsParameters params;
+      params.SubscriptionIds = serverIds;
+      params.SendInitialValues = false;
+      std::vector<TransferResult> results;
+      try
+      {
+        results = server.Subscriptions()->TransferSubscriptions(params, GetPublishCallback());
+      }
+      catch (const std::exception& exc)
+      {
+        if (Debug) { std::cout << "reconnect| Failed to transfer subscriptions: " << exc.what() << std::endl; }
+      }
+
+      for (std::size_t i = 0; i < ids.size(); ++i)
+      {
+        if (i < results.size() && results[i].Status == StatusCode::Good)
+        {
+          Republish(server, ids[i], serverIds[i], results[i].AvailableSequenceNumbers);
+        }
+        else
+        {
+          Recreate(server, ids[i]);
+        }
+      }
+      // Start publishing on the new session
+      server.Subscriptions()->Publish(PublishRequest());
+    }
+
+    // Deliver notifications sent by server but not received before the connection broke.
+    void Republish(Services& server, uint32_t id, uint32_t serverId, std::vector<uint32_t> available)
+    {
+      if (Debug) { std::cout << "reconnect| Subscription " << id << " transferred." << std::endl; }
+      std::unique_lock<std::mutex> lock(Mutex);
+      uint32_t expected = States[id].LastSequenceNumber + 1;
+      lock.unlock();
+
+      bool lost = false;
+      std::sort(available.begin(), available.end());
+      for (uint32_t sequenceNumber : available)
+      {
+        if (sequenceNumber < expected)
+        {
+          continue;
+        }
+        lost = lost || (expected != 1 && sequenceNumber != expected);
+        expected = sequenceNumber + 1;
+
+        RepublishParameters params;
+        params.SubscriptionId = serverId;
+        params.RetransmitSequenceNumber = sequenceNumber;
+        RepublishResponse response = server.Subscriptions()->Republish(params);
+        if (response.Header.ServiceResult != StatusCode::Good)
+        {
+          lost = true;
+          continue;
+        }
+        PublishResult result;
+        result.SubscriptionId = serverId;
+        result.NotificationMessage = std::move(response.NotificationMessage);
+        OnPublish(std::move(result));
+      }
+      if (lost)
+      {
+        NotifyDataLost(id);
+      }
+    }
+
+    void Recreate(Services& server, uint32_t id)
+    {
+      if (Debug) { std::cout << "reconnect| Creating subscription " << id << " again." << std::endl; }
+      std::unique_lock<std::mutex> lock(Mutex);
+      SubscriptionStateMap::const_iterator stateIt = States.find(id);
+      if (stateIt == States.end())
+      {
+        return;
+      }
+      const CreateSubscriptionRequest request = stateIt->second.Request;
+      const std::map<uint32_t, MonitoredItemState> items = stateIt->second.Items;
+      lock.unlock();
+
+      const SubscriptionData data = server.Subscriptions()->CreateSubscription(request, GetPublishCallback());
+
+      lock.lock();
+      SubscriptionState& state = States[id];
+      Ids.erase(state.ServerId);
+      Ids[data.SubscriptionId] = id;
+      state.ServerId = data.SubscriptionId;
+      state.LastSequenceNumber = 0;
+      lock.unlock();
+
+      // All items of a subscription are created with one request for every kind of timestamps
+      std::map<TimestampsToReturn, std::vector<uint32_t>> groups;
+      for (const std::map<uint32_t, MonitoredItemState>::value_type& item : items)
+      {
+        groups[item.second.Timestamps].push_back(item.first);
+      }
+      for (const std::map<TimestampsToReturn, std::vector<uint32_t>>::value_type& group : groups)
+      {
+        MonitoredItemsParameters params;
+        params.SubscriptionId = data.SubscriptionId;
+        params.TimestampsToReturn = group.first;
+        for (uint32_t itemId : group.second)
+        {
+          params.ItemsToCreate.push_back(items.at(itemId).Request);
+        }
+        const std::vector<MonitoredItemCreateResult> results = server.Subscriptions()->CreateMonitoredItems(params);
+
+        lock.lock();
+        SubscriptionState& current = States[id];
+        for (std::size_t i = 0; i < results.size() && i < group.second.size(); ++i)
+        {
+          if (results[i].Status != StatusCode::Good)
+          {
+            std::cerr << "reconnect| Failed to create monitored item " << group.second[i] << " again: " << ToString(results[i].Status) << std::endl;
+            continue;
+          }
+          current.Items[group.second[i]].ServerId = results[i].MonitoredItemId;
+        }
+        lock.unlock();
+      }
+      NotifyDataLost(id);
+    }
+
+  private:
+    const ConnectFunction Connect;
+    const ReconnectParameters Params;
+    const bool Debug;
+
+    mutable std::mutex Mutex;
+    std::condition_variable Condition;
+    Services::SharedPtr Current;
+    uint64_t Generation = 0;
+    bool Lost = false;
+    bool StopRequest = false;
+    SubscriptionStateMap States;
+    // Subscription ids on server mapped to ids known by application
+    std::map<uint32_t, uint32_t> Ids;
+
+    std::mutex ReconnectMutex;
+    std::weak_ptr<ReconnectingClient> Self;
+    // Calls application callbacks, which may then stop or release these services
+    CallbackDispatcher Callbacks;
+    std::mutex JoinMutex;
+    std::thread Supervisor;
+    std::thread::id SupervisorId;
+  };
+
+}
+
+namespace OpcUa
+{
+
+  ReconnectingServices::SharedPtr CreateReconnectingServices(ConnectFunction connect, const ReconnectParameters& params, bool debug)
+  {
+    std::shared_ptr<ReconnectingClient> client = std::make_shared<ReconnectingClient>(connect, params, debug);
+    client->Start();
+    return client;
+  }
+
+} // namespace OpcUa
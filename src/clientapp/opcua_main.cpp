@@ -19,7 +19,9 @@
 #include <opc/ua/protocol/string_utils.h>
 #include <opc/ua/protocol/variant_visitor.h>
 #include <opc/ua/services/services.h>
+#include <opc/ua/tree_walker.h>
 
+#include <chrono>
 #include <iostream>
 #include <stdexcept>
 
@@ -380,6 +382,20 @@ namespace
     }
   }
 
+  // One line per reference, nodes are listed level by level.
+  void Dump(OpcUa::ViewServices& view, OpcUa::NodeId nodeId)
+  {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const std::size_t count = OpcUa::WalkTree(view, nodeId, [](const OpcUa::NodeId&, const OpcUa::ReferenceDescription& ref, unsigned depth)
+      {
+        std::cout << Tabs(depth * 2) << OpcUa::ToString(ref.TargetNodeId) << " " << ref.BrowseName.NamespaceIndex << ":" << ref.BrowseName.Name
+                  << " (" << GetNodeClassName(static_cast<unsigned>(ref.TargetNodeClass)) << ")\n";
+        return true;
+      });
+    const std::chrono::milliseconds elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << count << " references in " << elapsed.count() << " ms" << std::endl;
+  }
+
 
   struct VariantPrinter
   {
@@ -647,6 +663,11 @@ namespace
       Print(nodeId, Tabs(0));
       Browse(*computer->Views(), nodeId);
     }
+    else if (cmd.IsDumpOperation())
+    {
+      const OpcUa::NodeId nodeId = cmd.GetNodeId() == OpcUa::NodeId() ? OpcUa::NodeId(OpcUa::ObjectId::RootFolder) : cmd.GetNodeId();
+      Dump(*computer->Views(), nodeId);
+    }
     else if (cmd.IsReadOperation())
     {
       const OpcUa::NodeId nodeId = cmd.GetNodeId();
@@ -29,6 +29,7 @@ namespace
   const char* OPTION_HELP = "help";
   const char* OPTION_GET_ENDPOINTS = "get-endpoints";
   const char* OPTION_BROWSE = "browse";
+  const char* OPTION_DUMP = "dump";
   const char* OPTION_READ = "read";
   const char* OPTION_WRITE = "write";
   const char* OPTION_CREATE_SUBSCRIPTION = "create-subscription";
@@ -127,6 +128,7 @@ namespace OpcUa
     , IsHelp(false)
     , IsGetEndpoints(false)
     , IsBrowse(false)
+    , IsDump(false)
     , IsRead(false)
     , IsWrite(false)
     , IsCreateSubscription(false)
@@ -140,6 +142,7 @@ namespace OpcUa
       (OPTION_HELP, "produce help message")
       (OPTION_GET_ENDPOINTS, "List endpoints endpoints.")
       (OPTION_BROWSE, "browse command.")
+      (OPTION_DUMP, "dump the whole tree below node-id, Root by default.")
       (OPTION_READ, "read command.")
       (OPTION_WRITE, "write command.")
       (OPTION_CREATE_SUBSCRIPTION, "create subscription command.")
@@ -195,6 +198,7 @@ namespace OpcUa
     Value = GetOptionValue(vm);
     IsGetEndpoints = vm.count(OPTION_GET_ENDPOINTS) != 0;
     IsBrowse = vm.count(OPTION_BROWSE) != 0;
+    IsDump = vm.count(OPTION_DUMP) != 0;
     IsRead = vm.count(OPTION_READ) != 0;
     IsWrite = vm.count(OPTION_WRITE) != 0;
     IsCreateSubscription = vm.count(OPTION_CREATE_SUBSCRIPTION) != 0;
@@ -73,6 +73,11 @@ namespace OpcUa
       return IsBrowse;
     }
 
+    bool IsDumpOperation() const
+    {
+      return IsDump;
+    }
+
     bool IsReadOperation() const
     {
       return IsRead;
@@ -121,6 +126,7 @@ namespace OpcUa
     bool IsHelp;
     bool IsGetEndpoints;
     bool IsBrowse;
+    bool IsDump;
     bool IsRead;
     bool IsWrite;
     bool IsCreateSubscription;
@@ -15,10 +15,10 @@ namespace OpcUa
 
   Event::Event(const Node& type) : EventType(type.GetId()) {}
 
-  std::vector<std::vector<QualifiedName>> Event::GetValueKeys()
+  std::vector<std::vector<QualifiedName>> Event::GetValueKeys() const
   {
     std::vector<std::vector<QualifiedName>> qns;
-    for (auto qn : PathValues)
+    for (const auto& qn : PathValues)
     {
       qns.push_back(qn.first);
     }
@@ -55,19 +55,12 @@ namespace OpcUa
   Variant Event::GetValue(const std::vector<QualifiedName>& path) const
   {
     PathMap::const_iterator it = PathValues.find(path);
-      std::cout << "Looking for Event value: ";
-      for ( auto qn : path ){
-        std::cout << qn ;
-      }
-      std::cout << std::endl;
     if ( it == PathValues.end() )
     {
-      std::cout << "Bad Not found " << std::endl;
       return Variant();
     }
     else
     {
-      std::cout << "ok" << std::endl;
       return it->second;
     }
   }
@@ -1,5 +1,7 @@
 #include "opc/ua/server_operations.h"
 
+#include <stdexcept>
+
 namespace OpcUa {
 	ServerOperations::ServerOperations(Services::SharedPtr Server) : Server(Server)
 	{
@@ -11,6 +13,28 @@ namespace OpcUa {
 		CheckStatusCode(codes.front());
 	}
 
+	void ServerOperations::WriteValues(const std::vector<Node>& nodes, const std::vector<Variant>& values)
+	{
+		if (nodes.size() != values.size())
+		{
+			throw std::invalid_argument("Number of nodes and values differ.");
+		}
+		const DateTime now = DateTime::Current();
+		std::vector<WriteValue> updates(nodes.size());
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			updates[i].NodeId = nodes[i].GetId();
+			updates[i].AttributeId = AttributeId::Value;
+			updates[i].Value = DataValue(values[i]);
+			updates[i].Value.SetSourceTimestamp(now);
+		}
+		std::vector<StatusCode> codes = Server->Attributes()->Write(updates);
+		for (StatusCode code : codes)
+		{
+			CheckStatusCode(code);
+		}
+	}
+
 	std::vector<DataValue> ServerOperations::ReadAttributes(std::vector<ReadValueId>& attributes)
 	{
 		ReadParameters params;
@@ -32,7 +32,7 @@ namespace OpcUa
     CreateSubscriptionRequest request;
     request.Parameters = params;
     Services::SharedPtr serverptr = Server;
-    Data = Server->Subscriptions()->CreateSubscription(request, [this, serverptr](PublishResult i){ this->PublishCallback(serverptr, i); } );
+    Data = Server->Subscriptions()->CreateSubscription(request, [this, serverptr](PublishResult i){ this->PublishCallback(serverptr, std::move(i)); } );
     //After creating the subscription, it is expected to send at least one publish request
     Server->Subscriptions()->Publish(PublishRequest());
     Server->Subscriptions()->Publish(PublishRequest());
@@ -47,16 +47,19 @@ namespace OpcUa
     }
   }
 
-  void Subscription::PublishCallback(Services::SharedPtr server, const PublishResult result)
+  void Subscription::PublishCallback(Services::SharedPtr server, PublishResult result)
   {
 
     if (Debug){ std::cout << "Subscription | Suscription::PublishCallback called with " <<result.NotificationMessage.NotificationData.size() << " notifications " << std::endl; }
-    for (const NotificationData& data: result.NotificationMessage.NotificationData )
+    for (NotificationData& data: result.NotificationMessage.NotificationData )
     {
       if (data.Header.TypeId == ExpandedObjectId::DataChangeNotification)
       {
         if (Debug) { std::cout << "Subscription | Notification is of type DataChange\n"; }
-        CallDataChangeCallback(data);
+        if (Client.BatchDataChanges())
+          CallDataChangeBatchCallback(data);
+        else
+          CallDataChangeCallback(data);
       }
       else if (data.Header.TypeId == ExpandedObjectId::EventNotificationList)
       {
@@ -81,7 +84,31 @@ namespace OpcUa
     server->Subscriptions()->Publish(request);
   }
 
-  void Subscription::CallDataChangeCallback(const NotificationData& data)
+  void Subscription::CallDataChangeBatchCallback(NotificationData& data)
+  {
+    const std::size_t size = data.DataChange.Notification.size();
+    Changes.ClientHandles.resize(size);
+    Changes.Values.resize(size);
+    Changes.Statuses.resize(size);
+    Changes.SourceTimestamps.resize(size);
+    Changes.ServerTimestamps.resize(size);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      MonitoredItems& item = data.DataChange.Notification[i];
+      const uint8_t encoding = item.Value.Encoding;
+      Changes.ClientHandles[i] = item.ClientHandle;
+      Changes.Values[i] = std::move(item.Value.Value);
+      Changes.Statuses[i] = (encoding & DATA_VALUE_STATUS_CODE) ? item.Value.Status : StatusCode::Good;
+      Changes.SourceTimestamps[i] = (encoding & DATA_VALUE_SOURCE_TIMESTAMP) ? item.Value.SourceTimestamp : DateTime();
+      Changes.ServerTimestamps[i] = (encoding & DATA_VALUE_Server_TIMESTAMP) ? item.Value.ServerTimestamp : DateTime();
+    }
+
+    if (Debug) { std::cout << "Subscription | Debug: Calling DataChanges user callback with " << size << " changes" << std::endl; }
+    Client.DataChanges(GetId(), Changes);
+  }
+
+  void Subscription::CallDataChangeCallback(NotificationData& data)
   {
     for ( const MonitoredItems& item: data.DataChange.Notification)
     {
@@ -263,6 +290,19 @@ namespace OpcUa
     return monitoredItemsIds;
   }
 
+  uint32_t Subscription::GetClientHandle(uint32_t monitoredItemId)
+  {
+    std::unique_lock<std::mutex> lock(Mutex);
+    for (const AttValMap::value_type& pair : AttributeValueMap)
+    {
+      if (pair.second.MonitoredItemId == monitoredItemId)
+      {
+        return pair.first;
+      }
+    }
+    return 0;
+  }
+
   void Subscription::setUsrPtr(uint32_t handle,UserData *usr)
   {
       AttributeValueMap[handle].usrVar = usr;
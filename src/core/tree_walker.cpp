@@ -0,0 +1,157 @@
+/// @brief Walking large address spaces with batched Browse requests.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/tree_walker.h>
+
+#include <deque>
+#include <set>
+
+namespace
+{
+
+  using namespace OpcUa;
+
+  struct PendingNode
+  {
+    NodeId Id;
+    unsigned Depth;
+  };
+
+  class TreeWalker
+  {
+  public:
+    TreeWalker(ViewServices& views, TreeVisitor visitor, const TreeWalkParameters& params)
+      : Views(views)
+      , Visitor(visitor)
+      , Params(params)
+    {
+    }
+
+    std::size_t Walk(const NodeId& root)
+    {
+      Visited.insert(root);
+      Queue.push_back(PendingNode{root, 0});
+      while (!Queue.empty())
+      {
+        BrowseBatch(TakeBatch());
+      }
+      return Visits;
+    }
+
+  private:
+    // Oldest nodes first, newest when the queue is over MaxQueued.
+    std::vector<PendingNode> TakeBatch()
+    {
+      const bool deepFirst = Queue.size() > Params.MaxQueued;
+      const std::size_t count = std::min<std::size_t>(Queue.size(), std::max(Params.NodesPerRequest, 1u));
+      std::vector<PendingNode> batch;
+      batch.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        if (deepFirst)
+        {
+          batch.push_back(std::move(Queue.back()));
+          Queue.pop_back();
+        }
+        else
+        {
+          batch.push_back(std::move(Queue.front()));
+          Queue.pop_front();
+        }
+      }
+      return batch;
+    }
+
+    void BrowseBatch(std::vector<PendingNode> batch)
+    {
+      NodesQuery query;
+      query.MaxReferenciesPerNode = Params.MaxReferencesPerNode;
+      query.NodesToBrowse.reserve(batch.size());
+      for (const PendingNode& node : batch)
+      {
+        BrowseDescription description;
+        description.NodeToBrowse = node.Id;
+        description.Direction = BrowseDirection::Forward;
+        description.ReferenceTypeId = Params.ReferenceTypeId;
+        description.IncludeSubtypes = Params.IncludeSubtypes;
+        description.NodeClasses = Params.NodeClasses;
+        description.ResultMask = Params.ResultMask;
+        query.NodesToBrowse.push_back(description);
+      }
+
+      std::vector<BrowseResult> results = Views.Browse(query);
+      while (!batch.empty())
+      {
+        if (results.size() != batch.size())
+        {
+          // Results cannot be matched to their nodes, continuation points would stay held by the server
+          Views.ReleaseContinuationPoints();
+          break;
+        }
+        // BrowseNext continues every result with a continuation point, in the same order
+        std::vector<PendingNode> continued;
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+          Visit(batch[i], results[i]);
+          if (!results[i].ContinuationPoint.empty())
+          {
+            continued.push_back(std::move(batch[i]));
+          }
+        }
+        batch.swap(continued);
+        if (batch.empty())
+        {
+          break;
+        }
+        results = Views.BrowseNext();
+      }
+    }
+
+    void Visit(const PendingNode& parent, const BrowseResult& result)
+    {
+      for (const ReferenceDescription& reference : result.Referencies)
+      {
+        ++Visits;
+        const unsigned depth = parent.Depth + 1;
+        if (!Visitor(parent.Id, reference, depth))
+        {
+          continue;
+        }
+        if (Params.MaxDepth && depth >= Params.MaxDepth)
+        {
+          continue;
+        }
+        if (Visited.insert(reference.TargetNodeId).second)
+        {
+          Queue.push_back(PendingNode{reference.TargetNodeId, depth});
+        }
+      }
+    }
+
+  private:
+    ViewServices& Views;
+    TreeVisitor Visitor;
+    const TreeWalkParameters& Params;
+    std::deque<PendingNode> Queue;
+    // Every node seen during the walk
+    std::set<NodeId> Visited;
+    std::size_t Visits = 0;
+  };
+
+}
+
+namespace OpcUa
+{
+
+  std::size_t WalkTree(ViewServices& views, const NodeId& root, TreeVisitor visitor, const TreeWalkParameters& params)
+  {
+    TreeWalker walker(views, visitor, params);
+    return walker.Walk(root);
+  }
+
+} // namespace OpcUa
@@ -0,0 +1,491 @@
+/// @brief Opc Ua binary history services.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "binary_serialization.h"
+
+#include <opc/ua/protocol/history.h>
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/expanded_object_ids.h>
+#include <opc/ua/protocol/message_identifiers.h>
+
+#include <stdexcept>
+
+namespace OpcUa
+{
+
+  HistoryReadDetails::HistoryReadDetails(const ReadRawModifiedDetails& details)
+    : RawModified(details)
+  {
+    Header.TypeId = ExpandedObjectId::ReadRawModifiedDetails;
+    Header.Encoding = ExtensionObjectEncoding::HAS_BINARY_BODY;
+  }
+
+  HistoryReadDetails::HistoryReadDetails(const ReadAtTimeDetails& details)
+    : AtTime(details)
+  {
+    Header.TypeId = ExpandedObjectId::ReadAtTimeDetails;
+    Header.Encoding = ExtensionObjectEncoding::HAS_BINARY_BODY;
+  }
+
+  HistoryReadDetails::HistoryReadDetails(const ReadProcessedDetails& details)
+    : Processed(details)
+  {
+    Header.TypeId = ExpandedObjectId::ReadProcessedDetails;
+    Header.Encoding = ExtensionObjectEncoding::HAS_BINARY_BODY;
+  }
+
+  HistoryReadResult::HistoryReadResult()
+    : Status(StatusCode::Good)
+  {
+    Header.TypeId = ExpandedObjectId::HistoryData;
+    Header.Encoding = ExtensionObjectEncoding::HAS_BINARY_BODY;
+  }
+
+  HistoryReadRequest::HistoryReadRequest()
+    : TypeId(HISTORY_READ_REQUEST)
+  {
+  }
+
+  HistoryReadResponse::HistoryReadResponse()
+    : TypeId(HISTORY_READ_RESPONSE)
+  {
+  }
+
+  namespace Binary
+  {
+
+    ////////////////////////////////////////////////////////
+    // HistoryReadValueId
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<HistoryReadValueId>(const HistoryReadValueId& value)
+    {
+      return RawSize(value.NodeId) +
+          RawSize(value.IndexRange) +
+          RawSize(value.DataEncoding) +
+          RawSize(value.ContinuationPoint);
+    }
+
+    template<>
+    void DataSerializer::Serialize<HistoryReadValueId>(const HistoryReadValueId& value)
+    {
+      *this << value.NodeId;
+      *this << value.IndexRange;
+      *this << value.DataEncoding;
+      *this << value.ContinuationPoint;
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<HistoryReadValueId>(HistoryReadValueId& value)
+    {
+      *this >> value.NodeId;
+      *this >> value.IndexRange;
+      *this >> value.DataEncoding;
+      *this >> value.ContinuationPoint;
+    }
+
+    ////////////////////////////////////////////////////////
+    // ReadRawModifiedDetails
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<ReadRawModifiedDetails>(const ReadRawModifiedDetails& details)
+    {
+      return RawSize(details.IsReadModified) +
+          RawSize(details.StartTime) +
+          RawSize(details.EndTime) +
+          RawSize(details.NumValuesPerNode) +
+          RawSize(details.ReturnBounds);
+    }
+
+    template<>
+    void DataSerializer::Serialize<ReadRawModifiedDetails>(const ReadRawModifiedDetails& details)
+    {
+      *this << details.IsReadModified;
+      *this << details.StartTime;
+      *this << details.EndTime;
+      *this << details.NumValuesPerNode;
+      *this << details.ReturnBounds;
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<ReadRawModifiedDetails>(ReadRawModifiedDetails& details)
+    {
+      *this >> details.IsReadModified;
+      *this >> details.StartTime;
+      *this >> details.EndTime;
+      *this >> details.NumValuesPerNode;
+      *this >> details.ReturnBounds;
+    }
+
+    ////////////////////////////////////////////////////////
+    // ReadAtTimeDetails
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<ReadAtTimeDetails>(const ReadAtTimeDetails& details)
+    {
+      return RawSizeContainer(details.ReqTimes) +
+          RawSize(details.UseSimpleBounds);
+    }
+
+    template<>
+    void DataSerializer::Serialize<ReadAtTimeDetails>(const ReadAtTimeDetails& details)
+    {
+      SerializeContainer(*this, details.ReqTimes);
+      *this << details.UseSimpleBounds;
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<ReadAtTimeDetails>(ReadAtTimeDetails& details)
+    {
+      DeserializeContainer(*this, details.ReqTimes);
+      *this >> details.UseSimpleBounds;
+    }
+
+    ////////////////////////////////////////////////////////
+    // AggregateConfiguration
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<AggregateConfiguration>(const AggregateConfiguration& config)
+    {
+      return RawSize(config.UseServerCapabilitiesDefaults) +
+          RawSize(config.TreatUncertainAsBad) +
+          RawSize(config.PercentDataBad) +
+          RawSize(config.PercentDataGood) +
+          RawSize(config.UseSlopedExtrapolation);
+    }
+
+    template<>
+    void DataSerializer::Serialize<AggregateConfiguration>(const AggregateConfiguration& config)
+    {
+      *this << config.UseServerCapabilitiesDefaults;
+      *this << config.TreatUncertainAsBad;
+      *this << config.PercentDataBad;
+      *this << config.PercentDataGood;
+      *this << config.UseSlopedExtrapolation;
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<AggregateConfiguration>(AggregateConfiguration& config)
+    {
+      *this >> config.UseServerCapabilitiesDefaults;
+      *this >> config.TreatUncertainAsBad;
+      *this >> config.PercentDataBad;
+      *this >> config.PercentDataGood;
+      *this >> config.UseSlopedExtrapolation;
+    }
+
+    ////////////////////////////////////////////////////////
+    // ReadProcessedDetails
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<ReadProcessedDetails>(const ReadProcessedDetails& details)
+    {
+      return RawSize(details.StartTime) +
+          RawSize(details.EndTime) +
+          RawSize(details.ProcessingInterval) +
+          RawSizeContainer(details.AggregateType) +
+          RawSize(details.AggregateConfiguration);
+    }
+
+    template<>
+    void DataSerializer::Serialize<ReadProcessedDetails>(const ReadProcessedDetails& details)
+    {
+      *this << details.StartTime;
+      *this << details.EndTime;
+      *this << details.ProcessingInterval;
+      SerializeContainer(*this, details.AggregateType);
+      *this << details.AggregateConfiguration;
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<ReadProcessedDetails>(ReadProcessedDetails& details)
+    {
+      *this >> details.StartTime;
+      *this >> details.EndTime;
+      *this >> details.ProcessingInterval;
+      DeserializeContainer(*this, details.AggregateType);
+      *this >> details.AggregateConfiguration;
+    }
+
+    ////////////////////////////////////////////////////////
+    // HistoryReadDetails
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<HistoryReadDetails>(const HistoryReadDetails& details)
+    {
+      std::size_t total = RawSize(details.Header);
+      if ( details.Header.TypeId == ExpandedObjectId::ReadRawModifiedDetails )
+      {
+        total += 4;
+        total += RawSize(details.RawModified);
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadAtTimeDetails )
+      {
+        total += 4;
+        total += RawSize(details.AtTime);
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadProcessedDetails )
+      {
+        total += 4;
+        total += RawSize(details.Processed);
+      }
+      else if ( details.Header.TypeId != NodeId(0, 0) )
+      {
+        throw std::runtime_error("HistoryReadDetails type not implemented");
+      }
+      return total;
+    }
+
+    template<>
+    void DataSerializer::Serialize<HistoryReadDetails>(const HistoryReadDetails& details)
+    {
+      *this << details.Header;
+      if ( details.Header.TypeId == ExpandedObjectId::ReadRawModifiedDetails )
+      {
+        *this << (uint32_t) RawSize(details.RawModified);
+        *this << details.RawModified;
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadAtTimeDetails )
+      {
+        *this << (uint32_t) RawSize(details.AtTime);
+        *this << details.AtTime;
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadProcessedDetails )
+      {
+        *this << (uint32_t) RawSize(details.Processed);
+        *this << details.Processed;
+      }
+      else if ( details.Header.TypeId != NodeId(0, 0) )
+      {
+        throw std::runtime_error("HistoryReadDetails type not supported in serialization");
+      }
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<HistoryReadDetails>(HistoryReadDetails& details)
+    {
+      *this >> details.Header;
+      int32_t size;
+      if ( details.Header.TypeId == ExpandedObjectId::ReadRawModifiedDetails )
+      {
+        *this >> size; //not used yet
+        *this >> details.RawModified;
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadAtTimeDetails )
+      {
+        *this >> size; //not used yet
+        *this >> details.AtTime;
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadProcessedDetails )
+      {
+        *this >> size; //not used yet
+        *this >> details.Processed;
+      }
+      else if ( details.Header.TypeId != NodeId(0, 0) )
+      {
+        throw std::runtime_error("HistoryReadDetails type not supported in deserialization");
+      }
+    }
+
+    ////////////////////////////////////////////////////////
+    // ModificationInfo
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<ModificationInfo>(const ModificationInfo& info)
+    {
+      return RawSize(info.ModificationTime) +
+          RawSize(info.UpdateType) +
+          RawSize(info.UserName);
+    }
+
+    template<>
+    void DataSerializer::Serialize<ModificationInfo>(const ModificationInfo& info)
+    {
+      *this << info.ModificationTime;
+      *this << info.UpdateType;
+      *this << info.UserName;
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<ModificationInfo>(ModificationInfo& info)
+    {
+      *this >> info.ModificationTime;
+      *this >> info.UpdateType;
+      *this >> info.UserName;
+    }
+
+    ////////////////////////////////////////////////////////
+    // HistoryReadResult
+    ////////////////////////////////////////////////////////
+
+    namespace
+    {
+      std::size_t RawSizeHistoryData(const HistoryReadResult& result)
+      {
+        std::size_t total = RawSizeContainer(result.DataValues);
+        if ( result.Header.TypeId == ExpandedObjectId::HistoryModifiedData )
+        {
+          total += RawSizeContainer(result.ModificationInfos);
+        }
+        return total;
+      }
+    }
+
+    template<>
+    std::size_t RawSize<HistoryReadResult>(const HistoryReadResult& result)
+    {
+      std::size_t total = RawSize(result.Status) +
+          RawSize(result.ContinuationPoint) +
+          RawSize(result.Header);
+      if ( result.Header.TypeId == ExpandedObjectId::HistoryData || result.Header.TypeId == ExpandedObjectId::HistoryModifiedData )
+      {
+        total += 4;
+        total += RawSizeHistoryData(result);
+      }
+      return total;
+    }
+
+    template<>
+    void DataSerializer::Serialize<HistoryReadResult>(const HistoryReadResult& result)
+    {
+      *this << result.Status;
+      *this << result.ContinuationPoint;
+      *this << result.Header;
+      if ( result.Header.TypeId == ExpandedObjectId::HistoryData || result.Header.TypeId == ExpandedObjectId::HistoryModifiedData )
+      {
+        *this << (uint32_t) RawSizeHistoryData(result);
+        SerializeContainer(*this, result.DataValues);
+        if ( result.Header.TypeId == ExpandedObjectId::HistoryModifiedData )
+        {
+          SerializeContainer(*this, result.ModificationInfos);
+        }
+      }
+      else if ( result.Header.TypeId != NodeId(0, 0) )
+      {
+        throw std::runtime_error("History data type not supported in serialization");
+      }
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<HistoryReadResult>(HistoryReadResult& result)
+    {
+      *this >> result.Status;
+      *this >> result.ContinuationPoint;
+      *this >> result.Header;
+      if ( result.Header.TypeId == ExpandedObjectId::HistoryData || result.Header.TypeId == ExpandedObjectId::HistoryModifiedData )
+      {
+        int32_t size;
+        *this >> size; //not used yet
+        DeserializeContainer(*this, result.DataValues);
+        if ( result.Header.TypeId == ExpandedObjectId::HistoryModifiedData )
+        {
+          DeserializeContainer(*this, result.ModificationInfos);
+        }
+      }
+      else if ( result.Header.TypeId != NodeId(0, 0) )
+      {
+        throw std::runtime_error("History data type not supported in deserialization");
+      }
+    }
+
+    ////////////////////////////////////////////////////////
+    // HistoryReadParameters
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<HistoryReadParameters>(const HistoryReadParameters& params)
+    {
+      return RawSize(params.Details) +
+          RawSize(params.Timestamps) +
+          RawSize(params.ReleaseContinuationPoints) +
+          RawSizeContainer(params.NodesToRead);
+    }
+
+    template<>
+    void DataSerializer::Serialize<HistoryReadParameters>(const HistoryReadParameters& params)
+    {
+      *this << params.Details;
+      *this << params.Timestamps;
+      *this << params.ReleaseContinuationPoints;
+      SerializeContainer(*this, params.NodesToRead);
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<HistoryReadParameters>(HistoryReadParameters& params)
+    {
+      *this >> params.Details;
+      *this >> params.Timestamps;
+      *this >> params.ReleaseContinuationPoints;
+      DeserializeContainer(*this, params.NodesToRead);
+    }
+
+    ////////////////////////////////////////////////////////
+    // HistoryReadRequest
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<HistoryReadRequest>(const HistoryReadRequest& request)
+    {
+      return RawSize(request.TypeId) + RawSize(request.Header) + RawSize(request.Parameters);
+    }
+
+    template<>
+    void DataSerializer::Serialize<HistoryReadRequest>(const HistoryReadRequest& request)
+    {
+      *this << request.TypeId;
+      *this << request.Header;
+      *this << request.Parameters;
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<HistoryReadRequest>(HistoryReadRequest& request)
+    {
+      *this >> request.TypeId;
+      *this >> request.Header;
+      *this >> request.Parameters;
+    }
+
+    ////////////////////////////////////////////////////////
+    // HistoryReadResponse
+    ////////////////////////////////////////////////////////
+
+    template<>
+    std::size_t RawSize<HistoryReadResponse>(const HistoryReadResponse& response)
+    {
+      return RawSize(response.TypeId) + RawSize(response.Header) +
+          RawSizeContainer(response.Results) +
+          RawSizeContainer(response.Diagnostics);
+    }
+
+    template<>
+    void DataSerializer::Serialize<HistoryReadResponse>(const HistoryReadResponse& response)
+    {
+      *this << response.TypeId;
+      *this << response.Header;
+      SerializeContainer(*this, response.Results, 0);
+      SerializeContainer(*this, response.Diagnostics, 0);
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<HistoryReadResponse>(HistoryReadResponse& response)
+    {
+      *this >> response.TypeId;
+      *this >> response.Header;
+      DeserializeContainer(*this, response.Results);
+      DeserializeContainer(*this, response.Diagnostics);
+    }
+
+  } // namespace Binary
+} // namespace OpcUa
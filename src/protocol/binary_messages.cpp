@@ -142,10 +142,25 @@ namespace OpcUa
   DateTime DateTime::Current()
   {
     using namespace std::chrono;
-    const auto t = time_point<high_resolution_clock>(high_resolution_clock::now());
-    const auto us = duration_cast<microseconds>(t.time_since_epoch());
-    const auto n = us.count();
-    return DateTime::FromTimeT(n / 1000000, n % 1000000);
+    const int64_t daysBetween1601And1970 = 134774;
+    const int64_t ticksFrom1601To1970 = daysBetween1601And1970 * 24 * 3600LL * 10000000LL;
+    typedef duration<int64_t, std::ratio<1, 10000000>> Ticks;
+    const Ticks ticks = duration_cast<Ticks>(system_clock::now().time_since_epoch());
+    return DateTime(ticksFrom1601To1970 + ticks.count());
+  }
+
+  DateTime DateTime::CurrentCoarse()
+  {
+#ifdef CLOCK_REALTIME_COARSE
+    const int64_t daysBetween1601And1970 = 134774;
+    const int64_t ticksFrom1601To1970 = daysBetween1601And1970 * 24 * 3600LL * 10000000LL;
+    timespec ts;
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0)
+    {
+      return DateTime(ticksFrom1601To1970 + ts.tv_sec * 10000000LL + ts.tv_nsec / 100);
+    }
+#endif
+    return Current();
   }
 
   time_t DateTime::ToTimeT(DateTime dateTime)
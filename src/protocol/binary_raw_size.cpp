@@ -11,6 +11,7 @@
 #include <opc/ua/protocol/binary/stream.h>
 #include <opc/ua/protocol/secure_channel.h>
 #include <opc/ua/protocol/types.h>
+#include <opc/ua/protocol/variable_access_level.h>
 
 #include <algorithm>
 #include <stdexcept>
@@ -98,6 +99,12 @@ namespace OpcUa
       return 4;
     }
 
+    template<>
+    std::size_t RawSize<VariableAccessLevel>(const VariableAccessLevel&)
+    {
+      return 1;
+    }
+
     template<>
     std::size_t RawSize<std::string>(const std::string& str)
     {
@@ -11,8 +11,13 @@
 #ifndef __OPC_UA_BINARY_SERIALIZATION_TOOLS_H__
 #define __OPC_UA_BINARY_SERIALIZATION_TOOLS_H__
 
+#include <opc/ua/protocol/datetime.h>
+
 #include <algorithm>
+#include <cstring>
 #include <stdint.h>
+#include <type_traits>
+#include <vector>
 
 
 namespace OpcUa
@@ -31,6 +36,21 @@ namespace OpcUa
     }
   }
 
+  // Elements reserved at once while decoding, more are added one by one,
+  // so a broken size cannot make a large allocation.
+  const uint32_t MaxReservedElements = 4096;
+
+  template<class Container>
+  inline void ReserveElements(Container&, uint32_t)
+  {
+  }
+
+  template<class T>
+  inline void ReserveElements(std::vector<T>& c, uint32_t size)
+  {
+    c.reserve(std::min(size, MaxReservedElements));
+  }
+
   template<class Stream, class Container>
   inline void DeserializeContainer(Stream& in, Container& c)
   {
@@ -43,13 +63,247 @@ namespace OpcUa
       return;
     }
 
+    ReserveElements(c, size);
     for (uint32_t i = 0; i < size; ++i)
     {
       typename Container::value_type val;
       in.Deserialize(val);
-      c.push_back(val);
+      c.push_back(std::move(val));
+    }
+  }
+
+  // Fixed size values are stored into a block of memory which is written
+  // or read with one call instead of byte by byte. Layout is the same as
+  // the one of DataSerializer: little endian integers and raw floats.
+
+  template <typename T>
+  inline typename std::enable_if<std::is_integral<T>::value>::type StoreFixed(char* out, T value)
+  {
+    typedef typename std::make_unsigned<T>::type UnsignedType;
+    const UnsignedType tmp = static_cast<UnsignedType>(value);
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+      out[i] = static_cast<char>((tmp >> (8 * i)) & 0xFF);
+    }
+  }
+
+  template <typename T>
+  inline typename std::enable_if<std::is_integral<T>::value>::type LoadFixed(const char* in, T& value)
+  {
+    typedef typename std::make_unsigned<T>::type UnsignedType;
+    UnsignedType tmp = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+      tmp |= static_cast<UnsignedType>(static_cast<uint8_t>(in[i])) << (8 * i);
+    }
+    value = static_cast<T>(tmp);
+  }
+
+  inline void StoreFixed(char* out, bool value)
+  {
+    out[0] = value ? 1 : 0;
+  }
+
+  inline void LoadFixed(const char* in, bool& value)
+  {
+    value = in[0] != 0;
+  }
+
+  template <typename T>
+  inline typename std::enable_if<std::is_enum<T>::value>::type StoreFixed(char* out, T value)
+  {
+    StoreFixed(out, static_cast<typename std::underlying_type<T>::type>(value));
+  }
+
+  template <typename T>
+  inline typename std::enable_if<std::is_enum<T>::value>::type LoadFixed(const char* in, T& value)
+  {
+    typename std::underlying_type<T>::type tmp = 0;
+    LoadFixed(in, tmp);
+    value = static_cast<T>(tmp);
+  }
+
+  template <typename T>
+  inline typename std::enable_if<std::is_floating_point<T>::value>::type StoreFixed(char* out, T value)
+  {
+    std::memcpy(out, &value, sizeof(T));
+  }
+
+  template <typename T>
+  inline typename std::enable_if<std::is_floating_point<T>::value>::type LoadFixed(const char* in, T& value)
+  {
+    std::memcpy(&value, in, sizeof(T));
+  }
+
+  inline void StoreFixed(char* out, const DateTime& value)
+  {
+    StoreFixed(out, value.Value);
+  }
+
+  inline void LoadFixed(const char* in, DateTime& value)
+  {
+    LoadFixed(in, value.Value);
+  }
+
+  /// @brief Encoding of a value with the same size on the wire whatever its content.
+  /// Structures built only from such values get specializations from the generator.
+  template <typename T>
+  struct FixedCodec
+  {
+    static const std::size_t Size = sizeof(T);
+
+    static void Store(char* out, const T& value)
+    {
+      StoreFixed(out, value);
+    }
+
+    static void Load(const char* in, T& value)
+    {
+      LoadFixed(in, value);
+    }
+  };
+
+  /// @brief Types encoded by the FixedCodec primary template.
+  template <typename T>
+  struct IsFixedSize : std::integral_constant<bool,
+    std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_same<T, DateTime>::value>
+  {
+  };
+
+  const std::size_t FixedContainerBlockSize = 1024;
+  // Arrays decoded with bulk copies grow by this many bytes at most at once.
+  const std::size_t FixedContainerReserveLimit = 16 * 1024 * 1024;
+
+#if defined(_WIN32) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+  const bool IsLittleEndianHost = true;
+#else
+  const bool IsLittleEndianHost = false;
+#endif
+
+  /// @brief Values stored in memory exactly as they are encoded, so arrays of them
+  /// are copied as a whole. bool is not one of them, std::vector<bool> is packed.
+  template <typename T>
+  struct IsRawEncoded : std::integral_constant<bool, IsLittleEndianHost &&
+    ((std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+     std::is_enum<T>::value ||
+     std::is_floating_point<T>::value ||
+     std::is_same<T, DateTime>::value)>
+  {
+  };
+
+  template <typename Container>
+  struct IsRawEncodedContainer : std::false_type
+  {
+  };
+
+  template <typename T>
+  struct IsRawEncodedContainer<std::vector<T>> : IsRawEncoded<T>
+  {
+  };
+
+  namespace Details
+  {
+    template<class Stream, class Container>
+    inline void WriteFixedElements(Stream& out, const Container& c, std::false_type)
+    {
+      typedef FixedCodec<typename Container::value_type> Codec;
+      static_assert(Codec::Size <= FixedContainerBlockSize, "Element is too big for bulk encoding.");
+
+      char block[FixedContainerBlockSize];
+      std::size_t offset = 0;
+      for (auto it = c.begin(); it != c.end(); ++it)
+      {
+        if (offset + Codec::Size > sizeof(block))
+        {
+          out.Write(block, offset);
+          offset = 0;
+        }
+        Codec::Store(block + offset, *it);
+        offset += Codec::Size;
+      }
+      out.Write(block, offset);
+    }
+
+    template<class Stream, class T>
+    inline void WriteFixedElements(Stream& out, const std::vector<T>& c, std::true_type)
+    {
+      static_assert(sizeof(T) == FixedCodec<T>::Size, "Element has padding.");
+      out.Write(reinterpret_cast<const char*>(c.data()), c.size() * sizeof(T));
+    }
+
+    // Elements are read block by block, so a broken size fails on missing data
+    // before a large amount of memory is allocated for it.
+    template<class Stream, class Container>
+    inline void ReadFixedElements(Stream& in, Container& c, uint32_t size, std::false_type)
+    {
+      typedef typename Container::value_type ValueType;
+      typedef FixedCodec<ValueType> Codec;
+      static_assert(Codec::Size <= FixedContainerBlockSize, "Element is too big for bulk decoding.");
+
+      char block[FixedContainerBlockSize];
+      const std::size_t perBlock = sizeof(block) / Codec::Size;
+      for (uint32_t done = 0; done < size;)
+      {
+        const std::size_t count = std::min<std::size_t>(perBlock, size - done);
+        in.Read(block, count * Codec::Size);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          ValueType val;
+          Codec::Load(block + i * Codec::Size, val);
+          c.push_back(val);
+        }
+        done += count;
+      }
+    }
+
+    template<class Stream, class T>
+    inline void ReadFixedElements(Stream& in, std::vector<T>& c, uint32_t size, std::true_type)
+    {
+      const std::size_t perRead = FixedContainerReserveLimit / sizeof(T);
+      c.reserve(std::min<std::size_t>(size, perRead));
+      for (uint32_t done = 0; done < size;)
+      {
+        const std::size_t count = std::min<std::size_t>(perRead, size - done);
+        c.resize(done + count);
+        in.Read(reinterpret_cast<char*>(&c[done]), count * sizeof(T));
+        done += count;
+      }
     }
   }
+
+  template<class Container>
+  inline std::size_t RawSizeFixedContainer(const Container& c)
+  {
+    return sizeof(uint32_t) + c.size() * FixedCodec<typename Container::value_type>::Size;
+  }
+
+  template<class Stream, class Container>
+  inline void SerializeFixedContainer(Stream& out, const Container& c)
+  {
+    if (c.empty())
+    {
+      out.Serialize(~uint32_t());
+      return;
+    }
+
+    out.Serialize(static_cast<uint32_t>(c.size()));
+    Details::WriteFixedElements(out, c, IsRawEncodedContainer<Container>());
+  }
+
+  template<class Stream, class Container>
+  inline void DeserializeFixedContainer(Stream& in, Container& c)
+  {
+    uint32_t size = 0;
+    in.Deserialize(size);
+
+    c.clear();
+    if (!size || size == ~uint32_t())
+    {
+      return;
+    }
+
+    Details::ReadFixedElements(in, c, size, IsRawEncodedContainer<Container>());
+  }
 }
 
 #endif // __OPC_UA_BINARY_SERIALIZATION_TOOLS_H__
@@ -13,6 +13,7 @@
 #include <opc/ua/protocol/endpoints.h>
 #include <opc/ua/protocol/secure_channel.h>
 #include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/variable_access_level.h>
 
 #include <algorithm>
 #include <iostream>
@@ -218,7 +219,12 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<std::vector<int8_t>>(const std::vector<int8_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
+    }
+
+    void DataDeserializer::Read(char* data, std::size_t size)
+    {
+      GetData(In, data, size);
     }
 
     template<>
@@ -246,7 +252,7 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<std::vector<int8_t>>(std::vector<int8_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
 
@@ -349,7 +355,7 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<std::vector<bool>>(const std::vector<bool>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
@@ -363,7 +369,7 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<std::vector<bool>>(std::vector<bool>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
 
@@ -484,13 +490,13 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<std::vector<OpcUa::DateTime>>(const std::vector<OpcUa::DateTime>& date)
     {
-      SerializeContainer(*this, date);
+      SerializeFixedContainer(*this, date);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<OpcUa::DateTime>>(std::vector<OpcUa::DateTime>& date)
     {
-      DeserializeContainer(*this, date);
+      DeserializeFixedContainer(*this, date);
     }
 
     template<>
@@ -538,111 +544,111 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<std::vector<uint8_t>>(const std::vector<uint8_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<uint8_t>>(std::vector<uint8_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
     template<>
     void DataSerializer::Serialize<std::vector<uint16_t>>(const std::vector<uint16_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<uint16_t>>(std::vector<uint16_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
     template<>
     void DataSerializer::Serialize<std::vector<int16_t>>(const std::vector<int16_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<int16_t>>(std::vector<int16_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
 
     template<>
     void DataSerializer::Serialize<std::vector<uint32_t>>(const std::vector<uint32_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<uint32_t>>(std::vector<uint32_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
     template<>
     void DataSerializer::Serialize<std::vector<int32_t>>(const std::vector<int32_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<int32_t>>(std::vector<int32_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
     template<>
     void DataSerializer::Serialize<std::vector<int64_t>>(const std::vector<int64_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<int64_t>>(std::vector<int64_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
     template<>
     void DataSerializer::Serialize<std::vector<uint64_t>>(const std::vector<uint64_t>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<uint64_t>>(std::vector<uint64_t>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
 
     template<>
     void DataSerializer::Serialize<std::vector<float>>(const std::vector<float>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<double>>(std::vector<double>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
     template<>
     void DataSerializer::Serialize<std::vector<double>>(const std::vector<double>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<float>>(std::vector<float>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
     }
 
 
@@ -1320,13 +1326,31 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<std::vector<StatusCode>>(const std::vector<StatusCode>& value)
     {
-      SerializeContainer(*this, value);
+      SerializeFixedContainer(*this, value);
     }
 
     template<>
     void DataDeserializer::Deserialize<std::vector<StatusCode>>(std::vector<StatusCode>& value)
     {
-      DeserializeContainer(*this, value);
+      DeserializeFixedContainer(*this, value);
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    // VariableAccessLevel
+    ////////////////////////////////////////////////////////////////////
+
+    template<>
+    void DataSerializer::Serialize<VariableAccessLevel>(const VariableAccessLevel& level)
+    {
+      *this << static_cast<uint8_t>(level);
+    }
+
+    template<>
+    void DataDeserializer::Deserialize<VariableAccessLevel>(VariableAccessLevel& level)
+    {
+      uint8_t value = 0;
+      *this >> value;
+      level = static_cast<VariableAccessLevel>(value);
     }
 
     template<>
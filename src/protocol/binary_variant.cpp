@@ -113,6 +113,45 @@ namespace
     value.push_back(tmp);
   }
 
+  // Arrays of numbers are encoded and decoded with bulk copies,
+  // other arrays element by element.
+
+  template <typename T>
+  std::size_t RawSizeArray(const T& val, std::true_type)
+  {
+    return RawSizeFixedContainer(val);
+  }
+
+  template <typename T>
+  std::size_t RawSizeArray(const T& val, std::false_type)
+  {
+    return RawSizeContainer(val);
+  }
+
+  template <typename T>
+  void SerializeArray(DataSerializer& out, const T& val, std::true_type)
+  {
+    SerializeFixedContainer(out, val);
+  }
+
+  template <typename T>
+  void SerializeArray(DataSerializer& out, const T& val, std::false_type)
+  {
+    SerializeContainer(out, val);
+  }
+
+  template <typename T>
+  void DeserializeArray(DataDeserializer& in, T& val, std::true_type)
+  {
+    DeserializeFixedContainer(in, val);
+  }
+
+  template <typename T>
+  void DeserializeArray(DataDeserializer& in, T& val, std::false_type)
+  {
+    DeserializeContainer(in, val);
+  }
+
   struct RawSizeVisitor
   {
     size_t Result = 0;
@@ -120,7 +159,7 @@ namespace
     template <typename T>
     void OnContainer(const T& val)
     {
-      Result = RawSizeContainer(val);
+      Result = RawSizeArray(val, IsFixedSize<typename T::value_type>());
     }
 
     template <typename T>
@@ -142,7 +181,7 @@ namespace
     template <typename T>
     void OnContainer(const T& val)
     {
-      SerializeContainer(*Serializer, val);
+      SerializeArray(*Serializer, val, IsFixedSize<typename T::value_type>());
     }
 
     template <typename T>
@@ -166,7 +205,7 @@ namespace
     typename std::enable_if<is_container_not_string<T>::value == true, T>::type get()
     {
       T tmp;
-      DeserializeContainer(*Deserializer, tmp);
+      DeserializeArray(*Deserializer, tmp, IsFixedSize<typename T::value_type>());
       return tmp;
     }
 
@@ -680,7 +719,7 @@ namespace OpcUa
       size += rawSizeCalc.Result;
       if (!var.Dimensions.empty())
       {
-        size += RawSizeContainer(var.Dimensions);
+        size += RawSizeFixedContainer(var.Dimensions);
       }
 
       return size;
@@ -710,7 +749,7 @@ namespace OpcUa
 
       if (!var.Dimensions.empty())
       {
-        SerializeContainer(*this, var.Dimensions);
+        SerializeFixedContainer(*this, var.Dimensions);
       }
     }
 
@@ -826,7 +865,7 @@ namespace OpcUa
 
       if (encoding & HAS_DIMENSIONS_MASK)
       {
-        DeserializeContainer(*this, var.Dimensions);
+        DeserializeFixedContainer(*this, var.Dimensions);
       }
     }
 
@@ -24,13 +24,10 @@ namespace OpcUa
 /*  DISABLED
 */
 
-/*  DISABLED
-
      ServiceFault::ServiceFault()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::ServiceFault_Encoding_DefaultBinary))
     {
     }
-*/
 
 /*  DISABLED
 
@@ -58,21 +55,15 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-
      RegisterServerRequest::RegisterServerRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::RegisterServerRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      RegisterServerResponse::RegisterServerResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::RegisterServerResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
 /*  DISABLED
 */
@@ -101,13 +92,10 @@ namespace OpcUa
     }
 */
 
-/*  DISABLED
-
      CloseSecureChannelResponse::CloseSecureChannelResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::CloseSecureChannelResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
      CreateSessionRequest::CreateSessionRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::CreateSessionRequest_Encoding_DefaultBinary))
@@ -119,9 +107,6 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-*/
-
      ActivateSessionRequest::ActivateSessionRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::ActivateSessionRequest_Encoding_DefaultBinary))
     {
@@ -148,21 +133,15 @@ namespace OpcUa
     }
 */
 
-/*  DISABLED
-
      CancelRequest::CancelRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::CancelRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      CancelResponse::CancelResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::CancelResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
 /*  DISABLED
 
@@ -206,21 +185,15 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-
      DeleteReferencesRequest::DeleteReferencesRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::DeleteReferencesRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      DeleteReferencesResponse::DeleteReferencesResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::DeleteReferencesResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
 /*  DISABLED
 */
@@ -319,29 +292,20 @@ namespace OpcUa
     }
 */
 
-/*  DISABLED
-
      QueryFirstResponse::QueryFirstResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::QueryFirstResponse_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      QueryNextRequest::QueryNextRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::QueryNextRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      QueryNextResponse::QueryNextResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::QueryNextResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
      ReadRequest::ReadRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::ReadRequest_Encoding_DefaultBinary))
@@ -379,21 +343,15 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-
      HistoryUpdateRequest::HistoryUpdateRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::HistoryUpdateRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      HistoryUpdateResponse::HistoryUpdateResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::HistoryUpdateResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
      CallRequest::CallRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::CallRequest_Encoding_DefaultBinary))
@@ -415,53 +373,35 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-
      ModifyMonitoredItemsRequest::ModifyMonitoredItemsRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::ModifyMonitoredItemsRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      ModifyMonitoredItemsResponse::ModifyMonitoredItemsResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::ModifyMonitoredItemsResponse_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      SetMonitoringModeRequest::SetMonitoringModeRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::SetMonitoringModeRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      SetMonitoringModeResponse::SetMonitoringModeResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::SetMonitoringModeResponse_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      SetTriggeringRequest::SetTriggeringRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::SetTriggeringRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      SetTriggeringResponse::SetTriggeringResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::SetTriggeringResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
      DeleteMonitoredItemsRequest::DeleteMonitoredItemsRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::DeleteMonitoredItemsRequest_Encoding_DefaultBinary))
@@ -483,21 +423,15 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-
      ModifySubscriptionRequest::ModifySubscriptionRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::ModifySubscriptionRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      ModifySubscriptionResponse::ModifySubscriptionResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::ModifySubscriptionResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
      SetPublishingModeRequest::SetPublishingModeRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::SetPublishingModeRequest_Encoding_DefaultBinary))
@@ -529,21 +463,15 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-
      TransferSubscriptionsRequest::TransferSubscriptionsRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::TransferSubscriptionsRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      TransferSubscriptionsResponse::TransferSubscriptionsResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::TransferSubscriptionsResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
      DeleteSubscriptionsRequest::DeleteSubscriptionsRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::DeleteSubscriptionsRequest_Encoding_DefaultBinary))
@@ -555,37 +483,25 @@ namespace OpcUa
     {
     }
 
-/*  DISABLED
-
      TestStackRequest::TestStackRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::TestStackRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      TestStackResponse::TestStackResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::TestStackResponse_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      TestStackExRequest::TestStackExRequest()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::TestStackExRequest_Encoding_DefaultBinary))
     {
     }
-*/
-
-/*  DISABLED
 
      TestStackExResponse::TestStackExResponse()
         : TypeId(FourByteNodeId((uint16_t)ObjectId::TestStackExResponse_Encoding_DefaultBinary))
     {
     }
-*/
 
 } // namespace
     
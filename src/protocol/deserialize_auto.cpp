@@ -17,6 +17,8 @@
 
 #include <opc/ua/protocol/binary/stream.h>
 
+#include "fixed_size_auto.h"
+
 namespace OpcUa
 {
     namespace Binary
@@ -242,7 +244,7 @@ namespace OpcUa
     void DataDeserializer::Deserialize<XmlElement>(XmlElement& data)
     {
         *this >> data.Length;
-        DeserializeContainer(*this, data.Value);
+        DeserializeFixedContainer(*this, data.Value);
     }
 
 
@@ -261,8 +263,10 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<FourByteNodeId>(FourByteNodeId& data)
     {
-        *this >> data.NamespaceIndex;
-        *this >> data.Identifier;
+        char block1[3];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.NamespaceIndex);
+        FixedCodec<uint16_t>::Load(block1 + 1, data.Identifier);
     }
 
 */
@@ -272,8 +276,10 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<NumericNodeId>(NumericNodeId& data)
     {
-        *this >> data.NamespaceIndex;
-        *this >> data.Identifier;
+        char block1[6];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint16_t>::Load(block1 + 0, data.NamespaceIndex);
+        FixedCodec<uint32_t>::Load(block1 + 2, data.Identifier);
     }
 
 */
@@ -317,12 +323,12 @@ namespace OpcUa
     void DataDeserializer::Deserialize<NodeId>(NodeId& data)
     {
         *this >> data.NodeIdType;
-        if ((data.NodeIdType) & (1>>(0))) *this >> data.TwoByte;
-        if ((data.NodeIdType) & (1>>(1))) *this >> data.FourByte;
-        if ((data.NodeIdType) & (1>>(2))) *this >> data.Numeric;
-        if ((data.NodeIdType) & (1>>(3))) *this >> data.String;
-        if ((data.NodeIdType) & (1>>(4))) *this >> data.Guid;
-        if ((data.NodeIdType) & (1>>(5))) *this >> data.ByteString;
+        if ((data.NodeIdType) & (1<<(0))) *this >> data.TwoByte;
+        if ((data.NodeIdType) & (1<<(1))) *this >> data.FourByte;
+        if ((data.NodeIdType) & (1<<(2))) *this >> data.Numeric;
+        if ((data.NodeIdType) & (1<<(3))) *this >> data.String;
+        if ((data.NodeIdType) & (1<<(4))) *this >> data.Guid;
+        if ((data.NodeIdType) & (1<<(5))) *this >> data.ByteString;
     }
 
 */
@@ -332,7 +338,7 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Body;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Body;
     }
 
 
@@ -342,14 +348,14 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ExpandedNodeId>(ExpandedNodeId& data)
     {
         *this >> data.NodeIdType;
-        if ((data.NodeIdType) & (1>>(0))) *this >> data.TwoByte;
-        if ((data.NodeIdType) & (1>>(1))) *this >> data.FourByte;
-        if ((data.NodeIdType) & (1>>(2))) *this >> data.Numeric;
-        if ((data.NodeIdType) & (1>>(3))) *this >> data.String;
-        if ((data.NodeIdType) & (1>>(4))) *this >> data.Guid;
-        if ((data.NodeIdType) & (1>>(5))) *this >> data.ByteString;
-        if ((data.NodeIdType) & (1>>(7))) *this >> data.NamespaceURI;
-        if ((data.NodeIdType) & (1>>(6))) *this >> data.ServerIndex;
+        if ((data.NodeIdType) & (1<<(0))) *this >> data.TwoByte;
+        if ((data.NodeIdType) & (1<<(1))) *this >> data.FourByte;
+        if ((data.NodeIdType) & (1<<(2))) *this >> data.Numeric;
+        if ((data.NodeIdType) & (1<<(3))) *this >> data.String;
+        if ((data.NodeIdType) & (1<<(4))) *this >> data.Guid;
+        if ((data.NodeIdType) & (1<<(5))) *this >> data.ByteString;
+        if ((data.NodeIdType) & (1<<(7))) *this >> data.NamespaceURI;
+        if ((data.NodeIdType) & (1<<(6))) *this >> data.ServerIndex;
     }
 
 */
@@ -360,12 +366,12 @@ namespace OpcUa
     void DataDeserializer::Deserialize<DiagnosticInfo>(DiagnosticInfo& data)
     {
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.SymbolicId;
-        if ((data.Encoding) & (1>>(1))) *this >> data.NamespaceURI;
-        if ((data.Encoding) & (1>>(2))) *this >> data.LocalizedText;
-        if ((data.Encoding) & (1>>(4))) *this >> data.AdditionalInfo;
-        if ((data.Encoding) & (1>>(5))) *this >> data.InnerStatusCode;
-        if ((data.Encoding) & (1>>(6))) *this >> data.InnerDiagnosticInfo;
+        if ((data.Encoding) & (1<<(0))) *this >> data.SymbolicId;
+        if ((data.Encoding) & (1<<(1))) *this >> data.NamespaceURI;
+        if ((data.Encoding) & (1<<(2))) *this >> data.LocalizedText;
+        if ((data.Encoding) & (1<<(4))) *this >> data.AdditionalInfo;
+        if ((data.Encoding) & (1<<(5))) *this >> data.InnerStatusCode;
+        if ((data.Encoding) & (1<<(6))) *this >> data.InnerDiagnosticInfo;
     }
 
 */
@@ -387,8 +393,8 @@ namespace OpcUa
     void DataDeserializer::Deserialize<LocalizedText>(LocalizedText& data)
     {
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Locale;
-        if ((data.Encoding) & (1>>(1))) *this >> data.Text;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Locale;
+        if ((data.Encoding) & (1<<(1))) *this >> data.Text;
     }
 
 */
@@ -399,32 +405,32 @@ namespace OpcUa
     void DataDeserializer::Deserialize<Variant>(Variant& data)
     {
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(7))) *this >> data.ArrayLength;
-        if ((data.VariantType) & (1>>(1))) DeserializeContainer(*this, data.Boolean);
-        if ((data.VariantType) & (1>>(2))) DeserializeContainer(*this, data.SByte);
-        if ((data.VariantType) & (1>>(3))) DeserializeContainer(*this, data.Byte);
-        if ((data.VariantType) & (1>>(4))) DeserializeContainer(*this, data.Int16);
-        if ((data.VariantType) & (1>>(5))) DeserializeContainer(*this, data.UInt16);
-        if ((data.VariantType) & (1>>(6))) DeserializeContainer(*this, data.Int32);
-        if ((data.VariantType) & (1>>(7))) DeserializeContainer(*this, data.UInt32);
-        if ((data.VariantType) & (1>>(8))) DeserializeContainer(*this, data.Int64);
-        if ((data.VariantType) & (1>>(9))) DeserializeContainer(*this, data.UInt64);
-        if ((data.VariantType) & (1>>(10))) DeserializeContainer(*this, data.Float);
-        if ((data.VariantType) & (1>>(11))) DeserializeContainer(*this, data.Double);
-        if ((data.VariantType) & (1>>(12))) DeserializeContainer(*this, data.String);
-        if ((data.VariantType) & (1>>(13))) DeserializeContainer(*this, data.DateTime);
-        if ((data.VariantType) & (1>>(14))) DeserializeContainer(*this, data.Guid);
-        if ((data.VariantType) & (1>>(15))) DeserializeContainer(*this, data.ByteString);
-        if ((data.VariantType) & (1>>(16))) DeserializeContainer(*this, data.XmlElement);
-        if ((data.VariantType) & (1>>(17))) DeserializeContainer(*this, data.NodeId);
-        if ((data.VariantType) & (1>>(18))) DeserializeContainer(*this, data.ExpandedNodeId);
-        if ((data.VariantType) & (1>>(19))) DeserializeContainer(*this, data.Status);
-        if ((data.VariantType) & (1>>(20))) DeserializeContainer(*this, data.DiagnosticInfo);
-        if ((data.VariantType) & (1>>(21))) DeserializeContainer(*this, data.QualifiedName);
-        if ((data.VariantType) & (1>>(22))) DeserializeContainer(*this, data.LocalizedText);
-        if ((data.VariantType) & (1>>(23))) DeserializeContainer(*this, data.ExtensionObject);
-        if ((data.VariantType) & (1>>(24))) DeserializeContainer(*this, data.DataValue);
-        if ((data.VariantType) & (1>>(25))) DeserializeContainer(*this, data.Variant);
+        if ((data.Encoding) & (1<<(7))) *this >> data.ArrayLength;
+        if ((data.VariantType) & (1<<(1))) DeserializeFixedContainer(*this, data.Boolean);
+        if ((data.VariantType) & (1<<(2))) DeserializeFixedContainer(*this, data.SByte);
+        if ((data.VariantType) & (1<<(3))) DeserializeFixedContainer(*this, data.Byte);
+        if ((data.VariantType) & (1<<(4))) DeserializeFixedContainer(*this, data.Int16);
+        if ((data.VariantType) & (1<<(5))) DeserializeFixedContainer(*this, data.UInt16);
+        if ((data.VariantType) & (1<<(6))) DeserializeFixedContainer(*this, data.Int32);
+        if ((data.VariantType) & (1<<(7))) DeserializeFixedContainer(*this, data.UInt32);
+        if ((data.VariantType) & (1<<(8))) DeserializeFixedContainer(*this, data.Int64);
+        if ((data.VariantType) & (1<<(9))) DeserializeFixedContainer(*this, data.UInt64);
+        if ((data.VariantType) & (1<<(10))) DeserializeFixedContainer(*this, data.Float);
+        if ((data.VariantType) & (1<<(11))) DeserializeFixedContainer(*this, data.Double);
+        if ((data.VariantType) & (1<<(12))) DeserializeContainer(*this, data.String);
+        if ((data.VariantType) & (1<<(13))) DeserializeFixedContainer(*this, data.DateTime);
+        if ((data.VariantType) & (1<<(14))) DeserializeContainer(*this, data.Guid);
+        if ((data.VariantType) & (1<<(15))) DeserializeContainer(*this, data.ByteString);
+        if ((data.VariantType) & (1<<(16))) DeserializeContainer(*this, data.XmlElement);
+        if ((data.VariantType) & (1<<(17))) DeserializeContainer(*this, data.NodeId);
+        if ((data.VariantType) & (1<<(18))) DeserializeContainer(*this, data.ExpandedNodeId);
+        if ((data.VariantType) & (1<<(19))) DeserializeFixedContainer(*this, data.Status);
+        if ((data.VariantType) & (1<<(20))) DeserializeContainer(*this, data.DiagnosticInfo);
+        if ((data.VariantType) & (1<<(21))) DeserializeContainer(*this, data.QualifiedName);
+        if ((data.VariantType) & (1<<(22))) DeserializeContainer(*this, data.LocalizedText);
+        if ((data.VariantType) & (1<<(23))) DeserializeContainer(*this, data.ExtensionObject);
+        if ((data.VariantType) & (1<<(24))) DeserializeContainer(*this, data.DataValue);
+        if ((data.VariantType) & (1<<(25))) DeserializeContainer(*this, data.Variant);
     }
 
 */
@@ -435,18 +441,16 @@ namespace OpcUa
     void DataDeserializer::Deserialize<DataValue>(DataValue& data)
     {
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Value;
-        if ((data.Encoding) & (1>>(1))) *this >> data.Status;
-        if ((data.Encoding) & (1>>(2))) *this >> data.SourceTimestamp;
-        if ((data.Encoding) & (1>>(3))) *this >> data.SourcePicoseconds;
-        if ((data.Encoding) & (1>>(4))) *this >> data.ServerTimestamp;
-        if ((data.Encoding) & (1>>(5))) *this >> data.ServerPicoseconds;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Value;
+        if ((data.Encoding) & (1<<(1))) *this >> data.Status;
+        if ((data.Encoding) & (1<<(2))) *this >> data.SourceTimestamp;
+        if ((data.Encoding) & (1<<(3))) *this >> data.SourcePicoseconds;
+        if ((data.Encoding) & (1<<(4))) *this >> data.ServerTimestamp;
+        if ((data.Encoding) & (1<<(5))) *this >> data.ServerPicoseconds;
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<ReferenceNode>(ReferenceNode& data)
     {
@@ -455,7 +459,6 @@ namespace OpcUa
         *this >> data.TargetId;
     }
 
-*/
 
 /*  DISABLED
 
@@ -467,15 +470,15 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<InstanceNode>(InstanceNode& data)
     {
@@ -484,14 +487,13 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TypeNode>(TypeNode& data)
@@ -501,14 +503,13 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ObjectNode>(ObjectNode& data)
@@ -518,15 +519,14 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
         *this >> data.EventNotifier;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ObjectTypeNode>(ObjectTypeNode& data)
@@ -536,15 +536,14 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
         *this >> data.IsAbstract;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<VariableNode>(VariableNode& data)
@@ -554,22 +553,23 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
         *this >> data.Value;
         *this >> data.DataType;
         *this >> data.ValueRank;
-        DeserializeContainer(*this, data.ArrayDimensions);
-        *this >> data.AccessLevel;
-        *this >> data.UserAccessLevel;
-        *this >> data.MinimumSamplingInterval;
-        *this >> data.Historizing;
+        DeserializeFixedContainer(*this, data.ArrayDimensions);
+        char block2[11];
+        Read(block2, sizeof(block2));
+        FixedCodec<OpcUa::VariableAccessLevel>::Load(block2 + 0, data.AccessLevel);
+        FixedCodec<OpcUa::VariableAccessLevel>::Load(block2 + 1, data.UserAccessLevel);
+        FixedCodec<double>::Load(block2 + 2, data.MinimumSamplingInterval);
+        FixedCodec<bool>::Load(block2 + 10, data.Historizing);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<VariableTypeNode>(VariableTypeNode& data)
@@ -579,19 +579,18 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
         *this >> data.Value;
         *this >> data.DataType;
         *this >> data.ValueRank;
-        DeserializeContainer(*this, data.ArrayDimensions);
+        DeserializeFixedContainer(*this, data.ArrayDimensions);
         *this >> data.IsAbstract;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ReferenceTypeNode>(ReferenceTypeNode& data)
@@ -601,17 +600,18 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
-        *this >> data.IsAbstract;
-        *this >> data.Symmetric;
+        char block2[2];
+        Read(block2, sizeof(block2));
+        FixedCodec<bool>::Load(block2 + 0, data.IsAbstract);
+        FixedCodec<bool>::Load(block2 + 1, data.Symmetric);
         *this >> data.InverseName;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<MethodNode>(MethodNode& data)
@@ -621,16 +621,17 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
-        *this >> data.Executable;
-        *this >> data.UserExecutable;
+        char block2[2];
+        Read(block2, sizeof(block2));
+        FixedCodec<bool>::Load(block2 + 0, data.Executable);
+        FixedCodec<bool>::Load(block2 + 1, data.UserExecutable);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ViewNode>(ViewNode& data)
@@ -640,16 +641,17 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
-        *this >> data.ContainsNoLoops;
-        *this >> data.EventNotifier;
+        char block2[2];
+        Read(block2, sizeof(block2));
+        FixedCodec<bool>::Load(block2 + 0, data.ContainsNoLoops);
+        FixedCodec<uint8_t>::Load(block2 + 1, data.EventNotifier);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DataTypeNode>(DataTypeNode& data)
@@ -659,15 +661,14 @@ namespace OpcUa
         *this >> data.BrowseName;
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.UserWriteMask);
         DeserializeContainer(*this, data.References);
         *this >> data.IsAbstract;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<Argument>(Argument& data)
@@ -675,13 +676,10 @@ namespace OpcUa
         *this >> data.Name;
         *this >> data.DataType;
         *this >> data.ValueRank;
-        DeserializeContainer(*this, data.ArrayDimensions);
+        DeserializeFixedContainer(*this, data.ArrayDimensions);
         *this >> data.Description;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<EnumValueType>(EnumValueType& data)
@@ -691,18 +689,15 @@ namespace OpcUa
         *this >> data.Description;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TimeZoneDataType>(TimeZoneDataType& data)
     {
-        *this >> data.Offset;
-        *this >> data.DaylightSavingInOffset;
+        char block[FixedCodec<TimeZoneDataType>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<TimeZoneDataType>::Load(block, data);
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<ApplicationDescription>(ApplicationDescription& data)
@@ -723,9 +718,11 @@ namespace OpcUa
     void DataDeserializer::Deserialize<RequestHeader>(RequestHeader& data)
     {
         *this >> data.AuthenticationToken;
-        *this >> data.Timestamp;
-        *this >> data.RequestHandle;
-        *this >> data.ReturnDiagnostics;
+        char block1[16];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 0, data.Timestamp);
+        FixedCodec<uint32_t>::Load(block1 + 8, data.RequestHandle);
+        FixedCodec<uint32_t>::Load(block1 + 12, data.ReturnDiagnostics);
         *this >> data.AuditEntryId;
         *this >> data.TimeoutHint;
         *this >> data.AdditionalHeader;
@@ -738,9 +735,11 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<ResponseHeader>(ResponseHeader& data)
     {
-        *this >> data.Timestamp;
-        *this >> data.RequestHandle;
-        *this >> data.ServiceResult;
+        char block1[16];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 0, data.Timestamp);
+        FixedCodec<uint32_t>::Load(block1 + 8, data.RequestHandle);
+        FixedCodec<OpcUa::StatusCode>::Load(block1 + 12, data.ServiceResult);
         *this >> data.ServiceDiagnostics;
         DeserializeContainer(*this, data.StringTable);
         *this >> data.AdditionalHeader;
@@ -748,8 +747,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<ServiceFault>(ServiceFault& data)
     {
@@ -757,7 +754,6 @@ namespace OpcUa
         *this >> data.Header;
     }
 
-*/
 
 /*  DISABLED
 
@@ -783,15 +779,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<FindServersResult>(FindServersResult& data)
     {
         DeserializeContainer(*this, data.Servers);
     }
 
-*/
 
 /*  DISABLED
 
@@ -857,8 +850,6 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<RegisteredServer>(RegisteredServer& data)
     {
@@ -872,9 +863,6 @@ namespace OpcUa
         *this >> data.IsOnline;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<RegisterServerParameters>(RegisterServerParameters& data)
@@ -882,9 +870,6 @@ namespace OpcUa
         *this >> data.Server;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<RegisterServerRequest>(RegisterServerRequest& data)
@@ -894,9 +879,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<RegisterServerResponse>(RegisterServerResponse& data)
@@ -905,29 +887,26 @@ namespace OpcUa
         *this >> data.Header;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ChannelSecurityToken>(ChannelSecurityToken& data)
     {
-        *this >> data.ChannelId;
-        *this >> data.TokenId;
-        *this >> data.CreatedAt;
-        *this >> data.RevisedLifetime;
+        char block[FixedCodec<ChannelSecurityToken>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<ChannelSecurityToken>::Load(block, data);
     }
 
-*/
 
 /*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<OpenSecureChannelParameters>(OpenSecureChannelParameters& data)
     {
-        *this >> data.ClientProtocolVersion;
-        *this >> data.RequestType;
-        *this >> data.SecurityMode;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.ClientProtocolVersion);
+        FixedCodec<OpcUa::SecurityTokenRequestType>::Load(block1 + 4, data.RequestType);
+        FixedCodec<OpcUa::MessageSecurityMode>::Load(block1 + 8, data.SecurityMode);
         *this >> data.ClientNonce;
         *this >> data.RequestedLifetime;
     }
@@ -946,17 +925,16 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<OpenSecureChannelResult>(OpenSecureChannelResult& data)
     {
-        *this >> data.ServerProtocolVersion;
-        *this >> data.SecurityToken;
+        char block1[24];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.ServerProtocolVersion);
+        FixedCodec<OpcUa::ChannelSecurityToken>::Load(block1 + 4, data.SecurityToken);
         *this >> data.ServerNonce;
     }
 
-*/
 
 /*  DISABLED
 
@@ -981,8 +959,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<CloseSecureChannelResponse>(CloseSecureChannelResponse& data)
     {
@@ -990,7 +966,6 @@ namespace OpcUa
         *this >> data.Header;
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<SignedSoftwareCertificate>(SignedSoftwareCertificate& data)
@@ -1017,8 +992,10 @@ namespace OpcUa
         *this >> data.SessionName;
         *this >> data.ClientNonce;
         *this >> data.ClientCertificate;
-        *this >> data.RequestedSessionTimeout;
-        *this >> data.MaxResponseMessageSize;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<double>::Load(block1 + 0, data.RequestedSessionTimeout);
+        FixedCodec<uint32_t>::Load(block1 + 8, data.MaxResponseMessageSize);
     }
 
 
@@ -1055,76 +1032,71 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<UserIdentityToken>(UserIdentityToken& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.PolicyId;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<AnonymousIdentityToken>(AnonymousIdentityToken& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.PolicyId;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<UserNameIdentityToken>(UserNameIdentityToken& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.PolicyId;
         *this >> data.UserName;
         *this >> data.Password;
         *this >> data.EncryptionAlgorithm;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<X509IdentityToken>(X509IdentityToken& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.PolicyId;
         *this >> data.CertificateData;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<IssuedIdentityToken>(IssuedIdentityToken& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.PolicyId;
         *this >> data.TokenData;
         *this >> data.EncryptionAlgorithm;
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<ActivateSessionParameters>(ActivateSessionParameters& data)
@@ -1150,7 +1122,7 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ActivateSessionResult>(ActivateSessionResult& data)
     {
         *this >> data.ServerNonce;
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -1187,17 +1159,14 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<CancelParameters>(CancelParameters& data)
     {
-        *this >> data.RequestHandle;
+        char block[FixedCodec<CancelParameters>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<CancelParameters>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<CancelRequest>(CancelRequest& data)
@@ -1207,19 +1176,15 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<CancelResult>(CancelResult& data)
     {
-        *this >> data.CancelCount;
+        char block[FixedCodec<CancelResult>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<CancelResult>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<CancelResponse>(CancelResponse& data)
@@ -1229,7 +1194,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
 
 /*  DISABLED
 
@@ -1237,13 +1201,17 @@ namespace OpcUa
     void DataDeserializer::Deserialize<NodeAttributes>(NodeAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block2[8];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
     }
 
 */
@@ -1254,14 +1222,18 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ObjectAttributes>(ObjectAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
-        *this >> data.EventNotifier;
+        char block2[9];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
+        FixedCodec<uint8_t>::Load(block2 + 8, data.EventNotifier);
     }
 
 */
@@ -1272,21 +1244,27 @@ namespace OpcUa
     void DataDeserializer::Deserialize<VariableAttributes>(VariableAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block2[8];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
         *this >> data.Value;
         *this >> data.DataType;
         *this >> data.ValueRank;
-        DeserializeContainer(*this, data.ArrayDimensions);
-        *this >> data.AccessLevel;
-        *this >> data.UserAccessLevel;
-        *this >> data.MinimumSamplingInterval;
-        *this >> data.Historizing;
+        DeserializeFixedContainer(*this, data.ArrayDimensions);
+        char block3[11];
+        Read(block3, sizeof(block3));
+        FixedCodec<OpcUa::VariableAccessLevel>::Load(block3 + 0, data.AccessLevel);
+        FixedCodec<OpcUa::VariableAccessLevel>::Load(block3 + 1, data.UserAccessLevel);
+        FixedCodec<double>::Load(block3 + 2, data.MinimumSamplingInterval);
+        FixedCodec<bool>::Load(block3 + 10, data.Historizing);
     }
 
 */
@@ -1297,15 +1275,19 @@ namespace OpcUa
     void DataDeserializer::Deserialize<MethodAttributes>(MethodAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
-        *this >> data.Executable;
-        *this >> data.UserExecutable;
+        char block2[10];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Load(block2 + 8, data.Executable);
+        FixedCodec<bool>::Load(block2 + 9, data.UserExecutable);
     }
 
 */
@@ -1316,14 +1298,18 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ObjectTypeAttributes>(ObjectTypeAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
-        *this >> data.IsAbstract;
+        char block2[9];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Load(block2 + 8, data.IsAbstract);
     }
 
 */
@@ -1334,17 +1320,21 @@ namespace OpcUa
     void DataDeserializer::Deserialize<VariableTypeAttributes>(VariableTypeAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
+        char block2[8];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
         *this >> data.Value;
         *this >> data.DataType;
         *this >> data.ValueRank;
-        DeserializeContainer(*this, data.ArrayDimensions);
+        DeserializeFixedContainer(*this, data.ArrayDimensions);
         *this >> data.IsAbstract;
     }
 
@@ -1356,15 +1346,19 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ReferenceTypeAttributes>(ReferenceTypeAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
-        *this >> data.IsAbstract;
-        *this >> data.Symmetric;
+        char block2[10];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Load(block2 + 8, data.IsAbstract);
+        FixedCodec<bool>::Load(block2 + 9, data.Symmetric);
         *this >> data.InverseName;
     }
 
@@ -1376,14 +1370,18 @@ namespace OpcUa
     void DataDeserializer::Deserialize<DataTypeAttributes>(DataTypeAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
-        *this >> data.IsAbstract;
+        char block2[9];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Load(block2 + 8, data.IsAbstract);
     }
 
 */
@@ -1394,15 +1392,19 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ViewAttributes>(ViewAttributes& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.SpecifiedAttributes;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.SpecifiedAttributes);
         *this >> data.DisplayName;
         *this >> data.Description;
-        *this >> data.WriteMask;
-        *this >> data.UserWriteMask;
-        *this >> data.ContainsNoLoops;
-        *this >> data.EventNotifier;
+        char block2[10];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Load(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Load(block2 + 8, data.ContainsNoLoops);
+        FixedCodec<uint8_t>::Load(block2 + 9, data.EventNotifier);
     }
 
 */
@@ -1503,7 +1505,7 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Header;
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -1531,13 +1533,11 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Header;
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<DeleteReferencesItem>(DeleteReferencesItem& data)
     {
@@ -1548,9 +1548,6 @@ namespace OpcUa
         *this >> data.DeleteBidirectional;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DeleteReferencesParameters>(DeleteReferencesParameters& data)
@@ -1558,9 +1555,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.ReferencesToDelete);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DeleteReferencesRequest>(DeleteReferencesRequest& data)
@@ -1570,20 +1564,14 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DeleteReferencesResult>(DeleteReferencesResult& data)
     {
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DeleteReferencesResponse>(DeleteReferencesResponse& data)
@@ -1593,7 +1581,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
 
 /*  DISABLED
 
@@ -1601,8 +1588,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ViewDescription>(ViewDescription& data)
     {
         *this >> data.ViewId;
-        *this >> data.Timestamp;
-        *this >> data.ViewVersion;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 0, data.Timestamp);
+        FixedCodec<uint32_t>::Load(block1 + 8, data.ViewVersion);
     }
 
 */
@@ -1615,9 +1604,11 @@ namespace OpcUa
         *this >> data.NodeId;
         *this >> data.BrowseDirection;
         *this >> data.ReferenceTypeId;
-        *this >> data.IncludeSubtypes;
-        *this >> data.NodeClassMask;
-        *this >> data.ResultMask;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<bool>::Load(block1 + 0, data.IncludeSubtypes);
+        FixedCodec<OpcUa::NodeClass>::Load(block1 + 1, data.NodeClassMask);
+        FixedCodec<OpcUa::BrowseResultMask>::Load(block1 + 5, data.ResultMask);
     }
 
 */
@@ -1687,8 +1678,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<BrowseNextParameters>(BrowseNextParameters& data)
     {
@@ -1696,7 +1685,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.ContinuationPoints);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1739,8 +1727,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<RelativePathElement>(RelativePathElement& data)
     {
         *this >> data.ReferenceTypeId;
-        *this >> data.IsInverse;
-        *this >> data.IncludeSubtypes;
+        char block1[2];
+        Read(block1, sizeof(block1));
+        FixedCodec<bool>::Load(block1 + 0, data.IsInverse);
+        FixedCodec<bool>::Load(block1 + 1, data.IncludeSubtypes);
         *this >> data.TargetName;
     }
 
@@ -1824,15 +1814,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<RegisterNodesParameters>(RegisterNodesParameters& data)
     {
         DeserializeContainer(*this, data.NodesToRegister);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1846,15 +1833,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<RegisterNodesResult>(RegisterNodesResult& data)
     {
         DeserializeContainer(*this, data.RegisteredNodeIds);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1868,15 +1852,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<UnregisterNodesParameters>(UnregisterNodesParameters& data)
     {
         DeserializeContainer(*this, data.NodesToUnregister);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1901,25 +1882,14 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<EndpointConfiguration>(EndpointConfiguration& data)
     {
-        *this >> data.OperationTimeout;
-        *this >> data.UseBinaryEncoding;
-        *this >> data.MaxStringLength;
-        *this >> data.MaxByteStringLength;
-        *this >> data.MaxArrayLength;
-        *this >> data.MaxMessageSize;
-        *this >> data.MaxBufferSize;
-        *this >> data.ChannelLifetime;
-        *this >> data.SecurityTokenLifetime;
+        char block[FixedCodec<EndpointConfiguration>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<EndpointConfiguration>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SupportedProfile>(SupportedProfile& data)
@@ -1927,14 +1897,13 @@ namespace OpcUa
         *this >> data.OrganizationUri;
         *this >> data.ProfileId;
         *this >> data.ComplianceTool;
-        *this >> data.ComplianceDate;
-        *this >> data.ComplianceLevel;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 0, data.ComplianceDate);
+        FixedCodec<OpcUa::ComplianceLevel>::Load(block1 + 8, data.ComplianceLevel);
         DeserializeContainer(*this, data.UnsupportedUnitIds);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SoftwareCertificate>(SoftwareCertificate& data)
@@ -1951,9 +1920,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.SupportedProfiles);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<QueryDataDescription>(QueryDataDescription& data)
@@ -1963,9 +1929,6 @@ namespace OpcUa
         *this >> data.IndexRange;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<NodeTypeDescription>(NodeTypeDescription& data)
@@ -1975,9 +1938,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.DataToReturn);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<QueryDataSet>(QueryDataSet& data)
@@ -1987,9 +1947,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.Values);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<NodeReference>(NodeReference& data)
@@ -2000,7 +1957,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.ReferencedNodeIds);
     }
 
-*/
 
 /*  DISABLED
 
@@ -2030,7 +1986,7 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Body;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Body;
     }
 
 */
@@ -2041,9 +1997,11 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ElementOperand>(ElementOperand& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.Index;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.Index);
     }
 
 */
@@ -2054,8 +2012,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<LiteralOperand>(LiteralOperand& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.Value;
     }
 
@@ -2067,8 +2027,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<AttributeOperand>(AttributeOperand& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.NodeId;
         *this >> data.Alias;
         *this >> data.BrowsePath;
@@ -2084,8 +2046,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<SimpleAttributeOperand>(SimpleAttributeOperand& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         *this >> data.TypeDefinitionId;
         DeserializeContainer(*this, data.BrowsePath);
         *this >> data.AttributeId;
@@ -2094,19 +2058,14 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<ContentFilterElementResult>(ContentFilterElementResult& data)
     {
         *this >> data.Status;
-        DeserializeContainer(*this, data.OperandStatusCodes);
+        DeserializeFixedContainer(*this, data.OperandStatusCodes);
         DeserializeContainer(*this, data.OperandDiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ContentFilterResult>(ContentFilterResult& data)
@@ -2115,19 +2074,15 @@ namespace OpcUa
         DeserializeContainer(*this, data.ElementDiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ParsingResult>(ParsingResult& data)
     {
         *this >> data.Status;
-        DeserializeContainer(*this, data.DataStatusCodes);
+        DeserializeFixedContainer(*this, data.DataStatusCodes);
         DeserializeContainer(*this, data.DataDiagnosticInfos);
     }
 
-*/
 
 /*  DISABLED
 
@@ -2137,8 +2092,10 @@ namespace OpcUa
         *this >> data.View;
         DeserializeContainer(*this, data.NodeTypes);
         *this >> data.Filter;
-        *this >> data.MaxDataSetsToReturn;
-        *this >> data.MaxReferencesToReturn;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.MaxDataSetsToReturn);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.MaxReferencesToReturn);
     }
 
 */
@@ -2155,8 +2112,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<QueryFirstResult>(QueryFirstResult& data)
     {
@@ -2167,9 +2122,6 @@ namespace OpcUa
         *this >> data.FilterResult;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<QueryFirstResponse>(QueryFirstResponse& data)
@@ -2179,9 +2131,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<QueryNextParameters>(QueryNextParameters& data)
@@ -2190,9 +2139,6 @@ namespace OpcUa
         *this >> data.ContinuationPoint;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<QueryNextRequest>(QueryNextRequest& data)
@@ -2202,9 +2148,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<QueryNextResult>(QueryNextResult& data)
@@ -2213,9 +2156,6 @@ namespace OpcUa
         *this >> data.RevisedContinuationPoint;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<QueryNextResponse>(QueryNextResponse& data)
@@ -2225,7 +2165,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<ReadValueId>(ReadValueId& data)
@@ -2240,8 +2179,10 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<ReadParameters>(ReadParameters& data)
     {
-        *this >> data.MaxAge;
-        *this >> data.TimestampsToReturn;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<double>::Load(block1 + 0, data.MaxAge);
+        FixedCodec<OpcUa::TimestampsToReturn>::Load(block1 + 8, data.TimestampsToReturn);
         DeserializeContainer(*this, data.AttributesToRead);
     }
 
@@ -2297,7 +2238,7 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Body;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Body;
     }
 
 */
@@ -2308,13 +2249,15 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ReadRawModifiedDetails>(ReadRawModifiedDetails& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.IsReadModified;
-        *this >> data.StartTime;
-        *this >> data.EndTime;
-        *this >> data.NumValuesPerNode;
-        *this >> data.ReturnBounds;
+        char block1[27];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<bool>::Load(block1 + 5, data.IsReadModified);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 6, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 14, data.EndTime);
+        FixedCodec<uint32_t>::Load(block1 + 22, data.NumValuesPerNode);
+        FixedCodec<bool>::Load(block1 + 26, data.ReturnBounds);
     }
 
 */
@@ -2325,31 +2268,32 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ReadAtTimeDetails>(ReadAtTimeDetails& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        DeserializeContainer(*this, data.ReqTimes);
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        DeserializeFixedContainer(*this, data.ReqTimes);
         *this >> data.UseSimpleBounds;
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<HistoryData>(HistoryData& data)
     {
         DeserializeContainer(*this, data.DataValues);
     }
 
-*/
 
 /*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModificationInfo>(ModificationInfo& data)
     {
-        *this >> data.ModificationTime;
-        *this >> data.UpdateType;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 0, data.ModificationTime);
+        FixedCodec<OpcUa::HistoryUpdateType>::Load(block1 + 8, data.UpdateType);
         *this >> data.UserName;
     }
 
@@ -2372,8 +2316,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<HistoryReadParameters>(HistoryReadParameters& data)
     {
         *this >> data.HistoryReadDetails;
-        *this >> data.TimestampsToReturn;
-        *this >> data.ReleaseContinuationPoints;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::TimestampsToReturn>::Load(block1 + 0, data.TimestampsToReturn);
+        FixedCodec<bool>::Load(block1 + 4, data.ReleaseContinuationPoints);
         DeserializeContainer(*this, data.AttributesToRead);
     }
 
@@ -2435,22 +2381,17 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Header;
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<HistoryUpdateDetails>(HistoryUpdateDetails& data)
     {
         *this >> data.NodeId;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<UpdateDataDetails>(UpdateDataDetails& data)
@@ -2460,9 +2401,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.UpdateValues);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<UpdateStructureDataDetails>(UpdateStructureDataDetails& data)
@@ -2472,33 +2410,26 @@ namespace OpcUa
         DeserializeContainer(*this, data.UpdateValues);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DeleteRawModifiedDetails>(DeleteRawModifiedDetails& data)
     {
         *this >> data.NodeId;
-        *this >> data.IsDeleteModified;
-        *this >> data.StartTime;
-        *this >> data.EndTime;
+        char block1[17];
+        Read(block1, sizeof(block1));
+        FixedCodec<bool>::Load(block1 + 0, data.IsDeleteModified);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 1, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 9, data.EndTime);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DeleteAtTimeDetails>(DeleteAtTimeDetails& data)
     {
         *this >> data.NodeId;
-        DeserializeContainer(*this, data.ReqTimes);
+        DeserializeFixedContainer(*this, data.ReqTimes);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DeleteEventDetails>(DeleteEventDetails& data)
@@ -2507,21 +2438,15 @@ namespace OpcUa
         DeserializeContainer(*this, data.EventIds);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<HistoryUpdateResult>(HistoryUpdateResult& data)
     {
         *this >> data.Status;
-        DeserializeContainer(*this, data.OperationResults);
+        DeserializeFixedContainer(*this, data.OperationResults);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<HistoryUpdateParameters>(HistoryUpdateParameters& data)
@@ -2529,9 +2454,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.HistoryUpdateDetails);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<HistoryUpdateRequest>(HistoryUpdateRequest& data)
@@ -2541,9 +2463,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<HistoryUpdateResponse>(HistoryUpdateResponse& data)
@@ -2554,7 +2473,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<CallMethodRequest>(CallMethodRequest& data)
@@ -2569,7 +2487,7 @@ namespace OpcUa
     void DataDeserializer::Deserialize<CallMethodResult>(CallMethodResult& data)
     {
         *this >> data.Status;
-        DeserializeContainer(*this, data.InputArgumentResults);
+        DeserializeFixedContainer(*this, data.InputArgumentResults);
         DeserializeContainer(*this, data.InputArgumentDiagnosticInfos);
         DeserializeContainer(*this, data.OutputArguments);
     }
@@ -2608,7 +2526,7 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Body;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Body;
     }
 
 */
@@ -2619,11 +2537,13 @@ namespace OpcUa
     void DataDeserializer::Deserialize<DataChangeFilter>(DataChangeFilter& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.Trigger;
-        *this >> data.DeadbandType;
-        *this >> data.DeadbandValue;
+        char block1[21];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DataChangeTrigger>::Load(block1 + 5, data.Trigger);
+        FixedCodec<uint32_t>::Load(block1 + 9, data.DeadbandType);
+        FixedCodec<double>::Load(block1 + 13, data.DeadbandValue);
     }
 
 */
@@ -2634,40 +2554,43 @@ namespace OpcUa
     void DataDeserializer::Deserialize<EventFilter>(EventFilter& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         DeserializeContainer(*this, data.SelectClauses);
         *this >> data.WhereClause;
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<ReadEventDetails>(ReadEventDetails& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.NumValuesPerNode;
-        *this >> data.StartTime;
-        *this >> data.EndTime;
+        char block1[25];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Load(block1 + 5, data.NumValuesPerNode);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 9, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 17, data.EndTime);
         *this >> data.Filter;
     }
 
-*/
 
 /*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<AggregateConfiguration>(AggregateConfiguration& data)
     {
-        *this >> data.UseServerCapabilitiesDefaults;
-        *this >> data.TreatUncertainAsBad;
-        *this >> data.PercentDataBad;
-        *this >> data.PercentDataGood;
-        *this >> data.UseSlopedExtrapolation;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<bool>::Load(block1 + 0, data.UseServerCapabilitiesDefaults);
+        FixedCodec<bool>::Load(block1 + 1, data.TreatUncertainAsBad);
+        FixedCodec<uint8_t>::Load(block1 + 2, data.PercentDataBad);
+        FixedCodec<uint8_t>::Load(block1 + 3, data.PercentDataGood);
+        FixedCodec<bool>::Load(block1 + 4, data.UseSlopedExtrapolation);
     }
 
 */
@@ -2678,11 +2601,13 @@ namespace OpcUa
     void DataDeserializer::Deserialize<ReadProcessedDetails>(ReadProcessedDetails& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.StartTime;
-        *this >> data.EndTime;
-        *this >> data.ProcessingInterval;
+        char block1[29];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 5, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 13, data.EndTime);
+        FixedCodec<double>::Load(block1 + 21, data.ProcessingInterval);
         DeserializeContainer(*this, data.AggregateType);
         *this >> data.AggregateConfiguration;
     }
@@ -2695,9 +2620,11 @@ namespace OpcUa
     void DataDeserializer::Deserialize<AggregateFilter>(AggregateFilter& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.StartTime;
+        char block1[13];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 5, data.StartTime);
         *this >> data.AggregateType;
         *this >> data.ProcessingInterval;
         *this >> data.AggregateConfiguration;
@@ -2705,34 +2632,28 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<MonitoringFilterResult>(MonitoringFilterResult& data)
     {
         *this >> data.TypeId;
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Body;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Body;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<EventFilterResult>(EventFilterResult& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        DeserializeContainer(*this, data.SelectClauseResults);
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        DeserializeFixedContainer(*this, data.SelectClauseResults);
         DeserializeContainer(*this, data.SelectClauseDiagnosticInfos);
         *this >> data.WhereClauseResult;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<HistoryUpdateEventResult>(HistoryUpdateEventResult& data)
@@ -2741,7 +2662,6 @@ namespace OpcUa
         *this >> data.EventFilterResult;
     }
 
-*/
 
 /*  DISABLED
 
@@ -2749,10 +2669,12 @@ namespace OpcUa
     void DataDeserializer::Deserialize<AggregateFilterResult>(AggregateFilterResult& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.RevisedStartTime;
-        *this >> data.RevisedProcessingInterval;
+        char block1[21];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 5, data.RevisedStartTime);
+        FixedCodec<double>::Load(block1 + 13, data.RevisedProcessingInterval);
         *this >> data.RevisedAggregateConfiguration;
     }
 
@@ -2761,11 +2683,15 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<MonitoringParameters>(MonitoringParameters& data)
     {
-        *this >> data.ClientHandle;
-        *this >> data.SamplingInterval;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.ClientHandle);
+        FixedCodec<double>::Load(block1 + 4, data.SamplingInterval);
         *this >> data.Filter;
-        *this >> data.QueueSize;
-        *this >> data.DiscardOldest;
+        char block2[5];
+        Read(block2, sizeof(block2));
+        FixedCodec<uint32_t>::Load(block2 + 0, data.QueueSize);
+        FixedCodec<bool>::Load(block2 + 4, data.DiscardOldest);
     }
 
 
@@ -2781,10 +2707,12 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<MonitoredItemCreateResult>(MonitoredItemCreateResult& data)
     {
-        *this >> data.Status;
-        *this >> data.MonitoredItemId;
-        *this >> data.RevisedSamplingInterval;
-        *this >> data.RevisedQueueSize;
+        char block1[20];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::StatusCode>::Load(block1 + 0, data.Status);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.MonitoredItemId);
+        FixedCodec<double>::Load(block1 + 8, data.RevisedSamplingInterval);
+        FixedCodec<uint32_t>::Load(block1 + 16, data.RevisedQueueSize);
         *this >> data.FilterResult;
     }
 
@@ -2792,8 +2720,10 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<MonitoredItemsParameters>(MonitoredItemsParameters& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.TimestampsToReturn;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.SubscriptionId);
+        FixedCodec<OpcUa::TimestampsToReturn>::Load(block1 + 4, data.TimestampsToReturn);
         DeserializeContainer(*this, data.ItemsToCreate);
     }
 
@@ -2817,8 +2747,6 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<MonitoredItemModifyRequest>(MonitoredItemModifyRequest& data)
     {
@@ -2826,34 +2754,29 @@ namespace OpcUa
         *this >> data.RequestedParameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<MonitoredItemModifyResult>(MonitoredItemModifyResult& data)
     {
-        *this >> data.Status;
-        *this >> data.RevisedSamplingInterval;
-        *this >> data.RevisedQueueSize;
+        char block1[16];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::StatusCode>::Load(block1 + 0, data.Status);
+        FixedCodec<double>::Load(block1 + 4, data.RevisedSamplingInterval);
+        FixedCodec<uint32_t>::Load(block1 + 12, data.RevisedQueueSize);
         *this >> data.FilterResult;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModifyMonitoredItemsParameters>(ModifyMonitoredItemsParameters& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.TimestampsToReturn;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.SubscriptionId);
+        FixedCodec<OpcUa::TimestampsToReturn>::Load(block1 + 4, data.TimestampsToReturn);
         DeserializeContainer(*this, data.ItemsToModify);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModifyMonitoredItemsRequest>(ModifyMonitoredItemsRequest& data)
@@ -2863,9 +2786,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModifyMonitoredItemsResponse>(ModifyMonitoredItemsResponse& data)
@@ -2876,21 +2796,17 @@ namespace OpcUa
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetMonitoringModeParameters>(SetMonitoringModeParameters& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.MonitoringMode;
-        DeserializeContainer(*this, data.MonitoredItemIds);
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.SubscriptionId);
+        FixedCodec<OpcUa::MonitoringMode>::Load(block1 + 4, data.MonitoringMode);
+        DeserializeFixedContainer(*this, data.MonitoredItemIds);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetMonitoringModeRequest>(SetMonitoringModeRequest& data)
@@ -2900,20 +2816,14 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetMonitoringModeResult>(SetMonitoringModeResult& data)
     {
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetMonitoringModeResponse>(SetMonitoringModeResponse& data)
@@ -2923,22 +2833,18 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetTriggeringParameters>(SetTriggeringParameters& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.TriggeringItemId;
-        DeserializeContainer(*this, data.LinksToAdd);
-        DeserializeContainer(*this, data.LinksToRemove);
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.SubscriptionId);
+        FixedCodec<uint32_t>::Load(block1 + 4, data.TriggeringItemId);
+        DeserializeFixedContainer(*this, data.LinksToAdd);
+        DeserializeFixedContainer(*this, data.LinksToRemove);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetTriggeringRequest>(SetTriggeringRequest& data)
@@ -2948,22 +2854,16 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetTriggeringResult>(SetTriggeringResult& data)
     {
-        DeserializeContainer(*this, data.AddResults);
+        DeserializeFixedContainer(*this, data.AddResults);
         DeserializeContainer(*this, data.AddDiagnosticInfos);
-        DeserializeContainer(*this, data.RemoveResults);
+        DeserializeFixedContainer(*this, data.RemoveResults);
         DeserializeContainer(*this, data.RemoveDiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SetTriggeringResponse>(SetTriggeringResponse& data)
@@ -2973,13 +2873,12 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<DeleteMonitoredItemsParameters>(DeleteMonitoredItemsParameters& data)
     {
         *this >> data.SubscriptionId;
-        DeserializeContainer(*this, data.MonitoredItemIds);
+        DeserializeFixedContainer(*this, data.MonitoredItemIds);
     }
 
 
@@ -2997,7 +2896,7 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Header;
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -3005,12 +2904,9 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<CreateSubscriptionParameters>(CreateSubscriptionParameters& data)
     {
-        *this >> data.RequestedPublishingInterval;
-        *this >> data.RequestedLifetimeCount;
-        *this >> data.RequestedMaxKeepAliveCount;
-        *this >> data.MaxNotificationsPerPublish;
-        *this >> data.PublishingEnabled;
-        *this >> data.Priority;
+        char block[FixedCodec<CreateSubscriptionParameters>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<CreateSubscriptionParameters>::Load(block, data);
     }
 
 
@@ -3026,10 +2922,9 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<SubscriptionData>(SubscriptionData& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.RevisedPublishingInterval;
-        *this >> data.RevisedLifetimeCount;
-        *this >> data.RevisedMaxKeepAliveCount;
+        char block[FixedCodec<SubscriptionData>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<SubscriptionData>::Load(block, data);
     }
 
 
@@ -3042,22 +2937,14 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<ModifySubscriptionParameters>(ModifySubscriptionParameters& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.RequestedPublishingInterval;
-        *this >> data.RequestedLifetimeCount;
-        *this >> data.RequestedMaxKeepAliveCount;
-        *this >> data.MaxNotificationsPerPublish;
-        *this >> data.Priority;
+        char block[FixedCodec<ModifySubscriptionParameters>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<ModifySubscriptionParameters>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModifySubscriptionRequest>(ModifySubscriptionRequest& data)
@@ -3067,21 +2954,15 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModifySubscriptionResult>(ModifySubscriptionResult& data)
     {
-        *this >> data.RevisedPublishingInterval;
-        *this >> data.RevisedLifetimeCount;
-        *this >> data.RevisedMaxKeepAliveCount;
+        char block[FixedCodec<ModifySubscriptionResult>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<ModifySubscriptionResult>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModifySubscriptionResponse>(ModifySubscriptionResponse& data)
@@ -3091,13 +2972,12 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<PublishingModeParameters>(PublishingModeParameters& data)
     {
         *this >> data.PublishingEnabled;
-        DeserializeContainer(*this, data.SubscriptionIds);
+        DeserializeFixedContainer(*this, data.SubscriptionIds);
     }
 
 
@@ -3113,7 +2993,7 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<PublishingModeResult>(PublishingModeResult& data)
     {
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -3130,8 +3010,10 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<NotificationMessage>(NotificationMessage& data)
     {
-        *this >> data.SequenceNumber;
-        *this >> data.PublishTime;
+        char block1[12];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.SequenceNumber);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 4, data.PublishTime);
         DeserializeContainer(*this, data.NotificationData);
     }
 
@@ -3143,13 +3025,11 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Encoding;
-        if ((data.Encoding) & (1>>(0))) *this >> data.Body;
+        if ((data.Encoding) & (1<<(0))) *this >> data.Body;
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<MonitoredItemNotification>(MonitoredItemNotification& data)
     {
@@ -3157,7 +3037,6 @@ namespace OpcUa
         *this >> data.Value;
     }
 
-*/
 
 /*  DISABLED
 
@@ -3165,8 +3044,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<DataChangeNotification>(DataChangeNotification& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         DeserializeContainer(*this, data.MonitoredItems);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
@@ -3190,24 +3071,21 @@ namespace OpcUa
     void DataDeserializer::Deserialize<EventNotificationList>(EventNotificationList& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
         DeserializeContainer(*this, data.Events);
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<HistoryEventFieldList>(HistoryEventFieldList& data)
     {
         DeserializeContainer(*this, data.EventFields);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<HistoryEvent>(HistoryEvent& data)
@@ -3215,9 +3093,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.Events);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<UpdateEventDetails>(UpdateEventDetails& data)
@@ -3228,7 +3103,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.EventData);
     }
 
-*/
 
 /*  DISABLED
 
@@ -3236,9 +3110,11 @@ namespace OpcUa
     void DataDeserializer::Deserialize<StatusChangeNotification>(StatusChangeNotification& data)
     {
         *this >> data.TypeId;
-        *this >> data.Encoding;
-        *this >> data.BodyLength;
-        *this >> data.Status;
+        char block1[9];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Load(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::StatusCode>::Load(block1 + 5, data.Status);
         *this >> data.DiagnosticInfo;
     }
 
@@ -3247,8 +3123,9 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<SubscriptionAcknowledgement>(SubscriptionAcknowledgement& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.SequenceNumber;
+        char block[FixedCodec<SubscriptionAcknowledgement>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<SubscriptionAcknowledgement>::Load(block, data);
     }
 
 
@@ -3257,7 +3134,7 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Header;
-        DeserializeContainer(*this, data.SubscriptionAcknowledgements);
+        DeserializeFixedContainer(*this, data.SubscriptionAcknowledgements);
     }
 
 
@@ -3265,10 +3142,10 @@ namespace OpcUa
     void DataDeserializer::Deserialize<PublishResult>(PublishResult& data)
     {
         *this >> data.SubscriptionId;
-        DeserializeContainer(*this, data.AvailableSequenceNumbers);
+        DeserializeFixedContainer(*this, data.AvailableSequenceNumbers);
         *this >> data.MoreNotifications;
         *this >> data.NotificationMessage;
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -3285,8 +3162,9 @@ namespace OpcUa
     template<>
     void DataDeserializer::Deserialize<RepublishParameters>(RepublishParameters& data)
     {
-        *this >> data.SubscriptionId;
-        *this >> data.RetransmitSequenceNumber;
+        char block[FixedCodec<RepublishParameters>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<RepublishParameters>::Load(block, data);
     }
 
 
@@ -3308,29 +3186,21 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<TransferResult>(TransferResult& data)
     {
         *this >> data.Status;
-        DeserializeContainer(*this, data.AvailableSequenceNumbers);
+        DeserializeFixedContainer(*this, data.AvailableSequenceNumbers);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TransferSubscriptionsParameters>(TransferSubscriptionsParameters& data)
     {
-        DeserializeContainer(*this, data.SubscriptionIds);
+        DeserializeFixedContainer(*this, data.SubscriptionIds);
         *this >> data.SendInitialValues;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TransferSubscriptionsRequest>(TransferSubscriptionsRequest& data)
@@ -3340,9 +3210,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TransferSubscriptionsResult>(TransferSubscriptionsResult& data)
@@ -3351,9 +3218,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TransferSubscriptionsResponse>(TransferSubscriptionsResponse& data)
@@ -3363,14 +3227,13 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<DeleteSubscriptionsRequest>(DeleteSubscriptionsRequest& data)
     {
         *this >> data.TypeId;
         *this >> data.Header;
-        DeserializeContainer(*this, data.SubscriptionIds);
+        DeserializeFixedContainer(*this, data.SubscriptionIds);
     }
 
 
@@ -3379,27 +3242,27 @@ namespace OpcUa
     {
         *this >> data.TypeId;
         *this >> data.Header;
-        DeserializeContainer(*this, data.Results);
+        DeserializeFixedContainer(*this, data.Results);
         DeserializeContainer(*this, data.DiagnosticInfos);
     }
 
 
-/*  DISABLED
-
     template<>
     void DataDeserializer::Deserialize<ScalarTestType>(ScalarTestType& data)
     {
-        *this >> data.Boolean;
-        *this >> data.SByte;
-        *this >> data.Byte;
-        *this >> data.Int16;
-        *this >> data.UInt16;
-        *this >> data.Int32;
-        *this >> data.UInt32;
-        *this >> data.Int64;
-        *this >> data.UInt64;
-        *this >> data.Float;
-        *this >> data.Double;
+        char block1[43];
+        Read(block1, sizeof(block1));
+        FixedCodec<bool>::Load(block1 + 0, data.Boolean);
+        FixedCodec<uint8_t>::Load(block1 + 1, data.SByte);
+        FixedCodec<uint8_t>::Load(block1 + 2, data.Byte);
+        FixedCodec<int16_t>::Load(block1 + 3, data.Int16);
+        FixedCodec<uint16_t>::Load(block1 + 5, data.UInt16);
+        FixedCodec<int32_t>::Load(block1 + 7, data.Int32);
+        FixedCodec<uint32_t>::Load(block1 + 11, data.UInt32);
+        FixedCodec<int64_t>::Load(block1 + 15, data.Int64);
+        FixedCodec<uint64_t>::Load(block1 + 23, data.UInt64);
+        FixedCodec<float>::Load(block1 + 31, data.Float);
+        FixedCodec<double>::Load(block1 + 35, data.Double);
         *this >> data.String;
         *this >> data.DateTime;
         *this >> data.Guid;
@@ -3416,43 +3279,37 @@ namespace OpcUa
         *this >> data.EnumeratedValue;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ArrayTestType>(ArrayTestType& data)
     {
-        DeserializeContainer(*this, data.Booleans);
-        DeserializeContainer(*this, data.SBytes);
-        DeserializeContainer(*this, data.Int16s);
-        DeserializeContainer(*this, data.UInt16s);
-        DeserializeContainer(*this, data.Int32s);
-        DeserializeContainer(*this, data.UInt32s);
-        DeserializeContainer(*this, data.Int64s);
-        DeserializeContainer(*this, data.UInt64s);
-        DeserializeContainer(*this, data.Floats);
-        DeserializeContainer(*this, data.Doubles);
+        DeserializeFixedContainer(*this, data.Booleans);
+        DeserializeFixedContainer(*this, data.SBytes);
+        DeserializeFixedContainer(*this, data.Int16s);
+        DeserializeFixedContainer(*this, data.UInt16s);
+        DeserializeFixedContainer(*this, data.Int32s);
+        DeserializeFixedContainer(*this, data.UInt32s);
+        DeserializeFixedContainer(*this, data.Int64s);
+        DeserializeFixedContainer(*this, data.UInt64s);
+        DeserializeFixedContainer(*this, data.Floats);
+        DeserializeFixedContainer(*this, data.Doubles);
         DeserializeContainer(*this, data.Strings);
-        DeserializeContainer(*this, data.DateTimes);
+        DeserializeFixedContainer(*this, data.DateTimes);
         DeserializeContainer(*this, data.Guids);
         DeserializeContainer(*this, data.ByteStrings);
         DeserializeContainer(*this, data.XmlElements);
         DeserializeContainer(*this, data.NodeIds);
         DeserializeContainer(*this, data.ExpandedNodeIds);
-        DeserializeContainer(*this, data.StatusCodes);
+        DeserializeFixedContainer(*this, data.StatusCodes);
         DeserializeContainer(*this, data.DiagnosticInfos);
         DeserializeContainer(*this, data.QualifiedNames);
         DeserializeContainer(*this, data.LocalizedTexts);
         DeserializeContainer(*this, data.ExtensionObjects);
         DeserializeContainer(*this, data.DataValues);
         DeserializeContainer(*this, data.Variants);
-        DeserializeContainer(*this, data.EnumeratedValues);
+        DeserializeFixedContainer(*this, data.EnumeratedValues);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<CompositeTestType>(CompositeTestType& data)
@@ -3461,21 +3318,17 @@ namespace OpcUa
         *this >> data.Field2;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackParameters>(TestStackParameters& data)
     {
-        *this >> data.TestId;
-        *this >> data.Iteration;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.TestId);
+        FixedCodec<int32_t>::Load(block1 + 4, data.Iteration);
         *this >> data.Input;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackRequest>(TestStackRequest& data)
@@ -3485,9 +3338,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackResult>(TestStackResult& data)
@@ -3495,9 +3345,6 @@ namespace OpcUa
         *this >> data.Output;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackResponse>(TestStackResponse& data)
@@ -3507,21 +3354,17 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackExParameters>(TestStackExParameters& data)
     {
-        *this >> data.TestId;
-        *this >> data.Iteration;
+        char block1[8];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.TestId);
+        FixedCodec<int32_t>::Load(block1 + 4, data.Iteration);
         *this >> data.Input;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackExRequest>(TestStackExRequest& data)
@@ -3531,9 +3374,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackExResult>(TestStackExResult& data)
@@ -3541,9 +3381,6 @@ namespace OpcUa
         *this >> data.Output;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<TestStackExResponse>(TestStackExResponse& data)
@@ -3553,9 +3390,6 @@ namespace OpcUa
         *this >> data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<BuildInfo>(BuildInfo& data)
@@ -3568,21 +3402,17 @@ namespace OpcUa
         *this >> data.BuildDate;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<RedundantServerDataType>(RedundantServerDataType& data)
     {
         *this >> data.ServerId;
-        *this >> data.ServiceLevel;
-        *this >> data.ServerState;
+        char block1[5];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint8_t>::Load(block1 + 0, data.ServiceLevel);
+        FixedCodec<OpcUa::ServerState>::Load(block1 + 1, data.ServerState);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<EndpointUrlListDataType>(EndpointUrlListDataType& data)
@@ -3590,9 +3420,6 @@ namespace OpcUa
         DeserializeContainer(*this, data.EndpointUrlList);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<NetworkGroupDataType>(NetworkGroupDataType& data)
@@ -3601,58 +3428,38 @@ namespace OpcUa
         DeserializeContainer(*this, data.NetworkPaths);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SamplingIntervalDiagnosticsDataType>(SamplingIntervalDiagnosticsDataType& data)
     {
-        *this >> data.SamplingInterval;
-        *this >> data.MonitoredItemCount;
-        *this >> data.MaxMonitoredItemCount;
-        *this >> data.DisabledMonitoredItemCount;
+        char block[FixedCodec<SamplingIntervalDiagnosticsDataType>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<SamplingIntervalDiagnosticsDataType>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ServerDiagnosticsSummaryDataType>(ServerDiagnosticsSummaryDataType& data)
     {
-        *this >> data.ServerViewCount;
-        *this >> data.CurrentSessionCount;
-        *this >> data.CumulatedSessionCount;
-        *this >> data.SecurityRejectedSessionCount;
-        *this >> data.RejectedSessionCount;
-        *this >> data.SessionTimeoutCount;
-        *this >> data.SessionAbortCount;
-        *this >> data.CurrentSubscriptionCount;
-        *this >> data.CumulatedSubscriptionCount;
-        *this >> data.PublishingIntervalCount;
-        *this >> data.SecurityRejectedRequestsCount;
-        *this >> data.RejectedRequestsCount;
+        char block[FixedCodec<ServerDiagnosticsSummaryDataType>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<ServerDiagnosticsSummaryDataType>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ServerStatusDataType>(ServerStatusDataType& data)
     {
-        *this >> data.StartTime;
-        *this >> data.CurrentTime;
-        *this >> data.State;
+        char block1[20];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 0, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 8, data.CurrentTime);
+        FixedCodec<OpcUa::ServerState>::Load(block1 + 16, data.State);
         *this >> data.BuildInfo;
         *this >> data.SecondsTillShutdown;
         *this >> data.ShutdownReason;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SessionSecurityDiagnosticsDataType>(SessionSecurityDiagnosticsDataType& data)
@@ -3668,20 +3475,15 @@ namespace OpcUa
         *this >> data.ClientCertificate;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ServiceCounterDataType>(ServiceCounterDataType& data)
     {
-        *this >> data.TotalCount;
-        *this >> data.ErrorCount;
+        char block[FixedCodec<ServiceCounterDataType>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<ServiceCounterDataType>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SessionDiagnosticsDataType>(SessionDiagnosticsDataType& data)
@@ -3692,48 +3494,47 @@ namespace OpcUa
         *this >> data.ServerUri;
         *this >> data.EndpointUrl;
         DeserializeContainer(*this, data.LocaleIds);
-        *this >> data.ActualSessionTimeout;
-        *this >> data.MaxResponseMessageSize;
-        *this >> data.ClientConnectionTime;
-        *this >> data.ClientLastContactTime;
-        *this >> data.CurrentSubscriptionsCount;
-        *this >> data.CurrentMonitoredItemsCount;
-        *this >> data.CurrentPublishRequestsInQueue;
-        *this >> data.TotalRequestCount;
-        *this >> data.UnauthorizedRequestCount;
-        *this >> data.ReadCount;
-        *this >> data.HistoryReadCount;
-        *this >> data.WriteCount;
-        *this >> data.HistoryUpdateCount;
-        *this >> data.CallCount;
-        *this >> data.CreateMonitoredItemsCount;
-        *this >> data.ModifyMonitoredItemsCount;
-        *this >> data.SetMonitoringModeCount;
-        *this >> data.SetTriggeringCount;
-        *this >> data.DeleteMonitoredItemsCount;
-        *this >> data.CreateSubscriptionCount;
-        *this >> data.ModifySubscriptionCount;
-        *this >> data.SetPublishingModeCount;
-        *this >> data.PublishCount;
-        *this >> data.RepublishCount;
-        *this >> data.TransferSubscriptionsCount;
-        *this >> data.DeleteSubscriptionsCount;
-        *this >> data.AddNodesCount;
-        *this >> data.AddReferencesCount;
-        *this >> data.DeleteNodesCount;
-        *this >> data.DeleteReferencesCount;
-        *this >> data.BrowseCount;
-        *this >> data.BrowseNextCount;
-        *this >> data.TranslateBrowsePathsToNodeIdsCount;
-        *this >> data.QueryFirstCount;
-        *this >> data.QueryNextCount;
-        *this >> data.RegisterNodesCount;
-        *this >> data.UnregisterNodesCount;
+        char block1[276];
+        Read(block1, sizeof(block1));
+        FixedCodec<double>::Load(block1 + 0, data.ActualSessionTimeout);
+        FixedCodec<uint32_t>::Load(block1 + 8, data.MaxResponseMessageSize);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 12, data.ClientConnectionTime);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 20, data.ClientLastContactTime);
+        FixedCodec<uint32_t>::Load(block1 + 28, data.CurrentSubscriptionsCount);
+        FixedCodec<uint32_t>::Load(block1 + 32, data.CurrentMonitoredItemsCount);
+        FixedCodec<uint32_t>::Load(block1 + 36, data.CurrentPublishRequestsInQueue);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 40, data.TotalRequestCount);
+        FixedCodec<uint32_t>::Load(block1 + 48, data.UnauthorizedRequestCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 52, data.ReadCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 60, data.HistoryReadCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 68, data.WriteCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 76, data.HistoryUpdateCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 84, data.CallCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 92, data.CreateMonitoredItemsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 100, data.ModifyMonitoredItemsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 108, data.SetMonitoringModeCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 116, data.SetTriggeringCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 124, data.DeleteMonitoredItemsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 132, data.CreateSubscriptionCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 140, data.ModifySubscriptionCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 148, data.SetPublishingModeCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 156, data.PublishCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 164, data.RepublishCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 172, data.TransferSubscriptionsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 180, data.DeleteSubscriptionsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 188, data.AddNodesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 196, data.AddReferencesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 204, data.DeleteNodesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 212, data.DeleteReferencesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 220, data.BrowseCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 228, data.BrowseNextCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 236, data.TranslateBrowsePathsToNodeIdsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 244, data.QueryFirstCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 252, data.QueryNextCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 260, data.RegisterNodesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Load(block1 + 268, data.UnregisterNodesCount);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<StatusResult>(StatusResult& data)
@@ -3742,49 +3543,45 @@ namespace OpcUa
         *this >> data.DiagnosticInfo;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SubscriptionDiagnosticsDataType>(SubscriptionDiagnosticsDataType& data)
     {
         *this >> data.SessionId;
-        *this >> data.SubscriptionId;
-        *this >> data.Priority;
-        *this >> data.PublishingInterval;
-        *this >> data.MaxKeepAliveCount;
-        *this >> data.MaxLifetimeCount;
-        *this >> data.MaxNotificationsPerPublish;
-        *this >> data.PublishingEnabled;
-        *this >> data.ModifyCount;
-        *this >> data.EnableCount;
-        *this >> data.DisableCount;
-        *this >> data.RepublishRequestCount;
-        *this >> data.RepublishMessageRequestCount;
-        *this >> data.RepublishMessageCount;
-        *this >> data.TransferRequestCount;
-        *this >> data.TransferredToAltClientCount;
-        *this >> data.TransferredToSameClientCount;
-        *this >> data.PublishRequestCount;
-        *this >> data.DataChangeNotificationsCount;
-        *this >> data.EventNotificationsCount;
-        *this >> data.NotificationsCount;
-        *this >> data.LatePublishRequestCount;
-        *this >> data.CurrentKeepAliveCount;
-        *this >> data.CurrentLifetimeCount;
-        *this >> data.UnacknowledgedMessageCount;
-        *this >> data.DiscardedMessageCount;
-        *this >> data.MonitoredItemCount;
-        *this >> data.DisabledMonitoredItemCount;
-        *this >> data.MonitoringQueueOverflowCount;
-        *this >> data.NextSequenceNumber;
-        *this >> data.EventQueueOverFlowCount;
+        char block1[118];
+        Read(block1, sizeof(block1));
+        FixedCodec<uint32_t>::Load(block1 + 0, data.SubscriptionId);
+        FixedCodec<uint8_t>::Load(block1 + 4, data.Priority);
+        FixedCodec<double>::Load(block1 + 5, data.PublishingInterval);
+        FixedCodec<uint32_t>::Load(block1 + 13, data.MaxKeepAliveCount);
+        FixedCodec<uint32_t>::Load(block1 + 17, data.MaxLifetimeCount);
+        FixedCodec<uint32_t>::Load(block1 + 21, data.MaxNotificationsPerPublish);
+        FixedCodec<bool>::Load(block1 + 25, data.PublishingEnabled);
+        FixedCodec<uint32_t>::Load(block1 + 26, data.ModifyCount);
+        FixedCodec<uint32_t>::Load(block1 + 30, data.EnableCount);
+        FixedCodec<uint32_t>::Load(block1 + 34, data.DisableCount);
+        FixedCodec<uint32_t>::Load(block1 + 38, data.RepublishRequestCount);
+        FixedCodec<uint32_t>::Load(block1 + 42, data.RepublishMessageRequestCount);
+        FixedCodec<uint32_t>::Load(block1 + 46, data.RepublishMessageCount);
+        FixedCodec<uint32_t>::Load(block1 + 50, data.TransferRequestCount);
+        FixedCodec<uint32_t>::Load(block1 + 54, data.TransferredToAltClientCount);
+        FixedCodec<uint32_t>::Load(block1 + 58, data.TransferredToSameClientCount);
+        FixedCodec<uint32_t>::Load(block1 + 62, data.PublishRequestCount);
+        FixedCodec<uint32_t>::Load(block1 + 66, data.DataChangeNotificationsCount);
+        FixedCodec<uint32_t>::Load(block1 + 70, data.EventNotificationsCount);
+        FixedCodec<uint32_t>::Load(block1 + 74, data.NotificationsCount);
+        FixedCodec<uint32_t>::Load(block1 + 78, data.LatePublishRequestCount);
+        FixedCodec<uint32_t>::Load(block1 + 82, data.CurrentKeepAliveCount);
+        FixedCodec<uint32_t>::Load(block1 + 86, data.CurrentLifetimeCount);
+        FixedCodec<uint32_t>::Load(block1 + 90, data.UnacknowledgedMessageCount);
+        FixedCodec<uint32_t>::Load(block1 + 94, data.DiscardedMessageCount);
+        FixedCodec<uint32_t>::Load(block1 + 98, data.MonitoredItemCount);
+        FixedCodec<uint32_t>::Load(block1 + 102, data.DisabledMonitoredItemCount);
+        FixedCodec<uint32_t>::Load(block1 + 106, data.MonitoringQueueOverflowCount);
+        FixedCodec<uint32_t>::Load(block1 + 110, data.NextSequenceNumber);
+        FixedCodec<uint32_t>::Load(block1 + 114, data.EventQueueOverFlowCount);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ModelChangeStructureDataType>(ModelChangeStructureDataType& data)
@@ -3794,9 +3591,6 @@ namespace OpcUa
         *this >> data.Verb;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<SemanticChangeStructureDataType>(SemanticChangeStructureDataType& data)
@@ -3805,20 +3599,15 @@ namespace OpcUa
         *this >> data.AffectedType;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<Range>(Range& data)
     {
-        *this >> data.Low;
-        *this >> data.High;
+        char block[FixedCodec<Range>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<Range>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<EUInformation>(EUInformation& data)
@@ -3829,31 +3618,24 @@ namespace OpcUa
         *this >> data.Description;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ComplexNumberType>(ComplexNumberType& data)
     {
-        *this >> data.Real;
-        *this >> data.Imaginary;
+        char block[FixedCodec<ComplexNumberType>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<ComplexNumberType>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<DoubleComplexNumberType>(DoubleComplexNumberType& data)
     {
-        *this >> data.Real;
-        *this >> data.Imaginary;
+        char block[FixedCodec<DoubleComplexNumberType>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<DoubleComplexNumberType>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<AxisInformation>(AxisInformation& data)
@@ -3862,31 +3644,28 @@ namespace OpcUa
         *this >> data.EURange;
         *this >> data.Title;
         *this >> data.AxisScaleType;
-        DeserializeContainer(*this, data.AxisSteps);
+        DeserializeFixedContainer(*this, data.AxisSteps);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<XVType>(XVType& data)
     {
-        *this >> data.X;
-        *this >> data.Value;
+        char block[FixedCodec<XVType>::Size];
+        Read(block, sizeof(block));
+        FixedCodec<XVType>::Load(block, data);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataDeserializer::Deserialize<ProgramDiagnosticDataType>(ProgramDiagnosticDataType& data)
     {
         *this >> data.CreateSessionId;
         *this >> data.CreateClientName;
-        *this >> data.InvocationCreationTime;
-        *this >> data.LastTransitionTime;
+        char block1[16];
+        Read(block1, sizeof(block1));
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 0, data.InvocationCreationTime);
+        FixedCodec<OpcUa::DateTime>::Load(block1 + 8, data.LastTransitionTime);
         *this >> data.LastMethodCall;
         *this >> data.LastMethodSessionId;
         DeserializeContainer(*this, data.LastMethodInputArguments);
@@ -3895,7 +3674,6 @@ namespace OpcUa
         *this >> data.LastMethodReturnStatus;
     }
 
-*/
 
     template<>
     void DataDeserializer::Deserialize<Annotation>(Annotation& data)
@@ -0,0 +1,406 @@
+// DO NOT EDIT THIS FILE!
+// It is automatically generated from opcfoundation.org schemas.
+//
+
+/// @brief Encoding of structures made only of fixed size fields.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include "binary_serialization.h"
+#include <opc/ua/protocol/protocol.h>
+
+namespace OpcUa
+{
+
+  template <>
+  struct FixedCodec<OpcUa::TimeZoneDataType>
+  {
+    static void Store(char* out, const OpcUa::TimeZoneDataType& data)
+    {
+      FixedCodec<int16_t>::Store(out + 0, data.Offset);
+      FixedCodec<bool>::Store(out + 2, data.DaylightSavingInOffset);
+    }
+
+    static void Load(const char* in, OpcUa::TimeZoneDataType& data)
+    {
+      FixedCodec<int16_t>::Load(in + 0, data.Offset);
+      FixedCodec<bool>::Load(in + 2, data.DaylightSavingInOffset);
+    }
+
+    static const std::size_t Size = 3;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::ChannelSecurityToken>
+  {
+    static void Store(char* out, const OpcUa::ChannelSecurityToken& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.ChannelId);
+      FixedCodec<uint32_t>::Store(out + 4, data.TokenId);
+      FixedCodec<OpcUa::DateTime>::Store(out + 8, data.CreatedAt);
+      FixedCodec<uint32_t>::Store(out + 16, data.RevisedLifetime);
+    }
+
+    static void Load(const char* in, OpcUa::ChannelSecurityToken& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.ChannelId);
+      FixedCodec<uint32_t>::Load(in + 4, data.TokenId);
+      FixedCodec<OpcUa::DateTime>::Load(in + 8, data.CreatedAt);
+      FixedCodec<uint32_t>::Load(in + 16, data.RevisedLifetime);
+    }
+
+    static const std::size_t Size = 20;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::CancelParameters>
+  {
+    static void Store(char* out, const OpcUa::CancelParameters& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.RequestHandle);
+    }
+
+    static void Load(const char* in, OpcUa::CancelParameters& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.RequestHandle);
+    }
+
+    static const std::size_t Size = 4;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::CancelResult>
+  {
+    static void Store(char* out, const OpcUa::CancelResult& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.CancelCount);
+    }
+
+    static void Load(const char* in, OpcUa::CancelResult& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.CancelCount);
+    }
+
+    static const std::size_t Size = 4;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::EndpointConfiguration>
+  {
+    static void Store(char* out, const OpcUa::EndpointConfiguration& data)
+    {
+      FixedCodec<int32_t>::Store(out + 0, data.OperationTimeout);
+      FixedCodec<bool>::Store(out + 4, data.UseBinaryEncoding);
+      FixedCodec<int32_t>::Store(out + 5, data.MaxStringLength);
+      FixedCodec<int32_t>::Store(out + 9, data.MaxByteStringLength);
+      FixedCodec<int32_t>::Store(out + 13, data.MaxArrayLength);
+      FixedCodec<int32_t>::Store(out + 17, data.MaxMessageSize);
+      FixedCodec<int32_t>::Store(out + 21, data.MaxBufferSize);
+      FixedCodec<int32_t>::Store(out + 25, data.ChannelLifetime);
+      FixedCodec<int32_t>::Store(out + 29, data.SecurityTokenLifetime);
+    }
+
+    static void Load(const char* in, OpcUa::EndpointConfiguration& data)
+    {
+      FixedCodec<int32_t>::Load(in + 0, data.OperationTimeout);
+      FixedCodec<bool>::Load(in + 4, data.UseBinaryEncoding);
+      FixedCodec<int32_t>::Load(in + 5, data.MaxStringLength);
+      FixedCodec<int32_t>::Load(in + 9, data.MaxByteStringLength);
+      FixedCodec<int32_t>::Load(in + 13, data.MaxArrayLength);
+      FixedCodec<int32_t>::Load(in + 17, data.MaxMessageSize);
+      FixedCodec<int32_t>::Load(in + 21, data.MaxBufferSize);
+      FixedCodec<int32_t>::Load(in + 25, data.ChannelLifetime);
+      FixedCodec<int32_t>::Load(in + 29, data.SecurityTokenLifetime);
+    }
+
+    static const std::size_t Size = 33;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::CreateSubscriptionParameters>
+  {
+    static void Store(char* out, const OpcUa::CreateSubscriptionParameters& data)
+    {
+      FixedCodec<double>::Store(out + 0, data.RequestedPublishingInterval);
+      FixedCodec<uint32_t>::Store(out + 8, data.RequestedLifetimeCount);
+      FixedCodec<uint32_t>::Store(out + 12, data.RequestedMaxKeepAliveCount);
+      FixedCodec<uint32_t>::Store(out + 16, data.MaxNotificationsPerPublish);
+      FixedCodec<bool>::Store(out + 20, data.PublishingEnabled);
+      FixedCodec<uint8_t>::Store(out + 21, data.Priority);
+    }
+
+    static void Load(const char* in, OpcUa::CreateSubscriptionParameters& data)
+    {
+      FixedCodec<double>::Load(in + 0, data.RequestedPublishingInterval);
+      FixedCodec<uint32_t>::Load(in + 8, data.RequestedLifetimeCount);
+      FixedCodec<uint32_t>::Load(in + 12, data.RequestedMaxKeepAliveCount);
+      FixedCodec<uint32_t>::Load(in + 16, data.MaxNotificationsPerPublish);
+      FixedCodec<bool>::Load(in + 20, data.PublishingEnabled);
+      FixedCodec<uint8_t>::Load(in + 21, data.Priority);
+    }
+
+    static const std::size_t Size = 22;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::SubscriptionData>
+  {
+    static void Store(char* out, const OpcUa::SubscriptionData& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.SubscriptionId);
+      FixedCodec<double>::Store(out + 4, data.RevisedPublishingInterval);
+      FixedCodec<uint32_t>::Store(out + 12, data.RevisedLifetimeCount);
+      FixedCodec<uint32_t>::Store(out + 16, data.RevisedMaxKeepAliveCount);
+    }
+
+    static void Load(const char* in, OpcUa::SubscriptionData& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.SubscriptionId);
+      FixedCodec<double>::Load(in + 4, data.RevisedPublishingInterval);
+      FixedCodec<uint32_t>::Load(in + 12, data.RevisedLifetimeCount);
+      FixedCodec<uint32_t>::Load(in + 16, data.RevisedMaxKeepAliveCount);
+    }
+
+    static const std::size_t Size = 20;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::ModifySubscriptionParameters>
+  {
+    static void Store(char* out, const OpcUa::ModifySubscriptionParameters& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.SubscriptionId);
+      FixedCodec<double>::Store(out + 4, data.RequestedPublishingInterval);
+      FixedCodec<uint32_t>::Store(out + 12, data.RequestedLifetimeCount);
+      FixedCodec<uint32_t>::Store(out + 16, data.RequestedMaxKeepAliveCount);
+      FixedCodec<uint32_t>::Store(out + 20, data.MaxNotificationsPerPublish);
+      FixedCodec<uint8_t>::Store(out + 24, data.Priority);
+    }
+
+    static void Load(const char* in, OpcUa::ModifySubscriptionParameters& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.SubscriptionId);
+      FixedCodec<double>::Load(in + 4, data.RequestedPublishingInterval);
+      FixedCodec<uint32_t>::Load(in + 12, data.RequestedLifetimeCount);
+      FixedCodec<uint32_t>::Load(in + 16, data.RequestedMaxKeepAliveCount);
+      FixedCodec<uint32_t>::Load(in + 20, data.MaxNotificationsPerPublish);
+      FixedCodec<uint8_t>::Load(in + 24, data.Priority);
+    }
+
+    static const std::size_t Size = 25;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::ModifySubscriptionResult>
+  {
+    static void Store(char* out, const OpcUa::ModifySubscriptionResult& data)
+    {
+      FixedCodec<double>::Store(out + 0, data.RevisedPublishingInterval);
+      FixedCodec<uint32_t>::Store(out + 8, data.RevisedLifetimeCount);
+      FixedCodec<uint32_t>::Store(out + 12, data.RevisedMaxKeepAliveCount);
+    }
+
+    static void Load(const char* in, OpcUa::ModifySubscriptionResult& data)
+    {
+      FixedCodec<double>::Load(in + 0, data.RevisedPublishingInterval);
+      FixedCodec<uint32_t>::Load(in + 8, data.RevisedLifetimeCount);
+      FixedCodec<uint32_t>::Load(in + 12, data.RevisedMaxKeepAliveCount);
+    }
+
+    static const std::size_t Size = 16;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::SubscriptionAcknowledgement>
+  {
+    static void Store(char* out, const OpcUa::SubscriptionAcknowledgement& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.SubscriptionId);
+      FixedCodec<uint32_t>::Store(out + 4, data.SequenceNumber);
+    }
+
+    static void Load(const char* in, OpcUa::SubscriptionAcknowledgement& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.SubscriptionId);
+      FixedCodec<uint32_t>::Load(in + 4, data.SequenceNumber);
+    }
+
+    static const std::size_t Size = 8;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::RepublishParameters>
+  {
+    static void Store(char* out, const OpcUa::RepublishParameters& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.SubscriptionId);
+      FixedCodec<uint32_t>::Store(out + 4, data.RetransmitSequenceNumber);
+    }
+
+    static void Load(const char* in, OpcUa::RepublishParameters& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.SubscriptionId);
+      FixedCodec<uint32_t>::Load(in + 4, data.RetransmitSequenceNumber);
+    }
+
+    static const std::size_t Size = 8;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::SamplingIntervalDiagnosticsDataType>
+  {
+    static void Store(char* out, const OpcUa::SamplingIntervalDiagnosticsDataType& data)
+    {
+      FixedCodec<double>::Store(out + 0, data.SamplingInterval);
+      FixedCodec<uint32_t>::Store(out + 8, data.MonitoredItemCount);
+      FixedCodec<uint32_t>::Store(out + 12, data.MaxMonitoredItemCount);
+      FixedCodec<uint32_t>::Store(out + 16, data.DisabledMonitoredItemCount);
+    }
+
+    static void Load(const char* in, OpcUa::SamplingIntervalDiagnosticsDataType& data)
+    {
+      FixedCodec<double>::Load(in + 0, data.SamplingInterval);
+      FixedCodec<uint32_t>::Load(in + 8, data.MonitoredItemCount);
+      FixedCodec<uint32_t>::Load(in + 12, data.MaxMonitoredItemCount);
+      FixedCodec<uint32_t>::Load(in + 16, data.DisabledMonitoredItemCount);
+    }
+
+    static const std::size_t Size = 20;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::ServerDiagnosticsSummaryDataType>
+  {
+    static void Store(char* out, const OpcUa::ServerDiagnosticsSummaryDataType& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.ServerViewCount);
+      FixedCodec<uint32_t>::Store(out + 4, data.CurrentSessionCount);
+      FixedCodec<uint32_t>::Store(out + 8, data.CumulatedSessionCount);
+      FixedCodec<uint32_t>::Store(out + 12, data.SecurityRejectedSessionCount);
+      FixedCodec<uint32_t>::Store(out + 16, data.RejectedSessionCount);
+      FixedCodec<uint32_t>::Store(out + 20, data.SessionTimeoutCount);
+      FixedCodec<uint32_t>::Store(out + 24, data.SessionAbortCount);
+      FixedCodec<uint32_t>::Store(out + 28, data.CurrentSubscriptionCount);
+      FixedCodec<uint32_t>::Store(out + 32, data.CumulatedSubscriptionCount);
+      FixedCodec<uint32_t>::Store(out + 36, data.PublishingIntervalCount);
+      FixedCodec<uint32_t>::Store(out + 40, data.SecurityRejectedRequestsCount);
+      FixedCodec<uint32_t>::Store(out + 44, data.RejectedRequestsCount);
+    }
+
+    static void Load(const char* in, OpcUa::ServerDiagnosticsSummaryDataType& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.ServerViewCount);
+      FixedCodec<uint32_t>::Load(in + 4, data.CurrentSessionCount);
+      FixedCodec<uint32_t>::Load(in + 8, data.CumulatedSessionCount);
+      FixedCodec<uint32_t>::Load(in + 12, data.SecurityRejectedSessionCount);
+      FixedCodec<uint32_t>::Load(in + 16, data.RejectedSessionCount);
+      FixedCodec<uint32_t>::Load(in + 20, data.SessionTimeoutCount);
+      FixedCodec<uint32_t>::Load(in + 24, data.SessionAbortCount);
+      FixedCodec<uint32_t>::Load(in + 28, data.CurrentSubscriptionCount);
+      FixedCodec<uint32_t>::Load(in + 32, data.CumulatedSubscriptionCount);
+      FixedCodec<uint32_t>::Load(in + 36, data.PublishingIntervalCount);
+      FixedCodec<uint32_t>::Load(in + 40, data.SecurityRejectedRequestsCount);
+      FixedCodec<uint32_t>::Load(in + 44, data.RejectedRequestsCount);
+    }
+
+    static const std::size_t Size = 48;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::ServiceCounterDataType>
+  {
+    static void Store(char* out, const OpcUa::ServiceCounterDataType& data)
+    {
+      FixedCodec<uint32_t>::Store(out + 0, data.TotalCount);
+      FixedCodec<uint32_t>::Store(out + 4, data.ErrorCount);
+    }
+
+    static void Load(const char* in, OpcUa::ServiceCounterDataType& data)
+    {
+      FixedCodec<uint32_t>::Load(in + 0, data.TotalCount);
+      FixedCodec<uint32_t>::Load(in + 4, data.ErrorCount);
+    }
+
+    static const std::size_t Size = 8;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::Range>
+  {
+    static void Store(char* out, const OpcUa::Range& data)
+    {
+      FixedCodec<double>::Store(out + 0, data.Low);
+      FixedCodec<double>::Store(out + 8, data.High);
+    }
+
+    static void Load(const char* in, OpcUa::Range& data)
+    {
+      FixedCodec<double>::Load(in + 0, data.Low);
+      FixedCodec<double>::Load(in + 8, data.High);
+    }
+
+    static const std::size_t Size = 16;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::ComplexNumberType>
+  {
+    static void Store(char* out, const OpcUa::ComplexNumberType& data)
+    {
+      FixedCodec<float>::Store(out + 0, data.Real);
+      FixedCodec<float>::Store(out + 4, data.Imaginary);
+    }
+
+    static void Load(const char* in, OpcUa::ComplexNumberType& data)
+    {
+      FixedCodec<float>::Load(in + 0, data.Real);
+      FixedCodec<float>::Load(in + 4, data.Imaginary);
+    }
+
+    static const std::size_t Size = 8;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::DoubleComplexNumberType>
+  {
+    static void Store(char* out, const OpcUa::DoubleComplexNumberType& data)
+    {
+      FixedCodec<double>::Store(out + 0, data.Real);
+      FixedCodec<double>::Store(out + 8, data.Imaginary);
+    }
+
+    static void Load(const char* in, OpcUa::DoubleComplexNumberType& data)
+    {
+      FixedCodec<double>::Load(in + 0, data.Real);
+      FixedCodec<double>::Load(in + 8, data.Imaginary);
+    }
+
+    static const std::size_t Size = 16;
+  };
+
+  template <>
+  struct FixedCodec<OpcUa::XVType>
+  {
+    static void Store(char* out, const OpcUa::XVType& data)
+    {
+      FixedCodec<double>::Store(out + 0, data.X);
+      FixedCodec<float>::Store(out + 8, data.Value);
+    }
+
+    static void Load(const char* in, OpcUa::XVType& data)
+    {
+      FixedCodec<double>::Load(in + 0, data.X);
+      FixedCodec<float>::Load(in + 8, data.Value);
+    }
+
+    static const std::size_t Size = 12;
+  };
+
+} // namespace
+    
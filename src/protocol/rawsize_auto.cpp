@@ -17,6 +17,8 @@
 
 #include <opc/ua/protocol/binary/stream.h>
 
+#include "fixed_size_auto.h"
+
 namespace OpcUa
 {
     namespace Binary
@@ -195,7 +197,7 @@ namespace OpcUa
     {
         size_t size = 0;
         size += RawSize(data.Length);
-        size += RawSizeContainer(data.Value);
+        size += RawSizeFixedContainer(data.Value);
         return size;
     }
 
@@ -217,9 +219,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<FourByteNodeId>(const FourByteNodeId& data)
     {
-        size_t size = 0;
-        size += RawSize(data.NamespaceIndex);
-        size += RawSize(data.Identifier);
+        size_t size = 3;
         return size;
     }
 
@@ -230,9 +230,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<NumericNodeId>(const NumericNodeId& data)
     {
-        size_t size = 0;
-        size += RawSize(data.NamespaceIndex);
-        size += RawSize(data.Identifier);
+        size_t size = 6;
         return size;
     }
 
@@ -379,25 +377,25 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.Encoding);
         if ((data.Encoding) & (1<<(7))) size += RawSize(data.ArrayLength);
-        if ((data.VariantType) & (1<<(1))) size += RawSizeContainer(data.Boolean);
-        if ((data.VariantType) & (1<<(2))) size += RawSizeContainer(data.SByte);
-        if ((data.VariantType) & (1<<(3))) size += RawSizeContainer(data.Byte);
-        if ((data.VariantType) & (1<<(4))) size += RawSizeContainer(data.Int16);
-        if ((data.VariantType) & (1<<(5))) size += RawSizeContainer(data.UInt16);
-        if ((data.VariantType) & (1<<(6))) size += RawSizeContainer(data.Int32);
-        if ((data.VariantType) & (1<<(7))) size += RawSizeContainer(data.UInt32);
-        if ((data.VariantType) & (1<<(8))) size += RawSizeContainer(data.Int64);
-        if ((data.VariantType) & (1<<(9))) size += RawSizeContainer(data.UInt64);
-        if ((data.VariantType) & (1<<(10))) size += RawSizeContainer(data.Float);
-        if ((data.VariantType) & (1<<(11))) size += RawSizeContainer(data.Double);
+        if ((data.VariantType) & (1<<(1))) size += RawSizeFixedContainer(data.Boolean);
+        if ((data.VariantType) & (1<<(2))) size += RawSizeFixedContainer(data.SByte);
+        if ((data.VariantType) & (1<<(3))) size += RawSizeFixedContainer(data.Byte);
+        if ((data.VariantType) & (1<<(4))) size += RawSizeFixedContainer(data.Int16);
+        if ((data.VariantType) & (1<<(5))) size += RawSizeFixedContainer(data.UInt16);
+        if ((data.VariantType) & (1<<(6))) size += RawSizeFixedContainer(data.Int32);
+        if ((data.VariantType) & (1<<(7))) size += RawSizeFixedContainer(data.UInt32);
+        if ((data.VariantType) & (1<<(8))) size += RawSizeFixedContainer(data.Int64);
+        if ((data.VariantType) & (1<<(9))) size += RawSizeFixedContainer(data.UInt64);
+        if ((data.VariantType) & (1<<(10))) size += RawSizeFixedContainer(data.Float);
+        if ((data.VariantType) & (1<<(11))) size += RawSizeFixedContainer(data.Double);
         if ((data.VariantType) & (1<<(12))) size += RawSizeContainer(data.String);
-        if ((data.VariantType) & (1<<(13))) size += RawSizeContainer(data.DateTime);
+        if ((data.VariantType) & (1<<(13))) size += RawSizeFixedContainer(data.DateTime);
         if ((data.VariantType) & (1<<(14))) size += RawSizeContainer(data.Guid);
         if ((data.VariantType) & (1<<(15))) size += RawSizeContainer(data.ByteString);
         if ((data.VariantType) & (1<<(16))) size += RawSizeContainer(data.XmlElement);
         if ((data.VariantType) & (1<<(17))) size += RawSizeContainer(data.NodeId);
         if ((data.VariantType) & (1<<(18))) size += RawSizeContainer(data.ExpandedNodeId);
-        if ((data.VariantType) & (1<<(19))) size += RawSizeContainer(data.Status);
+        if ((data.VariantType) & (1<<(19))) size += RawSizeFixedContainer(data.Status);
         if ((data.VariantType) & (1<<(20))) size += RawSizeContainer(data.DiagnosticInfo);
         if ((data.VariantType) & (1<<(21))) size += RawSizeContainer(data.QualifiedName);
         if ((data.VariantType) & (1<<(22))) size += RawSizeContainer(data.LocalizedText);
@@ -427,8 +425,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<ReferenceNode>(const ReferenceNode& data)
     {
@@ -439,241 +435,176 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<Node>(const Node& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         return size;
     }
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<InstanceNode>(const InstanceNode& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TypeNode>(const TypeNode& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ObjectNode>(const ObjectNode& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         size += RawSize(data.EventNotifier);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ObjectTypeNode>(const ObjectTypeNode& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         size += RawSize(data.IsAbstract);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<VariableNode>(const VariableNode& data)
     {
-        size_t size = 0;
+        size_t size = 19;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         size += RawSize(data.Value);
         size += RawSize(data.DataType);
         size += RawSize(data.ValueRank);
-        size += RawSizeContainer(data.ArrayDimensions);
-        size += RawSize(data.AccessLevel);
-        size += RawSize(data.UserAccessLevel);
-        size += RawSize(data.MinimumSamplingInterval);
-        size += RawSize(data.Historizing);
+        size += RawSizeFixedContainer(data.ArrayDimensions);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<VariableTypeNode>(const VariableTypeNode& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         size += RawSize(data.Value);
         size += RawSize(data.DataType);
         size += RawSize(data.ValueRank);
-        size += RawSizeContainer(data.ArrayDimensions);
+        size += RawSizeFixedContainer(data.ArrayDimensions);
         size += RawSize(data.IsAbstract);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ReferenceTypeNode>(const ReferenceTypeNode& data)
     {
-        size_t size = 0;
+        size_t size = 10;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
-        size += RawSize(data.IsAbstract);
-        size += RawSize(data.Symmetric);
         size += RawSize(data.InverseName);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<MethodNode>(const MethodNode& data)
     {
-        size_t size = 0;
+        size_t size = 10;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
-        size += RawSize(data.Executable);
-        size += RawSize(data.UserExecutable);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ViewNode>(const ViewNode& data)
     {
-        size_t size = 0;
+        size_t size = 10;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
-        size += RawSize(data.ContainsNoLoops);
-        size += RawSize(data.EventNotifier);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DataTypeNode>(const DataTypeNode& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.NodeId);
         size += RawSize(data.NodeClass);
         size += RawSize(data.BrowseName);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSizeContainer(data.References);
         size += RawSize(data.IsAbstract);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<Argument>(const Argument& data)
@@ -682,14 +613,11 @@ namespace OpcUa
         size += RawSize(data.Name);
         size += RawSize(data.DataType);
         size += RawSize(data.ValueRank);
-        size += RawSizeContainer(data.ArrayDimensions);
+        size += RawSizeFixedContainer(data.ArrayDimensions);
         size += RawSize(data.Description);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<EnumValueType>(const EnumValueType& data)
@@ -701,20 +629,13 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TimeZoneDataType>(const TimeZoneDataType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Offset);
-        size += RawSize(data.DaylightSavingInOffset);
-        return size;
+        return FixedCodec<TimeZoneDataType>::Size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<ApplicationDescription>(const ApplicationDescription& data)
@@ -736,11 +657,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<RequestHeader>(const RequestHeader& data)
     {
-        size_t size = 0;
+        size_t size = 16;
         size += RawSize(data.AuthenticationToken);
-        size += RawSize(data.Timestamp);
-        size += RawSize(data.RequestHandle);
-        size += RawSize(data.ReturnDiagnostics);
         size += RawSize(data.AuditEntryId);
         size += RawSize(data.TimeoutHint);
         size += RawSize(data.AdditionalHeader);
@@ -754,10 +672,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ResponseHeader>(const ResponseHeader& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Timestamp);
-        size += RawSize(data.RequestHandle);
-        size += RawSize(data.ServiceResult);
+        size_t size = 16;
         size += RawSize(data.ServiceDiagnostics);
         size += RawSizeContainer(data.StringTable);
         size += RawSize(data.AdditionalHeader);
@@ -766,8 +681,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<ServiceFault>(const ServiceFault& data)
     {
@@ -777,7 +690,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -807,8 +719,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<FindServersResult>(const FindServersResult& data)
     {
@@ -817,7 +727,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -895,8 +804,6 @@ namespace OpcUa
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<RegisteredServer>(const RegisteredServer& data)
     {
@@ -912,9 +819,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<RegisterServerParameters>(const RegisterServerParameters& data)
@@ -924,9 +828,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<RegisterServerRequest>(const RegisterServerRequest& data)
@@ -938,9 +839,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<RegisterServerResponse>(const RegisterServerResponse& data)
@@ -951,32 +849,20 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ChannelSecurityToken>(const ChannelSecurityToken& data)
     {
-        size_t size = 0;
-        size += RawSize(data.ChannelId);
-        size += RawSize(data.TokenId);
-        size += RawSize(data.CreatedAt);
-        size += RawSize(data.RevisedLifetime);
-        return size;
+        return FixedCodec<ChannelSecurityToken>::Size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<OpenSecureChannelParameters>(const OpenSecureChannelParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.ClientProtocolVersion);
-        size += RawSize(data.RequestType);
-        size += RawSize(data.SecurityMode);
+        size_t size = 12;
         size += RawSize(data.ClientNonce);
         size += RawSize(data.RequestedLifetime);
         return size;
@@ -998,19 +884,14 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<OpenSecureChannelResult>(const OpenSecureChannelResult& data)
     {
-        size_t size = 0;
-        size += RawSize(data.ServerProtocolVersion);
-        size += RawSize(data.SecurityToken);
+        size_t size = 24;
         size += RawSize(data.ServerNonce);
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -1039,8 +920,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<CloseSecureChannelResponse>(const CloseSecureChannelResponse& data)
     {
@@ -1050,7 +929,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<SignedSoftwareCertificate>(const SignedSoftwareCertificate& data)
@@ -1075,15 +953,13 @@ namespace OpcUa
     template<>
     std::size_t RawSize<CreateSessionParameters>(const CreateSessionParameters& data)
     {
-        size_t size = 0;
+        size_t size = 12;
         size += RawSize(data.ClientDescription);
         size += RawSize(data.ServerUri);
         size += RawSize(data.EndpointUrl);
         size += RawSize(data.SessionName);
         size += RawSize(data.ClientNonce);
         size += RawSize(data.ClientCertificate);
-        size += RawSize(data.RequestedSessionTimeout);
-        size += RawSize(data.MaxResponseMessageSize);
         return size;
     }
 
@@ -1127,45 +1003,31 @@ namespace OpcUa
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<UserIdentityToken>(const UserIdentityToken& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.PolicyId);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<AnonymousIdentityToken>(const AnonymousIdentityToken& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.PolicyId);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<UserNameIdentityToken>(const UserNameIdentityToken& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.PolicyId);
         size += RawSize(data.UserName);
         size += RawSize(data.Password);
@@ -1173,40 +1035,29 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<X509IdentityToken>(const X509IdentityToken& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.PolicyId);
         size += RawSize(data.CertificateData);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<IssuedIdentityToken>(const IssuedIdentityToken& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.PolicyId);
         size += RawSize(data.TokenData);
         size += RawSize(data.EncryptionAlgorithm);
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<ActivateSessionParameters>(const ActivateSessionParameters& data)
@@ -1237,7 +1088,7 @@ namespace OpcUa
     {
         size_t size = 0;
         size += RawSize(data.ServerNonce);
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
@@ -1281,19 +1132,12 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<CancelParameters>(const CancelParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.RequestHandle);
-        return size;
+        return FixedCodec<CancelParameters>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<CancelRequest>(const CancelRequest& data)
@@ -1305,21 +1149,13 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<CancelResult>(const CancelResult& data)
     {
-        size_t size = 0;
-        size += RawSize(data.CancelCount);
-        return size;
+        return FixedCodec<CancelResult>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<CancelResponse>(const CancelResponse& data)
@@ -1331,22 +1167,16 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<NodeAttributes>(const NodeAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 17;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         return size;
     }
 
@@ -1357,16 +1187,10 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ObjectAttributes>(const ObjectAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 18;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
-        size += RawSize(data.EventNotifier);
         return size;
     }
 
@@ -1377,23 +1201,14 @@ namespace OpcUa
     template<>
     std::size_t RawSize<VariableAttributes>(const VariableAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 28;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSize(data.Value);
         size += RawSize(data.DataType);
         size += RawSize(data.ValueRank);
-        size += RawSizeContainer(data.ArrayDimensions);
-        size += RawSize(data.AccessLevel);
-        size += RawSize(data.UserAccessLevel);
-        size += RawSize(data.MinimumSamplingInterval);
-        size += RawSize(data.Historizing);
+        size += RawSizeFixedContainer(data.ArrayDimensions);
         return size;
     }
 
@@ -1404,17 +1219,10 @@ namespace OpcUa
     template<>
     std::size_t RawSize<MethodAttributes>(const MethodAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 19;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
-        size += RawSize(data.Executable);
-        size += RawSize(data.UserExecutable);
         return size;
     }
 
@@ -1425,16 +1233,10 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ObjectTypeAttributes>(const ObjectTypeAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 18;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
-        size += RawSize(data.IsAbstract);
         return size;
     }
 
@@ -1445,19 +1247,14 @@ namespace OpcUa
     template<>
     std::size_t RawSize<VariableTypeAttributes>(const VariableTypeAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 17;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
         size += RawSize(data.Value);
         size += RawSize(data.DataType);
         size += RawSize(data.ValueRank);
-        size += RawSizeContainer(data.ArrayDimensions);
+        size += RawSizeFixedContainer(data.ArrayDimensions);
         size += RawSize(data.IsAbstract);
         return size;
     }
@@ -1469,17 +1266,10 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ReferenceTypeAttributes>(const ReferenceTypeAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 19;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
-        size += RawSize(data.IsAbstract);
-        size += RawSize(data.Symmetric);
         size += RawSize(data.InverseName);
         return size;
     }
@@ -1491,16 +1281,10 @@ namespace OpcUa
     template<>
     std::size_t RawSize<DataTypeAttributes>(const DataTypeAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 18;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
-        size += RawSize(data.IsAbstract);
         return size;
     }
 
@@ -1511,17 +1295,10 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ViewAttributes>(const ViewAttributes& data)
     {
-        size_t size = 0;
+        size_t size = 19;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.SpecifiedAttributes);
         size += RawSize(data.DisplayName);
         size += RawSize(data.Description);
-        size += RawSize(data.WriteMask);
-        size += RawSize(data.UserWriteMask);
-        size += RawSize(data.ContainsNoLoops);
-        size += RawSize(data.EventNotifier);
         return size;
     }
 
@@ -1638,7 +1415,7 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.TypeId);
         size += RawSize(data.Header);
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
@@ -1672,14 +1449,12 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.TypeId);
         size += RawSize(data.Header);
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<DeleteReferencesItem>(const DeleteReferencesItem& data)
     {
@@ -1692,9 +1467,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DeleteReferencesParameters>(const DeleteReferencesParameters& data)
@@ -1704,9 +1476,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DeleteReferencesRequest>(const DeleteReferencesRequest& data)
@@ -1718,22 +1487,16 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DeleteReferencesResult>(const DeleteReferencesResult& data)
     {
         size_t size = 0;
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DeleteReferencesResponse>(const DeleteReferencesResponse& data)
@@ -1745,17 +1508,14 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<ViewDescription>(const ViewDescription& data)
     {
-        size_t size = 0;
+        size_t size = 12;
         size += RawSize(data.ViewId);
-        size += RawSize(data.Timestamp);
-        size += RawSize(data.ViewVersion);
         return size;
     }
 
@@ -1766,13 +1526,10 @@ namespace OpcUa
     template<>
     std::size_t RawSize<BrowseDescription>(const BrowseDescription& data)
     {
-        size_t size = 0;
+        size_t size = 9;
         size += RawSize(data.NodeId);
         size += RawSize(data.BrowseDirection);
         size += RawSize(data.ReferenceTypeId);
-        size += RawSize(data.IncludeSubtypes);
-        size += RawSize(data.NodeClassMask);
-        size += RawSize(data.ResultMask);
         return size;
     }
 
@@ -1853,8 +1610,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<BrowseNextParameters>(const BrowseNextParameters& data)
     {
@@ -1864,7 +1619,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -1912,10 +1666,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<RelativePathElement>(const RelativePathElement& data)
     {
-        size_t size = 0;
+        size_t size = 2;
         size += RawSize(data.ReferenceTypeId);
-        size += RawSize(data.IsInverse);
-        size += RawSize(data.IncludeSubtypes);
         size += RawSize(data.TargetName);
         return size;
     }
@@ -2014,8 +1766,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<RegisterNodesParameters>(const RegisterNodesParameters& data)
     {
@@ -2024,7 +1774,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -2040,8 +1789,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<RegisterNodesResult>(const RegisterNodesResult& data)
     {
@@ -2050,7 +1797,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -2066,8 +1812,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<UnregisterNodesParameters>(const UnregisterNodesParameters& data)
     {
@@ -2076,7 +1820,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -2105,44 +1848,24 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<EndpointConfiguration>(const EndpointConfiguration& data)
     {
-        size_t size = 0;
-        size += RawSize(data.OperationTimeout);
-        size += RawSize(data.UseBinaryEncoding);
-        size += RawSize(data.MaxStringLength);
-        size += RawSize(data.MaxByteStringLength);
-        size += RawSize(data.MaxArrayLength);
-        size += RawSize(data.MaxMessageSize);
-        size += RawSize(data.MaxBufferSize);
-        size += RawSize(data.ChannelLifetime);
-        size += RawSize(data.SecurityTokenLifetime);
-        return size;
+        return FixedCodec<EndpointConfiguration>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SupportedProfile>(const SupportedProfile& data)
     {
-        size_t size = 0;
+        size_t size = 12;
         size += RawSize(data.OrganizationUri);
         size += RawSize(data.ProfileId);
         size += RawSize(data.ComplianceTool);
-        size += RawSize(data.ComplianceDate);
-        size += RawSize(data.ComplianceLevel);
         size += RawSizeContainer(data.UnsupportedUnitIds);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SoftwareCertificate>(const SoftwareCertificate& data)
@@ -2161,9 +1884,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<QueryDataDescription>(const QueryDataDescription& data)
@@ -2175,9 +1895,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<NodeTypeDescription>(const NodeTypeDescription& data)
@@ -2189,9 +1906,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<QueryDataSet>(const QueryDataSet& data)
@@ -2203,9 +1917,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<NodeReference>(const NodeReference& data)
@@ -2218,7 +1929,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
@@ -2264,11 +1974,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ElementOperand>(const ElementOperand& data)
     {
-        size_t size = 0;
+        size_t size = 9;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.Index);
         return size;
     }
 
@@ -2279,10 +1986,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<LiteralOperand>(const LiteralOperand& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.Value);
         return size;
     }
@@ -2294,10 +1999,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<AttributeOperand>(const AttributeOperand& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.NodeId);
         size += RawSize(data.Alias);
         size += RawSize(data.BrowsePath);
@@ -2313,10 +2016,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<SimpleAttributeOperand>(const SimpleAttributeOperand& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSize(data.TypeDefinitionId);
         size += RawSizeContainer(data.BrowsePath);
         size += RawSize(data.AttributeId);
@@ -2326,21 +2027,16 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<ContentFilterElementResult>(const ContentFilterElementResult& data)
     {
         size_t size = 0;
         size += RawSize(data.Status);
-        size += RawSizeContainer(data.OperandStatusCodes);
+        size += RawSizeFixedContainer(data.OperandStatusCodes);
         size += RawSizeContainer(data.OperandDiagnosticInfos);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ContentFilterResult>(const ContentFilterResult& data)
@@ -2351,33 +2047,27 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ParsingResult>(const ParsingResult& data)
     {
         size_t size = 0;
         size += RawSize(data.Status);
-        size += RawSizeContainer(data.DataStatusCodes);
+        size += RawSizeFixedContainer(data.DataStatusCodes);
         size += RawSizeContainer(data.DataDiagnosticInfos);
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<QueryFirstParameters>(const QueryFirstParameters& data)
     {
-        size_t size = 0;
+        size_t size = 8;
         size += RawSize(data.View);
         size += RawSizeContainer(data.NodeTypes);
         size += RawSize(data.Filter);
-        size += RawSize(data.MaxDataSetsToReturn);
-        size += RawSize(data.MaxReferencesToReturn);
         return size;
     }
 
@@ -2397,8 +2087,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<QueryFirstResult>(const QueryFirstResult& data)
     {
@@ -2411,9 +2099,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<QueryFirstResponse>(const QueryFirstResponse& data)
@@ -2425,9 +2110,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<QueryNextParameters>(const QueryNextParameters& data)
@@ -2438,9 +2120,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<QueryNextRequest>(const QueryNextRequest& data)
@@ -2452,9 +2131,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<QueryNextResult>(const QueryNextResult& data)
@@ -2465,9 +2141,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<QueryNextResponse>(const QueryNextResponse& data)
@@ -2479,7 +2152,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<ReadValueId>(const ReadValueId& data)
@@ -2496,9 +2168,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ReadParameters>(const ReadParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.MaxAge);
-        size += RawSize(data.TimestampsToReturn);
+        size_t size = 12;
         size += RawSizeContainer(data.AttributesToRead);
         return size;
     }
@@ -2575,15 +2245,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ReadRawModifiedDetails>(const ReadRawModifiedDetails& data)
     {
-        size_t size = 0;
+        size_t size = 27;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.IsReadModified);
-        size += RawSize(data.StartTime);
-        size += RawSize(data.EndTime);
-        size += RawSize(data.NumValuesPerNode);
-        size += RawSize(data.ReturnBounds);
         return size;
     }
 
@@ -2594,19 +2257,15 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ReadAtTimeDetails>(const ReadAtTimeDetails& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSizeContainer(data.ReqTimes);
+        size += RawSizeFixedContainer(data.ReqTimes);
         size += RawSize(data.UseSimpleBounds);
         return size;
     }
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<HistoryData>(const HistoryData& data)
     {
@@ -2615,16 +2274,13 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<ModificationInfo>(const ModificationInfo& data)
     {
-        size_t size = 0;
-        size += RawSize(data.ModificationTime);
-        size += RawSize(data.UpdateType);
+        size_t size = 12;
         size += RawSize(data.UserName);
         return size;
     }
@@ -2649,10 +2305,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<HistoryReadParameters>(const HistoryReadParameters& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.HistoryReadDetails);
-        size += RawSize(data.TimestampsToReturn);
-        size += RawSize(data.ReleaseContinuationPoints);
         size += RawSizeContainer(data.AttributesToRead);
         return size;
     }
@@ -2726,14 +2380,12 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.TypeId);
         size += RawSize(data.Header);
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<HistoryUpdateDetails>(const HistoryUpdateDetails& data)
     {
@@ -2742,9 +2394,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<UpdateDataDetails>(const UpdateDataDetails& data)
@@ -2756,9 +2405,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<UpdateStructureDataDetails>(const UpdateStructureDataDetails& data)
@@ -2770,37 +2416,25 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DeleteRawModifiedDetails>(const DeleteRawModifiedDetails& data)
     {
-        size_t size = 0;
+        size_t size = 17;
         size += RawSize(data.NodeId);
-        size += RawSize(data.IsDeleteModified);
-        size += RawSize(data.StartTime);
-        size += RawSize(data.EndTime);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DeleteAtTimeDetails>(const DeleteAtTimeDetails& data)
     {
         size_t size = 0;
         size += RawSize(data.NodeId);
-        size += RawSizeContainer(data.ReqTimes);
+        size += RawSizeFixedContainer(data.ReqTimes);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DeleteEventDetails>(const DeleteEventDetails& data)
@@ -2811,23 +2445,17 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<HistoryUpdateResult>(const HistoryUpdateResult& data)
     {
         size_t size = 0;
         size += RawSize(data.Status);
-        size += RawSizeContainer(data.OperationResults);
+        size += RawSizeFixedContainer(data.OperationResults);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<HistoryUpdateParameters>(const HistoryUpdateParameters& data)
@@ -2837,9 +2465,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<HistoryUpdateRequest>(const HistoryUpdateRequest& data)
@@ -2851,9 +2476,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<HistoryUpdateResponse>(const HistoryUpdateResponse& data)
@@ -2866,7 +2488,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<CallMethodRequest>(const CallMethodRequest& data)
@@ -2884,7 +2505,7 @@ namespace OpcUa
     {
         size_t size = 0;
         size += RawSize(data.Status);
-        size += RawSizeContainer(data.InputArgumentResults);
+        size += RawSizeFixedContainer(data.InputArgumentResults);
         size += RawSizeContainer(data.InputArgumentDiagnosticInfos);
         size += RawSizeContainer(data.OutputArguments);
         return size;
@@ -2942,13 +2563,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<DataChangeFilter>(const DataChangeFilter& data)
     {
-        size_t size = 0;
+        size_t size = 21;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.Trigger);
-        size += RawSize(data.DeadbandType);
-        size += RawSize(data.DeadbandValue);
         return size;
     }
 
@@ -2959,10 +2575,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<EventFilter>(const EventFilter& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSizeContainer(data.SelectClauses);
         size += RawSize(data.WhereClause);
         return size;
@@ -2970,35 +2584,22 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<ReadEventDetails>(const ReadEventDetails& data)
     {
-        size_t size = 0;
+        size_t size = 25;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.NumValuesPerNode);
-        size += RawSize(data.StartTime);
-        size += RawSize(data.EndTime);
         size += RawSize(data.Filter);
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<AggregateConfiguration>(const AggregateConfiguration& data)
     {
-        size_t size = 0;
-        size += RawSize(data.UseServerCapabilitiesDefaults);
-        size += RawSize(data.TreatUncertainAsBad);
-        size += RawSize(data.PercentDataBad);
-        size += RawSize(data.PercentDataGood);
-        size += RawSize(data.UseSlopedExtrapolation);
+        size_t size = 5;
         return size;
     }
 
@@ -3009,13 +2610,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<ReadProcessedDetails>(const ReadProcessedDetails& data)
     {
-        size_t size = 0;
+        size_t size = 29;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.StartTime);
-        size += RawSize(data.EndTime);
-        size += RawSize(data.ProcessingInterval);
         size += RawSizeContainer(data.AggregateType);
         size += RawSize(data.AggregateConfiguration);
         return size;
@@ -3028,11 +2624,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<AggregateFilter>(const AggregateFilter& data)
     {
-        size_t size = 0;
+        size_t size = 13;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.StartTime);
         size += RawSize(data.AggregateType);
         size += RawSize(data.ProcessingInterval);
         size += RawSize(data.AggregateConfiguration);
@@ -3041,8 +2634,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<MonitoringFilterResult>(const MonitoringFilterResult& data)
     {
@@ -3053,26 +2644,18 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<EventFilterResult>(const EventFilterResult& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSizeContainer(data.SelectClauseResults);
+        size += RawSizeFixedContainer(data.SelectClauseResults);
         size += RawSizeContainer(data.SelectClauseDiagnosticInfos);
         size += RawSize(data.WhereClauseResult);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<HistoryUpdateEventResult>(const HistoryUpdateEventResult& data)
@@ -3083,19 +2666,14 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<AggregateFilterResult>(const AggregateFilterResult& data)
     {
-        size_t size = 0;
+        size_t size = 21;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.RevisedStartTime);
-        size += RawSize(data.RevisedProcessingInterval);
         size += RawSize(data.RevisedAggregateConfiguration);
         return size;
     }
@@ -3105,12 +2683,8 @@ namespace OpcUa
     template<>
     std::size_t RawSize<MonitoringParameters>(const MonitoringParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.ClientHandle);
-        size += RawSize(data.SamplingInterval);
+        size_t size = 17;
         size += RawSize(data.Filter);
-        size += RawSize(data.QueueSize);
-        size += RawSize(data.DiscardOldest);
         return size;
     }
 
@@ -3129,11 +2703,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<MonitoredItemCreateResult>(const MonitoredItemCreateResult& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Status);
-        size += RawSize(data.MonitoredItemId);
-        size += RawSize(data.RevisedSamplingInterval);
-        size += RawSize(data.RevisedQueueSize);
+        size_t size = 20;
         size += RawSize(data.FilterResult);
         return size;
     }
@@ -3142,9 +2712,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<MonitoredItemsParameters>(const MonitoredItemsParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.TimestampsToReturn);
+        size_t size = 8;
         size += RawSizeContainer(data.ItemsToCreate);
         return size;
     }
@@ -3173,8 +2741,6 @@ namespace OpcUa
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<MonitoredItemModifyRequest>(const MonitoredItemModifyRequest& data)
     {
@@ -3184,38 +2750,24 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<MonitoredItemModifyResult>(const MonitoredItemModifyResult& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Status);
-        size += RawSize(data.RevisedSamplingInterval);
-        size += RawSize(data.RevisedQueueSize);
+        size_t size = 16;
         size += RawSize(data.FilterResult);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ModifyMonitoredItemsParameters>(const ModifyMonitoredItemsParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.TimestampsToReturn);
+        size_t size = 8;
         size += RawSizeContainer(data.ItemsToModify);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ModifyMonitoredItemsRequest>(const ModifyMonitoredItemsRequest& data)
@@ -3227,9 +2779,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ModifyMonitoredItemsResponse>(const ModifyMonitoredItemsResponse& data)
@@ -3242,23 +2791,15 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetMonitoringModeParameters>(const SetMonitoringModeParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.MonitoringMode);
-        size += RawSizeContainer(data.MonitoredItemIds);
+        size_t size = 8;
+        size += RawSizeFixedContainer(data.MonitoredItemIds);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetMonitoringModeRequest>(const SetMonitoringModeRequest& data)
@@ -3270,22 +2811,16 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetMonitoringModeResult>(const SetMonitoringModeResult& data)
     {
         size_t size = 0;
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetMonitoringModeResponse>(const SetMonitoringModeResponse& data)
@@ -3297,24 +2832,16 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetTriggeringParameters>(const SetTriggeringParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.TriggeringItemId);
-        size += RawSizeContainer(data.LinksToAdd);
-        size += RawSizeContainer(data.LinksToRemove);
+        size_t size = 8;
+        size += RawSizeFixedContainer(data.LinksToAdd);
+        size += RawSizeFixedContainer(data.LinksToRemove);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetTriggeringRequest>(const SetTriggeringRequest& data)
@@ -3326,24 +2853,18 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetTriggeringResult>(const SetTriggeringResult& data)
     {
         size_t size = 0;
-        size += RawSizeContainer(data.AddResults);
+        size += RawSizeFixedContainer(data.AddResults);
         size += RawSizeContainer(data.AddDiagnosticInfos);
-        size += RawSizeContainer(data.RemoveResults);
+        size += RawSizeFixedContainer(data.RemoveResults);
         size += RawSizeContainer(data.RemoveDiagnosticInfos);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SetTriggeringResponse>(const SetTriggeringResponse& data)
@@ -3355,14 +2876,13 @@ namespace OpcUa
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<DeleteMonitoredItemsParameters>(const DeleteMonitoredItemsParameters& data)
     {
         size_t size = 0;
         size += RawSize(data.SubscriptionId);
-        size += RawSizeContainer(data.MonitoredItemIds);
+        size += RawSizeFixedContainer(data.MonitoredItemIds);
         return size;
     }
 
@@ -3384,7 +2904,7 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.TypeId);
         size += RawSize(data.Header);
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
@@ -3393,14 +2913,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<CreateSubscriptionParameters>(const CreateSubscriptionParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.RequestedPublishingInterval);
-        size += RawSize(data.RequestedLifetimeCount);
-        size += RawSize(data.RequestedMaxKeepAliveCount);
-        size += RawSize(data.MaxNotificationsPerPublish);
-        size += RawSize(data.PublishingEnabled);
-        size += RawSize(data.Priority);
-        return size;
+        return FixedCodec<CreateSubscriptionParameters>::Size;
     }
 
 
@@ -3418,12 +2931,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<SubscriptionData>(const SubscriptionData& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.RevisedPublishingInterval);
-        size += RawSize(data.RevisedLifetimeCount);
-        size += RawSize(data.RevisedMaxKeepAliveCount);
-        return size;
+        return FixedCodec<SubscriptionData>::Size;
     }
 
 
@@ -3438,24 +2946,12 @@ namespace OpcUa
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<ModifySubscriptionParameters>(const ModifySubscriptionParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.RequestedPublishingInterval);
-        size += RawSize(data.RequestedLifetimeCount);
-        size += RawSize(data.RequestedMaxKeepAliveCount);
-        size += RawSize(data.MaxNotificationsPerPublish);
-        size += RawSize(data.Priority);
-        return size;
+        return FixedCodec<ModifySubscriptionParameters>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ModifySubscriptionRequest>(const ModifySubscriptionRequest& data)
@@ -3467,23 +2963,13 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ModifySubscriptionResult>(const ModifySubscriptionResult& data)
     {
-        size_t size = 0;
-        size += RawSize(data.RevisedPublishingInterval);
-        size += RawSize(data.RevisedLifetimeCount);
-        size += RawSize(data.RevisedMaxKeepAliveCount);
-        return size;
+        return FixedCodec<ModifySubscriptionResult>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ModifySubscriptionResponse>(const ModifySubscriptionResponse& data)
@@ -3495,14 +2981,13 @@ namespace OpcUa
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<PublishingModeParameters>(const PublishingModeParameters& data)
     {
         size_t size = 0;
         size += RawSize(data.PublishingEnabled);
-        size += RawSizeContainer(data.SubscriptionIds);
+        size += RawSizeFixedContainer(data.SubscriptionIds);
         return size;
     }
 
@@ -3522,7 +3007,7 @@ namespace OpcUa
     std::size_t RawSize<PublishingModeResult>(const PublishingModeResult& data)
     {
         size_t size = 0;
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
@@ -3542,9 +3027,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<NotificationMessage>(const NotificationMessage& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SequenceNumber);
-        size += RawSize(data.PublishTime);
+        size_t size = 12;
         size += RawSizeContainer(data.NotificationData);
         return size;
     }
@@ -3564,8 +3047,6 @@ namespace OpcUa
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<MonitoredItemNotification>(const MonitoredItemNotification& data)
     {
@@ -3575,17 +3056,14 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<DataChangeNotification>(const DataChangeNotification& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSizeContainer(data.MonitoredItems);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
@@ -3611,18 +3089,14 @@ namespace OpcUa
     template<>
     std::size_t RawSize<EventNotificationList>(const EventNotificationList& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
         size += RawSizeContainer(data.Events);
         return size;
     }
 
 */
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<HistoryEventFieldList>(const HistoryEventFieldList& data)
     {
@@ -3631,9 +3105,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<HistoryEvent>(const HistoryEvent& data)
@@ -3643,9 +3114,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<UpdateEventDetails>(const UpdateEventDetails& data)
@@ -3658,18 +3126,14 @@ namespace OpcUa
         return size;
     }
 
-*/
 
 /* DISABLED
 
     template<>
     std::size_t RawSize<StatusChangeNotification>(const StatusChangeNotification& data)
     {
-        size_t size = 0;
+        size_t size = 9;
         size += RawSize(data.TypeId);
-        size += RawSize(data.Encoding);
-        size += RawSize(data.BodyLength);
-        size += RawSize(data.Status);
         size += RawSize(data.DiagnosticInfo);
         return size;
     }
@@ -3679,10 +3143,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<SubscriptionAcknowledgement>(const SubscriptionAcknowledgement& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.SequenceNumber);
-        return size;
+        return FixedCodec<SubscriptionAcknowledgement>::Size;
     }
 
 
@@ -3692,7 +3153,7 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.TypeId);
         size += RawSize(data.Header);
-        size += RawSizeContainer(data.SubscriptionAcknowledgements);
+        size += RawSizeFixedContainer(data.SubscriptionAcknowledgements);
         return size;
     }
 
@@ -3702,10 +3163,10 @@ namespace OpcUa
     {
         size_t size = 0;
         size += RawSize(data.SubscriptionId);
-        size += RawSizeContainer(data.AvailableSequenceNumbers);
+        size += RawSizeFixedContainer(data.AvailableSequenceNumbers);
         size += RawSize(data.MoreNotifications);
         size += RawSize(data.NotificationMessage);
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
@@ -3725,10 +3186,7 @@ namespace OpcUa
     template<>
     std::size_t RawSize<RepublishParameters>(const RepublishParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.RetransmitSequenceNumber);
-        return size;
+        return FixedCodec<RepublishParameters>::Size;
     }
 
 
@@ -3754,33 +3212,25 @@ namespace OpcUa
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<TransferResult>(const TransferResult& data)
     {
         size_t size = 0;
         size += RawSize(data.Status);
-        size += RawSizeContainer(data.AvailableSequenceNumbers);
+        size += RawSizeFixedContainer(data.AvailableSequenceNumbers);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TransferSubscriptionsParameters>(const TransferSubscriptionsParameters& data)
     {
         size_t size = 0;
-        size += RawSizeContainer(data.SubscriptionIds);
+        size += RawSizeFixedContainer(data.SubscriptionIds);
         size += RawSize(data.SendInitialValues);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TransferSubscriptionsRequest>(const TransferSubscriptionsRequest& data)
@@ -3792,9 +3242,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TransferSubscriptionsResult>(const TransferSubscriptionsResult& data)
@@ -3805,9 +3252,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TransferSubscriptionsResponse>(const TransferSubscriptionsResponse& data)
@@ -3819,7 +3263,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<DeleteSubscriptionsRequest>(const DeleteSubscriptionsRequest& data)
@@ -3827,7 +3270,7 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.TypeId);
         size += RawSize(data.Header);
-        size += RawSizeContainer(data.SubscriptionIds);
+        size += RawSizeFixedContainer(data.SubscriptionIds);
         return size;
     }
 
@@ -3838,29 +3281,16 @@ namespace OpcUa
         size_t size = 0;
         size += RawSize(data.TypeId);
         size += RawSize(data.Header);
-        size += RawSizeContainer(data.Results);
+        size += RawSizeFixedContainer(data.Results);
         size += RawSizeContainer(data.DiagnosticInfos);
         return size;
     }
 
 
-/* DISABLED
-
     template<>
     std::size_t RawSize<ScalarTestType>(const ScalarTestType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Boolean);
-        size += RawSize(data.SByte);
-        size += RawSize(data.Byte);
-        size += RawSize(data.Int16);
-        size += RawSize(data.UInt16);
-        size += RawSize(data.Int32);
-        size += RawSize(data.UInt32);
-        size += RawSize(data.Int64);
-        size += RawSize(data.UInt64);
-        size += RawSize(data.Float);
-        size += RawSize(data.Double);
+        size_t size = 43;
         size += RawSize(data.String);
         size += RawSize(data.DateTime);
         size += RawSize(data.Guid);
@@ -3878,45 +3308,39 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ArrayTestType>(const ArrayTestType& data)
     {
         size_t size = 0;
-        size += RawSizeContainer(data.Booleans);
-        size += RawSizeContainer(data.SBytes);
-        size += RawSizeContainer(data.Int16s);
-        size += RawSizeContainer(data.UInt16s);
-        size += RawSizeContainer(data.Int32s);
-        size += RawSizeContainer(data.UInt32s);
-        size += RawSizeContainer(data.Int64s);
-        size += RawSizeContainer(data.UInt64s);
-        size += RawSizeContainer(data.Floats);
-        size += RawSizeContainer(data.Doubles);
+        size += RawSizeFixedContainer(data.Booleans);
+        size += RawSizeFixedContainer(data.SBytes);
+        size += RawSizeFixedContainer(data.Int16s);
+        size += RawSizeFixedContainer(data.UInt16s);
+        size += RawSizeFixedContainer(data.Int32s);
+        size += RawSizeFixedContainer(data.UInt32s);
+        size += RawSizeFixedContainer(data.Int64s);
+        size += RawSizeFixedContainer(data.UInt64s);
+        size += RawSizeFixedContainer(data.Floats);
+        size += RawSizeFixedContainer(data.Doubles);
         size += RawSizeContainer(data.Strings);
-        size += RawSizeContainer(data.DateTimes);
+        size += RawSizeFixedContainer(data.DateTimes);
         size += RawSizeContainer(data.Guids);
         size += RawSizeContainer(data.ByteStrings);
         size += RawSizeContainer(data.XmlElements);
         size += RawSizeContainer(data.NodeIds);
         size += RawSizeContainer(data.ExpandedNodeIds);
-        size += RawSizeContainer(data.StatusCodes);
+        size += RawSizeFixedContainer(data.StatusCodes);
         size += RawSizeContainer(data.DiagnosticInfos);
         size += RawSizeContainer(data.QualifiedNames);
         size += RawSizeContainer(data.LocalizedTexts);
         size += RawSizeContainer(data.ExtensionObjects);
         size += RawSizeContainer(data.DataValues);
         size += RawSizeContainer(data.Variants);
-        size += RawSizeContainer(data.EnumeratedValues);
+        size += RawSizeFixedContainer(data.EnumeratedValues);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<CompositeTestType>(const CompositeTestType& data)
@@ -3927,23 +3351,15 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackParameters>(const TestStackParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.TestId);
-        size += RawSize(data.Iteration);
+        size_t size = 8;
         size += RawSize(data.Input);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackRequest>(const TestStackRequest& data)
@@ -3955,9 +3371,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackResult>(const TestStackResult& data)
@@ -3967,9 +3380,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackResponse>(const TestStackResponse& data)
@@ -3981,23 +3391,15 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackExParameters>(const TestStackExParameters& data)
     {
-        size_t size = 0;
-        size += RawSize(data.TestId);
-        size += RawSize(data.Iteration);
+        size_t size = 8;
         size += RawSize(data.Input);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackExRequest>(const TestStackExRequest& data)
@@ -4009,9 +3411,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackExResult>(const TestStackExResult& data)
@@ -4021,9 +3420,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<TestStackExResponse>(const TestStackExResponse& data)
@@ -4035,9 +3431,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<BuildInfo>(const BuildInfo& data)
@@ -4052,23 +3445,15 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<RedundantServerDataType>(const RedundantServerDataType& data)
     {
-        size_t size = 0;
+        size_t size = 5;
         size += RawSize(data.ServerId);
-        size += RawSize(data.ServiceLevel);
-        size += RawSize(data.ServerState);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<EndpointUrlListDataType>(const EndpointUrlListDataType& data)
@@ -4078,9 +3463,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<NetworkGroupDataType>(const NetworkGroupDataType& data)
@@ -4091,64 +3473,31 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SamplingIntervalDiagnosticsDataType>(const SamplingIntervalDiagnosticsDataType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.SamplingInterval);
-        size += RawSize(data.MonitoredItemCount);
-        size += RawSize(data.MaxMonitoredItemCount);
-        size += RawSize(data.DisabledMonitoredItemCount);
-        return size;
+        return FixedCodec<SamplingIntervalDiagnosticsDataType>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ServerDiagnosticsSummaryDataType>(const ServerDiagnosticsSummaryDataType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.ServerViewCount);
-        size += RawSize(data.CurrentSessionCount);
-        size += RawSize(data.CumulatedSessionCount);
-        size += RawSize(data.SecurityRejectedSessionCount);
-        size += RawSize(data.RejectedSessionCount);
-        size += RawSize(data.SessionTimeoutCount);
-        size += RawSize(data.SessionAbortCount);
-        size += RawSize(data.CurrentSubscriptionCount);
-        size += RawSize(data.CumulatedSubscriptionCount);
-        size += RawSize(data.PublishingIntervalCount);
-        size += RawSize(data.SecurityRejectedRequestsCount);
-        size += RawSize(data.RejectedRequestsCount);
-        return size;
+        return FixedCodec<ServerDiagnosticsSummaryDataType>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ServerStatusDataType>(const ServerStatusDataType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.StartTime);
-        size += RawSize(data.CurrentTime);
-        size += RawSize(data.State);
+        size_t size = 20;
         size += RawSize(data.BuildInfo);
         size += RawSize(data.SecondsTillShutdown);
         size += RawSize(data.ShutdownReason);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SessionSecurityDiagnosticsDataType>(const SessionSecurityDiagnosticsDataType& data)
@@ -4166,76 +3515,27 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ServiceCounterDataType>(const ServiceCounterDataType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.TotalCount);
-        size += RawSize(data.ErrorCount);
-        return size;
+        return FixedCodec<ServiceCounterDataType>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SessionDiagnosticsDataType>(const SessionDiagnosticsDataType& data)
     {
-        size_t size = 0;
+        size_t size = 276;
         size += RawSize(data.SessionId);
         size += RawSize(data.SessionName);
         size += RawSize(data.ClientDescription);
         size += RawSize(data.ServerUri);
         size += RawSize(data.EndpointUrl);
         size += RawSizeContainer(data.LocaleIds);
-        size += RawSize(data.ActualSessionTimeout);
-        size += RawSize(data.MaxResponseMessageSize);
-        size += RawSize(data.ClientConnectionTime);
-        size += RawSize(data.ClientLastContactTime);
-        size += RawSize(data.CurrentSubscriptionsCount);
-        size += RawSize(data.CurrentMonitoredItemsCount);
-        size += RawSize(data.CurrentPublishRequestsInQueue);
-        size += RawSize(data.TotalRequestCount);
-        size += RawSize(data.UnauthorizedRequestCount);
-        size += RawSize(data.ReadCount);
-        size += RawSize(data.HistoryReadCount);
-        size += RawSize(data.WriteCount);
-        size += RawSize(data.HistoryUpdateCount);
-        size += RawSize(data.CallCount);
-        size += RawSize(data.CreateMonitoredItemsCount);
-        size += RawSize(data.ModifyMonitoredItemsCount);
-        size += RawSize(data.SetMonitoringModeCount);
-        size += RawSize(data.SetTriggeringCount);
-        size += RawSize(data.DeleteMonitoredItemsCount);
-        size += RawSize(data.CreateSubscriptionCount);
-        size += RawSize(data.ModifySubscriptionCount);
-        size += RawSize(data.SetPublishingModeCount);
-        size += RawSize(data.PublishCount);
-        size += RawSize(data.RepublishCount);
-        size += RawSize(data.TransferSubscriptionsCount);
-        size += RawSize(data.DeleteSubscriptionsCount);
-        size += RawSize(data.AddNodesCount);
-        size += RawSize(data.AddReferencesCount);
-        size += RawSize(data.DeleteNodesCount);
-        size += RawSize(data.DeleteReferencesCount);
-        size += RawSize(data.BrowseCount);
-        size += RawSize(data.BrowseNextCount);
-        size += RawSize(data.TranslateBrowsePathsToNodeIdsCount);
-        size += RawSize(data.QueryFirstCount);
-        size += RawSize(data.QueryNextCount);
-        size += RawSize(data.RegisterNodesCount);
-        size += RawSize(data.UnregisterNodesCount);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<StatusResult>(const StatusResult& data)
@@ -4246,51 +3546,15 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SubscriptionDiagnosticsDataType>(const SubscriptionDiagnosticsDataType& data)
     {
-        size_t size = 0;
+        size_t size = 118;
         size += RawSize(data.SessionId);
-        size += RawSize(data.SubscriptionId);
-        size += RawSize(data.Priority);
-        size += RawSize(data.PublishingInterval);
-        size += RawSize(data.MaxKeepAliveCount);
-        size += RawSize(data.MaxLifetimeCount);
-        size += RawSize(data.MaxNotificationsPerPublish);
-        size += RawSize(data.PublishingEnabled);
-        size += RawSize(data.ModifyCount);
-        size += RawSize(data.EnableCount);
-        size += RawSize(data.DisableCount);
-        size += RawSize(data.RepublishRequestCount);
-        size += RawSize(data.RepublishMessageRequestCount);
-        size += RawSize(data.RepublishMessageCount);
-        size += RawSize(data.TransferRequestCount);
-        size += RawSize(data.TransferredToAltClientCount);
-        size += RawSize(data.TransferredToSameClientCount);
-        size += RawSize(data.PublishRequestCount);
-        size += RawSize(data.DataChangeNotificationsCount);
-        size += RawSize(data.EventNotificationsCount);
-        size += RawSize(data.NotificationsCount);
-        size += RawSize(data.LatePublishRequestCount);
-        size += RawSize(data.CurrentKeepAliveCount);
-        size += RawSize(data.CurrentLifetimeCount);
-        size += RawSize(data.UnacknowledgedMessageCount);
-        size += RawSize(data.DiscardedMessageCount);
-        size += RawSize(data.MonitoredItemCount);
-        size += RawSize(data.DisabledMonitoredItemCount);
-        size += RawSize(data.MonitoringQueueOverflowCount);
-        size += RawSize(data.NextSequenceNumber);
-        size += RawSize(data.EventQueueOverFlowCount);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ModelChangeStructureDataType>(const ModelChangeStructureDataType& data)
@@ -4302,9 +3566,6 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<SemanticChangeStructureDataType>(const SemanticChangeStructureDataType& data)
@@ -4315,22 +3576,13 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<Range>(const Range& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Low);
-        size += RawSize(data.High);
-        return size;
+        return FixedCodec<Range>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<EUInformation>(const EUInformation& data)
@@ -4343,35 +3595,20 @@ namespace OpcUa
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ComplexNumberType>(const ComplexNumberType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Real);
-        size += RawSize(data.Imaginary);
-        return size;
+        return FixedCodec<ComplexNumberType>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<DoubleComplexNumberType>(const DoubleComplexNumberType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.Real);
-        size += RawSize(data.Imaginary);
-        return size;
+        return FixedCodec<DoubleComplexNumberType>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<AxisInformation>(const AxisInformation& data)
@@ -4381,35 +3618,24 @@ namespace OpcUa
         size += RawSize(data.EURange);
         size += RawSize(data.Title);
         size += RawSize(data.AxisScaleType);
-        size += RawSizeContainer(data.AxisSteps);
+        size += RawSizeFixedContainer(data.AxisSteps);
         return size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<XVType>(const XVType& data)
     {
-        size_t size = 0;
-        size += RawSize(data.X);
-        size += RawSize(data.Value);
-        return size;
+        return FixedCodec<XVType>::Size;
     }
 
-*/
-
-/* DISABLED
 
     template<>
     std::size_t RawSize<ProgramDiagnosticDataType>(const ProgramDiagnosticDataType& data)
     {
-        size_t size = 0;
+        size_t size = 16;
         size += RawSize(data.CreateSessionId);
         size += RawSize(data.CreateClientName);
-        size += RawSize(data.InvocationCreationTime);
-        size += RawSize(data.LastTransitionTime);
         size += RawSize(data.LastMethodCall);
         size += RawSize(data.LastMethodSessionId);
         size += RawSizeContainer(data.LastMethodInputArguments);
@@ -4419,7 +3645,6 @@ namespace OpcUa
         return size;
     }
 
-*/
 
     template<>
     std::size_t RawSize<Annotation>(const Annotation& data)
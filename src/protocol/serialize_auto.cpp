@@ -17,6 +17,8 @@
 
 #include <opc/ua/protocol/binary/stream.h>
 
+#include "fixed_size_auto.h"
+
 namespace OpcUa
 {
     namespace Binary
@@ -194,7 +196,7 @@ namespace OpcUa
     void DataSerializer::Serialize<XmlElement>(const XmlElement& data)
     {
         *this << data.Length;
-        SerializeContainer(*this, data.Value);
+        SerializeFixedContainer(*this, data.Value);
     }
 
 
@@ -213,8 +215,10 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<FourByteNodeId>(const FourByteNodeId& data)
     {
-        *this << data.NamespaceIndex;
-        *this << data.Identifier;
+        char block1[3];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.NamespaceIndex);
+        FixedCodec<uint16_t>::Store(block1 + 1, data.Identifier);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -224,8 +228,10 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<NumericNodeId>(const NumericNodeId& data)
     {
-        *this << data.NamespaceIndex;
-        *this << data.Identifier;
+        char block1[6];
+        FixedCodec<uint16_t>::Store(block1 + 0, data.NamespaceIndex);
+        FixedCodec<uint32_t>::Store(block1 + 2, data.Identifier);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -352,25 +358,25 @@ namespace OpcUa
     {
         *this << data.Encoding;
         if ((data.Encoding) & (1<<(7))) *this << data.ArrayLength;
-        if ((data.VariantType) & (1<<(1))) SerializeContainer(*this, data.Boolean);
-        if ((data.VariantType) & (1<<(2))) SerializeContainer(*this, data.SByte);
-        if ((data.VariantType) & (1<<(3))) SerializeContainer(*this, data.Byte);
-        if ((data.VariantType) & (1<<(4))) SerializeContainer(*this, data.Int16);
-        if ((data.VariantType) & (1<<(5))) SerializeContainer(*this, data.UInt16);
-        if ((data.VariantType) & (1<<(6))) SerializeContainer(*this, data.Int32);
-        if ((data.VariantType) & (1<<(7))) SerializeContainer(*this, data.UInt32);
-        if ((data.VariantType) & (1<<(8))) SerializeContainer(*this, data.Int64);
-        if ((data.VariantType) & (1<<(9))) SerializeContainer(*this, data.UInt64);
-        if ((data.VariantType) & (1<<(10))) SerializeContainer(*this, data.Float);
-        if ((data.VariantType) & (1<<(11))) SerializeContainer(*this, data.Double);
+        if ((data.VariantType) & (1<<(1))) SerializeFixedContainer(*this, data.Boolean);
+        if ((data.VariantType) & (1<<(2))) SerializeFixedContainer(*this, data.SByte);
+        if ((data.VariantType) & (1<<(3))) SerializeFixedContainer(*this, data.Byte);
+        if ((data.VariantType) & (1<<(4))) SerializeFixedContainer(*this, data.Int16);
+        if ((data.VariantType) & (1<<(5))) SerializeFixedContainer(*this, data.UInt16);
+        if ((data.VariantType) & (1<<(6))) SerializeFixedContainer(*this, data.Int32);
+        if ((data.VariantType) & (1<<(7))) SerializeFixedContainer(*this, data.UInt32);
+        if ((data.VariantType) & (1<<(8))) SerializeFixedContainer(*this, data.Int64);
+        if ((data.VariantType) & (1<<(9))) SerializeFixedContainer(*this, data.UInt64);
+        if ((data.VariantType) & (1<<(10))) SerializeFixedContainer(*this, data.Float);
+        if ((data.VariantType) & (1<<(11))) SerializeFixedContainer(*this, data.Double);
         if ((data.VariantType) & (1<<(12))) SerializeContainer(*this, data.String);
-        if ((data.VariantType) & (1<<(13))) SerializeContainer(*this, data.DateTime);
+        if ((data.VariantType) & (1<<(13))) SerializeFixedContainer(*this, data.DateTime);
         if ((data.VariantType) & (1<<(14))) SerializeContainer(*this, data.Guid);
         if ((data.VariantType) & (1<<(15))) SerializeContainer(*this, data.ByteString);
         if ((data.VariantType) & (1<<(16))) SerializeContainer(*this, data.XmlElement);
         if ((data.VariantType) & (1<<(17))) SerializeContainer(*this, data.NodeId);
         if ((data.VariantType) & (1<<(18))) SerializeContainer(*this, data.ExpandedNodeId);
-        if ((data.VariantType) & (1<<(19))) SerializeContainer(*this, data.Status);
+        if ((data.VariantType) & (1<<(19))) SerializeFixedContainer(*this, data.Status);
         if ((data.VariantType) & (1<<(20))) SerializeContainer(*this, data.DiagnosticInfo);
         if ((data.VariantType) & (1<<(21))) SerializeContainer(*this, data.QualifiedName);
         if ((data.VariantType) & (1<<(22))) SerializeContainer(*this, data.LocalizedText);
@@ -397,8 +403,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<ReferenceNode>(const ReferenceNode& data)
     {
@@ -407,7 +411,6 @@ namespace OpcUa
         *this << data.TargetId;
     }
 
-*/
 
 /*  DISABLED
 
@@ -419,15 +422,15 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<InstanceNode>(const InstanceNode& data)
     {
@@ -436,14 +439,13 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TypeNode>(const TypeNode& data)
@@ -453,14 +455,13 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ObjectNode>(const ObjectNode& data)
@@ -470,15 +471,14 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
         *this << data.EventNotifier;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ObjectTypeNode>(const ObjectTypeNode& data)
@@ -488,15 +488,14 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
         *this << data.IsAbstract;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<VariableNode>(const VariableNode& data)
@@ -506,22 +505,23 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
         *this << data.Value;
         *this << data.DataType;
         *this << data.ValueRank;
-        SerializeContainer(*this, data.ArrayDimensions);
-        *this << data.AccessLevel;
-        *this << data.UserAccessLevel;
-        *this << data.MinimumSamplingInterval;
-        *this << data.Historizing;
+        SerializeFixedContainer(*this, data.ArrayDimensions);
+        char block2[11];
+        FixedCodec<OpcUa::VariableAccessLevel>::Store(block2 + 0, data.AccessLevel);
+        FixedCodec<OpcUa::VariableAccessLevel>::Store(block2 + 1, data.UserAccessLevel);
+        FixedCodec<double>::Store(block2 + 2, data.MinimumSamplingInterval);
+        FixedCodec<bool>::Store(block2 + 10, data.Historizing);
+        Write(block2, sizeof(block2));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<VariableTypeNode>(const VariableTypeNode& data)
@@ -531,19 +531,18 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
         *this << data.Value;
         *this << data.DataType;
         *this << data.ValueRank;
-        SerializeContainer(*this, data.ArrayDimensions);
+        SerializeFixedContainer(*this, data.ArrayDimensions);
         *this << data.IsAbstract;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ReferenceTypeNode>(const ReferenceTypeNode& data)
@@ -553,17 +552,18 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
-        *this << data.IsAbstract;
-        *this << data.Symmetric;
+        char block2[2];
+        FixedCodec<bool>::Store(block2 + 0, data.IsAbstract);
+        FixedCodec<bool>::Store(block2 + 1, data.Symmetric);
+        Write(block2, sizeof(block2));
         *this << data.InverseName;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<MethodNode>(const MethodNode& data)
@@ -573,16 +573,17 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
-        *this << data.Executable;
-        *this << data.UserExecutable;
+        char block2[2];
+        FixedCodec<bool>::Store(block2 + 0, data.Executable);
+        FixedCodec<bool>::Store(block2 + 1, data.UserExecutable);
+        Write(block2, sizeof(block2));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ViewNode>(const ViewNode& data)
@@ -592,16 +593,17 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
-        *this << data.ContainsNoLoops;
-        *this << data.EventNotifier;
+        char block2[2];
+        FixedCodec<bool>::Store(block2 + 0, data.ContainsNoLoops);
+        FixedCodec<uint8_t>::Store(block2 + 1, data.EventNotifier);
+        Write(block2, sizeof(block2));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DataTypeNode>(const DataTypeNode& data)
@@ -611,15 +613,14 @@ namespace OpcUa
         *this << data.BrowseName;
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.UserWriteMask);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.References);
         *this << data.IsAbstract;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<Argument>(const Argument& data)
@@ -627,13 +628,10 @@ namespace OpcUa
         *this << data.Name;
         *this << data.DataType;
         *this << data.ValueRank;
-        SerializeContainer(*this, data.ArrayDimensions);
+        SerializeFixedContainer(*this, data.ArrayDimensions);
         *this << data.Description;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<EnumValueType>(const EnumValueType& data)
@@ -643,18 +641,15 @@ namespace OpcUa
         *this << data.Description;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TimeZoneDataType>(const TimeZoneDataType& data)
     {
-        *this << data.Offset;
-        *this << data.DaylightSavingInOffset;
+        char block[FixedCodec<TimeZoneDataType>::Size];
+        FixedCodec<TimeZoneDataType>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<ApplicationDescription>(const ApplicationDescription& data)
@@ -675,9 +670,11 @@ namespace OpcUa
     void DataSerializer::Serialize<RequestHeader>(const RequestHeader& data)
     {
         *this << data.AuthenticationToken;
-        *this << data.Timestamp;
-        *this << data.RequestHandle;
-        *this << data.ReturnDiagnostics;
+        char block1[16];
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 0, data.Timestamp);
+        FixedCodec<uint32_t>::Store(block1 + 8, data.RequestHandle);
+        FixedCodec<uint32_t>::Store(block1 + 12, data.ReturnDiagnostics);
+        Write(block1, sizeof(block1));
         *this << data.AuditEntryId;
         *this << data.TimeoutHint;
         *this << data.AdditionalHeader;
@@ -690,9 +687,11 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<ResponseHeader>(const ResponseHeader& data)
     {
-        *this << data.Timestamp;
-        *this << data.RequestHandle;
-        *this << data.ServiceResult;
+        char block1[16];
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 0, data.Timestamp);
+        FixedCodec<uint32_t>::Store(block1 + 8, data.RequestHandle);
+        FixedCodec<OpcUa::StatusCode>::Store(block1 + 12, data.ServiceResult);
+        Write(block1, sizeof(block1));
         *this << data.ServiceDiagnostics;
         SerializeContainer(*this, data.StringTable);
         *this << data.AdditionalHeader;
@@ -700,8 +699,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<ServiceFault>(const ServiceFault& data)
     {
@@ -709,7 +706,6 @@ namespace OpcUa
         *this << data.Header;
     }
 
-*/
 
 /*  DISABLED
 
@@ -735,15 +731,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<FindServersResult>(const FindServersResult& data)
     {
         SerializeContainer(*this, data.Servers);
     }
 
-*/
 
 /*  DISABLED
 
@@ -809,8 +802,6 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<RegisteredServer>(const RegisteredServer& data)
     {
@@ -824,9 +815,6 @@ namespace OpcUa
         *this << data.IsOnline;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<RegisterServerParameters>(const RegisterServerParameters& data)
@@ -834,9 +822,6 @@ namespace OpcUa
         *this << data.Server;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<RegisterServerRequest>(const RegisterServerRequest& data)
@@ -846,9 +831,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<RegisterServerResponse>(const RegisterServerResponse& data)
@@ -857,29 +839,26 @@ namespace OpcUa
         *this << data.Header;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ChannelSecurityToken>(const ChannelSecurityToken& data)
     {
-        *this << data.ChannelId;
-        *this << data.TokenId;
-        *this << data.CreatedAt;
-        *this << data.RevisedLifetime;
+        char block[FixedCodec<ChannelSecurityToken>::Size];
+        FixedCodec<ChannelSecurityToken>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
 
 /*  DISABLED
 
     template<>
     void DataSerializer::Serialize<OpenSecureChannelParameters>(const OpenSecureChannelParameters& data)
     {
-        *this << data.ClientProtocolVersion;
-        *this << data.RequestType;
-        *this << data.SecurityMode;
+        char block1[12];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.ClientProtocolVersion);
+        FixedCodec<OpcUa::SecurityTokenRequestType>::Store(block1 + 4, data.RequestType);
+        FixedCodec<OpcUa::MessageSecurityMode>::Store(block1 + 8, data.SecurityMode);
+        Write(block1, sizeof(block1));
         *this << data.ClientNonce;
         *this << data.RequestedLifetime;
     }
@@ -898,17 +877,16 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<OpenSecureChannelResult>(const OpenSecureChannelResult& data)
     {
-        *this << data.ServerProtocolVersion;
-        *this << data.SecurityToken;
+        char block1[24];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.ServerProtocolVersion);
+        FixedCodec<OpcUa::ChannelSecurityToken>::Store(block1 + 4, data.SecurityToken);
+        Write(block1, sizeof(block1));
         *this << data.ServerNonce;
     }
 
-*/
 
 /*  DISABLED
 
@@ -933,8 +911,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<CloseSecureChannelResponse>(const CloseSecureChannelResponse& data)
     {
@@ -942,7 +918,6 @@ namespace OpcUa
         *this << data.Header;
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<SignedSoftwareCertificate>(const SignedSoftwareCertificate& data)
@@ -969,8 +944,10 @@ namespace OpcUa
         *this << data.SessionName;
         *this << data.ClientNonce;
         *this << data.ClientCertificate;
-        *this << data.RequestedSessionTimeout;
-        *this << data.MaxResponseMessageSize;
+        char block1[12];
+        FixedCodec<double>::Store(block1 + 0, data.RequestedSessionTimeout);
+        FixedCodec<uint32_t>::Store(block1 + 8, data.MaxResponseMessageSize);
+        Write(block1, sizeof(block1));
     }
 
 
@@ -1007,76 +984,71 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<UserIdentityToken>(const UserIdentityToken& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.PolicyId;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<AnonymousIdentityToken>(const AnonymousIdentityToken& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.PolicyId;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<UserNameIdentityToken>(const UserNameIdentityToken& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.PolicyId;
         *this << data.UserName;
         *this << data.Password;
         *this << data.EncryptionAlgorithm;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<X509IdentityToken>(const X509IdentityToken& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.PolicyId;
         *this << data.CertificateData;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<IssuedIdentityToken>(const IssuedIdentityToken& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.PolicyId;
         *this << data.TokenData;
         *this << data.EncryptionAlgorithm;
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<ActivateSessionParameters>(const ActivateSessionParameters& data)
@@ -1102,7 +1074,7 @@ namespace OpcUa
     void DataSerializer::Serialize<ActivateSessionResult>(const ActivateSessionResult& data)
     {
         *this << data.ServerNonce;
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -1139,17 +1111,14 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<CancelParameters>(const CancelParameters& data)
     {
-        *this << data.RequestHandle;
+        char block[FixedCodec<CancelParameters>::Size];
+        FixedCodec<CancelParameters>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<CancelRequest>(const CancelRequest& data)
@@ -1159,19 +1128,15 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<CancelResult>(const CancelResult& data)
     {
-        *this << data.CancelCount;
+        char block[FixedCodec<CancelResult>::Size];
+        FixedCodec<CancelResult>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<CancelResponse>(const CancelResponse& data)
@@ -1181,7 +1146,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
 
 /*  DISABLED
 
@@ -1189,13 +1153,17 @@ namespace OpcUa
     void DataSerializer::Serialize<NodeAttributes>(const NodeAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block2[8];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        Write(block2, sizeof(block2));
     }
 
 */
@@ -1206,14 +1174,18 @@ namespace OpcUa
     void DataSerializer::Serialize<ObjectAttributes>(const ObjectAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
-        *this << data.EventNotifier;
+        char block2[9];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        FixedCodec<uint8_t>::Store(block2 + 8, data.EventNotifier);
+        Write(block2, sizeof(block2));
     }
 
 */
@@ -1224,21 +1196,27 @@ namespace OpcUa
     void DataSerializer::Serialize<VariableAttributes>(const VariableAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block2[8];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        Write(block2, sizeof(block2));
         *this << data.Value;
         *this << data.DataType;
         *this << data.ValueRank;
-        SerializeContainer(*this, data.ArrayDimensions);
-        *this << data.AccessLevel;
-        *this << data.UserAccessLevel;
-        *this << data.MinimumSamplingInterval;
-        *this << data.Historizing;
+        SerializeFixedContainer(*this, data.ArrayDimensions);
+        char block3[11];
+        FixedCodec<OpcUa::VariableAccessLevel>::Store(block3 + 0, data.AccessLevel);
+        FixedCodec<OpcUa::VariableAccessLevel>::Store(block3 + 1, data.UserAccessLevel);
+        FixedCodec<double>::Store(block3 + 2, data.MinimumSamplingInterval);
+        FixedCodec<bool>::Store(block3 + 10, data.Historizing);
+        Write(block3, sizeof(block3));
     }
 
 */
@@ -1249,15 +1227,19 @@ namespace OpcUa
     void DataSerializer::Serialize<MethodAttributes>(const MethodAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
-        *this << data.Executable;
-        *this << data.UserExecutable;
+        char block2[10];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Store(block2 + 8, data.Executable);
+        FixedCodec<bool>::Store(block2 + 9, data.UserExecutable);
+        Write(block2, sizeof(block2));
     }
 
 */
@@ -1268,14 +1250,18 @@ namespace OpcUa
     void DataSerializer::Serialize<ObjectTypeAttributes>(const ObjectTypeAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
-        *this << data.IsAbstract;
+        char block2[9];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Store(block2 + 8, data.IsAbstract);
+        Write(block2, sizeof(block2));
     }
 
 */
@@ -1286,17 +1272,21 @@ namespace OpcUa
     void DataSerializer::Serialize<VariableTypeAttributes>(const VariableTypeAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
+        char block2[8];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        Write(block2, sizeof(block2));
         *this << data.Value;
         *this << data.DataType;
         *this << data.ValueRank;
-        SerializeContainer(*this, data.ArrayDimensions);
+        SerializeFixedContainer(*this, data.ArrayDimensions);
         *this << data.IsAbstract;
     }
 
@@ -1308,15 +1298,19 @@ namespace OpcUa
     void DataSerializer::Serialize<ReferenceTypeAttributes>(const ReferenceTypeAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
-        *this << data.IsAbstract;
-        *this << data.Symmetric;
+        char block2[10];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Store(block2 + 8, data.IsAbstract);
+        FixedCodec<bool>::Store(block2 + 9, data.Symmetric);
+        Write(block2, sizeof(block2));
         *this << data.InverseName;
     }
 
@@ -1328,14 +1322,18 @@ namespace OpcUa
     void DataSerializer::Serialize<DataTypeAttributes>(const DataTypeAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
-        *this << data.IsAbstract;
+        char block2[9];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Store(block2 + 8, data.IsAbstract);
+        Write(block2, sizeof(block2));
     }
 
 */
@@ -1346,15 +1344,19 @@ namespace OpcUa
     void DataSerializer::Serialize<ViewAttributes>(const ViewAttributes& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.SpecifiedAttributes;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.SpecifiedAttributes);
+        Write(block1, sizeof(block1));
         *this << data.DisplayName;
         *this << data.Description;
-        *this << data.WriteMask;
-        *this << data.UserWriteMask;
-        *this << data.ContainsNoLoops;
-        *this << data.EventNotifier;
+        char block2[10];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.WriteMask);
+        FixedCodec<uint32_t>::Store(block2 + 4, data.UserWriteMask);
+        FixedCodec<bool>::Store(block2 + 8, data.ContainsNoLoops);
+        FixedCodec<uint8_t>::Store(block2 + 9, data.EventNotifier);
+        Write(block2, sizeof(block2));
     }
 
 */
@@ -1455,7 +1457,7 @@ namespace OpcUa
     {
         *this << data.TypeId;
         *this << data.Header;
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -1483,13 +1485,11 @@ namespace OpcUa
     {
         *this << data.TypeId;
         *this << data.Header;
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<DeleteReferencesItem>(const DeleteReferencesItem& data)
     {
@@ -1500,9 +1500,6 @@ namespace OpcUa
         *this << data.DeleteBidirectional;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DeleteReferencesParameters>(const DeleteReferencesParameters& data)
@@ -1510,9 +1507,6 @@ namespace OpcUa
         SerializeContainer(*this, data.ReferencesToDelete);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DeleteReferencesRequest>(const DeleteReferencesRequest& data)
@@ -1522,20 +1516,14 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DeleteReferencesResult>(const DeleteReferencesResult& data)
     {
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DeleteReferencesResponse>(const DeleteReferencesResponse& data)
@@ -1545,7 +1533,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
 
 /*  DISABLED
 
@@ -1553,8 +1540,10 @@ namespace OpcUa
     void DataSerializer::Serialize<ViewDescription>(const ViewDescription& data)
     {
         *this << data.ViewId;
-        *this << data.Timestamp;
-        *this << data.ViewVersion;
+        char block1[12];
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 0, data.Timestamp);
+        FixedCodec<uint32_t>::Store(block1 + 8, data.ViewVersion);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -1567,9 +1556,11 @@ namespace OpcUa
         *this << data.NodeId;
         *this << data.BrowseDirection;
         *this << data.ReferenceTypeId;
-        *this << data.IncludeSubtypes;
-        *this << data.NodeClassMask;
-        *this << data.ResultMask;
+        char block1[9];
+        FixedCodec<bool>::Store(block1 + 0, data.IncludeSubtypes);
+        FixedCodec<OpcUa::NodeClass>::Store(block1 + 1, data.NodeClassMask);
+        FixedCodec<OpcUa::BrowseResultMask>::Store(block1 + 5, data.ResultMask);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -1639,8 +1630,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<BrowseNextParameters>(const BrowseNextParameters& data)
     {
@@ -1648,7 +1637,6 @@ namespace OpcUa
         SerializeContainer(*this, data.ContinuationPoints);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1691,8 +1679,10 @@ namespace OpcUa
     void DataSerializer::Serialize<RelativePathElement>(const RelativePathElement& data)
     {
         *this << data.ReferenceTypeId;
-        *this << data.IsInverse;
-        *this << data.IncludeSubtypes;
+        char block1[2];
+        FixedCodec<bool>::Store(block1 + 0, data.IsInverse);
+        FixedCodec<bool>::Store(block1 + 1, data.IncludeSubtypes);
+        Write(block1, sizeof(block1));
         *this << data.TargetName;
     }
 
@@ -1776,15 +1766,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<RegisterNodesParameters>(const RegisterNodesParameters& data)
     {
         SerializeContainer(*this, data.NodesToRegister);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1798,15 +1785,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<RegisterNodesResult>(const RegisterNodesResult& data)
     {
         SerializeContainer(*this, data.RegisteredNodeIds);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1820,15 +1804,12 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<UnregisterNodesParameters>(const UnregisterNodesParameters& data)
     {
         SerializeContainer(*this, data.NodesToUnregister);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1853,25 +1834,14 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<EndpointConfiguration>(const EndpointConfiguration& data)
     {
-        *this << data.OperationTimeout;
-        *this << data.UseBinaryEncoding;
-        *this << data.MaxStringLength;
-        *this << data.MaxByteStringLength;
-        *this << data.MaxArrayLength;
-        *this << data.MaxMessageSize;
-        *this << data.MaxBufferSize;
-        *this << data.ChannelLifetime;
-        *this << data.SecurityTokenLifetime;
+        char block[FixedCodec<EndpointConfiguration>::Size];
+        FixedCodec<EndpointConfiguration>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SupportedProfile>(const SupportedProfile& data)
@@ -1879,14 +1849,13 @@ namespace OpcUa
         *this << data.OrganizationUri;
         *this << data.ProfileId;
         *this << data.ComplianceTool;
-        *this << data.ComplianceDate;
-        *this << data.ComplianceLevel;
+        char block1[12];
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 0, data.ComplianceDate);
+        FixedCodec<OpcUa::ComplianceLevel>::Store(block1 + 8, data.ComplianceLevel);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.UnsupportedUnitIds);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SoftwareCertificate>(const SoftwareCertificate& data)
@@ -1903,9 +1872,6 @@ namespace OpcUa
         SerializeContainer(*this, data.SupportedProfiles);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<QueryDataDescription>(const QueryDataDescription& data)
@@ -1915,9 +1881,6 @@ namespace OpcUa
         *this << data.IndexRange;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<NodeTypeDescription>(const NodeTypeDescription& data)
@@ -1927,9 +1890,6 @@ namespace OpcUa
         SerializeContainer(*this, data.DataToReturn);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<QueryDataSet>(const QueryDataSet& data)
@@ -1939,9 +1899,6 @@ namespace OpcUa
         SerializeContainer(*this, data.Values);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<NodeReference>(const NodeReference& data)
@@ -1952,7 +1909,6 @@ namespace OpcUa
         SerializeContainer(*this, data.ReferencedNodeIds);
     }
 
-*/
 
 /*  DISABLED
 
@@ -1993,9 +1949,11 @@ namespace OpcUa
     void DataSerializer::Serialize<ElementOperand>(const ElementOperand& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.Index;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.Index);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -2006,8 +1964,10 @@ namespace OpcUa
     void DataSerializer::Serialize<LiteralOperand>(const LiteralOperand& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.Value;
     }
 
@@ -2019,8 +1979,10 @@ namespace OpcUa
     void DataSerializer::Serialize<AttributeOperand>(const AttributeOperand& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.NodeId;
         *this << data.Alias;
         *this << data.BrowsePath;
@@ -2036,8 +1998,10 @@ namespace OpcUa
     void DataSerializer::Serialize<SimpleAttributeOperand>(const SimpleAttributeOperand& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         *this << data.TypeDefinitionId;
         SerializeContainer(*this, data.BrowsePath);
         *this << data.AttributeId;
@@ -2046,19 +2010,14 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<ContentFilterElementResult>(const ContentFilterElementResult& data)
     {
         *this << data.Status;
-        SerializeContainer(*this, data.OperandStatusCodes);
+        SerializeFixedContainer(*this, data.OperandStatusCodes);
         SerializeContainer(*this, data.OperandDiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ContentFilterResult>(const ContentFilterResult& data)
@@ -2067,19 +2026,15 @@ namespace OpcUa
         SerializeContainer(*this, data.ElementDiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ParsingResult>(const ParsingResult& data)
     {
         *this << data.Status;
-        SerializeContainer(*this, data.DataStatusCodes);
+        SerializeFixedContainer(*this, data.DataStatusCodes);
         SerializeContainer(*this, data.DataDiagnosticInfos);
     }
 
-*/
 
 /*  DISABLED
 
@@ -2089,8 +2044,10 @@ namespace OpcUa
         *this << data.View;
         SerializeContainer(*this, data.NodeTypes);
         *this << data.Filter;
-        *this << data.MaxDataSetsToReturn;
-        *this << data.MaxReferencesToReturn;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.MaxDataSetsToReturn);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.MaxReferencesToReturn);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -2107,8 +2064,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<QueryFirstResult>(const QueryFirstResult& data)
     {
@@ -2119,9 +2074,6 @@ namespace OpcUa
         *this << data.FilterResult;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<QueryFirstResponse>(const QueryFirstResponse& data)
@@ -2131,9 +2083,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<QueryNextParameters>(const QueryNextParameters& data)
@@ -2142,9 +2091,6 @@ namespace OpcUa
         *this << data.ContinuationPoint;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<QueryNextRequest>(const QueryNextRequest& data)
@@ -2154,9 +2100,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<QueryNextResult>(const QueryNextResult& data)
@@ -2165,9 +2108,6 @@ namespace OpcUa
         *this << data.RevisedContinuationPoint;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<QueryNextResponse>(const QueryNextResponse& data)
@@ -2177,7 +2117,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<ReadValueId>(const ReadValueId& data)
@@ -2192,8 +2131,10 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<ReadParameters>(const ReadParameters& data)
     {
-        *this << data.MaxAge;
-        *this << data.TimestampsToReturn;
+        char block1[12];
+        FixedCodec<double>::Store(block1 + 0, data.MaxAge);
+        FixedCodec<OpcUa::TimestampsToReturn>::Store(block1 + 8, data.TimestampsToReturn);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.AttributesToRead);
     }
 
@@ -2260,13 +2201,15 @@ namespace OpcUa
     void DataSerializer::Serialize<ReadRawModifiedDetails>(const ReadRawModifiedDetails& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.IsReadModified;
-        *this << data.StartTime;
-        *this << data.EndTime;
-        *this << data.NumValuesPerNode;
-        *this << data.ReturnBounds;
+        char block1[27];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<bool>::Store(block1 + 5, data.IsReadModified);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 6, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 14, data.EndTime);
+        FixedCodec<uint32_t>::Store(block1 + 22, data.NumValuesPerNode);
+        FixedCodec<bool>::Store(block1 + 26, data.ReturnBounds);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -2277,31 +2220,32 @@ namespace OpcUa
     void DataSerializer::Serialize<ReadAtTimeDetails>(const ReadAtTimeDetails& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        SerializeContainer(*this, data.ReqTimes);
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
+        SerializeFixedContainer(*this, data.ReqTimes);
         *this << data.UseSimpleBounds;
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<HistoryData>(const HistoryData& data)
     {
         SerializeContainer(*this, data.DataValues);
     }
 
-*/
 
 /*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModificationInfo>(const ModificationInfo& data)
     {
-        *this << data.ModificationTime;
-        *this << data.UpdateType;
+        char block1[12];
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 0, data.ModificationTime);
+        FixedCodec<OpcUa::HistoryUpdateType>::Store(block1 + 8, data.UpdateType);
+        Write(block1, sizeof(block1));
         *this << data.UserName;
     }
 
@@ -2324,8 +2268,10 @@ namespace OpcUa
     void DataSerializer::Serialize<HistoryReadParameters>(const HistoryReadParameters& data)
     {
         *this << data.HistoryReadDetails;
-        *this << data.TimestampsToReturn;
-        *this << data.ReleaseContinuationPoints;
+        char block1[5];
+        FixedCodec<OpcUa::TimestampsToReturn>::Store(block1 + 0, data.TimestampsToReturn);
+        FixedCodec<bool>::Store(block1 + 4, data.ReleaseContinuationPoints);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.AttributesToRead);
     }
 
@@ -2387,22 +2333,17 @@ namespace OpcUa
     {
         *this << data.TypeId;
         *this << data.Header;
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<HistoryUpdateDetails>(const HistoryUpdateDetails& data)
     {
         *this << data.NodeId;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<UpdateDataDetails>(const UpdateDataDetails& data)
@@ -2412,9 +2353,6 @@ namespace OpcUa
         SerializeContainer(*this, data.UpdateValues);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<UpdateStructureDataDetails>(const UpdateStructureDataDetails& data)
@@ -2424,33 +2362,26 @@ namespace OpcUa
         SerializeContainer(*this, data.UpdateValues);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DeleteRawModifiedDetails>(const DeleteRawModifiedDetails& data)
     {
         *this << data.NodeId;
-        *this << data.IsDeleteModified;
-        *this << data.StartTime;
-        *this << data.EndTime;
+        char block1[17];
+        FixedCodec<bool>::Store(block1 + 0, data.IsDeleteModified);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 1, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 9, data.EndTime);
+        Write(block1, sizeof(block1));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DeleteAtTimeDetails>(const DeleteAtTimeDetails& data)
     {
         *this << data.NodeId;
-        SerializeContainer(*this, data.ReqTimes);
+        SerializeFixedContainer(*this, data.ReqTimes);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DeleteEventDetails>(const DeleteEventDetails& data)
@@ -2459,21 +2390,15 @@ namespace OpcUa
         SerializeContainer(*this, data.EventIds);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<HistoryUpdateResult>(const HistoryUpdateResult& data)
     {
         *this << data.Status;
-        SerializeContainer(*this, data.OperationResults);
+        SerializeFixedContainer(*this, data.OperationResults);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<HistoryUpdateParameters>(const HistoryUpdateParameters& data)
@@ -2481,9 +2406,6 @@ namespace OpcUa
         SerializeContainer(*this, data.HistoryUpdateDetails);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<HistoryUpdateRequest>(const HistoryUpdateRequest& data)
@@ -2493,9 +2415,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<HistoryUpdateResponse>(const HistoryUpdateResponse& data)
@@ -2506,7 +2425,6 @@ namespace OpcUa
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<CallMethodRequest>(const CallMethodRequest& data)
@@ -2521,7 +2439,7 @@ namespace OpcUa
     void DataSerializer::Serialize<CallMethodResult>(const CallMethodResult& data)
     {
         *this << data.Status;
-        SerializeContainer(*this, data.InputArgumentResults);
+        SerializeFixedContainer(*this, data.InputArgumentResults);
         SerializeContainer(*this, data.InputArgumentDiagnosticInfos);
         SerializeContainer(*this, data.OutputArguments);
     }
@@ -2571,11 +2489,13 @@ namespace OpcUa
     void DataSerializer::Serialize<DataChangeFilter>(const DataChangeFilter& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.Trigger;
-        *this << data.DeadbandType;
-        *this << data.DeadbandValue;
+        char block1[21];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DataChangeTrigger>::Store(block1 + 5, data.Trigger);
+        FixedCodec<uint32_t>::Store(block1 + 9, data.DeadbandType);
+        FixedCodec<double>::Store(block1 + 13, data.DeadbandValue);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -2586,40 +2506,43 @@ namespace OpcUa
     void DataSerializer::Serialize<EventFilter>(const EventFilter& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.SelectClauses);
         *this << data.WhereClause;
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<ReadEventDetails>(const ReadEventDetails& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.NumValuesPerNode;
-        *this << data.StartTime;
-        *this << data.EndTime;
+        char block1[25];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<uint32_t>::Store(block1 + 5, data.NumValuesPerNode);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 9, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 17, data.EndTime);
+        Write(block1, sizeof(block1));
         *this << data.Filter;
     }
 
-*/
 
 /*  DISABLED
 
     template<>
     void DataSerializer::Serialize<AggregateConfiguration>(const AggregateConfiguration& data)
     {
-        *this << data.UseServerCapabilitiesDefaults;
-        *this << data.TreatUncertainAsBad;
-        *this << data.PercentDataBad;
-        *this << data.PercentDataGood;
-        *this << data.UseSlopedExtrapolation;
+        char block1[5];
+        FixedCodec<bool>::Store(block1 + 0, data.UseServerCapabilitiesDefaults);
+        FixedCodec<bool>::Store(block1 + 1, data.TreatUncertainAsBad);
+        FixedCodec<uint8_t>::Store(block1 + 2, data.PercentDataBad);
+        FixedCodec<uint8_t>::Store(block1 + 3, data.PercentDataGood);
+        FixedCodec<bool>::Store(block1 + 4, data.UseSlopedExtrapolation);
+        Write(block1, sizeof(block1));
     }
 
 */
@@ -2630,11 +2553,13 @@ namespace OpcUa
     void DataSerializer::Serialize<ReadProcessedDetails>(const ReadProcessedDetails& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.StartTime;
-        *this << data.EndTime;
-        *this << data.ProcessingInterval;
+        char block1[29];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 5, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 13, data.EndTime);
+        FixedCodec<double>::Store(block1 + 21, data.ProcessingInterval);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.AggregateType);
         *this << data.AggregateConfiguration;
     }
@@ -2647,9 +2572,11 @@ namespace OpcUa
     void DataSerializer::Serialize<AggregateFilter>(const AggregateFilter& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.StartTime;
+        char block1[13];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 5, data.StartTime);
+        Write(block1, sizeof(block1));
         *this << data.AggregateType;
         *this << data.ProcessingInterval;
         *this << data.AggregateConfiguration;
@@ -2657,8 +2584,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<MonitoringFilterResult>(const MonitoringFilterResult& data)
     {
@@ -2667,24 +2592,20 @@ namespace OpcUa
         if ((data.Encoding) & (1<<(0))) *this << data.Body;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<EventFilterResult>(const EventFilterResult& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        SerializeContainer(*this, data.SelectClauseResults);
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
+        SerializeFixedContainer(*this, data.SelectClauseResults);
         SerializeContainer(*this, data.SelectClauseDiagnosticInfos);
         *this << data.WhereClauseResult;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<HistoryUpdateEventResult>(const HistoryUpdateEventResult& data)
@@ -2693,7 +2614,6 @@ namespace OpcUa
         *this << data.EventFilterResult;
     }
 
-*/
 
 /*  DISABLED
 
@@ -2701,10 +2621,12 @@ namespace OpcUa
     void DataSerializer::Serialize<AggregateFilterResult>(const AggregateFilterResult& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.RevisedStartTime;
-        *this << data.RevisedProcessingInterval;
+        char block1[21];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 5, data.RevisedStartTime);
+        FixedCodec<double>::Store(block1 + 13, data.RevisedProcessingInterval);
+        Write(block1, sizeof(block1));
         *this << data.RevisedAggregateConfiguration;
     }
 
@@ -2713,11 +2635,15 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<MonitoringParameters>(const MonitoringParameters& data)
     {
-        *this << data.ClientHandle;
-        *this << data.SamplingInterval;
+        char block1[12];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.ClientHandle);
+        FixedCodec<double>::Store(block1 + 4, data.SamplingInterval);
+        Write(block1, sizeof(block1));
         *this << data.Filter;
-        *this << data.QueueSize;
-        *this << data.DiscardOldest;
+        char block2[5];
+        FixedCodec<uint32_t>::Store(block2 + 0, data.QueueSize);
+        FixedCodec<bool>::Store(block2 + 4, data.DiscardOldest);
+        Write(block2, sizeof(block2));
     }
 
 
@@ -2733,10 +2659,12 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<MonitoredItemCreateResult>(const MonitoredItemCreateResult& data)
     {
-        *this << data.Status;
-        *this << data.MonitoredItemId;
-        *this << data.RevisedSamplingInterval;
-        *this << data.RevisedQueueSize;
+        char block1[20];
+        FixedCodec<OpcUa::StatusCode>::Store(block1 + 0, data.Status);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.MonitoredItemId);
+        FixedCodec<double>::Store(block1 + 8, data.RevisedSamplingInterval);
+        FixedCodec<uint32_t>::Store(block1 + 16, data.RevisedQueueSize);
+        Write(block1, sizeof(block1));
         *this << data.FilterResult;
     }
 
@@ -2744,8 +2672,10 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<MonitoredItemsParameters>(const MonitoredItemsParameters& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.TimestampsToReturn;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.SubscriptionId);
+        FixedCodec<OpcUa::TimestampsToReturn>::Store(block1 + 4, data.TimestampsToReturn);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.ItemsToCreate);
     }
 
@@ -2769,8 +2699,6 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<MonitoredItemModifyRequest>(const MonitoredItemModifyRequest& data)
     {
@@ -2778,34 +2706,29 @@ namespace OpcUa
         *this << data.RequestedParameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<MonitoredItemModifyResult>(const MonitoredItemModifyResult& data)
     {
-        *this << data.Status;
-        *this << data.RevisedSamplingInterval;
-        *this << data.RevisedQueueSize;
+        char block1[16];
+        FixedCodec<OpcUa::StatusCode>::Store(block1 + 0, data.Status);
+        FixedCodec<double>::Store(block1 + 4, data.RevisedSamplingInterval);
+        FixedCodec<uint32_t>::Store(block1 + 12, data.RevisedQueueSize);
+        Write(block1, sizeof(block1));
         *this << data.FilterResult;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModifyMonitoredItemsParameters>(const ModifyMonitoredItemsParameters& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.TimestampsToReturn;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.SubscriptionId);
+        FixedCodec<OpcUa::TimestampsToReturn>::Store(block1 + 4, data.TimestampsToReturn);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.ItemsToModify);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModifyMonitoredItemsRequest>(const ModifyMonitoredItemsRequest& data)
@@ -2815,9 +2738,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModifyMonitoredItemsResponse>(const ModifyMonitoredItemsResponse& data)
@@ -2828,21 +2748,17 @@ namespace OpcUa
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetMonitoringModeParameters>(const SetMonitoringModeParameters& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.MonitoringMode;
-        SerializeContainer(*this, data.MonitoredItemIds);
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.SubscriptionId);
+        FixedCodec<OpcUa::MonitoringMode>::Store(block1 + 4, data.MonitoringMode);
+        Write(block1, sizeof(block1));
+        SerializeFixedContainer(*this, data.MonitoredItemIds);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetMonitoringModeRequest>(const SetMonitoringModeRequest& data)
@@ -2852,20 +2768,14 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetMonitoringModeResult>(const SetMonitoringModeResult& data)
     {
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetMonitoringModeResponse>(const SetMonitoringModeResponse& data)
@@ -2875,22 +2785,18 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetTriggeringParameters>(const SetTriggeringParameters& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.TriggeringItemId;
-        SerializeContainer(*this, data.LinksToAdd);
-        SerializeContainer(*this, data.LinksToRemove);
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.SubscriptionId);
+        FixedCodec<uint32_t>::Store(block1 + 4, data.TriggeringItemId);
+        Write(block1, sizeof(block1));
+        SerializeFixedContainer(*this, data.LinksToAdd);
+        SerializeFixedContainer(*this, data.LinksToRemove);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetTriggeringRequest>(const SetTriggeringRequest& data)
@@ -2900,22 +2806,16 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetTriggeringResult>(const SetTriggeringResult& data)
     {
-        SerializeContainer(*this, data.AddResults);
+        SerializeFixedContainer(*this, data.AddResults);
         SerializeContainer(*this, data.AddDiagnosticInfos);
-        SerializeContainer(*this, data.RemoveResults);
+        SerializeFixedContainer(*this, data.RemoveResults);
         SerializeContainer(*this, data.RemoveDiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SetTriggeringResponse>(const SetTriggeringResponse& data)
@@ -2925,13 +2825,12 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<DeleteMonitoredItemsParameters>(const DeleteMonitoredItemsParameters& data)
     {
         *this << data.SubscriptionId;
-        SerializeContainer(*this, data.MonitoredItemIds);
+        SerializeFixedContainer(*this, data.MonitoredItemIds);
     }
 
 
@@ -2949,7 +2848,7 @@ namespace OpcUa
     {
         *this << data.TypeId;
         *this << data.Header;
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -2957,12 +2856,9 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<CreateSubscriptionParameters>(const CreateSubscriptionParameters& data)
     {
-        *this << data.RequestedPublishingInterval;
-        *this << data.RequestedLifetimeCount;
-        *this << data.RequestedMaxKeepAliveCount;
-        *this << data.MaxNotificationsPerPublish;
-        *this << data.PublishingEnabled;
-        *this << data.Priority;
+        char block[FixedCodec<CreateSubscriptionParameters>::Size];
+        FixedCodec<CreateSubscriptionParameters>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
 
@@ -2978,10 +2874,9 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<SubscriptionData>(const SubscriptionData& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.RevisedPublishingInterval;
-        *this << data.RevisedLifetimeCount;
-        *this << data.RevisedMaxKeepAliveCount;
+        char block[FixedCodec<SubscriptionData>::Size];
+        FixedCodec<SubscriptionData>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
 
@@ -2994,22 +2889,14 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<ModifySubscriptionParameters>(const ModifySubscriptionParameters& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.RequestedPublishingInterval;
-        *this << data.RequestedLifetimeCount;
-        *this << data.RequestedMaxKeepAliveCount;
-        *this << data.MaxNotificationsPerPublish;
-        *this << data.Priority;
+        char block[FixedCodec<ModifySubscriptionParameters>::Size];
+        FixedCodec<ModifySubscriptionParameters>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModifySubscriptionRequest>(const ModifySubscriptionRequest& data)
@@ -3019,21 +2906,15 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModifySubscriptionResult>(const ModifySubscriptionResult& data)
     {
-        *this << data.RevisedPublishingInterval;
-        *this << data.RevisedLifetimeCount;
-        *this << data.RevisedMaxKeepAliveCount;
+        char block[FixedCodec<ModifySubscriptionResult>::Size];
+        FixedCodec<ModifySubscriptionResult>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModifySubscriptionResponse>(const ModifySubscriptionResponse& data)
@@ -3043,13 +2924,12 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<PublishingModeParameters>(const PublishingModeParameters& data)
     {
         *this << data.PublishingEnabled;
-        SerializeContainer(*this, data.SubscriptionIds);
+        SerializeFixedContainer(*this, data.SubscriptionIds);
     }
 
 
@@ -3065,7 +2945,7 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<PublishingModeResult>(const PublishingModeResult& data)
     {
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -3082,8 +2962,10 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<NotificationMessage>(const NotificationMessage& data)
     {
-        *this << data.SequenceNumber;
-        *this << data.PublishTime;
+        char block1[12];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.SequenceNumber);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 4, data.PublishTime);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.NotificationData);
     }
 
@@ -3100,8 +2982,6 @@ namespace OpcUa
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<MonitoredItemNotification>(const MonitoredItemNotification& data)
     {
@@ -3109,7 +2989,6 @@ namespace OpcUa
         *this << data.Value;
     }
 
-*/
 
 /*  DISABLED
 
@@ -3117,8 +2996,10 @@ namespace OpcUa
     void DataSerializer::Serialize<DataChangeNotification>(const DataChangeNotification& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.MonitoredItems);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
@@ -3142,24 +3023,21 @@ namespace OpcUa
     void DataSerializer::Serialize<EventNotificationList>(const EventNotificationList& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        Write(block1, sizeof(block1));
         SerializeContainer(*this, data.Events);
     }
 
 */
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<HistoryEventFieldList>(const HistoryEventFieldList& data)
     {
         SerializeContainer(*this, data.EventFields);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<HistoryEvent>(const HistoryEvent& data)
@@ -3167,9 +3045,6 @@ namespace OpcUa
         SerializeContainer(*this, data.Events);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<UpdateEventDetails>(const UpdateEventDetails& data)
@@ -3180,7 +3055,6 @@ namespace OpcUa
         SerializeContainer(*this, data.EventData);
     }
 
-*/
 
 /*  DISABLED
 
@@ -3188,9 +3062,11 @@ namespace OpcUa
     void DataSerializer::Serialize<StatusChangeNotification>(const StatusChangeNotification& data)
     {
         *this << data.TypeId;
-        *this << data.Encoding;
-        *this << data.BodyLength;
-        *this << data.Status;
+        char block1[9];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.Encoding);
+        FixedCodec<int32_t>::Store(block1 + 1, data.BodyLength);
+        FixedCodec<OpcUa::StatusCode>::Store(block1 + 5, data.Status);
+        Write(block1, sizeof(block1));
         *this << data.DiagnosticInfo;
     }
 
@@ -3199,8 +3075,9 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<SubscriptionAcknowledgement>(const SubscriptionAcknowledgement& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.SequenceNumber;
+        char block[FixedCodec<SubscriptionAcknowledgement>::Size];
+        FixedCodec<SubscriptionAcknowledgement>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
 
@@ -3209,7 +3086,7 @@ namespace OpcUa
     {
         *this << data.TypeId;
         *this << data.Header;
-        SerializeContainer(*this, data.SubscriptionAcknowledgements);
+        SerializeFixedContainer(*this, data.SubscriptionAcknowledgements);
     }
 
 
@@ -3217,10 +3094,10 @@ namespace OpcUa
     void DataSerializer::Serialize<PublishResult>(const PublishResult& data)
     {
         *this << data.SubscriptionId;
-        SerializeContainer(*this, data.AvailableSequenceNumbers);
+        SerializeFixedContainer(*this, data.AvailableSequenceNumbers);
         *this << data.MoreNotifications;
         *this << data.NotificationMessage;
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
@@ -3237,8 +3114,9 @@ namespace OpcUa
     template<>
     void DataSerializer::Serialize<RepublishParameters>(const RepublishParameters& data)
     {
-        *this << data.SubscriptionId;
-        *this << data.RetransmitSequenceNumber;
+        char block[FixedCodec<RepublishParameters>::Size];
+        FixedCodec<RepublishParameters>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
 
@@ -3260,29 +3138,21 @@ namespace OpcUa
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<TransferResult>(const TransferResult& data)
     {
         *this << data.Status;
-        SerializeContainer(*this, data.AvailableSequenceNumbers);
+        SerializeFixedContainer(*this, data.AvailableSequenceNumbers);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TransferSubscriptionsParameters>(const TransferSubscriptionsParameters& data)
     {
-        SerializeContainer(*this, data.SubscriptionIds);
+        SerializeFixedContainer(*this, data.SubscriptionIds);
         *this << data.SendInitialValues;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TransferSubscriptionsRequest>(const TransferSubscriptionsRequest& data)
@@ -3292,9 +3162,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TransferSubscriptionsResult>(const TransferSubscriptionsResult& data)
@@ -3303,9 +3170,6 @@ namespace OpcUa
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TransferSubscriptionsResponse>(const TransferSubscriptionsResponse& data)
@@ -3315,14 +3179,13 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<DeleteSubscriptionsRequest>(const DeleteSubscriptionsRequest& data)
     {
         *this << data.TypeId;
         *this << data.Header;
-        SerializeContainer(*this, data.SubscriptionIds);
+        SerializeFixedContainer(*this, data.SubscriptionIds);
     }
 
 
@@ -3331,27 +3194,27 @@ namespace OpcUa
     {
         *this << data.TypeId;
         *this << data.Header;
-        SerializeContainer(*this, data.Results);
+        SerializeFixedContainer(*this, data.Results);
         SerializeContainer(*this, data.DiagnosticInfos);
     }
 
 
-/*  DISABLED
-
     template<>
     void DataSerializer::Serialize<ScalarTestType>(const ScalarTestType& data)
     {
-        *this << data.Boolean;
-        *this << data.SByte;
-        *this << data.Byte;
-        *this << data.Int16;
-        *this << data.UInt16;
-        *this << data.Int32;
-        *this << data.UInt32;
-        *this << data.Int64;
-        *this << data.UInt64;
-        *this << data.Float;
-        *this << data.Double;
+        char block1[43];
+        FixedCodec<bool>::Store(block1 + 0, data.Boolean);
+        FixedCodec<uint8_t>::Store(block1 + 1, data.SByte);
+        FixedCodec<uint8_t>::Store(block1 + 2, data.Byte);
+        FixedCodec<int16_t>::Store(block1 + 3, data.Int16);
+        FixedCodec<uint16_t>::Store(block1 + 5, data.UInt16);
+        FixedCodec<int32_t>::Store(block1 + 7, data.Int32);
+        FixedCodec<uint32_t>::Store(block1 + 11, data.UInt32);
+        FixedCodec<int64_t>::Store(block1 + 15, data.Int64);
+        FixedCodec<uint64_t>::Store(block1 + 23, data.UInt64);
+        FixedCodec<float>::Store(block1 + 31, data.Float);
+        FixedCodec<double>::Store(block1 + 35, data.Double);
+        Write(block1, sizeof(block1));
         *this << data.String;
         *this << data.DateTime;
         *this << data.Guid;
@@ -3368,43 +3231,37 @@ namespace OpcUa
         *this << data.EnumeratedValue;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ArrayTestType>(const ArrayTestType& data)
     {
-        SerializeContainer(*this, data.Booleans);
-        SerializeContainer(*this, data.SBytes);
-        SerializeContainer(*this, data.Int16s);
-        SerializeContainer(*this, data.UInt16s);
-        SerializeContainer(*this, data.Int32s);
-        SerializeContainer(*this, data.UInt32s);
-        SerializeContainer(*this, data.Int64s);
-        SerializeContainer(*this, data.UInt64s);
-        SerializeContainer(*this, data.Floats);
-        SerializeContainer(*this, data.Doubles);
+        SerializeFixedContainer(*this, data.Booleans);
+        SerializeFixedContainer(*this, data.SBytes);
+        SerializeFixedContainer(*this, data.Int16s);
+        SerializeFixedContainer(*this, data.UInt16s);
+        SerializeFixedContainer(*this, data.Int32s);
+        SerializeFixedContainer(*this, data.UInt32s);
+        SerializeFixedContainer(*this, data.Int64s);
+        SerializeFixedContainer(*this, data.UInt64s);
+        SerializeFixedContainer(*this, data.Floats);
+        SerializeFixedContainer(*this, data.Doubles);
         SerializeContainer(*this, data.Strings);
-        SerializeContainer(*this, data.DateTimes);
+        SerializeFixedContainer(*this, data.DateTimes);
         SerializeContainer(*this, data.Guids);
         SerializeContainer(*this, data.ByteStrings);
         SerializeContainer(*this, data.XmlElements);
         SerializeContainer(*this, data.NodeIds);
         SerializeContainer(*this, data.ExpandedNodeIds);
-        SerializeContainer(*this, data.StatusCodes);
+        SerializeFixedContainer(*this, data.StatusCodes);
         SerializeContainer(*this, data.DiagnosticInfos);
         SerializeContainer(*this, data.QualifiedNames);
         SerializeContainer(*this, data.LocalizedTexts);
         SerializeContainer(*this, data.ExtensionObjects);
         SerializeContainer(*this, data.DataValues);
         SerializeContainer(*this, data.Variants);
-        SerializeContainer(*this, data.EnumeratedValues);
+        SerializeFixedContainer(*this, data.EnumeratedValues);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<CompositeTestType>(const CompositeTestType& data)
@@ -3413,21 +3270,17 @@ namespace OpcUa
         *this << data.Field2;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackParameters>(const TestStackParameters& data)
     {
-        *this << data.TestId;
-        *this << data.Iteration;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.TestId);
+        FixedCodec<int32_t>::Store(block1 + 4, data.Iteration);
+        Write(block1, sizeof(block1));
         *this << data.Input;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackRequest>(const TestStackRequest& data)
@@ -3437,9 +3290,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackResult>(const TestStackResult& data)
@@ -3447,9 +3297,6 @@ namespace OpcUa
         *this << data.Output;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackResponse>(const TestStackResponse& data)
@@ -3459,21 +3306,17 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackExParameters>(const TestStackExParameters& data)
     {
-        *this << data.TestId;
-        *this << data.Iteration;
+        char block1[8];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.TestId);
+        FixedCodec<int32_t>::Store(block1 + 4, data.Iteration);
+        Write(block1, sizeof(block1));
         *this << data.Input;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackExRequest>(const TestStackExRequest& data)
@@ -3483,9 +3326,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackExResult>(const TestStackExResult& data)
@@ -3493,9 +3333,6 @@ namespace OpcUa
         *this << data.Output;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<TestStackExResponse>(const TestStackExResponse& data)
@@ -3505,9 +3342,6 @@ namespace OpcUa
         *this << data.Parameters;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<BuildInfo>(const BuildInfo& data)
@@ -3520,21 +3354,17 @@ namespace OpcUa
         *this << data.BuildDate;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<RedundantServerDataType>(const RedundantServerDataType& data)
     {
         *this << data.ServerId;
-        *this << data.ServiceLevel;
-        *this << data.ServerState;
+        char block1[5];
+        FixedCodec<uint8_t>::Store(block1 + 0, data.ServiceLevel);
+        FixedCodec<OpcUa::ServerState>::Store(block1 + 1, data.ServerState);
+        Write(block1, sizeof(block1));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<EndpointUrlListDataType>(const EndpointUrlListDataType& data)
@@ -3542,9 +3372,6 @@ namespace OpcUa
         SerializeContainer(*this, data.EndpointUrlList);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<NetworkGroupDataType>(const NetworkGroupDataType& data)
@@ -3553,58 +3380,38 @@ namespace OpcUa
         SerializeContainer(*this, data.NetworkPaths);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SamplingIntervalDiagnosticsDataType>(const SamplingIntervalDiagnosticsDataType& data)
     {
-        *this << data.SamplingInterval;
-        *this << data.MonitoredItemCount;
-        *this << data.MaxMonitoredItemCount;
-        *this << data.DisabledMonitoredItemCount;
+        char block[FixedCodec<SamplingIntervalDiagnosticsDataType>::Size];
+        FixedCodec<SamplingIntervalDiagnosticsDataType>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ServerDiagnosticsSummaryDataType>(const ServerDiagnosticsSummaryDataType& data)
     {
-        *this << data.ServerViewCount;
-        *this << data.CurrentSessionCount;
-        *this << data.CumulatedSessionCount;
-        *this << data.SecurityRejectedSessionCount;
-        *this << data.RejectedSessionCount;
-        *this << data.SessionTimeoutCount;
-        *this << data.SessionAbortCount;
-        *this << data.CurrentSubscriptionCount;
-        *this << data.CumulatedSubscriptionCount;
-        *this << data.PublishingIntervalCount;
-        *this << data.SecurityRejectedRequestsCount;
-        *this << data.RejectedRequestsCount;
+        char block[FixedCodec<ServerDiagnosticsSummaryDataType>::Size];
+        FixedCodec<ServerDiagnosticsSummaryDataType>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ServerStatusDataType>(const ServerStatusDataType& data)
     {
-        *this << data.StartTime;
-        *this << data.CurrentTime;
-        *this << data.State;
+        char block1[20];
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 0, data.StartTime);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 8, data.CurrentTime);
+        FixedCodec<OpcUa::ServerState>::Store(block1 + 16, data.State);
+        Write(block1, sizeof(block1));
         *this << data.BuildInfo;
         *this << data.SecondsTillShutdown;
         *this << data.ShutdownReason;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SessionSecurityDiagnosticsDataType>(const SessionSecurityDiagnosticsDataType& data)
@@ -3620,20 +3427,15 @@ namespace OpcUa
         *this << data.ClientCertificate;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ServiceCounterDataType>(const ServiceCounterDataType& data)
     {
-        *this << data.TotalCount;
-        *this << data.ErrorCount;
+        char block[FixedCodec<ServiceCounterDataType>::Size];
+        FixedCodec<ServiceCounterDataType>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SessionDiagnosticsDataType>(const SessionDiagnosticsDataType& data)
@@ -3644,48 +3446,47 @@ namespace OpcUa
         *this << data.ServerUri;
         *this << data.EndpointUrl;
         SerializeContainer(*this, data.LocaleIds);
-        *this << data.ActualSessionTimeout;
-        *this << data.MaxResponseMessageSize;
-        *this << data.ClientConnectionTime;
-        *this << data.ClientLastContactTime;
-        *this << data.CurrentSubscriptionsCount;
-        *this << data.CurrentMonitoredItemsCount;
-        *this << data.CurrentPublishRequestsInQueue;
-        *this << data.TotalRequestCount;
-        *this << data.UnauthorizedRequestCount;
-        *this << data.ReadCount;
-        *this << data.HistoryReadCount;
-        *this << data.WriteCount;
-        *this << data.HistoryUpdateCount;
-        *this << data.CallCount;
-        *this << data.CreateMonitoredItemsCount;
-        *this << data.ModifyMonitoredItemsCount;
-        *this << data.SetMonitoringModeCount;
-        *this << data.SetTriggeringCount;
-        *this << data.DeleteMonitoredItemsCount;
-        *this << data.CreateSubscriptionCount;
-        *this << data.ModifySubscriptionCount;
-        *this << data.SetPublishingModeCount;
-        *this << data.PublishCount;
-        *this << data.RepublishCount;
-        *this << data.TransferSubscriptionsCount;
-        *this << data.DeleteSubscriptionsCount;
-        *this << data.AddNodesCount;
-        *this << data.AddReferencesCount;
-        *this << data.DeleteNodesCount;
-        *this << data.DeleteReferencesCount;
-        *this << data.BrowseCount;
-        *this << data.BrowseNextCount;
-        *this << data.TranslateBrowsePathsToNodeIdsCount;
-        *this << data.QueryFirstCount;
-        *this << data.QueryNextCount;
-        *this << data.RegisterNodesCount;
-        *this << data.UnregisterNodesCount;
+        char block1[276];
+        FixedCodec<double>::Store(block1 + 0, data.ActualSessionTimeout);
+        FixedCodec<uint32_t>::Store(block1 + 8, data.MaxResponseMessageSize);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 12, data.ClientConnectionTime);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 20, data.ClientLastContactTime);
+        FixedCodec<uint32_t>::Store(block1 + 28, data.CurrentSubscriptionsCount);
+        FixedCodec<uint32_t>::Store(block1 + 32, data.CurrentMonitoredItemsCount);
+        FixedCodec<uint32_t>::Store(block1 + 36, data.CurrentPublishRequestsInQueue);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 40, data.TotalRequestCount);
+        FixedCodec<uint32_t>::Store(block1 + 48, data.UnauthorizedRequestCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 52, data.ReadCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 60, data.HistoryReadCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 68, data.WriteCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 76, data.HistoryUpdateCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 84, data.CallCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 92, data.CreateMonitoredItemsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 100, data.ModifyMonitoredItemsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 108, data.SetMonitoringModeCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 116, data.SetTriggeringCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 124, data.DeleteMonitoredItemsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 132, data.CreateSubscriptionCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 140, data.ModifySubscriptionCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 148, data.SetPublishingModeCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 156, data.PublishCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 164, data.RepublishCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 172, data.TransferSubscriptionsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 180, data.DeleteSubscriptionsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 188, data.AddNodesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 196, data.AddReferencesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 204, data.DeleteNodesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 212, data.DeleteReferencesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 220, data.BrowseCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 228, data.BrowseNextCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 236, data.TranslateBrowsePathsToNodeIdsCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 244, data.QueryFirstCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 252, data.QueryNextCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 260, data.RegisterNodesCount);
+        FixedCodec<OpcUa::ServiceCounterDataType>::Store(block1 + 268, data.UnregisterNodesCount);
+        Write(block1, sizeof(block1));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<StatusResult>(const StatusResult& data)
@@ -3694,49 +3495,45 @@ namespace OpcUa
         *this << data.DiagnosticInfo;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SubscriptionDiagnosticsDataType>(const SubscriptionDiagnosticsDataType& data)
     {
         *this << data.SessionId;
-        *this << data.SubscriptionId;
-        *this << data.Priority;
-        *this << data.PublishingInterval;
-        *this << data.MaxKeepAliveCount;
-        *this << data.MaxLifetimeCount;
-        *this << data.MaxNotificationsPerPublish;
-        *this << data.PublishingEnabled;
-        *this << data.ModifyCount;
-        *this << data.EnableCount;
-        *this << data.DisableCount;
-        *this << data.RepublishRequestCount;
-        *this << data.RepublishMessageRequestCount;
-        *this << data.RepublishMessageCount;
-        *this << data.TransferRequestCount;
-        *this << data.TransferredToAltClientCount;
-        *this << data.TransferredToSameClientCount;
-        *this << data.PublishRequestCount;
-        *this << data.DataChangeNotificationsCount;
-        *this << data.EventNotificationsCount;
-        *this << data.NotificationsCount;
-        *this << data.LatePublishRequestCount;
-        *this << data.CurrentKeepAliveCount;
-        *this << data.CurrentLifetimeCount;
-        *this << data.UnacknowledgedMessageCount;
-        *this << data.DiscardedMessageCount;
-        *this << data.MonitoredItemCount;
-        *this << data.DisabledMonitoredItemCount;
-        *this << data.MonitoringQueueOverflowCount;
-        *this << data.NextSequenceNumber;
-        *this << data.EventQueueOverFlowCount;
+        char block1[118];
+        FixedCodec<uint32_t>::Store(block1 + 0, data.SubscriptionId);
+        FixedCodec<uint8_t>::Store(block1 + 4, data.Priority);
+        FixedCodec<double>::Store(block1 + 5, data.PublishingInterval);
+        FixedCodec<uint32_t>::Store(block1 + 13, data.MaxKeepAliveCount);
+        FixedCodec<uint32_t>::Store(block1 + 17, data.MaxLifetimeCount);
+        FixedCodec<uint32_t>::Store(block1 + 21, data.MaxNotificationsPerPublish);
+        FixedCodec<bool>::Store(block1 + 25, data.PublishingEnabled);
+        FixedCodec<uint32_t>::Store(block1 + 26, data.ModifyCount);
+        FixedCodec<uint32_t>::Store(block1 + 30, data.EnableCount);
+        FixedCodec<uint32_t>::Store(block1 + 34, data.DisableCount);
+        FixedCodec<uint32_t>::Store(block1 + 38, data.RepublishRequestCount);
+        FixedCodec<uint32_t>::Store(block1 + 42, data.RepublishMessageRequestCount);
+        FixedCodec<uint32_t>::Store(block1 + 46, data.RepublishMessageCount);
+        FixedCodec<uint32_t>::Store(block1 + 50, data.TransferRequestCount);
+        FixedCodec<uint32_t>::Store(block1 + 54, data.TransferredToAltClientCount);
+        FixedCodec<uint32_t>::Store(block1 + 58, data.TransferredToSameClientCount);
+        FixedCodec<uint32_t>::Store(block1 + 62, data.PublishRequestCount);
+        FixedCodec<uint32_t>::Store(block1 + 66, data.DataChangeNotificationsCount);
+        FixedCodec<uint32_t>::Store(block1 + 70, data.EventNotificationsCount);
+        FixedCodec<uint32_t>::Store(block1 + 74, data.NotificationsCount);
+        FixedCodec<uint32_t>::Store(block1 + 78, data.LatePublishRequestCount);
+        FixedCodec<uint32_t>::Store(block1 + 82, data.CurrentKeepAliveCount);
+        FixedCodec<uint32_t>::Store(block1 + 86, data.CurrentLifetimeCount);
+        FixedCodec<uint32_t>::Store(block1 + 90, data.UnacknowledgedMessageCount);
+        FixedCodec<uint32_t>::Store(block1 + 94, data.DiscardedMessageCount);
+        FixedCodec<uint32_t>::Store(block1 + 98, data.MonitoredItemCount);
+        FixedCodec<uint32_t>::Store(block1 + 102, data.DisabledMonitoredItemCount);
+        FixedCodec<uint32_t>::Store(block1 + 106, data.MonitoringQueueOverflowCount);
+        FixedCodec<uint32_t>::Store(block1 + 110, data.NextSequenceNumber);
+        FixedCodec<uint32_t>::Store(block1 + 114, data.EventQueueOverFlowCount);
+        Write(block1, sizeof(block1));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ModelChangeStructureDataType>(const ModelChangeStructureDataType& data)
@@ -3746,9 +3543,6 @@ namespace OpcUa
         *this << data.Verb;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<SemanticChangeStructureDataType>(const SemanticChangeStructureDataType& data)
@@ -3757,20 +3551,15 @@ namespace OpcUa
         *this << data.AffectedType;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<Range>(const Range& data)
     {
-        *this << data.Low;
-        *this << data.High;
+        char block[FixedCodec<Range>::Size];
+        FixedCodec<Range>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<EUInformation>(const EUInformation& data)
@@ -3781,31 +3570,24 @@ namespace OpcUa
         *this << data.Description;
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ComplexNumberType>(const ComplexNumberType& data)
     {
-        *this << data.Real;
-        *this << data.Imaginary;
+        char block[FixedCodec<ComplexNumberType>::Size];
+        FixedCodec<ComplexNumberType>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<DoubleComplexNumberType>(const DoubleComplexNumberType& data)
     {
-        *this << data.Real;
-        *this << data.Imaginary;
+        char block[FixedCodec<DoubleComplexNumberType>::Size];
+        FixedCodec<DoubleComplexNumberType>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<AxisInformation>(const AxisInformation& data)
@@ -3814,31 +3596,28 @@ namespace OpcUa
         *this << data.EURange;
         *this << data.Title;
         *this << data.AxisScaleType;
-        SerializeContainer(*this, data.AxisSteps);
+        SerializeFixedContainer(*this, data.AxisSteps);
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<XVType>(const XVType& data)
     {
-        *this << data.X;
-        *this << data.Value;
+        char block[FixedCodec<XVType>::Size];
+        FixedCodec<XVType>::Store(block, data);
+        Write(block, sizeof(block));
     }
 
-*/
-
-/*  DISABLED
 
     template<>
     void DataSerializer::Serialize<ProgramDiagnosticDataType>(const ProgramDiagnosticDataType& data)
     {
         *this << data.CreateSessionId;
         *this << data.CreateClientName;
-        *this << data.InvocationCreationTime;
-        *this << data.LastTransitionTime;
+        char block1[16];
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 0, data.InvocationCreationTime);
+        FixedCodec<OpcUa::DateTime>::Store(block1 + 8, data.LastTransitionTime);
+        Write(block1, sizeof(block1));
         *this << data.LastMethodCall;
         *this << data.LastMethodSessionId;
         SerializeContainer(*this, data.LastMethodInputArguments);
@@ -3847,7 +3626,6 @@ namespace OpcUa
         *this << data.LastMethodReturnStatus;
     }
 
-*/
 
     template<>
     void DataSerializer::Serialize<Annotation>(const Annotation& data)
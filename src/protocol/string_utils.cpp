@@ -22,6 +22,7 @@
 #include <ctime>
 #include <stdexcept>
 #include <sstream>
+#include <utility>
 #include <iomanip>
 #include <iostream>
 #include <limits>
@@ -29,37 +30,20 @@
 
 std::string OpcUa::ToString(const NodeId& id)
 {
-  std::stringstream stream;
-
-  if (id.HasServerIndex())
-  {
-    stream << "srv=" << id.ServerIndex << ";";
-  }
-  {
-  if (id.HasNamespaceURI())
-    stream << "nsu=" << id.NamespaceURI << ";";
-  }
-
-  stream << "ns=" << id.GetNamespaceIndex() << ";";
-  if (id.IsInteger())
-  {
-    stream << "i=" << id.GetIntegerIdentifier() << ";";
-  }
+  // srv=4294967295;ns=65535;g=<35 characters>; fits into 64 characters.
+  std::size_t size = 64 + id.NamespaceURI.size();
 #ifndef __ENABLE_EMBEDDED_PROFILE__
-  else if(id.IsString())
-  {
-    stream << "s=" << id.GetStringIdentifier() << ";";
-  }
-  else if (id.IsGuid())
+  if (id.IsString())
   {
-    stream << "g=" << ToString(id.GetGuidIdentifier()) << ";";
+    size += id.StringData.Identifier.size();
   }
 #endif
-
-  return stream.str();
+  std::string result(size, '\0');
+  const NodeIdFormatResult formatted = FormatNodeId(&result[0], &result[0] + size, id);
+  result.resize(formatted.Ptr - &result[0]);
+  return result;
 }
 
-
 std::string OpcUa::ToString(const OpcUa::Guid& guid)
 {
   char buf[36] = {0};
@@ -111,103 +95,301 @@ OpcUa::Guid OpcUa::ToGuid(const std::string& str)
 
 namespace
 {
-  std::string GetNodeField(const std::string& data, const char* field)
+  struct Field
   {
-    std::size_t colon = 0;
-    do
+    const char* Begin = nullptr;
+    const char* End = nullptr;
+
+    bool Empty() const
+    {
+      return Begin == End;
+    }
+  };
+
+  bool StartsWith(const char* first, const char* last, const char* prefix, std::size_t size)
+  {
+    return static_cast<std::size_t>(last - first) >= size && std::memcmp(first, prefix, size) == 0;
+  }
+
+  // Only the first occurrence of a field counts, later ones are ignored.
+  void SetField(Field& field, const char* first, const char* last, std::size_t prefixSize)
+  {
+    if (!field.Begin)
     {
-      // if something found at previous cycle
-      if (colon)
+      field.Begin = first + prefixSize;
+      field.End = last;
+    }
+  }
+
+  std::errc ParseInteger(const Field& field, uint32_t max, uint32_t& value)
+  {
+    uint64_t result = 0;
+    for (const char* it = field.Begin; it != field.End; ++it)
+    {
+      if (*it < '0' || *it > '9')
       {
-        ++colon;
+        return std::errc::invalid_argument;
       }
-      // find field string
-      colon = data.find(field, colon);
-
-      // if found nothing
-      if (colon == std::string::npos)
+      result = result * 10 + (*it - '0');
+      if (result > max)
       {
-        return std::string();
+        return std::errc::result_out_of_range;
       }
-      // if found at the begin
-      if (colon == 0)
+    }
+    value = static_cast<uint32_t>(result);
+    return std::errc();
+  }
+
+  int HexDigit(char c)
+  {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+  }
+
+  bool ParseHex(const char*& it, unsigned digits, uint32_t& value)
+  {
+    value = 0;
+    for (unsigned i = 0; i < digits; ++i, ++it)
+    {
+      const int digit = HexDigit(*it);
+      if (digit < 0)
       {
-        break;
+        return false;
       }
+      value = (value << 4) | digit;
+    }
+    return true;
+  }
+
+  // Text in the format written by ToString(Guid): XXXXXXXX-XXXX-XXXX-XXXXXXXXXXXXXXXX
+  bool ParseGuid(const char* first, const char* last, OpcUa::Guid& guid)
+  {
+    if (last - first != 35 || first[8] != '-' || first[13] != '-' || first[18] != '-')
+    {
+      return false;
+    }
+    const char* it = first;
+    uint32_t value = 0;
+    if (!ParseHex(it, 8, value)) return false;
+    guid.Data1 = value;
+    ++it;
+    if (!ParseHex(it, 4, value)) return false;
+    guid.Data2 = static_cast<uint16_t>(value);
+    ++it;
+    if (!ParseHex(it, 4, value)) return false;
+    guid.Data3 = static_cast<uint16_t>(value);
+    ++it;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      if (!ParseHex(it, 2, value)) return false;
+      guid.Data4[i] = static_cast<uint8_t>(value);
+    }
+    return true;
+  }
+
+  char* Append(char* out, char* last, const char* text, std::size_t size)
+  {
+    if (!out || static_cast<std::size_t>(last - out) < size)
+    {
+      return nullptr;
     }
-    // if finding 's=' in the 'ns=1;i-3;' will be found field 'ns=1;'
-    // check that previous character is the ';' if not then search next.
-    while(data[colon - 1] != ';');
+    std::memcpy(out, text, size);
+    return out + size;
+  }
 
-    colon += std::strlen(field);
-    const std::size_t semicolon = data.find(";", colon);
-    if (semicolon == std::string::npos)
+  template <std::size_t N>
+  char* Append(char* out, char* last, const char (&text)[N])
+  {
+    return Append(out, last, text, N - 1);
+  }
+
+  char* AppendInteger(char* out, char* last, uint32_t value)
+  {
+    char digits[10];
+    char* end = digits + sizeof(digits);
+    char* begin = end;
+    do
     {
-      data.substr(colon);
+      *--begin = static_cast<char>('0' + value % 10);
+      value /= 10;
     }
-    return data.substr(colon, semicolon - colon);
+    while (value);
+    return Append(out, last, begin, end - begin);
   }
 
-  uint32_t GetInteger(const std::string&value)
+  char* AppendHex(char* out, char* last, uint32_t value, unsigned digits)
   {
-    if (value.empty())
+    static const char hex[] = "0123456789ABCDEF";
+    char buf[8];
+    for (unsigned i = digits; i > 0; --i)
     {
-      return 0;
+      buf[i - 1] = hex[value & 0xF];
+      value >>= 4;
     }
-    return std::stoul(value);
+    return Append(out, last, buf, digits);
   }
 
 }
 
-OpcUa::NodeId OpcUa::ToNodeId(const std::string& data, uint32_t defaultNamespace)
+OpcUa::NodeIdParseResult OpcUa::ParseNodeId(const char* first, const char* last, NodeId& id, uint32_t defaultNamespace)
 {
-  OpcUa::NodeId result;
-  uint32_t ns = defaultNamespace;
+  Field ns, srv, nsu, integer, str, guid;
+  for (const char* token = first; token < last; )
+  {
+    const char* semicolon = static_cast<const char*>(std::memchr(token, ';', last - token));
+    const char* end = semicolon ? semicolon : last;
+    if (StartsWith(token, end, "ns=", 3)) SetField(ns, token, end, 3);
+    else if (StartsWith(token, end, "srv=", 4)) SetField(srv, token, end, 4);
+    else if (StartsWith(token, end, "nsu=", 4)) SetField(nsu, token, end, 4);
+    else if (StartsWith(token, end, "i=", 2)) SetField(integer, token, end, 2);
+    else if (StartsWith(token, end, "s=", 2)) SetField(str, token, end, 2);
+    else if (StartsWith(token, end, "g=", 2)) SetField(guid, token, end, 2);
+    token = end + 1;
+  }
 
-  const std::string nsString = GetNodeField(data, "ns=");
-  if (nsString.empty())
+  NodeIdParseResult result = {last, std::errc()};
+  uint32_t nsIndex = defaultNamespace;
+  if (ns.Empty())
   {
-    if (ns == std::numeric_limits<uint32_t>::max() )
+    if (nsIndex == std::numeric_limits<uint32_t>::max())
     {
-      throw(std::runtime_error("Namespace index coult not be parsed from string and not default index specified in string: " + data));
+      result.Error = std::errc::invalid_argument;
+      return result;
     }
   }
-  else
+  else if ((result.Error = ParseInteger(ns, std::numeric_limits<uint16_t>::max(), nsIndex)) != std::errc())
   {
-    ns = GetInteger(nsString);
+    result.Ptr = ns.Begin;
+    return result;
   }
 
-  const std::string srv = GetNodeField(data, "srv=");
-  if (!srv.empty())
+  uint32_t serverIndex = 0;
+  if (!srv.Empty() && (result.Error = ParseInteger(srv, std::numeric_limits<uint32_t>::max(), serverIndex)) != std::errc())
   {
-    result.SetServerIndex(GetInteger(srv));
+    result.Ptr = srv.Begin;
+    return result;
   }
 
-  const std::string nsu = GetNodeField(data, "nsu=");
-  if (!nsu.empty())
+  NodeId parsed;
+  if (!integer.Empty())
+  {
+    uint32_t value = 0;
+    if ((result.Error = ParseInteger(integer, std::numeric_limits<uint32_t>::max(), value)) != std::errc())
+    {
+      result.Ptr = integer.Begin;
+      return result;
+    }
+    parsed = NumericNodeId(value, static_cast<uint16_t>(nsIndex));
+  }
+  else if (!str.Empty())
   {
-    result.SetNamespaceURI(nsu);
+    parsed = StringNodeId(std::string(str.Begin, str.End), static_cast<uint16_t>(nsIndex));
+  }
+  else if (!guid.Empty())
+  {
+    Guid value;
+    if (!ParseGuid(guid.Begin, guid.End, value))
+    {
+      result.Ptr = guid.Begin;
+      result.Error = std::errc::invalid_argument;
+      return result;
+    }
+    parsed = GuidNodeId(value, static_cast<uint16_t>(nsIndex));
+  }
+  else
+  {
+    result.Ptr = first;
+    result.Error = std::errc::invalid_argument;
+    return result;
   }
 
-  const std::string integer = GetNodeField(data, "i=");
-  if (!integer.empty())
+  if (!srv.Empty())
+  {
+    parsed.SetServerIndex(serverIndex);
+  }
+  if (!nsu.Empty())
   {
-    return OpcUa::NumericNodeId(GetInteger(integer), ns);
+    parsed.SetNamespaceURI(std::string(nsu.Begin, nsu.End));
   }
+  id = std::move(parsed);
+  return result;
+}
 
-  const std::string str = GetNodeField(data, "s=");
-  if (!str.empty())
+OpcUa::NodeIdFormatResult OpcUa::FormatNodeId(char* first, char* last, const NodeId& id)
+{
+  char* out = first;
+  if (id.HasServerIndex())
+  {
+    out = Append(out, last, "srv=");
+    out = AppendInteger(out, last, id.ServerIndex);
+    out = Append(out, last, ";");
+  }
+  if (id.HasNamespaceURI())
   {
-    return OpcUa::StringNodeId(str, ns);
+    out = Append(out, last, "nsu=");
+    out = Append(out, last, id.NamespaceURI.data(), id.NamespaceURI.size());
+    out = Append(out, last, ";");
   }
 
-  const std::string g = GetNodeField(data, "g=");
-  if (!g.empty())
+  out = Append(out, last, "ns=");
+  out = AppendInteger(out, last, id.GetNamespaceIndex());
+  out = Append(out, last, ";");
+  if (id.IsInteger())
   {
-    return OpcUa::GuidNodeId(ToGuid(g), ns);
+    out = Append(out, last, "i=");
+    out = AppendInteger(out, last, id.GetIntegerIdentifier());
+    out = Append(out, last, ";");
   }
+#ifndef __ENABLE_EMBEDDED_PROFILE__
+  else if(id.IsString())
+  {
+    const std::string& str = id.StringData.Identifier;
+    out = Append(out, last, "s=");
+    out = Append(out, last, str.data(), str.size());
+    out = Append(out, last, ";");
+  }
+  else if (id.IsGuid())
+  {
+    const Guid guid = id.GetGuidIdentifier();
+    out = Append(out, last, "g=");
+    out = AppendHex(out, last, guid.Data1, 8);
+    out = Append(out, last, "-");
+    out = AppendHex(out, last, guid.Data2, 4);
+    out = Append(out, last, "-");
+    out = AppendHex(out, last, guid.Data3, 4);
+    out = Append(out, last, "-");
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      out = AppendHex(out, last, guid.Data4[i], 2);
+    }
+    out = Append(out, last, ";");
+  }
+#endif
+
+  NodeIdFormatResult result = {out, std::errc()};
+  if (!out)
+  {
+    result.Ptr = last;
+    result.Error = std::errc::value_too_large;
+  }
+  return result;
+}
 
-  throw(std::runtime_error("No identifier found in string: '" + data +"'"));
+OpcUa::NodeId OpcUa::ToNodeId(const std::string& data, uint32_t defaultNamespace)
+{
+  NodeId id;
+  const NodeIdParseResult result = ParseNodeId(data.data(), data.data() + data.size(), id, defaultNamespace);
+  if (result.Error == std::errc::result_out_of_range)
+  {
+    throw(std::out_of_range("Number is out of range in node id string: '" + data + "'"));
+  }
+  if (result.Error != std::errc())
+  {
+    throw(std::runtime_error("Cannot parse node id from string: '" + data + "'"));
+  }
+  return id;
 }
 
 OpcUa::QualifiedName OpcUa::ToQualifiedName(const std::string& str, uint32_t default_ns)
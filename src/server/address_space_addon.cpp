@@ -39,6 +39,14 @@ namespace OpcUa
           std::cout << "Enabled debug mode for address space addon." << std::endl;
           options.Debug = true;
         }
+        else if (param.Name == "history_path")
+        {
+          options.HistoryPath = param.Value;
+        }
+        else if (param.Name == "coarse_timestamps")
+        {
+          options.CoarseTimestamps = !param.Value.empty() && param.Value != "0";
+        }
       }
       return options;
     }
@@ -47,6 +55,16 @@ namespace OpcUa
     {
       Options options = GetOptions(params);
       Registry = Server::CreateAddressSpace(options.Debug);
+      if (!options.HistoryPath.empty())
+      {
+        if (options.Debug) std::cout << "address_space| Storing history in '" << options.HistoryPath << "'." << std::endl;
+        Registry->SetHistoryBackend(Server::CreateHistoryStore(options.HistoryPath));
+      }
+      if (options.CoarseTimestamps)
+      {
+        if (options.Debug) std::cout << "address_space| Using coarse clock for server timestamps." << std::endl;
+        Registry->SetCoarseTimestamps(true);
+      }
       InternalServer = addons.GetAddon<OpcUa::Server::ServicesRegistry>(OpcUa::Server::ServicesRegistryAddonId);
       InternalServer->RegisterViewServices(Registry);
       InternalServer->RegisterAttributeServices(Registry);
@@ -108,6 +126,11 @@ namespace OpcUa
       return Registry->Write(filter);
     }
 
+    std::vector<HistoryReadResult> AddressSpaceAddon::HistoryRead(const OpcUa::HistoryReadParameters& params) const
+    {
+      return Registry->HistoryRead(params);
+    }
+
     uint32_t AddressSpaceAddon::AddDataChangeCallback(const NodeId& node, AttributeId attribute, std::function<Server::DataChangeCallback> callback)
     {
       return Registry->AddDataChangeCallback(node, attribute, callback);
@@ -129,6 +152,16 @@ namespace OpcUa
       return;
     }
 
+    void AddressSpaceAddon::SetHistoryBackend(Server::HistoryBackend::SharedPtr backend)
+    {
+      Registry->SetHistoryBackend(backend);
+    }
+
+    void AddressSpaceAddon::SetCoarseTimestamps(bool coarse)
+    {
+      Registry->SetCoarseTimestamps(coarse);
+    }
+
     std::vector<CallMethodResult> AddressSpaceAddon::Call(const std::vector<CallMethodRequest>& methodsToCall)
     {
       return Registry->Call(methodsToCall);
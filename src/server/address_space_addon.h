@@ -51,6 +51,7 @@ namespace OpcUa
     public: // AttribueServices
       virtual std::vector<DataValue> Read(const OpcUa::ReadParameters& filter) const;
       virtual std::vector<StatusCode> Write(const std::vector<OpcUa::WriteValue>& filter);
+      virtual std::vector<HistoryReadResult> HistoryRead(const OpcUa::HistoryReadParameters& params) const;
 
     public: // MethodServices
       virtual std::vector<CallMethodResult> Call(const std::vector<CallMethodRequest>& methodsToCall);
@@ -60,11 +61,15 @@ namespace OpcUa
       virtual void DeleteDataChangeCallback(uint32_t clienthandle);
       virtual StatusCode SetValueCallback(const NodeId& node, AttributeId attribute, std::function<DataValue(void)> callback);
       virtual void SetMethod(const NodeId& node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback);
+      virtual void SetHistoryBackend(Server::HistoryBackend::SharedPtr backend);
+      virtual void SetCoarseTimestamps(bool coarse);
 
     private:
       struct Options
       {
         bool Debug = false;
+        std::string HistoryPath;
+        bool CoarseTimestamps = false;
       };
 
     private:
@@ -9,6 +9,12 @@
 ///
 
 #include "address_space_internal.h"
+#include "history_read.h"
+#include "server_clock.h"
+
+#include <opc/ua/protocol/expanded_object_ids.h>
+
+#include <iostream>
 
 
 namespace OpcUa
@@ -25,6 +31,19 @@ namespace OpcUa
       MonitoringParameters Parameters;
     };
 
+    ReferenceDescription NodeReference::ToDescription() const
+    {
+      ReferenceDescription desc;
+      desc.ReferenceTypeId = ReferenceTypeId;
+      desc.IsForward = IsForward;
+      desc.TargetNodeId = TargetNodeId;
+      desc.BrowseName = *BrowseName;
+      desc.DisplayName = *DisplayName;
+      desc.TargetNodeClass = TargetNodeClass;
+      desc.TargetNodeTypeDefinition = TargetNodeTypeDefinition;
+      return desc;
+    }
+
     AddressSpaceInMemory::AddressSpaceInMemory(bool debug)
         : Debug(debug)
         , DataChangeCallbackHandle(0)
@@ -77,10 +96,10 @@ namespace OpcUa
       boost::shared_lock<boost::shared_mutex> lock(DbMutex);
 
       std::vector<BrowsePathResult> results;
-      for (BrowsePath browsepath : params.BrowsePaths )
+      results.reserve(params.BrowsePaths.size());
+      for (const BrowsePath& browsepath : params.BrowsePaths)
       {
-        BrowsePathResult result = TranslateBrowsePath(browsepath);
-        results.push_back(result);
+        results.push_back(TranslateBrowsePath(browsepath));
       }
       return results;
     }
@@ -91,7 +110,8 @@ namespace OpcUa
 
       if (Debug) std::cout << "AddressSpaceInternal | Browsing." << std::endl;
       std::vector<BrowseResult> results;
-      for ( BrowseDescription browseDescription: query.NodesToBrowse)
+      results.reserve(query.NodesToBrowse.size());
+      for (const BrowseDescription& browseDescription : query.NodesToBrowse)
       {
         BrowseResult result;
         if(Debug)
@@ -111,10 +131,15 @@ namespace OpcUa
           continue;
         }
 
-        std::copy_if(node_it->second.References.begin(), node_it->second.References.end(), std::back_inserter(result.Referencies),
-            std::bind(&AddressSpaceInMemory::IsSuitableReference, this, std::cref(browseDescription), std::placeholders::_1)
-        );
-        results.push_back(result);
+        result.Referencies.reserve(node_it->second.References.size());
+        for (const NodeReference& reference : node_it->second.References)
+        {
+          if (IsSuitableReference(browseDescription, reference))
+          {
+            result.Referencies.push_back(reference.ToDescription());
+          }
+        }
+        results.push_back(std::move(result));
       }
       return results;
     }
@@ -145,6 +170,7 @@ namespace OpcUa
       boost::shared_lock<boost::shared_mutex> lock(DbMutex);
 
       std::vector<DataValue> values;
+      values.reserve(params.AttributesToRead.size());
       for (const ReadValueId& attribute : params.AttributesToRead)
       {
         values.push_back(GetValue(attribute.NodeId, attribute.AttributeId));
@@ -154,30 +180,118 @@ namespace OpcUa
 
     std::vector<StatusCode> AddressSpaceInMemory::Write(const std::vector<OpcUa::WriteValue>& values)
     {
-      boost::unique_lock<boost::shared_mutex> lock(DbMutex);
-
       std::vector<StatusCode> statuses;
-      for (WriteValue value : values)
       {
-        if (value.Value.Encoding & DATA_VALUE)
+        boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
+        // All values of one request get the same server timestamp.
+        const DateTime serverTime = Server::ServerClock::Now();
+        statuses.reserve(values.size());
+        for (const WriteValue& value : values)
         {
-          statuses.push_back(SetValue(value.NodeId, value.AttributeId, value.Value));
-          continue;
+          if (value.Value.Encoding & DATA_VALUE)
+          {
+            statuses.push_back(SetValue(value.NodeId, value.AttributeId, value.Value, serverTime));
+            continue;
+          }
+          statuses.push_back(StatusCode::BadNotWritable);
         }
-        statuses.push_back(StatusCode::BadNotWritable);
       }
+      // Backend may write to disk or wait for long history reads, address space is not locked meanwhile.
+      AppendHistory();
       return statuses;
     }
 
-    std::tuple<bool, NodeId> AddressSpaceInMemory::FindElementInNode(const NodeId& nodeid, const RelativePathElement& element) const
+    void AddressSpaceInMemory::AppendHistory()
+    {
+      // One thread at a time takes the whole queue so that values reach the backend in write order.
+      std::lock_guard<std::mutex> appendLock(HistoryAppendMutex);
+      std::vector<HistoryValue> values;
+      {
+        std::lock_guard<std::mutex> lock(HistoryQueueMutex);
+        values.swap(HistoryQueue);
+      }
+      for (const HistoryValue& value : values)
+      {
+        try
+        {
+          value.Backend->Append(value.Node, value.Value);
+        }
+        catch (const std::exception& ex)
+        {
+          std::cerr << "AddressSpaceInternal | Failed to record history of node " << value.Node << ": " << ex.what() << std::endl;
+        }
+      }
+    }
+
+    std::vector<HistoryReadResult> AddressSpaceInMemory::HistoryRead(const HistoryReadParameters& params) const
+    {
+      std::vector<HistoryReadResult> results(params.NodesToRead.size());
+      std::vector<bool> readable(params.NodesToRead.size(), false);
+      Server::HistoryBackend::SharedPtr history;
+      {
+        boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+        history = History;
+        for (std::size_t i = 0; i < params.NodesToRead.size(); ++i)
+        {
+          NodesMap::const_iterator it = Nodes.find(params.NodesToRead[i].NodeId);
+          if ( it == Nodes.end() )
+          {
+            results[i].Status = StatusCode::BadNodeIdUnknown;
+          }
+          else if ( ! history || ! IsHistorizing(it->second) )
+          {
+            results[i].Status = StatusCode::BadHistoryOperationUnsupported;
+          }
+          else
+          {
+            readable[i] = true;
+          }
+        }
+      }
+
+      //processed reads need one aggregate for each node
+      if ( params.Details.Header.TypeId == ExpandedObjectId::ReadProcessedDetails && params.Details.Processed.AggregateType.size() != params.NodesToRead.size() )
+      {
+        for (HistoryReadResult& result : results)
+        {
+          result.Status = StatusCode::BadAggregateListMismatch;
+        }
+        return results;
+      }
+
+      //backend is read without lock so that writes are not blocked by long reads
+      for (std::size_t i = 0; i < params.NodesToRead.size(); ++i)
+      {
+        if ( ! readable[i] || params.ReleaseContinuationPoints )
+        {
+          continue;
+        }
+        if (Debug) std::cout << "AddressSpaceInternal | Reading history of node " << params.NodesToRead[i].NodeId << std::endl;
+        const std::vector<NodeId>& aggregates = params.Details.Processed.AggregateType;
+        results[i] = ReadHistory(*history, params.Details, params.Timestamps, params.NodesToRead[i], i < aggregates.size() ? aggregates[i] : NodeId());
+      }
+      return results;
+    }
+
+    bool AddressSpaceInMemory::IsHistorizing(const NodeStruct& node) const
+    {
+      AttributesMap::const_iterator it = node.Attributes.find(AttributeId::Historizing);
+      if ( it == node.Attributes.end() || it->second.Value.Value.Type() != VariantType::BOOLEAN || ! it->second.Value.Value.IsScalar() )
+      {
+        return false;
+      }
+      return it->second.Value.Value.As<bool>();
+    }
+
+    std::tuple<bool, NodeId> AddressSpaceInMemory::FindElementInNode(const NodeId& nodeid, const QualifiedName* name) const
     {
       NodesMap::const_iterator nodeit = Nodes.find(nodeid);
       if ( nodeit != Nodes.end() )
       {
-        for (auto reference : nodeit->second.References)
+        for (const NodeReference& reference : nodeit->second.References)
         {
-          //if (reference.first == current) { std::cout <<   reference.second.BrowseName.NamespaceIndex << reference.second.BrowseName.Name << " to " << element.TargetName.NamespaceIndex << element.TargetName.Name <<std::endl; }
-          if (reference.BrowseName == element.TargetName)
+          if (reference.BrowseName.get() == name)
           {
             return std::make_tuple(true, reference.TargetNodeId);
           }
@@ -191,9 +305,16 @@ namespace OpcUa
       NodeId current = browsepath.StartingNode;
       BrowsePathResult result;
 
-      for (RelativePathElement element : browsepath.Path.Elements)
+      for (const RelativePathElement& element : browsepath.Path.Elements)
       {
-        auto res = FindElementInNode(current, element);
+        // Interned names are compared by pointer, a name unknown to the table cannot match.
+        const std::shared_ptr<const QualifiedName> name = FindName(element.TargetName);
+        if (!name)
+        {
+          result.Status = OpcUa::StatusCode::BadNoMatch;
+          return result;
+        }
+        auto res = FindElementInNode(current, name.get());
         if ( std::get<0>(res) == false )
         {
           result.Status = OpcUa::StatusCode::BadNoMatch;
@@ -322,6 +443,17 @@ namespace OpcUa
         throw std::runtime_error("While setting node callback: node does not exist.");
     }
 
+    void AddressSpaceInMemory::SetHistoryBackend(Server::HistoryBackend::SharedPtr backend)
+    {
+      boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+      History = backend;
+    }
+
+    void AddressSpaceInMemory::SetCoarseTimestamps(bool coarse)
+    {
+      Server::ServerClock::SetCoarse(coarse);
+    }
+
     std::vector<OpcUa::CallMethodResult> AddressSpaceInMemory::Call(const std::vector<OpcUa::CallMethodRequest>& methodsToCall)
     {
       std::vector<OpcUa::CallMethodResult>  results;
@@ -373,7 +505,7 @@ namespace OpcUa
       return result;
     }
 
-    StatusCode AddressSpaceInMemory::SetValue(const NodeId& node, AttributeId attribute, const DataValue& data)
+    StatusCode AddressSpaceInMemory::SetValue(const NodeId& node, AttributeId attribute, const DataValue& data, DateTime serverTime)
     {
       NodesMap::iterator it = Nodes.find(node);
       if ( it != Nodes.end() )
@@ -382,10 +514,15 @@ namespace OpcUa
         if ( ait != it->second.Attributes.end() )
         {
           DataValue value(data);
-          value.SetServerTimestamp(DateTime::Current());
+          value.SetServerTimestamp(serverTime);
           ait->second.Value = value;
+          if ( attribute == AttributeId::Value && History && IsHistorizing(it->second) )
+          {
+            std::lock_guard<std::mutex> queueLock(HistoryQueueMutex);
+            HistoryQueue.push_back(HistoryValue{History, node, value});
+          }
           //call registered callback
-          for (auto pair : ait->second.DataChangeCallbacks)
+          for (const auto& pair : ait->second.DataChangeCallbacks)
           {
             pair.second.Callback(it->first, ait->first, ait->second.Value);
           }
@@ -395,9 +532,9 @@ namespace OpcUa
       return StatusCode::BadAttributeIdInvalid;
     }
 
-    bool AddressSpaceInMemory::IsSuitableReference(const BrowseDescription& desc, const ReferenceDescription& reference) const
+    bool AddressSpaceInMemory::IsSuitableReference(const BrowseDescription& desc, const NodeReference& reference) const
     {
-      if (Debug) std::cout << "AddressSpaceInternal | Checking reference '" << reference.ReferenceTypeId << "' to the node '" << reference.TargetNodeId << "' (" << reference.BrowseName << ") which must fit ref: " << desc.ReferenceTypeId << " with include subtype: " << desc.IncludeSubtypes << std::endl;
+      if (Debug) std::cout << "AddressSpaceInternal | Checking reference '" << reference.ReferenceTypeId << "' to the node '" << reference.TargetNodeId << "' (" << *reference.BrowseName << ") which must fit ref: " << desc.ReferenceTypeId << " with include subtype: " << desc.IncludeSubtypes << std::endl;
 
       if ((desc.Direction == BrowseDirection::Forward && !reference.IsForward) || (desc.Direction == BrowseDirection::Inverse && reference.IsForward))
       {
@@ -418,7 +555,7 @@ namespace OpcUa
       return true;
     }
 
-    bool AddressSpaceInMemory::IsSuitableReferenceType(const ReferenceDescription& reference, const NodeId& typeId, bool includeSubtypes) const
+    bool AddressSpaceInMemory::IsSuitableReferenceType(const NodeReference& reference, const NodeId& typeId, bool includeSubtypes) const
     {
       if (!includeSubtypes)
       {
@@ -499,14 +636,14 @@ namespace OpcUa
       if (parent_node_it != Nodes.end())
       {
         // Link to parent
-        ReferenceDescription desc;
+        NodeReference desc;
         desc.ReferenceTypeId = item.ReferenceTypeId;
         desc.TargetNodeId = resultId;
         desc.TargetNodeClass = item.Class;
-        desc.BrowseName = item.BrowseName;
-        desc.DisplayName = LocalizedText(item.BrowseName.Name);
+        desc.BrowseName = InternName(item.BrowseName);
+        desc.DisplayName = InternName(LocalizedText(item.BrowseName.Name));
         desc.TargetNodeTypeDefinition = item.TypeDefinition;
-        desc.IsForward = true; // should this be in constructor?
+        desc.IsForward = true;
 
         parent_node_it->second.References.push_back(desc);
       }
@@ -541,7 +678,7 @@ namespace OpcUa
       {
         return StatusCode::BadTargetNodeIdInvalid;
       }
-      ReferenceDescription desc;
+      NodeReference desc;
       desc.ReferenceTypeId = item.ReferenceTypeId;
       desc.IsForward = item.IsForward;
       desc.TargetNodeId = item.TargetNodeId;
@@ -549,20 +686,20 @@ namespace OpcUa
       DataValue dv = GetValue(item.TargetNodeId, AttributeId::BrowseName);
       if (dv.Status == StatusCode::Good)
       {
-        desc.BrowseName = dv.Value.As<QualifiedName>();
+        desc.BrowseName = InternName(dv.Value.As<QualifiedName>());
       }
       else
       {
-        desc.BrowseName = QualifiedName("NONAME", 0);
+        desc.BrowseName = InternName(QualifiedName("NONAME", 0));
       }
       dv = GetValue(item.TargetNodeId, AttributeId::DisplayName);
       if (dv.Status == StatusCode::Good)
       {
-        desc.DisplayName = dv.Value.As<LocalizedText>();
+        desc.DisplayName = InternName(dv.Value.As<LocalizedText>());
       }
       else
       {
-        desc.DisplayName = LocalizedText(desc.BrowseName.Name);
+        desc.DisplayName = InternName(LocalizedText(desc.BrowseName->Name));
       }
       node_it->second.References.push_back(desc);
       return StatusCode::Good;
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "address_space_addon.h"
+#include "name_table.h"
 
 #include <opc/ua/protocol/strings.h>
 #include <opc/ua/protocol/string_utils.h>
@@ -24,6 +25,7 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <mutex>
 #include <queue>
 #include <deque>
 #include <set>
@@ -66,16 +68,39 @@ namespace OpcUa
 
     typedef std::map<AttributeId, AttributeValue> AttributesMap;
 
+    //Reference kept in the address space. Names are shared through the process wide name table,
+    //so references to often used standard names do not copy strings.
+    struct NodeReference
+    {
+      NodeId ReferenceTypeId;
+      NodeId TargetNodeId;
+      NodeId TargetNodeTypeDefinition;
+      std::shared_ptr<const QualifiedName> BrowseName;
+      std::shared_ptr<const LocalizedText> DisplayName;
+      NodeClass TargetNodeClass = NodeClass::Unspecified;
+      bool IsForward = true;
+
+      ReferenceDescription ToDescription() const;
+    };
+
     //Store all data related to a Node
     struct NodeStruct
     {
       AttributesMap Attributes;
-      std::vector<ReferenceDescription> References;
+      std::vector<NodeReference> References;
       std::function<std::vector<OpcUa::Variant> (NodeId, std::vector<OpcUa::Variant>)> Method;
     };
 
     typedef std::map<NodeId, NodeStruct> NodesMap;
 
+    //Written value waiting to be recorded by the history backend
+    struct HistoryValue
+    {
+      Server::HistoryBackend::SharedPtr Backend;
+      NodeId Node;
+      DataValue Value;
+    };
+
     //In memory storage of server opc-ua data model
     class AddressSpaceInMemory : public Server::AddressSpace
     {
@@ -94,6 +119,7 @@ namespace OpcUa
 		virtual void UnregisterNodes(const std::vector<NodeId>& params) const;
         virtual std::vector<DataValue> Read(const ReadParameters& params) const;
         virtual std::vector<StatusCode> Write(const std::vector<OpcUa::WriteValue>& values);
+        virtual std::vector<HistoryReadResult> HistoryRead(const HistoryReadParameters& params) const;
         virtual std::vector<OpcUa::CallMethodResult> Call(const std::vector<OpcUa::CallMethodRequest>& methodsToCall);
 
         //Server side methods
@@ -111,18 +137,27 @@ namespace OpcUa
         /// @brief Set method function for a method node.
         void SetMethod(const NodeId& node, std::function<std::vector<OpcUa::Variant> (NodeId context, std::vector<OpcUa::Variant> arguments)> callback);
 
+        /// @brief Set backend recording values of historizing variables.
+        void SetHistoryBackend(Server::HistoryBackend::SharedPtr backend);
+
+        /// @brief Take all timestamps set by the server from the coarse clock, see ServerClock.
+        void SetCoarseTimestamps(bool coarse);
+
       private:
-        std::tuple<bool, NodeId> FindElementInNode(const NodeId& nodeid, const RelativePathElement& element) const;
+        std::tuple<bool, NodeId> FindElementInNode(const NodeId& nodeid, const QualifiedName* name) const;
         BrowsePathResult TranslateBrowsePath(const BrowsePath& browsepath) const;
         DataValue GetValue(const NodeId& node, AttributeId attribute) const;
-        StatusCode SetValue(const NodeId& node, AttributeId attribute, const DataValue& data);
-        bool IsSuitableReference(const BrowseDescription& desc, const ReferenceDescription& reference) const;
-        bool IsSuitableReferenceType(const ReferenceDescription& reference, const NodeId& typeId, bool includeSubtypes) const;
+        StatusCode SetValue(const NodeId& node, AttributeId attribute, const DataValue& data, DateTime serverTime);
+        bool IsSuitableReference(const BrowseDescription& desc, const NodeReference& reference) const;
+        bool IsSuitableReferenceType(const NodeReference& reference, const NodeId& typeId, bool includeSubtypes) const;
         std::vector<NodeId> SelectNodesHierarchy(std::vector<NodeId> sourceNodes) const;
         AddNodesResult AddNode( const AddNodesItem& item );
         StatusCode AddReference(const AddReferencesItem& item);
         NodeId GetNewNodeId(const NodeId& id);
         CallMethodResult CallMethod(CallMethodRequest method);
+        bool IsHistorizing(const NodeStruct& node) const;
+        //Record queued values of historizing variables, called without DbMutex
+        void AppendHistory();
 
       private:
         bool Debug = false;
@@ -132,6 +167,10 @@ namespace OpcUa
         uint32_t MaxNodeIdNum = 2000;
         uint32_t DefaultIdx = 2;
         std::atomic<uint32_t> DataChangeCallbackHandle;
+        Server::HistoryBackend::SharedPtr History;
+        std::mutex HistoryQueueMutex;
+        std::vector<HistoryValue> HistoryQueue;
+        std::mutex HistoryAppendMutex;
     };
   }
 
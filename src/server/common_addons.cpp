@@ -119,6 +119,14 @@ namespace
 
     Common::ParametersGroup addressSpace(OpcUa::Server::AddressSpaceRegistryAddonId);
     addressSpace.Parameters.push_back(debugMode);
+    if (!serverParams.HistoryPath.empty())
+    {
+      addressSpace.Parameters.push_back(Common::Parameter("history_path", serverParams.HistoryPath));
+    }
+    if (serverParams.CoarseTimestamps)
+    {
+      addressSpace.Parameters.push_back(Common::Parameter("coarse_timestamps", "1"));
+    }
     addons.Groups.push_back(addressSpace);
 
     Common::ParametersGroup endpointServices(OpcUa::Server::EndpointsRegistryAddonId);
@@ -226,6 +234,7 @@ namespace OpcUa
     subscriptionAddon.Id = OpcUa::Server::SubscriptionServiceAddonId;
     subscriptionAddon.Dependencies.push_back(OpcUa::Server::AsioAddonId);
     subscriptionAddon.Dependencies.push_back(OpcUa::Server::AddressSpaceRegistryAddonId);
+    subscriptionAddon.Dependencies.push_back(OpcUa::Server::StandardNamespaceAddonId);
     subscriptionAddon.Dependencies.push_back(OpcUa::Server::ServicesRegistryAddonId);
     return subscriptionAddon;
   }
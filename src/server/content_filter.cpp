@@ -0,0 +1,487 @@
+/// @brief Compiled evaluation of event filter where clauses.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "content_filter.h"
+
+#include <opc/ua/protocol/string_utils.h>
+
+#include <algorithm>
+#include <set>
+
+namespace
+{
+  using namespace OpcUa;
+
+  bool ToNumber(const Variant& var, double& number)
+  {
+    if (var.IsNul() || var.IsArray())
+    {
+      return false;
+    }
+    switch (var.Type())
+    {
+      case VariantType::BOOLEAN: number = var.As<bool>() ? 1 : 0; return true;
+      case VariantType::SBYTE: number = var.As<int8_t>(); return true;
+      case VariantType::BYTE: number = var.As<uint8_t>(); return true;
+      case VariantType::INT16: number = var.As<int16_t>(); return true;
+      case VariantType::UINT16: number = var.As<uint16_t>(); return true;
+      case VariantType::INT32: number = var.As<int32_t>(); return true;
+      case VariantType::UINT32: number = var.As<uint32_t>(); return true;
+      case VariantType::INT64: number = static_cast<double>(var.As<int64_t>()); return true;
+      case VariantType::UINT64: number = static_cast<double>(var.As<uint64_t>()); return true;
+      case VariantType::FLOAT: number = var.As<float>(); return true;
+      case VariantType::DOUBLE: number = var.As<double>(); return true;
+      case VariantType::DATE_TIME: number = static_cast<double>(var.As<DateTime>().Value); return true;
+      case VariantType::STATUS_CODE: number = static_cast<uint32_t>(var.As<StatusCode>()); return true;
+      default: return false;
+    }
+  }
+
+  bool ToText(const Variant& var, std::string& text)
+  {
+    if (var.IsNul() || var.IsArray())
+    {
+      return false;
+    }
+    switch (var.Type())
+    {
+      case VariantType::STRING: text = var.As<std::string>(); return true;
+      case VariantType::LOCALIZED_TEXT: text = var.As<LocalizedText>().Text; return true;
+      case VariantType::QUALIFIED_NAME: text = var.As<QualifiedName>().Name; return true;
+      default: return false;
+    }
+  }
+
+  bool ToBool(const Variant& var)
+  {
+    double number = 0;
+    return ToNumber(var, number) && number != 0;
+  }
+
+  //Pattern matching of the Like operator: '%' matches any string, '_' any character, '\' escapes
+  bool MatchPattern(const char* str, const char* pattern)
+  {
+    while (*pattern)
+    {
+      if (*pattern == '%')
+      {
+        while (*pattern == '%')
+        {
+          ++pattern;
+        }
+        if (!*pattern)
+        {
+          return true;
+        }
+        for (; *str; ++str)
+        {
+          if (MatchPattern(str, pattern))
+          {
+            return true;
+          }
+        }
+        return false;
+      }
+      if (!*str)
+      {
+        return false;
+      }
+      if (*pattern == '\\' && *(pattern + 1))
+      {
+        ++pattern;
+      }
+      else if (*pattern == '_')
+      {
+        ++pattern;
+        ++str;
+        continue;
+      }
+      if (*pattern != *str)
+      {
+        return false;
+      }
+      ++pattern;
+      ++str;
+    }
+    return *str == 0;
+  }
+
+  void CollectSubtypes(const Server::AddressSpace& addressSpace, const NodeId& type, std::set<NodeId>& types)
+  {
+    if (!types.insert(type).second)
+    {
+      return;
+    }
+    BrowseDescription desc;
+    desc.NodeToBrowse = type;
+    desc.Direction = BrowseDirection::Forward;
+    desc.ReferenceTypeId = ObjectId::HasSubtype;
+    desc.IncludeSubtypes = false;
+    NodesQuery query;
+    query.NodesToBrowse.push_back(desc);
+    for (const BrowseResult& result : addressSpace.Browse(query))
+    {
+      for (const ReferenceDescription& ref : result.Referencies)
+      {
+        CollectSubtypes(addressSpace, ref.TargetNodeId, types);
+      }
+    }
+  }
+
+  int ExpectedOperandsCount(FilterOperator op)
+  {
+    switch (op)
+    {
+      case FilterOperator::IsNull:
+      case FilterOperator::Not:
+      case FilterOperator::OfType:
+        return 1;
+      case FilterOperator::Between:
+        return 3;
+      case FilterOperator::InList:
+        return -2; //at least two
+      default:
+        return 2;
+    }
+  }
+
+  bool IsBitwise(FilterOperator op)
+  {
+    return op == FilterOperator::BitwiseAnd || op == FilterOperator::BitwiseOr;
+  }
+}
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    EventField ToEventField(const std::vector<QualifiedName>& path)
+    {
+      if (path.size() != 1 || path[0].NamespaceIndex != 0)
+      {
+        return EventField::Custom;
+      }
+      const std::string& name = path[0].Name;
+      if (name == "EventId") return EventField::EventId;
+      if (name == "EventType") return EventField::EventType;
+      if (name == "SourceNode") return EventField::SourceNode;
+      if (name == "SourceName") return EventField::SourceName;
+      if (name == "Message") return EventField::Message;
+      if (name == "Severity") return EventField::Severity;
+      if (name == "LocalTime") return EventField::LocalTime;
+      if (name == "ReceiveTime") return EventField::ReceiveTime;
+      if (name == "Time") return EventField::Time;
+      return EventField::Custom;
+    }
+
+    EventFieldSelector::EventFieldSelector(const SimpleAttributeOperand& operand)
+      : Field(ToEventField(operand.BrowsePath))
+      , Attribute(operand.Attribute)
+    {
+      if (Field == EventField::Custom)
+      {
+        Path = operand.BrowsePath;
+      }
+    }
+
+    Variant EventFieldSelector::Get(const Event& event) const
+    {
+      switch (Field)
+      {
+        case EventField::EventId: return Variant(event.EventId);
+        case EventField::EventType: return Variant(event.EventType);
+        case EventField::SourceNode: return Variant(event.SourceNode);
+        case EventField::SourceName: return Variant(event.SourceName);
+        case EventField::Message: return Variant(event.Message);
+        case EventField::Severity: return Variant(event.Severity);
+        case EventField::LocalTime: return Variant(event.LocalTime);
+        case EventField::ReceiveTime: return Variant(event.ReceiveTime);
+        case EventField::Time: return Variant(event.Time);
+        case EventField::Custom: break;
+      }
+      if (Path.empty())
+      {
+        return event.GetValue(Attribute);
+      }
+      return event.GetValue(Path);
+    }
+
+    ContentFilterEvaluator::ContentFilterEvaluator()
+    {
+    }
+
+    ContentFilterEvaluator::ContentFilterEvaluator(const std::vector<ContentFilterElement>& whereClause, const Server::AddressSpace& addressSpace)
+      : Elements(whereClause.size())
+    {
+      for (uint32_t i = 0; i < whereClause.size(); ++i)
+      {
+        StatusCode result = CompileElement(i, whereClause[i], addressSpace);
+        ElementResults.push_back(result);
+        if (result != StatusCode::Good && Status == StatusCode::Good)
+        {
+          Status = result;
+        }
+      }
+    }
+
+    StatusCode ContentFilterEvaluator::CompileElement(uint32_t index, const ContentFilterElement& element, const Server::AddressSpace& addressSpace)
+    {
+      Element& compiled = Elements[index];
+      compiled.Operator = element.Operator;
+
+      switch (element.Operator)
+      {
+        case FilterOperator::Cast:
+        case FilterOperator::InView:
+        case FilterOperator::RelatedTo:
+          return StatusCode::BadFilterOperatorUnsupported;
+        default:
+          if (element.Operator > FilterOperator::BitwiseOr)
+          {
+            return StatusCode::BadFilterOperatorInvalid;
+          }
+      }
+
+      const int expected = ExpectedOperandsCount(element.Operator);
+      const int count = static_cast<int>(element.FilterOperands.size());
+      if ((expected > 0 && count != expected) || (expected < 0 && count < -expected))
+      {
+        return StatusCode::BadFilterOperandCountMismatch;
+      }
+
+      compiled.Operands.resize(element.FilterOperands.size());
+      for (std::size_t i = 0; i < element.FilterOperands.size(); ++i)
+      {
+        StatusCode status = CompileOperand(index, element.FilterOperands[i], compiled.Operands[i]);
+        if (status != StatusCode::Good)
+        {
+          return status;
+        }
+      }
+
+      if (element.Operator == FilterOperator::OfType)
+      {
+        const Operand& type = compiled.Operands[0];
+        if (type.Kind != OperandKind::Literal || type.Literal.Type() != VariantType::NODE_Id)
+        {
+          return StatusCode::BadFilterOperandInvalid;
+        }
+        std::set<NodeId> types;
+        CollectSubtypes(addressSpace, type.Literal.As<NodeId>(), types);
+        compiled.Types.assign(types.begin(), types.end());
+      }
+      return StatusCode::Good;
+    }
+
+    StatusCode ContentFilterEvaluator::CompileOperand(uint32_t index, const FilterOperand& operand, Operand& result) const
+    {
+      const NodeId& type = operand.Header.TypeId;
+      if (type == ExpandedObjectId::LiteralOperand)
+      {
+        result.Kind = OperandKind::Literal;
+        result.Literal = operand.Literal.Value;
+        result.IsNumber = ToNumber(result.Literal, result.Number);
+        return StatusCode::Good;
+      }
+      if (type == ExpandedObjectId::ElementOperand)
+      {
+        //Elements can only reference elements after them, this also prevents loops
+        if (operand.Element.Index <= index || operand.Element.Index >= Elements.size())
+        {
+          return StatusCode::BadFilterOperandInvalid;
+        }
+        result.Kind = OperandKind::Element;
+        result.Index = operand.Element.Index;
+        return StatusCode::Good;
+      }
+      if (type == ExpandedObjectId::SimpleAttributeOperand)
+      {
+        result.Kind = OperandKind::Field;
+        result.Field = EventFieldSelector(operand.SimpleAttribute);
+        return StatusCode::Good;
+      }
+      return StatusCode::BadFilterOperandInvalid;
+    }
+
+    bool ContentFilterEvaluator::Match(const Event& event) const
+    {
+      if (Status != StatusCode::Good)
+      {
+        return false;
+      }
+      if (Elements.empty())
+      {
+        return true;
+      }
+      return EvaluateBool(0, event);
+    }
+
+    bool ContentFilterEvaluator::EvaluateBool(uint32_t index, const Event& event) const
+    {
+      const Element& element = Elements[index];
+      const std::vector<Operand>& ops = element.Operands;
+      bool comparable = false;
+      switch (element.Operator)
+      {
+        case FilterOperator::Equals:
+          return IsEqual(ops[0], ops[1], event);
+        case FilterOperator::IsNull:
+          return GetValue(ops[0], event).IsNul();
+        case FilterOperator::GreaterThan:
+          return Compare(ops[0], ops[1], event, comparable) > 0 && comparable;
+        case FilterOperator::LessThan:
+          return Compare(ops[0], ops[1], event, comparable) < 0 && comparable;
+        case FilterOperator::GreaterThanOrEqual:
+          return Compare(ops[0], ops[1], event, comparable) >= 0 && comparable;
+        case FilterOperator::LessThanOrEqual:
+          return Compare(ops[0], ops[1], event, comparable) <= 0 && comparable;
+        case FilterOperator::Like:
+        {
+          std::string text;
+          std::string pattern;
+          return ToText(GetValue(ops[0], event), text) && ToText(GetValue(ops[1], event), pattern) && MatchPattern(text.c_str(), pattern.c_str());
+        }
+        case FilterOperator::Not:
+          return !IsTrue(ops[0], event);
+        case FilterOperator::Between:
+        {
+          if (Compare(ops[0], ops[1], event, comparable) < 0 || !comparable)
+          {
+            return false;
+          }
+          return Compare(ops[0], ops[2], event, comparable) <= 0 && comparable;
+        }
+        case FilterOperator::InList:
+          for (std::size_t i = 1; i < ops.size(); ++i)
+          {
+            if (IsEqual(ops[0], ops[i], event))
+            {
+              return true;
+            }
+          }
+          return false;
+        case FilterOperator::And:
+          return IsTrue(ops[0], event) && IsTrue(ops[1], event);
+        case FilterOperator::Or:
+          return IsTrue(ops[0], event) || IsTrue(ops[1], event);
+        case FilterOperator::OfType:
+          return std::binary_search(element.Types.begin(), element.Types.end(), event.EventType);
+        case FilterOperator::BitwiseAnd:
+        case FilterOperator::BitwiseOr:
+          return ToBool(Evaluate(index, event));
+        default:
+          return false;
+      }
+    }
+
+    Variant ContentFilterEvaluator::Evaluate(uint32_t index, const Event& event) const
+    {
+      const Element& element = Elements[index];
+      if (!IsBitwise(element.Operator))
+      {
+        return Variant(EvaluateBool(index, event));
+      }
+      double left = 0;
+      double right = 0;
+      if (!GetNumber(element.Operands[0], event, left) || !GetNumber(element.Operands[1], event, right))
+      {
+        return Variant();
+      }
+      const int64_t a = static_cast<int64_t>(left);
+      const int64_t b = static_cast<int64_t>(right);
+      return Variant(element.Operator == FilterOperator::BitwiseAnd ? (a & b) : (a | b));
+    }
+
+    bool ContentFilterEvaluator::IsTrue(const Operand& operand, const Event& event) const
+    {
+      if (operand.Kind == OperandKind::Element)
+      {
+        return EvaluateBool(operand.Index, event);
+      }
+      return ToBool(GetValue(operand, event));
+    }
+
+    Variant ContentFilterEvaluator::GetValue(const Operand& operand, const Event& event) const
+    {
+      switch (operand.Kind)
+      {
+        case OperandKind::Literal:
+          return operand.Literal;
+        case OperandKind::Element:
+          return Evaluate(operand.Index, event);
+        case OperandKind::Field:
+          break;
+      }
+      return operand.Field.Get(event);
+    }
+
+    bool ContentFilterEvaluator::GetNumber(const Operand& operand, const Event& event, double& number) const
+    {
+      if (operand.Kind == OperandKind::Literal)
+      {
+        number = operand.Number;
+        return operand.IsNumber;
+      }
+      if (operand.Kind == OperandKind::Field)
+      {
+        //Avoid building variants for the most common base fields
+        switch (operand.Field.Field)
+        {
+          case EventField::Severity: number = event.Severity; return true;
+          case EventField::LocalTime: number = static_cast<double>(event.LocalTime.Value); return true;
+          case EventField::ReceiveTime: number = static_cast<double>(event.ReceiveTime.Value); return true;
+          case EventField::Time: number = static_cast<double>(event.Time.Value); return true;
+          case EventField::Custom: break;
+          default: return false;
+        }
+      }
+      return ToNumber(GetValue(operand, event), number);
+    }
+
+    int ContentFilterEvaluator::Compare(const Operand& left, const Operand& right, const Event& event, bool& comparable) const
+    {
+      double a = 0;
+      double b = 0;
+      if (GetNumber(left, event, a) && GetNumber(right, event, b))
+      {
+        comparable = true;
+        return a < b ? -1 : (a > b ? 1 : 0);
+      }
+      std::string first;
+      std::string second;
+      if (ToText(GetValue(left, event), first) && ToText(GetValue(right, event), second))
+      {
+        comparable = true;
+        return first.compare(second);
+      }
+      comparable = false;
+      return 0;
+    }
+
+    bool ContentFilterEvaluator::IsEqual(const Operand& left, const Operand& right, const Event& event) const
+    {
+      double a = 0;
+      double b = 0;
+      if (GetNumber(left, event, a) && GetNumber(right, event, b))
+      {
+        return a == b;
+      }
+      const Variant first = GetValue(left, event);
+      const Variant second = GetValue(right, event);
+      std::string firstText;
+      std::string secondText;
+      if (ToText(first, firstText) && ToText(second, secondText))
+      {
+        return firstText == secondText;
+      }
+      return first == second;
+    }
+
+  }
+}
@@ -0,0 +1,118 @@
+/// @brief Compiled evaluation of event filter where clauses.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/event.h>
+#include <opc/ua/protocol/protocol.h>
+#include <opc/ua/protocol/status_codes.h>
+#include <opc/ua/server/address_space.h>
+
+#include <vector>
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    //Base fields of BaseEventType, which are stored as members of Event
+    enum class EventField : uint8_t
+    {
+      Custom = 0,
+      EventId,
+      EventType,
+      SourceNode,
+      SourceName,
+      Message,
+      Severity,
+      LocalTime,
+      ReceiveTime,
+      Time,
+    };
+
+    //Return the base field addressed by a browse path, or Custom if the path addresses another value
+    EventField ToEventField(const std::vector<QualifiedName>& path);
+
+    //Field of an event selected by a SimpleAttributeOperand, resolved once.
+    //Base fields are read directly from Event members, others through Event::GetValue
+    struct EventFieldSelector
+    {
+      EventField Field = EventField::Custom;
+      AttributeId Attribute = AttributeId::Unknown;
+      std::vector<QualifiedName> Path;
+
+      EventFieldSelector() {}
+      explicit EventFieldSelector(const SimpleAttributeOperand& operand);
+
+      Variant Get(const Event& event) const;
+    };
+
+    //WhereClause of an EventFilter compiled into a predicate.
+    //Compilation is done once when monitored item is created:
+    //operands are resolved to literals, event fields or indexes of other elements
+    //and OfType operators are expanded to the set of all subtypes found in the address space.
+    //Evaluation then only walks the compiled elements, starting with the first one.
+    class ContentFilterEvaluator
+    {
+      public:
+        //Empty filter, matches every event
+        ContentFilterEvaluator();
+        ContentFilterEvaluator(const std::vector<ContentFilterElement>& whereClause, const Server::AddressSpace& addressSpace);
+
+        //Good if the filter could be compiled, otherwise the first error found
+        StatusCode GetStatus() const { return Status; }
+        //Result of compilation for each element of the where clause
+        const std::vector<StatusCode>& GetElementResults() const { return ElementResults; }
+        bool IsEmpty() const { return Elements.empty(); }
+
+        bool Match(const Event& event) const;
+
+      private:
+        enum class OperandKind : uint8_t
+        {
+          Literal,
+          Element,
+          Field,
+        };
+
+        struct Operand
+        {
+          OperandKind Kind = OperandKind::Literal;
+          Variant Literal;
+          bool IsNumber = false;
+          double Number = 0;
+          uint32_t Index = 0;
+          EventFieldSelector Field;
+        };
+
+        struct Element
+        {
+          FilterOperator Operator;
+          std::vector<Operand> Operands;
+          std::vector<NodeId> Types; //sorted, used by OfType
+        };
+
+        StatusCode CompileElement(uint32_t index, const ContentFilterElement& element, const Server::AddressSpace& addressSpace);
+        StatusCode CompileOperand(uint32_t index, const FilterOperand& operand, Operand& result) const;
+
+        Variant Evaluate(uint32_t index, const Event& event) const;
+        bool EvaluateBool(uint32_t index, const Event& event) const;
+        bool IsTrue(const Operand& operand, const Event& event) const;
+        Variant GetValue(const Operand& operand, const Event& event) const;
+        bool GetNumber(const Operand& operand, const Event& event, double& number) const;
+        int Compare(const Operand& left, const Operand& right, const Event& event, bool& comparable) const;
+        bool IsEqual(const Operand& left, const Operand& right, const Event& event) const;
+
+      private:
+        StatusCode Status = StatusCode::Good;
+        std::vector<StatusCode> ElementResults;
+        std::vector<Element> Elements;
+    };
+
+  }
+}
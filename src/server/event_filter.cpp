@@ -0,0 +1,59 @@
+/// @brief Compiled event filters shared by event monitored items.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "event_filter.h"
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    CompiledEventFilter::CompiledEventFilter(const EventFilter& filter, const Server::AddressSpace& addressSpace)
+      : WhereClause(filter.WhereClause, addressSpace)
+    {
+      SelectClauses.reserve(filter.SelectClauses.size());
+      for (const SimpleAttributeOperand& operand : filter.SelectClauses)
+      {
+        SelectClauses.push_back(EventFieldSelector(operand));
+      }
+    }
+
+    std::vector<Variant> CompiledEventFilter::Select(const Event& event) const
+    {
+      std::vector<Variant> fields;
+      fields.reserve(SelectClauses.size());
+      for (const EventFieldSelector& selector : SelectClauses)
+      {
+        fields.push_back(selector.Get(event));
+      }
+      return fields;
+    }
+
+    EventProjection::EventProjection(const Event& event)
+      : Ev(event)
+    {
+    }
+
+    const std::vector<Variant>* EventProjection::Apply(const CompiledEventFilter& filter)
+    {
+      std::map<const CompiledEventFilter*, Result>::iterator it = Results.find(&filter);
+      if (it == Results.end())
+      {
+        Result result;
+        result.Matched = filter.Match(Ev);
+        if (result.Matched)
+        {
+          result.Fields = filter.Select(Ev);
+        }
+        it = Results.insert(std::make_pair(&filter, std::move(result))).first;
+      }
+      return it->second.Matched ? &it->second.Fields : nullptr;
+    }
+
+  }
+}
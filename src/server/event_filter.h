@@ -0,0 +1,62 @@
+/// @brief Compiled event filters shared by event monitored items.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include "content_filter.h"
+
+#include <map>
+#include <vector>
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    //EventFilter compiled when a monitored item is created.
+    //SelectClauses become field selectors, so projecting an event is an index walk,
+    //WhereClause becomes a ContentFilterEvaluator.
+    //Monitored items with identical filters share one instance.
+    class CompiledEventFilter
+    {
+      public:
+        CompiledEventFilter(const EventFilter& filter, const Server::AddressSpace& addressSpace);
+
+        StatusCode GetStatus() const { return WhereClause.GetStatus(); }
+        bool Match(const Event& event) const { return WhereClause.Match(event); }
+        std::vector<Variant> Select(const Event& event) const;
+
+      private:
+        std::vector<EventFieldSelector> SelectClauses;
+        ContentFilterEvaluator WhereClause;
+    };
+
+    //Result of filtering one triggered event.
+    //Each compiled filter is applied at most once per event, whatever the number of monitored items using it.
+    class EventProjection
+    {
+      public:
+        explicit EventProjection(const Event& event);
+
+        const Event& GetEvent() const { return Ev; }
+        //Return selected fields of the event or nullptr if it does not match the filter
+        const std::vector<Variant>* Apply(const CompiledEventFilter& filter);
+
+      private:
+        struct Result
+        {
+          bool Matched;
+          std::vector<Variant> Fields;
+        };
+
+        const Event& Ev;
+        std::map<const CompiledEventFilter*, Result> Results;
+    };
+
+  }
+}
@@ -0,0 +1,162 @@
+/// @brief Bounded in-memory store of triggered events.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "event_store.h"
+
+#include <algorithm>
+
+namespace
+{
+  int64_t GetEventTime(const OpcUa::Event& event)
+  {
+    return event.Time.Value ? event.Time.Value : event.ReceiveTime.Value;
+  }
+}
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    std::size_t EstimateEventSize(const Event& event)
+    {
+      std::size_t size = sizeof(StoredEvent);
+      size += event.EventId.Data.size();
+      size += event.Message.Locale.size() + event.Message.Text.size();
+      size += event.SourceName.size();
+      for (const std::vector<QualifiedName>& path : event.GetValueKeys())
+      {
+        size += sizeof(Variant);
+        for (const QualifiedName& name : path)
+        {
+          size += sizeof(QualifiedName) + name.Name.size();
+        }
+      }
+      return size;
+    }
+
+    EventStore::EventStore(std::size_t maxEvents, std::size_t maxBytes)
+      : MaxEvents(maxEvents)
+      , MaxBytes(maxBytes)
+    {
+    }
+
+    void EventStore::Add(const NodeId& notifier, const Event& event)
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+
+      StoredEvent stored;
+      stored.Sequence = NextSequence++;
+      stored.Notifier = notifier;
+      stored.Data = event;
+      stored.Size = EstimateEventSize(event);
+
+      TimeIndex.insert(std::make_pair(GetEventTime(event), stored.Sequence));
+      SourceIndex[event.SourceNode].push_back(stored.Sequence);
+      MemoryUsage += stored.Size;
+      Events.push_back(std::move(stored));
+      Evict();
+    }
+
+    void EventStore::Evict()
+    {
+      while ( ! Events.empty() && (Events.size() > MaxEvents || MemoryUsage > MaxBytes) )
+      {
+        const StoredEvent& oldest = Events.front();
+
+        auto range = TimeIndex.equal_range(GetEventTime(oldest.Data));
+        for (auto it = range.first; it != range.second; ++it)
+        {
+          if ( it->second == oldest.Sequence )
+          {
+            TimeIndex.erase(it);
+            break;
+          }
+        }
+
+        //sequences of a source are ordered, so the oldest one is always first
+        auto source = SourceIndex.find(oldest.Data.SourceNode);
+        if ( source != SourceIndex.end() )
+        {
+          source->second.pop_front();
+          if ( source->second.empty() )
+          {
+            SourceIndex.erase(source);
+          }
+        }
+
+        MemoryUsage -= oldest.Size;
+        Events.pop_front();
+      }
+    }
+
+    const StoredEvent& EventStore::Get(uint64_t sequence) const
+    {
+      return Events[sequence - Events.front().Sequence];
+    }
+
+    void EventStore::Clear()
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      Events.clear();
+      TimeIndex.clear();
+      SourceIndex.clear();
+      MemoryUsage = 0;
+    }
+
+    std::vector<StoredEvent> EventStore::GetByTime(const DateTime& start, const DateTime& end) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+
+      std::vector<StoredEvent> result;
+      auto it = TimeIndex.lower_bound(start.Value);
+      const auto last = TimeIndex.upper_bound(end.Value);
+      for (; it != last; ++it)
+      {
+        result.push_back(Get(it->second));
+      }
+      return result;
+    }
+
+    std::vector<StoredEvent> EventStore::GetBySource(const NodeId& source) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+
+      std::vector<StoredEvent> result;
+      auto it = SourceIndex.find(source);
+      if ( it == SourceIndex.end() )
+      {
+        return result;
+      }
+      for (uint64_t sequence : it->second)
+      {
+        result.push_back(Get(sequence));
+      }
+      return result;
+    }
+
+    std::vector<StoredEvent> EventStore::GetAll() const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      return std::vector<StoredEvent>(Events.begin(), Events.end());
+    }
+
+    std::size_t EventStore::GetSize() const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      return Events.size();
+    }
+
+    std::size_t EventStore::GetMemoryUsage() const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      return MemoryUsage;
+    }
+
+  }
+}
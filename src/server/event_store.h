@@ -0,0 +1,73 @@
+/// @brief Bounded in-memory store of triggered events.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/event.h>
+#include <opc/ua/protocol/datetime.h>
+#include <opc/ua/protocol/nodeid.h>
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    struct StoredEvent
+    {
+      uint64_t Sequence = 0;
+      NodeId Notifier;  //node the event was triggered on
+      Event Data;
+      std::size_t Size = 0; //estimated memory used by the event
+    };
+
+    //Keeps the last triggered events, oldest are dropped when either
+    //the maximum number of events or the memory budget is exceeded.
+    //Events are indexed by time (Time, or ReceiveTime if Time is not set)
+    //and by source node. All methods are thread safe.
+    class EventStore
+    {
+      public:
+        EventStore(std::size_t maxEvents, std::size_t maxBytes);
+
+        void Add(const NodeId& notifier, const Event& event);
+        void Clear();
+
+        //Events with time in [start, end], ordered by time
+        std::vector<StoredEvent> GetByTime(const DateTime& start, const DateTime& end) const;
+        //Events with given source node, in the order they were added
+        std::vector<StoredEvent> GetBySource(const NodeId& source) const;
+        //All events, in the order they were added
+        std::vector<StoredEvent> GetAll() const;
+
+        std::size_t GetSize() const;
+        std::size_t GetMemoryUsage() const;
+
+      private:
+        void Evict();
+        const StoredEvent& Get(uint64_t sequence) const;
+
+      private:
+        const std::size_t MaxEvents;
+        const std::size_t MaxBytes;
+        mutable std::mutex Mutex;
+        std::deque<StoredEvent> Events; //ordered by sequence number
+        std::multimap<int64_t, uint64_t> TimeIndex; //event time, sequence
+        std::map<NodeId, std::deque<uint64_t>> SourceIndex; //source node, sequences
+        uint64_t NextSequence = 0;
+        std::size_t MemoryUsage = 0;
+    };
+
+    std::size_t EstimateEventSize(const Event& event);
+
+  }
+}
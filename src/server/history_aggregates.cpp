@@ -0,0 +1,452 @@
+/// @brief Aggregates computed over historical values.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "history_aggregates.h"
+#include "history_read.h"
+
+#include <opc/ua/protocol/object_ids.h>
+
+#include <algorithm>
+
+namespace
+{
+  using namespace OpcUa;
+
+  const int64_t TicksPerMillisecond = 10000;
+
+  enum class AggregateKind
+  {
+    Average,
+    TimeAverage,
+    Minimum,
+    Maximum,
+    Count,
+    Interpolative,
+    Start,
+    End,
+  };
+
+  bool GetAggregateKind(const NodeId& aggregate, AggregateKind& kind)
+  {
+    static const std::vector<std::pair<ObjectId, AggregateKind>> aggregates = {
+      {ObjectId::AggregateFunction_Average, AggregateKind::Average},
+      {ObjectId::AggregateFunction_TimeAverage, AggregateKind::TimeAverage},
+      {ObjectId::AggregateFunction_Minimum, AggregateKind::Minimum},
+      {ObjectId::AggregateFunction_Maximum, AggregateKind::Maximum},
+      {ObjectId::AggregateFunction_Count, AggregateKind::Count},
+      {ObjectId::AggregateFunction_Interpolative, AggregateKind::Interpolative},
+      {ObjectId::AggregateFunction_Start, AggregateKind::Start},
+      {ObjectId::AggregateFunction_End, AggregateKind::End},
+    };
+    for (const auto& pair : aggregates)
+    {
+      if ( aggregate == NodeId(pair.first) )
+      {
+        kind = pair.second;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool IsGood(StatusCode status)
+  {
+    return (static_cast<uint32_t>(status) & 0xC0000000) == 0;
+  }
+
+  bool IsUncertain(StatusCode status)
+  {
+    return (static_cast<uint32_t>(status) & 0xC0000000) == 0x40000000;
+  }
+
+  bool IsUsable(const DataValue& value, bool includeUncertain)
+  {
+    return IsGood(value.Status) || (includeUncertain && IsUncertain(value.Status));
+  }
+
+  bool GetNumber(const DataValue& value, double& number)
+  {
+    return (value.Encoding & DATA_VALUE) && Internal::ToDouble(value.Value, number);
+  }
+
+  double GetNumber(const DataValue& value)
+  {
+    double number = 0;
+    GetNumber(value, number);
+    return number;
+  }
+
+  //Lower value, or same value earlier
+  bool IsLower(const DataValue& left, const DataValue& right)
+  {
+    const double first = GetNumber(left);
+    const double second = GetNumber(right);
+    return first < second || (first == second && left.SourceTimestamp.Value < right.SourceTimestamp.Value);
+  }
+
+  //Higher value, or same value earlier
+  bool IsHigher(const DataValue& left, const DataValue& right)
+  {
+    const double first = GetNumber(left);
+    const double second = GetNumber(right);
+    return first > second || (first == second && left.SourceTimestamp.Value < right.SourceTimestamp.Value);
+  }
+
+  DataValue MakeValue(const Variant& variant, StatusCode status, int64_t time)
+  {
+    DataValue value;
+    if ( ! variant.IsNul() )
+    {
+      value = variant;
+    }
+    value.Status = status;
+    if ( status != StatusCode::Good )
+    {
+      value.Encoding |= DATA_VALUE_STATUS_CODE;
+    }
+    value.SetSourceTimestamp(DateTime(time));
+    value.SetServerTimestamp(DateTime(time));
+    return value;
+  }
+
+  DataValue WithStatus(DataValue value, StatusCode status)
+  {
+    value.Status = status;
+    if ( status != StatusCode::Good )
+    {
+      value.Encoding |= DATA_VALUE_STATUS_CODE;
+    }
+    return value;
+  }
+
+  //Statistics of numbers taken from values at given positions
+  void Reduce(const std::vector<DataValue>& values, const std::vector<double>& numbers, const std::vector<std::size_t>& positions, Server::HistoryStatistics& statistics)
+  {
+    const std::size_t count = numbers.size();
+    if ( count == 0 )
+    {
+      return;
+    }
+    //reductions over a column of doubles, simple enough to be vectorized by compiler
+    const double* data = numbers.data();
+    double sum = 0;
+    double minimum = data[0];
+    double maximum = data[0];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      sum += data[i];
+      minimum = std::min(minimum, data[i]);
+      maximum = std::max(maximum, data[i]);
+    }
+    std::size_t minIndex = count;
+    std::size_t maxIndex = count;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const DataValue& value = values[positions[i]];
+      if ( data[i] == minimum && (minIndex == count || value.SourceTimestamp.Value < values[positions[minIndex]].SourceTimestamp.Value) )
+      {
+        minIndex = i;
+      }
+      if ( data[i] == maximum && (maxIndex == count || value.SourceTimestamp.Value < values[positions[maxIndex]].SourceTimestamp.Value) )
+      {
+        maxIndex = i;
+      }
+    }
+    statistics.NumericCount = static_cast<uint32_t>(count);
+    statistics.Sum = sum;
+    statistics.Minimum = values[positions[minIndex]];
+    statistics.Maximum = values[positions[maxIndex]];
+  }
+
+  void MergeStatistics(const Server::HistoryStatistics& from, Server::HistoryStatistics& to)
+  {
+    if ( from.NumericCount == 0 )
+    {
+      return;
+    }
+    if ( to.NumericCount == 0 || IsLower(from.Minimum, to.Minimum) )
+    {
+      to.Minimum = from.Minimum;
+    }
+    if ( to.NumericCount == 0 || IsHigher(from.Maximum, to.Maximum) )
+    {
+      to.Maximum = from.Maximum;
+    }
+    to.NumericCount += from.NumericCount;
+    to.Sum += from.Sum;
+  }
+
+  //Status of an aggregate from the part of usable values of interval
+  StatusCode GetIntervalStatus(const Server::HistorySummary& summary, uint32_t usable, const AggregateConfiguration& config)
+  {
+    const uint64_t bad = summary.Count - usable;
+    if ( bad && bad * 100 >= uint64_t(config.PercentDataBad) * summary.Count )
+    {
+      return StatusCode::BadAggregateInvalidInputs;
+    }
+    if ( uint64_t(usable) * 100 >= uint64_t(config.PercentDataGood) * summary.Count )
+    {
+      return StatusCode::Good;
+    }
+    return StatusCode::UncertainDataSubNormal;
+  }
+
+  Server::HistorySummary SummarizeInterval(const Server::HistoryBackend& backend, const NodeId& node, const AggregateConfiguration& config, int64_t start, int64_t end)
+  {
+    Server::HistorySummary summary;
+    std::vector<Server::HistorySummary> summaries;
+    std::vector<DataValue> values;
+    backend.ReadSummaries(node, DateTime(start), DateTime(end - 1), summaries, values);
+    Internal::Summarize(values, summary);
+    for (const Server::HistorySummary& part : summaries)
+    {
+      Internal::MergeSummary(part, summary);
+    }
+    return summary;
+  }
+
+  //Time weighted average of values linearly interpolated over interval
+  DataValue ComputeTimeAverage(const Server::HistoryBackend& backend, const NodeId& node, const AggregateConfiguration& config, int64_t start, int64_t end)
+  {
+    std::vector<DataValue> points;
+    points.push_back(Internal::ReadValueAt(backend, node, DateTime(start)));
+    if ( end - start > 1 )
+    {
+      const std::vector<DataValue> values = backend.Read(node, DateTime(start + 1), DateTime(end - 1), 0);
+      points.insert(points.end(), values.begin(), values.end());
+    }
+    points.push_back(Internal::ReadValueAt(backend, node, DateTime(end)));
+
+    std::vector<double> times;
+    std::vector<double> numbers;
+    bool partial = false;
+    for (const DataValue& point : points)
+    {
+      double number = 0;
+      if ( IsUsable(point, ! config.TreatUncertainAsBad) && GetNumber(point, number) )
+      {
+        times.push_back(static_cast<double>(point.SourceTimestamp.Value - start));
+        numbers.push_back(number);
+      }
+      else
+      {
+        partial = true;
+      }
+    }
+    if ( numbers.empty() )
+    {
+      return MakeValue(Variant(), StatusCode::BadNoData, start);
+    }
+
+    double area = 0;
+    for (std::size_t i = 1; i < numbers.size(); ++i)
+    {
+      area += (times[i] - times[i - 1]) * (numbers[i] + numbers[i - 1]) / 2;
+    }
+    const double covered = times.back() - times.front();
+    const double average = covered > 0 ? area / covered : numbers.front();
+    const bool complete = ! partial && covered >= static_cast<double>(end - start);
+    return MakeValue(average, complete ? StatusCode::Good : StatusCode::UncertainDataSubNormal, start);
+  }
+
+  DataValue ComputeAggregate(const Server::HistoryBackend& backend, const NodeId& node, AggregateKind kind, const AggregateConfiguration& config, int64_t start, int64_t end)
+  {
+    if ( kind == AggregateKind::Interpolative )
+    {
+      return Internal::ReadValueAt(backend, node, DateTime(start));
+    }
+    if ( kind == AggregateKind::TimeAverage )
+    {
+      return ComputeTimeAverage(backend, node, config, start, end);
+    }
+
+    const Server::HistorySummary summary = SummarizeInterval(backend, node, config, start, end);
+    const uint32_t usable = summary.GoodCount + (config.TreatUncertainAsBad ? 0 : summary.UncertainCount);
+    const Server::HistoryStatistics& statistics = config.TreatUncertainAsBad ? summary.Good : summary.Usable;
+    if ( kind == AggregateKind::Count )
+    {
+      return MakeValue(static_cast<int32_t>(usable), StatusCode::Good, start);
+    }
+    if ( summary.Count == 0 )
+    {
+      return MakeValue(Variant(), StatusCode::BadNoData, start);
+    }
+    switch (kind)
+    {
+      case AggregateKind::Start:
+        return summary.First;
+      case AggregateKind::End:
+        return summary.Last;
+      default:
+        break;
+    }
+
+    if ( statistics.NumericCount == 0 )
+    {
+      return MakeValue(Variant(), StatusCode::BadAggregateInvalidInputs, start);
+    }
+    const StatusCode status = GetIntervalStatus(summary, usable, config);
+    switch (kind)
+    {
+      case AggregateKind::Average:
+        return MakeValue(statistics.Sum / statistics.NumericCount, status, start);
+      case AggregateKind::Minimum:
+        return WithStatus(statistics.Minimum, status);
+      case AggregateKind::Maximum:
+        return WithStatus(statistics.Maximum, status);
+      default:
+        return MakeValue(Variant(), StatusCode::BadAggregateNotSupported, start);
+    }
+  }
+}
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    void Summarize(const std::vector<DataValue>& values, Server::HistorySummary& summary)
+    {
+      Server::HistorySummary local;
+      std::vector<double> good;
+      std::vector<std::size_t> goodPositions;
+      std::vector<double> usable;
+      std::vector<std::size_t> usablePositions;
+      good.reserve(values.size());
+      goodPositions.reserve(values.size());
+      usable.reserve(values.size());
+      usablePositions.reserve(values.size());
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+        const DataValue& value = values[i];
+        if ( local.Count == 0 || value.SourceTimestamp.Value < local.First.SourceTimestamp.Value )
+        {
+          local.First = value;
+        }
+        if ( local.Count == 0 || value.SourceTimestamp.Value >= local.Last.SourceTimestamp.Value )
+        {
+          local.Last = value;
+        }
+        ++local.Count;
+        const bool isGood = IsGood(value.Status);
+        if ( isGood )
+        {
+          ++local.GoodCount;
+        }
+        else if ( IsUncertain(value.Status) )
+        {
+          ++local.UncertainCount;
+        }
+        double number = 0;
+        if ( IsUsable(value, true) && GetNumber(value, number) )
+        {
+          usable.push_back(number);
+          usablePositions.push_back(i);
+          if ( isGood )
+          {
+            good.push_back(number);
+            goodPositions.push_back(i);
+          }
+        }
+      }
+      Reduce(values, good, goodPositions, local.Good);
+      Reduce(values, usable, usablePositions, local.Usable);
+      MergeSummary(local, summary);
+    }
+
+    void MergeSummary(const Server::HistorySummary& from, Server::HistorySummary& to)
+    {
+      if ( from.Count == 0 )
+      {
+        return;
+      }
+      if ( to.Count == 0 )
+      {
+        to = from;
+        return;
+      }
+      if ( from.First.SourceTimestamp.Value < to.First.SourceTimestamp.Value )
+      {
+        to.First = from.First;
+      }
+      if ( from.Last.SourceTimestamp.Value >= to.Last.SourceTimestamp.Value )
+      {
+        to.Last = from.Last;
+      }
+      MergeStatistics(from.Good, to.Good);
+      MergeStatistics(from.Usable, to.Usable);
+      to.Count += from.Count;
+      to.GoodCount += from.GoodCount;
+      to.UncertainCount += from.UncertainCount;
+    }
+
+    HistoryReadResult ReadProcessed(const Server::HistoryBackend& backend, const ReadProcessedDetails& details, const NodeId& aggregate, const NodeId& node)
+    {
+      HistoryReadResult result;
+      const int64_t start = details.StartTime.Value;
+      const int64_t end = details.EndTime.Value;
+      if ( start == 0 || end == 0 || start == end || details.ProcessingInterval < 0 )
+      {
+        result.Status = StatusCode::BadInvalidTimestampArgument;
+        return result;
+      }
+
+      AggregateKind kind;
+      if ( ! GetAggregateKind(aggregate, kind) )
+      {
+        result.Status = StatusCode::BadAggregateNotSupported;
+        return result;
+      }
+
+      const AggregateConfiguration config = details.AggregateConfiguration.UseServerCapabilitiesDefaults ? AggregateConfiguration() : details.AggregateConfiguration;
+      if ( config.PercentDataBad > 100 || config.PercentDataGood > 100 )
+      {
+        result.Status = StatusCode::BadAggregateConfigurationRejected;
+        return result;
+      }
+
+      const int64_t lower = std::min(start, end);
+      const int64_t span = std::max(start, end) - lower;
+      int64_t interval = static_cast<int64_t>(details.ProcessingInterval * TicksPerMillisecond);
+      if ( interval <= 0 || interval > span )
+      {
+        interval = span;
+      }
+      const int64_t count = (span + interval - 1) / interval;
+      if ( count > MaxProcessedIntervals )
+      {
+        result.Status = StatusCode::BadTooManyOperations;
+        return result;
+      }
+
+      for (int64_t i = 0; i < count; ++i)
+      {
+        const int64_t intervalStart = lower + i * interval;
+        const int64_t intervalEnd = std::min(intervalStart + interval, lower + span);
+        result.DataValues.push_back(ComputeAggregate(backend, node, kind, config, intervalStart, intervalEnd));
+      }
+      //intervals are computed from the oldest one but returned from StartTime to EndTime
+      if ( start > end )
+      {
+        std::reverse(result.DataValues.begin(), result.DataValues.end());
+      }
+      return result;
+    }
+
+  }
+
+  namespace Server
+  {
+
+    void HistoryBackend::ReadSummaries(const NodeId& node, const DateTime& start, const DateTime& end, std::vector<HistorySummary>& summaries, std::vector<DataValue>& values) const
+    {
+      values = Read(node, start, end, 0);
+    }
+
+  }
+}
@@ -0,0 +1,31 @@
+/// @brief Aggregates computed over historical values.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/history.h>
+#include <opc/ua/server/history.h>
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    //Maximum number of intervals of a processed read
+    const uint32_t MaxProcessedIntervals = 100000;
+
+    //Add values to summary, statistics are computed both with and without uncertain values
+    void Summarize(const std::vector<DataValue>& values, Server::HistorySummary& summary);
+    void MergeSummary(const Server::HistorySummary& from, Server::HistorySummary& to);
+
+    //One value of aggregate for each processing interval.
+    //Supported aggregates are Average, TimeAverage, Minimum, Maximum, Count, Interpolative, Start and End.
+    HistoryReadResult ReadProcessed(const Server::HistoryBackend& backend, const ReadProcessedDetails& details, const NodeId& aggregate, const NodeId& node);
+
+  }
+}
@@ -0,0 +1,354 @@
+/// @brief Implementation of HistoryRead on top of a history backend.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "history_read.h"
+#include "history_aggregates.h"
+
+#include <opc/ua/protocol/expanded_object_ids.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+  using namespace OpcUa;
+
+  const int64_t MinTime = std::numeric_limits<int64_t>::min();
+  const int64_t MaxTime = std::numeric_limits<int64_t>::max();
+
+  //Position of the next value to return: its timestamp
+  //and the number of values with the same timestamp already returned.
+  struct ReadPosition
+  {
+    int64_t Time = 0;
+    uint32_t Skip = 0;
+  };
+
+  const std::size_t ContinuationPointSize = 12;
+
+  ByteString EncodeContinuationPoint(const ReadPosition& position)
+  {
+    std::vector<uint8_t> data;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      data.push_back(static_cast<uint8_t>(static_cast<uint64_t>(position.Time) >> (8 * i)));
+    }
+    for (unsigned i = 0; i < 4; ++i)
+    {
+      data.push_back(static_cast<uint8_t>(position.Skip >> (8 * i)));
+    }
+    return ByteString(data);
+  }
+
+  bool DecodeContinuationPoint(const ByteString& point, ReadPosition& position)
+  {
+    if ( point.Data.size() != ContinuationPointSize )
+    {
+      return false;
+    }
+    uint64_t time = 0;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      time |= static_cast<uint64_t>(point.Data[i]) << (8 * i);
+    }
+    uint32_t skip = 0;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+      skip |= static_cast<uint32_t>(point.Data[8 + i]) << (8 * i);
+    }
+    position.Time = static_cast<int64_t>(time);
+    position.Skip = skip;
+    return true;
+  }
+
+  DataValue MakeBadValue(StatusCode status, const DateTime& time)
+  {
+    DataValue value;
+    value.Status = status;
+    value.Encoding |= DATA_VALUE_STATUS_CODE;
+    value.SetSourceTimestamp(time);
+    value.SetServerTimestamp(time);
+    return value;
+  }
+
+  DataValue WithTime(DataValue value, const DateTime& time)
+  {
+    value.SetSourceTimestamp(time);
+    value.SetServerTimestamp(time);
+    return value;
+  }
+
+  HistoryReadResult ReadRaw(const Server::HistoryBackend& backend, const ReadRawModifiedDetails& details, const HistoryReadValueId& valueId)
+  {
+    HistoryReadResult result;
+    if ( details.IsReadModified )
+    {
+      //values are never modified since HistoryUpdate is not supported
+      result.Header.TypeId = ExpandedObjectId::HistoryModifiedData;
+      return result;
+    }
+
+    const int64_t start = details.StartTime.Value;
+    const int64_t end = details.EndTime.Value;
+    if ( (start == 0 && end == 0) || (details.NumValuesPerNode == 0 && (start == 0 || end == 0)) )
+    {
+      result.Status = StatusCode::BadInvalidTimestampArgument;
+      return result;
+    }
+
+    //traversal goes from origin to limit, limit is excluded unless it is the origin
+    const bool forward = start != 0 && (end == 0 || start <= end);
+    const int64_t origin = start != 0 ? start : end;
+    const bool hasLimit = start != 0 && end != 0;
+    int64_t lower = forward ? origin : (hasLimit ? end + 1 : MinTime);
+    int64_t upper = forward ? (hasLimit ? (end > start ? end - 1 : end) : MaxTime) : origin;
+
+    ReadPosition position;
+    const bool continued = ! valueId.ContinuationPoint.Data.empty();
+    if ( continued )
+    {
+      if ( ! DecodeContinuationPoint(valueId.ContinuationPoint, position) )
+      {
+        result.Status = StatusCode::BadContinuationPointInvalid;
+        return result;
+      }
+      if ( forward )
+      {
+        lower = position.Time;
+      }
+      else
+      {
+        upper = position.Time;
+      }
+    }
+
+    std::vector<DataValue> values;
+    if ( lower <= upper )
+    {
+      uint32_t maxValues = 0;
+      if ( forward && details.NumValuesPerNode )
+      {
+        //enough to skip already returned values and to know if more are left
+        maxValues = position.Skip + details.NumValuesPerNode + 1;
+      }
+      values = backend.Read(valueId.NodeId, DateTime(lower), DateTime(upper), maxValues);
+    }
+    if ( ! forward )
+    {
+      std::reverse(values.begin(), values.end());
+    }
+    if ( continued )
+    {
+      uint32_t skipped = 0;
+      auto it = values.begin();
+      while (it != values.end() && skipped < position.Skip && it->SourceTimestamp.Value == position.Time)
+      {
+        ++it;
+        ++skipped;
+      }
+      values.erase(values.begin(), it);
+    }
+
+    if ( details.ReturnBounds )
+    {
+      if ( ! continued && (values.empty() || values.front().SourceTimestamp.Value != origin) )
+      {
+        DataValue bound;
+        const bool found = forward ? backend.ReadBefore(valueId.NodeId, DateTime(origin), bound) : backend.ReadAfter(valueId.NodeId, DateTime(origin), bound);
+        values.insert(values.begin(), found ? bound : MakeBadValue(StatusCode::BadBoundNotFound, DateTime(origin)));
+      }
+      if ( hasLimit && start != end )
+      {
+        DataValue bound;
+        const bool found = forward ? backend.ReadAfter(valueId.NodeId, DateTime(end), bound) : backend.ReadBefore(valueId.NodeId, DateTime(end), bound);
+        values.push_back(found ? bound : MakeBadValue(StatusCode::BadBoundNotFound, DateTime(end)));
+      }
+    }
+
+    if ( details.NumValuesPerNode && values.size() > details.NumValuesPerNode )
+    {
+      ReadPosition next;
+      next.Time = values[details.NumValuesPerNode].SourceTimestamp.Value;
+      for (uint32_t i = 0; i < details.NumValuesPerNode; ++i)
+      {
+        if ( values[i].SourceTimestamp.Value == next.Time )
+        {
+          ++next.Skip;
+        }
+      }
+      if ( continued && next.Time == position.Time )
+      {
+        next.Skip += position.Skip;
+      }
+      values.resize(details.NumValuesPerNode);
+      result.ContinuationPoint = EncodeContinuationPoint(next);
+    }
+
+    result.DataValues = values;
+    if ( values.empty() )
+    {
+      result.Status = StatusCode::GoodNoData;
+    }
+    else if ( ! result.ContinuationPoint.Data.empty() )
+    {
+      result.Status = StatusCode::GoodMoreData;
+    }
+    return result;
+  }
+
+  HistoryReadResult ReadAtTime(const Server::HistoryBackend& backend, const ReadAtTimeDetails& details, const HistoryReadValueId& valueId)
+  {
+    HistoryReadResult result;
+    for (const DateTime& time : details.ReqTimes)
+    {
+      result.DataValues.push_back(Internal::ReadValueAt(backend, valueId.NodeId, time));
+    }
+    return result;
+  }
+}
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    bool ToDouble(const Variant& value, double& result)
+    {
+      if ( ! value.IsScalar() )
+      {
+        return false;
+      }
+      switch (value.Type())
+      {
+        case VariantType::BOOLEAN: result = value.As<bool>() ? 1 : 0; return true;
+        case VariantType::SBYTE:   result = value.As<int8_t>(); return true;
+        case VariantType::BYTE:    result = value.As<uint8_t>(); return true;
+        case VariantType::INT16:   result = value.As<int16_t>(); return true;
+        case VariantType::UINT16:  result = value.As<uint16_t>(); return true;
+        case VariantType::INT32:   result = value.As<int32_t>(); return true;
+        case VariantType::UINT32:  result = value.As<uint32_t>(); return true;
+        case VariantType::INT64:   result = static_cast<double>(value.As<int64_t>()); return true;
+        case VariantType::UINT64:  result = static_cast<double>(value.As<uint64_t>()); return true;
+        case VariantType::FLOAT:   result = value.As<float>(); return true;
+        case VariantType::DOUBLE:  result = value.As<double>(); return true;
+        default: return false;
+      }
+    }
+
+    Variant FromDouble(double value, VariantType type)
+    {
+      const double rounded = std::round(value);
+      switch (type)
+      {
+        case VariantType::BOOLEAN: return Variant(rounded != 0);
+        case VariantType::SBYTE:   return Variant(static_cast<int8_t>(rounded));
+        case VariantType::BYTE:    return Variant(static_cast<uint8_t>(rounded));
+        case VariantType::INT16:   return Variant(static_cast<int16_t>(rounded));
+        case VariantType::UINT16:  return Variant(static_cast<uint16_t>(rounded));
+        case VariantType::INT32:   return Variant(static_cast<int32_t>(rounded));
+        case VariantType::UINT32:  return Variant(static_cast<uint32_t>(rounded));
+        case VariantType::INT64:   return Variant(static_cast<int64_t>(rounded));
+        case VariantType::UINT64:  return Variant(static_cast<uint64_t>(rounded));
+        case VariantType::FLOAT:   return Variant(static_cast<float>(value));
+        default: return Variant(value);
+      }
+    }
+
+    DataValue Interpolate(const DataValue& before, const DataValue& after, const DateTime& time)
+    {
+      double first = 0;
+      double second = 0;
+      const int64_t span = after.SourceTimestamp.Value - before.SourceTimestamp.Value;
+      if ( span <= 0 || ! ToDouble(before.Value, first) || ! ToDouble(after.Value, second) )
+      {
+        return WithTime(before, time);
+      }
+      const double ratio = static_cast<double>(time.Value - before.SourceTimestamp.Value) / span;
+      DataValue value(FromDouble(first + (second - first) * ratio, before.Value.Type()));
+      if ( before.Status != StatusCode::Good || after.Status != StatusCode::Good )
+      {
+        value.Status = StatusCode::UncertainDataSubNormal;
+        value.Encoding |= DATA_VALUE_STATUS_CODE;
+      }
+      return WithTime(value, time);
+    }
+
+    DataValue ReadValueAt(const Server::HistoryBackend& backend, const NodeId& node, const DateTime& time)
+    {
+      DataValue before;
+      DataValue after;
+      const bool hasBefore = backend.ReadBefore(node, time, before);
+      if ( hasBefore && before.SourceTimestamp.Value == time.Value )
+      {
+        return before;
+      }
+      const bool hasAfter = backend.ReadAfter(node, time, after);
+      if ( hasBefore && hasAfter )
+      {
+        return Interpolate(before, after, time);
+      }
+      if ( hasBefore )
+      {
+        //stepped extrapolation of the last known value
+        DataValue value = WithTime(before, time);
+        value.Status = StatusCode::UncertainDataSubNormal;
+        value.Encoding |= DATA_VALUE_STATUS_CODE;
+        return value;
+      }
+      return MakeBadValue(StatusCode::BadNoData, time);
+    }
+
+    void FilterTimestamps(DataValue& value, TimestampsToReturn timestamps)
+    {
+      if ( timestamps == TimestampsToReturn::Server || timestamps == TimestampsToReturn::Neither )
+      {
+        value.Encoding &= ~(DATA_VALUE_SOURCE_TIMESTAMP | DATA_VALUE_SOURCE_PICOSECONDS);
+      }
+      if ( timestamps == TimestampsToReturn::Source || timestamps == TimestampsToReturn::Neither )
+      {
+        value.Encoding &= ~(DATA_VALUE_Server_TIMESTAMP | DATA_VALUE_Server_PICOSECONDS);
+      }
+    }
+
+    HistoryReadResult ReadHistory(const Server::HistoryBackend& backend, const HistoryReadDetails& details, TimestampsToReturn timestamps, const HistoryReadValueId& valueId, const NodeId& aggregate)
+    {
+      HistoryReadResult result;
+      if ( timestamps == TimestampsToReturn::Neither )
+      {
+        result.Status = StatusCode::BadTimestampsToReturnInvalid;
+        return result;
+      }
+
+      if ( details.Header.TypeId == ExpandedObjectId::ReadRawModifiedDetails )
+      {
+        result = ReadRaw(backend, details.RawModified, valueId);
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadAtTimeDetails )
+      {
+        result = ReadAtTime(backend, details.AtTime, valueId);
+      }
+      else if ( details.Header.TypeId == ExpandedObjectId::ReadProcessedDetails )
+      {
+        result = ReadProcessed(backend, details.Processed, aggregate, valueId.NodeId);
+      }
+      else
+      {
+        result.Status = StatusCode::BadHistoryOperationUnsupported;
+        return result;
+      }
+
+      for (DataValue& value : result.DataValues)
+      {
+        FilterTimestamps(value, timestamps);
+      }
+      return result;
+    }
+
+  }
+}
@@ -0,0 +1,41 @@
+/// @brief Implementation of HistoryRead on top of a history backend.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/history.h>
+#include <opc/ua/server/history.h>
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    //Read history of one node. Node must exist and be historizing.
+    //Continuation points are not kept on server side, they store where the next read starts.
+    //Aggregate is only used by processed reads.
+    HistoryReadResult ReadHistory(const Server::HistoryBackend& backend, const HistoryReadDetails& details, TimestampsToReturn timestamps, const HistoryReadValueId& valueId, const NodeId& aggregate = NodeId());
+
+    //Numeric scalar value as double, false if value is not numeric
+    bool ToDouble(const Variant& value, double& result);
+    //Convert double back to numeric type, integers are rounded
+    Variant FromDouble(double value, VariantType type);
+
+    //Value at time, linearly interpolated between two numeric values.
+    //If values are not numeric the first one is used.
+    DataValue Interpolate(const DataValue& before, const DataValue& after, const DateTime& time);
+
+    //Value at time: stored value, interpolated value between two stored values,
+    //or last stored value with uncertain status if there is no value after time.
+    DataValue ReadValueAt(const Server::HistoryBackend& backend, const NodeId& node, const DateTime& time);
+
+    //Keep only timestamps requested by client
+    void FilterTimestamps(DataValue& value, TimestampsToReturn timestamps);
+
+  }
+}
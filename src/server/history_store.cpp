@@ -0,0 +1,1000 @@
+/// @brief Embedded store of historical values.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "history_store.h"
+#include "history_aggregates.h"
+
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/input_from_buffer.h>
+#include <opc/ua/protocol/string_utils.h>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace
+{
+  using namespace OpcUa;
+
+  enum SegmentKind : uint8_t
+  {
+    NUMERIC = 1,
+    ENCODED = 2,
+  };
+
+  struct BufferAcceptor
+  {
+    std::vector<char>& Data;
+
+    explicit BufferAcceptor(std::vector<char>& data)
+      : Data(data)
+    {
+    }
+
+    void Send(const char* data, std::size_t size)
+    {
+      Data.insert(Data.end(), data, data + size);
+    }
+  };
+
+  bool IsNumeric(const DataValue& value)
+  {
+    if ( ! (value.Encoding & DATA_VALUE) || ! value.Value.IsScalar() )
+    {
+      return false;
+    }
+    const VariantType type = value.Value.Type();
+    return type >= VariantType::BOOLEAN && type <= VariantType::DOUBLE;
+  }
+
+  uint8_t GetKind(const DataValue& value)
+  {
+    return IsNumeric(value) ? NUMERIC : ENCODED;
+  }
+
+  template <typename T>
+  uint64_t CopyBits(T value)
+  {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+  }
+
+  template <typename T>
+  T FromCopiedBits(uint64_t bits)
+  {
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+
+  //64 bits pattern of a numeric value, integers are sign extended so that close values share their high bits
+  uint64_t ToBits(const Variant& value)
+  {
+    switch (value.Type())
+    {
+      case VariantType::BOOLEAN: return value.As<bool>() ? 1 : 0;
+      case VariantType::SBYTE:   return static_cast<uint64_t>(static_cast<int64_t>(value.As<int8_t>()));
+      case VariantType::BYTE:    return value.As<uint8_t>();
+      case VariantType::INT16:   return static_cast<uint64_t>(static_cast<int64_t>(value.As<int16_t>()));
+      case VariantType::UINT16:  return value.As<uint16_t>();
+      case VariantType::INT32:   return static_cast<uint64_t>(static_cast<int64_t>(value.As<int32_t>()));
+      case VariantType::UINT32:  return value.As<uint32_t>();
+      case VariantType::INT64:   return static_cast<uint64_t>(value.As<int64_t>());
+      case VariantType::UINT64:  return value.As<uint64_t>();
+      case VariantType::FLOAT:   return CopyBits(value.As<float>());
+      case VariantType::DOUBLE:  return CopyBits(value.As<double>());
+      default: throw std::logic_error("Value is not numeric");
+    }
+  }
+
+  Variant FromBits(uint64_t bits, VariantType type)
+  {
+    switch (type)
+    {
+      case VariantType::BOOLEAN: return Variant(bits != 0);
+      case VariantType::SBYTE:   return Variant(static_cast<int8_t>(bits));
+      case VariantType::BYTE:    return Variant(static_cast<uint8_t>(bits));
+      case VariantType::INT16:   return Variant(static_cast<int16_t>(bits));
+      case VariantType::UINT16:  return Variant(static_cast<uint16_t>(bits));
+      case VariantType::INT32:   return Variant(static_cast<int32_t>(bits));
+      case VariantType::UINT32:  return Variant(static_cast<uint32_t>(bits));
+      case VariantType::INT64:   return Variant(static_cast<int64_t>(bits));
+      case VariantType::UINT64:  return Variant(bits);
+      case VariantType::FLOAT:   return Variant(FromCopiedBits<float>(bits));
+      case VariantType::DOUBLE:  return Variant(FromCopiedBits<double>(bits));
+      default: throw std::runtime_error("Invalid type of numeric history segment");
+    }
+  }
+
+  unsigned CountLeadingZeros(uint64_t value)
+  {
+    unsigned count = 0;
+    for (uint64_t mask = uint64_t(1) << 63; mask && !(value & mask); mask >>= 1)
+    {
+      ++count;
+    }
+    return count;
+  }
+
+  unsigned CountTrailingZeros(uint64_t value)
+  {
+    unsigned count = 0;
+    for (uint64_t mask = 1; mask && !(value & mask); mask <<= 1)
+    {
+      ++count;
+    }
+    return count;
+  }
+
+  bool FitsIn(int64_t value, unsigned bits)
+  {
+    const int64_t limit = int64_t(1) << (bits - 1);
+    return value >= -limit && value < limit;
+  }
+
+  int64_t SignExtend(uint64_t value, unsigned bits)
+  {
+    if ( bits == 64 )
+    {
+      return static_cast<int64_t>(value);
+    }
+    const uint64_t sign = uint64_t(1) << (bits - 1);
+    return static_cast<int64_t>((value ^ sign) - sign);
+  }
+
+  //File name of a node, every character which is not alphanumeric is escaped
+  std::string GetFileName(const NodeId& node)
+  {
+    static const char hex[] = "0123456789ABCDEF";
+    std::string name;
+    for (char c : ToString(node))
+    {
+      if ( std::isalnum(static_cast<unsigned char>(c)) )
+      {
+        name += c;
+      }
+      else
+      {
+        name += '%';
+        name += hex[(static_cast<unsigned char>(c) >> 4) & 0xF];
+        name += hex[static_cast<unsigned char>(c) & 0xF];
+      }
+    }
+    return name + ".hist";
+  }
+
+  bool IsBefore(const DataValue& left, const DataValue& right)
+  {
+    return left.SourceTimestamp.Value < right.SourceTimestamp.Value;
+  }
+
+  //Latest value with timestamp lower or equal to time, the last appended one if several
+  const DataValue* FindLast(const std::vector<DataValue>& values, int64_t time)
+  {
+    const DataValue* result = nullptr;
+    for (const DataValue& value : values)
+    {
+      if ( value.SourceTimestamp.Value <= time && ( ! result || value.SourceTimestamp.Value >= result->SourceTimestamp.Value) )
+      {
+        result = &value;
+      }
+    }
+    return result;
+  }
+
+  //Earliest value with timestamp greater or equal to time, the first appended one if several
+  const DataValue* FindFirst(const std::vector<DataValue>& values, int64_t time)
+  {
+    const DataValue* result = nullptr;
+    for (const DataValue& value : values)
+    {
+      if ( value.SourceTimestamp.Value >= time && ( ! result || value.SourceTimestamp.Value < result->SourceTimestamp.Value) )
+      {
+        result = &value;
+      }
+    }
+    return result;
+  }
+}
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    ////////////////////////////////////////////////////////
+    // BitWriter, BitReader
+    ////////////////////////////////////////////////////////
+
+    void BitWriter::WriteBit(bool bit)
+    {
+      Write(bit ? 1 : 0, 1);
+    }
+
+    void BitWriter::Write(uint64_t value, unsigned bits)
+    {
+      while (bits > 0)
+      {
+        if ( FreeBits == 0 )
+        {
+          Data.push_back(0);
+          FreeBits = 8;
+        }
+        const unsigned count = std::min(bits, FreeBits);
+        const uint8_t chunk = static_cast<uint8_t>((value >> (bits - count)) & ((1u << count) - 1));
+        Data.back() |= chunk << (FreeBits - count);
+        FreeBits -= count;
+        bits -= count;
+      }
+    }
+
+    BitReader::BitReader(const uint8_t* data, std::size_t size)
+      : Data(data)
+      , Size(size)
+    {
+    }
+
+    bool BitReader::ReadBit()
+    {
+      return Read(1) != 0;
+    }
+
+    uint64_t BitReader::Read(unsigned bits)
+    {
+      uint64_t result = 0;
+      while (bits > 0)
+      {
+        const std::size_t byte = Position / 8;
+        if ( byte >= Size )
+        {
+          throw std::runtime_error("History segment is truncated");
+        }
+        const unsigned available = 8 - Position % 8;
+        const unsigned count = std::min(bits, available);
+        const uint8_t chunk = (Data[byte] >> (available - count)) & ((1u << count) - 1);
+        result = (result << count) | chunk;
+        Position += count;
+        bits -= count;
+      }
+      return result;
+    }
+
+    ////////////////////////////////////////////////////////
+    // SegmentWriter
+    ////////////////////////////////////////////////////////
+
+    int64_t GetHistoryTime(const DataValue& value)
+    {
+      if ( value.Encoding & DATA_VALUE_SOURCE_TIMESTAMP )
+      {
+        return value.SourceTimestamp.Value;
+      }
+      if ( value.Encoding & DATA_VALUE_Server_TIMESTAMP )
+      {
+        return value.ServerTimestamp.Value;
+      }
+      return 0;
+    }
+
+    SegmentWriter::SegmentWriter()
+    {
+      Header.Magic = SegmentMagic;
+    }
+
+    bool SegmentWriter::Accepts(const DataValue& value) const
+    {
+      if ( IsEmpty() )
+      {
+        return true;
+      }
+      if ( IsFull() || GetKind(value) != Header.Kind )
+      {
+        return false;
+      }
+      return Header.Kind != NUMERIC || static_cast<uint8_t>(value.Value.Type()) == Header.Type;
+    }
+
+    void SegmentWriter::Append(int64_t time, const DataValue& value)
+    {
+      const bool first = IsEmpty();
+      if ( first )
+      {
+        Header.Kind = GetKind(value);
+        Header.Type = Header.Kind == NUMERIC ? static_cast<uint8_t>(value.Value.Type()) : 0;
+        Header.MinTime = Header.MaxTime = time;
+      }
+
+      //timestamp, as delta of delta
+      if ( first )
+      {
+        Bits.Write(static_cast<uint64_t>(time), 64);
+      }
+      else
+      {
+        const int64_t delta = time - LastTime;
+        const int64_t dod = delta - LastDelta;
+        if ( dod == 0 )
+        {
+          Bits.WriteBit(false);
+        }
+        else if ( FitsIn(dod, 20) )
+        {
+          Bits.Write(0x2, 2);
+          Bits.Write(static_cast<uint64_t>(dod), 20);
+        }
+        else if ( FitsIn(dod, 32) )
+        {
+          Bits.Write(0x6, 3);
+          Bits.Write(static_cast<uint64_t>(dod), 32);
+        }
+        else
+        {
+          Bits.Write(0x7, 3);
+          Bits.Write(static_cast<uint64_t>(dod), 64);
+        }
+        LastDelta = delta;
+      }
+      LastTime = time;
+
+      //status code, only when it changes
+      const uint32_t status = (value.Encoding & DATA_VALUE_STATUS_CODE) ? static_cast<uint32_t>(value.Status) : 0;
+      if ( status == LastStatus )
+      {
+        Bits.WriteBit(false);
+      }
+      else
+      {
+        Bits.WriteBit(true);
+        Bits.Write(status, 32);
+        LastStatus = status;
+      }
+
+      if ( Header.Kind == NUMERIC )
+      {
+        //value, as XOR with previous one
+        const uint64_t bits = ToBits(value.Value);
+        const uint64_t xored = bits ^ LastBits;
+        if ( first )
+        {
+          Bits.Write(bits, 64);
+        }
+        else if ( xored == 0 )
+        {
+          Bits.WriteBit(false);
+        }
+        else
+        {
+          Bits.WriteBit(true);
+          const unsigned leading = std::min(CountLeadingZeros(xored), 31u);
+          const unsigned trailing = CountTrailingZeros(xored);
+          if ( LastLeading != ~0u && leading >= LastLeading && trailing >= LastTrailing )
+          {
+            Bits.WriteBit(false);
+            Bits.Write(xored >> LastTrailing, 64 - LastLeading - LastTrailing);
+          }
+          else
+          {
+            const unsigned length = 64 - leading - trailing;
+            Bits.WriteBit(true);
+            Bits.Write(leading, 5);
+            Bits.Write(length - 1, 6);
+            Bits.Write(xored >> trailing, length);
+            LastLeading = leading;
+            LastTrailing = trailing;
+          }
+        }
+        LastBits = bits;
+      }
+      else
+      {
+        std::vector<char> encoded;
+        BufferAcceptor acceptor(encoded);
+        Binary::DataSerializer serializer(0);
+        serializer << ((value.Encoding & DATA_VALUE) ? value.Value : Variant());
+        serializer.Flush(acceptor);
+        Bits.Write(encoded.size(), 32);
+        for (char c : encoded)
+        {
+          Bits.Write(static_cast<uint8_t>(c), 8);
+        }
+      }
+
+      Header.MinTime = std::min(Header.MinTime, time);
+      Header.MaxTime = std::max(Header.MaxTime, time);
+      ++Header.Count;
+    }
+
+    SegmentHeader SegmentWriter::GetHeader() const
+    {
+      SegmentHeader header(Header);
+      header.Size = static_cast<uint32_t>(Bits.GetData().size());
+      return header;
+    }
+
+    void DecodeSegment(const SegmentHeader& header, const uint8_t* data, std::vector<DataValue>& values)
+    {
+      BitReader bits(data, header.Size);
+      int64_t time = 0;
+      int64_t delta = 0;
+      uint32_t status = 0;
+      uint64_t valueBits = 0;
+      unsigned leading = 0;
+      unsigned trailing = 0;
+
+      for (uint32_t i = 0; i < header.Count; ++i)
+      {
+        if ( i == 0 )
+        {
+          time = static_cast<int64_t>(bits.Read(64));
+        }
+        else
+        {
+          int64_t dod = 0;
+          if ( bits.ReadBit() )
+          {
+            if ( ! bits.ReadBit() )
+            {
+              dod = SignExtend(bits.Read(20), 20);
+            }
+            else if ( ! bits.ReadBit() )
+            {
+              dod = SignExtend(bits.Read(32), 32);
+            }
+            else
+            {
+              dod = static_cast<int64_t>(bits.Read(64));
+            }
+          }
+          delta += dod;
+          time += delta;
+        }
+
+        if ( bits.ReadBit() )
+        {
+          status = static_cast<uint32_t>(bits.Read(32));
+        }
+
+        DataValue value;
+        if ( header.Kind == NUMERIC )
+        {
+          if ( i == 0 )
+          {
+            valueBits = bits.Read(64);
+          }
+          else if ( bits.ReadBit() )
+          {
+            if ( bits.ReadBit() )
+            {
+              leading = static_cast<unsigned>(bits.Read(5));
+              const unsigned length = static_cast<unsigned>(bits.Read(6)) + 1;
+              trailing = 64 - leading - length;
+            }
+            valueBits ^= bits.Read(64 - leading - trailing) << trailing;
+          }
+          value.Value = FromBits(valueBits, static_cast<VariantType>(header.Type));
+        }
+        else
+        {
+          std::vector<char> encoded(static_cast<std::size_t>(bits.Read(32)));
+          for (char& c : encoded)
+          {
+            c = static_cast<char>(bits.Read(8));
+          }
+          if ( ! encoded.empty() )
+          {
+            InputFromBuffer buffer(&encoded[0], encoded.size());
+            Binary::IStreamBinary stream(buffer);
+            stream >> value.Value;
+          }
+        }
+
+        if ( ! value.Value.IsNul() )
+        {
+          value.Encoding |= DATA_VALUE;
+        }
+        if ( status != 0 )
+        {
+          value.Status = static_cast<StatusCode>(status);
+          value.Encoding |= DATA_VALUE_STATUS_CODE;
+        }
+        value.SetSourceTimestamp(DateTime(time));
+        value.SetServerTimestamp(DateTime(time));
+        values.push_back(value);
+      }
+    }
+
+    ////////////////////////////////////////////////////////
+    // HistoryStore
+    ////////////////////////////////////////////////////////
+
+    HistoryStore::HistoryStore(const std::string& directory)
+      : Directory(directory)
+    {
+      if ( ! Directory.empty() )
+      {
+        boost::filesystem::create_directories(Directory);
+      }
+    }
+
+    HistoryStore::~HistoryStore()
+    {
+      try
+      {
+        Flush();
+      }
+      catch (const std::exception& ex)
+      {
+        std::cerr << "HistoryStore | Failed to write history: " << ex.what() << std::endl;
+      }
+    }
+
+    void HistoryStore::Flush()
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      for (auto& pair : Nodes)
+      {
+        if ( ! pair.second.Active.IsEmpty() )
+        {
+          Seal(pair.second);
+        }
+      }
+    }
+
+    HistoryStore::NodeHistory* HistoryStore::FindNode(const NodeId& node) const
+    {
+      auto it = Nodes.find(node);
+      if ( it != Nodes.end() )
+      {
+        return &it->second;
+      }
+      if ( Directory.empty() )
+      {
+        return nullptr;
+      }
+      const boost::filesystem::path path = boost::filesystem::path(Directory) / GetFileName(node);
+      if ( ! boost::filesystem::exists(path) )
+      {
+        return nullptr;
+      }
+      return &GetNode(node);
+    }
+
+    HistoryStore::NodeHistory& HistoryStore::GetNode(const NodeId& node) const
+    {
+      auto it = Nodes.find(node);
+      if ( it != Nodes.end() )
+      {
+        return it->second;
+      }
+      NodeHistory& history = Nodes[node];
+      if ( ! Directory.empty() )
+      {
+        history.Path = (boost::filesystem::path(Directory) / GetFileName(node)).string();
+        LoadSegments(history);
+      }
+      return history;
+    }
+
+    void HistoryStore::LoadSegments(NodeHistory& history) const
+    {
+      if ( ! boost::filesystem::exists(history.Path) )
+      {
+        return;
+      }
+      const uint64_t fileSize = boost::filesystem::file_size(history.Path);
+      std::ifstream file(history.Path.c_str(), std::ios::binary);
+      uint64_t offset = 0;
+      while (offset + sizeof(SegmentHeader) <= fileSize)
+      {
+        Segment segment;
+        file.seekg(offset);
+        file.read(reinterpret_cast<char*>(&segment.Header), sizeof(SegmentHeader));
+        if ( ! file || segment.Header.Magic != SegmentMagic || offset + sizeof(SegmentHeader) + segment.Header.Size > fileSize )
+        {
+          break;
+        }
+        segment.Offset = offset + sizeof(SegmentHeader);
+        offset = segment.Offset + segment.Header.Size;
+        if ( ! history.Segments.empty() && segment.Header.MinTime < history.Segments.back().Header.MaxTime )
+        {
+          history.Ordered = false;
+        }
+        history.Segments.push_back(segment);
+      }
+      file.close();
+      if ( offset != fileSize )
+      {
+        //drop a segment which was not completely written
+        std::cerr << "HistoryStore | Truncating corrupted history file " << history.Path << std::endl;
+        boost::filesystem::resize_file(history.Path, offset);
+      }
+      history.FileSize = offset;
+    }
+
+    void HistoryStore::Seal(NodeHistory& history)
+    {
+      Segment segment;
+      segment.Header = history.Active.GetHeader();
+      if ( history.Path.empty() )
+      {
+        segment.Data = history.Active.GetData();
+      }
+      else
+      {
+        std::ofstream file(history.Path.c_str(), std::ios::binary | std::ios::app);
+        file.write(reinterpret_cast<const char*>(&segment.Header), sizeof(SegmentHeader));
+        file.write(reinterpret_cast<const char*>(history.Active.GetData().data()), segment.Header.Size);
+        file.close();
+        if ( ! file )
+        {
+          throw std::runtime_error("Failed to write history file " + history.Path);
+        }
+        segment.Offset = history.FileSize + sizeof(SegmentHeader);
+        history.FileSize = segment.Offset + segment.Header.Size;
+      }
+      if ( ! history.Segments.empty() && segment.Header.MinTime < history.Segments.back().Header.MaxTime )
+      {
+        history.Ordered = false;
+      }
+      history.Segments.push_back(std::move(segment));
+      history.Active = SegmentWriter();
+    }
+
+    void HistoryStore::Decode(NodeHistory& history, const Segment& segment, std::vector<DataValue>& values) const
+    {
+      if ( history.Path.empty() )
+      {
+        DecodeSegment(segment.Header, segment.Data.data(), values);
+        return;
+      }
+      //file grows when segments are sealed, map it again if needed
+      if ( ! history.Region || history.Region->get_size() < segment.Offset + segment.Header.Size )
+      {
+        history.Region.reset();
+        history.Mapping.reset(new boost::interprocess::file_mapping(history.Path.c_str(), boost::interprocess::read_only));
+        history.Region.reset(new boost::interprocess::mapped_region(*history.Mapping, boost::interprocess::read_only, 0, history.FileSize));
+      }
+      const uint8_t* data = static_cast<const uint8_t*>(history.Region->get_address());
+      DecodeSegment(segment.Header, data + segment.Offset, values);
+    }
+
+    std::size_t HistoryStore::CountSegments(const NodeHistory& history) const
+    {
+      return history.Segments.size() + (history.Active.IsEmpty() ? 0 : 1);
+    }
+
+    SegmentHeader HistoryStore::GetHeader(const NodeHistory& history, std::size_t index) const
+    {
+      return index < history.Segments.size() ? history.Segments[index].Header : history.Active.GetHeader();
+    }
+
+    void HistoryStore::Decode(NodeHistory& history, std::size_t index, std::vector<DataValue>& values) const
+    {
+      if ( index < history.Segments.size() )
+      {
+        Decode(history, history.Segments[index], values);
+        return;
+      }
+      DecodeSegment(history.Active.GetHeader(), history.Active.GetData().data(), values);
+    }
+
+    bool HistoryStore::IsOrdered(const NodeHistory& history) const
+    {
+      if ( ! history.Ordered )
+      {
+        return false;
+      }
+      return history.Active.IsEmpty() || history.Segments.empty() || history.Active.GetHeader().MinTime >= history.Segments.back().Header.MaxTime;
+    }
+
+    std::vector<DataValue> HistoryStore::Collect(NodeHistory& history, int64_t start, int64_t end) const
+    {
+      std::vector<DataValue> decoded;
+      for (std::size_t i = 0; i < CountSegments(history); ++i)
+      {
+        const SegmentHeader header = GetHeader(history, i);
+        if ( header.MaxTime >= start && header.MinTime <= end )
+        {
+          Decode(history, i, decoded);
+        }
+      }
+
+      std::vector<DataValue> values;
+      for (const DataValue& value : decoded)
+      {
+        if ( value.SourceTimestamp.Value >= start && value.SourceTimestamp.Value <= end )
+        {
+          values.push_back(value);
+        }
+      }
+      //values are appended in time order, except if a source sent them late
+      if ( ! std::is_sorted(values.begin(), values.end(), IsBefore) )
+      {
+        std::stable_sort(values.begin(), values.end(), IsBefore);
+      }
+      return values;
+    }
+
+    void HistoryStore::Append(const NodeId& node, const DataValue& value)
+    {
+      int64_t time = GetHistoryTime(value);
+      if ( time == 0 )
+      {
+        time = DateTime::Current().Value;
+      }
+
+      std::lock_guard<std::mutex> lock(Mutex);
+      NodeHistory& history = GetNode(node);
+      if ( ! history.Active.Accepts(value) )
+      {
+        Seal(history);
+      }
+      history.Active.Append(time, value);
+      if ( history.Active.IsFull() )
+      {
+        Seal(history);
+      }
+    }
+
+    std::vector<DataValue> HistoryStore::Read(const NodeId& node, const DateTime& start, const DateTime& end, uint32_t maxValues) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      NodeHistory* history = FindNode(node);
+      if ( ! history )
+      {
+        return std::vector<DataValue>();
+      }
+      if ( ! IsOrdered(*history) )
+      {
+        std::vector<DataValue> values = Collect(*history, start.Value, end.Value);
+        if ( maxValues && values.size() > maxValues )
+        {
+          values.resize(maxValues);
+        }
+        return values;
+      }
+
+      //segments follow each other in time: decode from the first one ending after start
+      //and stop as soon as enough values were read
+      const std::vector<Segment>& segments = history->Segments;
+      std::size_t index = std::lower_bound(segments.begin(), segments.end(), start.Value, [](const Segment& segment, int64_t time)
+      {
+        return segment.Header.MaxTime < time;
+      }) - segments.begin();
+
+      std::vector<DataValue> values;
+      for (; index < CountSegments(*history) && GetHeader(*history, index).MinTime <= end.Value; ++index)
+      {
+        std::vector<DataValue> decoded;
+        Decode(*history, index, decoded);
+        const std::size_t first = values.size();
+        for (const DataValue& value : decoded)
+        {
+          if ( value.SourceTimestamp.Value >= start.Value && value.SourceTimestamp.Value <= end.Value )
+          {
+            values.push_back(value);
+          }
+        }
+        if ( ! std::is_sorted(values.begin() + first, values.end(), IsBefore) )
+        {
+          std::stable_sort(values.begin() + first, values.end(), IsBefore);
+        }
+        if ( maxValues && values.size() >= maxValues )
+        {
+          values.resize(maxValues);
+          break;
+        }
+      }
+      return values;
+    }
+
+    bool HistoryStore::ReadBefore(const NodeId& node, const DateTime& time, DataValue& value) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      NodeHistory* history = FindNode(node);
+      if ( ! history )
+      {
+        return false;
+      }
+
+      //segments which can hold a value at or before time, the one which can hold the latest value first
+      std::vector<std::size_t> candidates;
+      if ( IsOrdered(*history) )
+      {
+        //only the last segment starting before time can hold the answer
+        const std::vector<Segment>& segments = history->Segments;
+        if ( ! history->Active.IsEmpty() && history->Active.GetHeader().MinTime <= time.Value )
+        {
+          candidates.push_back(segments.size());
+        }
+        else
+        {
+          const std::size_t index = std::upper_bound(segments.begin(), segments.end(), time.Value, [](int64_t time, const Segment& segment)
+          {
+            return time < segment.Header.MinTime;
+          }) - segments.begin();
+          if ( index > 0 )
+          {
+            candidates.push_back(index - 1);
+          }
+        }
+      }
+      else
+      {
+        for (std::size_t i = 0; i < CountSegments(*history); ++i)
+        {
+          if ( GetHeader(*history, i).MinTime <= time.Value )
+          {
+            candidates.push_back(i);
+          }
+        }
+        std::sort(candidates.begin(), candidates.end(), [this, history, &time](std::size_t left, std::size_t right)
+        {
+          const int64_t leftEnd = std::min(GetHeader(*history, left).MaxTime, time.Value);
+          const int64_t rightEnd = std::min(GetHeader(*history, right).MaxTime, time.Value);
+          return leftEnd != rightEnd ? leftEnd > rightEnd : left > right;
+        });
+      }
+
+      bool found = false;
+      for (std::size_t index : candidates)
+      {
+        if ( found && std::min(GetHeader(*history, index).MaxTime, time.Value) <= value.SourceTimestamp.Value )
+        {
+          break;
+        }
+        std::vector<DataValue> values;
+        Decode(*history, index, values);
+        const DataValue* last = FindLast(values, time.Value);
+        if ( last && ( ! found || last->SourceTimestamp.Value > value.SourceTimestamp.Value) )
+        {
+          value = *last;
+          found = true;
+        }
+      }
+      return found;
+    }
+
+    bool HistoryStore::ReadAfter(const NodeId& node, const DateTime& time, DataValue& value) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      NodeHistory* history = FindNode(node);
+      if ( ! history )
+      {
+        return false;
+      }
+
+      //segments which can hold a value at or after time, the one which can hold the earliest value first
+      std::vector<std::size_t> candidates;
+      if ( IsOrdered(*history) )
+      {
+        //only the first segment ending after time can hold the answer
+        const std::vector<Segment>& segments = history->Segments;
+        const std::size_t index = std::lower_bound(segments.begin(), segments.end(), time.Value, [](const Segment& segment, int64_t time)
+        {
+          return segment.Header.MaxTime < time;
+        }) - segments.begin();
+        if ( index < CountSegments(*history) && GetHeader(*history, index).MaxTime >= time.Value )
+        {
+          candidates.push_back(index);
+        }
+      }
+      else
+      {
+        for (std::size_t i = 0; i < CountSegments(*history); ++i)
+        {
+          if ( GetHeader(*history, i).MaxTime >= time.Value )
+          {
+            candidates.push_back(i);
+          }
+        }
+        std::sort(candidates.begin(), candidates.end(), [this, history, &time](std::size_t left, std::size_t right)
+        {
+          const int64_t leftStart = std::max(GetHeader(*history, left).MinTime, time.Value);
+          const int64_t rightStart = std::max(GetHeader(*history, right).MinTime, time.Value);
+          return leftStart != rightStart ? leftStart < rightStart : left < right;
+        });
+      }
+
+      bool found = false;
+      for (std::size_t index : candidates)
+      {
+        if ( found && std::max(GetHeader(*history, index).MinTime, time.Value) >= value.SourceTimestamp.Value )
+        {
+          break;
+        }
+        std::vector<DataValue> values;
+        Decode(*history, index, values);
+        const DataValue* first = FindFirst(values, time.Value);
+        if ( first && ( ! found || first->SourceTimestamp.Value < value.SourceTimestamp.Value) )
+        {
+          value = *first;
+          found = true;
+        }
+      }
+      return found;
+    }
+
+    void HistoryStore::ReadSummaries(const NodeId& node, const DateTime& start, const DateTime& end, std::vector<Server::HistorySummary>& summaries, std::vector<DataValue>& values) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      NodeHistory* history = FindNode(node);
+      if ( ! history )
+      {
+        return;
+      }
+
+      //without overlapping segments, only the ones from start to end are visited
+      std::vector<Segment>& segments = history->Segments;
+      const bool ordered = IsOrdered(*history);
+      std::size_t first = 0;
+      if ( ordered )
+      {
+        first = std::lower_bound(segments.begin(), segments.end(), start.Value, [](const Segment& segment, int64_t time)
+        {
+          return segment.Header.MaxTime < time;
+        }) - segments.begin();
+      }
+
+      std::vector<DataValue> decoded;
+      for (std::size_t i = first; i < segments.size(); ++i)
+      {
+        Segment& segment = segments[i];
+        if ( ordered && segment.Header.MinTime > end.Value )
+        {
+          break;
+        }
+        if ( segment.Header.MaxTime < start.Value || segment.Header.MinTime > end.Value )
+        {
+          continue;
+        }
+        if ( segment.Header.MinTime >= start.Value && segment.Header.MaxTime <= end.Value )
+        {
+          if ( ! segment.HasSummary )
+          {
+            std::vector<DataValue> segmentValues;
+            Decode(*history, segment, segmentValues);
+            Summarize(segmentValues, segment.Summary);
+            segment.HasSummary = true;
+          }
+          summaries.push_back(segment.Summary);
+          continue;
+        }
+        Decode(*history, segment, decoded);
+      }
+      const SegmentHeader active = history->Active.GetHeader();
+      if ( ! history->Active.IsEmpty() && active.MaxTime >= start.Value && active.MinTime <= end.Value )
+      {
+        DecodeSegment(active, history->Active.GetData().data(), decoded);
+      }
+      for (const DataValue& value : decoded)
+      {
+        if ( value.SourceTimestamp.Value >= start.Value && value.SourceTimestamp.Value <= end.Value )
+        {
+          values.push_back(value);
+        }
+      }
+    }
+
+  } // namespace Internal
+
+  namespace Server
+  {
+
+    HistoryBackend::UniquePtr CreateHistoryStore(const std::string& directory)
+    {
+      return HistoryBackend::UniquePtr(new Internal::HistoryStore(directory));
+    }
+
+  }
+}
@@ -0,0 +1,161 @@
+/// @brief Embedded store of historical values.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/server/history.h>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    class BitWriter
+    {
+      public:
+        void WriteBit(bool bit);
+        void Write(uint64_t value, unsigned bits);
+        const std::vector<uint8_t>& GetData() const { return Data; }
+
+      private:
+        std::vector<uint8_t> Data;
+        unsigned FreeBits = 0; //unused bits in the last byte
+    };
+
+    class BitReader
+    {
+      public:
+        BitReader(const uint8_t* data, std::size_t size);
+        bool ReadBit();
+        uint64_t Read(unsigned bits);
+
+      private:
+        const uint8_t* Data;
+        std::size_t Size;
+        std::size_t Position = 0; //in bits
+    };
+
+    //Header of a segment as written to disk, followed by Size bytes of compressed values
+    struct SegmentHeader
+    {
+      uint32_t Magic = 0;
+      uint32_t Count = 0;
+      int64_t MinTime = 0;
+      int64_t MaxTime = 0;
+      uint8_t Kind = 0;
+      uint8_t Type = 0;
+      uint16_t Reserved = 0;
+      uint32_t Size = 0;
+    };
+
+    const uint32_t SegmentMagic = 0x54534948; // "HIST"
+    const uint32_t MaxSegmentValues = 1024;
+
+    //Successive values of a node compressed the Gorilla way:
+    //timestamps are stored as delta of deltas, numeric scalar values as XOR with the previous value,
+    //other values are binary encoded. Status codes are only stored when they change.
+    //All numeric values of a segment have the same type.
+    class SegmentWriter
+    {
+      public:
+        SegmentWriter();
+
+        bool IsEmpty() const { return Header.Count == 0; }
+        bool IsFull() const { return Header.Count >= MaxSegmentValues; }
+        //True if value can be appended without starting a new segment
+        bool Accepts(const DataValue& value) const;
+        void Append(int64_t time, const DataValue& value);
+
+        SegmentHeader GetHeader() const;
+        const std::vector<uint8_t>& GetData() const { return Bits.GetData(); }
+
+      private:
+        SegmentHeader Header;
+        BitWriter Bits;
+        int64_t LastTime = 0;
+        int64_t LastDelta = 0;
+        uint32_t LastStatus = 0;
+        uint64_t LastBits = 0;
+        unsigned LastLeading = ~0u;
+        unsigned LastTrailing = 0;
+    };
+
+    //Decode values of a segment, with both timestamps set to the stored time
+    void DecodeSegment(const SegmentHeader& header, const uint8_t* data, std::vector<DataValue>& values);
+
+    //Time used to store a value: source timestamp, or server timestamp if not set
+    int64_t GetHistoryTime(const DataValue& value);
+
+    class HistoryStore : public Server::HistoryBackend
+    {
+      public:
+        explicit HistoryStore(const std::string& directory);
+        ~HistoryStore();
+
+        virtual void Append(const NodeId& node, const DataValue& value);
+        virtual std::vector<DataValue> Read(const NodeId& node, const DateTime& start, const DateTime& end, uint32_t maxValues) const;
+        virtual bool ReadBefore(const NodeId& node, const DateTime& time, DataValue& value) const;
+        virtual bool ReadAfter(const NodeId& node, const DateTime& time, DataValue& value) const;
+        //Segments completely in [start, end] are returned as summaries, computed once per segment
+        virtual void ReadSummaries(const NodeId& node, const DateTime& start, const DateTime& end, std::vector<Server::HistorySummary>& summaries, std::vector<DataValue>& values) const;
+
+        //Write values not yet in a full segment to disk
+        void Flush();
+
+      private:
+        struct Segment
+        {
+          SegmentHeader Header;
+          uint64_t Offset = 0; //position of compressed values in node file
+          std::vector<uint8_t> Data; //compressed values, when not stored on disk
+          bool HasSummary = false;
+          Server::HistorySummary Summary;
+        };
+
+        struct NodeHistory
+        {
+          std::string Path;
+          std::vector<Segment> Segments;
+          SegmentWriter Active;
+          uint64_t FileSize = 0;
+          std::unique_ptr<boost::interprocess::file_mapping> Mapping;
+          std::unique_ptr<boost::interprocess::mapped_region> Region;
+          bool Ordered = true; //sealed segments do not overlap and are in time order
+        };
+
+        NodeHistory* FindNode(const NodeId& node) const;
+        NodeHistory& GetNode(const NodeId& node) const;
+        void LoadSegments(NodeHistory& history) const;
+        void Seal(NodeHistory& history);
+        void Decode(NodeHistory& history, const Segment& segment, std::vector<DataValue>& values) const;
+        //Segments are numbered in append order, the active segment comes after the sealed ones
+        std::size_t CountSegments(const NodeHistory& history) const;
+        SegmentHeader GetHeader(const NodeHistory& history, std::size_t index) const;
+        void Decode(NodeHistory& history, std::size_t index, std::vector<DataValue>& values) const;
+        //True if no segment overlaps the previous ones, then segments can be binary searched by time
+        bool IsOrdered(const NodeHistory& history) const;
+        //Decode all values of segments in [start, end], in time order
+        std::vector<DataValue> Collect(NodeHistory& history, int64_t start, int64_t end) const;
+
+      private:
+        const std::string Directory;
+        mutable std::mutex Mutex;
+        mutable std::map<NodeId, NodeHistory> Nodes;
+    };
+
+  }
+}
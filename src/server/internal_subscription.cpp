@@ -1,4 +1,6 @@
 #include "internal_subscription.h"
+#include "server_clock.h"
+#include "server_diagnostics.h"
 
 #include <boost/thread/locks.hpp>
 
@@ -6,6 +8,8 @@ namespace OpcUa
 {
   namespace Internal
   {
+    using Server::Diagnostics;
+    using Server::ServerClock;
 
     InternalSubscription::InternalSubscription(SubscriptionServiceInternal& service, const SubscriptionData& data, const NodeId& SessionAuthenticationToken, std::function<void (PublishResult)> callback, bool debug)
       : Service(service)
@@ -18,6 +22,8 @@ namespace OpcUa
       , LifeTimeCount(data.RevisedLifetimeCount)
       , Debug(debug)
     {
+      Diagnostics::Add(Diagnostics::CumulatedSubscriptions);
+      Diagnostics::Change(Diagnostics::CurrentSubscriptions, 1);
     }
 
     void InternalSubscription::Start()
@@ -29,6 +35,11 @@ namespace OpcUa
     InternalSubscription::~InternalSubscription()
     {
       //Stop(); 
+      const std::size_t pending = TriggeredDataChangeEvents.size() + TriggeredEvents.size();
+      Diagnostics::Change(Diagnostics::NotificationBacklog, -static_cast<int64_t>(pending));
+      Diagnostics::Add(Diagnostics::DroppedNotifications, pending);
+      Diagnostics::Change(Diagnostics::MonitoredItems, -static_cast<int64_t>(MonitoredDataChanges.size()));
+      Diagnostics::Change(Diagnostics::CurrentSubscriptions, -1);
     }
 
     void InternalSubscription::Stop()
@@ -123,7 +134,7 @@ namespace OpcUa
       //std::cout << "PopPublishresult for subscription: " << Data.SubscriptionId << " with " << TriggeredDataChangeEvents.size() << " triggered items in queue" << std::endl;
       PublishResult result;
       result.SubscriptionId = Data.SubscriptionId;
-      result.NotificationMessage.PublishTime = DateTime::Current();
+      result.NotificationMessage.PublishTime = ServerClock::Now();
 
       if ( ! TriggeredDataChangeEvents.empty() )
       {
@@ -141,6 +152,8 @@ namespace OpcUa
           notif.Events.push_back(ev.Data);
         }
         TriggeredEvents.clear();
+        Diagnostics::Change(Diagnostics::NotificationBacklog, -static_cast<int64_t>(notif.Events.size()));
+        Diagnostics::Add(Diagnostics::EventNotifications, notif.Events.size());
         NotificationData data(notif);
         result.NotificationMessage.NotificationData.push_back(data);
         result.Results.push_back(StatusCode::Good);
@@ -193,6 +206,8 @@ namespace OpcUa
         notification.Notification.push_back(event.Data);
       }
       TriggeredDataChangeEvents.clear();
+      Diagnostics::Change(Diagnostics::NotificationBacklog, -static_cast<int64_t>(notification.Notification.size()));
+      Diagnostics::Add(Diagnostics::DataChangeNotifications, notification.Notification.size());
       NotificationData data(notification);
       return data;
     }
@@ -208,9 +223,23 @@ namespace OpcUa
     MonitoredItemCreateResult InternalSubscription::CreateMonitoredItem(const MonitoredItemCreateRequest& request)
     {
       if (Debug) std::cout << "SubscriptionService| Creating monitored item." << std::endl;
-      boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
       MonitoredItemCreateResult result;
+      std::shared_ptr<CompiledEventFilter> eventFilter;
+      if (request.ItemToMonitor.AttributeId == AttributeId::EventNotifier )
+      {
+        //Compile filter before locking, it browses the address space to resolve event types
+        eventFilter = Service.GetEventFilter(request.RequestedParameters.Filter.Event);
+        if (eventFilter->GetStatus() != StatusCode::Good)
+        {
+          if (Debug) std::cout << "SubscriptionService| Invalid where clause in event filter: " << ToString(eventFilter->GetStatus()) << std::endl;
+          result.Status = OpcUa::StatusCode::BadMonitoredItemFilterInvalid;
+          return result;
+        }
+      }
+
+      boost::unique_lock<boost::shared_mutex> lock(DbMutex);
+
       uint32_t callbackHandle = 0;
       result.MonitoredItemId = ++LastMonitoredItemId;
       if (request.ItemToMonitor.AttributeId == AttributeId::EventNotifier )
@@ -247,7 +276,9 @@ namespace OpcUa
       mdata.ClientHandle = request.RequestedParameters.ClientHandle;
       mdata.CallbackHandle = callbackHandle;
       mdata.MonitoredItemId = result.MonitoredItemId;
+      mdata.EventFilter = eventFilter;
       MonitoredDataChanges[result.MonitoredItemId] = mdata;
+      Diagnostics::Change(Diagnostics::MonitoredItems, 1);
       if (Debug) std::cout << "Created MonitoredItem with id: " << result.MonitoredItemId << " and client handle " << mdata.ClientHandle << std::endl;
       //Forcing event, 
       if (request.ItemToMonitor.AttributeId != AttributeId::EventNotifier )
@@ -270,6 +301,7 @@ namespace OpcUa
       event.Data.ClientHandle = monitoreditems.ClientHandle; 
       event.Data.Value = vals[0];
       TriggeredDataChangeEvents.push_back(event);
+      Diagnostics::Change(Diagnostics::NotificationBacklog, 1);
     }
 
     std::vector<StatusCode> InternalSubscription::DeleteMonitoredItemsIds(const std::vector<uint32_t>& monitoreditemsids)
@@ -312,6 +344,7 @@ namespace OpcUa
             AddressSpace.DeleteDataChangeCallback(it->second.CallbackHandle);
           }
           MonitoredDataChanges.erase(handle);
+          Diagnostics::Change(Diagnostics::MonitoredItems, -1);
           //We remove you our monitoreditem, now empty events which are already triggered
           for(auto ev = TriggeredDataChangeEvents.begin(); ev != TriggeredDataChangeEvents.end();)
           {
@@ -319,6 +352,8 @@ namespace OpcUa
             {
               if (Debug) std::cout << "InternalSubscription | Remove triggeredEvent for monitoreditemid " << handle << std::endl;
               ev = TriggeredDataChangeEvents.erase(ev);
+              Diagnostics::Change(Diagnostics::NotificationBacklog, -1);
+              Diagnostics::Add(Diagnostics::DroppedNotifications);
             }
             else
             {
@@ -336,6 +371,10 @@ namespace OpcUa
           if ( pair.second == handle )
           {
             MonitoredEvents.erase(pair.first);
+            if (MonitoredDataChanges.erase(handle))
+            {
+              Diagnostics::Change(Diagnostics::MonitoredItems, -1);
+            }
             //We remove you our monitoreditem, now empty events which are already triggered
             for(auto ev = TriggeredEvents.begin(); ev != TriggeredEvents.end();)
             {
@@ -343,6 +382,8 @@ namespace OpcUa
               {
                 if (Debug) std::cout << "InternalSubscription | Remove triggeredEvent for monitoreditemid " << handle << std::endl;
                 ev = TriggeredEvents.erase(ev);
+                Diagnostics::Change(Diagnostics::NotificationBacklog, -1);
+                Diagnostics::Add(Diagnostics::DroppedNotifications);
               }
               else
               {
@@ -372,9 +413,10 @@ namespace OpcUa
       event.Data.Value = value;
       if (Debug) { std::cout << "InternalSubcsription | Enqueued DataChange triggered item for sub: " << Data.SubscriptionId << " and clienthandle: " << event.Data.ClientHandle << std::endl; }
       TriggeredDataChangeEvents.push_back(event);
+      Diagnostics::Change(Diagnostics::NotificationBacklog, 1);
     }
 
-    void InternalSubscription::TriggerEvent(NodeId node, Event event)
+    void InternalSubscription::TriggerEvent(const NodeId& node, EventProjection& projection)
     {
       boost::shared_lock<boost::shared_mutex> lock(DbMutex);
 
@@ -384,16 +426,51 @@ namespace OpcUa
         if (Debug) std::cout << "InternalSubcsription | Subscription: " << Data.SubscriptionId << " has no subcsription for this event" << std::endl;
         return;
       }
+      const uint32_t monitoredItemId = it->second;
       lock.unlock();//Enqueue vill need to set a unique lock
-      EnqueueEvent(it->second, event);
+      EnqueueEvent(monitoredItemId, projection);
+    }
+
+    void InternalSubscription::BroadcastEvent(EventProjection& projection)
+    {
+      boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+      std::vector<uint32_t> ids;
+      for (const auto& pair : MonitoredEvents)
+      {
+        ids.push_back(pair.second);
+      }
+      lock.unlock();
+      for (uint32_t id : ids)
+      {
+        EnqueueEvent(id, projection);
+      }
+    }
+
+    std::vector<NodeId> InternalSubscription::GetEventNotifiers() const
+    {
+      boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+      std::vector<NodeId> nodes;
+      for (const auto& pair : MonitoredEvents)
+      {
+        nodes.push_back(pair.first);
+      }
+      return nodes;
     }
 
     bool InternalSubscription::EnqueueEvent(uint32_t monitoreditemid, const Event& event)
+    {
+      EventProjection projection(event);
+      return EnqueueEvent(monitoreditemid, projection);
+    }
+
+    bool InternalSubscription::EnqueueEvent(uint32_t monitoreditemid, EventProjection& projection)
     {
       if (Debug) { std::cout << "InternalSubcsription | Enqueing event to be send" << std::endl; }
       boost::unique_lock<boost::shared_mutex> lock(DbMutex);
 
-      if (Debug) { std::cout << "enqueueing event: " << event << std::endl;}
+      if (Debug) { std::cout << "enqueueing event: " << projection.GetEvent() << std::endl;}
 
       //Find monitoredItem 
       std::map<uint32_t, MonitoredDataChange>::iterator mii_it =  MonitoredDataChanges.find( monitoreditemid );
@@ -403,79 +480,31 @@ namespace OpcUa
         return false;
       }
           
+      if ( ! mii_it->second.EventFilter )
+      {
+        if (Debug) std::cout << "InternalSubcsription | monitoreditem " << monitoreditemid << " does not monitor events" << std::endl;
+        return false;
+      }
+
       //Check filter against event data and create EventFieldList to send
-      //FIXME: Here we should also check event agains WhereClause of filter
+      //Filters are shared between monitored items, so the event is only filtered and projected once for all of them
+      const std::vector<Variant>* fields = projection.Apply(*mii_it->second.EventFilter);
+      if ( ! fields )
+      {
+        if (Debug) std::cout << "InternalSubcsription | event does not match where clause of monitoreditem " << monitoreditemid << std::endl;
+        return false;
+      }
       EventFieldList fieldlist;
       fieldlist.ClientHandle = mii_it->second.ClientHandle; 
-      fieldlist.EventFields = GetEventFields(mii_it->second.Parameters.FilterResult.Event, event);
+      fieldlist.EventFields = *fields;
       TriggeredEvent ev;
       ev.Data = fieldlist;
       ev.MonitoredItemId = monitoreditemid;
       TriggeredEvents.push_back(ev);
+      Diagnostics::Change(Diagnostics::NotificationBacklog, 1);
       return true;
     }
 
-    std::vector<Variant> InternalSubscription::GetEventFields(const EventFilter& filter, const Event& event)
-    {
-      //Go through filter and add value og matches as in spec
-      std::vector<Variant> fields;
-      if(Debug) std::cout << "InternalSubscription | InternalGetEventField " << filter.SelectClauses.size() << std::endl;
-      for (SimpleAttributeOperand sattr : filter.SelectClauses)
-      {
-        if(Debug) std::cout << "InternalSubscription | BrowsePath size " << sattr.BrowsePath.size() << std::endl;
-        if ( sattr.BrowsePath.size() == 0 )
-        {
-          fields.push_back(event.GetValue(sattr.Attribute));
-        }
-        else
-        {
-          if(Debug) std::cout << "InternalSubscription | sending value for : " << sattr.BrowsePath[0] << std::endl;
-          if ( sattr.BrowsePath[0] == QualifiedName("EventId", 0) )
-          {
-            fields.push_back(event.EventId);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("EventType", 0) )
-          {
-            fields.push_back(event.EventType);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("SourceNode", 0) )
-          {
-            fields.push_back(event.SourceNode);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("SourceName", 0) )
-          {
-            fields.push_back(event.SourceName);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("Message", 0) )
-          {
-            if (Debug) std::cout << "msg is: " << event.Message << std::endl;
-            fields.push_back(event.Message);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("Severity", 0) )
-          {
-            fields.push_back(event.Severity);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("LocalTime", 0) )
-          {
-            fields.push_back(event.LocalTime);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("ReceiveTime", 0) )
-          {
-            fields.push_back(event.ReceiveTime);
-          }
-          else if ( sattr.BrowsePath[0] == QualifiedName("Time", 0) )
-          {
-            fields.push_back(event.Time);
-          }
-          else
-          {
-            fields.push_back(event.GetValue(sattr.BrowsePath));
-          }
-        }
-      }
-      return fields;
-    }
-
 
   }
 }
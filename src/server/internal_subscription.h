@@ -2,6 +2,7 @@
 #pragma once
 
 //#include "address_space_internal.h"
+#include "event_filter.h"
 #include "subscription_service_internal.h"
 
 #include <opc/ua/event.h>
@@ -35,6 +36,7 @@ namespace OpcUa
       MonitoredItemCreateResult Parameters;
       uint32_t ClientHandle;
       uint32_t CallbackHandle;
+      std::shared_ptr<CompiledEventFilter> EventFilter; //set for event monitored items only
     };
 
     struct TriggeredDataChange
@@ -67,11 +69,17 @@ namespace OpcUa
         void NewAcknowlegment(const SubscriptionAcknowledgement& ack);
         std::vector<StatusCode> DeleteMonitoredItemsIds(const std::vector<uint32_t>& ids);
         bool EnqueueEvent(uint32_t monitoreditemid, const Event& event);
+        bool EnqueueEvent(uint32_t monitoreditemid, EventProjection& projection);
         bool EnqueueDataChange(uint32_t monitoreditemid, const DataValue& value);
         MonitoredItemCreateResult CreateMonitoredItem(const MonitoredItemCreateRequest& request);
         void DataChangeCallback(const uint32_t&, const DataValue& value);
         bool HasExpired();
-        void TriggerEvent(NodeId node, Event event);
+        void TriggerEvent(const NodeId& node, EventProjection& projection);
+        //Enqueue event for every monitored item subscribed to events, whatever its notifier
+        void BroadcastEvent(EventProjection& projection);
+        //Nodes this subscription monitors events from
+        std::vector<NodeId> GetEventNotifiers() const;
+        uint32_t GetId() const { return Data.SubscriptionId; }
         RepublishResponse Republish(const RepublishParameters& params);
 
       private:
@@ -82,7 +90,6 @@ namespace OpcUa
         bool HasPublishResult(); 
         NotificationData GetNotificationData();
         void PublishResults(const boost::system::error_code& error);
-        std::vector<Variant> GetEventFields(const EventFilter& filter, const Event& event);
         void TriggerDataChangeEvent(MonitoredDataChange monitoreditems, ReadValueId attrval);
 
       private:
@@ -0,0 +1,146 @@
+/// @brief Interned browse and display names of nodes.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "name_table.h"
+
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+namespace
+{
+  using namespace OpcUa;
+
+  struct QualifiedNameHash
+  {
+    std::size_t operator()(const QualifiedName& name) const
+    {
+      return std::hash<std::string>()(name.Name) * 31 + name.NamespaceIndex;
+    }
+  };
+
+  struct LocalizedTextHash
+  {
+    std::size_t operator()(const LocalizedText& text) const
+    {
+      return (std::hash<std::string>()(text.Text) * 31 + std::hash<std::string>()(text.Locale)) * 31 + text.Encoding;
+    }
+  };
+
+  // Names are owned by the references using them, the table only knows them:
+  // the last reference removes its name from the table.
+  template <typename T, typename Hash>
+  class Table : public std::enable_shared_from_this<Table<T, Hash>>
+  {
+  public:
+    std::shared_ptr<const T> Intern(const T& value)
+    {
+      if (std::shared_ptr<const T> name = Find(value))
+      {
+        return name;
+      }
+      boost::unique_lock<boost::shared_mutex> lock(Mutex);
+      typename NameMap::iterator it = Values.find(&value);
+      if (it != Values.end())
+      {
+        if (std::shared_ptr<const T> name = it->second.lock())
+        {
+          return name;
+        }
+        // Released, its deleter waits for the lock and leaves the new entry
+        Values.erase(it);
+      }
+      std::shared_ptr<Table> self = this->shared_from_this();
+      std::shared_ptr<const T> name(new T(value), [self](const T* released) { self->Release(released); });
+      Values.insert(std::make_pair(name.get(), std::weak_ptr<const T>(name)));
+      return name;
+    }
+
+    std::shared_ptr<const T> Find(const T& value) const
+    {
+      boost::shared_lock<boost::shared_mutex> lock(Mutex);
+      typename NameMap::const_iterator it = Values.find(&value);
+      return it != Values.end() ? it->second.lock() : std::shared_ptr<const T>();
+    }
+
+  private:
+    void Release(const T* name)
+    {
+      {
+        boost::unique_lock<boost::shared_mutex> lock(Mutex);
+        typename NameMap::iterator it = Values.find(name);
+        if (it != Values.end() && it->first == name)
+        {
+          Values.erase(it);
+        }
+      }
+      delete name;
+    }
+
+    // Keys point to the names themselves, lookups pass the address of the searched value.
+    struct KeyHash
+    {
+      std::size_t operator()(const T* value) const
+      {
+        return Hash()(*value);
+      }
+    };
+
+    struct KeyEqual
+    {
+      bool operator()(const T* left, const T* right) const
+      {
+        return *left == *right;
+      }
+    };
+
+    typedef std::unordered_map<const T*, std::weak_ptr<const T>, KeyHash, KeyEqual> NameMap;
+
+  private:
+    mutable boost::shared_mutex Mutex;
+    NameMap Values;
+  };
+
+  // Tables live as long as a name, names may be released after static destructors ran.
+  Table<QualifiedName, QualifiedNameHash>& QualifiedNames()
+  {
+    static const std::shared_ptr<Table<QualifiedName, QualifiedNameHash>> table = std::make_shared<Table<QualifiedName, QualifiedNameHash>>();
+    return *table;
+  }
+
+  Table<LocalizedText, LocalizedTextHash>& LocalizedTexts()
+  {
+    static const std::shared_ptr<Table<LocalizedText, LocalizedTextHash>> table = std::make_shared<Table<LocalizedText, LocalizedTextHash>>();
+    return *table;
+  }
+}
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    std::shared_ptr<const QualifiedName> InternName(const QualifiedName& name)
+    {
+      return QualifiedNames().Intern(name);
+    }
+
+    std::shared_ptr<const LocalizedText> InternName(const LocalizedText& name)
+    {
+      return LocalizedTexts().Intern(name);
+    }
+
+    std::shared_ptr<const QualifiedName> FindName(const QualifiedName& name)
+    {
+      return QualifiedNames().Find(name);
+    }
+
+  }
+}
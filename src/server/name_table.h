@@ -0,0 +1,31 @@
+/// @brief Interned browse and display names of nodes.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/types.h>
+
+#include <memory>
+
+namespace OpcUa
+{
+  namespace Internal
+  {
+
+    //Every distinct name in use is stored once for the whole process,
+    //so equal names have equal pointers and can be compared without touching strings.
+    //Standard namespace names are shared by all address spaces.
+    //A name is freed with the last reference to it.
+    std::shared_ptr<const QualifiedName> InternName(const QualifiedName& name);
+    std::shared_ptr<const LocalizedText> InternName(const LocalizedText& name);
+
+    //Interned name equal to the given one, empty if no node has such name.
+    std::shared_ptr<const QualifiedName> FindName(const QualifiedName& name);
+
+  }
+}
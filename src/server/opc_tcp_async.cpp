@@ -18,6 +18,7 @@
  ******************************************************************************/
 
 #include "opc_tcp_processor.h"
+#include "server_diagnostics.h"
 
 #include <opc/ua/server/opc_tcp_async.h>
 
@@ -30,7 +31,10 @@
 
 #include <array>
 #include <boost/asio.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 #include <set>
 
 
@@ -65,11 +69,19 @@ namespace
   private:// OpcTcpClient interface;
     friend class OpcTcpConnection;
     void RemoveClient(std::shared_ptr<OpcTcpConnection> client);
+    void ConnectionClosed();
 
   private:
     Parameters Params;
     Services::SharedPtr Server;
+    boost::asio::io_service& IoService;
+    std::mutex ClientsMutex;
+    std::condition_variable ClientsClosed;
     std::set<std::shared_ptr<OpcTcpConnection>> Clients;
+    // Connections which are not destroyed yet, they refer to the server until then.
+    std::size_t OpenConnections = 0;
+    bool Accepting = false;
+    bool Stopping = false;
 
     tcp::socket socket;
     tcp::acceptor acceptor;
@@ -126,6 +138,7 @@ namespace
 
   OpcTcpConnection::~OpcTcpConnection()
   {
+    TcpServer.ConnectionClosed();
   }
 
   void OpcTcpConnection::Start()
@@ -135,8 +148,10 @@ namespace
 
   void OpcTcpConnection::ReadNextData()
   {
+    // Pending operation keeps the connection alive after it is removed from the server.
+    SharedPtr self = shared_from_this();
     async_read(Socket, buffer(Buffer), transfer_exactly(GetHeaderSize()),
-      [this](const boost::system::error_code& error, std::size_t bytes_transferred)
+      [this, self](const boost::system::error_code& error, std::size_t bytes_transferred)
       {
         try
         {
@@ -181,8 +196,9 @@ namespace
       std::cout << "opc_tcp_async| Waiting " << messageSize << " bytes from client." << std::endl;
     }
 
+    SharedPtr self = shared_from_this();
     async_read(Socket, buffer(Buffer), transfer_exactly(messageSize),
-        [this, header](const boost::system::error_code& error, std::size_t bytesTransferred)
+        [this, self, header](const boost::system::error_code& error, std::size_t bytesTransferred)
         {
           if (error)
           {
@@ -204,6 +220,8 @@ namespace
       return;
     }
 
+    OpcUa::Server::Diagnostics::Add(OpcUa::Server::Diagnostics::BytesReceived, GetHeaderSize() + bytesTransferred);
+
     if (Debug)
     {
       if (Debug) std::cout << "opc_tcp_async| Received " << bytesTransferred << " bytes from client:" << std::endl;
@@ -259,15 +277,19 @@ namespace
       PrintBlob(*data);
     }
 
-    async_write(Socket, buffer(&(*data)[0], data->size()), [this, data](const boost::system::error_code & err, size_t bytes){
+    // Publish responses are sent from other threads while the connection may be closing,
+    // so the handler does not use the connection. Failed socket is closed by the pending read.
+    const bool debug = Debug;
+    async_write(Socket, buffer(&(*data)[0], data->size()), [debug, data](const boost::system::error_code & err, size_t bytes){
       if (err)
       {
         std::cerr << "opc_tcp_async| Failed to send data to the client. " << err.message() << std::endl;
-        GoodBye();
         return;
       }
 
-      if (Debug)
+      OpcUa::Server::Diagnostics::Add(OpcUa::Server::Diagnostics::BytesSent, bytes);
+
+      if (debug)
       {
         std::cout << "opc_tcp_async| Response sent to the client." << std::endl;
       }
@@ -277,6 +299,7 @@ namespace
   OpcTcpServer::OpcTcpServer(const AsyncOpcTcp::Parameters& params, Services::SharedPtr server, boost::asio::io_service& ioService)
     : Params(params)
     , Server(server)
+    , IoService(ioService)
     , socket(ioService)
     , acceptor(ioService)
   {
@@ -307,8 +330,26 @@ namespace
   void OpcTcpServer::Shutdown()
   {
     std::clog << "opc_tcp_async| Shutting down server." << std::endl;
-    Clients.clear();
-    acceptor.close();
+    std::set<std::shared_ptr<OpcTcpConnection>> clients;
+    {
+      std::lock_guard<std::mutex> lock(ClientsMutex);
+      Stopping = true;
+      clients.swap(Clients);
+    }
+    // Sockets are closed in the io threads, aborted reads release the last references to connections.
+    for (const std::shared_ptr<OpcTcpConnection>& client : clients)
+    {
+      IoService.post([client]() { client->Stop(); });
+    }
+    clients.clear();
+    IoService.post([this]() { acceptor.close(); });
+
+    // Handlers of connections and of the acceptor use the server, so wait until they finished.
+    std::unique_lock<std::mutex> lock(ClientsMutex);
+    if (!ClientsClosed.wait_for(lock, std::chrono::seconds(5), [this]() { return OpenConnections == 0 && !Accepting; }))
+    {
+      std::cerr << "opc_tcp_async| " << OpenConnections << " client connections were not closed during shutdown." << std::endl;
+    }
   }
 
   void OpcTcpServer::Accept()
@@ -317,12 +358,35 @@ namespace
     {
       std::cout << "opc_tcp_async| Waiting for client connection at: " << acceptor.local_endpoint().address() << ":" << acceptor.local_endpoint().port() <<  std::endl;
       acceptor.listen();
+      {
+        std::lock_guard<std::mutex> lock(ClientsMutex);
+        if (Stopping)
+        {
+          return;
+        }
+        Accepting = true;
+      }
       acceptor.async_accept(socket, [this](boost::system::error_code errorCode){
-        if (!errorCode)
+        std::shared_ptr<OpcTcpConnection> connection;
+        {
+          std::lock_guard<std::mutex> lock(ClientsMutex);
+          Accepting = false;
+          if (Stopping)
+          {
+            ClientsClosed.notify_all();
+            return;
+          }
+          if (!errorCode)
+          {
+            connection = std::make_shared<OpcTcpConnection>(std::move(socket), *this, Server, Params.DebugMode);
+            ++OpenConnections;
+            Clients.insert(connection);
+          }
+        }
+
+        if (connection)
         {
           std::cout << "opc_tcp_async| Accepted new client connection." << std::endl;
-          std::shared_ptr<OpcTcpConnection> connection = std::make_shared<OpcTcpConnection>(std::move(socket), *this, Server, Params.DebugMode);
-          Clients.insert(connection);
           connection->Start();
         }
         else
@@ -340,9 +404,17 @@ namespace
 
   void OpcTcpServer::RemoveClient(OpcTcpConnection::SharedPtr client)
   {
+    std::lock_guard<std::mutex> lock(ClientsMutex);
     Clients.erase(client);
   }
 
+  void OpcTcpServer::ConnectionClosed()
+  {
+    std::lock_guard<std::mutex> lock(ClientsMutex);
+    --OpenConnections;
+    ClientsClosed.notify_all();
+  }
+
 } // namespace
 
 OpcUa::Server::AsyncOpcTcp::UniquePtr OpcUa::Server::CreateAsyncOpcTcp(const OpcUa::Server::AsyncOpcTcp::Parameters& params, Services::SharedPtr server, boost::asio::io_service& io)
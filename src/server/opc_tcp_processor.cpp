@@ -11,11 +11,13 @@
 #include "opc_tcp_processor.h"
 
 #include "opcua_protocol.h"
+#include "server_clock.h"
 
 #include <opc/common/uri_facade.h>
 #include <opc/ua/connection_listener.h>
 #include <opc/ua/protocol/binary/common.h>
 #include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/history.h>
 #include <opc/ua/protocol/input_from_buffer.h>
 #include <opc/ua/protocol/monitored_items.h>
 #include <opc/ua/protocol/object_ids.h>
@@ -27,6 +29,7 @@
 #include <opc/ua/server/addons/opcua_protocol.h>
 #include <opc/ua/server/addons/services_registry.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <list>
@@ -68,6 +71,13 @@ namespace OpcUa
       {
         std::cerr << "Error during stopping OpcTcpMessages. " << exc.what() <<std::endl;
       }
+
+      if (SessionOpened)
+      {
+        Diagnostics::Change(Diagnostics::CurrentSessions, -1);
+        Diagnostics::Add(Diagnostics::AbortedSessions);
+      }
+      Diagnostics::Change(Diagnostics::QueuedPublishRequests, -static_cast<int64_t>(PublishRequestQueue.size()));
     }
 
     bool OpcTcpMessages::ProcessMessage(MessageType msgType, IStreamBinary& iStream)
@@ -134,10 +144,17 @@ namespace OpcUa
       if ( PublishRequestQueue.empty() )
       {
         std::cerr << "Error trying to send publish response while we do not have data from a PublishRequest" << std::endl;
+        std::size_t notifications = 0;
+        for (const NotificationData& data : result.NotificationMessage.NotificationData)
+        {
+          notifications += data.DataChange.Notification.size() + data.Events.Events.size();
+        }
+        Diagnostics::Add(Diagnostics::DroppedNotifications, notifications);
         return;
       }
       PublishRequestElement requestData = PublishRequestQueue.front();
       PublishRequestQueue.pop();
+      Diagnostics::Change(Diagnostics::QueuedPublishRequests, -1);
 
       PublishResponse response;
 
@@ -147,13 +164,12 @@ namespace OpcUa
       requestData.sequence.SequenceNumber = ++SequenceNb;
 
       SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-      secureHeader.AddSize(RawSize(requestData.algorithmHeader));
-      secureHeader.AddSize(RawSize(requestData.sequence));
-      secureHeader.AddSize(RawSize(response));
       if (Debug) {
         std::cout << "opc_tcp_processor| Sedning publishResponse with " << response.Parameters.NotificationMessage.NotificationData.size() << " PublishResults" << std::endl;
       }
-      OutputStream << secureHeader << requestData.algorithmHeader << requestData.sequence << response << flush;
+      const Diagnostics::Clock::time_point started = Diagnostics::Clock::now();
+      WriteMessage(OutputStream, secureHeader, requestData.algorithmHeader, requestData.sequence, response);
+      Diagnostics::Record(Diagnostics::EncodeTime, Diagnostics::Clock::now() - started);
     }
     
     void OpcTcpMessages::HelloClient(IStreamBinary& istream, OStreamBinary& ostream)
@@ -171,9 +187,8 @@ namespace OpcUa
       ack.MaxChunkCount = 1;
 
       Header ackHeader(MT_ACKNOWLEDGE, CHT_SINGLE);
-      ackHeader.AddSize(RawSize(ack));
       if (Debug) std::clog << "opc_tcp_processor| Sending answer to client." << std::endl;
-      ostream << ackHeader << ack << flush;
+      WriteMessage(ostream, ackHeader, ack);
     }
 
     void OpcTcpMessages::OpenChannel(IStreamBinary& istream, OStreamBinary& ostream)
@@ -215,10 +230,7 @@ namespace OpcUa
       response.ChannelSecurityToken.RevisedLifetime = request.Parameters.RequestLifeTime;
 
       SecureHeader responseHeader(MT_SECURE_OPEN, CHT_SINGLE, ChannelId);
-      responseHeader.AddSize(RawSize(algorithmHeader));
-      responseHeader.AddSize(RawSize(sequence));
-      responseHeader.AddSize(RawSize(response));
-      ostream << responseHeader << algorithmHeader << sequence << response << flush;
+      WriteMessage(ostream, responseHeader, algorithmHeader, sequence, response);
     }
 
     void OpcTcpMessages::CloseChannel(IStreamBinary& istream)
@@ -238,6 +250,8 @@ namespace OpcUa
 
     void OpcTcpMessages::ProcessRequest(IStreamBinary& istream, OStreamBinary& ostream)
     {
+      RequestStarted = Diagnostics::Clock::now();
+
       uint32_t channelId = 0;
       istream >> channelId;
 
@@ -251,7 +265,7 @@ namespace OpcUa
       istream >> typeId;
 
       RequestHeader requestHeader;
-      istream >> requestHeader;
+      Decode(istream, requestHeader);
 
       sequence.SequenceNumber = ++SequenceNb;
 /*
@@ -263,23 +277,21 @@ namespace OpcUa
         RawSize(requestHeader);
 */
       const OpcUa::MessageId message = GetMessageId(typeId);
+      Diagnostics::CountService(GetServiceType(message));
       switch (message)
       {
         case OpcUa::GET_ENDPOINTS_REQUEST:
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing get endpoints request." << std::endl;
           GetEndpointsParameters filter;
-          istream >> filter;
+          Decode(istream, filter);
 
           GetEndpointsResponse response;
           FillResponseHeader(requestHeader, response.Header);
           response.Endpoints = Server->Endpoints()->GetEndpoints(filter);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -287,17 +299,14 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Find Servers' request." << std::endl;
           FindServersParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           FindServersResponse response;
           FillResponseHeader(requestHeader, response.Header);
           response.Data.Descriptions = Server->Endpoints()->FindServers(params);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -305,7 +314,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing browse request." << std::endl;
           NodesQuery query;
-          istream >> query;
+          Decode(istream, query);
 
           BrowseResponse response;
           response.Results =  Server->Views()->Browse(query);
@@ -313,22 +322,19 @@ namespace OpcUa
           FillResponseHeader(requestHeader, response.Header);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
         case OpcUa::READ_REQUEST:
         {
           ReadParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           if (Debug)
           {
             std::clog << "opc_tcp_processor| Processing read request for Node:";
-            for (ReadValueId id : params.AttributesToRead)
+            for (const ReadValueId& id : params.AttributesToRead)
             {
               std::clog << "opc_tcp_processor|  " << id.NodeId;
             }
@@ -352,13 +358,10 @@ namespace OpcUa
               values.push_back(value);
             }
           }
-          response.Results = values;
+          response.Results = std::move(values);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
 
           return;
         }
@@ -367,7 +370,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing write request." << std::endl;
           WriteParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           WriteResponse response;
           FillResponseHeader(requestHeader, response.Header);
@@ -382,10 +385,35 @@ namespace OpcUa
           }
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
+
+          return;
+        }
+
+        case OpcUa::HISTORY_READ_REQUEST:
+        {
+          if (Debug) std::clog << "opc_tcp_processor| Processing history read request." << std::endl;
+          HistoryReadParameters params;
+          Decode(istream, params);
+
+          HistoryReadResponse response;
+          FillResponseHeader(requestHeader, response.Header);
+          if (std::shared_ptr<OpcUa::AttributeServices> service = Server->Attributes())
+          {
+            response.Results = service->HistoryRead(params);
+          }
+          else
+          {
+            for (std::size_t i = 0; i < params.NodesToRead.size(); ++i)
+            {
+              HistoryReadResult result;
+              result.Status = OpcUa::StatusCode::BadNotImplemented;
+              response.Results.push_back(result);
+            }
+          }
+
+          SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
 
           return;
         }
@@ -394,7 +422,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Translate Browse Paths To Node Ids' request." << std::endl;
           TranslateBrowsePathsParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           if (Debug)
           {
@@ -416,7 +444,7 @@ namespace OpcUa
             for (BrowsePathResult res: result)
             {
               std::cout << "opc_tcp_processor| Result of browsePath is: " << (uint32_t) res.Status << ". Target is: ";
-              for ( BrowsePathTarget path : res.Targets)
+              for (const BrowsePathTarget& path : res.Targets)
               {
                 std::cout << path.Node ;
               }
@@ -426,14 +454,11 @@ namespace OpcUa
 
           TranslateBrowsePathsToNodeIdsResponse response;
           FillResponseHeader(requestHeader, response.Header);
-          response.Result.Paths = result;
+          response.Result.Paths = std::move(result);
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to 'Translate Browse Paths To Node Ids' request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -442,7 +467,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing create session request." << std::endl;
           CreateSessionParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           CreateSessionResponse response;
           FillResponseHeader(requestHeader, response.Header);
@@ -454,12 +479,15 @@ namespace OpcUa
           GetEndpointsParameters epf;
           response.Parameters.ServerEndpoints = Server->Endpoints()->GetEndpoints(epf);
 
+          if (!SessionOpened)
+          {
+            SessionOpened = true;
+            Diagnostics::Add(Diagnostics::CumulatedSessions);
+            Diagnostics::Change(Diagnostics::CurrentSessions, 1);
+          }
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
 
           return;
         }
@@ -467,16 +495,13 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing activate session request." << std::endl;
           ActivateSessionParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           ActivateSessionResponse response;
           FillResponseHeader(requestHeader, response.Header);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -484,21 +509,24 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing close session request." << std::endl;
           bool deleteSubscriptions = false;
-          istream >> deleteSubscriptions;
+          Decode(istream, deleteSubscriptions);
 
           if (deleteSubscriptions)
           {
             DeleteAllSubscriptions();
           }
 
+          if (SessionOpened)
+          {
+            SessionOpened = false;
+            Diagnostics::Change(Diagnostics::CurrentSessions, -1);
+          }
+
           CloseSessionResponse response;
           FillResponseHeader(requestHeader, response.Header);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           if (Debug) std::clog << "opc_tcp_processor| Session Closed " << std::endl;
           return;
         }
@@ -507,7 +535,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing create subscription request." << std::endl;
           CreateSubscriptionRequest request;
-          istream >> request.Parameters;
+          Decode(istream, request.Parameters);
           request.Header = requestHeader;
 
           CreateSubscriptionResponse response;
@@ -528,10 +556,7 @@ namespace OpcUa
           Subscriptions.push_back(response.Data.SubscriptionId); //Keep a link to eventually delete subcriptions when exiting
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -539,7 +564,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing delete subscription request." << std::endl;
           std::vector<uint32_t> ids;
-          istream >> ids;
+          Decode(istream, ids);
 
           DeleteSubscriptions(ids); //remove from locale subscription lis
 
@@ -549,12 +574,9 @@ namespace OpcUa
           response.Results = Server->Subscriptions()->DeleteSubscriptions(ids);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to Delete Subscription Request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -562,7 +584,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Create Monitored Items' request." << std::endl;
           MonitoredItemsParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           CreateMonitoredItemsResponse response;
 
@@ -570,12 +592,9 @@ namespace OpcUa
 
           FillResponseHeader(requestHeader, response.Header);
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to Create Monitored Items Request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -583,7 +602,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Delete Monitored Items' request." << std::endl;
           DeleteMonitoredItemsParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           DeleteMonitoredItemsResponse response;
 
@@ -591,12 +610,9 @@ namespace OpcUa
 
           FillResponseHeader(requestHeader, response.Header);
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to Delete Monitored Items Request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -605,14 +621,18 @@ namespace OpcUa
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Publish' request." << std::endl;
           PublishRequest request;
           request.Header = requestHeader;
-          istream >> request.SubscriptionAcknowledgements;
+          Decode(istream, request.SubscriptionAcknowledgements);
 
           PublishRequestElement data;
           data.sequence = sequence;
           data.algorithmHeader = algorithmHeader;
           data.requestHeader = requestHeader;
           PublishRequestQueue.push(data);
+          Diagnostics::Change(Diagnostics::QueuedPublishRequests, 1);
           Server->Subscriptions()->Publish(request);
+          // Response is encoded later by ForwardPublishResponse.
+          Diagnostics::Record(Diagnostics::DecodeTime, RequestDecoded - RequestStarted);
+          Diagnostics::Record(Diagnostics::HandlerTime, Diagnostics::Clock::now() - RequestDecoded);
 
           --SequenceNb; //We do not send response, so do not increase sequence
 
@@ -623,7 +643,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Set Publishing Mode' request." << std::endl;
           PublishingModeParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           //FIXME: forward request to internal server!!
           SetPublishingModeResponse response;
@@ -631,12 +651,9 @@ namespace OpcUa
           response.Result.Results.resize(params.SubscriptionIds.size(), StatusCode::Good);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to 'Set Publishing Mode' request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -644,21 +661,18 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Add Nodes' request." << std::endl;
           AddNodesParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           std::vector<AddNodesResult> results = Server->NodeManagement()->AddNodes(params.NodesToAdd);
 
           AddNodesResponse response;
           FillResponseHeader(requestHeader, response.Header);
-          response.results = results;
+          response.results = std::move(results);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to 'Add Nodes' request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -666,21 +680,18 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Add References' request." << std::endl;
           AddReferencesParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           std::vector<StatusCode> results = Server->NodeManagement()->AddReferences(params.ReferencesToAdd);
 
           AddReferencesResponse response;
           FillResponseHeader(requestHeader, response.Header);
-          response.Results = results;
+          response.Results = std::move(results);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to 'Add References' request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -688,7 +699,7 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing 'Republish' request." << std::endl;
           RepublishParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           //Not implemented so we just say we do not have that notification
           RepublishResponse response;
@@ -696,12 +707,9 @@ namespace OpcUa
           response.Header.ServiceResult = StatusCode::BadMessageNotAvailable;
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::clog << "opc_tcp_processor| Sending response to 'Republish' request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -709,30 +717,45 @@ namespace OpcUa
         {
           if (Debug) std::clog << "opc_tcp_processor| Processing call request." << std::endl;
           CallParameters params;
-          istream >> params;
+          Decode(istream, params);
 
           CallResponse response;
           FillResponseHeader(requestHeader, response.Header);
 
+          // ConditionRefresh may only be called for subscriptions of this session
+          std::vector<CallMethodRequest> calls;
+          std::vector<std::size_t> positions;
+          response.Results.resize(params.MethodsToCall.size());
+          for (std::size_t i = 0; i < params.MethodsToCall.size(); ++i)
+          {
+            CallMethodRequest& call = params.MethodsToCall[i];
+            if (call.MethodId == ObjectId::ConditionType_ConditionRefresh && !IsSessionSubscription(call.InputArguments))
+            {
+              response.Results[i].Status = OpcUa::StatusCode::BadSubscriptionIdInvalid;
+              continue;
+            }
+            calls.push_back(std::move(call));
+            positions.push_back(i);
+          }
+
           if (std::shared_ptr<OpcUa::MethodServices> service = Server->Method())
           {
-            response.Results = service->Call(params.MethodsToCall);
+            const std::vector<CallMethodResult> results = service->Call(calls);
+            for (std::size_t i = 0; i < results.size() && i < positions.size(); ++i)
+            {
+              response.Results[positions[i]] = results[i];
+            }
           }
           else
           {
-            for (auto callMethodRequest : params.MethodsToCall)
+            for (std::size_t position : positions)
             {
-              OpcUa::CallMethodResult result;
-              result.Status = OpcUa::StatusCode::BadNotImplemented;
-              response.Results.push_back(result);
+              response.Results[position].Status = OpcUa::StatusCode::BadNotImplemented;
             }
           }
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
 
           return;
         }
@@ -742,7 +765,7 @@ namespace OpcUa
           if (Debug) std::clog << "opc_tcp_processor| Processing register nodes request." << std::endl;
           RegisterNodesRequest request;
 
-          istream >> request.NodesToRegister;
+          Decode(istream, request.NodesToRegister);
 
           RegisterNodesResponse response;
           response.Result = Server->Views()->RegisterNodes(request.NodesToRegister);
@@ -750,11 +773,8 @@ namespace OpcUa
           FillResponseHeader(requestHeader, response.Header);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
           if (Debug) std::clog << "opc_tcp_processor| Sending response to register nodes request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
@@ -763,7 +783,7 @@ namespace OpcUa
           if (Debug) std::clog << "opc_tcp_processor| Processing unregister nodes request." << std::endl;
           UnregisterNodesRequest request;
 
-          istream >> request.NodesToUnregister;
+          Decode(istream, request.NodesToUnregister);
 
           UnregisterNodesResponse response;
           Server->Views()->UnregisterNodes(request.NodesToUnregister);
@@ -771,36 +791,41 @@ namespace OpcUa
           FillResponseHeader(requestHeader, response.Header);
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
           if (Debug) std::clog << "opc_tcp_processor| Sending response to unregister nodes request." << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
 
         default:
         {
+          Diagnostics::Add(Diagnostics::RejectedRequests);
           ServiceFaultResponse response;
           FillResponseHeader(requestHeader, response.Header);
           response.Header.ServiceResult = StatusCode::BadNotImplemented;
 
           SecureHeader secureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, ChannelId);
-          secureHeader.AddSize(RawSize(algorithmHeader));
-          secureHeader.AddSize(RawSize(sequence));
-          secureHeader.AddSize(RawSize(response));
 
           if (Debug) std::cerr << "opc_tcp_processor| Sending ServiceFaultResponse to unsupported request of id: " << message << std::endl;
-          ostream << secureHeader << algorithmHeader << sequence << response << flush;
+          SendResponse(ostream, secureHeader, algorithmHeader, sequence, response);
           return;
         }
       }
     }
 
+    bool OpcTcpMessages::IsSessionSubscription(const std::vector<Variant>& arguments) const
+    {
+      if (arguments.size() != 1 || arguments[0].Type() != VariantType::UINT32)
+      {
+        return false;
+      }
+      const uint32_t id = arguments[0].As<uint32_t>();
+      return std::find(Subscriptions.begin(), Subscriptions.end(), id) != Subscriptions.end();
+    }
+
     void OpcTcpMessages::FillResponseHeader(const RequestHeader& requestHeader, ResponseHeader& responseHeader)
     {
        //responseHeader.InnerDiagnostics.push_back(DiagnosticInfo());
-       responseHeader.Timestamp = DateTime::Current();
+       responseHeader.Timestamp = ServerClock::Now();
        responseHeader.RequestHandle = requestHeader.RequestHandle;
     }
 
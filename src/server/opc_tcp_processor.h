@@ -8,6 +8,8 @@
 /// http://www.gnu.org/licenses/lgpl.html)
 ///
 
+#include "server_diagnostics.h"
+
 #include <opc/ua/protocol/binary/common.h>
 #include <opc/ua/protocol/binary/stream.h>
 #include <opc/ua/services/services.h>
@@ -39,6 +41,24 @@ namespace OpcUa
       void DeleteSubscriptions(const std::vector<uint32_t>& ids);
       void DeleteAllSubscriptions();
       void ForwardPublishResponse(const PublishResult response);
+      bool IsSessionSubscription(const std::vector<Variant>& arguments) const;
+
+      template <typename T>
+      void Decode(Binary::IStreamBinary& istream, T& value)
+      {
+        istream >> value;
+        RequestDecoded = Diagnostics::Clock::now();
+      }
+
+      template <typename Response>
+      void SendResponse(Binary::OStreamBinary& ostream, const Binary::SecureHeader& header, const Binary::SymmetricAlgorithmHeader& algorithmHeader, const Binary::SequenceHeader& sequence, const Response& response)
+      {
+        const Diagnostics::Clock::time_point handled = Diagnostics::Clock::now();
+        Binary::WriteMessage(ostream, header, algorithmHeader, sequence, response);
+        Diagnostics::Record(Diagnostics::DecodeTime, RequestDecoded - RequestStarted);
+        Diagnostics::Record(Diagnostics::HandlerTime, handled - RequestDecoded);
+        Diagnostics::Record(Diagnostics::EncodeTime, Diagnostics::Clock::now() - handled);
+      }
 
     private:
       std::mutex ProcessMutex;
@@ -50,6 +70,10 @@ namespace OpcUa
       ExpandedNodeId SessionId;
       //ExpandedNodeId AuthenticationToken;
       uint32_t SequenceNb;
+      bool SessionOpened = false;
+      // Time of the request being processed, guarded by ProcessMutex.
+      Diagnostics::Clock::time_point RequestStarted;
+      Diagnostics::Clock::time_point RequestDecoded;
 
       struct PublishRequestElement
       {
@@ -56,6 +56,16 @@ namespace OpcUa
 	  Name = name;
   }
 
+  void UaServer::SetHistoryPath(const std::string& path)
+  {
+	  HistoryPath = path;
+  }
+
+  void UaServer::SetCoarseTimestamps(bool coarse)
+  {
+	  CoarseTimestamps = coarse;
+  }
+
   void UaServer::AddAddressSpace(const std::string& path)
   {
 	  XmlAddressSpaces.push_back(path);
@@ -106,6 +116,8 @@ namespace OpcUa
 
     OpcUa::Server::Parameters params;
     params.Debug = Debug;
+    params.HistoryPath = HistoryPath;
+    params.CoarseTimestamps = CoarseTimestamps;
     params.Endpoint.Server = appDesc;
     params.Endpoint.EndpointUrl = Endpoint;
     params.Endpoint.SecurityMode = SecurityMode;
@@ -0,0 +1,39 @@
+/// @brief Clock of the timestamps set by the server.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "server_clock.h"
+
+#include <atomic>
+
+namespace
+{
+  std::atomic<bool> Coarse(false);
+}
+
+namespace OpcUa
+{
+  namespace Server
+  {
+
+    void ServerClock::SetCoarse(bool coarse)
+    {
+      Coarse = coarse;
+    }
+
+    bool ServerClock::IsCoarse()
+    {
+      return Coarse.load(std::memory_order_relaxed);
+    }
+
+    DateTime ServerClock::Now()
+    {
+      return IsCoarse() ? DateTime::CurrentCoarse() : DateTime::Current();
+    }
+
+  } // namespace Server
+} // namespace OpcUa
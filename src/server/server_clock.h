@@ -0,0 +1,30 @@
+/// @brief Clock of the timestamps set by the server.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/ua/protocol/datetime.h>
+
+namespace OpcUa
+{
+  namespace Server
+  {
+
+    /// @brief Process wide clock of server timestamps of written values, publish times,
+    /// response headers and server status. Coarse clock is much cheaper under heavy load
+    /// but advances only every few milliseconds.
+    class ServerClock
+    {
+    public:
+      static void SetCoarse(bool coarse);
+      static bool IsCoarse();
+      static DateTime Now();
+    };
+
+  } // namespace Server
+} // namespace OpcUa
@@ -0,0 +1,251 @@
+/// @brief Counters of server activity exposed in the diagnostics nodes of the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "server_diagnostics.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+  using namespace OpcUa::Server;
+
+  const std::size_t ServiceCount = static_cast<std::size_t>(ServiceType::Count);
+
+  // Counters of one thread. Only the owning thread changes them, so plain load and store
+  // are enough and readers see every value whole.
+  struct Shard
+  {
+    std::atomic<uint64_t> Counters[Diagnostics::CounterCount];
+    std::atomic<int64_t> Gauges[Diagnostics::GaugeCount];
+    std::atomic<uint64_t> Services[ServiceCount];
+    Common::Histogram Timings[Diagnostics::TimingCount];
+
+    Shard()
+    {
+      for (std::atomic<uint64_t>& counter : Counters)
+      {
+        counter.store(0, std::memory_order_relaxed);
+      }
+      for (std::atomic<int64_t>& gauge : Gauges)
+      {
+        gauge.store(0, std::memory_order_relaxed);
+      }
+      for (std::atomic<uint64_t>& service : Services)
+      {
+        service.store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  template <typename T>
+  void Increase(std::atomic<T>& value, T delta)
+  {
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+  }
+
+  // Shards of finished threads are given to new threads, values in them stay counted.
+  class ShardRegistry
+  {
+  public:
+    Shard* Acquire()
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      if (!Free.empty())
+      {
+        Shard* shard = Free.back();
+        Free.pop_back();
+        return shard;
+      }
+      All.push_back(std::unique_ptr<Shard>(new Shard()));
+      return All.back().get();
+    }
+
+    void Release(Shard* shard)
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      Free.push_back(shard);
+    }
+
+    template <typename Function>
+    void ForEach(Function function) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      for (const std::unique_ptr<Shard>& shard : All)
+      {
+        function(*shard);
+      }
+    }
+
+  private:
+    mutable std::mutex Mutex;
+    std::vector<std::unique_ptr<Shard>> All;
+    std::vector<Shard*> Free;
+  };
+
+  // Never destroyed, threads may finish after static objects are gone.
+  ShardRegistry& Registry()
+  {
+    static ShardRegistry* registry = new ShardRegistry();
+    return *registry;
+  }
+
+  struct LocalShard
+  {
+    Shard* Value = nullptr;
+
+    ~LocalShard()
+    {
+      if (Value)
+      {
+        Registry().Release(Value);
+      }
+    }
+  };
+
+  thread_local LocalShard CurrentThreadShard;
+
+  Shard& GetShard()
+  {
+    if (!CurrentThreadShard.Value)
+    {
+      CurrentThreadShard.Value = Registry().Acquire();
+    }
+    return *CurrentThreadShard.Value;
+  }
+}
+
+namespace OpcUa
+{
+  namespace Server
+  {
+
+    ServiceType GetServiceType(MessageId message)
+    {
+      switch (message)
+      {
+        case READ_REQUEST: return ServiceType::Read;
+        case HISTORY_READ_REQUEST: return ServiceType::HistoryRead;
+        case WRITE_REQUEST: return ServiceType::Write;
+        case CALL_REQUEST: return ServiceType::Call;
+        case CREATE_MONITORED_ITEMS_REQUEST: return ServiceType::CreateMonitoredItems;
+        case DELETE_MONITORED_ITEMS_REQUEST: return ServiceType::DeleteMonitoredItems;
+        case CREATE_SUBSCRIPTION_REQUEST: return ServiceType::CreateSubscription;
+        case SET_PUBLISHING_MODE_REQUEST: return ServiceType::SetPublishingMode;
+        case PUBLISH_REQUEST: return ServiceType::Publish;
+        case REPUBLISH_REQUEST: return ServiceType::Republish;
+        case DELETE_SUBSCRIPTION_REQUEST: return ServiceType::DeleteSubscriptions;
+        case ADD_NODES_REQUEST: return ServiceType::AddNodes;
+        case ADD_REFERENCES_REQUEST: return ServiceType::AddReferences;
+        case BROWSE_REQUEST: return ServiceType::Browse;
+        case TRANSLATE_BROWSE_PATHS_TO_NODE_IdS_REQUEST: return ServiceType::TranslateBrowsePathsToNodeIds;
+        case REGISTER_NODES_REQUEST: return ServiceType::RegisterNodes;
+        case UNREGISTER_NODES_REQUEST: return ServiceType::UnregisterNodes;
+        case GET_ENDPOINTS_REQUEST: return ServiceType::GetEndpoints;
+        case FIND_ServerS_REQUEST: return ServiceType::FindServers;
+        case CREATE_SESSION_REQUEST: return ServiceType::CreateSession;
+        case ACTIVATE_SESSION_REQUEST: return ServiceType::ActivateSession;
+        case CLOSE_SESSION_REQUEST: return ServiceType::CloseSession;
+        default: return ServiceType::Unsupported;
+      }
+    }
+
+    const char* GetCounterName(ServiceType service)
+    {
+      switch (service)
+      {
+        case ServiceType::Read: return "ReadCount";
+        case ServiceType::HistoryRead: return "HistoryReadCount";
+        case ServiceType::Write: return "WriteCount";
+        case ServiceType::Call: return "CallCount";
+        case ServiceType::CreateMonitoredItems: return "CreateMonitoredItemsCount";
+        case ServiceType::DeleteMonitoredItems: return "DeleteMonitoredItemsCount";
+        case ServiceType::CreateSubscription: return "CreateSubscriptionCount";
+        case ServiceType::SetPublishingMode: return "SetPublishingModeCount";
+        case ServiceType::Publish: return "PublishCount";
+        case ServiceType::Republish: return "RepublishCount";
+        case ServiceType::DeleteSubscriptions: return "DeleteSubscriptionsCount";
+        case ServiceType::AddNodes: return "AddNodesCount";
+        case ServiceType::AddReferences: return "AddReferencesCount";
+        case ServiceType::Browse: return "BrowseCount";
+        case ServiceType::TranslateBrowsePathsToNodeIds: return "TranslateBrowsePathsToNodeIdsCount";
+        case ServiceType::RegisterNodes: return "RegisterNodesCount";
+        case ServiceType::UnregisterNodes: return "UnregisterNodesCount";
+        case ServiceType::GetEndpoints: return "GetEndpointsCount";
+        case ServiceType::FindServers: return "FindServersCount";
+        case ServiceType::CreateSession: return "CreateSessionCount";
+        case ServiceType::ActivateSession: return "ActivateSessionCount";
+        case ServiceType::CloseSession: return "CloseSessionCount";
+        default: return "UnsupportedCount";
+      }
+    }
+
+    void Diagnostics::Add(Counter counter, uint64_t value)
+    {
+      Increase(GetShard().Counters[counter], value);
+    }
+
+    void Diagnostics::Change(Gauge gauge, int64_t delta)
+    {
+      Increase(GetShard().Gauges[gauge], delta);
+    }
+
+    void Diagnostics::CountService(ServiceType service)
+    {
+      Increase(GetShard().Services[static_cast<std::size_t>(service)], uint64_t(1));
+    }
+
+    void Diagnostics::Record(Timing timing, Clock::duration duration)
+    {
+      const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+      GetShard().Timings[timing].Record(ns > 0 ? static_cast<uint64_t>(ns) : 0);
+    }
+
+    uint64_t Diagnostics::Get(Counter counter)
+    {
+      uint64_t result = 0;
+      Registry().ForEach([&](const Shard& shard) { result += shard.Counters[counter].load(std::memory_order_relaxed); });
+      return result;
+    }
+
+    int64_t Diagnostics::Get(Gauge gauge)
+    {
+      int64_t result = 0;
+      Registry().ForEach([&](const Shard& shard) { result += shard.Gauges[gauge].load(std::memory_order_relaxed); });
+      return result;
+    }
+
+    uint64_t Diagnostics::GetServiceCount(ServiceType service)
+    {
+      uint64_t result = 0;
+      Registry().ForEach([&](const Shard& shard) { result += shard.Services[static_cast<std::size_t>(service)].load(std::memory_order_relaxed); });
+      return result;
+    }
+
+    uint64_t Diagnostics::GetRequestCount()
+    {
+      uint64_t result = 0;
+      Registry().ForEach([&](const Shard& shard)
+      {
+        for (const std::atomic<uint64_t>& service : shard.Services)
+        {
+          result += service.load(std::memory_order_relaxed);
+        }
+      });
+      return result;
+    }
+
+    void Diagnostics::Get(Timing timing, Common::Histogram& result)
+    {
+      Registry().ForEach([&](const Shard& shard) { result.Merge(shard.Timings[timing]); });
+    }
+
+  } // namespace Server
+} // namespace OpcUa
@@ -0,0 +1,116 @@
+/// @brief Counters of server activity exposed in the diagnostics nodes of the address space.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#pragma once
+
+#include <opc/common/histogram.h>
+#include <opc/ua/protocol/message_identifiers.h>
+
+#include <chrono>
+#include <stdint.h>
+
+namespace OpcUa
+{
+  namespace Server
+  {
+
+    /// @brief Services counted separately. Names of counters of the standard
+    /// services are the names of fields of ServiceCounterDataType.
+    enum class ServiceType : uint8_t
+    {
+      Read,
+      HistoryRead,
+      Write,
+      Call,
+      CreateMonitoredItems,
+      DeleteMonitoredItems,
+      CreateSubscription,
+      SetPublishingMode,
+      Publish,
+      Republish,
+      DeleteSubscriptions,
+      AddNodes,
+      AddReferences,
+      Browse,
+      TranslateBrowsePathsToNodeIds,
+      RegisterNodes,
+      UnregisterNodes,
+      GetEndpoints,
+      FindServers,
+      CreateSession,
+      ActivateSession,
+      CloseSession,
+      Unsupported,
+      Count
+    };
+
+    ServiceType GetServiceType(MessageId message);
+    /// @brief Name of the counter of service, e.g. "ReadCount".
+    const char* GetCounterName(ServiceType service);
+
+    /// @brief Process wide counters of all servers.
+    /// Every thread updates its own set of counters without locks, they are summed when read.
+    class Diagnostics
+    {
+    public:
+      typedef std::chrono::steady_clock Clock;
+
+      /// @brief Totals which only grow.
+      enum Counter
+      {
+        BytesReceived,
+        BytesSent,
+        RejectedRequests,
+        CumulatedSessions,
+        AbortedSessions,
+        CumulatedSubscriptions,
+        DataChangeNotifications,
+        EventNotifications,
+        // Notifications which were queued but never sent to a client.
+        DroppedNotifications,
+        CounterCount
+      };
+
+      /// @brief Current values, increased and decreased maybe from different threads.
+      enum Gauge
+      {
+        CurrentSessions,
+        CurrentSubscriptions,
+        MonitoredItems,
+        QueuedPublishRequests,
+        // Notifications waiting in subscriptions for the next publish.
+        NotificationBacklog,
+        GaugeCount
+      };
+
+      /// @brief Durations of request processing, recorded in nanoseconds.
+      enum Timing
+      {
+        DecodeTime,
+        HandlerTime,
+        EncodeTime,
+        TimingCount
+      };
+
+    public:
+      static void Add(Counter counter, uint64_t value = 1);
+      static void Change(Gauge gauge, int64_t delta);
+      static void CountService(ServiceType service);
+      static void Record(Timing timing, Clock::duration duration);
+
+      static uint64_t Get(Counter counter);
+      static int64_t Get(Gauge gauge);
+      static uint64_t GetServiceCount(ServiceType service);
+      /// @brief Count of all requests.
+      static uint64_t GetRequestCount();
+      /// @brief Add durations of all threads to the histogram.
+      static void Get(Timing timing, Common::Histogram& result);
+    };
+
+  } // namespace Server
+} // namespace OpcUa
@@ -18,6 +18,7 @@
  ******************************************************************************/
 
 #include "server_object.h"
+#include "server_clock.h"
 
 #include <boost/chrono.hpp>
 #include <opc/ua/node.h>
@@ -62,8 +63,10 @@ namespace OpcUa
       , ServerTime(Instance.GetVariable(GetCurrentTimeRelativepath()))
       , Timer(io)
     {
+      CreateDiagnostics();
       Timer.Start(boost::posix_time::seconds(1), [this](){
         UpdateTime();
+        UpdateDiagnostics();
       });
       //Set many values in address space which are expected by clients
       std::vector<std::string> uris;
@@ -84,7 +87,7 @@ namespace OpcUa
       node = Node(Server, ObjectId::Server_ServerStatus_State);
       node.SetValue((int32_t) 0);
       node = Node(Server, ObjectId::Server_ServerStatus_CurrentTime);
-      node.SetValue(DateTime::Current());//Set time before the thread does it
+      node.SetValue(ServerClock::Now());//Set time before the thread does it
 
     }
 
@@ -106,7 +109,7 @@ namespace OpcUa
     {
       try
       {
-        DateTime t = OpcUa::DateTime::Current();
+        DateTime t = ServerClock::Now();
         DataValue timeData(t);
         timeData.SetSourceTimestamp(t);
         timeData.SetServerTimestamp(t);
@@ -121,5 +124,105 @@ namespace OpcUa
 
     }
 
+    void ServerObject::CreateDiagnostics()
+    {
+      Node(Server, ObjectId::Server_ServerDiagnostics_EnabledFlag).SetValue(true);
+
+      typedef Diagnostics D;
+      const struct
+      {
+        ObjectId Id;
+        std::function<Variant()> Value;
+      } summary[] =
+      {
+        {ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSessionCount, [](){ return Variant(static_cast<uint32_t>(D::Get(D::CurrentSessions))); }},
+        {ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSessionCount, [](){ return Variant(static_cast<uint32_t>(D::Get(D::CumulatedSessions))); }},
+        {ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_SessionAbortCount, [](){ return Variant(static_cast<uint32_t>(D::Get(D::AbortedSessions))); }},
+        {ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSubscriptionCount, [](){ return Variant(static_cast<uint32_t>(D::Get(D::CurrentSubscriptions))); }},
+        {ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSubscriptionCount, [](){ return Variant(static_cast<uint32_t>(D::Get(D::CumulatedSubscriptions))); }},
+        {ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_RejectedRequestsCount, [](){ return Variant(static_cast<uint32_t>(D::Get(D::RejectedRequests))); }},
+      };
+      for (const auto& item : summary)
+      {
+        DiagnosticsVariable variable = {Node(Server, item.Id), item.Value, Variant()};
+        DiagnosticsVariables.push_back(variable);
+      }
+
+      // Structured SessionDiagnostics and SubscriptionDiagnostics values need ExtensionObject
+      // variants which are not supported, so their fields are exposed as separate variables.
+      const Node sessions(Server, ObjectId::Server_ServerDiagnostics_SessionsDiagnosticsSummary);
+      AddDiagnosticsVariable(sessions, "TotalRequestCount", [](){ return Variant(D::GetRequestCount()); });
+      for (std::size_t i = 0; i < static_cast<std::size_t>(ServiceType::Count); ++i)
+      {
+        const ServiceType service = static_cast<ServiceType>(i);
+        AddDiagnosticsVariable(sessions, GetCounterName(service), [service](){ return Variant(D::GetServiceCount(service)); });
+      }
+      AddDiagnosticsVariable(sessions, "CurrentPublishRequestsInQueue", [](){ return Variant(D::Get(D::QueuedPublishRequests)); });
+
+      const Node diagnostics(Server, ObjectId::Server_ServerDiagnostics);
+      const Node subscriptions = diagnostics.AddObject(NodeId("Diagnostics.Subscriptions", 1), QualifiedName("SubscriptionDiagnostics", 1));
+      AddDiagnosticsVariable(subscriptions, "MonitoredItemCount", [](){ return Variant(D::Get(D::MonitoredItems)); });
+      AddDiagnosticsVariable(subscriptions, "DataChangeNotificationsCount", [](){ return Variant(D::Get(D::DataChangeNotifications)); });
+      AddDiagnosticsVariable(subscriptions, "EventNotificationsCount", [](){ return Variant(D::Get(D::EventNotifications)); });
+      AddDiagnosticsVariable(subscriptions, "DiscardedMessageCount", [](){ return Variant(D::Get(D::DroppedNotifications)); });
+      AddDiagnosticsVariable(subscriptions, "NotificationBacklog", [](){ return Variant(D::Get(D::NotificationBacklog)); });
+
+      AddDiagnosticsVariable(diagnostics, "BytesReceived", [](){ return Variant(D::Get(D::BytesReceived)); });
+      AddDiagnosticsVariable(diagnostics, "BytesSent", [](){ return Variant(D::Get(D::BytesSent)); });
+      AddTimingVariables(diagnostics, D::DecodeTime, "DecodeTime");
+      AddTimingVariables(diagnostics, D::HandlerTime, "HandlerTime");
+      AddTimingVariables(diagnostics, D::EncodeTime, "EncodeTime");
+
+      UpdateDiagnostics();
+    }
+
+    void ServerObject::AddDiagnosticsVariable(const Node& parent, const std::string& name, std::function<Variant()> value)
+    {
+      const std::string id = parent.GetId().IsString() ? parent.GetId().GetStringIdentifier() + "." + name : "Diagnostics." + name;
+      DiagnosticsVariable variable = {parent.AddVariable(NodeId(id, 1), QualifiedName(name, 1), value()), value, Variant()};
+      DiagnosticsVariables.push_back(variable);
+    }
+
+    // Durations are shown in microseconds.
+    void ServerObject::AddTimingVariables(const Node& parent, Diagnostics::Timing timing, const std::string& name)
+    {
+      const Common::Histogram& histogram = Timings[timing];
+      const Node object = parent.AddObject(NodeId("Diagnostics." + name, 1), QualifiedName(name, 1));
+      AddDiagnosticsVariable(object, "Count", [&histogram](){ return Variant(histogram.Count()); });
+      AddDiagnosticsVariable(object, "Mean", [&histogram](){ return Variant(histogram.Mean() / 1000); });
+      AddDiagnosticsVariable(object, "P50", [&histogram](){ return Variant(histogram.Percentile(0.5) / 1000.0); });
+      AddDiagnosticsVariable(object, "P99", [&histogram](){ return Variant(histogram.Percentile(0.99) / 1000.0); });
+      AddDiagnosticsVariable(object, "P999", [&histogram](){ return Variant(histogram.Percentile(0.999) / 1000.0); });
+      AddDiagnosticsVariable(object, "Max", [&histogram](){ return Variant(histogram.Max() / 1000.0); });
+    }
+
+    void ServerObject::UpdateDiagnostics()
+    {
+      try
+      {
+        for (std::size_t i = 0; i < Diagnostics::TimingCount; ++i)
+        {
+          Timings[i].Reset();
+          Diagnostics::Get(static_cast<Diagnostics::Timing>(i), Timings[i]);
+        }
+
+        // Unchanged values are not written to not wake up subscriptions.
+        for (DiagnosticsVariable& variable : DiagnosticsVariables)
+        {
+          Variant value = variable.Value();
+          if (value == variable.LastValue)
+          {
+            continue;
+          }
+          variable.Variable.SetValue(value);
+          variable.LastValue = std::move(value);
+        }
+      }
+      catch (std::exception& ex)
+      {
+        std::cerr << "Failed to update diagnostics at server object: " << ex.what() << std::endl;
+      }
+    }
+
   } // namespace UaServer
 } // namespace OpcUa
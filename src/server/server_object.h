@@ -21,9 +21,14 @@
 
 #include <opc/ua/services/services.h>
 #include <opc/ua/model.h>
+#include <opc/ua/node.h>
 
+#include "server_diagnostics.h"
 #include "timer.h"
 
+#include <functional>
+#include <vector>
+
 namespace boost
 {
   namespace asio
@@ -49,6 +54,18 @@ namespace OpcUa
     private:
       Model::Object CreateServerObject(const Services::SharedPtr& services) const;
       void UpdateTime();
+      void CreateDiagnostics();
+      void AddDiagnosticsVariable(const Node& parent, const std::string& name, std::function<Variant()> value);
+      void AddTimingVariables(const Node& parent, Diagnostics::Timing timing, const std::string& name);
+      void UpdateDiagnostics();
+
+    private:
+      struct DiagnosticsVariable
+      {
+        Node Variable;
+        std::function<Variant()> Value;
+        Variant LastValue;
+      };
 
     private:
       Services::SharedPtr Server;
@@ -56,6 +73,9 @@ namespace OpcUa
       bool Debug = false;
       Model::Object Instance;
       Model::Variable ServerTime;
+      std::vector<DiagnosticsVariable> DiagnosticsVariables;
+      // Durations of all threads, collected once per update.
+      Common::Histogram Timings[Diagnostics::TimingCount];
       PeriodicTimer Timer;
     };
 
@@ -131,6 +131,13 @@ namespace
       return std::vector<OpcUa::StatusCode>(filter.size(), StatusCode::BadNotImplemented);
     }
 
+    virtual std::vector<OpcUa::HistoryReadResult> HistoryRead(const OpcUa::HistoryReadParameters& params) const
+    {
+      HistoryReadResult result;
+      result.Status = StatusCode::BadNotImplemented;
+      return std::vector<OpcUa::HistoryReadResult>(params.NodesToRead.size(), result);
+    }
+
     virtual SubscriptionData CreateSubscription(const CreateSubscriptionRequest& request, std::function<void (PublishResult)> callback=0)
     {
       return SubscriptionData();
@@ -162,6 +169,64 @@ namespace
       return response;
     }
 
+    virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsParameters& params, std::function<void (PublishResult)> callback)
+    {
+      TransferResult result;
+      result.Status = StatusCode::BadNotImplemented;
+      return std::vector<TransferResult>(params.SubscriptionIds.size(), result);
+    }
+
+  };
+
+  // Asynchronous services of the internal server: requests are processed in the calling thread
+  // and callback is called before return.
+  class SynchronousAsyncServices : public AsyncServices
+  {
+  public:
+    explicit SynchronousAsyncServices(OpcUa::Services& services)
+      : Services(services)
+    {
+    }
+
+    virtual void Read(const ReadParameters& params, ReadCallback callback) override
+    {
+      Complete<std::vector<DataValue>>(callback, [this, &params]() { return Services.Attributes()->Read(params); });
+    }
+
+    virtual void Write(const std::vector<WriteValue>& values, WriteCallback callback) override
+    {
+      Complete<std::vector<StatusCode>>(callback, [this, &values]() { return Services.Attributes()->Write(values); });
+    }
+
+    virtual void Browse(const NodesQuery& query, BrowseCallback callback) override
+    {
+      Complete<std::vector<BrowseResult>>(callback, [this, &query]() { return Services.Views()->Browse(query); });
+    }
+
+    virtual void Call(const std::vector<CallMethodRequest>& methodsToCall, CallCallback callback) override
+    {
+      Complete<std::vector<CallMethodResult>>(callback, [this, &methodsToCall]() { return Services.Method()->Call(methodsToCall); });
+    }
+
+  private:
+    template <typename Results, typename Callback>
+    static void Complete(const Callback& callback, std::function<Results()> process)
+    {
+      Results results;
+      StatusCode status = StatusCode::Good;
+      try
+      {
+        results = process();
+      }
+      catch (const std::exception&)
+      {
+        status = StatusCode::BadInternalError;
+      }
+      callback(status, std::move(results));
+    }
+
+  private:
+    OpcUa::Services& Services;
   };
 
   class ServicesRegistry::InternalServer : public Services
@@ -169,6 +234,7 @@ namespace
   public:
     InternalServer()
       : Services(new DefaultServices())
+      , Asynchronous(new SynchronousAsyncServices(*this))
     {
       SetEndpoints(Services);
       SetViews(Services);
@@ -241,6 +307,11 @@ namespace
       return SubscriptionsServices;
     }
 
+    virtual AsyncServices::SharedPtr Async() override
+    {
+      return Asynchronous;
+    }
+
   public:
     void SetEndpoints(std::shared_ptr<EndpointServices> endpoints)
     {
@@ -280,6 +351,7 @@ namespace
     OpcUa::EndpointServices::SharedPtr EndpointsServices;
     OpcUa::SubscriptionServices::SharedPtr SubscriptionsServices;
     std::shared_ptr<DefaultServices> Services;
+    OpcUa::AsyncServices::SharedPtr Asynchronous;
   };
 
 
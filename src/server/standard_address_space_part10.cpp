@@ -21,10 +21,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2391");
+        node.RequestedNewNodeId = NumericNodeId(2391);
         node.BrowseName = ToQualifiedName("ProgramStateMachineType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2771");
+        node.ParentNodeId = NumericNodeId(2771);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.Description = LocalizedText("A state machine for a program.");
@@ -37,261 +37,261 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3830");
+        ref.TargetNodeId = NumericNodeId(3830);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3835");
+        ref.TargetNodeId = NumericNodeId(3835);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2392");
+        ref.TargetNodeId = NumericNodeId(2392);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2393");
+        ref.TargetNodeId = NumericNodeId(2393);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2394");
+        ref.TargetNodeId = NumericNodeId(2394);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2395");
+        ref.TargetNodeId = NumericNodeId(2395);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2396");
+        ref.TargetNodeId = NumericNodeId(2396);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2397");
+        ref.TargetNodeId = NumericNodeId(2397);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2398");
+        ref.TargetNodeId = NumericNodeId(2398);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2399");
+        ref.TargetNodeId = NumericNodeId(2399);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3850");
+        ref.TargetNodeId = NumericNodeId(3850);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2400");
+        ref.TargetNodeId = NumericNodeId(2400);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2402");
+        ref.TargetNodeId = NumericNodeId(2402);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2404");
+        ref.TargetNodeId = NumericNodeId(2404);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2406");
+        ref.TargetNodeId = NumericNodeId(2406);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2408");
+        ref.TargetNodeId = NumericNodeId(2408);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2410");
+        ref.TargetNodeId = NumericNodeId(2410);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2412");
+        ref.TargetNodeId = NumericNodeId(2412);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2414");
+        ref.TargetNodeId = NumericNodeId(2414);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2416");
+        ref.TargetNodeId = NumericNodeId(2416);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2418");
+        ref.TargetNodeId = NumericNodeId(2418);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2420");
+        ref.TargetNodeId = NumericNodeId(2420);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2422");
+        ref.TargetNodeId = NumericNodeId(2422);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2424");
+        ref.TargetNodeId = NumericNodeId(2424);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2426");
+        ref.TargetNodeId = NumericNodeId(2426);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2427");
+        ref.TargetNodeId = NumericNodeId(2427);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2428");
+        ref.TargetNodeId = NumericNodeId(2428);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2429");
+        ref.TargetNodeId = NumericNodeId(2429);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2391");
+        ref.SourceNodeId = NumericNodeId(2391);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2430");
+        ref.TargetNodeId = NumericNodeId(2430);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -299,12 +299,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3830");
+        node.RequestedNewNodeId = NumericNodeId(3830);
         node.BrowseName = ToQualifiedName("CurrentState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2760");
+        node.TypeDefinition = NumericNodeId(2760);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CurrentState");
         attrs.Type = ObjectId::LocalizedText;
@@ -316,27 +316,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3830");
+        ref.SourceNodeId = NumericNodeId(3830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3831");
+        ref.TargetNodeId = NumericNodeId(3831);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3830");
+        ref.SourceNodeId = NumericNodeId(3830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3833");
+        ref.TargetNodeId = NumericNodeId(3833);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3830");
+        ref.SourceNodeId = NumericNodeId(3830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -344,12 +344,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3831");
+        node.RequestedNewNodeId = NumericNodeId(3831);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3830");
+        node.ParentNodeId = NumericNodeId(3830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::NodeId;
@@ -361,9 +361,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3831");
+        ref.SourceNodeId = NumericNodeId(3831);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -371,12 +371,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3833");
+        node.RequestedNewNodeId = NumericNodeId(3833);
         node.BrowseName = ToQualifiedName("Number");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3830");
+        node.ParentNodeId = NumericNodeId(3830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Number");
         attrs.Type = ObjectId::UInt32;
@@ -388,9 +388,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3833");
+        ref.SourceNodeId = NumericNodeId(3833);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -398,12 +398,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3835");
+        node.RequestedNewNodeId = NumericNodeId(3835);
         node.BrowseName = ToQualifiedName("LastTransition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2767");
+        node.TypeDefinition = NumericNodeId(2767);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastTransition");
         attrs.Type = ObjectId::LocalizedText;
@@ -415,36 +415,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3835");
+        ref.SourceNodeId = NumericNodeId(3835);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3836");
+        ref.TargetNodeId = NumericNodeId(3836);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3835");
+        ref.SourceNodeId = NumericNodeId(3835);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3838");
+        ref.TargetNodeId = NumericNodeId(3838);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3835");
+        ref.SourceNodeId = NumericNodeId(3835);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3839");
+        ref.TargetNodeId = NumericNodeId(3839);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3835");
+        ref.SourceNodeId = NumericNodeId(3835);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -452,12 +452,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3836");
+        node.RequestedNewNodeId = NumericNodeId(3836);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3835");
+        node.ParentNodeId = NumericNodeId(3835);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::NodeId;
@@ -469,9 +469,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3836");
+        ref.SourceNodeId = NumericNodeId(3836);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -479,12 +479,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3838");
+        node.RequestedNewNodeId = NumericNodeId(3838);
         node.BrowseName = ToQualifiedName("Number");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3835");
+        node.ParentNodeId = NumericNodeId(3835);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Number");
         attrs.Type = ObjectId::UInt32;
@@ -496,9 +496,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3838");
+        ref.SourceNodeId = NumericNodeId(3838);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -506,15 +506,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3839");
+        node.RequestedNewNodeId = NumericNodeId(3839);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3835");
+        node.ParentNodeId = NumericNodeId(3835);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -523,9 +523,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3839");
+        ref.SourceNodeId = NumericNodeId(3839);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -533,12 +533,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2392");
+        node.RequestedNewNodeId = NumericNodeId(2392);
         node.BrowseName = ToQualifiedName("Creatable");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Creatable");
         attrs.Type = ObjectId::Boolean;
@@ -549,12 +549,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2393");
+        node.RequestedNewNodeId = NumericNodeId(2393);
         node.BrowseName = ToQualifiedName("Deletable");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Deletable");
         attrs.Type = ObjectId::Boolean;
@@ -566,9 +566,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2393");
+        ref.SourceNodeId = NumericNodeId(2393);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -576,12 +576,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2394");
+        node.RequestedNewNodeId = NumericNodeId(2394);
         node.BrowseName = ToQualifiedName("AutoDelete");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AutoDelete");
         attrs.Type = ObjectId::Boolean;
@@ -593,9 +593,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2394");
+        ref.SourceNodeId = NumericNodeId(2394);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=79");
+        ref.TargetNodeId = NumericNodeId(79);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -603,12 +603,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2395");
+        node.RequestedNewNodeId = NumericNodeId(2395);
         node.BrowseName = ToQualifiedName("RecycleCount");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("RecycleCount");
         attrs.Type = ObjectId::Int32;
@@ -620,9 +620,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2395");
+        ref.SourceNodeId = NumericNodeId(2395);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -630,12 +630,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2396");
+        node.RequestedNewNodeId = NumericNodeId(2396);
         node.BrowseName = ToQualifiedName("InstanceCount");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InstanceCount");
         attrs.Type = ObjectId::UInt32;
@@ -646,12 +646,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2397");
+        node.RequestedNewNodeId = NumericNodeId(2397);
         node.BrowseName = ToQualifiedName("MaxInstanceCount");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxInstanceCount");
         attrs.Type = ObjectId::UInt32;
@@ -662,12 +662,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2398");
+        node.RequestedNewNodeId = NumericNodeId(2398);
         node.BrowseName = ToQualifiedName("MaxRecycleCount");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxRecycleCount");
         attrs.Type = ObjectId::UInt32;
@@ -678,15 +678,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2399");
+        node.RequestedNewNodeId = NumericNodeId(2399);
         node.BrowseName = ToQualifiedName("ProgramDiagnostics");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2380");
+        node.TypeDefinition = NumericNodeId(2380);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ProgramDiagnostics");
-        attrs.Type = ToNodeId("i=894");
+        attrs.Type = NumericNodeId(894);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -695,99 +695,99 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3840");
+        ref.TargetNodeId = NumericNodeId(3840);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3841");
+        ref.TargetNodeId = NumericNodeId(3841);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3842");
+        ref.TargetNodeId = NumericNodeId(3842);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3843");
+        ref.TargetNodeId = NumericNodeId(3843);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3844");
+        ref.TargetNodeId = NumericNodeId(3844);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3845");
+        ref.TargetNodeId = NumericNodeId(3845);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3846");
+        ref.TargetNodeId = NumericNodeId(3846);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3847");
+        ref.TargetNodeId = NumericNodeId(3847);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3848");
+        ref.TargetNodeId = NumericNodeId(3848);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3849");
+        ref.TargetNodeId = NumericNodeId(3849);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2399");
+        ref.SourceNodeId = NumericNodeId(2399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -795,12 +795,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3840");
+        node.RequestedNewNodeId = NumericNodeId(3840);
         node.BrowseName = ToQualifiedName("CreateSessionId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CreateSessionId");
         attrs.Type = ObjectId::NodeId;
@@ -812,9 +812,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3840");
+        ref.SourceNodeId = NumericNodeId(3840);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -822,12 +822,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3841");
+        node.RequestedNewNodeId = NumericNodeId(3841);
         node.BrowseName = ToQualifiedName("CreateClientName");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CreateClientName");
         attrs.Type = ObjectId::String;
@@ -839,9 +839,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3841");
+        ref.SourceNodeId = NumericNodeId(3841);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -849,15 +849,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3842");
+        node.RequestedNewNodeId = NumericNodeId(3842);
         node.BrowseName = ToQualifiedName("InvocationCreationTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InvocationCreationTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -866,9 +866,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3842");
+        ref.SourceNodeId = NumericNodeId(3842);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -876,15 +876,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3843");
+        node.RequestedNewNodeId = NumericNodeId(3843);
         node.BrowseName = ToQualifiedName("LastTransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastTransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -893,9 +893,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3843");
+        ref.SourceNodeId = NumericNodeId(3843);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -903,12 +903,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3844");
+        node.RequestedNewNodeId = NumericNodeId(3844);
         node.BrowseName = ToQualifiedName("LastMethodCall");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodCall");
         attrs.Type = ObjectId::String;
@@ -920,9 +920,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3844");
+        ref.SourceNodeId = NumericNodeId(3844);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -930,12 +930,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3845");
+        node.RequestedNewNodeId = NumericNodeId(3845);
         node.BrowseName = ToQualifiedName("LastMethodSessionId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodSessionId");
         attrs.Type = ObjectId::NodeId;
@@ -947,9 +947,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3845");
+        ref.SourceNodeId = NumericNodeId(3845);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -957,15 +957,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3846");
+        node.RequestedNewNodeId = NumericNodeId(3846);
         node.BrowseName = ToQualifiedName("LastMethodInputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodInputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -974,9 +974,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3846");
+        ref.SourceNodeId = NumericNodeId(3846);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -984,15 +984,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3847");
+        node.RequestedNewNodeId = NumericNodeId(3847);
         node.BrowseName = ToQualifiedName("LastMethodOutputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodOutputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1001,9 +1001,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3847");
+        ref.SourceNodeId = NumericNodeId(3847);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1011,15 +1011,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3848");
+        node.RequestedNewNodeId = NumericNodeId(3848);
         node.BrowseName = ToQualifiedName("LastMethodCallTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodCallTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1028,9 +1028,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3848");
+        ref.SourceNodeId = NumericNodeId(3848);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1038,15 +1038,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3849");
+        node.RequestedNewNodeId = NumericNodeId(3849);
         node.BrowseName = ToQualifiedName("LastMethodReturnStatus");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2399");
+        node.ParentNodeId = NumericNodeId(2399);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodReturnStatus");
-        attrs.Type = ToNodeId("i=299");
+        attrs.Type = NumericNodeId(299);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1055,9 +1055,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3849");
+        ref.SourceNodeId = NumericNodeId(3849);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1065,12 +1065,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3850");
+        node.RequestedNewNodeId = NumericNodeId(3850);
         node.BrowseName = ToQualifiedName("FinalResultData");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=58");
+        node.TypeDefinition = NumericNodeId(58);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("FinalResultData");
         attrs.EventNotifier = 0;
@@ -1081,9 +1081,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3850");
+        ref.SourceNodeId = NumericNodeId(3850);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1091,12 +1091,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2400");
+        node.RequestedNewNodeId = NumericNodeId(2400);
         node.BrowseName = ToQualifiedName("Ready");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("The Program is properly initialized and may be started.");
         attrs.DisplayName = LocalizedText("Ready");
@@ -1108,9 +1108,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2400");
+        ref.SourceNodeId = NumericNodeId(2400);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2401");
+        ref.TargetNodeId = NumericNodeId(2401);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1118,12 +1118,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2401");
+        node.RequestedNewNodeId = NumericNodeId(2401);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2400");
+        node.ParentNodeId = NumericNodeId(2400);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1136,9 +1136,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2401");
+        ref.SourceNodeId = NumericNodeId(2401);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1146,12 +1146,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2402");
+        node.RequestedNewNodeId = NumericNodeId(2402);
         node.BrowseName = ToQualifiedName("Running");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("The Program is executing making progress towards completion.");
         attrs.DisplayName = LocalizedText("Running");
@@ -1163,9 +1163,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2402");
+        ref.SourceNodeId = NumericNodeId(2402);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2403");
+        ref.TargetNodeId = NumericNodeId(2403);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1173,12 +1173,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2403");
+        node.RequestedNewNodeId = NumericNodeId(2403);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2402");
+        node.ParentNodeId = NumericNodeId(2402);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1191,9 +1191,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2403");
+        ref.SourceNodeId = NumericNodeId(2403);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1201,12 +1201,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2404");
+        node.RequestedNewNodeId = NumericNodeId(2404);
         node.BrowseName = ToQualifiedName("Suspended");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("The Program has been stopped prior to reaching a terminal state but may be resumed.");
         attrs.DisplayName = LocalizedText("Suspended");
@@ -1218,9 +1218,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2404");
+        ref.SourceNodeId = NumericNodeId(2404);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2405");
+        ref.TargetNodeId = NumericNodeId(2405);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1228,12 +1228,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2405");
+        node.RequestedNewNodeId = NumericNodeId(2405);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2404");
+        node.ParentNodeId = NumericNodeId(2404);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1246,9 +1246,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2405");
+        ref.SourceNodeId = NumericNodeId(2405);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1256,12 +1256,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2406");
+        node.RequestedNewNodeId = NumericNodeId(2406);
         node.BrowseName = ToQualifiedName("Halted");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("The Program is in a terminal or failed state, and it cannot be started or resumed without being reset.");
         attrs.DisplayName = LocalizedText("Halted");
@@ -1273,9 +1273,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2406");
+        ref.SourceNodeId = NumericNodeId(2406);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2407");
+        ref.TargetNodeId = NumericNodeId(2407);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1283,12 +1283,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2407");
+        node.RequestedNewNodeId = NumericNodeId(2407);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2406");
+        node.ParentNodeId = NumericNodeId(2406);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1301,9 +1301,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2407");
+        ref.SourceNodeId = NumericNodeId(2407);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1311,12 +1311,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2408");
+        node.RequestedNewNodeId = NumericNodeId(2408);
         node.BrowseName = ToQualifiedName("HaltedToReady");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("HaltedToReady");
         attrs.EventNotifier = 0;
@@ -1327,45 +1327,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2408");
+        ref.SourceNodeId = NumericNodeId(2408);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2409");
+        ref.TargetNodeId = NumericNodeId(2409);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2408");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2408);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2406");
+        ref.TargetNodeId = NumericNodeId(2406);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2408");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2408);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2400");
+        ref.TargetNodeId = NumericNodeId(2400);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2408");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2408);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2430");
+        ref.TargetNodeId = NumericNodeId(2430);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2408");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2408);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1373,12 +1373,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2409");
+        node.RequestedNewNodeId = NumericNodeId(2409);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2408");
+        node.ParentNodeId = NumericNodeId(2408);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1391,9 +1391,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2409");
+        ref.SourceNodeId = NumericNodeId(2409);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1401,12 +1401,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2410");
+        node.RequestedNewNodeId = NumericNodeId(2410);
         node.BrowseName = ToQualifiedName("ReadyToRunning");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("ReadyToRunning");
         attrs.EventNotifier = 0;
@@ -1417,45 +1417,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2410");
+        ref.SourceNodeId = NumericNodeId(2410);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2411");
+        ref.TargetNodeId = NumericNodeId(2411);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2410");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2410);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2400");
+        ref.TargetNodeId = NumericNodeId(2400);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2410");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2410);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2402");
+        ref.TargetNodeId = NumericNodeId(2402);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2410");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2410);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2426");
+        ref.TargetNodeId = NumericNodeId(2426);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2410");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2410);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1463,12 +1463,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2411");
+        node.RequestedNewNodeId = NumericNodeId(2411);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2410");
+        node.ParentNodeId = NumericNodeId(2410);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1481,9 +1481,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2411");
+        ref.SourceNodeId = NumericNodeId(2411);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1491,12 +1491,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2412");
+        node.RequestedNewNodeId = NumericNodeId(2412);
         node.BrowseName = ToQualifiedName("RunningToHalted");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("RunningToHalted");
         attrs.EventNotifier = 0;
@@ -1507,45 +1507,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2412");
+        ref.SourceNodeId = NumericNodeId(2412);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2413");
+        ref.TargetNodeId = NumericNodeId(2413);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2412");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2412);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2402");
+        ref.TargetNodeId = NumericNodeId(2402);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2412");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2412);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2406");
+        ref.TargetNodeId = NumericNodeId(2406);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2412");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2412);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2429");
+        ref.TargetNodeId = NumericNodeId(2429);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2412");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2412);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1553,12 +1553,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2413");
+        node.RequestedNewNodeId = NumericNodeId(2413);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2412");
+        node.ParentNodeId = NumericNodeId(2412);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1571,9 +1571,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2413");
+        ref.SourceNodeId = NumericNodeId(2413);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1581,12 +1581,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2414");
+        node.RequestedNewNodeId = NumericNodeId(2414);
         node.BrowseName = ToQualifiedName("RunningToReady");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("RunningToReady");
         attrs.EventNotifier = 0;
@@ -1597,36 +1597,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2414");
+        ref.SourceNodeId = NumericNodeId(2414);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2415");
+        ref.TargetNodeId = NumericNodeId(2415);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2414");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2414);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2402");
+        ref.TargetNodeId = NumericNodeId(2402);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2414");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2414);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2400");
+        ref.TargetNodeId = NumericNodeId(2400);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2414");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2414);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1634,12 +1634,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2415");
+        node.RequestedNewNodeId = NumericNodeId(2415);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2414");
+        node.ParentNodeId = NumericNodeId(2414);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1652,9 +1652,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2415");
+        ref.SourceNodeId = NumericNodeId(2415);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1662,12 +1662,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2416");
+        node.RequestedNewNodeId = NumericNodeId(2416);
         node.BrowseName = ToQualifiedName("RunningToSuspended");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("RunningToSuspended");
         attrs.EventNotifier = 0;
@@ -1678,45 +1678,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2416");
+        ref.SourceNodeId = NumericNodeId(2416);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2417");
+        ref.TargetNodeId = NumericNodeId(2417);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2416");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2416);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2402");
+        ref.TargetNodeId = NumericNodeId(2402);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2416");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2416);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2404");
+        ref.TargetNodeId = NumericNodeId(2404);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2416");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2416);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2427");
+        ref.TargetNodeId = NumericNodeId(2427);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2416");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2416);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1724,12 +1724,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2417");
+        node.RequestedNewNodeId = NumericNodeId(2417);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2416");
+        node.ParentNodeId = NumericNodeId(2416);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1742,9 +1742,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2417");
+        ref.SourceNodeId = NumericNodeId(2417);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1752,12 +1752,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2418");
+        node.RequestedNewNodeId = NumericNodeId(2418);
         node.BrowseName = ToQualifiedName("SuspendedToRunning");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("SuspendedToRunning");
         attrs.EventNotifier = 0;
@@ -1768,45 +1768,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2418");
+        ref.SourceNodeId = NumericNodeId(2418);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2419");
+        ref.TargetNodeId = NumericNodeId(2419);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2418");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2418);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2404");
+        ref.TargetNodeId = NumericNodeId(2404);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2418");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2418);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2402");
+        ref.TargetNodeId = NumericNodeId(2402);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2418");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2418);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2428");
+        ref.TargetNodeId = NumericNodeId(2428);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2418");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2418);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1814,12 +1814,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2419");
+        node.RequestedNewNodeId = NumericNodeId(2419);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2418");
+        node.ParentNodeId = NumericNodeId(2418);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1832,9 +1832,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2419");
+        ref.SourceNodeId = NumericNodeId(2419);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1842,12 +1842,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2420");
+        node.RequestedNewNodeId = NumericNodeId(2420);
         node.BrowseName = ToQualifiedName("SuspendedToHalted");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("SuspendedToHalted");
         attrs.EventNotifier = 0;
@@ -1858,45 +1858,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2420");
+        ref.SourceNodeId = NumericNodeId(2420);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2421");
+        ref.TargetNodeId = NumericNodeId(2421);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2420");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2420);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2404");
+        ref.TargetNodeId = NumericNodeId(2404);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2420");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2420);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2406");
+        ref.TargetNodeId = NumericNodeId(2406);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2420");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2420);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2429");
+        ref.TargetNodeId = NumericNodeId(2429);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2420");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2420);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1904,12 +1904,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2421");
+        node.RequestedNewNodeId = NumericNodeId(2421);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2420");
+        node.ParentNodeId = NumericNodeId(2420);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -1922,9 +1922,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2421");
+        ref.SourceNodeId = NumericNodeId(2421);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1932,12 +1932,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2422");
+        node.RequestedNewNodeId = NumericNodeId(2422);
         node.BrowseName = ToQualifiedName("SuspendedToReady");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("SuspendedToReady");
         attrs.EventNotifier = 0;
@@ -1948,36 +1948,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2422");
+        ref.SourceNodeId = NumericNodeId(2422);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2423");
+        ref.TargetNodeId = NumericNodeId(2423);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2422");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2422);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2404");
+        ref.TargetNodeId = NumericNodeId(2404);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2422");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2422);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2400");
+        ref.TargetNodeId = NumericNodeId(2400);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2422");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2422);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1985,12 +1985,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2423");
+        node.RequestedNewNodeId = NumericNodeId(2423);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2422");
+        node.ParentNodeId = NumericNodeId(2422);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -2003,9 +2003,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2423");
+        ref.SourceNodeId = NumericNodeId(2423);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2013,12 +2013,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2424");
+        node.RequestedNewNodeId = NumericNodeId(2424);
         node.BrowseName = ToQualifiedName("ReadyToHalted");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2391");
+        node.ParentNodeId = NumericNodeId(2391);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("ReadyToHalted");
         attrs.EventNotifier = 0;
@@ -2029,45 +2029,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2424");
+        ref.SourceNodeId = NumericNodeId(2424);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2425");
+        ref.TargetNodeId = NumericNodeId(2425);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2424");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2424);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2400");
+        ref.TargetNodeId = NumericNodeId(2400);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2424");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2424);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2406");
+        ref.TargetNodeId = NumericNodeId(2406);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2424");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2424);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2429");
+        ref.TargetNodeId = NumericNodeId(2429);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2424");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2424);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2378");
+        ref.TargetNodeId = NumericNodeId(2378);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2075,12 +2075,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2425");
+        node.RequestedNewNodeId = NumericNodeId(2425);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2424");
+        node.ParentNodeId = NumericNodeId(2424);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -2093,9 +2093,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2425");
+        ref.SourceNodeId = NumericNodeId(2425);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2103,10 +2103,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2378");
+        node.RequestedNewNodeId = NumericNodeId(2378);
         node.BrowseName = ToQualifiedName("ProgramTransitionEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2311");
+        node.ParentNodeId = NumericNodeId(2311);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ProgramTransitionEventType");
@@ -2118,9 +2118,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2378");
+        ref.SourceNodeId = NumericNodeId(2378);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2379");
+        ref.TargetNodeId = NumericNodeId(2379);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2128,12 +2128,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2379");
+        node.RequestedNewNodeId = NumericNodeId(2379);
         node.BrowseName = ToQualifiedName("IntermediateResult");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2378");
+        node.ParentNodeId = NumericNodeId(2378);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("IntermediateResult");
         attrs.Type = ObjectId::String;
@@ -2145,9 +2145,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2379");
+        ref.SourceNodeId = NumericNodeId(2379);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2155,10 +2155,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11856");
+        node.RequestedNewNodeId = NumericNodeId(11856);
         node.BrowseName = ToQualifiedName("AuditProgramTransitionEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2315");
+        node.ParentNodeId = NumericNodeId(2315);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditProgramTransitionEventType");
@@ -2170,9 +2170,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11856");
+        ref.SourceNodeId = NumericNodeId(11856);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11875");
+        ref.TargetNodeId = NumericNodeId(11875);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2180,12 +2180,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11875");
+        node.RequestedNewNodeId = NumericNodeId(11875);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11856");
+        node.ParentNodeId = NumericNodeId(11856);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -2197,9 +2197,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11875");
+        ref.SourceNodeId = NumericNodeId(11875);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2207,10 +2207,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3806");
+        node.RequestedNewNodeId = NumericNodeId(3806);
         node.BrowseName = ToQualifiedName("ProgramTransitionAuditEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2315");
+        node.ParentNodeId = NumericNodeId(2315);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ProgramTransitionAuditEventType");
@@ -2222,9 +2222,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=3806");
+        ref.SourceNodeId = NumericNodeId(3806);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3825");
+        ref.TargetNodeId = NumericNodeId(3825);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2232,12 +2232,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3825");
+        node.RequestedNewNodeId = NumericNodeId(3825);
         node.BrowseName = ToQualifiedName("Transition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3806");
+        node.ParentNodeId = NumericNodeId(3806);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2767");
+        node.TypeDefinition = NumericNodeId(2767);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Transition");
         attrs.Type = ObjectId::LocalizedText;
@@ -2249,18 +2249,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3825");
+        ref.SourceNodeId = NumericNodeId(3825);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3826");
+        ref.TargetNodeId = NumericNodeId(3826);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3825");
+        ref.SourceNodeId = NumericNodeId(3825);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2268,12 +2268,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3826");
+        node.RequestedNewNodeId = NumericNodeId(3826);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3825");
+        node.ParentNodeId = NumericNodeId(3825);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::NodeId;
@@ -2285,9 +2285,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3826");
+        ref.SourceNodeId = NumericNodeId(3826);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2295,14 +2295,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2380");
+        node.RequestedNewNodeId = NumericNodeId(2380);
         node.BrowseName = ToQualifiedName("ProgramDiagnosticType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=63");
+        node.ParentNodeId = NumericNodeId(63);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ProgramDiagnosticType");
-        attrs.Type = ToNodeId("i=894");
+        attrs.Type = NumericNodeId(894);
         attrs.Rank = -1;
         attrs.IsAbstract = false;
         node.Attributes = attrs;
@@ -2312,90 +2312,90 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2381");
+        ref.TargetNodeId = NumericNodeId(2381);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2382");
+        ref.TargetNodeId = NumericNodeId(2382);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2383");
+        ref.TargetNodeId = NumericNodeId(2383);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2384");
+        ref.TargetNodeId = NumericNodeId(2384);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2385");
+        ref.TargetNodeId = NumericNodeId(2385);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2386");
+        ref.TargetNodeId = NumericNodeId(2386);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2387");
+        ref.TargetNodeId = NumericNodeId(2387);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2388");
+        ref.TargetNodeId = NumericNodeId(2388);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2389");
+        ref.TargetNodeId = NumericNodeId(2389);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2380");
+        ref.SourceNodeId = NumericNodeId(2380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2390");
+        ref.TargetNodeId = NumericNodeId(2390);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2403,12 +2403,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2381");
+        node.RequestedNewNodeId = NumericNodeId(2381);
         node.BrowseName = ToQualifiedName("CreateSessionId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CreateSessionId");
         attrs.Type = ObjectId::NodeId;
@@ -2420,9 +2420,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2381");
+        ref.SourceNodeId = NumericNodeId(2381);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2430,12 +2430,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2382");
+        node.RequestedNewNodeId = NumericNodeId(2382);
         node.BrowseName = ToQualifiedName("CreateClientName");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CreateClientName");
         attrs.Type = ObjectId::String;
@@ -2447,9 +2447,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2382");
+        ref.SourceNodeId = NumericNodeId(2382);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2457,15 +2457,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2383");
+        node.RequestedNewNodeId = NumericNodeId(2383);
         node.BrowseName = ToQualifiedName("InvocationCreationTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InvocationCreationTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2474,9 +2474,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2383");
+        ref.SourceNodeId = NumericNodeId(2383);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2484,15 +2484,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2384");
+        node.RequestedNewNodeId = NumericNodeId(2384);
         node.BrowseName = ToQualifiedName("LastTransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastTransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2501,9 +2501,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2384");
+        ref.SourceNodeId = NumericNodeId(2384);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2511,12 +2511,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2385");
+        node.RequestedNewNodeId = NumericNodeId(2385);
         node.BrowseName = ToQualifiedName("LastMethodCall");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodCall");
         attrs.Type = ObjectId::String;
@@ -2528,9 +2528,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2385");
+        ref.SourceNodeId = NumericNodeId(2385);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2538,12 +2538,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2386");
+        node.RequestedNewNodeId = NumericNodeId(2386);
         node.BrowseName = ToQualifiedName("LastMethodSessionId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodSessionId");
         attrs.Type = ObjectId::NodeId;
@@ -2555,9 +2555,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2386");
+        ref.SourceNodeId = NumericNodeId(2386);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2565,15 +2565,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2387");
+        node.RequestedNewNodeId = NumericNodeId(2387);
         node.BrowseName = ToQualifiedName("LastMethodInputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodInputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2582,9 +2582,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2387");
+        ref.SourceNodeId = NumericNodeId(2387);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2592,15 +2592,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2388");
+        node.RequestedNewNodeId = NumericNodeId(2388);
         node.BrowseName = ToQualifiedName("LastMethodOutputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodOutputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2609,9 +2609,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2388");
+        ref.SourceNodeId = NumericNodeId(2388);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2619,15 +2619,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2389");
+        node.RequestedNewNodeId = NumericNodeId(2389);
         node.BrowseName = ToQualifiedName("LastMethodCallTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodCallTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2636,9 +2636,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2389");
+        ref.SourceNodeId = NumericNodeId(2389);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2646,15 +2646,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2390");
+        node.RequestedNewNodeId = NumericNodeId(2390);
         node.BrowseName = ToQualifiedName("LastMethodReturnStatus");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2380");
+        node.ParentNodeId = NumericNodeId(2380);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastMethodReturnStatus");
-        attrs.Type = ToNodeId("i=299");
+        attrs.Type = NumericNodeId(299);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2663,9 +2663,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2390");
+        ref.SourceNodeId = NumericNodeId(2390);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2673,10 +2673,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=894");
+        node.RequestedNewNodeId = NumericNodeId(894);
         node.BrowseName = ToQualifiedName("ProgramDiagnosticDataType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ProgramDiagnosticDataType");
@@ -2687,12 +2687,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=895");
+        node.RequestedNewNodeId = NumericNodeId(895);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=894");
+        node.ParentNodeId = NumericNodeId(894);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -2703,9 +2703,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=895");
+        ref.SourceNodeId = NumericNodeId(895);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8882");
+        ref.TargetNodeId = NumericNodeId(8882);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2713,12 +2713,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=896");
+        node.RequestedNewNodeId = NumericNodeId(896);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=894");
+        node.ParentNodeId = NumericNodeId(894);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2729,9 +2729,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=896");
+        ref.SourceNodeId = NumericNodeId(896);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8247");
+        ref.TargetNodeId = NumericNodeId(8247);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -21,10 +21,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=56");
+        node.RequestedNewNodeId = NumericNodeId(56);
         node.BrowseName = ToQualifiedName("HasHistoricalConfiguration");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=44");
+        node.ParentNodeId = NumericNodeId(44);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for a reference to the historical configuration for a data variable.");
@@ -38,12 +38,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11192");
+        node.RequestedNewNodeId = NumericNodeId(11192);
         node.BrowseName = ToQualifiedName("HistoryServerCapabilities");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2268");
+        node.ParentNodeId = NumericNodeId(2268);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2330");
+        node.TypeDefinition = NumericNodeId(2330);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("HistoryServerCapabilities");
         attrs.EventNotifier = 0;
@@ -54,135 +54,135 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11193");
+        ref.TargetNodeId = NumericNodeId(11193);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11242");
+        ref.TargetNodeId = NumericNodeId(11242);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11273");
+        ref.TargetNodeId = NumericNodeId(11273);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11274");
+        ref.TargetNodeId = NumericNodeId(11274);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11196");
+        ref.TargetNodeId = NumericNodeId(11196);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11197");
+        ref.TargetNodeId = NumericNodeId(11197);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11198");
+        ref.TargetNodeId = NumericNodeId(11198);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11199");
+        ref.TargetNodeId = NumericNodeId(11199);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11200");
+        ref.TargetNodeId = NumericNodeId(11200);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11281");
+        ref.TargetNodeId = NumericNodeId(11281);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11282");
+        ref.TargetNodeId = NumericNodeId(11282);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11283");
+        ref.TargetNodeId = NumericNodeId(11283);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11502");
+        ref.TargetNodeId = NumericNodeId(11502);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11275");
+        ref.TargetNodeId = NumericNodeId(11275);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=11192");
+        ref.SourceNodeId = NumericNodeId(11192);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11201");
+        ref.TargetNodeId = NumericNodeId(11201);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -190,12 +190,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11193");
+        node.RequestedNewNodeId = NumericNodeId(11193);
         node.BrowseName = ToQualifiedName("AccessHistoryDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AccessHistoryDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -206,12 +206,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11242");
+        node.RequestedNewNodeId = NumericNodeId(11242);
         node.BrowseName = ToQualifiedName("AccessHistoryEventsCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AccessHistoryEventsCapability");
         attrs.Type = ObjectId::Boolean;
@@ -222,12 +222,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11273");
+        node.RequestedNewNodeId = NumericNodeId(11273);
         node.BrowseName = ToQualifiedName("MaxReturnDataValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxReturnDataValues");
         attrs.Type = ObjectId::UInt32;
@@ -238,12 +238,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11274");
+        node.RequestedNewNodeId = NumericNodeId(11274);
         node.BrowseName = ToQualifiedName("MaxReturnEventValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxReturnEventValues");
         attrs.Type = ObjectId::UInt32;
@@ -254,12 +254,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11196");
+        node.RequestedNewNodeId = NumericNodeId(11196);
         node.BrowseName = ToQualifiedName("InsertDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InsertDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -270,12 +270,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11197");
+        node.RequestedNewNodeId = NumericNodeId(11197);
         node.BrowseName = ToQualifiedName("ReplaceDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ReplaceDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -286,12 +286,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11198");
+        node.RequestedNewNodeId = NumericNodeId(11198);
         node.BrowseName = ToQualifiedName("UpdateDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UpdateDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -302,12 +302,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11199");
+        node.RequestedNewNodeId = NumericNodeId(11199);
         node.BrowseName = ToQualifiedName("DeleteRawCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DeleteRawCapability");
         attrs.Type = ObjectId::Boolean;
@@ -318,12 +318,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11200");
+        node.RequestedNewNodeId = NumericNodeId(11200);
         node.BrowseName = ToQualifiedName("DeleteAtTimeCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DeleteAtTimeCapability");
         attrs.Type = ObjectId::Boolean;
@@ -334,12 +334,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11281");
+        node.RequestedNewNodeId = NumericNodeId(11281);
         node.BrowseName = ToQualifiedName("InsertEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InsertEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -350,12 +350,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11282");
+        node.RequestedNewNodeId = NumericNodeId(11282);
         node.BrowseName = ToQualifiedName("ReplaceEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ReplaceEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -366,12 +366,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11283");
+        node.RequestedNewNodeId = NumericNodeId(11283);
         node.BrowseName = ToQualifiedName("UpdateEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UpdateEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -382,12 +382,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11502");
+        node.RequestedNewNodeId = NumericNodeId(11502);
         node.BrowseName = ToQualifiedName("DeleteEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DeleteEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -398,12 +398,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11275");
+        node.RequestedNewNodeId = NumericNodeId(11275);
         node.BrowseName = ToQualifiedName("InsertAnnotationCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InsertAnnotationCapability");
         attrs.Type = ObjectId::Boolean;
@@ -414,12 +414,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11201");
+        node.RequestedNewNodeId = NumericNodeId(11201);
         node.BrowseName = ToQualifiedName("AggregateFunctions");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=11192");
+        node.ParentNodeId = NumericNodeId(11192);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=61");
+        node.TypeDefinition = NumericNodeId(61);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("AggregateFunctions");
         attrs.EventNotifier = 0;
@@ -429,13 +429,13 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11214");
+        node.RequestedNewNodeId = NumericNodeId(11214);
         node.BrowseName = ToQualifiedName("Annotations");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Annotations");
-        attrs.Type = ToNodeId("i=891");
+        attrs.Type = NumericNodeId(891);
         attrs.Rank = -2;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -443,10 +443,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2318");
+        node.RequestedNewNodeId = NumericNodeId(2318);
         node.BrowseName = ToQualifiedName("HistoricalDataConfigurationType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=58");
+        node.ParentNodeId = NumericNodeId(58);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HistoricalDataConfigurationType");
@@ -458,90 +458,90 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3059");
+        ref.TargetNodeId = NumericNodeId(3059);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11876");
+        ref.TargetNodeId = NumericNodeId(11876);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2323");
+        ref.TargetNodeId = NumericNodeId(2323);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2324");
+        ref.TargetNodeId = NumericNodeId(2324);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2325");
+        ref.TargetNodeId = NumericNodeId(2325);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2326");
+        ref.TargetNodeId = NumericNodeId(2326);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2327");
+        ref.TargetNodeId = NumericNodeId(2327);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2328");
+        ref.TargetNodeId = NumericNodeId(2328);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11499");
+        ref.TargetNodeId = NumericNodeId(11499);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2318");
+        ref.SourceNodeId = NumericNodeId(2318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11500");
+        ref.TargetNodeId = NumericNodeId(11500);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -549,12 +549,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3059");
+        node.RequestedNewNodeId = NumericNodeId(3059);
         node.BrowseName = ToQualifiedName("AggregateConfiguration");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=11187");
+        node.TypeDefinition = NumericNodeId(11187);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("AggregateConfiguration");
         attrs.EventNotifier = 0;
@@ -565,45 +565,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3059");
+        ref.SourceNodeId = NumericNodeId(3059);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11168");
+        ref.TargetNodeId = NumericNodeId(11168);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3059");
+        ref.SourceNodeId = NumericNodeId(3059);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11169");
+        ref.TargetNodeId = NumericNodeId(11169);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3059");
+        ref.SourceNodeId = NumericNodeId(3059);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11170");
+        ref.TargetNodeId = NumericNodeId(11170);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3059");
+        ref.SourceNodeId = NumericNodeId(3059);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11171");
+        ref.TargetNodeId = NumericNodeId(11171);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3059");
+        ref.SourceNodeId = NumericNodeId(3059);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -611,12 +611,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11168");
+        node.RequestedNewNodeId = NumericNodeId(11168);
         node.BrowseName = ToQualifiedName("TreatUncertainAsBad");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3059");
+        node.ParentNodeId = NumericNodeId(3059);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TreatUncertainAsBad");
         attrs.Type = ObjectId::Boolean;
@@ -628,9 +628,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11168");
+        ref.SourceNodeId = NumericNodeId(11168);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -638,12 +638,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11169");
+        node.RequestedNewNodeId = NumericNodeId(11169);
         node.BrowseName = ToQualifiedName("PercentDataBad");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3059");
+        node.ParentNodeId = NumericNodeId(3059);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PercentDataBad");
         attrs.Type = ObjectId::Byte;
@@ -655,9 +655,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11169");
+        ref.SourceNodeId = NumericNodeId(11169);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -665,12 +665,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11170");
+        node.RequestedNewNodeId = NumericNodeId(11170);
         node.BrowseName = ToQualifiedName("PercentDataGood");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3059");
+        node.ParentNodeId = NumericNodeId(3059);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PercentDataGood");
         attrs.Type = ObjectId::Byte;
@@ -682,9 +682,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11170");
+        ref.SourceNodeId = NumericNodeId(11170);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -692,12 +692,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11171");
+        node.RequestedNewNodeId = NumericNodeId(11171);
         node.BrowseName = ToQualifiedName("UseSlopedExtrapolation");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3059");
+        node.ParentNodeId = NumericNodeId(3059);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UseSlopedExtrapolation");
         attrs.Type = ObjectId::Boolean;
@@ -709,9 +709,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11171");
+        ref.SourceNodeId = NumericNodeId(11171);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -719,12 +719,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11876");
+        node.RequestedNewNodeId = NumericNodeId(11876);
         node.BrowseName = ToQualifiedName("AggregateFunctions");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=61");
+        node.TypeDefinition = NumericNodeId(61);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("AggregateFunctions");
         attrs.EventNotifier = 0;
@@ -735,9 +735,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11876");
+        ref.SourceNodeId = NumericNodeId(11876);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -745,12 +745,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2323");
+        node.RequestedNewNodeId = NumericNodeId(2323);
         node.BrowseName = ToQualifiedName("Stepped");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Stepped");
         attrs.Type = ObjectId::Boolean;
@@ -762,9 +762,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2323");
+        ref.SourceNodeId = NumericNodeId(2323);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -772,12 +772,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2324");
+        node.RequestedNewNodeId = NumericNodeId(2324);
         node.BrowseName = ToQualifiedName("Definition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Definition");
         attrs.Type = ObjectId::String;
@@ -789,9 +789,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2324");
+        ref.SourceNodeId = NumericNodeId(2324);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -799,15 +799,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2325");
+        node.RequestedNewNodeId = NumericNodeId(2325);
         node.BrowseName = ToQualifiedName("MaxTimeInterval");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxTimeInterval");
-        attrs.Type = ToNodeId("i=290");
+        attrs.Type = NumericNodeId(290);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -816,9 +816,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2325");
+        ref.SourceNodeId = NumericNodeId(2325);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -826,15 +826,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2326");
+        node.RequestedNewNodeId = NumericNodeId(2326);
         node.BrowseName = ToQualifiedName("MinTimeInterval");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MinTimeInterval");
-        attrs.Type = ToNodeId("i=290");
+        attrs.Type = NumericNodeId(290);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -843,9 +843,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2326");
+        ref.SourceNodeId = NumericNodeId(2326);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -853,12 +853,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2327");
+        node.RequestedNewNodeId = NumericNodeId(2327);
         node.BrowseName = ToQualifiedName("ExceptionDeviation");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ExceptionDeviation");
         attrs.Type = ObjectId::Double;
@@ -870,9 +870,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2327");
+        ref.SourceNodeId = NumericNodeId(2327);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -880,15 +880,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2328");
+        node.RequestedNewNodeId = NumericNodeId(2328);
         node.BrowseName = ToQualifiedName("ExceptionDeviationFormat");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ExceptionDeviationFormat");
-        attrs.Type = ToNodeId("i=890");
+        attrs.Type = NumericNodeId(890);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -897,9 +897,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2328");
+        ref.SourceNodeId = NumericNodeId(2328);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -907,15 +907,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11499");
+        node.RequestedNewNodeId = NumericNodeId(11499);
         node.BrowseName = ToQualifiedName("StartOfArchive");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StartOfArchive");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -924,9 +924,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11499");
+        ref.SourceNodeId = NumericNodeId(11499);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -934,15 +934,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11500");
+        node.RequestedNewNodeId = NumericNodeId(11500);
         node.BrowseName = ToQualifiedName("StartOfOnlineArchive");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2318");
+        node.ParentNodeId = NumericNodeId(2318);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StartOfOnlineArchive");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -951,9 +951,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11500");
+        ref.SourceNodeId = NumericNodeId(11500);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -961,10 +961,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11202");
+        node.RequestedNewNodeId = NumericNodeId(11202);
         node.BrowseName = ToQualifiedName("HA Configuration");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2318");
+        node.TypeDefinition = NumericNodeId(2318);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("HA Configuration");
         attrs.EventNotifier = 0;
@@ -975,18 +975,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=11202");
+        ref.SourceNodeId = NumericNodeId(11202);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11203");
+        ref.TargetNodeId = NumericNodeId(11203);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11202");
+        ref.SourceNodeId = NumericNodeId(11202);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11208");
+        ref.TargetNodeId = NumericNodeId(11208);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -994,12 +994,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11203");
+        node.RequestedNewNodeId = NumericNodeId(11203);
         node.BrowseName = ToQualifiedName("AggregateConfiguration");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=11202");
+        node.ParentNodeId = NumericNodeId(11202);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=11187");
+        node.TypeDefinition = NumericNodeId(11187);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("AggregateConfiguration");
         attrs.EventNotifier = 0;
@@ -1010,36 +1010,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11203");
+        ref.SourceNodeId = NumericNodeId(11203);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11204");
+        ref.TargetNodeId = NumericNodeId(11204);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11203");
+        ref.SourceNodeId = NumericNodeId(11203);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11205");
+        ref.TargetNodeId = NumericNodeId(11205);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11203");
+        ref.SourceNodeId = NumericNodeId(11203);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11206");
+        ref.TargetNodeId = NumericNodeId(11206);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11203");
+        ref.SourceNodeId = NumericNodeId(11203);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11207");
+        ref.TargetNodeId = NumericNodeId(11207);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1047,12 +1047,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11204");
+        node.RequestedNewNodeId = NumericNodeId(11204);
         node.BrowseName = ToQualifiedName("TreatUncertainAsBad");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11203");
+        node.ParentNodeId = NumericNodeId(11203);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TreatUncertainAsBad");
         attrs.Type = ObjectId::Boolean;
@@ -1063,12 +1063,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11205");
+        node.RequestedNewNodeId = NumericNodeId(11205);
         node.BrowseName = ToQualifiedName("PercentDataBad");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11203");
+        node.ParentNodeId = NumericNodeId(11203);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PercentDataBad");
         attrs.Type = ObjectId::Byte;
@@ -1079,12 +1079,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11206");
+        node.RequestedNewNodeId = NumericNodeId(11206);
         node.BrowseName = ToQualifiedName("PercentDataGood");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11203");
+        node.ParentNodeId = NumericNodeId(11203);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PercentDataGood");
         attrs.Type = ObjectId::Byte;
@@ -1095,12 +1095,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11207");
+        node.RequestedNewNodeId = NumericNodeId(11207);
         node.BrowseName = ToQualifiedName("UseSlopedExtrapolation");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11203");
+        node.ParentNodeId = NumericNodeId(11203);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UseSlopedExtrapolation");
         attrs.Type = ObjectId::Boolean;
@@ -1111,12 +1111,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11208");
+        node.RequestedNewNodeId = NumericNodeId(11208);
         node.BrowseName = ToQualifiedName("Stepped");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11202");
+        node.ParentNodeId = NumericNodeId(11202);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Stepped");
         attrs.Type = ObjectId::Boolean;
@@ -1127,13 +1127,13 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11215");
+        node.RequestedNewNodeId = NumericNodeId(11215);
         node.BrowseName = ToQualifiedName("HistoricalEventFilter");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("HistoricalEventFilter");
-        attrs.Type = ToNodeId("i=725");
+        attrs.Type = NumericNodeId(725);
         attrs.Rank = -2;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1141,10 +1141,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2330");
+        node.RequestedNewNodeId = NumericNodeId(2330);
         node.BrowseName = ToQualifiedName("HistoryServerCapabilitiesType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=58");
+        node.ParentNodeId = NumericNodeId(58);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HistoryServerCapabilitiesType");
@@ -1156,135 +1156,135 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2331");
+        ref.TargetNodeId = NumericNodeId(2331);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2332");
+        ref.TargetNodeId = NumericNodeId(2332);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11268");
+        ref.TargetNodeId = NumericNodeId(11268);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11269");
+        ref.TargetNodeId = NumericNodeId(11269);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2334");
+        ref.TargetNodeId = NumericNodeId(2334);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2335");
+        ref.TargetNodeId = NumericNodeId(2335);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2336");
+        ref.TargetNodeId = NumericNodeId(2336);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2337");
+        ref.TargetNodeId = NumericNodeId(2337);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2338");
+        ref.TargetNodeId = NumericNodeId(2338);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11278");
+        ref.TargetNodeId = NumericNodeId(11278);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11279");
+        ref.TargetNodeId = NumericNodeId(11279);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11280");
+        ref.TargetNodeId = NumericNodeId(11280);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11501");
+        ref.TargetNodeId = NumericNodeId(11501);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11270");
+        ref.TargetNodeId = NumericNodeId(11270);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2330");
+        ref.SourceNodeId = NumericNodeId(2330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11172");
+        ref.TargetNodeId = NumericNodeId(11172);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1292,12 +1292,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2331");
+        node.RequestedNewNodeId = NumericNodeId(2331);
         node.BrowseName = ToQualifiedName("AccessHistoryDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AccessHistoryDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1309,9 +1309,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2331");
+        ref.SourceNodeId = NumericNodeId(2331);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1319,12 +1319,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2332");
+        node.RequestedNewNodeId = NumericNodeId(2332);
         node.BrowseName = ToQualifiedName("AccessHistoryEventsCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AccessHistoryEventsCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1336,9 +1336,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2332");
+        ref.SourceNodeId = NumericNodeId(2332);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1346,12 +1346,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11268");
+        node.RequestedNewNodeId = NumericNodeId(11268);
         node.BrowseName = ToQualifiedName("MaxReturnDataValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxReturnDataValues");
         attrs.Type = ObjectId::UInt32;
@@ -1363,9 +1363,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11268");
+        ref.SourceNodeId = NumericNodeId(11268);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1373,12 +1373,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11269");
+        node.RequestedNewNodeId = NumericNodeId(11269);
         node.BrowseName = ToQualifiedName("MaxReturnEventValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxReturnEventValues");
         attrs.Type = ObjectId::UInt32;
@@ -1390,9 +1390,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11269");
+        ref.SourceNodeId = NumericNodeId(11269);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1400,12 +1400,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2334");
+        node.RequestedNewNodeId = NumericNodeId(2334);
         node.BrowseName = ToQualifiedName("InsertDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InsertDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1417,9 +1417,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2334");
+        ref.SourceNodeId = NumericNodeId(2334);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1427,12 +1427,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2335");
+        node.RequestedNewNodeId = NumericNodeId(2335);
         node.BrowseName = ToQualifiedName("ReplaceDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ReplaceDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1444,9 +1444,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2335");
+        ref.SourceNodeId = NumericNodeId(2335);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1454,12 +1454,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2336");
+        node.RequestedNewNodeId = NumericNodeId(2336);
         node.BrowseName = ToQualifiedName("UpdateDataCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UpdateDataCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1471,9 +1471,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2336");
+        ref.SourceNodeId = NumericNodeId(2336);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1481,12 +1481,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2337");
+        node.RequestedNewNodeId = NumericNodeId(2337);
         node.BrowseName = ToQualifiedName("DeleteRawCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DeleteRawCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1498,9 +1498,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2337");
+        ref.SourceNodeId = NumericNodeId(2337);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1508,12 +1508,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2338");
+        node.RequestedNewNodeId = NumericNodeId(2338);
         node.BrowseName = ToQualifiedName("DeleteAtTimeCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DeleteAtTimeCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1525,9 +1525,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2338");
+        ref.SourceNodeId = NumericNodeId(2338);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1535,12 +1535,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11278");
+        node.RequestedNewNodeId = NumericNodeId(11278);
         node.BrowseName = ToQualifiedName("InsertEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InsertEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1552,9 +1552,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11278");
+        ref.SourceNodeId = NumericNodeId(11278);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1562,12 +1562,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11279");
+        node.RequestedNewNodeId = NumericNodeId(11279);
         node.BrowseName = ToQualifiedName("ReplaceEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ReplaceEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1579,9 +1579,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11279");
+        ref.SourceNodeId = NumericNodeId(11279);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1589,12 +1589,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11280");
+        node.RequestedNewNodeId = NumericNodeId(11280);
         node.BrowseName = ToQualifiedName("UpdateEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UpdateEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1606,9 +1606,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11280");
+        ref.SourceNodeId = NumericNodeId(11280);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1616,12 +1616,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11501");
+        node.RequestedNewNodeId = NumericNodeId(11501);
         node.BrowseName = ToQualifiedName("DeleteEventCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DeleteEventCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1633,9 +1633,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11501");
+        ref.SourceNodeId = NumericNodeId(11501);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1643,12 +1643,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11270");
+        node.RequestedNewNodeId = NumericNodeId(11270);
         node.BrowseName = ToQualifiedName("InsertAnnotationCapability");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InsertAnnotationCapability");
         attrs.Type = ObjectId::Boolean;
@@ -1660,9 +1660,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11270");
+        ref.SourceNodeId = NumericNodeId(11270);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1670,12 +1670,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11172");
+        node.RequestedNewNodeId = NumericNodeId(11172);
         node.BrowseName = ToQualifiedName("AggregateFunctions");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2330");
+        node.ParentNodeId = NumericNodeId(2330);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=61");
+        node.TypeDefinition = NumericNodeId(61);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("AggregateFunctions");
         attrs.EventNotifier = 0;
@@ -1686,9 +1686,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11172");
+        ref.SourceNodeId = NumericNodeId(11172);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1696,10 +1696,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2999");
+        node.RequestedNewNodeId = NumericNodeId(2999);
         node.BrowseName = ToQualifiedName("AuditHistoryEventUpdateEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2104");
+        node.ParentNodeId = NumericNodeId(2104);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditHistoryEventUpdateEventType");
@@ -1711,45 +1711,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2999");
+        ref.SourceNodeId = NumericNodeId(2999);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3025");
+        ref.TargetNodeId = NumericNodeId(3025);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2999");
+        ref.SourceNodeId = NumericNodeId(2999);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3028");
+        ref.TargetNodeId = NumericNodeId(3028);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2999");
+        ref.SourceNodeId = NumericNodeId(2999);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3003");
+        ref.TargetNodeId = NumericNodeId(3003);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2999");
+        ref.SourceNodeId = NumericNodeId(2999);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3029");
+        ref.TargetNodeId = NumericNodeId(3029);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2999");
+        ref.SourceNodeId = NumericNodeId(2999);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3030");
+        ref.TargetNodeId = NumericNodeId(3030);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1757,12 +1757,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3025");
+        node.RequestedNewNodeId = NumericNodeId(3025);
         node.BrowseName = ToQualifiedName("UpdatedNode");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2999");
+        node.ParentNodeId = NumericNodeId(2999);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UpdatedNode");
         attrs.Type = ObjectId::NodeId;
@@ -1774,9 +1774,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3025");
+        ref.SourceNodeId = NumericNodeId(3025);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1784,15 +1784,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3028");
+        node.RequestedNewNodeId = NumericNodeId(3028);
         node.BrowseName = ToQualifiedName("PerformInsertReplace");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2999");
+        node.ParentNodeId = NumericNodeId(2999);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PerformInsertReplace");
-        attrs.Type = ToNodeId("i=11293");
+        attrs.Type = NumericNodeId(11293);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1801,9 +1801,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3028");
+        ref.SourceNodeId = NumericNodeId(3028);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1811,15 +1811,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3003");
+        node.RequestedNewNodeId = NumericNodeId(3003);
         node.BrowseName = ToQualifiedName("Filter");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2999");
+        node.ParentNodeId = NumericNodeId(2999);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Filter");
-        attrs.Type = ToNodeId("i=725");
+        attrs.Type = NumericNodeId(725);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1828,9 +1828,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3003");
+        ref.SourceNodeId = NumericNodeId(3003);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1838,15 +1838,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3029");
+        node.RequestedNewNodeId = NumericNodeId(3029);
         node.BrowseName = ToQualifiedName("NewValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2999");
+        node.ParentNodeId = NumericNodeId(2999);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("NewValues");
-        attrs.Type = ToNodeId("i=920");
+        attrs.Type = NumericNodeId(920);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1855,9 +1855,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3029");
+        ref.SourceNodeId = NumericNodeId(3029);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1865,15 +1865,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3030");
+        node.RequestedNewNodeId = NumericNodeId(3030);
         node.BrowseName = ToQualifiedName("OldValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2999");
+        node.ParentNodeId = NumericNodeId(2999);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("OldValues");
-        attrs.Type = ToNodeId("i=920");
+        attrs.Type = NumericNodeId(920);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1882,9 +1882,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3030");
+        ref.SourceNodeId = NumericNodeId(3030);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1892,10 +1892,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3006");
+        node.RequestedNewNodeId = NumericNodeId(3006);
         node.BrowseName = ToQualifiedName("AuditHistoryValueUpdateEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2104");
+        node.ParentNodeId = NumericNodeId(2104);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditHistoryValueUpdateEventType");
@@ -1907,36 +1907,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3006");
+        ref.SourceNodeId = NumericNodeId(3006);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3026");
+        ref.TargetNodeId = NumericNodeId(3026);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3006");
+        ref.SourceNodeId = NumericNodeId(3006);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3031");
+        ref.TargetNodeId = NumericNodeId(3031);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3006");
+        ref.SourceNodeId = NumericNodeId(3006);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3032");
+        ref.TargetNodeId = NumericNodeId(3032);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3006");
+        ref.SourceNodeId = NumericNodeId(3006);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3033");
+        ref.TargetNodeId = NumericNodeId(3033);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1944,12 +1944,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3026");
+        node.RequestedNewNodeId = NumericNodeId(3026);
         node.BrowseName = ToQualifiedName("UpdatedNode");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3006");
+        node.ParentNodeId = NumericNodeId(3006);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UpdatedNode");
         attrs.Type = ObjectId::NodeId;
@@ -1961,9 +1961,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3026");
+        ref.SourceNodeId = NumericNodeId(3026);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1971,15 +1971,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3031");
+        node.RequestedNewNodeId = NumericNodeId(3031);
         node.BrowseName = ToQualifiedName("PerformInsertReplace");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3006");
+        node.ParentNodeId = NumericNodeId(3006);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PerformInsertReplace");
-        attrs.Type = ToNodeId("i=11293");
+        attrs.Type = NumericNodeId(11293);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1988,9 +1988,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3031");
+        ref.SourceNodeId = NumericNodeId(3031);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1998,15 +1998,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3032");
+        node.RequestedNewNodeId = NumericNodeId(3032);
         node.BrowseName = ToQualifiedName("NewValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3006");
+        node.ParentNodeId = NumericNodeId(3006);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("NewValues");
-        attrs.Type = ToNodeId("i=23");
+        attrs.Type = NumericNodeId(23);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2015,9 +2015,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3032");
+        ref.SourceNodeId = NumericNodeId(3032);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2025,15 +2025,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3033");
+        node.RequestedNewNodeId = NumericNodeId(3033);
         node.BrowseName = ToQualifiedName("OldValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3006");
+        node.ParentNodeId = NumericNodeId(3006);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("OldValues");
-        attrs.Type = ToNodeId("i=23");
+        attrs.Type = NumericNodeId(23);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2042,9 +2042,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3033");
+        ref.SourceNodeId = NumericNodeId(3033);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2052,10 +2052,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3012");
+        node.RequestedNewNodeId = NumericNodeId(3012);
         node.BrowseName = ToQualifiedName("AuditHistoryDeleteEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2104");
+        node.ParentNodeId = NumericNodeId(2104);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditHistoryDeleteEventType");
@@ -2067,9 +2067,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3012");
+        ref.SourceNodeId = NumericNodeId(3012);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3027");
+        ref.TargetNodeId = NumericNodeId(3027);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2077,12 +2077,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3027");
+        node.RequestedNewNodeId = NumericNodeId(3027);
         node.BrowseName = ToQualifiedName("UpdatedNode");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3012");
+        node.ParentNodeId = NumericNodeId(3012);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UpdatedNode");
         attrs.Type = ObjectId::NodeId;
@@ -2094,9 +2094,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3027");
+        ref.SourceNodeId = NumericNodeId(3027);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2104,10 +2104,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3014");
+        node.RequestedNewNodeId = NumericNodeId(3014);
         node.BrowseName = ToQualifiedName("AuditHistoryRawModifyDeleteEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=3012");
+        node.ParentNodeId = NumericNodeId(3012);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditHistoryRawModifyDeleteEventType");
@@ -2119,36 +2119,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3014");
+        ref.SourceNodeId = NumericNodeId(3014);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3015");
+        ref.TargetNodeId = NumericNodeId(3015);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3014");
+        ref.SourceNodeId = NumericNodeId(3014);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3016");
+        ref.TargetNodeId = NumericNodeId(3016);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3014");
+        ref.SourceNodeId = NumericNodeId(3014);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3017");
+        ref.TargetNodeId = NumericNodeId(3017);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3014");
+        ref.SourceNodeId = NumericNodeId(3014);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3034");
+        ref.TargetNodeId = NumericNodeId(3034);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2156,12 +2156,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3015");
+        node.RequestedNewNodeId = NumericNodeId(3015);
         node.BrowseName = ToQualifiedName("IsDeleteModified");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3014");
+        node.ParentNodeId = NumericNodeId(3014);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("IsDeleteModified");
         attrs.Type = ObjectId::Boolean;
@@ -2173,9 +2173,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3015");
+        ref.SourceNodeId = NumericNodeId(3015);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2183,15 +2183,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3016");
+        node.RequestedNewNodeId = NumericNodeId(3016);
         node.BrowseName = ToQualifiedName("StartTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3014");
+        node.ParentNodeId = NumericNodeId(3014);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StartTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2200,9 +2200,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3016");
+        ref.SourceNodeId = NumericNodeId(3016);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2210,15 +2210,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3017");
+        node.RequestedNewNodeId = NumericNodeId(3017);
         node.BrowseName = ToQualifiedName("EndTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3014");
+        node.ParentNodeId = NumericNodeId(3014);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EndTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2227,9 +2227,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3017");
+        ref.SourceNodeId = NumericNodeId(3017);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2237,15 +2237,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3034");
+        node.RequestedNewNodeId = NumericNodeId(3034);
         node.BrowseName = ToQualifiedName("OldValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3014");
+        node.ParentNodeId = NumericNodeId(3014);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("OldValues");
-        attrs.Type = ToNodeId("i=23");
+        attrs.Type = NumericNodeId(23);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2254,9 +2254,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3034");
+        ref.SourceNodeId = NumericNodeId(3034);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2264,10 +2264,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3019");
+        node.RequestedNewNodeId = NumericNodeId(3019);
         node.BrowseName = ToQualifiedName("AuditHistoryAtTimeDeleteEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=3012");
+        node.ParentNodeId = NumericNodeId(3012);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditHistoryAtTimeDeleteEventType");
@@ -2279,18 +2279,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3019");
+        ref.SourceNodeId = NumericNodeId(3019);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3020");
+        ref.TargetNodeId = NumericNodeId(3020);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3019");
+        ref.SourceNodeId = NumericNodeId(3019);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3021");
+        ref.TargetNodeId = NumericNodeId(3021);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2298,15 +2298,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3020");
+        node.RequestedNewNodeId = NumericNodeId(3020);
         node.BrowseName = ToQualifiedName("ReqTimes");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3019");
+        node.ParentNodeId = NumericNodeId(3019);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ReqTimes");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2315,9 +2315,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3020");
+        ref.SourceNodeId = NumericNodeId(3020);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2325,15 +2325,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3021");
+        node.RequestedNewNodeId = NumericNodeId(3021);
         node.BrowseName = ToQualifiedName("OldValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3019");
+        node.ParentNodeId = NumericNodeId(3019);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("OldValues");
-        attrs.Type = ToNodeId("i=23");
+        attrs.Type = NumericNodeId(23);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2342,9 +2342,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3021");
+        ref.SourceNodeId = NumericNodeId(3021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2352,10 +2352,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3022");
+        node.RequestedNewNodeId = NumericNodeId(3022);
         node.BrowseName = ToQualifiedName("AuditHistoryEventDeleteEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=3012");
+        node.ParentNodeId = NumericNodeId(3012);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditHistoryEventDeleteEventType");
@@ -2367,18 +2367,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3022");
+        ref.SourceNodeId = NumericNodeId(3022);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3023");
+        ref.TargetNodeId = NumericNodeId(3023);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=3022");
+        ref.SourceNodeId = NumericNodeId(3022);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3024");
+        ref.TargetNodeId = NumericNodeId(3024);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2386,12 +2386,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3023");
+        node.RequestedNewNodeId = NumericNodeId(3023);
         node.BrowseName = ToQualifiedName("EventIds");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3022");
+        node.ParentNodeId = NumericNodeId(3022);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EventIds");
         attrs.Type = ObjectId::ByteString;
@@ -2403,9 +2403,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3023");
+        ref.SourceNodeId = NumericNodeId(3023);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2413,15 +2413,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3024");
+        node.RequestedNewNodeId = NumericNodeId(3024);
         node.BrowseName = ToQualifiedName("OldValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3022");
+        node.ParentNodeId = NumericNodeId(3022);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("OldValues");
-        attrs.Type = ToNodeId("i=920");
+        attrs.Type = NumericNodeId(920);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2430,9 +2430,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3024");
+        ref.SourceNodeId = NumericNodeId(3024);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2440,10 +2440,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=891");
+        node.RequestedNewNodeId = NumericNodeId(891);
         node.BrowseName = ToQualifiedName("Annotation");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("Annotation");
@@ -2454,10 +2454,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=890");
+        node.RequestedNewNodeId = NumericNodeId(890);
         node.BrowseName = ToQualifiedName("ExceptionDeviationFormat");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ExceptionDeviationFormat");
@@ -2469,9 +2469,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=890");
+        ref.SourceNodeId = NumericNodeId(890);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7614");
+        ref.TargetNodeId = NumericNodeId(7614);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2479,12 +2479,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7614");
+        node.RequestedNewNodeId = NumericNodeId(7614);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=890");
+        node.ParentNodeId = NumericNodeId(890);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -2496,9 +2496,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7614");
+        ref.SourceNodeId = NumericNodeId(7614);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2506,12 +2506,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=892");
+        node.RequestedNewNodeId = NumericNodeId(892);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=891");
+        node.ParentNodeId = NumericNodeId(891);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -2522,9 +2522,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=892");
+        ref.SourceNodeId = NumericNodeId(892);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8879");
+        ref.TargetNodeId = NumericNodeId(8879);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2532,12 +2532,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=893");
+        node.RequestedNewNodeId = NumericNodeId(893);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=891");
+        node.ParentNodeId = NumericNodeId(891);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2548,9 +2548,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=893");
+        ref.SourceNodeId = NumericNodeId(893);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8244");
+        ref.TargetNodeId = NumericNodeId(8244);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
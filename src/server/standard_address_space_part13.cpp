@@ -21,10 +21,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11187");
+        node.RequestedNewNodeId = NumericNodeId(11187);
         node.BrowseName = ToQualifiedName("AggregateConfigurationType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=58");
+        node.ParentNodeId = NumericNodeId(58);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AggregateConfigurationType");
@@ -36,36 +36,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11187");
+        ref.SourceNodeId = NumericNodeId(11187);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11188");
+        ref.TargetNodeId = NumericNodeId(11188);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11187");
+        ref.SourceNodeId = NumericNodeId(11187);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11189");
+        ref.TargetNodeId = NumericNodeId(11189);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11187");
+        ref.SourceNodeId = NumericNodeId(11187);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11190");
+        ref.TargetNodeId = NumericNodeId(11190);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11187");
+        ref.SourceNodeId = NumericNodeId(11187);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11191");
+        ref.TargetNodeId = NumericNodeId(11191);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -73,12 +73,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11188");
+        node.RequestedNewNodeId = NumericNodeId(11188);
         node.BrowseName = ToQualifiedName("TreatUncertainAsBad");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11187");
+        node.ParentNodeId = NumericNodeId(11187);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TreatUncertainAsBad");
         attrs.Type = ObjectId::Boolean;
@@ -90,9 +90,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11188");
+        ref.SourceNodeId = NumericNodeId(11188);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -100,12 +100,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11189");
+        node.RequestedNewNodeId = NumericNodeId(11189);
         node.BrowseName = ToQualifiedName("PercentDataBad");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11187");
+        node.ParentNodeId = NumericNodeId(11187);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PercentDataBad");
         attrs.Type = ObjectId::Byte;
@@ -117,9 +117,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11189");
+        ref.SourceNodeId = NumericNodeId(11189);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -127,12 +127,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11190");
+        node.RequestedNewNodeId = NumericNodeId(11190);
         node.BrowseName = ToQualifiedName("PercentDataGood");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11187");
+        node.ParentNodeId = NumericNodeId(11187);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("PercentDataGood");
         attrs.Type = ObjectId::Byte;
@@ -144,9 +144,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11190");
+        ref.SourceNodeId = NumericNodeId(11190);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -154,12 +154,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11191");
+        node.RequestedNewNodeId = NumericNodeId(11191);
         node.BrowseName = ToQualifiedName("UseSlopedExtrapolation");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11187");
+        node.ParentNodeId = NumericNodeId(11187);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UseSlopedExtrapolation");
         attrs.Type = ObjectId::Boolean;
@@ -171,9 +171,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11191");
+        ref.SourceNodeId = NumericNodeId(11191);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -181,10 +181,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2341");
+        node.RequestedNewNodeId = NumericNodeId(2341);
         node.BrowseName = ToQualifiedName("Interpolative");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("At the beginning of each interval, retrieve the calculated value from the data points on either side of the requested timestamp.");
         attrs.DisplayName = LocalizedText("Interpolative");
@@ -195,10 +195,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2342");
+        node.RequestedNewNodeId = NumericNodeId(2342);
         node.BrowseName = ToQualifiedName("Average");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the average value of the data over the interval.");
         attrs.DisplayName = LocalizedText("Average");
@@ -209,10 +209,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2343");
+        node.RequestedNewNodeId = NumericNodeId(2343);
         node.BrowseName = ToQualifiedName("TimeAverage");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the time weighted average data over the interval using Interpolated Bounding Values.");
         attrs.DisplayName = LocalizedText("TimeAverage");
@@ -223,10 +223,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11285");
+        node.RequestedNewNodeId = NumericNodeId(11285);
         node.BrowseName = ToQualifiedName("TimeAverage2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the time weighted average data over the interval using Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("TimeAverage2");
@@ -237,10 +237,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2344");
+        node.RequestedNewNodeId = NumericNodeId(2344);
         node.BrowseName = ToQualifiedName("Total");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the total (time integral) of the data over the interval using Interpolated Bounding Values.");
         attrs.DisplayName = LocalizedText("Total");
@@ -251,10 +251,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11304");
+        node.RequestedNewNodeId = NumericNodeId(11304);
         node.BrowseName = ToQualifiedName("Total2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the total (time integral) of the data over the interval using Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("Total2");
@@ -265,10 +265,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2346");
+        node.RequestedNewNodeId = NumericNodeId(2346);
         node.BrowseName = ToQualifiedName("Minimum");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the minimum raw value in the interval with the timestamp of the start of the interval.");
         attrs.DisplayName = LocalizedText("Minimum");
@@ -279,10 +279,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2347");
+        node.RequestedNewNodeId = NumericNodeId(2347);
         node.BrowseName = ToQualifiedName("Maximum");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the maximum raw value in the interval with the timestamp of the start of the interval.");
         attrs.DisplayName = LocalizedText("Maximum");
@@ -293,10 +293,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2348");
+        node.RequestedNewNodeId = NumericNodeId(2348);
         node.BrowseName = ToQualifiedName("MinimumActualTime");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the minimum value in the interval and the Timestamp of the minimum value.");
         attrs.DisplayName = LocalizedText("MinimumActualTime");
@@ -307,10 +307,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2349");
+        node.RequestedNewNodeId = NumericNodeId(2349);
         node.BrowseName = ToQualifiedName("MaximumActualTime");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the maximum value in the interval and the Timestamp of the maximum value.");
         attrs.DisplayName = LocalizedText("MaximumActualTime");
@@ -321,10 +321,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2350");
+        node.RequestedNewNodeId = NumericNodeId(2350);
         node.BrowseName = ToQualifiedName("Range");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the difference between the minimum and maximum Value over the interval.");
         attrs.DisplayName = LocalizedText("Range");
@@ -335,10 +335,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11286");
+        node.RequestedNewNodeId = NumericNodeId(11286);
         node.BrowseName = ToQualifiedName("Minimum2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the minimum value in the interval including the Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("Minimum2");
@@ -349,10 +349,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11287");
+        node.RequestedNewNodeId = NumericNodeId(11287);
         node.BrowseName = ToQualifiedName("Maximum2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the maximum value in the interval including the Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("Maximum2");
@@ -363,10 +363,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11305");
+        node.RequestedNewNodeId = NumericNodeId(11305);
         node.BrowseName = ToQualifiedName("MinimumActualTime2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the minimum value with the actual timestamp including the Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("MinimumActualTime2");
@@ -377,10 +377,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11306");
+        node.RequestedNewNodeId = NumericNodeId(11306);
         node.BrowseName = ToQualifiedName("MaximumActualTime2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the maximum value with the actual timestamp including the Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("MaximumActualTime2");
@@ -391,10 +391,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11288");
+        node.RequestedNewNodeId = NumericNodeId(11288);
         node.BrowseName = ToQualifiedName("Range2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the difference between the Minimum2 and Maximum2 value over the interval.");
         attrs.DisplayName = LocalizedText("Range2");
@@ -405,10 +405,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2351");
+        node.RequestedNewNodeId = NumericNodeId(2351);
         node.BrowseName = ToQualifiedName("AnnotationCount");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the number of Annotations in the interval.");
         attrs.DisplayName = LocalizedText("AnnotationCount");
@@ -419,10 +419,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2352");
+        node.RequestedNewNodeId = NumericNodeId(2352);
         node.BrowseName = ToQualifiedName("Count");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the number of raw values over the interval.");
         attrs.DisplayName = LocalizedText("Count");
@@ -433,10 +433,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11307");
+        node.RequestedNewNodeId = NumericNodeId(11307);
         node.BrowseName = ToQualifiedName("DurationInStateZero");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the time a Boolean or numeric was in a zero state using Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("DurationInStateZero");
@@ -447,10 +447,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11308");
+        node.RequestedNewNodeId = NumericNodeId(11308);
         node.BrowseName = ToQualifiedName("DurationInStateNonZero");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the time a Boolean or numeric was in a non-zero state using Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("DurationInStateNonZero");
@@ -461,10 +461,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2355");
+        node.RequestedNewNodeId = NumericNodeId(2355);
         node.BrowseName = ToQualifiedName("NumberOfTransitions");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the number of changes between zero and non-zero that a Boolean or Numeric value experienced in the interval.");
         attrs.DisplayName = LocalizedText("NumberOfTransitions");
@@ -475,10 +475,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2357");
+        node.RequestedNewNodeId = NumericNodeId(2357);
         node.BrowseName = ToQualifiedName("Start");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the value at the beginning of the interval using Interpolated Bounding Values.");
         attrs.DisplayName = LocalizedText("Start");
@@ -489,10 +489,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2358");
+        node.RequestedNewNodeId = NumericNodeId(2358);
         node.BrowseName = ToQualifiedName("End");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the value at the end of the interval using Interpolated Bounding Values.");
         attrs.DisplayName = LocalizedText("End");
@@ -503,10 +503,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2359");
+        node.RequestedNewNodeId = NumericNodeId(2359);
         node.BrowseName = ToQualifiedName("Delta");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the difference between the Start and End value in the interval.");
         attrs.DisplayName = LocalizedText("Delta");
@@ -517,10 +517,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11505");
+        node.RequestedNewNodeId = NumericNodeId(11505);
         node.BrowseName = ToQualifiedName("StartBound");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the value at the beginning of the interval using Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("StartBound");
@@ -531,10 +531,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11506");
+        node.RequestedNewNodeId = NumericNodeId(11506);
         node.BrowseName = ToQualifiedName("EndBound");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the value at the end of the interval using Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("EndBound");
@@ -545,10 +545,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11507");
+        node.RequestedNewNodeId = NumericNodeId(11507);
         node.BrowseName = ToQualifiedName("DeltaBounds");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the difference between the StartBound and EndBound value in the interval.");
         attrs.DisplayName = LocalizedText("DeltaBounds");
@@ -559,10 +559,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2360");
+        node.RequestedNewNodeId = NumericNodeId(2360);
         node.BrowseName = ToQualifiedName("DurationGood");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the total duration of time in the interval during which the data is good.");
         attrs.DisplayName = LocalizedText("DurationGood");
@@ -573,10 +573,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2361");
+        node.RequestedNewNodeId = NumericNodeId(2361);
         node.BrowseName = ToQualifiedName("DurationBad");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the total duration of time in the interval during which the data is bad.");
         attrs.DisplayName = LocalizedText("DurationBad");
@@ -587,10 +587,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2362");
+        node.RequestedNewNodeId = NumericNodeId(2362);
         node.BrowseName = ToQualifiedName("PercentGood");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the percent of data (0 to 100) in the interval which has a good StatusCode.");
         attrs.DisplayName = LocalizedText("PercentGood");
@@ -601,10 +601,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2363");
+        node.RequestedNewNodeId = NumericNodeId(2363);
         node.BrowseName = ToQualifiedName("PercentBad");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the percent of data (0 to 100) in the interval which has a bad StatusCode.");
         attrs.DisplayName = LocalizedText("PercentBad");
@@ -615,10 +615,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2364");
+        node.RequestedNewNodeId = NumericNodeId(2364);
         node.BrowseName = ToQualifiedName("WorstQuality");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the worst StatusCode of data in the interval.");
         attrs.DisplayName = LocalizedText("WorstQuality");
@@ -629,10 +629,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11292");
+        node.RequestedNewNodeId = NumericNodeId(11292);
         node.BrowseName = ToQualifiedName("WorstQuality2");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the worst StatusCode of data in the interval including the Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("WorstQuality2");
@@ -643,10 +643,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11426");
+        node.RequestedNewNodeId = NumericNodeId(11426);
         node.BrowseName = ToQualifiedName("StandardDeviationSample");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the standard deviation for the interval for a sample of the population (n-1).");
         attrs.DisplayName = LocalizedText("StandardDeviationSample");
@@ -657,10 +657,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11427");
+        node.RequestedNewNodeId = NumericNodeId(11427);
         node.BrowseName = ToQualifiedName("StandardDeviationPopulation");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the standard deviation for the interval for a complete population (n) which includes Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("StandardDeviationPopulation");
@@ -671,10 +671,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11428");
+        node.RequestedNewNodeId = NumericNodeId(11428);
         node.BrowseName = ToQualifiedName("VarianceSample");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the variance for the interval as calculated by the StandardDeviationSample.");
         attrs.DisplayName = LocalizedText("VarianceSample");
@@ -685,10 +685,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11429");
+        node.RequestedNewNodeId = NumericNodeId(11429);
         node.BrowseName = ToQualifiedName("VariancePopulation");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=2340");
+        node.TypeDefinition = NumericNodeId(2340);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("Retrieve the variance for the interval as calculated by the StandardDeviationPopulation which includes Simple Bounding Values.");
         attrs.DisplayName = LocalizedText("VariancePopulation");
@@ -21,10 +21,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3062");
+        node.RequestedNewNodeId = NumericNodeId(3062);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=58");
+        node.TypeDefinition = NumericNodeId(58);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("The default binary encoding for a data type.");
         attrs.DisplayName = LocalizedText("Default Binary");
@@ -35,10 +35,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3063");
+        node.RequestedNewNodeId = NumericNodeId(3063);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.TypeDefinition = ToNodeId("i=58");
+        node.TypeDefinition = NumericNodeId(58);
         ObjectAttributes attrs;
         attrs.Description = LocalizedText("The default XML encoding for a data type.");
         attrs.DisplayName = LocalizedText("Default XML");
@@ -49,7 +49,7 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=24");
+        node.RequestedNewNodeId = NumericNodeId(24);
         node.BrowseName = ToQualifiedName("BaseDataType");
         node.Class = NodeClass::DataType;
         DataTypeAttributes attrs;
@@ -62,10 +62,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=26");
+        node.RequestedNewNodeId = NumericNodeId(26);
         node.BrowseName = ToQualifiedName("Number");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that can have any numeric DataType.");
@@ -77,10 +77,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=27");
+        node.RequestedNewNodeId = NumericNodeId(27);
         node.BrowseName = ToQualifiedName("Integer");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=26");
+        node.ParentNodeId = NumericNodeId(26);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that can have any integer DataType.");
@@ -92,10 +92,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=28");
+        node.RequestedNewNodeId = NumericNodeId(28);
         node.BrowseName = ToQualifiedName("UInteger");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=27");
+        node.ParentNodeId = NumericNodeId(27);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that can have any unsigned integer DataType.");
@@ -107,10 +107,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=29");
+        node.RequestedNewNodeId = NumericNodeId(29);
         node.BrowseName = ToQualifiedName("Enumeration");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an enumerated DataType.");
@@ -122,10 +122,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=1");
+        node.RequestedNewNodeId = NumericNodeId(1);
         node.BrowseName = ToQualifiedName("Boolean");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is either TRUE or FALSE.");
@@ -137,10 +137,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2");
+        node.RequestedNewNodeId = NumericNodeId(2);
         node.BrowseName = ToQualifiedName("SByte");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=27");
+        node.ParentNodeId = NumericNodeId(27);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between -128 and 127.");
@@ -152,10 +152,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3");
+        node.RequestedNewNodeId = NumericNodeId(3);
         node.BrowseName = ToQualifiedName("Byte");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=28");
+        node.ParentNodeId = NumericNodeId(28);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between 0 and 255.");
@@ -167,10 +167,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=4");
+        node.RequestedNewNodeId = NumericNodeId(4);
         node.BrowseName = ToQualifiedName("Int16");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=27");
+        node.ParentNodeId = NumericNodeId(27);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between −32,768 and 32,767.");
@@ -182,10 +182,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=5");
+        node.RequestedNewNodeId = NumericNodeId(5);
         node.BrowseName = ToQualifiedName("UInt16");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=28");
+        node.ParentNodeId = NumericNodeId(28);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between 0 and 65535.");
@@ -197,10 +197,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=6");
+        node.RequestedNewNodeId = NumericNodeId(6);
         node.BrowseName = ToQualifiedName("Int32");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=27");
+        node.ParentNodeId = NumericNodeId(27);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between −2,147,483,648  and 2,147,483,647.");
@@ -212,10 +212,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7");
+        node.RequestedNewNodeId = NumericNodeId(7);
         node.BrowseName = ToQualifiedName("UInt32");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=28");
+        node.ParentNodeId = NumericNodeId(28);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between 0 and 4,294,967,295.");
@@ -227,10 +227,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8");
+        node.RequestedNewNodeId = NumericNodeId(8);
         node.BrowseName = ToQualifiedName("Int64");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=27");
+        node.ParentNodeId = NumericNodeId(27);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between −9,223,372,036,854,775,808 and 9,223,372,036,854,775,807.");
@@ -242,10 +242,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9");
+        node.RequestedNewNodeId = NumericNodeId(9);
         node.BrowseName = ToQualifiedName("UInt64");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=28");
+        node.ParentNodeId = NumericNodeId(28);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an integer between 0 and 18,446,744,073,709,551,615.");
@@ -257,10 +257,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10");
+        node.RequestedNewNodeId = NumericNodeId(10);
         node.BrowseName = ToQualifiedName("Float");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=26");
+        node.ParentNodeId = NumericNodeId(26);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an IEEE 754-1985 single precision floating point number.");
@@ -272,10 +272,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11");
+        node.RequestedNewNodeId = NumericNodeId(11);
         node.BrowseName = ToQualifiedName("Double");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=26");
+        node.ParentNodeId = NumericNodeId(26);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an IEEE 754-1985 double precision floating point number.");
@@ -287,10 +287,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12");
+        node.RequestedNewNodeId = NumericNodeId(12);
         node.BrowseName = ToQualifiedName("String");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a sequence of printable Unicode characters.");
@@ -302,10 +302,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=13");
+        node.RequestedNewNodeId = NumericNodeId(13);
         node.BrowseName = ToQualifiedName("DateTime");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a Gregorian calender date and time.");
@@ -317,10 +317,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=14");
+        node.RequestedNewNodeId = NumericNodeId(14);
         node.BrowseName = ToQualifiedName("Guid");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a 128-bit globally unique identifier.");
@@ -332,10 +332,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=15");
+        node.RequestedNewNodeId = NumericNodeId(15);
         node.BrowseName = ToQualifiedName("ByteString");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a sequence of bytes.");
@@ -347,10 +347,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=16");
+        node.RequestedNewNodeId = NumericNodeId(16);
         node.BrowseName = ToQualifiedName("XmlElement");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an XML element.");
@@ -362,10 +362,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=17");
+        node.RequestedNewNodeId = NumericNodeId(17);
         node.BrowseName = ToQualifiedName("NodeId");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an identifier for a node within a Server address space.");
@@ -377,10 +377,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=20");
+        node.RequestedNewNodeId = NumericNodeId(20);
         node.BrowseName = ToQualifiedName("QualifiedName");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a name qualified by a namespace.");
@@ -392,10 +392,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=21");
+        node.RequestedNewNodeId = NumericNodeId(21);
         node.BrowseName = ToQualifiedName("LocalizedText");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is human readable Unicode text with a locale identifier.");
@@ -407,10 +407,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=22");
+        node.RequestedNewNodeId = NumericNodeId(22);
         node.BrowseName = ToQualifiedName("Structure");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is any type of structure that can be described with a data encoding.");
@@ -422,10 +422,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=30");
+        node.RequestedNewNodeId = NumericNodeId(30);
         node.BrowseName = ToQualifiedName("Image");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=15");
+        node.ParentNodeId = NumericNodeId(15);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an image encoded as a string of bytes.");
@@ -437,7 +437,7 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=31");
+        node.RequestedNewNodeId = NumericNodeId(31);
         node.BrowseName = ToQualifiedName("References");
         node.Class = NodeClass::ReferenceType;
         ReferenceTypeAttributes attrs;
@@ -452,10 +452,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=32");
+        node.RequestedNewNodeId = NumericNodeId(32);
         node.BrowseName = ToQualifiedName("NonHierarchicalReferences");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=31");
+        node.ParentNodeId = NumericNodeId(31);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The abstract base type for all non-hierarchical references.");
@@ -469,10 +469,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=33");
+        node.RequestedNewNodeId = NumericNodeId(33);
         node.BrowseName = ToQualifiedName("HierarchicalReferences");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=31");
+        node.ParentNodeId = NumericNodeId(31);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The abstract base type for all hierarchical references.");
@@ -486,10 +486,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=34");
+        node.RequestedNewNodeId = NumericNodeId(34);
         node.BrowseName = ToQualifiedName("HasChild");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=33");
+        node.ParentNodeId = NumericNodeId(33);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The abstract base type for all non-looping hierarchical references.");
@@ -503,10 +503,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=35");
+        node.RequestedNewNodeId = NumericNodeId(35);
         node.BrowseName = ToQualifiedName("Organizes");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=33");
+        node.ParentNodeId = NumericNodeId(33);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for hierarchical references that are used to organize nodes.");
@@ -520,10 +520,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=36");
+        node.RequestedNewNodeId = NumericNodeId(36);
         node.BrowseName = ToQualifiedName("HasEventSource");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=33");
+        node.ParentNodeId = NumericNodeId(33);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for non-looping hierarchical references that are used to organize event sources.");
@@ -537,10 +537,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=37");
+        node.RequestedNewNodeId = NumericNodeId(37);
         node.BrowseName = ToQualifiedName("HasModellingRule");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for references from instance declarations to modelling rule nodes.");
@@ -554,10 +554,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=38");
+        node.RequestedNewNodeId = NumericNodeId(38);
         node.BrowseName = ToQualifiedName("HasEncoding");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for references from data type nodes to to data type encoding nodes.");
@@ -571,10 +571,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=39");
+        node.RequestedNewNodeId = NumericNodeId(39);
         node.BrowseName = ToQualifiedName("HasDescription");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for references from data type encoding nodes to data type description nodes.");
@@ -588,10 +588,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=40");
+        node.RequestedNewNodeId = NumericNodeId(40);
         node.BrowseName = ToQualifiedName("HasTypeDefinition");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for references from a instance node its type defintion node.");
@@ -605,10 +605,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=41");
+        node.RequestedNewNodeId = NumericNodeId(41);
         node.BrowseName = ToQualifiedName("GeneratesEvent");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for references from a node to an event type that is raised by node.");
@@ -622,10 +622,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3065");
+        node.RequestedNewNodeId = NumericNodeId(3065);
         node.BrowseName = ToQualifiedName("AlwaysGeneratesEvent");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for references from a node to an event type that is always raised by node.");
@@ -639,10 +639,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=44");
+        node.RequestedNewNodeId = NumericNodeId(44);
         node.BrowseName = ToQualifiedName("Aggregates");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=34");
+        node.ParentNodeId = NumericNodeId(34);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for non-looping hierarchical references that are used to aggregate nodes into complex types.");
@@ -656,10 +656,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=45");
+        node.RequestedNewNodeId = NumericNodeId(45);
         node.BrowseName = ToQualifiedName("HasSubtype");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=34");
+        node.ParentNodeId = NumericNodeId(34);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for non-looping hierarchical references that are used to define sub types.");
@@ -673,10 +673,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=46");
+        node.RequestedNewNodeId = NumericNodeId(46);
         node.BrowseName = ToQualifiedName("HasProperty");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=44");
+        node.ParentNodeId = NumericNodeId(44);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for non-looping hierarchical reference from a node to its property.");
@@ -690,10 +690,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=47");
+        node.RequestedNewNodeId = NumericNodeId(47);
         node.BrowseName = ToQualifiedName("HasComponent");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=44");
+        node.ParentNodeId = NumericNodeId(44);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for non-looping hierarchical reference from a node to its component.");
@@ -707,10 +707,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=48");
+        node.RequestedNewNodeId = NumericNodeId(48);
         node.BrowseName = ToQualifiedName("HasNotifier");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=36");
+        node.ParentNodeId = NumericNodeId(36);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for non-looping hierarchical references that are used to indicate how events propagate from node to node.");
@@ -724,10 +724,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=49");
+        node.RequestedNewNodeId = NumericNodeId(49);
         node.BrowseName = ToQualifiedName("HasOrderedComponent");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=47");
+        node.ParentNodeId = NumericNodeId(47);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.Description = LocalizedText("The type for non-looping hierarchical reference from a node to its component when the order of references matters.");
@@ -741,10 +741,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=120");
+        node.RequestedNewNodeId = NumericNodeId(120);
         node.BrowseName = ToQualifiedName("NamingRuleType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that specifies the significance of the BrowseName for an instance declaration.");
@@ -757,9 +757,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=120");
+        ref.SourceNodeId = NumericNodeId(120);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12169");
+        ref.TargetNodeId = NumericNodeId(12169);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -767,15 +767,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12169");
+        node.RequestedNewNodeId = NumericNodeId(12169);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=120");
+        node.ParentNodeId = NumericNodeId(120);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -784,9 +784,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12169");
+        ref.SourceNodeId = NumericNodeId(12169);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -794,10 +794,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3068");
+        node.RequestedNewNodeId = NumericNodeId(3068);
         node.BrowseName = ToQualifiedName("NodeVersion");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The version number of the node (used to indicate changes to references of the owning node).");
         attrs.DisplayName = LocalizedText("NodeVersion");
@@ -809,10 +809,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12170");
+        node.RequestedNewNodeId = NumericNodeId(12170);
         node.BrowseName = ToQualifiedName("ViewVersion");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The version number of the view.");
         attrs.DisplayName = LocalizedText("ViewVersion");
@@ -824,14 +824,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3067");
+        node.RequestedNewNodeId = NumericNodeId(3067);
         node.BrowseName = ToQualifiedName("Icon");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("A small image representing the object.");
         attrs.DisplayName = LocalizedText("Icon");
-        attrs.Type = ToNodeId("i=30");
+        attrs.Type = NumericNodeId(30);
         attrs.Rank = -2;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -839,14 +839,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3069");
+        node.RequestedNewNodeId = NumericNodeId(3069);
         node.BrowseName = ToQualifiedName("LocalTime");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The local time where the owning variable value was collected.");
         attrs.DisplayName = LocalizedText("LocalTime");
-        attrs.Type = ToNodeId("i=8912");
+        attrs.Type = NumericNodeId(8912);
         attrs.Rank = -2;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -854,10 +854,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3070");
+        node.RequestedNewNodeId = NumericNodeId(3070);
         node.BrowseName = ToQualifiedName("AllowNulls");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("Whether the value of the owning variable is allowed to be null.");
         attrs.DisplayName = LocalizedText("AllowNulls");
@@ -869,10 +869,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11433");
+        node.RequestedNewNodeId = NumericNodeId(11433);
         node.BrowseName = ToQualifiedName("ValueAsText");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The string representation of the current value for a variable with an enumerated data type.");
         attrs.DisplayName = LocalizedText("ValueAsText");
@@ -884,10 +884,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11498");
+        node.RequestedNewNodeId = NumericNodeId(11498);
         node.BrowseName = ToQualifiedName("MaxStringLength");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The maximum length for a string that can be stored in the owning variable.");
         attrs.DisplayName = LocalizedText("MaxStringLength");
@@ -899,10 +899,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11512");
+        node.RequestedNewNodeId = NumericNodeId(11512);
         node.BrowseName = ToQualifiedName("MaxArrayLength");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The maximum length for an array that can be stored in the owning variable.");
         attrs.DisplayName = LocalizedText("MaxArrayLength");
@@ -914,14 +914,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11513");
+        node.RequestedNewNodeId = NumericNodeId(11513);
         node.BrowseName = ToQualifiedName("EngineeringUnits");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The engineering units for the value of the owning variable.");
         attrs.DisplayName = LocalizedText("EngineeringUnits");
-        attrs.Type = ToNodeId("i=887");
+        attrs.Type = NumericNodeId(887);
         attrs.Rank = -2;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -929,10 +929,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11432");
+        node.RequestedNewNodeId = NumericNodeId(11432);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The human readable strings associated with the values of an enumerated value (when values are sequential).");
         attrs.DisplayName = LocalizedText("EnumStrings");
@@ -944,14 +944,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3071");
+        node.RequestedNewNodeId = NumericNodeId(3071);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The human readable strings associated with the values of an enumerated value (when values have no sequence).");
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -959,14 +959,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3072");
+        node.RequestedNewNodeId = NumericNodeId(3072);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The input arguments for a method.");
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -974,14 +974,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3073");
+        node.RequestedNewNodeId = NumericNodeId(3073);
         node.BrowseName = ToQualifiedName("OutputArguments");
         node.Class = NodeClass::Variable;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The output arguments for a method.");
         attrs.DisplayName = LocalizedText("OutputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -989,10 +989,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2000");
+        node.RequestedNewNodeId = NumericNodeId(2000);
         node.BrowseName = ToQualifiedName("ImageBMP");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=30");
+        node.ParentNodeId = NumericNodeId(30);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("An image encoded in BMP format.");
@@ -1004,10 +1004,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2001");
+        node.RequestedNewNodeId = NumericNodeId(2001);
         node.BrowseName = ToQualifiedName("ImageGIF");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=30");
+        node.ParentNodeId = NumericNodeId(30);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("An image encoded in GIF format.");
@@ -1019,10 +1019,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2002");
+        node.RequestedNewNodeId = NumericNodeId(2002);
         node.BrowseName = ToQualifiedName("ImageJPG");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=30");
+        node.ParentNodeId = NumericNodeId(30);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("An image encoded in JPEG format.");
@@ -1034,10 +1034,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2003");
+        node.RequestedNewNodeId = NumericNodeId(2003);
         node.BrowseName = ToQualifiedName("ImagePNG");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=30");
+        node.ParentNodeId = NumericNodeId(30);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("An image encoded in PNG format.");
@@ -1049,10 +1049,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=256");
+        node.RequestedNewNodeId = NumericNodeId(256);
         node.BrowseName = ToQualifiedName("IdType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("The type of identifier used in a node id.");
@@ -1065,9 +1065,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=256");
+        ref.SourceNodeId = NumericNodeId(256);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7591");
+        ref.TargetNodeId = NumericNodeId(7591);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1075,12 +1075,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7591");
+        node.RequestedNewNodeId = NumericNodeId(7591);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=256");
+        node.ParentNodeId = NumericNodeId(256);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -1092,9 +1092,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7591");
+        ref.SourceNodeId = NumericNodeId(7591);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1102,10 +1102,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=257");
+        node.RequestedNewNodeId = NumericNodeId(257);
         node.BrowseName = ToQualifiedName("NodeClass");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A mask specifying the class of the node.");
@@ -1118,9 +1118,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=257");
+        ref.SourceNodeId = NumericNodeId(257);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11878");
+        ref.TargetNodeId = NumericNodeId(11878);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1128,15 +1128,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11878");
+        node.RequestedNewNodeId = NumericNodeId(11878);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=257");
+        node.ParentNodeId = NumericNodeId(257);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1145,9 +1145,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11878");
+        ref.SourceNodeId = NumericNodeId(11878);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1155,10 +1155,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=296");
+        node.RequestedNewNodeId = NumericNodeId(296);
         node.BrowseName = ToQualifiedName("Argument");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("An argument for a method.");
@@ -1170,10 +1170,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7594");
+        node.RequestedNewNodeId = NumericNodeId(7594);
         node.BrowseName = ToQualifiedName("EnumValueType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A mapping between a value of an enumerated type and a name and description.");
@@ -1185,10 +1185,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=290");
+        node.RequestedNewNodeId = NumericNodeId(290);
         node.BrowseName = ToQualifiedName("Duration");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=11");
+        node.ParentNodeId = NumericNodeId(11);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A period of time measured in seconds.");
@@ -1200,10 +1200,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=294");
+        node.RequestedNewNodeId = NumericNodeId(294);
         node.BrowseName = ToQualifiedName("UtcTime");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=13");
+        node.ParentNodeId = NumericNodeId(13);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A date/time value specified in Universal Coordinated Time (UTC).");
@@ -1215,10 +1215,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=295");
+        node.RequestedNewNodeId = NumericNodeId(295);
         node.BrowseName = ToQualifiedName("LocaleId");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=12");
+        node.ParentNodeId = NumericNodeId(12);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("An identifier for a user locale.");
@@ -1230,10 +1230,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8912");
+        node.RequestedNewNodeId = NumericNodeId(8912);
         node.BrowseName = ToQualifiedName("TimeZoneDataType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("TimeZoneDataType");
@@ -1244,12 +1244,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=297");
+        node.RequestedNewNodeId = NumericNodeId(297);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=296");
+        node.ParentNodeId = NumericNodeId(296);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1260,9 +1260,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=297");
+        ref.SourceNodeId = NumericNodeId(297);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8285");
+        ref.TargetNodeId = NumericNodeId(8285);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1270,12 +1270,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7616");
+        node.RequestedNewNodeId = NumericNodeId(7616);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=7594");
+        node.ParentNodeId = NumericNodeId(7594);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1286,9 +1286,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=7616");
+        ref.SourceNodeId = NumericNodeId(7616);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8291");
+        ref.TargetNodeId = NumericNodeId(8291);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1296,12 +1296,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8913");
+        node.RequestedNewNodeId = NumericNodeId(8913);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=8912");
+        node.ParentNodeId = NumericNodeId(8912);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1312,9 +1312,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=8913");
+        ref.SourceNodeId = NumericNodeId(8913);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8918");
+        ref.TargetNodeId = NumericNodeId(8918);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1322,12 +1322,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=298");
+        node.RequestedNewNodeId = NumericNodeId(298);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=296");
+        node.ParentNodeId = NumericNodeId(296);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1338,9 +1338,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=298");
+        ref.SourceNodeId = NumericNodeId(298);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7650");
+        ref.TargetNodeId = NumericNodeId(7650);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1348,12 +1348,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8251");
+        node.RequestedNewNodeId = NumericNodeId(8251);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=7594");
+        node.ParentNodeId = NumericNodeId(7594);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1364,9 +1364,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=8251");
+        ref.SourceNodeId = NumericNodeId(8251);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7656");
+        ref.TargetNodeId = NumericNodeId(7656);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1374,12 +1374,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8917");
+        node.RequestedNewNodeId = NumericNodeId(8917);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=8912");
+        node.ParentNodeId = NumericNodeId(8912);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1390,9 +1390,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=8917");
+        ref.SourceNodeId = NumericNodeId(8917);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8914");
+        ref.TargetNodeId = NumericNodeId(8914);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -21,10 +21,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=18");
+        node.RequestedNewNodeId = NumericNodeId(18);
         node.BrowseName = ToQualifiedName("ExpandedNodeId");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is an absolute identifier for a node.");
@@ -36,10 +36,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=19");
+        node.RequestedNewNodeId = NumericNodeId(19);
         node.BrowseName = ToQualifiedName("StatusCode");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a code representing the outcome of an operation by a Server.");
@@ -51,10 +51,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=23");
+        node.RequestedNewNodeId = NumericNodeId(23);
         node.BrowseName = ToQualifiedName("DataValue");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a structure containing a value, a status code and timestamps.");
@@ -66,10 +66,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=25");
+        node.RequestedNewNodeId = NumericNodeId(25);
         node.BrowseName = ToQualifiedName("DiagnosticInfo");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=24");
+        node.ParentNodeId = NumericNodeId(24);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a value that is a structure containing diagnostics associated with a StatusCode.");
@@ -81,10 +81,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=288");
+        node.RequestedNewNodeId = NumericNodeId(288);
         node.BrowseName = ToQualifiedName("IntegerId");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=7");
+        node.ParentNodeId = NumericNodeId(7);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A numeric identifier for an object.");
@@ -96,10 +96,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=307");
+        node.RequestedNewNodeId = NumericNodeId(307);
         node.BrowseName = ToQualifiedName("ApplicationType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("The types of applications.");
@@ -112,9 +112,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=307");
+        ref.SourceNodeId = NumericNodeId(307);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7597");
+        ref.TargetNodeId = NumericNodeId(7597);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -122,12 +122,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7597");
+        node.RequestedNewNodeId = NumericNodeId(7597);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=307");
+        node.ParentNodeId = NumericNodeId(307);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -139,9 +139,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7597");
+        ref.SourceNodeId = NumericNodeId(7597);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -149,10 +149,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=308");
+        node.RequestedNewNodeId = NumericNodeId(308);
         node.BrowseName = ToQualifiedName("ApplicationDescription");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes an application and how to find it.");
@@ -164,10 +164,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=311");
+        node.RequestedNewNodeId = NumericNodeId(311);
         node.BrowseName = ToQualifiedName("ApplicationInstanceCertificate");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=15");
+        node.ParentNodeId = NumericNodeId(15);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A certificate for an instance of an application.");
@@ -179,10 +179,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=302");
+        node.RequestedNewNodeId = NumericNodeId(302);
         node.BrowseName = ToQualifiedName("MessageSecurityMode");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("The type of security to use on a message.");
@@ -195,9 +195,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=302");
+        ref.SourceNodeId = NumericNodeId(302);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7595");
+        ref.TargetNodeId = NumericNodeId(7595);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -205,12 +205,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7595");
+        node.RequestedNewNodeId = NumericNodeId(7595);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=302");
+        node.ParentNodeId = NumericNodeId(302);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -222,9 +222,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7595");
+        ref.SourceNodeId = NumericNodeId(7595);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -232,10 +232,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=303");
+        node.RequestedNewNodeId = NumericNodeId(303);
         node.BrowseName = ToQualifiedName("UserTokenType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("The possible user token types.");
@@ -248,9 +248,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=303");
+        ref.SourceNodeId = NumericNodeId(303);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7596");
+        ref.TargetNodeId = NumericNodeId(7596);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -258,12 +258,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7596");
+        node.RequestedNewNodeId = NumericNodeId(7596);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=303");
+        node.ParentNodeId = NumericNodeId(303);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -275,9 +275,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7596");
+        ref.SourceNodeId = NumericNodeId(7596);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -285,10 +285,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=304");
+        node.RequestedNewNodeId = NumericNodeId(304);
         node.BrowseName = ToQualifiedName("UserTokenPolicy");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Describes a user token that can be used with a server.");
@@ -300,10 +300,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=312");
+        node.RequestedNewNodeId = NumericNodeId(312);
         node.BrowseName = ToQualifiedName("EndpointDescription");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("The description of a endpoint that can be used to access a server.");
@@ -315,10 +315,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=432");
+        node.RequestedNewNodeId = NumericNodeId(432);
         node.BrowseName = ToQualifiedName("RegisteredServer");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("The information required to register a server with a discovery server.");
@@ -330,10 +330,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=315");
+        node.RequestedNewNodeId = NumericNodeId(315);
         node.BrowseName = ToQualifiedName("SecurityTokenRequestType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Indicates whether a token if being created or renewed.");
@@ -346,9 +346,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=315");
+        ref.SourceNodeId = NumericNodeId(315);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7598");
+        ref.TargetNodeId = NumericNodeId(7598);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -356,12 +356,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7598");
+        node.RequestedNewNodeId = NumericNodeId(7598);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=315");
+        node.ParentNodeId = NumericNodeId(315);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -373,9 +373,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7598");
+        ref.SourceNodeId = NumericNodeId(7598);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -383,10 +383,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=344");
+        node.RequestedNewNodeId = NumericNodeId(344);
         node.BrowseName = ToQualifiedName("SignedSoftwareCertificate");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A software certificate with a digital signature.");
@@ -398,10 +398,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=388");
+        node.RequestedNewNodeId = NumericNodeId(388);
         node.BrowseName = ToQualifiedName("SessionAuthenticationToken");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=17");
+        node.ParentNodeId = NumericNodeId(17);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A unique identifier for a session used to authenticate requests.");
@@ -413,10 +413,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=316");
+        node.RequestedNewNodeId = NumericNodeId(316);
         node.BrowseName = ToQualifiedName("UserIdentityToken");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A base type for a user identity token.");
@@ -428,10 +428,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=319");
+        node.RequestedNewNodeId = NumericNodeId(319);
         node.BrowseName = ToQualifiedName("AnonymousIdentityToken");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=316");
+        node.ParentNodeId = NumericNodeId(316);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A token representing an anonymous user.");
@@ -443,10 +443,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=322");
+        node.RequestedNewNodeId = NumericNodeId(322);
         node.BrowseName = ToQualifiedName("UserNameIdentityToken");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=316");
+        node.ParentNodeId = NumericNodeId(316);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A token representing a user identified by a user name and password.");
@@ -458,10 +458,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=325");
+        node.RequestedNewNodeId = NumericNodeId(325);
         node.BrowseName = ToQualifiedName("X509IdentityToken");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=316");
+        node.ParentNodeId = NumericNodeId(316);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A token representing a user identified by an X509 certificate.");
@@ -473,10 +473,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=938");
+        node.RequestedNewNodeId = NumericNodeId(938);
         node.BrowseName = ToQualifiedName("IssuedIdentityToken");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=316");
+        node.ParentNodeId = NumericNodeId(316);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A token representing a user identified by a WS-Security XML token.");
@@ -488,10 +488,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=348");
+        node.RequestedNewNodeId = NumericNodeId(348);
         node.BrowseName = ToQualifiedName("NodeAttributesMask");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("The bits used to specify default attributes for a new node.");
@@ -504,9 +504,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=348");
+        ref.SourceNodeId = NumericNodeId(348);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11881");
+        ref.TargetNodeId = NumericNodeId(11881);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -514,15 +514,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11881");
+        node.RequestedNewNodeId = NumericNodeId(11881);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=348");
+        node.ParentNodeId = NumericNodeId(348);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -531,9 +531,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11881");
+        ref.SourceNodeId = NumericNodeId(11881);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -541,10 +541,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=376");
+        node.RequestedNewNodeId = NumericNodeId(376);
         node.BrowseName = ToQualifiedName("AddNodesItem");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A request to add a node to the server address space.");
@@ -556,10 +556,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=379");
+        node.RequestedNewNodeId = NumericNodeId(379);
         node.BrowseName = ToQualifiedName("AddReferencesItem");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A request to add a reference to the server address space.");
@@ -571,10 +571,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=382");
+        node.RequestedNewNodeId = NumericNodeId(382);
         node.BrowseName = ToQualifiedName("DeleteNodesItem");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A request to delete a node to the server address space.");
@@ -586,10 +586,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=385");
+        node.RequestedNewNodeId = NumericNodeId(385);
         node.BrowseName = ToQualifiedName("DeleteReferencesItem");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A request to delete a node from the server address space.");
@@ -601,10 +601,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=347");
+        node.RequestedNewNodeId = NumericNodeId(347);
         node.BrowseName = ToQualifiedName("AttributeWriteMask");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Define bits used to indicate which attributes are writeable.");
@@ -617,9 +617,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=347");
+        ref.SourceNodeId = NumericNodeId(347);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11882");
+        ref.TargetNodeId = NumericNodeId(11882);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -627,15 +627,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11882");
+        node.RequestedNewNodeId = NumericNodeId(11882);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=347");
+        node.ParentNodeId = NumericNodeId(347);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -644,9 +644,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11882");
+        ref.SourceNodeId = NumericNodeId(11882);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -654,10 +654,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=521");
+        node.RequestedNewNodeId = NumericNodeId(521);
         node.BrowseName = ToQualifiedName("ContinuationPoint");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=15");
+        node.ParentNodeId = NumericNodeId(15);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("An identifier for a suspended query or browse operation.");
@@ -669,10 +669,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=289");
+        node.RequestedNewNodeId = NumericNodeId(289);
         node.BrowseName = ToQualifiedName("Counter");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=7");
+        node.ParentNodeId = NumericNodeId(7);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A monotonically increasing value.");
@@ -684,10 +684,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=291");
+        node.RequestedNewNodeId = NumericNodeId(291);
         node.BrowseName = ToQualifiedName("NumericRange");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=12");
+        node.ParentNodeId = NumericNodeId(12);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("Specifies a range of array indexes.");
@@ -699,10 +699,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=292");
+        node.RequestedNewNodeId = NumericNodeId(292);
         node.BrowseName = ToQualifiedName("Time");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=12");
+        node.ParentNodeId = NumericNodeId(12);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A time value specified as HH:MM:SS.SSS.");
@@ -714,10 +714,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=293");
+        node.RequestedNewNodeId = NumericNodeId(293);
         node.BrowseName = ToQualifiedName("Date");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=13");
+        node.ParentNodeId = NumericNodeId(13);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.Description = LocalizedText("A date value.");
@@ -729,10 +729,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=331");
+        node.RequestedNewNodeId = NumericNodeId(331);
         node.BrowseName = ToQualifiedName("EndpointConfiguration");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("EndpointConfiguration");
@@ -743,10 +743,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=334");
+        node.RequestedNewNodeId = NumericNodeId(334);
         node.BrowseName = ToQualifiedName("ComplianceLevel");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ComplianceLevel");
@@ -758,9 +758,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=334");
+        ref.SourceNodeId = NumericNodeId(334);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7599");
+        ref.TargetNodeId = NumericNodeId(7599);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -768,12 +768,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7599");
+        node.RequestedNewNodeId = NumericNodeId(7599);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=334");
+        node.ParentNodeId = NumericNodeId(334);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -785,9 +785,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7599");
+        ref.SourceNodeId = NumericNodeId(7599);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -795,10 +795,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=335");
+        node.RequestedNewNodeId = NumericNodeId(335);
         node.BrowseName = ToQualifiedName("SupportedProfile");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("SupportedProfile");
@@ -809,10 +809,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=341");
+        node.RequestedNewNodeId = NumericNodeId(341);
         node.BrowseName = ToQualifiedName("SoftwareCertificate");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("SoftwareCertificate");
@@ -823,10 +823,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=576");
+        node.RequestedNewNodeId = NumericNodeId(576);
         node.BrowseName = ToQualifiedName("FilterOperator");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("FilterOperator");
@@ -838,9 +838,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=576");
+        ref.SourceNodeId = NumericNodeId(576);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7605");
+        ref.TargetNodeId = NumericNodeId(7605);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -848,12 +848,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=7605");
+        node.RequestedNewNodeId = NumericNodeId(7605);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=576");
+        node.ParentNodeId = NumericNodeId(576);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -865,9 +865,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=7605");
+        ref.SourceNodeId = NumericNodeId(7605);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -875,10 +875,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=583");
+        node.RequestedNewNodeId = NumericNodeId(583);
         node.BrowseName = ToQualifiedName("ContentFilterElement");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ContentFilterElement");
@@ -889,10 +889,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=586");
+        node.RequestedNewNodeId = NumericNodeId(586);
         node.BrowseName = ToQualifiedName("ContentFilter");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ContentFilter");
@@ -903,10 +903,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=589");
+        node.RequestedNewNodeId = NumericNodeId(589);
         node.BrowseName = ToQualifiedName("FilterOperand");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("FilterOperand");
@@ -917,10 +917,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=592");
+        node.RequestedNewNodeId = NumericNodeId(592);
         node.BrowseName = ToQualifiedName("ElementOperand");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=589");
+        node.ParentNodeId = NumericNodeId(589);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ElementOperand");
@@ -931,10 +931,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=595");
+        node.RequestedNewNodeId = NumericNodeId(595);
         node.BrowseName = ToQualifiedName("LiteralOperand");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=589");
+        node.ParentNodeId = NumericNodeId(589);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("LiteralOperand");
@@ -945,10 +945,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=598");
+        node.RequestedNewNodeId = NumericNodeId(598);
         node.BrowseName = ToQualifiedName("AttributeOperand");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=589");
+        node.ParentNodeId = NumericNodeId(589);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AttributeOperand");
@@ -959,10 +959,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=601");
+        node.RequestedNewNodeId = NumericNodeId(601);
         node.BrowseName = ToQualifiedName("SimpleAttributeOperand");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=589");
+        node.ParentNodeId = NumericNodeId(589);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("SimpleAttributeOperand");
@@ -973,10 +973,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=659");
+        node.RequestedNewNodeId = NumericNodeId(659);
         node.BrowseName = ToQualifiedName("HistoryEvent");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HistoryEvent");
@@ -987,10 +987,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11234");
+        node.RequestedNewNodeId = NumericNodeId(11234);
         node.BrowseName = ToQualifiedName("HistoryUpdateType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HistoryUpdateType");
@@ -1002,9 +1002,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11234");
+        ref.SourceNodeId = NumericNodeId(11234);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11884");
+        ref.TargetNodeId = NumericNodeId(11884);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1012,15 +1012,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11884");
+        node.RequestedNewNodeId = NumericNodeId(11884);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11234");
+        node.ParentNodeId = NumericNodeId(11234);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1029,9 +1029,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11884");
+        ref.SourceNodeId = NumericNodeId(11884);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1039,10 +1039,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11293");
+        node.RequestedNewNodeId = NumericNodeId(11293);
         node.BrowseName = ToQualifiedName("PerformUpdateType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("PerformUpdateType");
@@ -1054,9 +1054,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11293");
+        ref.SourceNodeId = NumericNodeId(11293);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11885");
+        ref.TargetNodeId = NumericNodeId(11885);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1064,15 +1064,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11885");
+        node.RequestedNewNodeId = NumericNodeId(11885);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11293");
+        node.ParentNodeId = NumericNodeId(11293);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1081,9 +1081,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11885");
+        ref.SourceNodeId = NumericNodeId(11885);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1091,10 +1091,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=719");
+        node.RequestedNewNodeId = NumericNodeId(719);
         node.BrowseName = ToQualifiedName("MonitoringFilter");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("MonitoringFilter");
@@ -1105,10 +1105,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=725");
+        node.RequestedNewNodeId = NumericNodeId(725);
         node.BrowseName = ToQualifiedName("EventFilter");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=719");
+        node.ParentNodeId = NumericNodeId(719);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("EventFilter");
@@ -1119,10 +1119,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=948");
+        node.RequestedNewNodeId = NumericNodeId(948);
         node.BrowseName = ToQualifiedName("AggregateConfiguration");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AggregateConfiguration");
@@ -1133,10 +1133,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=920");
+        node.RequestedNewNodeId = NumericNodeId(920);
         node.BrowseName = ToQualifiedName("HistoryEventFieldList");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HistoryEventFieldList");
@@ -1147,12 +1147,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=309");
+        node.RequestedNewNodeId = NumericNodeId(309);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=308");
+        node.ParentNodeId = NumericNodeId(308);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1163,9 +1163,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=309");
+        ref.SourceNodeId = NumericNodeId(309);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8300");
+        ref.TargetNodeId = NumericNodeId(8300);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1173,12 +1173,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=305");
+        node.RequestedNewNodeId = NumericNodeId(305);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=304");
+        node.ParentNodeId = NumericNodeId(304);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1189,9 +1189,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=305");
+        ref.SourceNodeId = NumericNodeId(305);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8297");
+        ref.TargetNodeId = NumericNodeId(8297);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1199,12 +1199,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=313");
+        node.RequestedNewNodeId = NumericNodeId(313);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=312");
+        node.ParentNodeId = NumericNodeId(312);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1215,9 +1215,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=313");
+        ref.SourceNodeId = NumericNodeId(313);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8303");
+        ref.TargetNodeId = NumericNodeId(8303);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1225,12 +1225,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=433");
+        node.RequestedNewNodeId = NumericNodeId(433);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=432");
+        node.ParentNodeId = NumericNodeId(432);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1241,9 +1241,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=433");
+        ref.SourceNodeId = NumericNodeId(433);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8417");
+        ref.TargetNodeId = NumericNodeId(8417);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1251,12 +1251,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=345");
+        node.RequestedNewNodeId = NumericNodeId(345);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=344");
+        node.ParentNodeId = NumericNodeId(344);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1267,9 +1267,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=345");
+        ref.SourceNodeId = NumericNodeId(345);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8333");
+        ref.TargetNodeId = NumericNodeId(8333);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1277,12 +1277,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=317");
+        node.RequestedNewNodeId = NumericNodeId(317);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=316");
+        node.ParentNodeId = NumericNodeId(316);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1293,9 +1293,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=317");
+        ref.SourceNodeId = NumericNodeId(317);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8306");
+        ref.TargetNodeId = NumericNodeId(8306);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1303,12 +1303,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=320");
+        node.RequestedNewNodeId = NumericNodeId(320);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=319");
+        node.ParentNodeId = NumericNodeId(319);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1319,9 +1319,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=320");
+        ref.SourceNodeId = NumericNodeId(320);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8309");
+        ref.TargetNodeId = NumericNodeId(8309);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1329,12 +1329,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=323");
+        node.RequestedNewNodeId = NumericNodeId(323);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=322");
+        node.ParentNodeId = NumericNodeId(322);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1345,9 +1345,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=323");
+        ref.SourceNodeId = NumericNodeId(323);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8312");
+        ref.TargetNodeId = NumericNodeId(8312);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1355,12 +1355,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=326");
+        node.RequestedNewNodeId = NumericNodeId(326);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=325");
+        node.ParentNodeId = NumericNodeId(325);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1371,9 +1371,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=326");
+        ref.SourceNodeId = NumericNodeId(326);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8315");
+        ref.TargetNodeId = NumericNodeId(8315);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1381,12 +1381,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=939");
+        node.RequestedNewNodeId = NumericNodeId(939);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=938");
+        node.ParentNodeId = NumericNodeId(938);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1397,9 +1397,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=939");
+        ref.SourceNodeId = NumericNodeId(939);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8318");
+        ref.TargetNodeId = NumericNodeId(8318);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1407,12 +1407,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=377");
+        node.RequestedNewNodeId = NumericNodeId(377);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=376");
+        node.ParentNodeId = NumericNodeId(376);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1423,9 +1423,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=377");
+        ref.SourceNodeId = NumericNodeId(377);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8363");
+        ref.TargetNodeId = NumericNodeId(8363);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1433,12 +1433,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=380");
+        node.RequestedNewNodeId = NumericNodeId(380);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=379");
+        node.ParentNodeId = NumericNodeId(379);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1449,9 +1449,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=380");
+        ref.SourceNodeId = NumericNodeId(380);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8366");
+        ref.TargetNodeId = NumericNodeId(8366);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1459,12 +1459,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=383");
+        node.RequestedNewNodeId = NumericNodeId(383);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=382");
+        node.ParentNodeId = NumericNodeId(382);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1475,9 +1475,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=383");
+        ref.SourceNodeId = NumericNodeId(383);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8369");
+        ref.TargetNodeId = NumericNodeId(8369);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1485,12 +1485,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=386");
+        node.RequestedNewNodeId = NumericNodeId(386);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=385");
+        node.ParentNodeId = NumericNodeId(385);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1501,9 +1501,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=386");
+        ref.SourceNodeId = NumericNodeId(386);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8372");
+        ref.TargetNodeId = NumericNodeId(8372);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1511,12 +1511,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=332");
+        node.RequestedNewNodeId = NumericNodeId(332);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=331");
+        node.ParentNodeId = NumericNodeId(331);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1527,9 +1527,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=332");
+        ref.SourceNodeId = NumericNodeId(332);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8321");
+        ref.TargetNodeId = NumericNodeId(8321);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1537,12 +1537,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=336");
+        node.RequestedNewNodeId = NumericNodeId(336);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=335");
+        node.ParentNodeId = NumericNodeId(335);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1553,9 +1553,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=336");
+        ref.SourceNodeId = NumericNodeId(336);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8324");
+        ref.TargetNodeId = NumericNodeId(8324);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1563,12 +1563,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=342");
+        node.RequestedNewNodeId = NumericNodeId(342);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=341");
+        node.ParentNodeId = NumericNodeId(341);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1579,9 +1579,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=342");
+        ref.SourceNodeId = NumericNodeId(342);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8330");
+        ref.TargetNodeId = NumericNodeId(8330);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1589,12 +1589,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=584");
+        node.RequestedNewNodeId = NumericNodeId(584);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=583");
+        node.ParentNodeId = NumericNodeId(583);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1605,9 +1605,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=584");
+        ref.SourceNodeId = NumericNodeId(584);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8564");
+        ref.TargetNodeId = NumericNodeId(8564);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1615,12 +1615,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=587");
+        node.RequestedNewNodeId = NumericNodeId(587);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=586");
+        node.ParentNodeId = NumericNodeId(586);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1631,9 +1631,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=587");
+        ref.SourceNodeId = NumericNodeId(587);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8567");
+        ref.TargetNodeId = NumericNodeId(8567);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1641,12 +1641,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=590");
+        node.RequestedNewNodeId = NumericNodeId(590);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=589");
+        node.ParentNodeId = NumericNodeId(589);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1657,9 +1657,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=590");
+        ref.SourceNodeId = NumericNodeId(590);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8570");
+        ref.TargetNodeId = NumericNodeId(8570);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1667,12 +1667,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=593");
+        node.RequestedNewNodeId = NumericNodeId(593);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=592");
+        node.ParentNodeId = NumericNodeId(592);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1683,9 +1683,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=593");
+        ref.SourceNodeId = NumericNodeId(593);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8573");
+        ref.TargetNodeId = NumericNodeId(8573);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1693,12 +1693,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=596");
+        node.RequestedNewNodeId = NumericNodeId(596);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=595");
+        node.ParentNodeId = NumericNodeId(595);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1709,9 +1709,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=596");
+        ref.SourceNodeId = NumericNodeId(596);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8576");
+        ref.TargetNodeId = NumericNodeId(8576);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1719,12 +1719,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=599");
+        node.RequestedNewNodeId = NumericNodeId(599);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=598");
+        node.ParentNodeId = NumericNodeId(598);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1735,9 +1735,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=599");
+        ref.SourceNodeId = NumericNodeId(599);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8579");
+        ref.TargetNodeId = NumericNodeId(8579);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1745,12 +1745,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=602");
+        node.RequestedNewNodeId = NumericNodeId(602);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=601");
+        node.ParentNodeId = NumericNodeId(601);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1761,9 +1761,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=602");
+        ref.SourceNodeId = NumericNodeId(602);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8582");
+        ref.TargetNodeId = NumericNodeId(8582);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1771,12 +1771,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=660");
+        node.RequestedNewNodeId = NumericNodeId(660);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=659");
+        node.ParentNodeId = NumericNodeId(659);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1787,9 +1787,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=660");
+        ref.SourceNodeId = NumericNodeId(660);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8639");
+        ref.TargetNodeId = NumericNodeId(8639);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1797,12 +1797,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=720");
+        node.RequestedNewNodeId = NumericNodeId(720);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=719");
+        node.ParentNodeId = NumericNodeId(719);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1813,9 +1813,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=720");
+        ref.SourceNodeId = NumericNodeId(720);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8702");
+        ref.TargetNodeId = NumericNodeId(8702);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1823,12 +1823,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=726");
+        node.RequestedNewNodeId = NumericNodeId(726);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=725");
+        node.ParentNodeId = NumericNodeId(725);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1839,9 +1839,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=726");
+        ref.SourceNodeId = NumericNodeId(726);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8708");
+        ref.TargetNodeId = NumericNodeId(8708);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1849,12 +1849,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=949");
+        node.RequestedNewNodeId = NumericNodeId(949);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=948");
+        node.ParentNodeId = NumericNodeId(948);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1865,9 +1865,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=949");
+        ref.SourceNodeId = NumericNodeId(949);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8711");
+        ref.TargetNodeId = NumericNodeId(8711);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1875,12 +1875,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=921");
+        node.RequestedNewNodeId = NumericNodeId(921);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=920");
+        node.ParentNodeId = NumericNodeId(920);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1891,9 +1891,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=921");
+        ref.SourceNodeId = NumericNodeId(921);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8807");
+        ref.TargetNodeId = NumericNodeId(8807);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1901,12 +1901,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=310");
+        node.RequestedNewNodeId = NumericNodeId(310);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=308");
+        node.ParentNodeId = NumericNodeId(308);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1917,9 +1917,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=310");
+        ref.SourceNodeId = NumericNodeId(310);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7665");
+        ref.TargetNodeId = NumericNodeId(7665);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1927,12 +1927,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=306");
+        node.RequestedNewNodeId = NumericNodeId(306);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=304");
+        node.ParentNodeId = NumericNodeId(304);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1943,9 +1943,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=306");
+        ref.SourceNodeId = NumericNodeId(306);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7662");
+        ref.TargetNodeId = NumericNodeId(7662);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1953,12 +1953,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=314");
+        node.RequestedNewNodeId = NumericNodeId(314);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=312");
+        node.ParentNodeId = NumericNodeId(312);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1969,9 +1969,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=314");
+        ref.SourceNodeId = NumericNodeId(314);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7668");
+        ref.TargetNodeId = NumericNodeId(7668);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1979,12 +1979,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=434");
+        node.RequestedNewNodeId = NumericNodeId(434);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=432");
+        node.ParentNodeId = NumericNodeId(432);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1995,9 +1995,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=434");
+        ref.SourceNodeId = NumericNodeId(434);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7782");
+        ref.TargetNodeId = NumericNodeId(7782);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2005,12 +2005,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=346");
+        node.RequestedNewNodeId = NumericNodeId(346);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=344");
+        node.ParentNodeId = NumericNodeId(344);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2021,9 +2021,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=346");
+        ref.SourceNodeId = NumericNodeId(346);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7698");
+        ref.TargetNodeId = NumericNodeId(7698);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2031,12 +2031,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=318");
+        node.RequestedNewNodeId = NumericNodeId(318);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=316");
+        node.ParentNodeId = NumericNodeId(316);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2047,9 +2047,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=318");
+        ref.SourceNodeId = NumericNodeId(318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7671");
+        ref.TargetNodeId = NumericNodeId(7671);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2057,12 +2057,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=321");
+        node.RequestedNewNodeId = NumericNodeId(321);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=319");
+        node.ParentNodeId = NumericNodeId(319);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2073,9 +2073,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=321");
+        ref.SourceNodeId = NumericNodeId(321);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7674");
+        ref.TargetNodeId = NumericNodeId(7674);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2083,12 +2083,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=324");
+        node.RequestedNewNodeId = NumericNodeId(324);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=322");
+        node.ParentNodeId = NumericNodeId(322);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2099,9 +2099,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=324");
+        ref.SourceNodeId = NumericNodeId(324);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7677");
+        ref.TargetNodeId = NumericNodeId(7677);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2109,12 +2109,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=327");
+        node.RequestedNewNodeId = NumericNodeId(327);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=325");
+        node.ParentNodeId = NumericNodeId(325);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2125,9 +2125,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=327");
+        ref.SourceNodeId = NumericNodeId(327);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7680");
+        ref.TargetNodeId = NumericNodeId(7680);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2135,12 +2135,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=940");
+        node.RequestedNewNodeId = NumericNodeId(940);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=938");
+        node.ParentNodeId = NumericNodeId(938);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2151,9 +2151,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=940");
+        ref.SourceNodeId = NumericNodeId(940);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7683");
+        ref.TargetNodeId = NumericNodeId(7683);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2161,12 +2161,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=378");
+        node.RequestedNewNodeId = NumericNodeId(378);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=376");
+        node.ParentNodeId = NumericNodeId(376);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2177,9 +2177,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=378");
+        ref.SourceNodeId = NumericNodeId(378);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7728");
+        ref.TargetNodeId = NumericNodeId(7728);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2187,12 +2187,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=381");
+        node.RequestedNewNodeId = NumericNodeId(381);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=379");
+        node.ParentNodeId = NumericNodeId(379);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2203,9 +2203,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=381");
+        ref.SourceNodeId = NumericNodeId(381);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7731");
+        ref.TargetNodeId = NumericNodeId(7731);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2213,12 +2213,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=384");
+        node.RequestedNewNodeId = NumericNodeId(384);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=382");
+        node.ParentNodeId = NumericNodeId(382);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2229,9 +2229,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=384");
+        ref.SourceNodeId = NumericNodeId(384);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7734");
+        ref.TargetNodeId = NumericNodeId(7734);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2239,12 +2239,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=387");
+        node.RequestedNewNodeId = NumericNodeId(387);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=385");
+        node.ParentNodeId = NumericNodeId(385);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2255,9 +2255,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=387");
+        ref.SourceNodeId = NumericNodeId(387);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7737");
+        ref.TargetNodeId = NumericNodeId(7737);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2265,12 +2265,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=333");
+        node.RequestedNewNodeId = NumericNodeId(333);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=331");
+        node.ParentNodeId = NumericNodeId(331);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2281,9 +2281,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=333");
+        ref.SourceNodeId = NumericNodeId(333);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7686");
+        ref.TargetNodeId = NumericNodeId(7686);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2291,12 +2291,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=337");
+        node.RequestedNewNodeId = NumericNodeId(337);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=335");
+        node.ParentNodeId = NumericNodeId(335);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2307,9 +2307,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=337");
+        ref.SourceNodeId = NumericNodeId(337);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7689");
+        ref.TargetNodeId = NumericNodeId(7689);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2317,12 +2317,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=343");
+        node.RequestedNewNodeId = NumericNodeId(343);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=341");
+        node.ParentNodeId = NumericNodeId(341);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2333,9 +2333,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=343");
+        ref.SourceNodeId = NumericNodeId(343);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7695");
+        ref.TargetNodeId = NumericNodeId(7695);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2343,12 +2343,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=585");
+        node.RequestedNewNodeId = NumericNodeId(585);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=583");
+        node.ParentNodeId = NumericNodeId(583);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2359,9 +2359,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=585");
+        ref.SourceNodeId = NumericNodeId(585);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7929");
+        ref.TargetNodeId = NumericNodeId(7929);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2369,12 +2369,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=588");
+        node.RequestedNewNodeId = NumericNodeId(588);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=586");
+        node.ParentNodeId = NumericNodeId(586);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2385,9 +2385,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=588");
+        ref.SourceNodeId = NumericNodeId(588);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7932");
+        ref.TargetNodeId = NumericNodeId(7932);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2395,12 +2395,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=591");
+        node.RequestedNewNodeId = NumericNodeId(591);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=589");
+        node.ParentNodeId = NumericNodeId(589);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2411,9 +2411,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=591");
+        ref.SourceNodeId = NumericNodeId(591);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7935");
+        ref.TargetNodeId = NumericNodeId(7935);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2421,12 +2421,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=594");
+        node.RequestedNewNodeId = NumericNodeId(594);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=592");
+        node.ParentNodeId = NumericNodeId(592);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2437,9 +2437,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=594");
+        ref.SourceNodeId = NumericNodeId(594);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7938");
+        ref.TargetNodeId = NumericNodeId(7938);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2447,12 +2447,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=597");
+        node.RequestedNewNodeId = NumericNodeId(597);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=595");
+        node.ParentNodeId = NumericNodeId(595);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2463,9 +2463,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=597");
+        ref.SourceNodeId = NumericNodeId(597);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7941");
+        ref.TargetNodeId = NumericNodeId(7941);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2473,12 +2473,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=600");
+        node.RequestedNewNodeId = NumericNodeId(600);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=598");
+        node.ParentNodeId = NumericNodeId(598);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2489,9 +2489,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=600");
+        ref.SourceNodeId = NumericNodeId(600);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7944");
+        ref.TargetNodeId = NumericNodeId(7944);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2499,12 +2499,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=603");
+        node.RequestedNewNodeId = NumericNodeId(603);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=601");
+        node.ParentNodeId = NumericNodeId(601);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2515,9 +2515,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=603");
+        ref.SourceNodeId = NumericNodeId(603);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=7947");
+        ref.TargetNodeId = NumericNodeId(7947);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2525,12 +2525,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=661");
+        node.RequestedNewNodeId = NumericNodeId(661);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=659");
+        node.ParentNodeId = NumericNodeId(659);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2541,9 +2541,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=661");
+        ref.SourceNodeId = NumericNodeId(661);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8004");
+        ref.TargetNodeId = NumericNodeId(8004);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2551,12 +2551,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=721");
+        node.RequestedNewNodeId = NumericNodeId(721);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=719");
+        node.ParentNodeId = NumericNodeId(719);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2567,9 +2567,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=721");
+        ref.SourceNodeId = NumericNodeId(721);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8067");
+        ref.TargetNodeId = NumericNodeId(8067);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2577,12 +2577,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=727");
+        node.RequestedNewNodeId = NumericNodeId(727);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=725");
+        node.ParentNodeId = NumericNodeId(725);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2593,9 +2593,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=727");
+        ref.SourceNodeId = NumericNodeId(727);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8073");
+        ref.TargetNodeId = NumericNodeId(8073);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2603,12 +2603,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=950");
+        node.RequestedNewNodeId = NumericNodeId(950);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=948");
+        node.ParentNodeId = NumericNodeId(948);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2619,9 +2619,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=950");
+        ref.SourceNodeId = NumericNodeId(950);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8076");
+        ref.TargetNodeId = NumericNodeId(8076);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2629,12 +2629,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=922");
+        node.RequestedNewNodeId = NumericNodeId(922);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=920");
+        node.ParentNodeId = NumericNodeId(920);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -2645,9 +2645,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=922");
+        ref.SourceNodeId = NumericNodeId(922);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8172");
+        ref.TargetNodeId = NumericNodeId(8172);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
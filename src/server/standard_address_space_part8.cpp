@@ -21,10 +21,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2365");
+        node.RequestedNewNodeId = NumericNodeId(2365);
         node.BrowseName = ToQualifiedName("DataItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=63");
+        node.ParentNodeId = NumericNodeId(63);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.Description = LocalizedText("A variable that contains live automation data.");
@@ -39,18 +39,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2365");
+        ref.SourceNodeId = NumericNodeId(2365);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2366");
+        ref.TargetNodeId = NumericNodeId(2366);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2365");
+        ref.SourceNodeId = NumericNodeId(2365);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2367");
+        ref.TargetNodeId = NumericNodeId(2367);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -58,12 +58,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2366");
+        node.RequestedNewNodeId = NumericNodeId(2366);
         node.BrowseName = ToQualifiedName("Definition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2365");
+        node.ParentNodeId = NumericNodeId(2365);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("A vendor-specific, human readable string that specifies how the value of this DataItem is calculated.");
         attrs.DisplayName = LocalizedText("Definition");
@@ -76,9 +76,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2366");
+        ref.SourceNodeId = NumericNodeId(2366);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -86,12 +86,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2367");
+        node.RequestedNewNodeId = NumericNodeId(2367);
         node.BrowseName = ToQualifiedName("ValuePrecision");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2365");
+        node.ParentNodeId = NumericNodeId(2365);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("The maximum precision that the server can maintain for the item based on restrictions in the target environment.");
         attrs.DisplayName = LocalizedText("ValuePrecision");
@@ -104,9 +104,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2367");
+        ref.SourceNodeId = NumericNodeId(2367);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -114,10 +114,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2368");
+        node.RequestedNewNodeId = NumericNodeId(2368);
         node.BrowseName = ToQualifiedName("AnalogItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=2365");
+        node.ParentNodeId = NumericNodeId(2365);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AnalogItemType");
@@ -131,27 +131,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2368");
+        ref.SourceNodeId = NumericNodeId(2368);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2370");
+        ref.TargetNodeId = NumericNodeId(2370);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2368");
+        ref.SourceNodeId = NumericNodeId(2368);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2369");
+        ref.TargetNodeId = NumericNodeId(2369);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2368");
+        ref.SourceNodeId = NumericNodeId(2368);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2371");
+        ref.TargetNodeId = NumericNodeId(2371);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -159,15 +159,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2370");
+        node.RequestedNewNodeId = NumericNodeId(2370);
         node.BrowseName = ToQualifiedName("InstrumentRange");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2368");
+        node.ParentNodeId = NumericNodeId(2368);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InstrumentRange");
-        attrs.Type = ToNodeId("i=884");
+        attrs.Type = NumericNodeId(884);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -176,9 +176,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2370");
+        ref.SourceNodeId = NumericNodeId(2370);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -186,15 +186,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2369");
+        node.RequestedNewNodeId = NumericNodeId(2369);
         node.BrowseName = ToQualifiedName("EURange");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2368");
+        node.ParentNodeId = NumericNodeId(2368);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EURange");
-        attrs.Type = ToNodeId("i=884");
+        attrs.Type = NumericNodeId(884);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -203,9 +203,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2369");
+        ref.SourceNodeId = NumericNodeId(2369);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -213,15 +213,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2371");
+        node.RequestedNewNodeId = NumericNodeId(2371);
         node.BrowseName = ToQualifiedName("EngineeringUnits");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2368");
+        node.ParentNodeId = NumericNodeId(2368);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EngineeringUnits");
-        attrs.Type = ToNodeId("i=887");
+        attrs.Type = NumericNodeId(887);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -230,9 +230,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2371");
+        ref.SourceNodeId = NumericNodeId(2371);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -240,10 +240,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2372");
+        node.RequestedNewNodeId = NumericNodeId(2372);
         node.BrowseName = ToQualifiedName("DiscreteItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=2365");
+        node.ParentNodeId = NumericNodeId(2365);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("DiscreteItemType");
@@ -256,10 +256,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2373");
+        node.RequestedNewNodeId = NumericNodeId(2373);
         node.BrowseName = ToQualifiedName("TwoStateDiscreteType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=2372");
+        node.ParentNodeId = NumericNodeId(2372);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("TwoStateDiscreteType");
@@ -273,18 +273,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2373");
+        ref.SourceNodeId = NumericNodeId(2373);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2374");
+        ref.TargetNodeId = NumericNodeId(2374);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2373");
+        ref.SourceNodeId = NumericNodeId(2373);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2375");
+        ref.TargetNodeId = NumericNodeId(2375);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -292,12 +292,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2374");
+        node.RequestedNewNodeId = NumericNodeId(2374);
         node.BrowseName = ToQualifiedName("FalseState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2373");
+        node.ParentNodeId = NumericNodeId(2373);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("FalseState");
         attrs.Type = ObjectId::LocalizedText;
@@ -309,9 +309,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2374");
+        ref.SourceNodeId = NumericNodeId(2374);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -319,12 +319,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2375");
+        node.RequestedNewNodeId = NumericNodeId(2375);
         node.BrowseName = ToQualifiedName("TrueState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2373");
+        node.ParentNodeId = NumericNodeId(2373);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TrueState");
         attrs.Type = ObjectId::LocalizedText;
@@ -336,9 +336,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2375");
+        ref.SourceNodeId = NumericNodeId(2375);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -346,10 +346,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2376");
+        node.RequestedNewNodeId = NumericNodeId(2376);
         node.BrowseName = ToQualifiedName("MultiStateDiscreteType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=2372");
+        node.ParentNodeId = NumericNodeId(2372);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("MultiStateDiscreteType");
@@ -363,9 +363,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2376");
+        ref.SourceNodeId = NumericNodeId(2376);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2377");
+        ref.TargetNodeId = NumericNodeId(2377);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -373,12 +373,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2377");
+        node.RequestedNewNodeId = NumericNodeId(2377);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2376");
+        node.ParentNodeId = NumericNodeId(2376);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -390,9 +390,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2377");
+        ref.SourceNodeId = NumericNodeId(2377);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -400,10 +400,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11238");
+        node.RequestedNewNodeId = NumericNodeId(11238);
         node.BrowseName = ToQualifiedName("MultiStateValueDiscreteType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=2372");
+        node.ParentNodeId = NumericNodeId(2372);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("MultiStateValueDiscreteType");
@@ -417,18 +417,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11238");
+        ref.SourceNodeId = NumericNodeId(11238);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11241");
+        ref.TargetNodeId = NumericNodeId(11241);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11238");
+        ref.SourceNodeId = NumericNodeId(11238);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11461");
+        ref.TargetNodeId = NumericNodeId(11461);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -436,15 +436,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11241");
+        node.RequestedNewNodeId = NumericNodeId(11241);
         node.BrowseName = ToQualifiedName("EnumValues");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11238");
+        node.ParentNodeId = NumericNodeId(11238);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumValues");
-        attrs.Type = ToNodeId("i=7594");
+        attrs.Type = NumericNodeId(7594);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -453,9 +453,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11241");
+        ref.SourceNodeId = NumericNodeId(11241);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -463,12 +463,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11461");
+        node.RequestedNewNodeId = NumericNodeId(11461);
         node.BrowseName = ToQualifiedName("ValueAsText");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11238");
+        node.ParentNodeId = NumericNodeId(11238);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ValueAsText");
         attrs.Type = ObjectId::LocalizedText;
@@ -480,9 +480,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11461");
+        ref.SourceNodeId = NumericNodeId(11461);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -490,10 +490,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12021");
+        node.RequestedNewNodeId = NumericNodeId(12021);
         node.BrowseName = ToQualifiedName("ArrayItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=2365");
+        node.ParentNodeId = NumericNodeId(2365);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ArrayItemType");
@@ -507,45 +507,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12021");
+        ref.SourceNodeId = NumericNodeId(12021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12024");
+        ref.TargetNodeId = NumericNodeId(12024);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12021");
+        ref.SourceNodeId = NumericNodeId(12021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12025");
+        ref.TargetNodeId = NumericNodeId(12025);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12021");
+        ref.SourceNodeId = NumericNodeId(12021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12026");
+        ref.TargetNodeId = NumericNodeId(12026);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12021");
+        ref.SourceNodeId = NumericNodeId(12021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12027");
+        ref.TargetNodeId = NumericNodeId(12027);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12021");
+        ref.SourceNodeId = NumericNodeId(12021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12028");
+        ref.TargetNodeId = NumericNodeId(12028);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -553,15 +553,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12024");
+        node.RequestedNewNodeId = NumericNodeId(12024);
         node.BrowseName = ToQualifiedName("InstrumentRange");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InstrumentRange");
-        attrs.Type = ToNodeId("i=884");
+        attrs.Type = NumericNodeId(884);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -570,9 +570,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12024");
+        ref.SourceNodeId = NumericNodeId(12024);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -580,15 +580,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12025");
+        node.RequestedNewNodeId = NumericNodeId(12025);
         node.BrowseName = ToQualifiedName("EURange");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EURange");
-        attrs.Type = ToNodeId("i=884");
+        attrs.Type = NumericNodeId(884);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -597,9 +597,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12025");
+        ref.SourceNodeId = NumericNodeId(12025);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -607,15 +607,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12026");
+        node.RequestedNewNodeId = NumericNodeId(12026);
         node.BrowseName = ToQualifiedName("EngineeringUnits");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EngineeringUnits");
-        attrs.Type = ToNodeId("i=887");
+        attrs.Type = NumericNodeId(887);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -624,9 +624,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12026");
+        ref.SourceNodeId = NumericNodeId(12026);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -634,12 +634,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12027");
+        node.RequestedNewNodeId = NumericNodeId(12027);
         node.BrowseName = ToQualifiedName("Title");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Title");
         attrs.Type = ObjectId::LocalizedText;
@@ -651,9 +651,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12027");
+        ref.SourceNodeId = NumericNodeId(12027);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -661,15 +661,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12028");
+        node.RequestedNewNodeId = NumericNodeId(12028);
         node.BrowseName = ToQualifiedName("AxisScaleType");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AxisScaleType");
-        attrs.Type = ToNodeId("i=12077");
+        attrs.Type = NumericNodeId(12077);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -678,9 +678,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12028");
+        ref.SourceNodeId = NumericNodeId(12028);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -688,10 +688,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12029");
+        node.RequestedNewNodeId = NumericNodeId(12029);
         node.BrowseName = ToQualifiedName("YArrayItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("YArrayItemType");
@@ -706,9 +706,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12029");
+        ref.SourceNodeId = NumericNodeId(12029);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12037");
+        ref.TargetNodeId = NumericNodeId(12037);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -716,15 +716,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12037");
+        node.RequestedNewNodeId = NumericNodeId(12037);
         node.BrowseName = ToQualifiedName("XAxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12029");
+        node.ParentNodeId = NumericNodeId(12029);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("XAxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -733,9 +733,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12037");
+        ref.SourceNodeId = NumericNodeId(12037);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -743,14 +743,14 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12038");
+        node.RequestedNewNodeId = NumericNodeId(12038);
         node.BrowseName = ToQualifiedName("XYArrayItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("XYArrayItemType");
-        attrs.Type = ToNodeId("i=12080");
+        attrs.Type = NumericNodeId(12080);
         attrs.Rank = 1;
         attrs.IsAbstract = false;
         attrs.Dimensions = std::vector<uint32_t>{0};
@@ -761,9 +761,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12038");
+        ref.SourceNodeId = NumericNodeId(12038);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12046");
+        ref.TargetNodeId = NumericNodeId(12046);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -771,15 +771,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12046");
+        node.RequestedNewNodeId = NumericNodeId(12046);
         node.BrowseName = ToQualifiedName("XAxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12038");
+        node.ParentNodeId = NumericNodeId(12038);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("XAxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -788,9 +788,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12046");
+        ref.SourceNodeId = NumericNodeId(12046);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -798,10 +798,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12047");
+        node.RequestedNewNodeId = NumericNodeId(12047);
         node.BrowseName = ToQualifiedName("ImageItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ImageItemType");
@@ -816,18 +816,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12047");
+        ref.SourceNodeId = NumericNodeId(12047);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12055");
+        ref.TargetNodeId = NumericNodeId(12055);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12047");
+        ref.SourceNodeId = NumericNodeId(12047);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12056");
+        ref.TargetNodeId = NumericNodeId(12056);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -835,15 +835,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12055");
+        node.RequestedNewNodeId = NumericNodeId(12055);
         node.BrowseName = ToQualifiedName("XAxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12047");
+        node.ParentNodeId = NumericNodeId(12047);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("XAxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -852,9 +852,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12055");
+        ref.SourceNodeId = NumericNodeId(12055);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -862,15 +862,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12056");
+        node.RequestedNewNodeId = NumericNodeId(12056);
         node.BrowseName = ToQualifiedName("YAxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12047");
+        node.ParentNodeId = NumericNodeId(12047);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("YAxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -879,9 +879,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12056");
+        ref.SourceNodeId = NumericNodeId(12056);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -889,10 +889,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12057");
+        node.RequestedNewNodeId = NumericNodeId(12057);
         node.BrowseName = ToQualifiedName("CubeItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("CubeItemType");
@@ -907,27 +907,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12057");
+        ref.SourceNodeId = NumericNodeId(12057);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12065");
+        ref.TargetNodeId = NumericNodeId(12065);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12057");
+        ref.SourceNodeId = NumericNodeId(12057);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12066");
+        ref.TargetNodeId = NumericNodeId(12066);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12057");
+        ref.SourceNodeId = NumericNodeId(12057);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12067");
+        ref.TargetNodeId = NumericNodeId(12067);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -935,15 +935,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12065");
+        node.RequestedNewNodeId = NumericNodeId(12065);
         node.BrowseName = ToQualifiedName("XAxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12057");
+        node.ParentNodeId = NumericNodeId(12057);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("XAxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -952,9 +952,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12065");
+        ref.SourceNodeId = NumericNodeId(12065);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -962,15 +962,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12066");
+        node.RequestedNewNodeId = NumericNodeId(12066);
         node.BrowseName = ToQualifiedName("YAxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12057");
+        node.ParentNodeId = NumericNodeId(12057);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("YAxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -979,9 +979,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12066");
+        ref.SourceNodeId = NumericNodeId(12066);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -989,15 +989,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12067");
+        node.RequestedNewNodeId = NumericNodeId(12067);
         node.BrowseName = ToQualifiedName("ZAxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12057");
+        node.ParentNodeId = NumericNodeId(12057);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ZAxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1006,9 +1006,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12067");
+        ref.SourceNodeId = NumericNodeId(12067);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1016,10 +1016,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12068");
+        node.RequestedNewNodeId = NumericNodeId(12068);
         node.BrowseName = ToQualifiedName("NDimensionArrayItemType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=12021");
+        node.ParentNodeId = NumericNodeId(12021);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("NDimensionArrayItemType");
@@ -1033,9 +1033,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12068");
+        ref.SourceNodeId = NumericNodeId(12068);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12076");
+        ref.TargetNodeId = NumericNodeId(12076);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1043,15 +1043,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12076");
+        node.RequestedNewNodeId = NumericNodeId(12076);
         node.BrowseName = ToQualifiedName("AxisDefinition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12068");
+        node.ParentNodeId = NumericNodeId(12068);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AxisDefinition");
-        attrs.Type = ToNodeId("i=12079");
+        attrs.Type = NumericNodeId(12079);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1060,9 +1060,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12076");
+        ref.SourceNodeId = NumericNodeId(12076);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1070,10 +1070,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=884");
+        node.RequestedNewNodeId = NumericNodeId(884);
         node.BrowseName = ToQualifiedName("Range");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("Range");
@@ -1084,10 +1084,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=887");
+        node.RequestedNewNodeId = NumericNodeId(887);
         node.BrowseName = ToQualifiedName("EUInformation");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("EUInformation");
@@ -1098,10 +1098,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12077");
+        node.RequestedNewNodeId = NumericNodeId(12077);
         node.BrowseName = ToQualifiedName("AxisScaleEnumeration");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=29");
+        node.ParentNodeId = NumericNodeId(29);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AxisScaleEnumeration");
@@ -1113,9 +1113,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=12077");
+        ref.SourceNodeId = NumericNodeId(12077);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12078");
+        ref.TargetNodeId = NumericNodeId(12078);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1123,12 +1123,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12078");
+        node.RequestedNewNodeId = NumericNodeId(12078);
         node.BrowseName = ToQualifiedName("EnumStrings");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=12077");
+        node.ParentNodeId = NumericNodeId(12077);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnumStrings");
         attrs.Type = ObjectId::LocalizedText;
@@ -1140,9 +1140,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=12078");
+        ref.SourceNodeId = NumericNodeId(12078);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1150,10 +1150,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12171");
+        node.RequestedNewNodeId = NumericNodeId(12171);
         node.BrowseName = ToQualifiedName("ComplexNumberType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ComplexNumberType");
@@ -1164,10 +1164,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12172");
+        node.RequestedNewNodeId = NumericNodeId(12172);
         node.BrowseName = ToQualifiedName("DoubleComplexNumberType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("DoubleComplexNumberType");
@@ -1178,10 +1178,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12079");
+        node.RequestedNewNodeId = NumericNodeId(12079);
         node.BrowseName = ToQualifiedName("AxisInformation");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AxisInformation");
@@ -1192,10 +1192,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12080");
+        node.RequestedNewNodeId = NumericNodeId(12080);
         node.BrowseName = ToQualifiedName("XVType");
         node.Class = NodeClass::DataType;
-        node.ParentNodeId = ToNodeId("i=22");
+        node.ParentNodeId = NumericNodeId(22);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         DataTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("XVType");
@@ -1206,12 +1206,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=885");
+        node.RequestedNewNodeId = NumericNodeId(885);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=884");
+        node.ParentNodeId = NumericNodeId(884);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1222,9 +1222,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=885");
+        ref.SourceNodeId = NumericNodeId(885);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8873");
+        ref.TargetNodeId = NumericNodeId(8873);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1232,12 +1232,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=888");
+        node.RequestedNewNodeId = NumericNodeId(888);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=887");
+        node.ParentNodeId = NumericNodeId(887);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1248,9 +1248,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=888");
+        ref.SourceNodeId = NumericNodeId(888);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8876");
+        ref.TargetNodeId = NumericNodeId(8876);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1258,12 +1258,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12173");
+        node.RequestedNewNodeId = NumericNodeId(12173);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12171");
+        node.ParentNodeId = NumericNodeId(12171);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1274,9 +1274,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12173");
+        ref.SourceNodeId = NumericNodeId(12173);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12175");
+        ref.TargetNodeId = NumericNodeId(12175);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1284,12 +1284,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12174");
+        node.RequestedNewNodeId = NumericNodeId(12174);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12172");
+        node.ParentNodeId = NumericNodeId(12172);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1300,9 +1300,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12174");
+        ref.SourceNodeId = NumericNodeId(12174);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12178");
+        ref.TargetNodeId = NumericNodeId(12178);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1310,12 +1310,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12081");
+        node.RequestedNewNodeId = NumericNodeId(12081);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12079");
+        node.ParentNodeId = NumericNodeId(12079);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1326,9 +1326,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12081");
+        ref.SourceNodeId = NumericNodeId(12081);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12083");
+        ref.TargetNodeId = NumericNodeId(12083);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1336,12 +1336,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12082");
+        node.RequestedNewNodeId = NumericNodeId(12082);
         node.BrowseName = ToQualifiedName("Default XML");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12080");
+        node.ParentNodeId = NumericNodeId(12080);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default XML");
         attrs.EventNotifier = 0;
@@ -1352,9 +1352,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12082");
+        ref.SourceNodeId = NumericNodeId(12082);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12086");
+        ref.TargetNodeId = NumericNodeId(12086);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1362,12 +1362,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=886");
+        node.RequestedNewNodeId = NumericNodeId(886);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=884");
+        node.ParentNodeId = NumericNodeId(884);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1378,9 +1378,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=886");
+        ref.SourceNodeId = NumericNodeId(886);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8238");
+        ref.TargetNodeId = NumericNodeId(8238);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1388,12 +1388,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=889");
+        node.RequestedNewNodeId = NumericNodeId(889);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=887");
+        node.ParentNodeId = NumericNodeId(887);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1404,9 +1404,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=889");
+        ref.SourceNodeId = NumericNodeId(889);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8241");
+        ref.TargetNodeId = NumericNodeId(8241);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1414,12 +1414,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12181");
+        node.RequestedNewNodeId = NumericNodeId(12181);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12171");
+        node.ParentNodeId = NumericNodeId(12171);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1430,9 +1430,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12181");
+        ref.SourceNodeId = NumericNodeId(12181);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12183");
+        ref.TargetNodeId = NumericNodeId(12183);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1440,12 +1440,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12182");
+        node.RequestedNewNodeId = NumericNodeId(12182);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12172");
+        node.ParentNodeId = NumericNodeId(12172);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1456,9 +1456,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12182");
+        ref.SourceNodeId = NumericNodeId(12182);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12186");
+        ref.TargetNodeId = NumericNodeId(12186);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1466,12 +1466,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12089");
+        node.RequestedNewNodeId = NumericNodeId(12089);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12079");
+        node.ParentNodeId = NumericNodeId(12079);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1482,9 +1482,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12089");
+        ref.SourceNodeId = NumericNodeId(12089);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12091");
+        ref.TargetNodeId = NumericNodeId(12091);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1492,12 +1492,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=12090");
+        node.RequestedNewNodeId = NumericNodeId(12090);
         node.BrowseName = ToQualifiedName("Default Binary");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=12080");
+        node.ParentNodeId = NumericNodeId(12080);
         node.ReferenceTypeId = ReferenceId::HasEncoding;
-        node.TypeDefinition = ToNodeId("i=76");
+        node.TypeDefinition = NumericNodeId(76);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Default Binary");
         attrs.EventNotifier = 0;
@@ -1508,9 +1508,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasDescription;
-        ref.SourceNodeId = ToNodeId("i=12090");
+        ref.SourceNodeId = NumericNodeId(12090);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=12094");
+        ref.TargetNodeId = NumericNodeId(12094);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -21,10 +21,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8995");
+        node.RequestedNewNodeId = NumericNodeId(8995);
         node.BrowseName = ToQualifiedName("TwoStateVariableType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=2755");
+        node.ParentNodeId = NumericNodeId(2755);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("TwoStateVariableType");
@@ -38,45 +38,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8995");
+        ref.SourceNodeId = NumericNodeId(8995);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8996");
+        ref.TargetNodeId = NumericNodeId(8996);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8995");
+        ref.SourceNodeId = NumericNodeId(8995);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9000");
+        ref.TargetNodeId = NumericNodeId(9000);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8995");
+        ref.SourceNodeId = NumericNodeId(8995);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9001");
+        ref.TargetNodeId = NumericNodeId(9001);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8995");
+        ref.SourceNodeId = NumericNodeId(8995);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11110");
+        ref.TargetNodeId = NumericNodeId(11110);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8995");
+        ref.SourceNodeId = NumericNodeId(8995);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11111");
+        ref.TargetNodeId = NumericNodeId(11111);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -84,12 +84,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8996");
+        node.RequestedNewNodeId = NumericNodeId(8996);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8995");
+        node.ParentNodeId = NumericNodeId(8995);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -101,9 +101,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=8996");
+        ref.SourceNodeId = NumericNodeId(8996);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -111,15 +111,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9000");
+        node.RequestedNewNodeId = NumericNodeId(9000);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8995");
+        node.ParentNodeId = NumericNodeId(8995);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -128,9 +128,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9000");
+        ref.SourceNodeId = NumericNodeId(9000);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -138,15 +138,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9001");
+        node.RequestedNewNodeId = NumericNodeId(9001);
         node.BrowseName = ToQualifiedName("EffectiveTransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8995");
+        node.ParentNodeId = NumericNodeId(8995);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EffectiveTransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -155,9 +155,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9001");
+        ref.SourceNodeId = NumericNodeId(9001);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -165,12 +165,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11110");
+        node.RequestedNewNodeId = NumericNodeId(11110);
         node.BrowseName = ToQualifiedName("TrueState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8995");
+        node.ParentNodeId = NumericNodeId(8995);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TrueState");
         attrs.Type = ObjectId::LocalizedText;
@@ -182,9 +182,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11110");
+        ref.SourceNodeId = NumericNodeId(11110);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -192,12 +192,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11111");
+        node.RequestedNewNodeId = NumericNodeId(11111);
         node.BrowseName = ToQualifiedName("FalseState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8995");
+        node.ParentNodeId = NumericNodeId(8995);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("FalseState");
         attrs.Type = ObjectId::LocalizedText;
@@ -209,9 +209,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11111");
+        ref.SourceNodeId = NumericNodeId(11111);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -219,10 +219,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9002");
+        node.RequestedNewNodeId = NumericNodeId(9002);
         node.BrowseName = ToQualifiedName("ConditionVariableType");
         node.Class = NodeClass::VariableType;
-        node.ParentNodeId = ToNodeId("i=63");
+        node.ParentNodeId = NumericNodeId(63);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         VariableTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ConditionVariableType");
@@ -236,9 +236,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9002");
+        ref.SourceNodeId = NumericNodeId(9002);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9003");
+        ref.TargetNodeId = NumericNodeId(9003);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -246,15 +246,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9003");
+        node.RequestedNewNodeId = NumericNodeId(9003);
         node.BrowseName = ToQualifiedName("SourceTimestamp");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9002");
+        node.ParentNodeId = NumericNodeId(9002);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SourceTimestamp");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -263,9 +263,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9003");
+        ref.SourceNodeId = NumericNodeId(9003);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -273,10 +273,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9004");
+        node.RequestedNewNodeId = NumericNodeId(9004);
         node.BrowseName = ToQualifiedName("HasTrueSubState");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HasTrueSubState");
@@ -289,10 +289,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9005");
+        node.RequestedNewNodeId = NumericNodeId(9005);
         node.BrowseName = ToQualifiedName("HasFalseSubState");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HasFalseSubState");
@@ -305,10 +305,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2782");
+        node.RequestedNewNodeId = NumericNodeId(2782);
         node.BrowseName = ToQualifiedName("ConditionType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2041");
+        node.ParentNodeId = NumericNodeId(2041);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ConditionType");
@@ -320,126 +320,126 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11112");
+        ref.TargetNodeId = NumericNodeId(11112);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11113");
+        ref.TargetNodeId = NumericNodeId(11113);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9009");
+        ref.TargetNodeId = NumericNodeId(9009);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9010");
+        ref.TargetNodeId = NumericNodeId(9010);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3874");
+        ref.TargetNodeId = NumericNodeId(3874);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9011");
+        ref.TargetNodeId = NumericNodeId(9011);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9020");
+        ref.TargetNodeId = NumericNodeId(9020);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9022");
+        ref.TargetNodeId = NumericNodeId(9022);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9024");
+        ref.TargetNodeId = NumericNodeId(9024);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9026");
+        ref.TargetNodeId = NumericNodeId(9026);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9028");
+        ref.TargetNodeId = NumericNodeId(9028);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9027");
+        ref.TargetNodeId = NumericNodeId(9027);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9029");
+        ref.TargetNodeId = NumericNodeId(9029);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2782");
+        ref.SourceNodeId = NumericNodeId(2782);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=3875");
+        ref.TargetNodeId = NumericNodeId(3875);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -447,12 +447,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11112");
+        node.RequestedNewNodeId = NumericNodeId(11112);
         node.BrowseName = ToQualifiedName("ConditionClassId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ConditionClassId");
         attrs.Type = ObjectId::NodeId;
@@ -464,9 +464,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11112");
+        ref.SourceNodeId = NumericNodeId(11112);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -474,12 +474,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11113");
+        node.RequestedNewNodeId = NumericNodeId(11113);
         node.BrowseName = ToQualifiedName("ConditionClassName");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ConditionClassName");
         attrs.Type = ObjectId::LocalizedText;
@@ -491,9 +491,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11113");
+        ref.SourceNodeId = NumericNodeId(11113);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -501,12 +501,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9009");
+        node.RequestedNewNodeId = NumericNodeId(9009);
         node.BrowseName = ToQualifiedName("ConditionName");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ConditionName");
         attrs.Type = ObjectId::String;
@@ -518,9 +518,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9009");
+        ref.SourceNodeId = NumericNodeId(9009);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -528,12 +528,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9010");
+        node.RequestedNewNodeId = NumericNodeId(9010);
         node.BrowseName = ToQualifiedName("BranchId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("BranchId");
         attrs.Type = ObjectId::NodeId;
@@ -545,9 +545,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9010");
+        ref.SourceNodeId = NumericNodeId(9010);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -555,12 +555,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3874");
+        node.RequestedNewNodeId = NumericNodeId(3874);
         node.BrowseName = ToQualifiedName("Retain");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Retain");
         attrs.Type = ObjectId::Boolean;
@@ -572,9 +572,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3874");
+        ref.SourceNodeId = NumericNodeId(3874);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -582,12 +582,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9011");
+        node.RequestedNewNodeId = NumericNodeId(9011);
         node.BrowseName = ToQualifiedName("EnabledState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnabledState");
         attrs.Type = ObjectId::LocalizedText;
@@ -599,45 +599,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9011");
+        ref.SourceNodeId = NumericNodeId(9011);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9012");
+        ref.TargetNodeId = NumericNodeId(9012);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9011");
+        ref.SourceNodeId = NumericNodeId(9011);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9015");
+        ref.TargetNodeId = NumericNodeId(9015);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9011");
+        ref.SourceNodeId = NumericNodeId(9011);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9016");
+        ref.TargetNodeId = NumericNodeId(9016);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9011");
+        ref.SourceNodeId = NumericNodeId(9011);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9017");
+        ref.TargetNodeId = NumericNodeId(9017);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9011");
+        ref.SourceNodeId = NumericNodeId(9011);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -645,12 +645,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9012");
+        node.RequestedNewNodeId = NumericNodeId(9012);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9011");
+        node.ParentNodeId = NumericNodeId(9011);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -662,9 +662,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9012");
+        ref.SourceNodeId = NumericNodeId(9012);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -672,12 +672,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9015");
+        node.RequestedNewNodeId = NumericNodeId(9015);
         node.BrowseName = ToQualifiedName("EffectiveDisplayName");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9011");
+        node.ParentNodeId = NumericNodeId(9011);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EffectiveDisplayName");
         attrs.Type = ObjectId::LocalizedText;
@@ -689,9 +689,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9015");
+        ref.SourceNodeId = NumericNodeId(9015);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -699,15 +699,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9016");
+        node.RequestedNewNodeId = NumericNodeId(9016);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9011");
+        node.ParentNodeId = NumericNodeId(9011);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -716,9 +716,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9016");
+        ref.SourceNodeId = NumericNodeId(9016);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -726,15 +726,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9017");
+        node.RequestedNewNodeId = NumericNodeId(9017);
         node.BrowseName = ToQualifiedName("EffectiveTransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9011");
+        node.ParentNodeId = NumericNodeId(9011);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EffectiveTransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -743,9 +743,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9017");
+        ref.SourceNodeId = NumericNodeId(9017);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -753,12 +753,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9020");
+        node.RequestedNewNodeId = NumericNodeId(9020);
         node.BrowseName = ToQualifiedName("Quality");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=9002");
+        node.TypeDefinition = NumericNodeId(9002);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Quality");
         attrs.Type = ObjectId::StatusCode;
@@ -770,18 +770,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9020");
+        ref.SourceNodeId = NumericNodeId(9020);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9021");
+        ref.TargetNodeId = NumericNodeId(9021);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9020");
+        ref.SourceNodeId = NumericNodeId(9020);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -789,15 +789,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9021");
+        node.RequestedNewNodeId = NumericNodeId(9021);
         node.BrowseName = ToQualifiedName("SourceTimestamp");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9020");
+        node.ParentNodeId = NumericNodeId(9020);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SourceTimestamp");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -806,9 +806,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9021");
+        ref.SourceNodeId = NumericNodeId(9021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -816,12 +816,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9022");
+        node.RequestedNewNodeId = NumericNodeId(9022);
         node.BrowseName = ToQualifiedName("LastSeverity");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=9002");
+        node.TypeDefinition = NumericNodeId(9002);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastSeverity");
         attrs.Type = ObjectId::UInt16;
@@ -833,18 +833,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9022");
+        ref.SourceNodeId = NumericNodeId(9022);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9023");
+        ref.TargetNodeId = NumericNodeId(9023);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9022");
+        ref.SourceNodeId = NumericNodeId(9022);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -852,15 +852,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9023");
+        node.RequestedNewNodeId = NumericNodeId(9023);
         node.BrowseName = ToQualifiedName("SourceTimestamp");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9022");
+        node.ParentNodeId = NumericNodeId(9022);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SourceTimestamp");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -869,9 +869,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9023");
+        ref.SourceNodeId = NumericNodeId(9023);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -879,12 +879,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9024");
+        node.RequestedNewNodeId = NumericNodeId(9024);
         node.BrowseName = ToQualifiedName("Comment");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=9002");
+        node.TypeDefinition = NumericNodeId(9002);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Comment");
         attrs.Type = ObjectId::LocalizedText;
@@ -896,18 +896,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9024");
+        ref.SourceNodeId = NumericNodeId(9024);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9025");
+        ref.TargetNodeId = NumericNodeId(9025);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9024");
+        ref.SourceNodeId = NumericNodeId(9024);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -915,15 +915,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9025");
+        node.RequestedNewNodeId = NumericNodeId(9025);
         node.BrowseName = ToQualifiedName("SourceTimestamp");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9024");
+        node.ParentNodeId = NumericNodeId(9024);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SourceTimestamp");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -932,9 +932,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9025");
+        ref.SourceNodeId = NumericNodeId(9025);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -942,12 +942,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9026");
+        node.RequestedNewNodeId = NumericNodeId(9026);
         node.BrowseName = ToQualifiedName("ClientUserId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ClientUserId");
         attrs.Type = ObjectId::String;
@@ -959,9 +959,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9026");
+        ref.SourceNodeId = NumericNodeId(9026);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -969,15 +969,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9030");
+        node.RequestedNewNodeId = NumericNodeId(9030);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9029");
+        node.ParentNodeId = NumericNodeId(9029);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -986,9 +986,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9030");
+        ref.SourceNodeId = NumericNodeId(9030);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -996,15 +996,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=3876");
+        node.RequestedNewNodeId = NumericNodeId(3876);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=3875");
+        node.ParentNodeId = NumericNodeId(3875);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1013,9 +1013,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=3876");
+        ref.SourceNodeId = NumericNodeId(3876);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1023,10 +1023,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2830");
+        node.RequestedNewNodeId = NumericNodeId(2830);
         node.BrowseName = ToQualifiedName("DialogConditionType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("DialogConditionType");
@@ -1038,81 +1038,81 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9035");
+        ref.TargetNodeId = NumericNodeId(9035);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9055");
+        ref.TargetNodeId = NumericNodeId(9055);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2831");
+        ref.TargetNodeId = NumericNodeId(2831);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9064");
+        ref.TargetNodeId = NumericNodeId(9064);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9065");
+        ref.TargetNodeId = NumericNodeId(9065);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9066");
+        ref.TargetNodeId = NumericNodeId(9066);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9067");
+        ref.TargetNodeId = NumericNodeId(9067);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9068");
+        ref.TargetNodeId = NumericNodeId(9068);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2830");
+        ref.SourceNodeId = NumericNodeId(2830);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9069");
+        ref.TargetNodeId = NumericNodeId(9069);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1120,12 +1120,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9035");
+        node.RequestedNewNodeId = NumericNodeId(9035);
         node.BrowseName = ToQualifiedName("EnabledState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnabledState");
         attrs.Type = ObjectId::LocalizedText;
@@ -1137,27 +1137,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9035");
+        ref.SourceNodeId = NumericNodeId(9035);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9036");
+        ref.TargetNodeId = NumericNodeId(9036);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9035");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9035);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9055");
+        ref.TargetNodeId = NumericNodeId(9055);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9035");
+        ref.SourceNodeId = NumericNodeId(9035);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1165,12 +1165,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9036");
+        node.RequestedNewNodeId = NumericNodeId(9036);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9035");
+        node.ParentNodeId = NumericNodeId(9035);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -1182,9 +1182,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9036");
+        ref.SourceNodeId = NumericNodeId(9036);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1192,12 +1192,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9055");
+        node.RequestedNewNodeId = NumericNodeId(9055);
         node.BrowseName = ToQualifiedName("DialogState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DialogState");
         attrs.Type = ObjectId::LocalizedText;
@@ -1209,27 +1209,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9055");
+        ref.SourceNodeId = NumericNodeId(9055);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9056");
+        ref.TargetNodeId = NumericNodeId(9056);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9055");
+        ref.SourceNodeId = NumericNodeId(9055);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9060");
+        ref.TargetNodeId = NumericNodeId(9060);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9055");
+        ref.SourceNodeId = NumericNodeId(9055);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1237,12 +1237,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9056");
+        node.RequestedNewNodeId = NumericNodeId(9056);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9055");
+        node.ParentNodeId = NumericNodeId(9055);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -1254,9 +1254,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9056");
+        ref.SourceNodeId = NumericNodeId(9056);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1264,15 +1264,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9060");
+        node.RequestedNewNodeId = NumericNodeId(9060);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9055");
+        node.ParentNodeId = NumericNodeId(9055);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1281,9 +1281,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9060");
+        ref.SourceNodeId = NumericNodeId(9060);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1291,12 +1291,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2831");
+        node.RequestedNewNodeId = NumericNodeId(2831);
         node.BrowseName = ToQualifiedName("Prompt");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Prompt");
         attrs.Type = ObjectId::LocalizedText;
@@ -1308,9 +1308,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2831");
+        ref.SourceNodeId = NumericNodeId(2831);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1318,12 +1318,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9064");
+        node.RequestedNewNodeId = NumericNodeId(9064);
         node.BrowseName = ToQualifiedName("ResponseOptionSet");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ResponseOptionSet");
         attrs.Type = ObjectId::LocalizedText;
@@ -1335,9 +1335,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9064");
+        ref.SourceNodeId = NumericNodeId(9064);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1345,12 +1345,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9065");
+        node.RequestedNewNodeId = NumericNodeId(9065);
         node.BrowseName = ToQualifiedName("DefaultResponse");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("DefaultResponse");
         attrs.Type = ObjectId::Int32;
@@ -1362,9 +1362,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9065");
+        ref.SourceNodeId = NumericNodeId(9065);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1372,12 +1372,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9066");
+        node.RequestedNewNodeId = NumericNodeId(9066);
         node.BrowseName = ToQualifiedName("OkResponse");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("OkResponse");
         attrs.Type = ObjectId::Int32;
@@ -1389,9 +1389,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9066");
+        ref.SourceNodeId = NumericNodeId(9066);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1399,12 +1399,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9067");
+        node.RequestedNewNodeId = NumericNodeId(9067);
         node.BrowseName = ToQualifiedName("CancelResponse");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CancelResponse");
         attrs.Type = ObjectId::Int32;
@@ -1416,9 +1416,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9067");
+        ref.SourceNodeId = NumericNodeId(9067);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1426,12 +1426,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9068");
+        node.RequestedNewNodeId = NumericNodeId(9068);
         node.BrowseName = ToQualifiedName("LastResponse");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2830");
+        node.ParentNodeId = NumericNodeId(2830);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastResponse");
         attrs.Type = ObjectId::Int32;
@@ -1443,9 +1443,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9068");
+        ref.SourceNodeId = NumericNodeId(9068);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1453,15 +1453,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9070");
+        node.RequestedNewNodeId = NumericNodeId(9070);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9069");
+        node.ParentNodeId = NumericNodeId(9069);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1470,9 +1470,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9070");
+        ref.SourceNodeId = NumericNodeId(9070);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1480,10 +1480,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2881");
+        node.RequestedNewNodeId = NumericNodeId(2881);
         node.BrowseName = ToQualifiedName("AcknowledgeableConditionType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2782");
+        node.ParentNodeId = NumericNodeId(2782);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AcknowledgeableConditionType");
@@ -1495,45 +1495,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2881");
+        ref.SourceNodeId = NumericNodeId(2881);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9073");
+        ref.TargetNodeId = NumericNodeId(9073);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2881");
+        ref.SourceNodeId = NumericNodeId(2881);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9093");
+        ref.TargetNodeId = NumericNodeId(9093);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2881");
+        ref.SourceNodeId = NumericNodeId(2881);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9102");
+        ref.TargetNodeId = NumericNodeId(9102);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2881");
+        ref.SourceNodeId = NumericNodeId(2881);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9111");
+        ref.TargetNodeId = NumericNodeId(9111);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2881");
+        ref.SourceNodeId = NumericNodeId(2881);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9113");
+        ref.TargetNodeId = NumericNodeId(9113);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1541,12 +1541,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9073");
+        node.RequestedNewNodeId = NumericNodeId(9073);
         node.BrowseName = ToQualifiedName("EnabledState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2881");
+        node.ParentNodeId = NumericNodeId(2881);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnabledState");
         attrs.Type = ObjectId::LocalizedText;
@@ -1558,36 +1558,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9073");
+        ref.SourceNodeId = NumericNodeId(9073);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9074");
+        ref.TargetNodeId = NumericNodeId(9074);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9073");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9073);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9093");
+        ref.TargetNodeId = NumericNodeId(9093);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9073");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9073);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9102");
+        ref.TargetNodeId = NumericNodeId(9102);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9073");
+        ref.SourceNodeId = NumericNodeId(9073);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1595,12 +1595,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9074");
+        node.RequestedNewNodeId = NumericNodeId(9074);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9073");
+        node.ParentNodeId = NumericNodeId(9073);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -1612,9 +1612,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9074");
+        ref.SourceNodeId = NumericNodeId(9074);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1622,12 +1622,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9093");
+        node.RequestedNewNodeId = NumericNodeId(9093);
         node.BrowseName = ToQualifiedName("AckedState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2881");
+        node.ParentNodeId = NumericNodeId(2881);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("AckedState");
         attrs.Type = ObjectId::LocalizedText;
@@ -1639,27 +1639,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9093");
+        ref.SourceNodeId = NumericNodeId(9093);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9094");
+        ref.TargetNodeId = NumericNodeId(9094);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9093");
+        ref.SourceNodeId = NumericNodeId(9093);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9098");
+        ref.TargetNodeId = NumericNodeId(9098);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9093");
+        ref.SourceNodeId = NumericNodeId(9093);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1667,12 +1667,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9094");
+        node.RequestedNewNodeId = NumericNodeId(9094);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9093");
+        node.ParentNodeId = NumericNodeId(9093);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -1684,9 +1684,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9094");
+        ref.SourceNodeId = NumericNodeId(9094);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1694,15 +1694,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9098");
+        node.RequestedNewNodeId = NumericNodeId(9098);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9093");
+        node.ParentNodeId = NumericNodeId(9093);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1711,9 +1711,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9098");
+        ref.SourceNodeId = NumericNodeId(9098);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1721,12 +1721,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9102");
+        node.RequestedNewNodeId = NumericNodeId(9102);
         node.BrowseName = ToQualifiedName("ConfirmedState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2881");
+        node.ParentNodeId = NumericNodeId(2881);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ConfirmedState");
         attrs.Type = ObjectId::LocalizedText;
@@ -1738,27 +1738,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9102");
+        ref.SourceNodeId = NumericNodeId(9102);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9103");
+        ref.TargetNodeId = NumericNodeId(9103);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9102");
+        ref.SourceNodeId = NumericNodeId(9102);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9107");
+        ref.TargetNodeId = NumericNodeId(9107);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9102");
+        ref.SourceNodeId = NumericNodeId(9102);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1766,12 +1766,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9103");
+        node.RequestedNewNodeId = NumericNodeId(9103);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9102");
+        node.ParentNodeId = NumericNodeId(9102);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -1783,9 +1783,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9103");
+        ref.SourceNodeId = NumericNodeId(9103);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1793,15 +1793,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9107");
+        node.RequestedNewNodeId = NumericNodeId(9107);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9102");
+        node.ParentNodeId = NumericNodeId(9102);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1810,9 +1810,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9107");
+        ref.SourceNodeId = NumericNodeId(9107);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1820,15 +1820,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9112");
+        node.RequestedNewNodeId = NumericNodeId(9112);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9111");
+        node.ParentNodeId = NumericNodeId(9111);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1837,9 +1837,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9112");
+        ref.SourceNodeId = NumericNodeId(9112);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1847,15 +1847,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9114");
+        node.RequestedNewNodeId = NumericNodeId(9114);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9113");
+        node.ParentNodeId = NumericNodeId(9113);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -1864,9 +1864,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9114");
+        ref.SourceNodeId = NumericNodeId(9114);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1874,10 +1874,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2915");
+        node.RequestedNewNodeId = NumericNodeId(2915);
         node.BrowseName = ToQualifiedName("AlarmConditionType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2881");
+        node.ParentNodeId = NumericNodeId(2881);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AlarmConditionType");
@@ -1889,63 +1889,63 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2915");
+        ref.SourceNodeId = NumericNodeId(2915);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9118");
+        ref.TargetNodeId = NumericNodeId(9118);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2915");
+        ref.SourceNodeId = NumericNodeId(2915);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9160");
+        ref.TargetNodeId = NumericNodeId(9160);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2915");
+        ref.SourceNodeId = NumericNodeId(2915);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11120");
+        ref.TargetNodeId = NumericNodeId(11120);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2915");
+        ref.SourceNodeId = NumericNodeId(2915);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9169");
+        ref.TargetNodeId = NumericNodeId(9169);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2915");
+        ref.SourceNodeId = NumericNodeId(2915);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9178");
+        ref.TargetNodeId = NumericNodeId(9178);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2915");
+        ref.SourceNodeId = NumericNodeId(2915);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9215");
+        ref.TargetNodeId = NumericNodeId(9215);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2915");
+        ref.SourceNodeId = NumericNodeId(2915);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9216");
+        ref.TargetNodeId = NumericNodeId(9216);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -1953,12 +1953,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9118");
+        node.RequestedNewNodeId = NumericNodeId(9118);
         node.BrowseName = ToQualifiedName("EnabledState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EnabledState");
         attrs.Type = ObjectId::LocalizedText;
@@ -1970,45 +1970,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9118");
+        ref.SourceNodeId = NumericNodeId(9118);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9119");
+        ref.TargetNodeId = NumericNodeId(9119);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9118");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9118);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9160");
+        ref.TargetNodeId = NumericNodeId(9160);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9118");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9118);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9169");
+        ref.TargetNodeId = NumericNodeId(9169);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9118");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9118);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9178");
+        ref.TargetNodeId = NumericNodeId(9178);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9118");
+        ref.SourceNodeId = NumericNodeId(9118);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2016,12 +2016,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9119");
+        node.RequestedNewNodeId = NumericNodeId(9119);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9118");
+        node.ParentNodeId = NumericNodeId(9118);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -2033,9 +2033,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9119");
+        ref.SourceNodeId = NumericNodeId(9119);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2043,12 +2043,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9160");
+        node.RequestedNewNodeId = NumericNodeId(9160);
         node.BrowseName = ToQualifiedName("ActiveState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ActiveState");
         attrs.Type = ObjectId::LocalizedText;
@@ -2060,45 +2060,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9160");
+        ref.SourceNodeId = NumericNodeId(9160);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9161");
+        ref.TargetNodeId = NumericNodeId(9161);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9160");
+        ref.SourceNodeId = NumericNodeId(9160);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9164");
+        ref.TargetNodeId = NumericNodeId(9164);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9160");
+        ref.SourceNodeId = NumericNodeId(9160);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9165");
+        ref.TargetNodeId = NumericNodeId(9165);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9160");
+        ref.SourceNodeId = NumericNodeId(9160);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9166");
+        ref.TargetNodeId = NumericNodeId(9166);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9160");
+        ref.SourceNodeId = NumericNodeId(9160);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2106,12 +2106,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9161");
+        node.RequestedNewNodeId = NumericNodeId(9161);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9160");
+        node.ParentNodeId = NumericNodeId(9160);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -2123,9 +2123,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9161");
+        ref.SourceNodeId = NumericNodeId(9161);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2133,12 +2133,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9164");
+        node.RequestedNewNodeId = NumericNodeId(9164);
         node.BrowseName = ToQualifiedName("EffectiveDisplayName");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9160");
+        node.ParentNodeId = NumericNodeId(9160);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EffectiveDisplayName");
         attrs.Type = ObjectId::LocalizedText;
@@ -2150,9 +2150,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9164");
+        ref.SourceNodeId = NumericNodeId(9164);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2160,15 +2160,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9165");
+        node.RequestedNewNodeId = NumericNodeId(9165);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9160");
+        node.ParentNodeId = NumericNodeId(9160);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2177,9 +2177,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9165");
+        ref.SourceNodeId = NumericNodeId(9165);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2187,15 +2187,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9166");
+        node.RequestedNewNodeId = NumericNodeId(9166);
         node.BrowseName = ToQualifiedName("EffectiveTransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9160");
+        node.ParentNodeId = NumericNodeId(9160);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("EffectiveTransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2204,9 +2204,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9166");
+        ref.SourceNodeId = NumericNodeId(9166);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2214,12 +2214,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11120");
+        node.RequestedNewNodeId = NumericNodeId(11120);
         node.BrowseName = ToQualifiedName("InputNode");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputNode");
         attrs.Type = ObjectId::NodeId;
@@ -2231,9 +2231,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11120");
+        ref.SourceNodeId = NumericNodeId(11120);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2241,12 +2241,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9169");
+        node.RequestedNewNodeId = NumericNodeId(9169);
         node.BrowseName = ToQualifiedName("SuppressedState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SuppressedState");
         attrs.Type = ObjectId::LocalizedText;
@@ -2258,27 +2258,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9169");
+        ref.SourceNodeId = NumericNodeId(9169);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9170");
+        ref.TargetNodeId = NumericNodeId(9170);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9169");
+        ref.SourceNodeId = NumericNodeId(9169);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9174");
+        ref.TargetNodeId = NumericNodeId(9174);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9169");
+        ref.SourceNodeId = NumericNodeId(9169);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2286,12 +2286,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9170");
+        node.RequestedNewNodeId = NumericNodeId(9170);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9169");
+        node.ParentNodeId = NumericNodeId(9169);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -2303,9 +2303,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9170");
+        ref.SourceNodeId = NumericNodeId(9170);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2313,15 +2313,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9174");
+        node.RequestedNewNodeId = NumericNodeId(9174);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9169");
+        node.ParentNodeId = NumericNodeId(9169);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2330,9 +2330,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9174");
+        ref.SourceNodeId = NumericNodeId(9174);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2340,12 +2340,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9178");
+        node.RequestedNewNodeId = NumericNodeId(9178);
         node.BrowseName = ToQualifiedName("ShelvingState");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2929");
+        node.TypeDefinition = NumericNodeId(2929);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("ShelvingState");
         attrs.EventNotifier = 0;
@@ -2356,63 +2356,63 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9178");
+        ref.SourceNodeId = NumericNodeId(9178);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9179");
+        ref.TargetNodeId = NumericNodeId(9179);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9178");
+        ref.SourceNodeId = NumericNodeId(9178);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9184");
+        ref.TargetNodeId = NumericNodeId(9184);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9178");
+        ref.SourceNodeId = NumericNodeId(9178);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9189");
+        ref.TargetNodeId = NumericNodeId(9189);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9178");
+        ref.SourceNodeId = NumericNodeId(9178);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9211");
+        ref.TargetNodeId = NumericNodeId(9211);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9178");
+        ref.SourceNodeId = NumericNodeId(9178);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9212");
+        ref.TargetNodeId = NumericNodeId(9212);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9178");
+        ref.SourceNodeId = NumericNodeId(9178);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9213");
+        ref.TargetNodeId = NumericNodeId(9213);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9178");
+        ref.SourceNodeId = NumericNodeId(9178);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2420,12 +2420,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9179");
+        node.RequestedNewNodeId = NumericNodeId(9179);
         node.BrowseName = ToQualifiedName("CurrentState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9178");
+        node.ParentNodeId = NumericNodeId(9178);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2760");
+        node.TypeDefinition = NumericNodeId(2760);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CurrentState");
         attrs.Type = ObjectId::LocalizedText;
@@ -2437,18 +2437,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9179");
+        ref.SourceNodeId = NumericNodeId(9179);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9180");
+        ref.TargetNodeId = NumericNodeId(9180);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9179");
+        ref.SourceNodeId = NumericNodeId(9179);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2456,12 +2456,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9180");
+        node.RequestedNewNodeId = NumericNodeId(9180);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9179");
+        node.ParentNodeId = NumericNodeId(9179);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::NodeId;
@@ -2473,9 +2473,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9180");
+        ref.SourceNodeId = NumericNodeId(9180);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2483,12 +2483,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9184");
+        node.RequestedNewNodeId = NumericNodeId(9184);
         node.BrowseName = ToQualifiedName("LastTransition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9178");
+        node.ParentNodeId = NumericNodeId(9178);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2767");
+        node.TypeDefinition = NumericNodeId(2767);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastTransition");
         attrs.Type = ObjectId::LocalizedText;
@@ -2500,27 +2500,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9184");
+        ref.SourceNodeId = NumericNodeId(9184);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9185");
+        ref.TargetNodeId = NumericNodeId(9185);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9184");
+        ref.SourceNodeId = NumericNodeId(9184);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9188");
+        ref.TargetNodeId = NumericNodeId(9188);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9184");
+        ref.SourceNodeId = NumericNodeId(9184);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2528,12 +2528,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9185");
+        node.RequestedNewNodeId = NumericNodeId(9185);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9184");
+        node.ParentNodeId = NumericNodeId(9184);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::NodeId;
@@ -2545,9 +2545,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9185");
+        ref.SourceNodeId = NumericNodeId(9185);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2555,15 +2555,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9188");
+        node.RequestedNewNodeId = NumericNodeId(9188);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9184");
+        node.ParentNodeId = NumericNodeId(9184);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2572,9 +2572,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9188");
+        ref.SourceNodeId = NumericNodeId(9188);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2582,15 +2582,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9189");
+        node.RequestedNewNodeId = NumericNodeId(9189);
         node.BrowseName = ToQualifiedName("UnshelveTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9178");
+        node.ParentNodeId = NumericNodeId(9178);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UnshelveTime");
-        attrs.Type = ToNodeId("i=290");
+        attrs.Type = NumericNodeId(290);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2599,9 +2599,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9189");
+        ref.SourceNodeId = NumericNodeId(9189);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2609,15 +2609,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9214");
+        node.RequestedNewNodeId = NumericNodeId(9214);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9213");
+        node.ParentNodeId = NumericNodeId(9213);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2626,9 +2626,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9214");
+        ref.SourceNodeId = NumericNodeId(9214);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2636,12 +2636,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9215");
+        node.RequestedNewNodeId = NumericNodeId(9215);
         node.BrowseName = ToQualifiedName("SuppressedOrShelved");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SuppressedOrShelved");
         attrs.Type = ObjectId::Boolean;
@@ -2653,9 +2653,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9215");
+        ref.SourceNodeId = NumericNodeId(9215);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2663,15 +2663,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9216");
+        node.RequestedNewNodeId = NumericNodeId(9216);
         node.BrowseName = ToQualifiedName("MaxTimeShelved");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("MaxTimeShelved");
-        attrs.Type = ToNodeId("i=290");
+        attrs.Type = NumericNodeId(290);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2680,9 +2680,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9216");
+        ref.SourceNodeId = NumericNodeId(9216);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2690,10 +2690,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2929");
+        node.RequestedNewNodeId = NumericNodeId(2929);
         node.BrowseName = ToQualifiedName("ShelvedStateMachineType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2771");
+        node.ParentNodeId = NumericNodeId(2771);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ShelvedStateMachineType");
@@ -2705,117 +2705,117 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9115");
+        ref.TargetNodeId = NumericNodeId(9115);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2930");
+        ref.TargetNodeId = NumericNodeId(2930);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2932");
+        ref.TargetNodeId = NumericNodeId(2932);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2933");
+        ref.TargetNodeId = NumericNodeId(2933);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2935");
+        ref.TargetNodeId = NumericNodeId(2935);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2936");
+        ref.TargetNodeId = NumericNodeId(2936);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2940");
+        ref.TargetNodeId = NumericNodeId(2940);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2942");
+        ref.TargetNodeId = NumericNodeId(2942);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2943");
+        ref.TargetNodeId = NumericNodeId(2943);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2945");
+        ref.TargetNodeId = NumericNodeId(2945);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2947");
+        ref.TargetNodeId = NumericNodeId(2947);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2948");
+        ref.TargetNodeId = NumericNodeId(2948);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=2929");
+        ref.SourceNodeId = NumericNodeId(2929);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2949");
+        ref.TargetNodeId = NumericNodeId(2949);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2823,15 +2823,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9115");
+        node.RequestedNewNodeId = NumericNodeId(9115);
         node.BrowseName = ToQualifiedName("UnshelveTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("UnshelveTime");
-        attrs.Type = ToNodeId("i=290");
+        attrs.Type = NumericNodeId(290);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -2840,9 +2840,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9115");
+        ref.SourceNodeId = NumericNodeId(9115);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2850,12 +2850,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2930");
+        node.RequestedNewNodeId = NumericNodeId(2930);
         node.BrowseName = ToQualifiedName("Unshelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Unshelved");
         attrs.EventNotifier = 0;
@@ -2866,9 +2866,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2930");
+        ref.SourceNodeId = NumericNodeId(2930);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=6098");
+        ref.TargetNodeId = NumericNodeId(6098);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2876,12 +2876,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=6098");
+        node.RequestedNewNodeId = NumericNodeId(6098);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2930");
+        node.ParentNodeId = NumericNodeId(2930);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -2893,9 +2893,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=6098");
+        ref.SourceNodeId = NumericNodeId(6098);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2903,12 +2903,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2932");
+        node.RequestedNewNodeId = NumericNodeId(2932);
         node.BrowseName = ToQualifiedName("TimedShelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("TimedShelved");
         attrs.EventNotifier = 0;
@@ -2919,9 +2919,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2932");
+        ref.SourceNodeId = NumericNodeId(2932);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=6100");
+        ref.TargetNodeId = NumericNodeId(6100);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2929,12 +2929,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=6100");
+        node.RequestedNewNodeId = NumericNodeId(6100);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2932");
+        node.ParentNodeId = NumericNodeId(2932);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -2946,9 +2946,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=6100");
+        ref.SourceNodeId = NumericNodeId(6100);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2956,12 +2956,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2933");
+        node.RequestedNewNodeId = NumericNodeId(2933);
         node.BrowseName = ToQualifiedName("OneShotShelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("OneShotShelved");
         attrs.EventNotifier = 0;
@@ -2972,9 +2972,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2933");
+        ref.SourceNodeId = NumericNodeId(2933);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=6101");
+        ref.TargetNodeId = NumericNodeId(6101);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -2982,12 +2982,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=6101");
+        node.RequestedNewNodeId = NumericNodeId(6101);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2933");
+        node.ParentNodeId = NumericNodeId(2933);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -2999,9 +2999,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=6101");
+        ref.SourceNodeId = NumericNodeId(6101);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3009,12 +3009,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2935");
+        node.RequestedNewNodeId = NumericNodeId(2935);
         node.BrowseName = ToQualifiedName("UnshelvedToTimedShelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("UnshelvedToTimedShelved");
         attrs.EventNotifier = 0;
@@ -3025,45 +3025,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2935");
+        ref.SourceNodeId = NumericNodeId(2935);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11322");
+        ref.TargetNodeId = NumericNodeId(11322);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2935");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2935);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2930");
+        ref.TargetNodeId = NumericNodeId(2930);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2935");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2935);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2932");
+        ref.TargetNodeId = NumericNodeId(2932);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2935");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2935);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2915");
+        ref.TargetNodeId = NumericNodeId(2915);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2935");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2935);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2949");
+        ref.TargetNodeId = NumericNodeId(2949);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3071,12 +3071,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11322");
+        node.RequestedNewNodeId = NumericNodeId(11322);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2935");
+        node.ParentNodeId = NumericNodeId(2935);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3088,9 +3088,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11322");
+        ref.SourceNodeId = NumericNodeId(11322);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3098,12 +3098,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2936");
+        node.RequestedNewNodeId = NumericNodeId(2936);
         node.BrowseName = ToQualifiedName("UnshelvedToOneShotShelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("UnshelvedToOneShotShelved");
         attrs.EventNotifier = 0;
@@ -3114,45 +3114,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2936");
+        ref.SourceNodeId = NumericNodeId(2936);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11323");
+        ref.TargetNodeId = NumericNodeId(11323);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2936");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2936);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2930");
+        ref.TargetNodeId = NumericNodeId(2930);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2936");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2936);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2933");
+        ref.TargetNodeId = NumericNodeId(2933);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2936");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2936);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2915");
+        ref.TargetNodeId = NumericNodeId(2915);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2936");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2936);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2948");
+        ref.TargetNodeId = NumericNodeId(2948);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3160,12 +3160,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11323");
+        node.RequestedNewNodeId = NumericNodeId(11323);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2936");
+        node.ParentNodeId = NumericNodeId(2936);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3177,9 +3177,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11323");
+        ref.SourceNodeId = NumericNodeId(11323);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3187,12 +3187,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2940");
+        node.RequestedNewNodeId = NumericNodeId(2940);
         node.BrowseName = ToQualifiedName("TimedShelvedToUnshelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("TimedShelvedToUnshelved");
         attrs.EventNotifier = 0;
@@ -3203,45 +3203,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2940");
+        ref.SourceNodeId = NumericNodeId(2940);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11324");
+        ref.TargetNodeId = NumericNodeId(11324);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2940");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2940);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2932");
+        ref.TargetNodeId = NumericNodeId(2932);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2940");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2940);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2930");
+        ref.TargetNodeId = NumericNodeId(2930);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2940");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2940);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2915");
+        ref.TargetNodeId = NumericNodeId(2915);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2940");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2940);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2947");
+        ref.TargetNodeId = NumericNodeId(2947);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3249,12 +3249,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11324");
+        node.RequestedNewNodeId = NumericNodeId(11324);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2940");
+        node.ParentNodeId = NumericNodeId(2940);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3266,9 +3266,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11324");
+        ref.SourceNodeId = NumericNodeId(11324);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3276,12 +3276,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2942");
+        node.RequestedNewNodeId = NumericNodeId(2942);
         node.BrowseName = ToQualifiedName("TimedShelvedToOneShotShelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("TimedShelvedToOneShotShelved");
         attrs.EventNotifier = 0;
@@ -3292,45 +3292,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2942");
+        ref.SourceNodeId = NumericNodeId(2942);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11325");
+        ref.TargetNodeId = NumericNodeId(11325);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2942");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2942);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2932");
+        ref.TargetNodeId = NumericNodeId(2932);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2942");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2942);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2933");
+        ref.TargetNodeId = NumericNodeId(2933);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2942");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2942);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2915");
+        ref.TargetNodeId = NumericNodeId(2915);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2942");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2942);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2948");
+        ref.TargetNodeId = NumericNodeId(2948);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3338,12 +3338,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11325");
+        node.RequestedNewNodeId = NumericNodeId(11325);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2942");
+        node.ParentNodeId = NumericNodeId(2942);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3355,9 +3355,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11325");
+        ref.SourceNodeId = NumericNodeId(11325);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3365,12 +3365,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2943");
+        node.RequestedNewNodeId = NumericNodeId(2943);
         node.BrowseName = ToQualifiedName("OneShotShelvedToUnshelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("OneShotShelvedToUnshelved");
         attrs.EventNotifier = 0;
@@ -3381,45 +3381,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2943");
+        ref.SourceNodeId = NumericNodeId(2943);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11326");
+        ref.TargetNodeId = NumericNodeId(11326);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2943");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2943);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2933");
+        ref.TargetNodeId = NumericNodeId(2933);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2943");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2943);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2930");
+        ref.TargetNodeId = NumericNodeId(2930);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2943");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2943);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2915");
+        ref.TargetNodeId = NumericNodeId(2915);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2943");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2943);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2947");
+        ref.TargetNodeId = NumericNodeId(2947);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3427,12 +3427,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11326");
+        node.RequestedNewNodeId = NumericNodeId(11326);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2943");
+        node.ParentNodeId = NumericNodeId(2943);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3444,9 +3444,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11326");
+        ref.SourceNodeId = NumericNodeId(11326);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3454,12 +3454,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2945");
+        node.RequestedNewNodeId = NumericNodeId(2945);
         node.BrowseName = ToQualifiedName("OneShotShelvedToTimedShelved");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=2929");
+        node.ParentNodeId = NumericNodeId(2929);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("OneShotShelvedToTimedShelved");
         attrs.EventNotifier = 0;
@@ -3470,45 +3470,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2945");
+        ref.SourceNodeId = NumericNodeId(2945);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11327");
+        ref.TargetNodeId = NumericNodeId(11327);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=2945");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(2945);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2933");
+        ref.TargetNodeId = NumericNodeId(2933);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=2945");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(2945);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2932");
+        ref.TargetNodeId = NumericNodeId(2932);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=54");
-        ref.SourceNodeId = ToNodeId("i=2945");
+        ref.ReferenceTypeId = NumericNodeId(54);
+        ref.SourceNodeId = NumericNodeId(2945);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2915");
+        ref.TargetNodeId = NumericNodeId(2915);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=53");
-        ref.SourceNodeId = ToNodeId("i=2945");
+        ref.ReferenceTypeId = NumericNodeId(53);
+        ref.SourceNodeId = NumericNodeId(2945);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=2949");
+        ref.TargetNodeId = NumericNodeId(2949);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3516,12 +3516,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11327");
+        node.RequestedNewNodeId = NumericNodeId(11327);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2945");
+        node.ParentNodeId = NumericNodeId(2945);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3533,9 +3533,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11327");
+        ref.SourceNodeId = NumericNodeId(11327);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3543,15 +3543,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2991");
+        node.RequestedNewNodeId = NumericNodeId(2991);
         node.BrowseName = ToQualifiedName("InputArguments");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2949");
+        node.ParentNodeId = NumericNodeId(2949);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("InputArguments");
-        attrs.Type = ToNodeId("i=296");
+        attrs.Type = NumericNodeId(296);
         attrs.Rank = 1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -3560,9 +3560,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=2991");
+        ref.SourceNodeId = NumericNodeId(2991);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3570,10 +3570,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2955");
+        node.RequestedNewNodeId = NumericNodeId(2955);
         node.BrowseName = ToQualifiedName("LimitAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("LimitAlarmType");
@@ -3585,36 +3585,36 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2955");
+        ref.SourceNodeId = NumericNodeId(2955);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11124");
+        ref.TargetNodeId = NumericNodeId(11124);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2955");
+        ref.SourceNodeId = NumericNodeId(2955);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11125");
+        ref.TargetNodeId = NumericNodeId(11125);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2955");
+        ref.SourceNodeId = NumericNodeId(2955);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11126");
+        ref.TargetNodeId = NumericNodeId(11126);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2955");
+        ref.SourceNodeId = NumericNodeId(2955);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11127");
+        ref.TargetNodeId = NumericNodeId(11127);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3622,12 +3622,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11124");
+        node.RequestedNewNodeId = NumericNodeId(11124);
         node.BrowseName = ToQualifiedName("HighHighLimit");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2955");
+        node.ParentNodeId = NumericNodeId(2955);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("HighHighLimit");
         attrs.Type = ObjectId::Double;
@@ -3639,9 +3639,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11124");
+        ref.SourceNodeId = NumericNodeId(11124);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3649,12 +3649,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11125");
+        node.RequestedNewNodeId = NumericNodeId(11125);
         node.BrowseName = ToQualifiedName("HighLimit");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2955");
+        node.ParentNodeId = NumericNodeId(2955);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("HighLimit");
         attrs.Type = ObjectId::Double;
@@ -3666,9 +3666,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11125");
+        ref.SourceNodeId = NumericNodeId(11125);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3676,12 +3676,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11126");
+        node.RequestedNewNodeId = NumericNodeId(11126);
         node.BrowseName = ToQualifiedName("LowLimit");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2955");
+        node.ParentNodeId = NumericNodeId(2955);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LowLimit");
         attrs.Type = ObjectId::Double;
@@ -3693,9 +3693,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11126");
+        ref.SourceNodeId = NumericNodeId(11126);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3703,12 +3703,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11127");
+        node.RequestedNewNodeId = NumericNodeId(11127);
         node.BrowseName = ToQualifiedName("LowLowLimit");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2955");
+        node.ParentNodeId = NumericNodeId(2955);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LowLowLimit");
         attrs.Type = ObjectId::Double;
@@ -3720,9 +3720,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11127");
+        ref.SourceNodeId = NumericNodeId(11127);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3730,10 +3730,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9318");
+        node.RequestedNewNodeId = NumericNodeId(9318);
         node.BrowseName = ToQualifiedName("ExclusiveLimitStateMachineType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2771");
+        node.ParentNodeId = NumericNodeId(2771);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ExclusiveLimitStateMachineType");
@@ -3745,72 +3745,72 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9329");
+        ref.TargetNodeId = NumericNodeId(9329);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9331");
+        ref.TargetNodeId = NumericNodeId(9331);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9333");
+        ref.TargetNodeId = NumericNodeId(9333);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9335");
+        ref.TargetNodeId = NumericNodeId(9335);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9337");
+        ref.TargetNodeId = NumericNodeId(9337);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9338");
+        ref.TargetNodeId = NumericNodeId(9338);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9339");
+        ref.TargetNodeId = NumericNodeId(9339);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9318");
+        ref.SourceNodeId = NumericNodeId(9318);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9340");
+        ref.TargetNodeId = NumericNodeId(9340);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3818,12 +3818,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9329");
+        node.RequestedNewNodeId = NumericNodeId(9329);
         node.BrowseName = ToQualifiedName("HighHigh");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("HighHigh");
         attrs.EventNotifier = 0;
@@ -3834,9 +3834,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9329");
+        ref.SourceNodeId = NumericNodeId(9329);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9330");
+        ref.TargetNodeId = NumericNodeId(9330);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3844,12 +3844,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9330");
+        node.RequestedNewNodeId = NumericNodeId(9330);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9329");
+        node.ParentNodeId = NumericNodeId(9329);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3861,9 +3861,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9330");
+        ref.SourceNodeId = NumericNodeId(9330);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3871,12 +3871,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9331");
+        node.RequestedNewNodeId = NumericNodeId(9331);
         node.BrowseName = ToQualifiedName("High");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("High");
         attrs.EventNotifier = 0;
@@ -3887,9 +3887,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9331");
+        ref.SourceNodeId = NumericNodeId(9331);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9332");
+        ref.TargetNodeId = NumericNodeId(9332);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3897,12 +3897,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9332");
+        node.RequestedNewNodeId = NumericNodeId(9332);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9331");
+        node.ParentNodeId = NumericNodeId(9331);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3914,9 +3914,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9332");
+        ref.SourceNodeId = NumericNodeId(9332);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3924,12 +3924,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9333");
+        node.RequestedNewNodeId = NumericNodeId(9333);
         node.BrowseName = ToQualifiedName("Low");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("Low");
         attrs.EventNotifier = 0;
@@ -3940,9 +3940,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9333");
+        ref.SourceNodeId = NumericNodeId(9333);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9334");
+        ref.TargetNodeId = NumericNodeId(9334);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3950,12 +3950,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9334");
+        node.RequestedNewNodeId = NumericNodeId(9334);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9333");
+        node.ParentNodeId = NumericNodeId(9333);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -3967,9 +3967,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9334");
+        ref.SourceNodeId = NumericNodeId(9334);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -3977,12 +3977,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9335");
+        node.RequestedNewNodeId = NumericNodeId(9335);
         node.BrowseName = ToQualifiedName("LowLow");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2307");
+        node.TypeDefinition = NumericNodeId(2307);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("LowLow");
         attrs.EventNotifier = 0;
@@ -3993,9 +3993,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9335");
+        ref.SourceNodeId = NumericNodeId(9335);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9336");
+        ref.TargetNodeId = NumericNodeId(9336);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4003,12 +4003,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9336");
+        node.RequestedNewNodeId = NumericNodeId(9336);
         node.BrowseName = ToQualifiedName("StateNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9335");
+        node.ParentNodeId = NumericNodeId(9335);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("StateNumber");
         attrs.Type = ObjectId::UInt32;
@@ -4020,9 +4020,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9336");
+        ref.SourceNodeId = NumericNodeId(9336);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4030,12 +4030,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9337");
+        node.RequestedNewNodeId = NumericNodeId(9337);
         node.BrowseName = ToQualifiedName("LowLowToLow");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("LowLowToLow");
         attrs.EventNotifier = 0;
@@ -4046,27 +4046,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9337");
+        ref.SourceNodeId = NumericNodeId(9337);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11340");
+        ref.TargetNodeId = NumericNodeId(11340);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=9337");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(9337);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9335");
+        ref.TargetNodeId = NumericNodeId(9335);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=9337");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(9337);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9333");
+        ref.TargetNodeId = NumericNodeId(9333);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4074,12 +4074,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11340");
+        node.RequestedNewNodeId = NumericNodeId(11340);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9337");
+        node.ParentNodeId = NumericNodeId(9337);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -4091,9 +4091,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11340");
+        ref.SourceNodeId = NumericNodeId(11340);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4101,12 +4101,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9338");
+        node.RequestedNewNodeId = NumericNodeId(9338);
         node.BrowseName = ToQualifiedName("LowToLowLow");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("LowToLowLow");
         attrs.EventNotifier = 0;
@@ -4117,27 +4117,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9338");
+        ref.SourceNodeId = NumericNodeId(9338);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11341");
+        ref.TargetNodeId = NumericNodeId(11341);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=9338");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(9338);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9333");
+        ref.TargetNodeId = NumericNodeId(9333);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=9338");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(9338);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9335");
+        ref.TargetNodeId = NumericNodeId(9335);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4145,12 +4145,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11341");
+        node.RequestedNewNodeId = NumericNodeId(11341);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9338");
+        node.ParentNodeId = NumericNodeId(9338);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -4162,9 +4162,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11341");
+        ref.SourceNodeId = NumericNodeId(11341);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4172,12 +4172,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9339");
+        node.RequestedNewNodeId = NumericNodeId(9339);
         node.BrowseName = ToQualifiedName("HighHighToHigh");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("HighHighToHigh");
         attrs.EventNotifier = 0;
@@ -4188,27 +4188,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9339");
+        ref.SourceNodeId = NumericNodeId(9339);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11342");
+        ref.TargetNodeId = NumericNodeId(11342);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=9339");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(9339);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9329");
+        ref.TargetNodeId = NumericNodeId(9329);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=9339");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(9339);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9331");
+        ref.TargetNodeId = NumericNodeId(9331);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4216,12 +4216,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11342");
+        node.RequestedNewNodeId = NumericNodeId(11342);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9339");
+        node.ParentNodeId = NumericNodeId(9339);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -4233,9 +4233,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11342");
+        ref.SourceNodeId = NumericNodeId(11342);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4243,12 +4243,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9340");
+        node.RequestedNewNodeId = NumericNodeId(9340);
         node.BrowseName = ToQualifiedName("HighToHighHigh");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9318");
+        node.ParentNodeId = NumericNodeId(9318);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2310");
+        node.TypeDefinition = NumericNodeId(2310);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("HighToHighHigh");
         attrs.EventNotifier = 0;
@@ -4259,27 +4259,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9340");
+        ref.SourceNodeId = NumericNodeId(9340);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11343");
+        ref.TargetNodeId = NumericNodeId(11343);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=51");
-        ref.SourceNodeId = ToNodeId("i=9340");
+        ref.ReferenceTypeId = NumericNodeId(51);
+        ref.SourceNodeId = NumericNodeId(9340);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9331");
+        ref.TargetNodeId = NumericNodeId(9331);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=52");
-        ref.SourceNodeId = ToNodeId("i=9340");
+        ref.ReferenceTypeId = NumericNodeId(52);
+        ref.SourceNodeId = NumericNodeId(9340);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9329");
+        ref.TargetNodeId = NumericNodeId(9329);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4287,12 +4287,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11343");
+        node.RequestedNewNodeId = NumericNodeId(11343);
         node.BrowseName = ToQualifiedName("TransitionNumber");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9340");
+        node.ParentNodeId = NumericNodeId(9340);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionNumber");
         attrs.Type = ObjectId::UInt32;
@@ -4304,9 +4304,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11343");
+        ref.SourceNodeId = NumericNodeId(11343);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4314,10 +4314,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9341");
+        node.RequestedNewNodeId = NumericNodeId(9341);
         node.BrowseName = ToQualifiedName("ExclusiveLimitAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2955");
+        node.ParentNodeId = NumericNodeId(2955);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ExclusiveLimitAlarmType");
@@ -4329,18 +4329,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9341");
+        ref.SourceNodeId = NumericNodeId(9341);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9398");
+        ref.TargetNodeId = NumericNodeId(9398);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9341");
+        ref.SourceNodeId = NumericNodeId(9341);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9455");
+        ref.TargetNodeId = NumericNodeId(9455);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4348,12 +4348,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9398");
+        node.RequestedNewNodeId = NumericNodeId(9398);
         node.BrowseName = ToQualifiedName("ActiveState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9341");
+        node.ParentNodeId = NumericNodeId(9341);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ActiveState");
         attrs.Type = ObjectId::LocalizedText;
@@ -4365,27 +4365,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9398");
+        ref.SourceNodeId = NumericNodeId(9398);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9399");
+        ref.TargetNodeId = NumericNodeId(9399);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9398");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9398);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9455");
+        ref.TargetNodeId = NumericNodeId(9455);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9398");
+        ref.SourceNodeId = NumericNodeId(9398);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4393,12 +4393,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9399");
+        node.RequestedNewNodeId = NumericNodeId(9399);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9398");
+        node.ParentNodeId = NumericNodeId(9398);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -4410,9 +4410,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9399");
+        ref.SourceNodeId = NumericNodeId(9399);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4420,12 +4420,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9455");
+        node.RequestedNewNodeId = NumericNodeId(9455);
         node.BrowseName = ToQualifiedName("LimitState");
         node.Class = NodeClass::Object;
-        node.ParentNodeId = ToNodeId("i=9341");
+        node.ParentNodeId = NumericNodeId(9341);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=9318");
+        node.TypeDefinition = NumericNodeId(9318);
         ObjectAttributes attrs;
         attrs.DisplayName = LocalizedText("LimitState");
         attrs.EventNotifier = 0;
@@ -4436,27 +4436,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9455");
+        ref.SourceNodeId = NumericNodeId(9455);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9456");
+        ref.TargetNodeId = NumericNodeId(9456);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9455");
+        ref.SourceNodeId = NumericNodeId(9455);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9461");
+        ref.TargetNodeId = NumericNodeId(9461);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9455");
+        ref.SourceNodeId = NumericNodeId(9455);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4464,12 +4464,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9456");
+        node.RequestedNewNodeId = NumericNodeId(9456);
         node.BrowseName = ToQualifiedName("CurrentState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9455");
+        node.ParentNodeId = NumericNodeId(9455);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2760");
+        node.TypeDefinition = NumericNodeId(2760);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("CurrentState");
         attrs.Type = ObjectId::LocalizedText;
@@ -4481,18 +4481,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9456");
+        ref.SourceNodeId = NumericNodeId(9456);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9457");
+        ref.TargetNodeId = NumericNodeId(9457);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9456");
+        ref.SourceNodeId = NumericNodeId(9456);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4500,12 +4500,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9457");
+        node.RequestedNewNodeId = NumericNodeId(9457);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9456");
+        node.ParentNodeId = NumericNodeId(9456);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::NodeId;
@@ -4517,9 +4517,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9457");
+        ref.SourceNodeId = NumericNodeId(9457);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4527,12 +4527,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9461");
+        node.RequestedNewNodeId = NumericNodeId(9461);
         node.BrowseName = ToQualifiedName("LastTransition");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9455");
+        node.ParentNodeId = NumericNodeId(9455);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=2767");
+        node.TypeDefinition = NumericNodeId(2767);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LastTransition");
         attrs.Type = ObjectId::LocalizedText;
@@ -4544,27 +4544,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9461");
+        ref.SourceNodeId = NumericNodeId(9461);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9462");
+        ref.TargetNodeId = NumericNodeId(9462);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9461");
+        ref.SourceNodeId = NumericNodeId(9461);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9465");
+        ref.TargetNodeId = NumericNodeId(9465);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9461");
+        ref.SourceNodeId = NumericNodeId(9461);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4572,12 +4572,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9462");
+        node.RequestedNewNodeId = NumericNodeId(9462);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9461");
+        node.ParentNodeId = NumericNodeId(9461);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::NodeId;
@@ -4589,9 +4589,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9462");
+        ref.SourceNodeId = NumericNodeId(9462);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4599,15 +4599,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9465");
+        node.RequestedNewNodeId = NumericNodeId(9465);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9461");
+        node.ParentNodeId = NumericNodeId(9461);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -4616,9 +4616,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9465");
+        ref.SourceNodeId = NumericNodeId(9465);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4626,10 +4626,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9906");
+        node.RequestedNewNodeId = NumericNodeId(9906);
         node.BrowseName = ToQualifiedName("NonExclusiveLimitAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2955");
+        node.ParentNodeId = NumericNodeId(2955);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("NonExclusiveLimitAlarmType");
@@ -4641,45 +4641,45 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9906");
+        ref.SourceNodeId = NumericNodeId(9906);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9963");
+        ref.TargetNodeId = NumericNodeId(9963);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9906");
+        ref.SourceNodeId = NumericNodeId(9906);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10020");
+        ref.TargetNodeId = NumericNodeId(10020);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9906");
+        ref.SourceNodeId = NumericNodeId(9906);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10029");
+        ref.TargetNodeId = NumericNodeId(10029);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9906");
+        ref.SourceNodeId = NumericNodeId(9906);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10038");
+        ref.TargetNodeId = NumericNodeId(10038);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasComponent;
-        ref.SourceNodeId = ToNodeId("i=9906");
+        ref.SourceNodeId = NumericNodeId(9906);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10047");
+        ref.TargetNodeId = NumericNodeId(10047);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4687,12 +4687,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9963");
+        node.RequestedNewNodeId = NumericNodeId(9963);
         node.BrowseName = ToQualifiedName("ActiveState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ActiveState");
         attrs.Type = ObjectId::LocalizedText;
@@ -4704,54 +4704,54 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9963");
+        ref.SourceNodeId = NumericNodeId(9963);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9964");
+        ref.TargetNodeId = NumericNodeId(9964);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9963");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9963);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10020");
+        ref.TargetNodeId = NumericNodeId(10020);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9963");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9963);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10029");
+        ref.TargetNodeId = NumericNodeId(10029);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9963");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9963);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10038");
+        ref.TargetNodeId = NumericNodeId(10038);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
-        ref.ReferenceTypeId = ToNodeId("i=9004");
-        ref.SourceNodeId = ToNodeId("i=9963");
+        ref.ReferenceTypeId = NumericNodeId(9004);
+        ref.SourceNodeId = NumericNodeId(9963);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10047");
+        ref.TargetNodeId = NumericNodeId(10047);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9963");
+        ref.SourceNodeId = NumericNodeId(9963);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4759,12 +4759,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9964");
+        node.RequestedNewNodeId = NumericNodeId(9964);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9963");
+        node.ParentNodeId = NumericNodeId(9963);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -4776,9 +4776,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9964");
+        ref.SourceNodeId = NumericNodeId(9964);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4786,12 +4786,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10020");
+        node.RequestedNewNodeId = NumericNodeId(10020);
         node.BrowseName = ToQualifiedName("HighHighState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("HighHighState");
         attrs.Type = ObjectId::LocalizedText;
@@ -4803,27 +4803,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10020");
+        ref.SourceNodeId = NumericNodeId(10020);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10021");
+        ref.TargetNodeId = NumericNodeId(10021);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10020");
+        ref.SourceNodeId = NumericNodeId(10020);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10025");
+        ref.TargetNodeId = NumericNodeId(10025);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10020");
+        ref.SourceNodeId = NumericNodeId(10020);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4831,12 +4831,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10021");
+        node.RequestedNewNodeId = NumericNodeId(10021);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10020");
+        node.ParentNodeId = NumericNodeId(10020);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -4848,9 +4848,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10021");
+        ref.SourceNodeId = NumericNodeId(10021);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4858,15 +4858,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10025");
+        node.RequestedNewNodeId = NumericNodeId(10025);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10020");
+        node.ParentNodeId = NumericNodeId(10020);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -4875,9 +4875,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10025");
+        ref.SourceNodeId = NumericNodeId(10025);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4885,12 +4885,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10029");
+        node.RequestedNewNodeId = NumericNodeId(10029);
         node.BrowseName = ToQualifiedName("HighState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("HighState");
         attrs.Type = ObjectId::LocalizedText;
@@ -4902,27 +4902,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10029");
+        ref.SourceNodeId = NumericNodeId(10029);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10030");
+        ref.TargetNodeId = NumericNodeId(10030);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10029");
+        ref.SourceNodeId = NumericNodeId(10029);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10034");
+        ref.TargetNodeId = NumericNodeId(10034);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10029");
+        ref.SourceNodeId = NumericNodeId(10029);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4930,12 +4930,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10030");
+        node.RequestedNewNodeId = NumericNodeId(10030);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10029");
+        node.ParentNodeId = NumericNodeId(10029);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -4947,9 +4947,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10030");
+        ref.SourceNodeId = NumericNodeId(10030);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4957,15 +4957,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10034");
+        node.RequestedNewNodeId = NumericNodeId(10034);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10029");
+        node.ParentNodeId = NumericNodeId(10029);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -4974,9 +4974,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10034");
+        ref.SourceNodeId = NumericNodeId(10034);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -4984,12 +4984,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10038");
+        node.RequestedNewNodeId = NumericNodeId(10038);
         node.BrowseName = ToQualifiedName("LowState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LowState");
         attrs.Type = ObjectId::LocalizedText;
@@ -5001,27 +5001,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10038");
+        ref.SourceNodeId = NumericNodeId(10038);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10039");
+        ref.TargetNodeId = NumericNodeId(10039);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10038");
+        ref.SourceNodeId = NumericNodeId(10038);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10043");
+        ref.TargetNodeId = NumericNodeId(10043);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10038");
+        ref.SourceNodeId = NumericNodeId(10038);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5029,12 +5029,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10039");
+        node.RequestedNewNodeId = NumericNodeId(10039);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10038");
+        node.ParentNodeId = NumericNodeId(10038);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -5046,9 +5046,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10039");
+        ref.SourceNodeId = NumericNodeId(10039);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5056,15 +5056,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10043");
+        node.RequestedNewNodeId = NumericNodeId(10043);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10038");
+        node.ParentNodeId = NumericNodeId(10038);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -5073,9 +5073,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10043");
+        ref.SourceNodeId = NumericNodeId(10043);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5083,12 +5083,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10047");
+        node.RequestedNewNodeId = NumericNodeId(10047);
         node.BrowseName = ToQualifiedName("LowLowState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasComponent;
-        node.TypeDefinition = ToNodeId("i=8995");
+        node.TypeDefinition = NumericNodeId(8995);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("LowLowState");
         attrs.Type = ObjectId::LocalizedText;
@@ -5100,27 +5100,27 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10047");
+        ref.SourceNodeId = NumericNodeId(10047);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10048");
+        ref.TargetNodeId = NumericNodeId(10048);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10047");
+        ref.SourceNodeId = NumericNodeId(10047);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10052");
+        ref.TargetNodeId = NumericNodeId(10052);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10047");
+        ref.SourceNodeId = NumericNodeId(10047);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5128,12 +5128,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10048");
+        node.RequestedNewNodeId = NumericNodeId(10048);
         node.BrowseName = ToQualifiedName("Id");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10047");
+        node.ParentNodeId = NumericNodeId(10047);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Id");
         attrs.Type = ObjectId::Boolean;
@@ -5145,9 +5145,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10048");
+        ref.SourceNodeId = NumericNodeId(10048);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5155,15 +5155,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10052");
+        node.RequestedNewNodeId = NumericNodeId(10052);
         node.BrowseName = ToQualifiedName("TransitionTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10047");
+        node.ParentNodeId = NumericNodeId(10047);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("TransitionTime");
-        attrs.Type = ToNodeId("i=294");
+        attrs.Type = NumericNodeId(294);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -5172,9 +5172,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10052");
+        ref.SourceNodeId = NumericNodeId(10052);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=80");
+        ref.TargetNodeId = NumericNodeId(80);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5182,10 +5182,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10060");
+        node.RequestedNewNodeId = NumericNodeId(10060);
         node.BrowseName = ToQualifiedName("NonExclusiveLevelAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("NonExclusiveLevelAlarmType");
@@ -5196,10 +5196,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9482");
+        node.RequestedNewNodeId = NumericNodeId(9482);
         node.BrowseName = ToQualifiedName("ExclusiveLevelAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=9341");
+        node.ParentNodeId = NumericNodeId(9341);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ExclusiveLevelAlarmType");
@@ -5210,10 +5210,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10368");
+        node.RequestedNewNodeId = NumericNodeId(10368);
         node.BrowseName = ToQualifiedName("NonExclusiveDeviationAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("NonExclusiveDeviationAlarmType");
@@ -5225,9 +5225,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10368");
+        ref.SourceNodeId = NumericNodeId(10368);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=10522");
+        ref.TargetNodeId = NumericNodeId(10522);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5235,12 +5235,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10522");
+        node.RequestedNewNodeId = NumericNodeId(10522);
         node.BrowseName = ToQualifiedName("SetpointNode");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10368");
+        node.ParentNodeId = NumericNodeId(10368);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SetpointNode");
         attrs.Type = ObjectId::NodeId;
@@ -5252,9 +5252,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=10522");
+        ref.SourceNodeId = NumericNodeId(10522);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5262,10 +5262,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9764");
+        node.RequestedNewNodeId = NumericNodeId(9764);
         node.BrowseName = ToQualifiedName("ExclusiveDeviationAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=9341");
+        node.ParentNodeId = NumericNodeId(9341);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ExclusiveDeviationAlarmType");
@@ -5277,9 +5277,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=9764");
+        ref.SourceNodeId = NumericNodeId(9764);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=9905");
+        ref.TargetNodeId = NumericNodeId(9905);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5287,12 +5287,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9905");
+        node.RequestedNewNodeId = NumericNodeId(9905);
         node.BrowseName = ToQualifiedName("SetpointNode");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=9764");
+        node.ParentNodeId = NumericNodeId(9764);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SetpointNode");
         attrs.Type = ObjectId::NodeId;
@@ -5304,9 +5304,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=9905");
+        ref.SourceNodeId = NumericNodeId(9905);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5314,10 +5314,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10214");
+        node.RequestedNewNodeId = NumericNodeId(10214);
         node.BrowseName = ToQualifiedName("NonExclusiveRateOfChangeAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=9906");
+        node.ParentNodeId = NumericNodeId(9906);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("NonExclusiveRateOfChangeAlarmType");
@@ -5328,10 +5328,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9623");
+        node.RequestedNewNodeId = NumericNodeId(9623);
         node.BrowseName = ToQualifiedName("ExclusiveRateOfChangeAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=9341");
+        node.ParentNodeId = NumericNodeId(9341);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ExclusiveRateOfChangeAlarmType");
@@ -5342,10 +5342,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10523");
+        node.RequestedNewNodeId = NumericNodeId(10523);
         node.BrowseName = ToQualifiedName("DiscreteAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2915");
+        node.ParentNodeId = NumericNodeId(2915);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("DiscreteAlarmType");
@@ -5356,10 +5356,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10637");
+        node.RequestedNewNodeId = NumericNodeId(10637);
         node.BrowseName = ToQualifiedName("OffNormalAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=10523");
+        node.ParentNodeId = NumericNodeId(10523);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("OffNormalAlarmType");
@@ -5371,9 +5371,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=10637");
+        ref.SourceNodeId = NumericNodeId(10637);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11158");
+        ref.TargetNodeId = NumericNodeId(11158);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5381,12 +5381,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11158");
+        node.RequestedNewNodeId = NumericNodeId(11158);
         node.BrowseName = ToQualifiedName("NormalState");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=10637");
+        node.ParentNodeId = NumericNodeId(10637);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("NormalState");
         attrs.Type = ObjectId::NodeId;
@@ -5398,9 +5398,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11158");
+        ref.SourceNodeId = NumericNodeId(11158);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5408,10 +5408,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11753");
+        node.RequestedNewNodeId = NumericNodeId(11753);
         node.BrowseName = ToQualifiedName("SystemOffNormalAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=10637");
+        node.ParentNodeId = NumericNodeId(10637);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("SystemOffNormalAlarmType");
@@ -5422,10 +5422,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=10751");
+        node.RequestedNewNodeId = NumericNodeId(10751);
         node.BrowseName = ToQualifiedName("TripAlarmType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=10637");
+        node.ParentNodeId = NumericNodeId(10637);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("TripAlarmType");
@@ -5436,10 +5436,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11163");
+        node.RequestedNewNodeId = NumericNodeId(11163);
         node.BrowseName = ToQualifiedName("BaseConditionClassType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=58");
+        node.ParentNodeId = NumericNodeId(58);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("BaseConditionClassType");
@@ -5450,10 +5450,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11164");
+        node.RequestedNewNodeId = NumericNodeId(11164);
         node.BrowseName = ToQualifiedName("ProcessConditionClassType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=11163");
+        node.ParentNodeId = NumericNodeId(11163);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("ProcessConditionClassType");
@@ -5464,10 +5464,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11165");
+        node.RequestedNewNodeId = NumericNodeId(11165);
         node.BrowseName = ToQualifiedName("MaintenanceConditionClassType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=11163");
+        node.ParentNodeId = NumericNodeId(11163);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("MaintenanceConditionClassType");
@@ -5478,10 +5478,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11166");
+        node.RequestedNewNodeId = NumericNodeId(11166);
         node.BrowseName = ToQualifiedName("SystemConditionClassType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=11163");
+        node.ParentNodeId = NumericNodeId(11163);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("SystemConditionClassType");
@@ -5492,10 +5492,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2790");
+        node.RequestedNewNodeId = NumericNodeId(2790);
         node.BrowseName = ToQualifiedName("AuditConditionEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2127");
+        node.ParentNodeId = NumericNodeId(2127);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditConditionEventType");
@@ -5506,10 +5506,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2803");
+        node.RequestedNewNodeId = NumericNodeId(2803);
         node.BrowseName = ToQualifiedName("AuditConditionEnableEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2790");
+        node.ParentNodeId = NumericNodeId(2790);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditConditionEnableEventType");
@@ -5520,10 +5520,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2829");
+        node.RequestedNewNodeId = NumericNodeId(2829);
         node.BrowseName = ToQualifiedName("AuditConditionCommentEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2790");
+        node.ParentNodeId = NumericNodeId(2790);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditConditionCommentEventType");
@@ -5535,18 +5535,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2829");
+        ref.SourceNodeId = NumericNodeId(2829);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=4170");
+        ref.TargetNodeId = NumericNodeId(4170);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=2829");
+        ref.SourceNodeId = NumericNodeId(2829);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11851");
+        ref.TargetNodeId = NumericNodeId(11851);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5554,12 +5554,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=4170");
+        node.RequestedNewNodeId = NumericNodeId(4170);
         node.BrowseName = ToQualifiedName("EventId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2829");
+        node.ParentNodeId = NumericNodeId(2829);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("A globally unique identifier for the event.");
         attrs.DisplayName = LocalizedText("EventId");
@@ -5572,9 +5572,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=4170");
+        ref.SourceNodeId = NumericNodeId(4170);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5582,12 +5582,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11851");
+        node.RequestedNewNodeId = NumericNodeId(11851);
         node.BrowseName = ToQualifiedName("Comment");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=2829");
+        node.ParentNodeId = NumericNodeId(2829);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Comment");
         attrs.Type = ObjectId::LocalizedText;
@@ -5599,9 +5599,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11851");
+        ref.SourceNodeId = NumericNodeId(11851);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5609,10 +5609,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8927");
+        node.RequestedNewNodeId = NumericNodeId(8927);
         node.BrowseName = ToQualifiedName("AuditConditionRespondEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2790");
+        node.ParentNodeId = NumericNodeId(2790);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditConditionRespondEventType");
@@ -5624,9 +5624,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8927");
+        ref.SourceNodeId = NumericNodeId(8927);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11852");
+        ref.TargetNodeId = NumericNodeId(11852);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5634,12 +5634,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11852");
+        node.RequestedNewNodeId = NumericNodeId(11852);
         node.BrowseName = ToQualifiedName("SelectedResponse");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8927");
+        node.ParentNodeId = NumericNodeId(8927);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("SelectedResponse");
         attrs.Type = ObjectId::Int32;
@@ -5651,9 +5651,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11852");
+        ref.SourceNodeId = NumericNodeId(11852);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5661,10 +5661,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8944");
+        node.RequestedNewNodeId = NumericNodeId(8944);
         node.BrowseName = ToQualifiedName("AuditConditionAcknowledgeEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2790");
+        node.ParentNodeId = NumericNodeId(2790);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditConditionAcknowledgeEventType");
@@ -5676,18 +5676,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8944");
+        ref.SourceNodeId = NumericNodeId(8944);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8945");
+        ref.TargetNodeId = NumericNodeId(8945);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8944");
+        ref.SourceNodeId = NumericNodeId(8944);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11853");
+        ref.TargetNodeId = NumericNodeId(11853);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5695,12 +5695,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8945");
+        node.RequestedNewNodeId = NumericNodeId(8945);
         node.BrowseName = ToQualifiedName("EventId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8944");
+        node.ParentNodeId = NumericNodeId(8944);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("A globally unique identifier for the event.");
         attrs.DisplayName = LocalizedText("EventId");
@@ -5713,9 +5713,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=8945");
+        ref.SourceNodeId = NumericNodeId(8945);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5723,12 +5723,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11853");
+        node.RequestedNewNodeId = NumericNodeId(11853);
         node.BrowseName = ToQualifiedName("Comment");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8944");
+        node.ParentNodeId = NumericNodeId(8944);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Comment");
         attrs.Type = ObjectId::LocalizedText;
@@ -5740,9 +5740,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11853");
+        ref.SourceNodeId = NumericNodeId(11853);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5750,10 +5750,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8961");
+        node.RequestedNewNodeId = NumericNodeId(8961);
         node.BrowseName = ToQualifiedName("AuditConditionConfirmEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2790");
+        node.ParentNodeId = NumericNodeId(2790);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditConditionConfirmEventType");
@@ -5765,18 +5765,18 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8961");
+        ref.SourceNodeId = NumericNodeId(8961);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=8962");
+        ref.TargetNodeId = NumericNodeId(8962);
         refs.push_back(ref);
         }
         {
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=8961");
+        ref.SourceNodeId = NumericNodeId(8961);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11854");
+        ref.TargetNodeId = NumericNodeId(11854);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5784,12 +5784,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=8962");
+        node.RequestedNewNodeId = NumericNodeId(8962);
         node.BrowseName = ToQualifiedName("EventId");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8961");
+        node.ParentNodeId = NumericNodeId(8961);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.Description = LocalizedText("A globally unique identifier for the event.");
         attrs.DisplayName = LocalizedText("EventId");
@@ -5802,9 +5802,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=8962");
+        ref.SourceNodeId = NumericNodeId(8962);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5812,12 +5812,12 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11854");
+        node.RequestedNewNodeId = NumericNodeId(11854);
         node.BrowseName = ToQualifiedName("Comment");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=8961");
+        node.ParentNodeId = NumericNodeId(8961);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("Comment");
         attrs.Type = ObjectId::LocalizedText;
@@ -5829,9 +5829,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11854");
+        ref.SourceNodeId = NumericNodeId(11854);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5839,10 +5839,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11093");
+        node.RequestedNewNodeId = NumericNodeId(11093);
         node.BrowseName = ToQualifiedName("AuditConditionShelvingEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2790");
+        node.ParentNodeId = NumericNodeId(2790);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("AuditConditionShelvingEventType");
@@ -5854,9 +5854,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasProperty;
-        ref.SourceNodeId = ToNodeId("i=11093");
+        ref.SourceNodeId = NumericNodeId(11093);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=11855");
+        ref.TargetNodeId = NumericNodeId(11855);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5864,15 +5864,15 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=11855");
+        node.RequestedNewNodeId = NumericNodeId(11855);
         node.BrowseName = ToQualifiedName("ShelvingTime");
         node.Class = NodeClass::Variable;
-        node.ParentNodeId = ToNodeId("i=11093");
+        node.ParentNodeId = NumericNodeId(11093);
         node.ReferenceTypeId = ReferenceId::HasProperty;
-        node.TypeDefinition = ToNodeId("i=68");
+        node.TypeDefinition = NumericNodeId(68);
         VariableAttributes attrs;
         attrs.DisplayName = LocalizedText("ShelvingTime");
-        attrs.Type = ToNodeId("i=290");
+        attrs.Type = NumericNodeId(290);
         attrs.Rank = -1;
         node.Attributes = attrs;
         registry.AddNodes(std::vector<AddNodesItem>{node});
@@ -5881,9 +5881,9 @@ namespace OpcUa
         AddReferencesItem ref;
         ref.IsForward = true;
         ref.ReferenceTypeId = ReferenceId::HasModellingRule;
-        ref.SourceNodeId = ToNodeId("i=11855");
+        ref.SourceNodeId = NumericNodeId(11855);
         ref.TargetNodeClass = NodeClass::DataType;
-        ref.TargetNodeId = ToNodeId("i=78");
+        ref.TargetNodeId = NumericNodeId(78);
         refs.push_back(ref);
         }
         registry.AddReferences(refs);
@@ -5891,10 +5891,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2787");
+        node.RequestedNewNodeId = NumericNodeId(2787);
         node.BrowseName = ToQualifiedName("RefreshStartEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2130");
+        node.ParentNodeId = NumericNodeId(2130);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("RefreshStartEventType");
@@ -5905,10 +5905,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2788");
+        node.RequestedNewNodeId = NumericNodeId(2788);
         node.BrowseName = ToQualifiedName("RefreshEndEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2130");
+        node.ParentNodeId = NumericNodeId(2130);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("RefreshEndEventType");
@@ -5919,10 +5919,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=2789");
+        node.RequestedNewNodeId = NumericNodeId(2789);
         node.BrowseName = ToQualifiedName("RefreshRequiredEventType");
         node.Class = NodeClass::ObjectType;
-        node.ParentNodeId = ToNodeId("i=2130");
+        node.ParentNodeId = NumericNodeId(2130);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ObjectTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("RefreshRequiredEventType");
@@ -5933,10 +5933,10 @@ namespace OpcUa
        
         {
         AddNodesItem node;
-        node.RequestedNewNodeId = ToNodeId("i=9006");
+        node.RequestedNewNodeId = NumericNodeId(9006);
         node.BrowseName = ToQualifiedName("HasCondition");
         node.Class = NodeClass::ReferenceType;
-        node.ParentNodeId = ToNodeId("i=32");
+        node.ParentNodeId = NumericNodeId(32);
         node.ReferenceTypeId = ReferenceId::HasSubtype;
         ReferenceTypeAttributes attrs;
         attrs.DisplayName = LocalizedText("HasCondition");
@@ -15,8 +15,11 @@
 #include <opc/ua/server/addons/services_registry.h>
 #include <opc/ua/server/address_space.h>
 #include <opc/ua/server/subscription_service.h>
+#include <opc/ua/protocol/object_ids.h>
+#include <opc/ua/protocol/string_utils.h>
 
 #include <iostream>
+#include <stdexcept>
 
 namespace
 {
@@ -34,6 +37,7 @@ namespace
       OpcUa::Server::AsioAddon::SharedPtr asio = manager.GetAddon<OpcUa::Server::AsioAddon>(OpcUa::Server::AsioAddonId);
       Subscriptions = OpcUa::Server::CreateSubscriptionService(addressSpace, asio->GetIoService(), Debug);
       Services->RegisterSubscriptionServices(Subscriptions);
+      RegisterConditionRefresh(*addressSpace);
     }
 
     void Stop()
@@ -49,6 +53,16 @@ namespace
       Subscriptions->TriggerEvent(node, event);
     }
 
+    OpcUa::StatusCode ReplayEvents(uint32_t subscriptionId, OpcUa::Duration period)
+    {
+      return Subscriptions->ReplayEvents(subscriptionId, period);
+    }
+
+    OpcUa::StatusCode RefreshConditions(uint32_t subscriptionId)
+    {
+      return Subscriptions->RefreshConditions(subscriptionId);
+    }
+
   public:
     OpcUa::SubscriptionData CreateSubscription(const OpcUa::CreateSubscriptionRequest& request, std::function<void (OpcUa::PublishResult)> callback)
     {
@@ -70,6 +84,11 @@ namespace
       return Subscriptions->Republish(request);
     }
 
+    std::vector<OpcUa::TransferResult> TransferSubscriptions(const OpcUa::TransferSubscriptionsParameters& params, std::function<void (OpcUa::PublishResult)> callback)
+    {
+      return Subscriptions->TransferSubscriptions(params, callback);
+    }
+
     std::vector<OpcUa::MonitoredItemCreateResult> CreateMonitoredItems(const OpcUa::MonitoredItemsParameters& parameters)
     {
       return Subscriptions->CreateMonitoredItems(parameters);
@@ -82,6 +101,46 @@ namespace
 
 
   private:
+    //ConditionRefresh is served from the last state of conditions kept by the subscription service.
+    //Ownership of the subscription is checked by the session layer before the call.
+    void RegisterConditionRefresh(OpcUa::Server::AddressSpace& addressSpace)
+    {
+      try
+      {
+        //Method nodes are not part of the generated standard address space,
+        //the reference from ConditionType to the method is.
+        OpcUa::AddNodesItem item;
+        item.RequestedNewNodeId = OpcUa::ObjectId::ConditionType_ConditionRefresh;
+        item.BrowseName = OpcUa::QualifiedName("ConditionRefresh");
+        item.Class = OpcUa::NodeClass::Method;
+        OpcUa::MethodAttributes attrs;
+        attrs.DisplayName = OpcUa::LocalizedText("ConditionRefresh");
+        attrs.Description = OpcUa::LocalizedText("ConditionRefresh");
+        attrs.Executable = true;
+        attrs.UserExecutable = true;
+        item.Attributes = attrs;
+        addressSpace.AddNodes(std::vector<OpcUa::AddNodesItem>{item});
+
+        addressSpace.SetMethod(OpcUa::ObjectId::ConditionType_ConditionRefresh, [this](OpcUa::NodeId context, std::vector<OpcUa::Variant> arguments)
+        {
+          if ( arguments.size() != 1 )
+          {
+            throw std::invalid_argument("ConditionRefresh expects subscription id as argument");
+          }
+          const OpcUa::StatusCode status = Subscriptions->RefreshConditions(arguments[0].As<uint32_t>());
+          if ( status != OpcUa::StatusCode::Good )
+          {
+            throw std::invalid_argument("ConditionRefresh failed: " + OpcUa::ToString(status));
+          }
+          return std::vector<OpcUa::Variant>();
+        });
+      }
+      catch (const std::exception& ex)
+      {
+        if (Debug) std::cout << "SubscriptionService | ConditionRefresh method not available: " << ex.what() << std::endl;
+      }
+    }
+
     void ApplyAddonParameters(const Common::AddonParameters& addons)
     {
       for (const Common::Parameter parameter : addons.Parameters)
@@ -9,10 +9,28 @@
 
 #include "subscription_service_internal.h"
 
+#include <opc/ua/protocol/binary/stream.h>
+
 #include <boost/thread/locks.hpp>
+#include <algorithm>
 
 namespace
 {
+  struct BufferAcceptor
+  {
+    std::vector<char>& Data;
+
+    explicit BufferAcceptor(std::vector<char>& data)
+      : Data(data)
+    {
+    }
+
+    void Send(const char* data, std::size_t size)
+    {
+      Data.insert(Data.end(), data, data + size);
+    }
+  };
+
   OpcUa::ByteString GenerateEventId()
   {
     //stupid id generator
@@ -35,6 +53,7 @@ namespace OpcUa
       : io(ioService)
       , AddressSpace(addressspace)
       , Debug(debug)
+      , Events(MaxStoredEvents, MaxStoredEventsBytes)
     {
     }
 
@@ -47,6 +66,29 @@ namespace OpcUa
       return *AddressSpace;
     }
 
+    std::shared_ptr<CompiledEventFilter> SubscriptionServiceInternal::GetEventFilter(const EventFilter& filter)
+    {
+      std::vector<char> key;
+      BufferAcceptor acceptor(key);
+      OpcUa::Binary::DataSerializer serializer(0);
+      serializer << filter;
+      serializer.Flush(acceptor);
+
+      std::lock_guard<std::mutex> lock(EventFiltersMutex);
+      std::shared_ptr<CompiledEventFilter> compiled = EventFilters[key].lock();
+      if ( ! compiled )
+      {
+        compiled.reset(new CompiledEventFilter(filter, *AddressSpace));
+        EventFilters[key] = compiled;
+        //forget filters of deleted monitored items
+        for (auto it = EventFilters.begin(); it != EventFilters.end();)
+        {
+          it = it->second.expired() ? EventFilters.erase(it) : std::next(it);
+        }
+      }
+      return compiled;
+    }
+
     boost::asio::io_service& SubscriptionServiceInternal::GetIOService()
     {
       return io;
@@ -82,6 +124,7 @@ namespace OpcUa
         {
           if (Debug) std::cout << "SubscriptionService | Deleting Subscription: " << subid << std::endl;
           itsub->second->Stop();
+          RemoveEventNotifiers(itsub->second);
           SubscriptionsMap.erase(subid);
           result.push_back(StatusCode::Good);
         }
@@ -129,6 +172,7 @@ namespace OpcUa
         MonitoredItemCreateResult result = itsub->second->CreateMonitoredItem(req);
         data.push_back(result);
       }
+      UpdateEventNotifiers(itsub->second);
       return data;
 
     }
@@ -150,9 +194,29 @@ namespace OpcUa
       }
 
       results = itsub->second->DeleteMonitoredItemsIds(params.MonitoredItemIds);
+      UpdateEventNotifiers(itsub->second);
       return results;
     }
 
+    void SubscriptionServiceInternal::RemoveEventNotifiers(const std::shared_ptr<InternalSubscription>& subscription)
+    {
+      for (auto it = EventNotifiers.begin(); it != EventNotifiers.end();)
+      {
+        std::vector<std::shared_ptr<InternalSubscription>>& subscriptions = it->second;
+        subscriptions.erase(std::remove(subscriptions.begin(), subscriptions.end(), subscription), subscriptions.end());
+        it = subscriptions.empty() ? EventNotifiers.erase(it) : std::next(it);
+      }
+    }
+
+    void SubscriptionServiceInternal::UpdateEventNotifiers(const std::shared_ptr<InternalSubscription>& subscription)
+    {
+      RemoveEventNotifiers(subscription);
+      for (const NodeId& node : subscription->GetEventNotifiers())
+      {
+        EventNotifiers[node].push_back(subscription);
+      }
+    }
+
     void SubscriptionServiceInternal::Publish(const PublishRequest& request)
     {
       boost::unique_lock<boost::shared_mutex> lock(DbMutex);
@@ -187,6 +251,14 @@ namespace OpcUa
       return sub_it->second->Republish(params);
     }
 
+    std::vector<TransferResult> SubscriptionServiceInternal::TransferSubscriptions(const TransferSubscriptionsParameters& params, std::function<void (PublishResult)> callback)
+    {
+      // Subscriptions are deleted with the connection of their session, nothing is left to transfer
+      TransferResult result;
+      result.Status = StatusCode::BadNotImplemented;
+      return std::vector<TransferResult>(params.SubscriptionIds.size(), result);
+    }
+
 
     bool SubscriptionServiceInternal::PopPublishRequest(NodeId node)
     {
@@ -226,11 +298,113 @@ namespace OpcUa
         event.EventId = GenerateEventId();
       }
 
-      for (auto sub : SubscriptionsMap)
+      if ( event.ReceiveTime.Value == 0 )
+      {
+        event.ReceiveTime = DateTime::Current();
+      }
+      Events.Add(node, event);
+      RetainCondition(node, event);
+
+      EventNotifiersMap::const_iterator it = EventNotifiers.find(node);
+      if ( it == EventNotifiers.end() )
+      {
+        return;
+      }
+      EventProjection projection(event);
+      for (const std::shared_ptr<InternalSubscription>& sub : it->second)
+      {
+        sub->TriggerEvent(node, projection);
+      }
+    }
+
+    StatusCode SubscriptionServiceInternal::ReplayEvents(uint32_t subscriptionId, Duration period)
+    {
+      //Read the store before locking, TriggerEvent locks in the opposite order
+      std::vector<StoredEvent> events;
+      if ( period > 0 )
+      {
+        const DateTime now = DateTime::Current();
+        events = Events.GetByTime(DateTime(now.Value - static_cast<int64_t>(period * 10000)), now);
+      }
+      else
+      {
+        events = Events.GetAll();
+      }
+
+      return SendRefresh(subscriptionId, events);
+    }
+
+    StatusCode SubscriptionServiceInternal::RefreshConditions(uint32_t subscriptionId)
+    {
+      std::vector<StoredEvent> conditions;
+      {
+        std::lock_guard<std::mutex> lock(ConditionsMutex);
+        conditions.reserve(Conditions.size());
+        for (const auto& pair : Conditions)
+        {
+          conditions.push_back(pair.second);
+        }
+      }
+      return SendRefresh(subscriptionId, conditions);
+    }
+
+    //Conditions are the events with a Retain field. They are identified by ConditionId
+    //(NodeId attribute of the event, or its source node if not set) and BranchId.
+    void SubscriptionServiceInternal::RetainCondition(const NodeId& notifier, const Event& event)
+    {
+      const Variant retain = event.GetValue("Retain");
+      if ( retain.IsNul() )
+      {
+        return;
+      }
+      const Variant conditionId = event.GetValue(AttributeId::NodeId);
+      const Variant branchId = event.GetValue("BranchId");
+      const std::pair<NodeId, NodeId> key(conditionId.IsNul() ? event.SourceNode : conditionId.As<NodeId>(), branchId.IsNul() ? NodeId() : branchId.As<NodeId>());
+
+      std::lock_guard<std::mutex> lock(ConditionsMutex);
+      if ( retain.Type() == VariantType::BOOLEAN && retain.As<bool>() )
+      {
+        StoredEvent& stored = Conditions[key];
+        stored.Notifier = notifier;
+        stored.Data = event;
+      }
+      else
+      {
+        Conditions.erase(key);
+      }
+    }
+
+    StatusCode SubscriptionServiceInternal::SendRefresh(uint32_t subscriptionId, const std::vector<StoredEvent>& events)
+    {
+      boost::shared_lock<boost::shared_mutex> lock(DbMutex);
+
+      SubscriptionsIdMap::iterator sub_it = SubscriptionsMap.find(subscriptionId);
+      if ( sub_it == SubscriptionsMap.end())
+      {
+        return StatusCode::BadSubscriptionIdInvalid;
+      }
+      if (Debug) std::cout << "SubscriptionService | Replaying " << events.size() << " events to subscription " << subscriptionId << std::endl;
+
+      Event refresh(ObjectId::RefreshStartEventType);
+      refresh.EventId = GenerateEventId();
+      refresh.SourceNode = ObjectId::Server;
+      refresh.SourceName = "Server";
+      refresh.Time = refresh.ReceiveTime = DateTime::Current();
+      EventProjection start(refresh);
+      sub_it->second->BroadcastEvent(start);
+
+      for (const StoredEvent& stored : events)
       {
-        sub.second->TriggerEvent(node, event);
+        EventProjection projection(stored.Data);
+        sub_it->second->TriggerEvent(stored.Notifier, projection);
       }
 
+      refresh.EventType = ObjectId::RefreshEndEventType;
+      refresh.EventId = GenerateEventId();
+      refresh.Time = refresh.ReceiveTime = DateTime::Current();
+      EventProjection end(refresh);
+      sub_it->second->BroadcastEvent(end);
+      return StatusCode::Good;
     }
 
   } // namespace Internal
@@ -10,6 +10,8 @@
 #pragma once
 
 #include "address_space_addon.h"
+#include "event_filter.h"
+#include "event_store.h"
 #include "internal_subscription.h"
 
 
@@ -26,6 +28,7 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <mutex>
 #include <queue>
 #include <deque>
 #include <set>
@@ -39,6 +42,11 @@ namespace OpcUa
     class InternalSubscription;
 
     typedef std::map <uint32_t, std::shared_ptr<InternalSubscription>> SubscriptionsIdMap; // Map SubscptioinId, SubscriptionData
+    typedef std::map <NodeId, std::vector<std::shared_ptr<InternalSubscription>>> EventNotifiersMap; // Map notifier node, subscriptions monitoring its events
+
+    //Limits of the store keeping triggered events for replay
+    const std::size_t MaxStoredEvents = 10000;
+    const std::size_t MaxStoredEventsBytes = 16 * 1024 * 1024;
 
 
     class SubscriptionServiceInternal : public Server::SubscriptionService
@@ -54,12 +62,24 @@ namespace OpcUa
         virtual std::vector<StatusCode> DeleteMonitoredItems(const DeleteMonitoredItemsParameters& params);
         virtual void Publish(const PublishRequest& request);
         virtual RepublishResponse Republish(const RepublishParameters& request);
+        virtual std::vector<TransferResult> TransferSubscriptions(const TransferSubscriptionsParameters& params, std::function<void (PublishResult)> callback);
 
         void DeleteAllSubscriptions();
         boost::asio::io_service& GetIOService();
         bool PopPublishRequest(NodeId node);
         void TriggerEvent(NodeId node, Event event);
+        virtual StatusCode ReplayEvents(uint32_t subscriptionId, Duration period);
+        virtual StatusCode RefreshConditions(uint32_t subscriptionId);
         Server::AddressSpace& GetAddressSpace();
+        //Return compiled filter, shared with all monitored items using an identical filter
+        std::shared_ptr<CompiledEventFilter> GetEventFilter(const EventFilter& filter);
+        const EventStore& GetEventStore() const { return Events; }
+
+      private:
+        void UpdateEventNotifiers(const std::shared_ptr<InternalSubscription>& subscription);
+        void RemoveEventNotifiers(const std::shared_ptr<InternalSubscription>& subscription);
+        void RetainCondition(const NodeId& notifier, const Event& event);
+        StatusCode SendRefresh(uint32_t subscriptionId, const std::vector<StoredEvent>& events);
 
       private:
         boost::asio::io_service& io;
@@ -69,6 +89,12 @@ namespace OpcUa
         SubscriptionsIdMap SubscriptionsMap; // Map SubscptioinId, SubscriptionData
         uint32_t LastSubscriptionId = 2;
         std::map<NodeId, uint32_t> PublishRequestQueues;
+        EventNotifiersMap EventNotifiers;
+        EventStore Events;
+        std::mutex ConditionsMutex;
+        std::map<std::pair<NodeId, NodeId>, StoredEvent> Conditions; //ConditionId and BranchId, last state of retained condition
+        std::mutex EventFiltersMutex;
+        std::map<std::vector<char>, std::weak_ptr<CompiledEventFilter>> EventFilters; //Map binary encoded filter, compiled filter
     };
 
 
@@ -0,0 +1,69 @@
+/// @brief Tests of histogram used for latencies.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/common/histogram.h>
+
+#include <gtest/gtest.h>
+
+TEST(Histogram, EmptyHasZeroPercentiles)
+{
+  Common::Histogram histogram;
+  ASSERT_EQ(histogram.Count(), 0u);
+  ASSERT_EQ(histogram.Percentile(0.5), 0u);
+  ASSERT_EQ(histogram.Max(), 0u);
+}
+
+TEST(Histogram, SmallValuesAreExact)
+{
+  Common::Histogram histogram;
+  for (uint64_t value = 1; value <= 10; ++value)
+  {
+    histogram.Record(value);
+  }
+  ASSERT_EQ(histogram.Count(), 10u);
+  ASSERT_EQ(histogram.Percentile(0.5), 5u);
+  ASSERT_EQ(histogram.Percentile(0.9), 9u);
+  ASSERT_EQ(histogram.Percentile(1), 10u);
+  ASSERT_EQ(histogram.Max(), 10u);
+  ASSERT_DOUBLE_EQ(histogram.Mean(), 5.5);
+}
+
+TEST(Histogram, LargeValuesAreWithinBucketError)
+{
+  Common::Histogram histogram;
+  for (uint64_t value = 1; value <= 100000; ++value)
+  {
+    histogram.Record(value);
+  }
+  const uint64_t p99 = histogram.Percentile(0.99);
+  ASSERT_GE(p99, 99000u);
+  ASSERT_LE(p99, 99000u + 99000u / 16);
+  ASSERT_EQ(histogram.Percentile(1), 100000u);
+}
+
+TEST(Histogram, RecordsHugeValues)
+{
+  Common::Histogram histogram;
+  histogram.Record(~uint64_t(0));
+  ASSERT_EQ(histogram.Percentile(0.5), ~uint64_t(0));
+}
+
+TEST(Histogram, MergeAddsCounts)
+{
+  Common::Histogram first;
+  Common::Histogram second;
+  first.Record(1);
+  second.Record(1000);
+  second.Record(2000);
+  first.Merge(second);
+  ASSERT_EQ(first.Count(), 3u);
+  ASSERT_EQ(first.Max(), 2000u);
+  ASSERT_EQ(first.Percentile(0.3), 1u);
+  first.Reset();
+  ASSERT_EQ(first.Count(), 0u);
+}
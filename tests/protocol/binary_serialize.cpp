@@ -372,6 +372,26 @@ TEST_F(OpcUaBinarySerialization, SecureMessageHeader)
   ASSERT_EQ(expectedData.size(), RawSize(hdr));
 }
 
+TEST_F(OpcUaBinarySerialization, WriteMessagePatchesSize)
+{
+  using namespace OpcUa::Binary;
+  SymmetricAlgorithmHeader algorithmHeader;
+  algorithmHeader.TokenId = 2;
+  SequenceHeader sequence;
+  sequence.SequenceNumber = 3;
+  sequence.RequestId = 4;
+  const std::string body = "message body";
+
+  SecureHeader hdr(MT_SECURE_MESSAGE, CHT_SINGLE, 1);
+  hdr.AddSize(RawSize(algorithmHeader));
+  hdr.AddSize(RawSize(sequence));
+  hdr.AddSize(RawSize(body));
+  GetStream() << hdr << algorithmHeader << sequence << body << flush;
+  const std::vector<char> expectedData = GetChannel().SerializedData;
+
+  WriteMessage(GetStream(), SecureHeader(MT_SECURE_MESSAGE, CHT_SINGLE, 1), algorithmHeader, sequence, body);
+  ASSERT_EQ(expectedData, GetChannel().SerializedData);
+}
 
 //---------------------------------------------------------
 // Hello
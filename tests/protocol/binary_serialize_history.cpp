@@ -0,0 +1,188 @@
+/// @brief Test of opc ua binary history read service.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "common.h"
+
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/expanded_object_ids.h>
+#include <opc/ua/protocol/history.h>
+#include <opc/ua/protocol/message_identifiers.h>
+
+class HistorySerialization : public OpcUaBinarySerialization
+{
+};
+
+class HistoryDeserialization : public OpcUaBinaryDeserialization
+{
+};
+
+TEST_F(HistorySerialization, ReadRawModifiedDetails)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  ReadRawModifiedDetails raw;
+  raw.StartTime = DateTime(1);
+  raw.EndTime = DateTime(2);
+  raw.NumValuesPerNode = 3;
+  raw.ReturnBounds = true;
+  HistoryReadDetails details(raw);
+
+  GetStream() << details << flush;
+
+  const std::vector<char> expectedData = {
+    1, 0, (char)0x89, 2,  // TypeId
+    1,                    // Encoding
+    22, 0, 0, 0,          // Size
+    0,                    // IsReadModified
+    1, 0, 0, 0, 0, 0, 0, 0, // StartTime
+    2, 0, 0, 0, 0, 0, 0, 0, // EndTime
+    3, 0, 0, 0,           // NumValuesPerNode
+    1                     // ReturnBounds
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData) <<
+      "Expected:" << std::endl <<
+      PrintData(expectedData) << std::endl <<
+      "Serialized:" << std::endl <<
+      PrintData(GetChannel().SerializedData) <<
+      std::endl;
+
+  ASSERT_EQ(expectedData.size(), RawSize(details));
+}
+
+TEST_F(HistoryDeserialization, ReadAtTimeDetails)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData = {
+    1, 0, (char)0x8F, 2,  // TypeId
+    1,                    // Encoding
+    13, 0, 0, 0,          // Size
+    1, 0, 0, 0,           // ReqTimes count
+    5, 0, 0, 0, 0, 0, 0, 0, // ReqTimes[0]
+    1                     // UseSimpleBounds
+  };
+
+  GetChannel().SetData(expectedData);
+
+  HistoryReadDetails details;
+  GetStream() >> details;
+
+  ASSERT_EQ(details.Header.TypeId, ExpandedObjectId::ReadAtTimeDetails);
+  ASSERT_EQ(details.AtTime.ReqTimes.size(), 1);
+  ASSERT_EQ(details.AtTime.ReqTimes[0].Value, 5);
+  ASSERT_TRUE(details.AtTime.UseSimpleBounds);
+}
+
+TEST_F(HistorySerialization, ReadProcessedDetails)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  ReadProcessedDetails processed;
+  processed.StartTime = DateTime(1);
+  processed.EndTime = DateTime(2);
+  processed.AggregateType.push_back(NodeId(2342, 0));
+  processed.AggregateConfiguration.PercentDataGood = 80;
+  HistoryReadDetails details(processed);
+
+  GetStream() << details << flush;
+
+  const std::vector<char> expectedData = {
+    1, 0, (char)0x8C, 2,  // TypeId
+    1,                    // Encoding
+    40, 0, 0, 0,          // Size
+    1, 0, 0, 0, 0, 0, 0, 0, // StartTime
+    2, 0, 0, 0, 0, 0, 0, 0, // EndTime
+    0, 0, 0, 0, 0, 0, 0, 0, // ProcessingInterval
+    1, 0, 0, 0,           // AggregateType count
+    2, 0, 0, 0x26, 0x09, 0, 0, // AggregateType[0]
+    1, 1, 100, 80, 0      // AggregateConfiguration
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData) <<
+      "Expected:" << std::endl <<
+      PrintData(expectedData) << std::endl <<
+      "Serialized:" << std::endl <<
+      PrintData(GetChannel().SerializedData) <<
+      std::endl;
+
+  ASSERT_EQ(expectedData.size(), RawSize(details));
+}
+
+TEST_F(HistorySerialization, HistoryReadResult)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  HistoryReadResult result;
+  result.Status = StatusCode::GoodMoreData;
+  result.DataValues.push_back(DataValue(uint8_t(7)));
+
+  GetStream() << result << flush;
+
+  const std::vector<char> expectedData = {
+    0, 0, (char)0xA6, 0,  // Status
+    -1, -1, -1, -1,       // ContinuationPoint
+    1, 0, (char)0x92, 2,  // TypeId
+    1,                    // Encoding
+    7, 0, 0, 0,           // Size
+    1, 0, 0, 0,           // DataValues count
+    1, 3, 7               // DataValue
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData) <<
+      "Expected:" << std::endl <<
+      PrintData(expectedData) << std::endl <<
+      "Serialized:" << std::endl <<
+      PrintData(GetChannel().SerializedData) <<
+      std::endl;
+
+  ASSERT_EQ(expectedData.size(), RawSize(result));
+}
+
+TEST_F(HistoryDeserialization, HistoryReadResult)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData = {
+    0, 0, 0, 0,           // Status
+    2, 0, 0, 0, 1, 2,     // ContinuationPoint
+    1, 0, (char)0x92, 2,  // TypeId
+    1,                    // Encoding
+    7, 0, 0, 0,           // Size
+    1, 0, 0, 0,           // DataValues count
+    1, 3, 7               // DataValue
+  };
+
+  GetChannel().SetData(expectedData);
+
+  HistoryReadResult result;
+  GetStream() >> result;
+
+  ASSERT_EQ(result.Status, StatusCode::Good);
+  ASSERT_EQ(result.ContinuationPoint.Data, std::vector<uint8_t>({1, 2}));
+  ASSERT_EQ(result.DataValues.size(), 1);
+  ASSERT_EQ(result.DataValues[0].Value.As<uint8_t>(), 7);
+}
+
+TEST_F(HistorySerialization, HistoryReadRequest)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  HistoryReadRequest request;
+  ASSERT_EQ(request.TypeId.Encoding, EV_FOUR_BYTE);
+  ASSERT_EQ(request.TypeId.FourByteData.Identifier, OpcUa::HISTORY_READ_REQUEST);
+
+  HistoryReadResponse response;
+  ASSERT_EQ(response.TypeId.FourByteData.Identifier, OpcUa::HISTORY_READ_RESPONSE);
+}
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 
 //-------------------------------------------------------
 // Serialization
@@ -1040,6 +1041,97 @@ TEST_F(OpcUaBinaryDeserialization, Variant_DOUBLE_DIMENSIONS)
   ASSERT_EQ(var.Dimensions[0], 1);
 }
 
+TEST_F(OpcUaBinarySerialization, Variant_DOUBLE_Matrix)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  std::vector<double> samples(256 * 256);
+  for (std::size_t i = 0; i < samples.size(); ++i)
+  {
+    samples[i] = i;
+  }
+  samples[1] = 1200000;
+
+  Variant var(samples);
+  var.Dimensions = {256, 256};
+
+  GetStream() << var << flush;
+
+  const std::vector<char>& data = GetChannel().SerializedData;
+  ASSERT_EQ(data.size(), RawSize(var));
+  ASSERT_EQ(data.size(), 1 + 4 + samples.size() * 8 + 4 + 2 * 4);
+
+  const char encodingMask = static_cast<uint8_t>(VariantType::DOUBLE) | HAS_ARRAY_MASK | HAS_DIMENSIONS_MASK;
+  const std::vector<char> head = {
+  encodingMask,
+  0,0,1,0, // 65536 samples
+  0,0,0,0,0,0,0,0,
+  0, 0, 0, 0, (char)0x80, (char)0x4f, (char)0x32, (char)0x41, // 1200000
+  };
+  const std::vector<char> tail = {
+  2,0,0,0,
+  0,1,0,0,
+  0,1,0,0,
+  };
+  ASSERT_TRUE(std::equal(head.begin(), head.end(), data.begin())) << PrintData(std::vector<char>(data.begin(), data.begin() + head.size()));
+  ASSERT_TRUE(std::equal(tail.begin(), tail.end(), data.end() - tail.size()));
+}
+
+TEST_F(OpcUaBinaryDeserialization, Variant_DOUBLE_Matrix)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  std::vector<char> data = {
+  static_cast<char>(static_cast<uint8_t>(VariantType::DOUBLE) | HAS_ARRAY_MASK | HAS_DIMENSIONS_MASK),
+  0,0,1,0, // 65536 samples
+  };
+  for (unsigned i = 0; i < 256 * 256; ++i)
+  {
+    const double sample = i;
+    const char* bytes = reinterpret_cast<const char*>(&sample);
+    data.insert(data.end(), bytes, bytes + sizeof(sample));
+  }
+  const std::vector<char> dimensions = {
+  2,0,0,0,
+  0,1,0,0,
+  0,1,0,0,
+  };
+  data.insert(data.end(), dimensions.begin(), dimensions.end());
+
+  GetChannel().SetData(data);
+
+  Variant var;
+  GetStream() >> var;
+
+  ASSERT_EQ(var.Type(), VariantType::DOUBLE);
+  ASSERT_TRUE(var.IsArray());
+  const std::vector<double> samples = var.As<std::vector<double>>();
+  ASSERT_EQ(samples.size(), 256 * 256);
+  ASSERT_EQ(samples[0], 0);
+  ASSERT_EQ(samples[12345], 12345);
+  ASSERT_EQ(samples.back(), 256 * 256 - 1);
+  ASSERT_EQ(var.Dimensions, std::vector<uint32_t>({256, 256}));
+}
+
+TEST_F(OpcUaBinaryDeserialization, Variant_DOUBLE_ArrayTooShort)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData = {
+  static_cast<char>(static_cast<uint8_t>(VariantType::DOUBLE) | HAS_ARRAY_MASK),
+  (char)0xff,(char)0xff,(char)0xff,0x7f,
+  0, 0, 0, 0, (char)0x80, (char)0x4f, (char)0x32, (char)0x41,
+  };
+
+  GetChannel().SetData(expectedData);
+
+  Variant var;
+  ASSERT_THROW(GetStream() >> var, std::logic_error);
+}
+
 OpcUa::Guid CreateTestGuid()
 {
   OpcUa::Guid guid;
@@ -1770,3 +1862,43 @@ TEST(Variant, Comparable)
   ASSERT_NE(OpcUa::Variant(true), OpcUa::Variant(false));
   ASSERT_NE(OpcUa::Variant(true), false);
 }
+
+TEST(Variant, CopiesDimensions)
+{
+  OpcUa::Variant var(std::vector<double>{1, 2, 3, 4});
+  var.Dimensions = {2, 2};
+
+  const OpcUa::Variant copy(var);
+  ASSERT_EQ(copy, var);
+  ASSERT_EQ(copy.Dimensions, std::vector<uint32_t>({2, 2}));
+
+  OpcUa::Variant assigned;
+  assigned = var;
+  ASSERT_EQ(assigned.Dimensions, std::vector<uint32_t>({2, 2}));
+}
+
+TEST(Variant, MovesArray)
+{
+  std::vector<double> samples(1024, 1.5);
+
+  OpcUa::Variant var(std::move(samples));
+  var.Dimensions = {32, 32};
+  const OpcUa::Variant moved(std::move(var));
+
+  ASSERT_TRUE(var.IsNul());
+  ASSERT_EQ(moved.Dimensions, std::vector<uint32_t>({32, 32}));
+  ASSERT_EQ(moved.As<std::vector<double>>(), std::vector<double>(1024, 1.5));
+}
+
+TEST(Variant, MovesWithoutThrowing)
+{
+  // std::vector moves its elements on reallocation only when they cannot throw
+  static_assert(std::is_nothrow_move_constructible<OpcUa::Variant>::value, "Variant must move without throwing");
+  static_assert(std::is_nothrow_move_assignable<OpcUa::Variant>::value, "Variant must move without throwing");
+  static_assert(std::is_nothrow_move_constructible<OpcUa::DataValue>::value, "DataValue must move without throwing");
+  static_assert(std::is_nothrow_move_assignable<OpcUa::DataValue>::value, "DataValue must move without throwing");
+
+  std::vector<OpcUa::Variant> values(1, OpcUa::Variant(std::vector<double>(16, 1.5)));
+  values.resize(values.capacity() + 1);
+  ASSERT_EQ(values[0].As<std::vector<double>>(), std::vector<double>(16, 1.5));
+}
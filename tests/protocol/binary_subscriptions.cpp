@@ -1072,3 +1072,131 @@ TEST_F(SubscriptionDeserialization, SetPublishingModeResponse)
   ASSERT_EQ(response.Result.Results.size(), 1);
   ASSERT_EQ(response.Result.DiagnosticInfos.size(), 0);
 }
+
+//-------------------------------------------------------
+// ModifySubscriptionParameters
+//-------------------------------------------------------
+
+TEST_F(SubscriptionSerialization, ModifySubscriptionParameters)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  ModifySubscriptionParameters params;
+  params.SubscriptionId = 1;
+  params.RequestedPublishingInterval = 1200000;
+  params.RequestedLifetimeCount = 2;
+  params.RequestedMaxKeepAliveCount = 3;
+  params.MaxNotificationsPerPublish = 4;
+  params.Priority = 5;
+
+  GetStream() << params << flush;
+
+  const std::vector<char> expectedData = {
+    1,0,0,0,
+    0,0,0,0,(char)0x80,(char)0x4f,(char)0x32,(char)0x41, // RequestedPublishingInterval
+    2,0,0,0,
+    3,0,0,0,
+    4,0,0,0,
+    5
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData) << "Actual:" << std::endl << PrintData(GetChannel().SerializedData) << std::endl << "Expected" << std::endl << PrintData(expectedData);
+  ASSERT_EQ(expectedData.size(), RawSize(params));
+}
+
+TEST_F(SubscriptionDeserialization, ModifySubscriptionParameters)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData = {
+    1,0,0,0,
+    0,0,0,0,(char)0x80,(char)0x4f,(char)0x32,(char)0x41, // RequestedPublishingInterval
+    2,0,0,0,
+    3,0,0,0,
+    4,0,0,0,
+    5
+  };
+
+  GetChannel().SetData(expectedData);
+
+  ModifySubscriptionParameters params;
+  GetStream() >> params;
+
+  ASSERT_EQ(params.SubscriptionId, 1);
+  ASSERT_EQ(params.RequestedPublishingInterval, 1200000);
+  ASSERT_EQ(params.RequestedLifetimeCount, 2);
+  ASSERT_EQ(params.RequestedMaxKeepAliveCount, 3);
+  ASSERT_EQ(params.MaxNotificationsPerPublish, 4);
+  ASSERT_EQ(params.Priority, 5);
+}
+
+//-------------------------------------------------------
+// SetMonitoringModeParameters
+//-------------------------------------------------------
+
+TEST_F(SubscriptionSerialization, SetMonitoringModeParameters)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  SetMonitoringModeParameters params;
+  params.SubscriptionId = 1;
+  params.MonitoringMode = MonitoringMode::Reporting;
+  params.MonitoredItemIds = {3, 0x01020304};
+
+  GetStream() << params << flush;
+
+  const std::vector<char> expectedData = {
+    1,0,0,0,
+    2,0,0,0, // MonitoringMode
+    2,0,0,0, // Count of ids
+    3,0,0,0,
+    4,3,2,1
+  };
+
+  ASSERT_EQ(expectedData, GetChannel().SerializedData) << "Actual:" << std::endl << PrintData(GetChannel().SerializedData) << std::endl << "Expected" << std::endl << PrintData(expectedData);
+  ASSERT_EQ(expectedData.size(), RawSize(params));
+}
+
+TEST_F(SubscriptionDeserialization, SetMonitoringModeParameters)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData = {
+    1,0,0,0,
+    2,0,0,0, // MonitoringMode
+    2,0,0,0, // Count of ids
+    3,0,0,0,
+    4,3,2,1
+  };
+
+  GetChannel().SetData(expectedData);
+
+  SetMonitoringModeParameters params;
+  GetStream() >> params;
+
+  ASSERT_EQ(params.SubscriptionId, 1);
+  ASSERT_EQ(params.MonitoringMode, MonitoringMode::Reporting);
+  ASSERT_EQ(params.MonitoredItemIds, std::vector<uint32_t>({3, 0x01020304}));
+}
+
+TEST_F(SubscriptionDeserialization, FailsOnTooShortArrayOfIds)
+{
+  using namespace OpcUa;
+  using namespace OpcUa::Binary;
+
+  const std::vector<char> expectedData = {
+    1,0,0,0,
+    2,0,0,0, // MonitoringMode
+    (char)0xff,(char)0xff,(char)0xff,0x7f, // Count of ids
+    3,0,0,0
+  };
+
+  GetChannel().SetData(expectedData);
+
+  SetMonitoringModeParameters params;
+  ASSERT_THROW(GetStream() >> params, std::logic_error);
+}
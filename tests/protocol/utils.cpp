@@ -12,6 +12,8 @@
 #include <opc/ua/protocol/guid.h>
 #include <opc/ua/protocol/string_utils.h>
 #include <gtest/gtest.h>
+#include <cstdlib>
+#include <limits>
 #include <stdexcept>
 
 using namespace testing;
@@ -53,6 +55,23 @@ TEST(DateTime, FromDateTime)
   ASSERT_EQ(t/10000000LL*10000000LL, converted);
 }
 
+TEST(DateTime, CurrentMatchesTimeT)
+{
+  const time_t before = time(0);
+  const time_t current = OpcUa::DateTime::ToTimeT(OpcUa::DateTime::Current());
+  const time_t after = time(0);
+  ASSERT_LE(before, current);
+  ASSERT_GE(after, current);
+}
+
+TEST(DateTime, CoarseIsCloseToCurrent)
+{
+  const OpcUa::DateTime current = OpcUa::DateTime::Current();
+  const OpcUa::DateTime coarse = OpcUa::DateTime::CurrentCoarse();
+  // One second in 100ns units.
+  ASSERT_LT(std::abs(coarse.Value - current.Value), 10000000LL);
+}
+
 TEST(DateTime, ZeroDateTime_ThrowInvalidArgument)
 {
   DateTime t(0);
@@ -245,3 +264,58 @@ TEST(NodeId, WithDefaultNamespace)
   OpcUa::NodeId converted = OpcUa::ToNodeId("i=1;", 2);
   ASSERT_EQ(expected, converted);
 }
+
+TEST(NodeId, FieldsInAnyOrder)
+{
+  OpcUa::NodeId expected = OpcUa::NumericNodeId(1, 2);
+  expected.SetServerIndex(3);
+  ASSERT_EQ(OpcUa::ToNodeId("i=1;srv=3;ns=2"), expected);
+}
+
+TEST(NodeId, StringIdentifierIsNotNamespace)
+{
+  ASSERT_EQ(OpcUa::ToNodeId("s=ns=5;ns=1"), OpcUa::StringNodeId("ns=5", 1));
+}
+
+TEST(NodeId, GuidRoundTrip)
+{
+  const OpcUa::NodeId id = OpcUa::ToNodeId("ns=1;g=01020304-0506-0708-090a0B0C0D0E0F10;");
+  ASSERT_TRUE(id.IsGuid());
+  const OpcUa::Guid guid = id.GetGuidIdentifier();
+  EXPECT_EQ(guid.Data2, 0x0506);
+  EXPECT_EQ(guid.Data3, 0x0708);
+  EXPECT_EQ(guid.Data4[1], 0x0A);
+  EXPECT_EQ(guid.Data4[7], 0x10);
+  EXPECT_EQ(OpcUa::ToString(id), "ns=1;g=01020304-0506-0708-090A0B0C0D0E0F10;");
+}
+
+TEST(NodeId, ParseReportsErrors)
+{
+  const std::string texts[] = {"ns=2;i=1x;", "ns=70000;i=1;", "i=4294967296;", "ns=1;", "ns=1;g=0102;", "ns=1;i=1;"};
+  const std::errc errors[] = {std::errc::invalid_argument, std::errc::result_out_of_range, std::errc::result_out_of_range,
+      std::errc::invalid_argument, std::errc::invalid_argument, std::errc()};
+  for (unsigned i = 0; i < 6; ++i)
+  {
+    OpcUa::NodeId id = OpcUa::NumericNodeId(7);
+    const std::string& text = texts[i];
+    const OpcUa::NodeIdParseResult result = OpcUa::ParseNodeId(text.data(), text.data() + text.size(), id);
+    EXPECT_EQ(result.Error, errors[i]) << text;
+    if (result.Error != std::errc())
+    {
+      EXPECT_EQ(id, OpcUa::NumericNodeId(7)) << text;
+    }
+  }
+  ASSERT_THROW(OpcUa::ToNodeId("ns=2;i=x;"), std::runtime_error);
+  ASSERT_THROW(OpcUa::ToNodeId("i=1;", std::numeric_limits<uint32_t>::max()), std::runtime_error);
+}
+
+TEST(NodeId, FormatFailsOnSmallBuffer)
+{
+  const OpcUa::NodeId id = OpcUa::NumericNodeId(1234, 2);
+  char buf[16];
+  OpcUa::NodeIdFormatResult result = OpcUa::FormatNodeId(buf, buf + 8, id);
+  EXPECT_EQ(result.Error, std::errc::value_too_large);
+  result = OpcUa::FormatNodeId(buf, buf + sizeof(buf), id);
+  ASSERT_EQ(result.Error, std::errc());
+  EXPECT_EQ(std::string(buf, result.Ptr), "ns=2;i=1234;");
+}
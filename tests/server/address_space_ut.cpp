@@ -17,6 +17,8 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.                *
  ******************************************************************************/
 
+#include "name_table.h"
+
 #include <opc/ua/protocol/object_ids.h>
 #include <opc/ua/protocol/attribute_ids.h>
 #include <opc/ua/protocol/status_codes.h>
@@ -96,6 +98,92 @@ TEST_F(AddressSpace, ReadAttributes)
   EXPECT_EQ(result.Value, OpcUa::QualifiedName(OpcUa::Names::Root));
 }
 
+TEST_F(AddressSpace, TranslatesBrowsePathByName)
+{
+  const OpcUa::NodeId valueId = CreateValue();
+  OpcUa::RelativePathElement element;
+  element.ReferenceTypeId = OpcUa::ObjectId::HierarchicalReferences;
+  element.TargetName = OpcUa::QualifiedName("value");
+  OpcUa::BrowsePath path;
+  path.StartingNode = OpcUa::ObjectId::RootFolder;
+  path.Path.Elements.push_back(element);
+  element.TargetName = OpcUa::QualifiedName("no such name in address space");
+  OpcUa::BrowsePath unknown;
+  unknown.StartingNode = OpcUa::ObjectId::RootFolder;
+  unknown.Path.Elements.push_back(element);
+  OpcUa::TranslateBrowsePathsParameters params;
+  params.BrowsePaths = {path, unknown};
+
+  std::vector<OpcUa::BrowsePathResult> results = NameSpace->TranslateBrowsePathsToNodeIds(params);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0].Status, OpcUa::StatusCode::Good);
+  ASSERT_EQ(results[0].Targets.size(), 1);
+  EXPECT_EQ(results[0].Targets[0].Node, valueId);
+  EXPECT_EQ(results[1].Status, OpcUa::StatusCode::BadNoMatch);
+}
+
+TEST_F(AddressSpace, BrowseReturnsNamesOfTargets)
+{
+  const OpcUa::NodeId valueId = CreateValue();
+  OpcUa::BrowseDescription desc;
+  desc.NodeToBrowse = OpcUa::ObjectId::RootFolder;
+  desc.Direction = OpcUa::BrowseDirection::Forward;
+  OpcUa::NodesQuery query;
+  query.NodesToBrowse.push_back(desc);
+
+  std::vector<OpcUa::BrowseResult> results = NameSpace->Browse(query);
+  ASSERT_EQ(results.size(), 1);
+  bool found = false;
+  for (const OpcUa::ReferenceDescription& ref : results[0].Referencies)
+  {
+    if (ref.TargetNodeId == valueId)
+    {
+      found = true;
+      EXPECT_EQ(ref.BrowseName, OpcUa::QualifiedName("value"));
+      EXPECT_EQ(ref.DisplayName, OpcUa::LocalizedText("value"));
+    }
+    else if (ref.TargetNodeId == OpcUa::ObjectId::ObjectsFolder)
+    {
+      EXPECT_EQ(ref.BrowseName, OpcUa::QualifiedName(0, OpcUa::Names::Objects));
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST_F(AddressSpace, ReleasesNamesOfDestroyedReferences)
+{
+  const OpcUa::QualifiedName name("name of one node only");
+  OpcUa::AddNodesItem item;
+  item.Attributes = OpcUa::ObjectAttributes();
+  item.BrowseName = name;
+  item.Class = OpcUa::NodeClass::Object;
+  item.ParentNodeId = OpcUa::ObjectId::RootFolder;
+  ASSERT_EQ(NameSpace->AddNodes({item})[0].Status, OpcUa::StatusCode::Good);
+  EXPECT_TRUE(OpcUa::Internal::FindName(name) != nullptr);
+
+  NameSpace.reset();
+  EXPECT_TRUE(OpcUa::Internal::FindName(name) == nullptr);
+}
+
+TEST(NameTable, SharesNameUntilLastReference)
+{
+  const OpcUa::QualifiedName name(3, "interned name");
+  std::shared_ptr<const OpcUa::QualifiedName> first = OpcUa::Internal::InternName(name);
+  std::shared_ptr<const OpcUa::QualifiedName> second = OpcUa::Internal::InternName(name);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(OpcUa::Internal::FindName(name), first);
+
+  first.reset();
+  EXPECT_EQ(OpcUa::Internal::FindName(name), second);
+  second.reset();
+  EXPECT_TRUE(OpcUa::Internal::FindName(name) == nullptr);
+
+  // Interned again after it was freed
+  first = OpcUa::Internal::InternName(name);
+  EXPECT_EQ(*first, name);
+  EXPECT_EQ(OpcUa::Internal::FindName(name), first);
+}
+
 TEST_F(AddressSpace, CallsDataChangeCallbackOnWrite)
 {
   OpcUa::NodeId valueId = CreateValue();
@@ -131,6 +219,36 @@ TEST_F(AddressSpace, CallsDataChangeCallbackOnWrite)
   ASSERT_FALSE(callbackCalled);
 }
 
+TEST_F(AddressSpace, WritesBatchWithOneServerTimestamp)
+{
+  NameSpace->SetCoarseTimestamps(true);
+  std::vector<OpcUa::WriteValue> values;
+  for (int i = 0; i < 3; ++i)
+  {
+    OpcUa::WriteValue value;
+    value.AttributeId = OpcUa::AttributeId::Value;
+    value.NodeId = CreateValue();
+    value.Value = i;
+    values.push_back(value);
+  }
+  std::vector<OpcUa::StatusCode> result = NameSpace->Write(values);
+  ASSERT_EQ(result.size(), 3);
+
+  OpcUa::ReadParameters readParams;
+  for (const OpcUa::WriteValue& value : values)
+  {
+    readParams.AttributesToRead.push_back(ToReadValueId(value.NodeId, OpcUa::AttributeId::Value));
+  }
+  std::vector<OpcUa::DataValue> read = NameSpace->Read(readParams);
+  ASSERT_EQ(read.size(), 3);
+  ASSERT_TRUE(read[0].Encoding & OpcUa::DATA_VALUE_Server_TIMESTAMP);
+  EXPECT_NE(read[0].ServerTimestamp.Value, 0);
+  EXPECT_EQ(read[1].ServerTimestamp, read[0].ServerTimestamp);
+  EXPECT_EQ(read[2].ServerTimestamp, read[0].ServerTimestamp);
+  EXPECT_EQ(read[2].Value, 2);
+  NameSpace->SetCoarseTimestamps(false);
+}
+
 TEST_F(AddressSpace, ValueCallbackIsCalled)
 {
   OpcUa::NodeId valueId = CreateValue();
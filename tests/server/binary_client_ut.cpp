@@ -0,0 +1,247 @@
+/// @brief Test of receiving responses split into several chunks by the binary client.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/binary_client.h>
+#include <opc/ua/protocol/binary/stream.h>
+#include <opc/ua/protocol/input_from_buffer.h>
+#include <opc/ua/protocol/object_ids.h>
+#include <opc/ua/protocol/protocol.h>
+#include <opc/ua/protocol/secure_channel.h>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+
+using namespace testing;
+using namespace OpcUa;
+using namespace OpcUa::Binary;
+
+namespace
+{
+
+  class BufferChannel : public OpcUa::OutputChannel
+  {
+  public:
+    virtual void Send(const char* message, std::size_t size)
+    {
+      Data.insert(Data.end(), message, message + size);
+    }
+
+    virtual void Stop()
+    {
+    }
+
+    std::vector<char> Data;
+  };
+
+  typedef std::function<std::vector<char> (uint32_t requestHandle)> Responder;
+
+  // Server side of a connection: acknowledges hello and answers requests with the chunks made by the test.
+  class FakeServerChannel : public OpcUa::IOChannel
+  {
+  public:
+    explicit FakeServerChannel(Responder respond)
+      : Respond(respond)
+    {
+    }
+
+    virtual std::size_t Receive(char* data, std::size_t size)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      DataReady.wait(lock, [this, size]() { return Stopped || Output.size() >= size; });
+      if (Stopped)
+      {
+        throw std::runtime_error("Fake server channel stopped");
+      }
+      std::copy(Output.begin(), Output.begin() + size, data);
+      Output.erase(Output.begin(), Output.begin() + size);
+      return size;
+    }
+
+    virtual void Send(const char* message, std::size_t size)
+    {
+      Input.insert(Input.end(), message, message + size);
+      const std::size_t headerSize = 8;
+      while (Input.size() >= headerSize)
+      {
+        uint32_t messageSize = 0;
+        std::memcpy(&messageSize, Input.data() + 4, sizeof(messageSize));
+        if (Input.size() < messageSize)
+        {
+          return;
+        }
+        const std::vector<char> request(Input.begin(), Input.begin() + messageSize);
+        Input.erase(Input.begin(), Input.begin() + messageSize);
+        Process(request);
+      }
+    }
+
+    virtual void Stop()
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      Stopped = true;
+      DataReady.notify_all();
+    }
+
+  private:
+    void Process(const std::vector<char>& request)
+    {
+      BufferChannel answer;
+      if (std::string(request.data(), 3) == "HEL")
+      {
+        OStreamBinary out(answer);
+        WriteMessage(out, Header(MT_ACKNOWLEDGE, CHT_SINGLE), Acknowledge());
+      }
+      else if (std::string(request.data(), 3) == "MSG")
+      {
+        InputFromBuffer input(request.data(), request.size());
+        IStreamBinary in(input);
+        SecureHeader secureHeader;
+        SymmetricAlgorithmHeader algorithmHeader;
+        SequenceHeader sequence;
+        NodeId typeId;
+        RequestHeader header;
+        in >> secureHeader >> algorithmHeader >> sequence >> typeId >> header;
+        answer.Data = Respond(header.RequestHandle);
+      }
+
+      std::unique_lock<std::mutex> lock(Mutex);
+      Output.insert(Output.end(), answer.Data.begin(), answer.Data.end());
+      DataReady.notify_all();
+    }
+
+  private:
+    Responder Respond;
+    std::vector<char> Input;
+    std::mutex Mutex;
+    std::condition_variable DataReady;
+    std::vector<char> Output;
+    bool Stopped = false;
+  };
+
+  template <typename T>
+  std::vector<char> Encode(const T& value)
+  {
+    BufferChannel channel;
+    OStreamBinary out(channel);
+    out << value << flush;
+    return channel.Data;
+  }
+
+  void AddChunk(std::vector<char>& chunks, ChunkType type, const std::vector<char>& body, std::size_t begin, std::size_t end)
+  {
+    BufferChannel channel;
+    OStreamBinary out(channel);
+    WriteMessage(out, SecureHeader(MT_SECURE_MESSAGE, type, 0), SymmetricAlgorithmHeader(), SequenceHeader(), RawMessage(body.data() + begin, end - begin));
+    chunks.insert(chunks.end(), channel.Data.begin(), channel.Data.end());
+  }
+
+  // Body split at the given offsets, every chunk but the last one is intermediate.
+  std::vector<char> MakeChunks(const std::vector<char>& body, const std::vector<std::size_t>& splits)
+  {
+    std::vector<char> chunks;
+    std::size_t begin = 0;
+    for (std::size_t split : splits)
+    {
+      AddChunk(chunks, CHT_INTERMEDIATE, body, begin, split);
+      begin = split;
+    }
+    AddChunk(chunks, CHT_SINGLE, body, begin, body.size());
+    return chunks;
+  }
+
+  ReadResponse MakeReadResponse(uint32_t requestHandle, std::size_t count)
+  {
+    ReadResponse response;
+    response.Header.RequestHandle = requestHandle;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      response.Results.push_back(DataValue(std::string(100, 'a' + i)));
+    }
+    return response;
+  }
+
+  std::vector<DataValue> Read(Services::SharedPtr client)
+  {
+    ReadParameters params;
+    params.AttributesToRead.push_back(ToReadValueId(ObjectId::RootFolder, AttributeId::Value));
+    return client->Attributes()->Read(params);
+  }
+
+  Services::SharedPtr CreateClient(Responder respond)
+  {
+    SecureConnectionParams params;
+    params.EndpointUrl = "opc.tcp://localhost:4841";
+    params.SecurePolicy = "http://opcfoundation.org/UA/SecurityPolicy#None";
+    return CreateBinaryClient(std::make_shared<FakeServerChannel>(respond), params);
+  }
+
+}
+
+TEST(BinaryClient, DecodesResponseOfSeveralChunks)
+{
+  Services::SharedPtr client = CreateClient([](uint32_t handle)
+  {
+    const std::vector<char> body = Encode(MakeReadResponse(handle, 3));
+    return MakeChunks(body, std::vector<std::size_t>{body.size() / 3, body.size() / 3 * 2});
+  });
+
+  const std::vector<DataValue> values = Read(client);
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0].Value, Variant(std::string(100, 'a')));
+  EXPECT_EQ(values[2].Value, Variant(std::string(100, 'c')));
+}
+
+TEST(BinaryClient, DecodesHeadersSpanningChunks)
+{
+  Services::SharedPtr client = CreateClient([](uint32_t handle)
+  {
+    ReadResponse response = MakeReadResponse(handle, 2);
+    response.Header.StringTable = std::vector<std::string>(4, std::string(50, 's'));
+    const std::vector<char> body = Encode(response);
+    // type id is split and the string table spreads over two more chunks
+    return MakeChunks(body, std::vector<std::size_t>{2, 60, 140});
+  });
+
+  for (int i = 0; i < 2; ++i)
+  {
+    const std::vector<DataValue> values = Read(client);
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[1].Value, Variant(std::string(100, 'b')));
+  }
+}
+
+TEST(BinaryClient, FailsRequestOfAbortedResponse)
+{
+  std::size_t requests = 0;
+  Services::SharedPtr client = CreateClient([&requests](uint32_t handle)
+  {
+    const std::vector<char> body = Encode(MakeReadResponse(handle, 3));
+    if (++requests > 1)
+    {
+      return MakeChunks(body, std::vector<std::size_t>());
+    }
+    // abort chunk carries an error instead of the rest of the body
+    std::vector<char> chunks;
+    AddChunk(chunks, CHT_INTERMEDIATE, body, 0, body.size() / 2);
+    std::vector<char> error = Encode(StatusCode::BadResponseTooLarge);
+    const std::vector<char> reason = Encode(std::string("Response too large"));
+    error.insert(error.end(), reason.begin(), reason.end());
+    AddChunk(chunks, CHT_FINAL, error, 0, error.size());
+    return chunks;
+  });
+
+  EXPECT_THROW(Read(client), std::exception);
+
+  // Connection stays usable after the aborted message
+  const std::vector<DataValue> values = Read(client);
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[1].Value, Variant(std::string(100, 'b')));
+}
@@ -0,0 +1,135 @@
+/// @brief Test of the pool of threads calling client callbacks.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include <opc/ua/client/callback_dispatcher.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+
+using namespace testing;
+using namespace OpcUa;
+
+TEST(CallbackDispatcher, CallsCallbacksOfOneKeyInOrder)
+{
+  CallbackDispatcher dispatcher(4);
+  std::mutex mutex;
+  std::vector<int> calls;
+  std::promise<void> done;
+  const int count = 200;
+  for (int i = 0; i < count; ++i)
+  {
+    dispatcher.Post(1, [&, i]()
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      calls.push_back(i);
+      if (i == count - 1)
+        done.set_value();
+    });
+  }
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_EQ(calls.size(), count);
+  for (int i = 0; i < count; ++i)
+    ASSERT_EQ(calls[i], i);
+}
+
+TEST(CallbackDispatcher, CallsCallbacksOfDifferentKeysInParallel)
+{
+  CallbackDispatcher dispatcher(2);
+  std::promise<void> second;
+  std::shared_future<void> secondCalled = second.get_future().share();
+  std::promise<bool> first;
+
+  // First callback only returns true if second one could run meanwhile
+  dispatcher.Post(1, [&]()
+  {
+    first.set_value(secondCalled.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+  });
+  dispatcher.Post(2, [&]()
+  {
+    second.set_value();
+  });
+
+  std::future<bool> result = first.get_future();
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(20)), std::future_status::ready);
+  ASSERT_TRUE(result.get());
+}
+
+TEST(CallbackDispatcher, ReportsMetrics)
+{
+  CallbackDispatcher dispatcher(1);
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::promise<void> done;
+  std::atomic<int> calls(0);
+  // Callback without key may run before the rest of the strand
+  const std::function<void()> count = [&calls, &done]()
+  {
+    if (++calls == 3)
+      done.set_value();
+  };
+
+  dispatcher.Post(1, [released, count]() { released.wait(); count(); });
+  dispatcher.Post(1, count);
+  dispatcher.Post(0, count);
+
+  CallbackMetrics metrics = dispatcher.GetMetrics();
+  ASSERT_GE(metrics.MaxQueueDepth, 2);
+
+  release.set_value();
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  dispatcher.Stop();
+
+  metrics = dispatcher.GetMetrics();
+  ASSERT_EQ(metrics.Dispatched, 3);
+  ASSERT_EQ(metrics.QueueDepth, 0);
+  ASSERT_LE(metrics.AverageLatency, metrics.MaxLatency);
+}
+
+TEST(CallbackDispatcher, StopsFromCallback)
+{
+  CallbackDispatcher dispatcher(2);
+  std::promise<void> stopped;
+  std::atomic<bool> dropped(true);
+
+  // Second callback of the strand is dropped by Stop, first one returns to a stopped dispatcher
+  dispatcher.Post(1, [&]()
+  {
+    EXPECT_TRUE(dispatcher.IsCallbackThread());
+    dispatcher.Stop();
+    stopped.set_value();
+  });
+  dispatcher.Post(1, [&dropped]() { dropped = false; });
+
+  ASSERT_EQ(stopped.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_FALSE(dispatcher.IsCallbackThread());
+  dispatcher.Stop();
+  EXPECT_TRUE(dropped);
+}
+
+TEST(CallbackDispatcher, IsDestroyedFromCallback)
+{
+  CallbackDispatcher* dispatcher = new CallbackDispatcher(2);
+  std::promise<void> posted;
+  std::shared_future<void> allPosted = posted.get_future().share();
+  std::promise<void> destroyed;
+
+  dispatcher->Post(1, [&, allPosted]()
+  {
+    allPosted.wait();
+    delete dispatcher;
+    destroyed.set_value();
+  });
+  dispatcher->Post(1, []() {});
+  posted.set_value();
+
+  ASSERT_EQ(destroyed.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+}
@@ -0,0 +1,217 @@
+/// @brief Test of event filter where clause evaluation.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "content_filter.h"
+#include "event_filter.h"
+
+#include <opc/ua/protocol/object_ids.h>
+#include <opc/ua/protocol/status_codes.h>
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/server/standard_address_space.h>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace OpcUa;
+
+namespace
+{
+  FilterOperand Literal(const Variant& value)
+  {
+    FilterOperand operand;
+    operand.Header.TypeId = ExpandedObjectId::LiteralOperand;
+    operand.Literal.Value = value;
+    return operand;
+  }
+
+  FilterOperand Element(uint32_t index)
+  {
+    FilterOperand operand;
+    operand.Header.TypeId = ExpandedObjectId::ElementOperand;
+    operand.Element.Index = index;
+    return operand;
+  }
+
+  FilterOperand Field(const std::string& name)
+  {
+    FilterOperand operand;
+    operand.Header.TypeId = ExpandedObjectId::SimpleAttributeOperand;
+    operand.SimpleAttribute.TypeId = ObjectId::BaseEventType;
+    operand.SimpleAttribute.BrowsePath.push_back(QualifiedName(name, 0));
+    operand.SimpleAttribute.Attribute = AttributeId::Value;
+    return operand;
+  }
+
+  ContentFilterElement MakeElement(FilterOperator op, const std::vector<FilterOperand>& operands)
+  {
+    ContentFilterElement element;
+    element.Operator = op;
+    element.FilterOperands = operands;
+    return element;
+  }
+}
+
+class ContentFilter : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    const bool debug = false;
+    NameSpace = OpcUa::Server::CreateAddressSpace(debug);
+    OpcUa::Server::FillStandardNamespace(*NameSpace, debug);
+  }
+
+  virtual void TearDown()
+  {
+    NameSpace.reset();
+  }
+
+  Internal::ContentFilterEvaluator Compile(const std::vector<ContentFilterElement>& where)
+  {
+    return Internal::ContentFilterEvaluator(where, *NameSpace);
+  }
+
+protected:
+  OpcUa::Server::AddressSpace::UniquePtr NameSpace;
+};
+
+TEST_F(ContentFilter, EmptyFilterMatchesAll)
+{
+  Internal::ContentFilterEvaluator filter = Compile({});
+  EXPECT_EQ(filter.GetStatus(), StatusCode::Good);
+  EXPECT_TRUE(filter.IsEmpty());
+  EXPECT_TRUE(filter.Match(Event()));
+}
+
+TEST_F(ContentFilter, ComparesSeverity)
+{
+  Internal::ContentFilterEvaluator filter = Compile({MakeElement(FilterOperator::GreaterThan, {Field("Severity"), Literal(uint16_t(500))})});
+  ASSERT_EQ(filter.GetStatus(), StatusCode::Good);
+
+  Event event;
+  event.Severity = 800;
+  EXPECT_TRUE(filter.Match(event));
+  event.Severity = 500;
+  EXPECT_FALSE(filter.Match(event));
+}
+
+TEST_F(ContentFilter, ComparesNumbersOfDifferentTypes)
+{
+  Internal::ContentFilterEvaluator filter = Compile({MakeElement(FilterOperator::Equals, {Field("Severity"), Literal(100.0)})});
+  ASSERT_EQ(filter.GetStatus(), StatusCode::Good);
+
+  Event event;
+  event.Severity = 100;
+  EXPECT_TRUE(filter.Match(event));
+}
+
+TEST_F(ContentFilter, OfTypeMatchesSubtypes)
+{
+  Internal::ContentFilterEvaluator filter = Compile({MakeElement(FilterOperator::OfType, {Literal(NodeId(ObjectId::SystemEventType))})});
+  ASSERT_EQ(filter.GetStatus(), StatusCode::Good);
+
+  EXPECT_TRUE(filter.Match(Event(ObjectId::SystemEventType)));
+  EXPECT_TRUE(filter.Match(Event(ObjectId::DeviceFailureEventType)));
+  EXPECT_FALSE(filter.Match(Event(ObjectId::BaseEventType)));
+}
+
+TEST_F(ContentFilter, CombinesElements)
+{
+  Internal::ContentFilterEvaluator filter = Compile({
+    MakeElement(FilterOperator::And, {Element(1), Element(2)}),
+    MakeElement(FilterOperator::InList, {Field("SourceName"), Literal(std::string("pump")), Literal(std::string("valve"))}),
+    MakeElement(FilterOperator::Or, {Element(3), Element(4)}),
+    MakeElement(FilterOperator::GreaterThanOrEqual, {Field("Severity"), Literal(uint32_t(900))}),
+    MakeElement(FilterOperator::Like, {Field("Message"), Literal(std::string("%overheat%"))}),
+  });
+  ASSERT_EQ(filter.GetStatus(), StatusCode::Good);
+
+  Event event;
+  event.SourceName = "pump";
+  event.Severity = 10;
+  event.Message = LocalizedText("motor overheated");
+  EXPECT_TRUE(filter.Match(event));
+
+  event.Message = LocalizedText("started");
+  EXPECT_FALSE(filter.Match(event));
+
+  event.Severity = 950;
+  EXPECT_TRUE(filter.Match(event));
+
+  event.SourceName = "tank";
+  EXPECT_FALSE(filter.Match(event));
+}
+
+TEST_F(ContentFilter, ReadsCustomValues)
+{
+  Internal::ContentFilterEvaluator filter = Compile({
+    MakeElement(FilterOperator::Not, {Element(1)}),
+    MakeElement(FilterOperator::IsNull, {Field("Area")}),
+  });
+  ASSERT_EQ(filter.GetStatus(), StatusCode::Good);
+
+  Event event;
+  EXPECT_FALSE(filter.Match(event));
+  event.SetValue("Area", Variant(std::string("north")));
+  EXPECT_TRUE(filter.Match(event));
+}
+
+TEST_F(ContentFilter, RejectsInvalidFilters)
+{
+  Internal::ContentFilterEvaluator count = Compile({MakeElement(FilterOperator::Equals, {Literal(1)})});
+  EXPECT_EQ(count.GetStatus(), StatusCode::BadFilterOperandCountMismatch);
+  EXPECT_FALSE(count.Match(Event()));
+
+  Internal::ContentFilterEvaluator loop = Compile({MakeElement(FilterOperator::Not, {Element(0)})});
+  EXPECT_EQ(loop.GetStatus(), StatusCode::BadFilterOperandInvalid);
+
+  Internal::ContentFilterEvaluator unsupported = Compile({MakeElement(FilterOperator::RelatedTo, {Literal(1), Literal(2)})});
+  EXPECT_EQ(unsupported.GetStatus(), StatusCode::BadFilterOperatorUnsupported);
+  ASSERT_EQ(unsupported.GetElementResults().size(), 1);
+}
+
+TEST_F(ContentFilter, SelectsEventFields)
+{
+  EventFilter filter;
+  filter.SelectClauses.push_back(Field("Severity").SimpleAttribute);
+  filter.SelectClauses.push_back(Field("SourceName").SimpleAttribute);
+  filter.SelectClauses.push_back(Field("Area").SimpleAttribute);
+  Internal::CompiledEventFilter compiled(filter, *NameSpace);
+  ASSERT_EQ(compiled.GetStatus(), StatusCode::Good);
+
+  Event event;
+  event.Severity = 300;
+  event.SourceName = "pump";
+  event.SetValue("Area", Variant(std::string("north")));
+  std::vector<Variant> fields = compiled.Select(event);
+  ASSERT_EQ(fields.size(), 3);
+  EXPECT_EQ(fields[0].As<uint16_t>(), 300);
+  EXPECT_EQ(fields[1].As<std::string>(), "pump");
+  EXPECT_EQ(fields[2].As<std::string>(), "north");
+}
+
+TEST_F(ContentFilter, ProjectsEventOncePerFilter)
+{
+  EventFilter filter;
+  filter.SelectClauses.push_back(Field("Message").SimpleAttribute);
+  filter.WhereClause.push_back(MakeElement(FilterOperator::GreaterThan, {Field("Severity"), Literal(100)}));
+  Internal::CompiledEventFilter compiled(filter, *NameSpace);
+
+  Event event;
+  event.Severity = 200;
+  event.Message = LocalizedText("high");
+  Internal::EventProjection projection(event);
+  const std::vector<Variant>* first = projection.Apply(compiled);
+  ASSERT_TRUE(first != nullptr);
+  EXPECT_EQ(first->size(), 1);
+  EXPECT_EQ(projection.Apply(compiled), first);
+
+  event.Severity = 50;
+  Internal::EventProjection rejected(event);
+  EXPECT_TRUE(rejected.Apply(compiled) == nullptr);
+}
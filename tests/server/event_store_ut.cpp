@@ -0,0 +1,106 @@
+/// @brief Test of the store of triggered events.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "event_store.h"
+
+#include <opc/ua/protocol/object_ids.h>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace OpcUa;
+
+namespace
+{
+  Event MakeEvent(const NodeId& source, int64_t time, const std::string& message = std::string())
+  {
+    Event event;
+    event.SourceNode = source;
+    event.Time = DateTime(time);
+    event.Message = LocalizedText(message);
+    return event;
+  }
+}
+
+TEST(EventStore, KeepsEventsInOrder)
+{
+  Internal::EventStore store(10, 1024 * 1024);
+  store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), 100, "first"));
+  store.Add(ObjectId::Server, MakeEvent(NodeId(2, 1), 50, "second"));
+
+  std::vector<Internal::StoredEvent> events = store.GetAll();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].Data.Message.Text, "first");
+  EXPECT_EQ(events[1].Data.Message.Text, "second");
+  EXPECT_EQ(events[1].Notifier, NodeId(ObjectId::Server));
+  EXPECT_LT(events[0].Sequence, events[1].Sequence);
+}
+
+TEST(EventStore, DropsOldestEventsWhenFull)
+{
+  Internal::EventStore store(3, 1024 * 1024);
+  for (int64_t time = 1; time <= 5; ++time)
+  {
+    store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), time));
+  }
+
+  ASSERT_EQ(store.GetSize(), 3);
+  std::vector<Internal::StoredEvent> events = store.GetByTime(DateTime(0), DateTime(10));
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_EQ(events[0].Data.Time.Value, 3);
+  EXPECT_EQ(store.GetBySource(NodeId(1, 1)).size(), 3);
+}
+
+TEST(EventStore, RespectsMemoryBudget)
+{
+  const std::string message(1000, 'x');
+  const std::size_t eventSize = Internal::EstimateEventSize(MakeEvent(NodeId(1, 1), 1, message));
+  Internal::EventStore store(100, eventSize * 2);
+  for (int64_t time = 1; time <= 5; ++time)
+  {
+    store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), time, message));
+  }
+
+  EXPECT_EQ(store.GetSize(), 2);
+  EXPECT_LE(store.GetMemoryUsage(), eventSize * 2);
+}
+
+TEST(EventStore, QueriesByTime)
+{
+  Internal::EventStore store(10, 1024 * 1024);
+  store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), 30));
+  store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), 10));
+  store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), 20));
+  Event received = MakeEvent(NodeId(1, 1), 0);
+  received.ReceiveTime = DateTime(15);
+  store.Add(ObjectId::Server, received);
+
+  std::vector<Internal::StoredEvent> events = store.GetByTime(DateTime(10), DateTime(20));
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_EQ(events[0].Data.Time.Value, 10);
+  EXPECT_EQ(events[1].Data.ReceiveTime.Value, 15);
+  EXPECT_EQ(events[2].Data.Time.Value, 20);
+}
+
+TEST(EventStore, QueriesBySource)
+{
+  Internal::EventStore store(10, 1024 * 1024);
+  store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), 1, "pump"));
+  store.Add(ObjectId::Server, MakeEvent(NodeId(2, 1), 2, "valve"));
+  store.Add(ObjectId::Server, MakeEvent(NodeId(1, 1), 3, "pump"));
+
+  std::vector<Internal::StoredEvent> events = store.GetBySource(NodeId(1, 1));
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].Data.Time.Value, 1);
+  EXPECT_EQ(events[1].Data.Time.Value, 3);
+  EXPECT_TRUE(store.GetBySource(NodeId(3, 1)).empty());
+
+  store.Clear();
+  EXPECT_EQ(store.GetSize(), 0);
+  EXPECT_TRUE(store.GetBySource(NodeId(1, 1)).empty());
+}
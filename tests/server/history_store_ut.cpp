@@ -0,0 +1,434 @@
+/// @brief Test of the store of historical values and of HistoryRead.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "history_read.h"
+#include "history_store.h"
+
+#include <opc/ua/protocol/attribute_ids.h>
+#include <opc/ua/protocol/expanded_object_ids.h>
+#include <opc/ua/server/address_space.h>
+#include <opc/ua/services/attributes.h>
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace OpcUa;
+
+namespace
+{
+  DataValue MakeValue(const Variant& variant, int64_t time)
+  {
+    DataValue value(variant);
+    value.SetSourceTimestamp(DateTime(time));
+    return value;
+  }
+
+  class TemporaryDirectory
+  {
+  public:
+    TemporaryDirectory()
+      : Path((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("opcua-history-%%%%-%%%%")).string())
+    {
+    }
+
+    ~TemporaryDirectory()
+    {
+      boost::filesystem::remove_all(Path);
+    }
+
+    const std::string Path;
+  };
+
+  HistoryReadValueId MakeValueId(const NodeId& node, const ByteString& continuationPoint = ByteString())
+  {
+    HistoryReadValueId valueId;
+    valueId.NodeId = node;
+    valueId.ContinuationPoint = continuationPoint;
+    return valueId;
+  }
+}
+
+TEST(HistoryStore, CompressesTimestampsAndValues)
+{
+  Internal::SegmentWriter writer;
+  std::vector<double> expected;
+  for (int i = 0; i < 100; ++i)
+  {
+    expected.push_back(20.0 + (i % 7) * 0.25);
+    writer.Append(1000 + i * 10 + (i % 3), MakeValue(expected.back(), 0));
+  }
+  // each value takes much less than its time and value of 16 bytes
+  EXPECT_LT(writer.GetData().size(), 100u * 4);
+
+  std::vector<DataValue> values;
+  Internal::DecodeSegment(writer.GetHeader(), writer.GetData().data(), values);
+  ASSERT_EQ(values.size(), expected.size());
+  for (int i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(values[i].SourceTimestamp.Value, 1000 + i * 10 + (i % 3));
+    EXPECT_EQ(values[i].Value.As<double>(), expected[i]);
+    EXPECT_EQ(values[i].Status, StatusCode::Good);
+  }
+}
+
+TEST(HistoryStore, KeepsTypesAndStatuses)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  store->Append(node, MakeValue(int32_t(-5), 10));
+  store->Append(node, MakeValue(int32_t(7), 20));
+  store->Append(node, MakeValue(std::string("text"), 30));
+  DataValue bad = MakeValue(int32_t(8), 40);
+  bad.Status = StatusCode::BadSensorFailure;
+  bad.Encoding |= DATA_VALUE_STATUS_CODE;
+  store->Append(node, bad);
+
+  std::vector<DataValue> values = store->Read(node, DateTime(0), DateTime(100), 0);
+  ASSERT_EQ(values.size(), 4);
+  EXPECT_EQ(values[0].Value.As<int32_t>(), -5);
+  EXPECT_EQ(values[1].Value.As<int32_t>(), 7);
+  EXPECT_EQ(values[2].Value.As<std::string>(), "text");
+  EXPECT_EQ(values[3].Value.As<int32_t>(), 8);
+  EXPECT_EQ(values[3].Status, StatusCode::BadSensorFailure);
+
+  EXPECT_TRUE(store->Read(NodeId(2, 2), DateTime(0), DateTime(100), 0).empty());
+}
+
+TEST(HistoryStore, ReadsStoredSegmentsAfterRestart)
+{
+  TemporaryDirectory directory;
+  const NodeId node("Temperature", 2);
+  {
+    Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore(directory.Path);
+    for (uint32_t i = 0; i < Internal::MaxSegmentValues + 10; ++i)
+    {
+      store->Append(node, MakeValue(double(i), 100 + i));
+    }
+  }
+
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore(directory.Path);
+  std::vector<DataValue> values = store->Read(node, DateTime(0), DateTime(100000), 0);
+  ASSERT_EQ(values.size(), Internal::MaxSegmentValues + 10);
+  EXPECT_EQ(values.back().Value.As<double>(), Internal::MaxSegmentValues + 9);
+
+  DataValue value;
+  ASSERT_TRUE(store->ReadBefore(node, DateTime(150), value));
+  EXPECT_EQ(value.SourceTimestamp.Value, 150);
+  ASSERT_TRUE(store->ReadAfter(node, DateTime(50), value));
+  EXPECT_EQ(value.SourceTimestamp.Value, 100);
+  EXPECT_FALSE(store->ReadBefore(node, DateTime(50), value));
+}
+
+TEST(HistoryStore, FindsValuesAroundTimeInManySegments)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  const int64_t count = 5 * Internal::MaxSegmentValues + 10;
+  for (int64_t i = 1; i < count; ++i)
+  {
+    store->Append(node, MakeValue(double(i), 10 * i));
+  }
+
+  DataValue value;
+  ASSERT_TRUE(store->ReadBefore(node, DateTime(10 * 2000 + 5), value));
+  EXPECT_EQ(value.Value.As<double>(), 2000.0);
+  ASSERT_TRUE(store->ReadBefore(node, DateTime(10 * count), value));
+  EXPECT_EQ(value.Value.As<double>(), double(count - 1));
+  ASSERT_TRUE(store->ReadAfter(node, DateTime(10 * 3000 - 5), value));
+  EXPECT_EQ(value.Value.As<double>(), 3000.0);
+  ASSERT_TRUE(store->ReadAfter(node, DateTime(10 * (count - 1)), value));
+  EXPECT_EQ(value.Value.As<double>(), double(count - 1));
+  EXPECT_FALSE(store->ReadAfter(node, DateTime(10 * count), value));
+
+  std::vector<DataValue> values = store->Read(node, DateTime(10 * 1000), DateTime(10 * count), 1500);
+  ASSERT_EQ(values.size(), 1500);
+  EXPECT_EQ(values.front().Value.As<double>(), 1000.0);
+  EXPECT_EQ(values.back().Value.As<double>(), 2499.0);
+}
+
+TEST(HistoryStore, FindsValuesAroundTimeWithLateValues)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  for (int64_t i = 1; i < 2 * Internal::MaxSegmentValues; ++i)
+  {
+    store->Append(node, MakeValue(double(i), 10 * i));
+  }
+  // a source sends old values after newer ones, segments now overlap
+  store->Append(node, MakeValue(-1.0, 10 * 500 + 5));
+  store->Append(node, MakeValue(-2.0, 10 * 1500 + 5));
+
+  DataValue value;
+  ASSERT_TRUE(store->ReadBefore(node, DateTime(10 * 500 + 7), value));
+  EXPECT_EQ(value.Value.As<double>(), -1.0);
+  ASSERT_TRUE(store->ReadAfter(node, DateTime(10 * 1500 + 1), value));
+  EXPECT_EQ(value.Value.As<double>(), -2.0);
+  ASSERT_TRUE(store->ReadBefore(node, DateTime(10 * 1500 + 4), value));
+  EXPECT_EQ(value.Value.As<double>(), 1500.0);
+
+  std::vector<DataValue> values = store->Read(node, DateTime(10 * 500), DateTime(10 * 502), 3);
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0].Value.As<double>(), 500.0);
+  EXPECT_EQ(values[1].Value.As<double>(), -1.0);
+  EXPECT_EQ(values[2].Value.As<double>(), 501.0);
+}
+
+TEST(HistoryRead, ReadsRawValuesByPages)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  for (int i = 0; i < 5; ++i)
+  {
+    store->Append(node, MakeValue(i, 10 * (i + 1)));
+  }
+
+  ReadRawModifiedDetails raw;
+  raw.StartTime = DateTime(10);
+  raw.EndTime = DateTime(60);
+  raw.NumValuesPerNode = 2;
+  const HistoryReadDetails details(raw);
+
+  HistoryReadResult result = Internal::ReadHistory(*store, details, TimestampsToReturn::Source, MakeValueId(node));
+  EXPECT_EQ(result.Status, StatusCode::GoodMoreData);
+  ASSERT_EQ(result.DataValues.size(), 2);
+  EXPECT_EQ(result.DataValues[1].Value.As<int>(), 1);
+  EXPECT_FALSE(result.DataValues[0].Encoding & DATA_VALUE_Server_TIMESTAMP);
+
+  result = Internal::ReadHistory(*store, details, TimestampsToReturn::Source, MakeValueId(node, result.ContinuationPoint));
+  ASSERT_EQ(result.DataValues.size(), 2);
+  EXPECT_EQ(result.DataValues[0].Value.As<int>(), 2);
+
+  result = Internal::ReadHistory(*store, details, TimestampsToReturn::Source, MakeValueId(node, result.ContinuationPoint));
+  ASSERT_EQ(result.DataValues.size(), 1);
+  EXPECT_EQ(result.DataValues[0].Value.As<int>(), 4);
+  EXPECT_TRUE(result.ContinuationPoint.Data.empty());
+}
+
+TEST(HistoryRead, ReadsRawValuesInReverseOrderWithBounds)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  for (int i = 0; i < 5; ++i)
+  {
+    store->Append(node, MakeValue(i, 10 * (i + 1)));
+  }
+
+  ReadRawModifiedDetails raw;
+  raw.StartTime = DateTime(35);
+  raw.EndTime = DateTime(20);
+  raw.ReturnBounds = true;
+
+  HistoryReadResult result = Internal::ReadHistory(*store, HistoryReadDetails(raw), TimestampsToReturn::Both, MakeValueId(node));
+  ASSERT_EQ(result.DataValues.size(), 3);
+  EXPECT_EQ(result.DataValues[0].SourceTimestamp.Value, 40); // bound after start
+  EXPECT_EQ(result.DataValues[1].SourceTimestamp.Value, 30);
+  EXPECT_EQ(result.DataValues[2].SourceTimestamp.Value, 20); // bound at end
+
+  raw.StartTime = DateTime();
+  result = Internal::ReadHistory(*store, HistoryReadDetails(raw), TimestampsToReturn::Both, MakeValueId(node));
+  EXPECT_EQ(result.Status, StatusCode::BadInvalidTimestampArgument);
+}
+
+TEST(HistoryRead, ReadsValuesAtTime)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  store->Append(node, MakeValue(10.0, 100));
+  store->Append(node, MakeValue(20.0, 200));
+
+  ReadAtTimeDetails atTime;
+  atTime.ReqTimes = {DateTime(50), DateTime(100), DateTime(150), DateTime(250)};
+
+  HistoryReadResult result = Internal::ReadHistory(*store, HistoryReadDetails(atTime), TimestampsToReturn::Source, MakeValueId(node));
+  ASSERT_EQ(result.DataValues.size(), 4);
+  EXPECT_EQ(result.DataValues[0].Status, StatusCode::BadNoData);
+  EXPECT_EQ(result.DataValues[1].Value.As<double>(), 10.0);
+  EXPECT_EQ(result.DataValues[2].Value.As<double>(), 15.0);
+  EXPECT_EQ(result.DataValues[2].SourceTimestamp.Value, 150);
+  EXPECT_EQ(result.DataValues[3].Value.As<double>(), 20.0);
+  EXPECT_EQ(result.DataValues[3].Status, StatusCode::UncertainDataSubNormal);
+}
+
+TEST(HistoryRead, RecordsHistorizingVariables)
+{
+  Server::AddressSpace::SharedPtr addressSpace = Server::CreateAddressSpace(false);
+  addressSpace->SetHistoryBackend(Server::CreateHistoryStore(""));
+
+  VariableAttributes attrs;
+  attrs.DisplayName = LocalizedText("Pressure");
+  attrs.Value = 1.0;
+  attrs.Historizing = true;
+  AddNodesItem item;
+  item.RequestedNewNodeId = NodeId(1, 2);
+  item.BrowseName = QualifiedName("Pressure", 2);
+  item.Class = NodeClass::Variable;
+  item.Attributes = attrs;
+  ASSERT_EQ(addressSpace->AddNodes({item})[0].Status, StatusCode::Good);
+
+  WriteValue write;
+  write.NodeId = NodeId(1, 2);
+  write.AttributeId = AttributeId::Value;
+  write.Value = MakeValue(2.0, 1000);
+  addressSpace->Write({write});
+
+  ReadRawModifiedDetails raw;
+  raw.StartTime = DateTime(1);
+  raw.NumValuesPerNode = 10;
+  HistoryReadParameters params;
+  params.Details = HistoryReadDetails(raw);
+  params.NodesToRead.push_back(MakeValueId(NodeId(1, 2)));
+  params.NodesToRead.push_back(MakeValueId(NodeId(99, 2)));
+
+  std::vector<HistoryReadResult> results = addressSpace->HistoryRead(params);
+  ASSERT_EQ(results.size(), 2);
+  ASSERT_EQ(results[0].DataValues.size(), 1);
+  EXPECT_EQ(results[0].DataValues[0].Value.As<double>(), 2.0);
+  EXPECT_EQ(results[1].Status, StatusCode::BadNodeIdUnknown);
+}
+
+namespace
+{
+  class AttributesWithoutHistory : public AttributeServices
+  {
+  public:
+    virtual std::vector<DataValue> Read(const ReadParameters&) const
+    {
+      return std::vector<DataValue>();
+    }
+
+    virtual std::vector<StatusCode> Write(const std::vector<WriteValue>&)
+    {
+      return std::vector<StatusCode>();
+    }
+  };
+}
+
+TEST(HistoryRead, IsUnsupportedByDefault)
+{
+  AttributesWithoutHistory attributes;
+  HistoryReadParameters params;
+  params.NodesToRead.push_back(MakeValueId(NodeId(1, 2)));
+  params.NodesToRead.push_back(MakeValueId(NodeId(2, 2)));
+
+  std::vector<HistoryReadResult> results = attributes.HistoryRead(params);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0].Status, StatusCode::BadHistoryOperationUnsupported);
+  EXPECT_EQ(results[1].Status, StatusCode::BadHistoryOperationUnsupported);
+}
+
+namespace
+{
+  HistoryReadResult ReadAggregate(const Server::HistoryBackend& store, const NodeId& node, ObjectId aggregate, int64_t start, int64_t end, Duration interval)
+  {
+    ReadProcessedDetails processed;
+    processed.StartTime = DateTime(start);
+    processed.EndTime = DateTime(end);
+    processed.ProcessingInterval = interval;
+    return Internal::ReadHistory(store, HistoryReadDetails(processed), TimestampsToReturn::Source, MakeValueId(node), aggregate);
+  }
+}
+
+TEST(HistoryRead, ComputesAggregatesByInterval)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  // one value each millisecond, several full segments
+  const int64_t count = 3 * Internal::MaxSegmentValues;
+  for (int64_t i = 0; i < count; ++i)
+  {
+    store->Append(node, MakeValue(double(i % 100), 10000 * (i + 1)));
+  }
+  const int64_t start = 10000;
+  const int64_t end = start + 10000 * count;
+  const Duration interval = Internal::MaxSegmentValues;
+
+  HistoryReadResult result = ReadAggregate(*store, node, ObjectId::AggregateFunction_Count, start, end, interval);
+  ASSERT_EQ(result.DataValues.size(), 3);
+  EXPECT_EQ(result.DataValues[0].Value.As<int32_t>(), Internal::MaxSegmentValues);
+  EXPECT_EQ(result.DataValues[1].SourceTimestamp.Value, start + 10000 * Internal::MaxSegmentValues);
+
+  result = ReadAggregate(*store, node, ObjectId::AggregateFunction_Maximum, start, end, 0);
+  ASSERT_EQ(result.DataValues.size(), 1);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 99.0);
+  EXPECT_EQ(result.DataValues[0].SourceTimestamp.Value, 10000 * 100);
+
+  result = ReadAggregate(*store, node, ObjectId::AggregateFunction_Minimum, start, end, 0);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 0.0);
+  EXPECT_EQ(result.DataValues[0].SourceTimestamp.Value, 10000);
+
+  result = ReadAggregate(*store, node, ObjectId::AggregateFunction_Average, start, start + 10000 * 100, 0);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 49.5);
+
+  result = ReadAggregate(*store, node, ObjectId::AggregateFunction_End, start, start + 10000 * 100, 0);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 99.0);
+
+  result = ReadAggregate(*store, node, ObjectId::AggregateFunction_Start, end, start, interval);
+  ASSERT_EQ(result.DataValues.size(), 3);
+  EXPECT_EQ(result.DataValues[0].SourceTimestamp.Value, start + 20000 * Internal::MaxSegmentValues);
+}
+
+TEST(HistoryRead, ComputesAggregatesWithUncertainValues)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  // every tenth value is uncertain, first segment is summarized, second one is decoded
+  for (int64_t i = 0; i < 2 * Internal::MaxSegmentValues; ++i)
+  {
+    DataValue value = MakeValue(i % 10 == 9 ? 100.0 : double(i % 10), 10000 * (i + 1));
+    if ( i % 10 == 9 )
+    {
+      value.Status = StatusCode::UncertainDataSubNormal;
+      value.Encoding |= DATA_VALUE_STATUS_CODE;
+    }
+    store->Append(node, value);
+  }
+
+  ReadProcessedDetails processed;
+  processed.StartTime = DateTime(10000);
+  processed.EndTime = DateTime(10000 * 2041);
+  processed.AggregateConfiguration.UseServerCapabilitiesDefaults = false;
+  processed.AggregateConfiguration.PercentDataBad = 100;
+  processed.AggregateConfiguration.PercentDataGood = 0;
+
+  processed.AggregateConfiguration.TreatUncertainAsBad = false;
+  HistoryReadResult result = Internal::ReadHistory(*store, HistoryReadDetails(processed), TimestampsToReturn::Source, MakeValueId(node), ObjectId::AggregateFunction_Average);
+  ASSERT_EQ(result.DataValues.size(), 1);
+  EXPECT_DOUBLE_EQ(result.DataValues[0].Value.As<double>(), 13.6);
+  result = Internal::ReadHistory(*store, HistoryReadDetails(processed), TimestampsToReturn::Source, MakeValueId(node), ObjectId::AggregateFunction_Maximum);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 100.0);
+
+  processed.AggregateConfiguration.TreatUncertainAsBad = true;
+  result = Internal::ReadHistory(*store, HistoryReadDetails(processed), TimestampsToReturn::Source, MakeValueId(node), ObjectId::AggregateFunction_Average);
+  EXPECT_DOUBLE_EQ(result.DataValues[0].Value.As<double>(), 4.0);
+  result = Internal::ReadHistory(*store, HistoryReadDetails(processed), TimestampsToReturn::Source, MakeValueId(node), ObjectId::AggregateFunction_Maximum);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 8.0);
+}
+
+TEST(HistoryRead, ComputesTimeWeightedAggregates)
+{
+  Server::HistoryBackend::UniquePtr store = Server::CreateHistoryStore("");
+  const NodeId node(1, 2);
+  store->Append(node, MakeValue(0.0, 10000));
+  store->Append(node, MakeValue(10.0, 20000));
+  store->Append(node, MakeValue(10.0, 40000));
+  store->Append(node, MakeValue(0.0, 50000));
+
+  HistoryReadResult result = ReadAggregate(*store, node, ObjectId::AggregateFunction_TimeAverage, 10000, 50000, 0);
+  ASSERT_EQ(result.DataValues.size(), 1);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 7.5);
+  EXPECT_EQ(result.DataValues[0].Status, StatusCode::Good);
+
+  result = ReadAggregate(*store, node, ObjectId::AggregateFunction_Interpolative, 15000, 55000, 2);
+  ASSERT_EQ(result.DataValues.size(), 2);
+  EXPECT_EQ(result.DataValues[0].Value.As<double>(), 5.0);
+  EXPECT_EQ(result.DataValues[1].Value.As<double>(), 10.0);
+
+  result = ReadAggregate(*store, node, ObjectId::AggregateFunction_Range, 10000, 50000, 0);
+  EXPECT_EQ(result.Status, StatusCode::BadAggregateNotSupported);
+}
@@ -11,11 +11,21 @@
 #include "opcua_protocol_addon_test.h"
 
 #include <opc/common/addons_core/addon_manager.h>
+#include <opc/ua/client/batch.h>
+#include <opc/ua/client/binary_client.h>
+#include <opc/ua/client/cache.h>
+#include <opc/ua/client/pool.h>
+#include <opc/ua/client/reconnect.h>
 #include <opc/ua/client/remote_connection.h>
+#include <opc/ua/protocol/string_utils.h>
+#include <opc/ua/subscription.h>
 #include "builtin_server_addon.h"
 #include "builtin_server.h"
+#include "server_clock.h"
 
 #include <opc/ua/server/addons/opcua_protocol.h>
+#include <opc/ua/server/addons/subscription_service.h>
+#include <opc/ua/server/subscription_service.h>
 #include "address_space_registry_test.h"
 #include "endpoints_services_test.h"
 #include "services_registry_test.h"
@@ -24,6 +34,8 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <condition_variable>
+#include <future>
 #include <iostream>
 #include <thread>
 
@@ -139,6 +151,60 @@ TEST_F(OpcUaProtocolAddonTest, CanCreateSession)
   computer.reset();
 }
 
+TEST_F(OpcUaProtocolAddonTest, TakesResponseAndPublishTimesFromServerClock)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  std::shared_ptr<OpcUa::Services> computer = computerAddon->GetServices();
+
+  // Precise clock is ahead of the coarse one, so only coarse times stay before the coarse time taken afterwards
+  OpcUa::Server::ServerClock::SetCoarse(true);
+  const OpcUa::DateTime before = OpcUa::DateTime::CurrentCoarse();
+
+  OpcUa::RemoteSessionParameters session;
+  session.ClientDescription.ApplicationName.Text = "opcua client";
+  session.SessionName = "opua command line";
+  session.EndpointUrl = "opc.tcp://localhost:4841";
+  session.Timeout = 1000;
+  const OpcUa::CreateSessionResponse response = computer->CreateSession(session);
+
+  OpcUa::CreateSubscriptionRequest request;
+  request.Parameters.RequestedPublishingInterval = 10;
+  std::atomic<bool> first(true);
+  std::promise<OpcUa::DateTime> published;
+  const OpcUa::SubscriptionData subscription = computer->Subscriptions()->CreateSubscription(request, [&first, &published](OpcUa::PublishResult result)
+    {
+      if (first.exchange(false))
+      {
+        published.set_value(result.NotificationMessage.PublishTime);
+      }
+    });
+  // Initial value of the item is published at once
+  OpcUa::MonitoredItemsParameters items;
+  items.SubscriptionId = subscription.SubscriptionId;
+  OpcUa::MonitoredItemCreateRequest item;
+  item.ItemToMonitor = OpcUa::ToReadValueId(OpcUa::ObjectId::Server_ServerStatus_BuildInfo_BuildNumber, OpcUa::AttributeId::Value);
+  item.MonitoringMode = OpcUa::MonitoringMode::Reporting;
+  item.RequestedParameters.ClientHandle = 1;
+  item.RequestedParameters.QueueSize = 1;
+  items.ItemsToCreate.push_back(item);
+  computer->Subscriptions()->CreateMonitoredItems(items);
+  std::future<OpcUa::DateTime> publishTime = published.get_future();
+  const bool ready = publishTime.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+  computer->Subscriptions()->DeleteSubscriptions(std::vector<uint32_t>{subscription.SubscriptionId});
+
+  const OpcUa::DateTime after = OpcUa::DateTime::CurrentCoarse();
+  OpcUa::Server::ServerClock::SetCoarse(false);
+
+  EXPECT_LE(before.Value, response.Header.Timestamp.Value);
+  EXPECT_LE(response.Header.Timestamp.Value, after.Value);
+  ASSERT_TRUE(ready);
+  const OpcUa::DateTime publish = publishTime.get();
+  EXPECT_LE(before.Value, publish.Value);
+  EXPECT_LE(publish.Value, after.Value);
+
+  computer.reset();
+}
+
 TEST_F(OpcUaProtocolAddonTest, ManipulateSubscriptions)
 {
   std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
@@ -180,3 +246,661 @@ TEST_F(OpcUaProtocolAddonTest, CanReadAttributes)
   attributes.reset();
   computer.reset();
 }
+
+TEST_F(OpcUaProtocolAddonTest, CanReadAttributesAsynchronously)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  std::shared_ptr<OpcUa::Services> computer = computerAddon->GetServices();
+  std::shared_ptr<OpcUa::AsyncServices> async = computer->Async();
+  ASSERT_TRUE(static_cast<bool>(async));
+
+  OpcUa::ReadParameters params;
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+
+  const unsigned count = 50;
+  std::vector<std::shared_ptr<std::promise<std::vector<OpcUa::DataValue>>>> promises;
+  for (unsigned i = 0; i < count; ++i)
+  {
+    std::shared_ptr<std::promise<std::vector<OpcUa::DataValue>>> promise(new std::promise<std::vector<OpcUa::DataValue>>());
+    promises.push_back(promise);
+    async->Read(params, [promise](OpcUa::StatusCode status, std::vector<OpcUa::DataValue> values){
+      ASSERT_EQ(status, OpcUa::StatusCode::Good);
+      promise->set_value(values);
+    });
+  }
+
+  for (auto promise : promises)
+  {
+    std::future<std::vector<OpcUa::DataValue>> result = promise->get_future();
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    std::vector<OpcUa::DataValue> values = result.get();
+    ASSERT_EQ(values.size(), 1);
+    ASSERT_EQ(values[0].Value.As<OpcUa::QualifiedName>().Name, "Root");
+  }
+
+  async.reset();
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, ClientIsDestroyedFromItsCallback)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  // callback drops the only reference to the client
+  std::shared_ptr<std::shared_ptr<OpcUa::AsyncServices>> client(new std::shared_ptr<OpcUa::AsyncServices>(computerAddon->GetServices()->Async()));
+  OpcUa::AsyncServices& async = **client;
+
+  OpcUa::ReadParameters params;
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+  std::promise<void> sent;
+  std::shared_future<void> readSent = sent.get_future().share();
+  std::promise<std::size_t> destroyed;
+  async.Read(params, [client, readSent, &destroyed](OpcUa::StatusCode, std::vector<OpcUa::DataValue> values)
+  {
+    readSent.wait();
+    client->reset();
+    destroyed.set_value(values.size());
+  });
+  sent.set_value();
+
+  std::future<std::size_t> result = destroyed.get_future();
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_EQ(result.get(), 1);
+}
+
+TEST_F(OpcUaProtocolAddonTest, ReadsInBatchesOfLimitedSize)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  std::shared_ptr<OpcUa::Services> computer = computerAddon->GetServices();
+
+  OpcUa::ReadParameters params;
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::ObjectsFolder, OpcUa::AttributeId::BrowseName));
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::TypesFolder, OpcUa::AttributeId::BrowseName));
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::ViewsFolder, OpcUa::AttributeId::BrowseName));
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+
+  std::vector<OpcUa::DataValue> values = OpcUa::ReadInBatches(*computer->Attributes(), params, 2);
+  ASSERT_EQ(values.size(), 5);
+  EXPECT_EQ(values[0].Value.As<OpcUa::QualifiedName>().Name, "Root");
+  EXPECT_EQ(values[1].Value.As<OpcUa::QualifiedName>().Name, "Objects");
+  EXPECT_EQ(values[2].Value.As<OpcUa::QualifiedName>().Name, "Types");
+  EXPECT_EQ(values[3].Value.As<OpcUa::QualifiedName>().Name, "Views");
+  EXPECT_EQ(values[4].Value.As<OpcUa::QualifiedName>().Name, "Root");
+
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, CoalescesConcurrentReads)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::BatchLimits limits;
+  limits.MaxNodesPerRead = 3;
+  std::shared_ptr<OpcUa::Services> computer = OpcUa::CreateBatchingServices(computerAddon->GetServices(), std::chrono::milliseconds(20), limits);
+
+  const std::vector<OpcUa::NodeId> nodes = {OpcUa::ObjectId::RootFolder, OpcUa::ObjectId::ObjectsFolder, OpcUa::ObjectId::TypesFolder, OpcUa::ObjectId::ViewsFolder};
+  const std::vector<std::string> names = {"Root", "Objects", "Types", "Views"};
+  std::vector<std::string> results(nodes.size());
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+  {
+    threads.push_back(std::thread([&computer, &nodes, &results, i]()
+    {
+      OpcUa::ReadParameters params;
+      params.AttributesToRead.push_back(OpcUa::ToReadValueId(nodes[i], OpcUa::AttributeId::BrowseName));
+      std::vector<OpcUa::DataValue> values = computer->Attributes()->Read(params);
+      if (values.size() == 1)
+        results[i] = values[0].Value.As<OpcUa::QualifiedName>().Name;
+    }));
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+
+  ASSERT_EQ(results, names);
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, DoesNotDelaySequentialReads)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  std::shared_ptr<OpcUa::Services> computer = OpcUa::CreateBatchingServices(computerAddon->GetServices(), std::chrono::seconds(10));
+
+  OpcUa::ReadParameters params;
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+  // a lone caller does not wait for the window, each read would take 10 seconds otherwise
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 3; ++i)
+  {
+    std::vector<OpcUa::DataValue> values = computer->Attributes()->Read(params);
+    ASSERT_EQ(values.size(), 1);
+    EXPECT_EQ(values[0].Value.As<OpcUa::QualifiedName>().Name, "Root");
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, SendsAttributeBatchOnFlush)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  std::shared_ptr<OpcUa::Services> computer = computerAddon->GetServices();
+
+  OpcUa::BatchLimits limits;
+  limits.MaxNodesPerRead = 1;
+  OpcUa::AttributeBatch batch(computer, limits);
+  std::shared_future<OpcUa::DataValue> root = batch.Read(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName);
+  std::shared_future<OpcUa::DataValue> objects = batch.Read(OpcUa::ObjectId::ObjectsFolder, OpcUa::AttributeId::BrowseName);
+  ASSERT_EQ(root.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+
+  batch.Flush();
+  EXPECT_EQ(root.get().Value.As<OpcUa::QualifiedName>().Name, "Root");
+  EXPECT_EQ(objects.get().Value.As<OpcUa::QualifiedName>().Name, "Objects");
+
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, CachesStaticAttributes)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::CachingServices::SharedPtr cache = OpcUa::CreateCachingServices(computerAddon->GetServices());
+
+  OpcUa::ReadParameters params;
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::Value));
+
+  std::vector<OpcUa::DataValue> values = cache->Attributes()->Read(params);
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0].Value.As<OpcUa::QualifiedName>().Name, "Root");
+  EXPECT_EQ(cache->GetSize(), 1);
+
+  values = cache->Attributes()->Read(params);
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0].Value.As<OpcUa::QualifiedName>().Name, "Root");
+  EXPECT_EQ(cache->GetSize(), 1);
+
+  cache->Invalidate(OpcUa::ObjectId::RootFolder);
+  EXPECT_EQ(cache->GetSize(), 0);
+
+  // Root and its three folders, with at least NodeClass, BrowseName and DisplayName each
+  cache->Prefetch(OpcUa::ObjectId::RootFolder, 1);
+  EXPECT_GE(cache->GetSize(), 4 * 3);
+
+  cache.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, DropsLeastRecentlyUsedAttributes)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::AttributeCacheParameters cacheParams;
+  cacheParams.MaxEntries = 2;
+  OpcUa::CachingServices::SharedPtr cache = OpcUa::CreateCachingServices(computerAddon->GetServices(), cacheParams);
+
+  OpcUa::ReadParameters params;
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::ObjectsFolder, OpcUa::AttributeId::BrowseName));
+  params.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::TypesFolder, OpcUa::AttributeId::BrowseName));
+
+  std::vector<OpcUa::DataValue> values = cache->Attributes()->Read(params);
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[2].Value.As<OpcUa::QualifiedName>().Name, "Types");
+  EXPECT_EQ(cache->GetSize(), 2);
+
+  cache.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, CachesMonitoredValueAgainAfterEviction)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::AttributeCacheParameters cacheParams;
+  cacheParams.MaxEntries = 1;
+  cacheParams.SubscribeValues = true;
+  // no notification comes during the test, values are cached from reads only
+  cacheParams.PublishingInterval = 60000;
+  OpcUa::CachingServices::SharedPtr cache = OpcUa::CreateCachingServices(computerAddon->GetServices(), cacheParams);
+
+  OpcUa::ReadParameters values;
+  values.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::Server_NamespaceArray, OpcUa::AttributeId::Value));
+  values.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::Server_ServerArray, OpcUa::AttributeId::Value));
+  ASSERT_EQ(cache->Attributes()->Read(values).size(), 2);
+
+  OpcUa::ReadParameters name;
+  name.AttributesToRead.push_back(OpcUa::ToReadValueId(OpcUa::ObjectId::RootFolder, OpcUa::AttributeId::BrowseName));
+  ASSERT_EQ(cache->Attributes()->Read(name).size(), 1);
+  EXPECT_EQ(cache->GetSize(), 1);
+
+  // value of an already monitored node is stored and evicts the browse name
+  OpcUa::ReadParameters value;
+  value.AttributesToRead.push_back(values.AttributesToRead[0]);
+  ASSERT_EQ(cache->Attributes()->Read(value).size(), 1);
+  cache->Invalidate(OpcUa::ObjectId::RootFolder);
+  EXPECT_EQ(cache->GetSize(), 1);
+
+  cache.reset();
+}
+
+namespace
+{
+  class BatchHandler : public OpcUa::SubscriptionHandler
+  {
+  public:
+    bool BatchDataChanges() const override
+    {
+      return true;
+    }
+
+    void DataChanges(uint32_t subscriptionId, const OpcUa::DataChangeBatch& changes) override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      ++Calls;
+      SubscriptionId = subscriptionId;
+      Changes = changes;
+      Changed.notify_all();
+    }
+
+    void DataChange(uint32_t, const OpcUa::Node&, const OpcUa::Variant&, OpcUa::AttributeId) override
+    {
+      ++ItemCalls;
+    }
+
+    bool WaitForValue(const OpcUa::Variant& value)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      return Changed.wait_for(lock, std::chrono::seconds(5), [this, &value]()
+        {
+          return Changes.Size() != 0 && Changes.Values.back() == value;
+        });
+    }
+
+    std::mutex Mutex;
+    std::condition_variable Changed;
+    unsigned Calls = 0;
+    unsigned ItemCalls = 0;
+    uint32_t SubscriptionId = 0;
+    OpcUa::DataChangeBatch Changes;
+  };
+}
+
+TEST_F(OpcUaProtocolAddonTest, DeliversDataChangesAsColumns)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::Services::SharedPtr computer = computerAddon->GetServices();
+
+  OpcUa::CreateSubscriptionParameters params;
+  params.RequestedPublishingInterval = 100;
+  BatchHandler handler;
+  OpcUa::Subscription subscription(computer, params, handler);
+
+  OpcUa::MonitoredItems first;
+  first.ClientHandle = 1;
+  first.Value = OpcUa::DataValue(10);
+  first.Value.Status = OpcUa::StatusCode::BadNodeIdUnknown;
+  first.Value.Encoding |= OpcUa::DATA_VALUE_STATUS_CODE;
+  OpcUa::MonitoredItems second;
+  second.ClientHandle = 2;
+  second.Value = OpcUa::DataValue(20);
+  second.Value.SourceTimestamp = OpcUa::DateTime(1000);
+  second.Value.Encoding |= OpcUa::DATA_VALUE_SOURCE_TIMESTAMP;
+
+  OpcUa::DataChangeNotification notification;
+  notification.Notification.push_back(first);
+  notification.Notification.push_back(second);
+  OpcUa::PublishResult result;
+  result.SubscriptionId = subscription.GetId();
+  result.NotificationMessage.NotificationData.push_back(OpcUa::NotificationData(notification));
+  subscription.PublishCallback(computer, result);
+
+  ASSERT_EQ(handler.Calls, 1);
+  EXPECT_EQ(handler.ItemCalls, 0);
+  EXPECT_EQ(handler.SubscriptionId, subscription.GetId());
+  ASSERT_EQ(handler.Changes.Size(), 2);
+  EXPECT_EQ(handler.Changes.ClientHandles, std::vector<uint32_t>({1, 2}));
+  EXPECT_EQ(handler.Changes.Values[0].As<int>(), 10);
+  EXPECT_EQ(handler.Changes.Values[1].As<int>(), 20);
+  EXPECT_EQ(handler.Changes.Statuses[0], OpcUa::StatusCode::BadNodeIdUnknown);
+  EXPECT_EQ(handler.Changes.Statuses[1], OpcUa::StatusCode::Good);
+  EXPECT_EQ(handler.Changes.SourceTimestamps[0], OpcUa::DateTime());
+  EXPECT_EQ(handler.Changes.SourceTimestamps[1], OpcUa::DateTime(1000));
+
+  subscription.Delete();
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, KeepsPublishPipelineFilled)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::Services::SharedPtr computer = computerAddon->GetServices();
+
+  OpcUa::CreateSubscriptionParameters params;
+  params.RequestedPublishingInterval = 10;
+  BatchHandler handler;
+  OpcUa::Subscription subscription(computer, params, handler);
+  subscription.SubscribeDataChange(std::vector<OpcUa::ReadValueId>{OpcUa::ToReadValueId(OpcUa::ObjectId::Server_ServerStatus_BuildInfo_BuildNumber, OpcUa::AttributeId::Value)});
+
+  // Every change must reach the handler although publish responses are not answered one by one
+  for (int i = 0; i < 10; ++i)
+  {
+    OpcUa::WriteValue value;
+    value.NodeId = OpcUa::ObjectId::Server_ServerStatus_BuildInfo_BuildNumber;
+    value.AttributeId = OpcUa::AttributeId::Value;
+    value.Value = OpcUa::DataValue(std::string("build ") + std::to_string(i));
+    computer->Attributes()->Write(std::vector<OpcUa::WriteValue>{value});
+    ASSERT_TRUE(handler.WaitForValue(value.Value.Value));
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(handler.Mutex);
+    EXPECT_GE(handler.Calls, 10);
+    ASSERT_EQ(handler.Changes.Size(), 1);
+    EXPECT_EQ(handler.Changes.Values[0].As<std::string>(), "build 9");
+  }
+
+  subscription.Delete();
+  computer.reset();
+}
+
+TEST(PublishWindow, KeepsRequestForEveryIntervalOfRoundTrip)
+{
+  OpcUa::PublishWindow window(10);
+  EXPECT_TRUE(window.IsEmpty());
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(25)), 0);
+
+  window.SetInterval(1, 100);
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(0)), 2);
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(250)), 4);
+
+  window.SetInterval(2, 10);
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(25)), 6);
+  EXPECT_EQ(window.GetSize(std::chrono::seconds(1)), 10);
+
+  window.RemoveInterval(2);
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(25)), 2);
+  window.RemoveInterval(1);
+  EXPECT_TRUE(window.IsEmpty());
+}
+
+TEST(PublishWindow, StaysBelowRequestsAcceptedByServer)
+{
+  OpcUa::PublishWindow window(4);
+  window.SetInterval(1, 10);
+  window.SetInterval(2, 10);
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(25)), 4);
+
+  // BadTooManyPublishRequests with 3 requests held by the server
+  window.LowerLimit(3);
+  EXPECT_EQ(window.GetLimit(), 3);
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(25)), 3);
+
+  // Limit is never raised and a single request is always allowed
+  window.LowerLimit(5);
+  EXPECT_EQ(window.GetLimit(), 3);
+  window.LowerLimit(0);
+  EXPECT_EQ(window.GetLimit(), 1);
+  EXPECT_EQ(window.GetSize(std::chrono::milliseconds(25)), 1);
+
+  EXPECT_EQ(OpcUa::PublishWindow(0).GetLimit(), 1);
+}
+
+namespace
+{
+  class RecordingHandler : public OpcUa::SubscriptionHandler
+  {
+  public:
+    void DataChange(uint32_t, const OpcUa::Node&, const OpcUa::Variant& value, OpcUa::AttributeId) override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      Values.push_back(value.ToString());
+      Changed.notify_all();
+    }
+
+    void StatusChange(OpcUa::StatusCode status) override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      Statuses.push_back(status);
+      Changed.notify_all();
+    }
+
+    bool WaitForValue(const std::string& value)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      return Changed.wait_for(lock, std::chrono::seconds(5), [this, &value]()
+        {
+          return !Values.empty() && Values.back() == value;
+        });
+    }
+
+    std::mutex Mutex;
+    std::condition_variable Changed;
+    std::vector<std::string> Values;
+    std::vector<OpcUa::StatusCode> Statuses;
+  };
+}
+
+TEST_F(OpcUaProtocolAddonTest, RecreatesSubscriptionsOnReconnect)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::Services::SharedPtr computer = computerAddon->GetServices();
+  OpcUa::ReconnectingServices::SharedPtr services = OpcUa::CreateReconnectingServices([computer](std::function<void ()>) { return computer; });
+
+  OpcUa::CreateSubscriptionParameters params;
+  params.RequestedPublishingInterval = 10;
+  RecordingHandler handler;
+  OpcUa::Subscription subscription(services, params, handler);
+  const OpcUa::NodeId node = OpcUa::ObjectId::Server_ServerStatus_BuildInfo_BuildNumber;
+  const std::vector<uint32_t> items = subscription.SubscribeDataChange(std::vector<OpcUa::ReadValueId>{OpcUa::ToReadValueId(node, OpcUa::AttributeId::Value)});
+  ASSERT_EQ(items.size(), 1);
+
+  // Server loses the subscription, builtin server cannot transfer it
+  const uint32_t id = subscription.GetId();
+  computer->Subscriptions()->DeleteSubscriptions(std::vector<uint32_t>{id});
+  services->Reconnect();
+  EXPECT_EQ(subscription.GetId(), id);
+
+  OpcUa::WriteValue value;
+  value.NodeId = node;
+  value.AttributeId = OpcUa::AttributeId::Value;
+  value.Value = OpcUa::DataValue(std::string("after reconnect"));
+  services->Attributes()->Write(std::vector<OpcUa::WriteValue>{value});
+  ASSERT_TRUE(handler.WaitForValue("after reconnect"));
+
+  {
+    // Loss is reported on the same thread before the new notifications
+    std::unique_lock<std::mutex> lock(handler.Mutex);
+    ASSERT_EQ(handler.Statuses.size(), 1);
+    EXPECT_EQ(handler.Statuses[0], OpcUa::StatusCode::BadDataLost);
+  }
+
+  // Ids known to the application still work
+  EXPECT_NO_THROW(subscription.UnSubscribe(items[0]));
+  EXPECT_NO_THROW(subscription.Delete());
+  services->Stop();
+  services.reset();
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, ReconnectingServicesAreReleasedFromStateCallback)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::Services::SharedPtr computer = computerAddon->GetServices();
+
+  std::mutex lostMutex;
+  std::function<void ()> lost;
+  std::promise<void> released;
+  std::shared_ptr<OpcUa::ReconnectingServices::SharedPtr> services = std::make_shared<OpcUa::ReconnectingServices::SharedPtr>();
+  OpcUa::ReconnectParameters params;
+  params.InitialDelay = std::chrono::milliseconds(10);
+  params.StateChanged = [services, &released](OpcUa::StatusCode status)
+    {
+      if (status != OpcUa::StatusCode::BadConnectionClosed)
+      {
+        return;
+      }
+      (*services)->Stop();
+      services->reset();
+      released.set_value();
+    };
+  *services = OpcUa::CreateReconnectingServices([computer, &lostMutex, &lost](std::function<void ()> connectionLost)
+    {
+      std::unique_lock<std::mutex> lock(lostMutex);
+      lost = connectionLost;
+      return computer;
+    }, params);
+  const std::weak_ptr<OpcUa::ReconnectingServices> weak = *services;
+  params.StateChanged = std::function<void (OpcUa::StatusCode)>();
+
+  std::unique_lock<std::mutex> lock(lostMutex);
+  const std::function<void ()> breakConnection = lost;
+  lock.unlock();
+  breakConnection();
+  ASSERT_EQ(released.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_TRUE(weak.expired());
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, SpreadsRequestsOverPool)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::Services::SharedPtr computer = computerAddon->GetServices();
+  OpcUa::PooledServices::SharedPtr pool = OpcUa::CreatePooledServices(std::vector<OpcUa::Services::SharedPtr>{computer, computer});
+  ASSERT_EQ(pool->GetSize(), 2);
+
+  const OpcUa::NodeId node = OpcUa::ObjectId::Server_ServerStatus_BuildInfo_BuildNumber;
+  OpcUa::ReadParameters read;
+  read.AttributesToRead.push_back(OpcUa::ToReadValueId(node, OpcUa::AttributeId::Value));
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_EQ(pool->Attributes()->Read(read).size(), 1);
+  }
+  std::promise<OpcUa::StatusCode> readStatus;
+  pool->Async()->Read(read, [&readStatus](OpcUa::StatusCode status, std::vector<OpcUa::DataValue>) { readStatus.set_value(status); });
+  EXPECT_EQ(readStatus.get_future().get(), OpcUa::StatusCode::Good);
+  EXPECT_EQ(pool->GetOutstanding(), std::vector<unsigned>(2, 0));
+
+  OpcUa::CreateSubscriptionParameters params;
+  params.RequestedPublishingInterval = 10;
+  RecordingHandler handler;
+  OpcUa::Subscription subscription(pool, params, handler);
+  const std::vector<uint32_t> items = subscription.SubscribeDataChange(std::vector<OpcUa::ReadValueId>{OpcUa::ToReadValueId(node, OpcUa::AttributeId::Value)});
+  ASSERT_EQ(items.size(), 1);
+
+  OpcUa::WriteValue value;
+  value.NodeId = node;
+  value.AttributeId = OpcUa::AttributeId::Value;
+  value.Value = OpcUa::DataValue(std::string("through pool"));
+  pool->Attributes()->Write(std::vector<OpcUa::WriteValue>{value});
+  EXPECT_TRUE(handler.WaitForValue("through pool"));
+
+  EXPECT_NO_THROW(subscription.UnSubscribe(items[0]));
+  EXPECT_NO_THROW(subscription.Delete());
+  pool.reset();
+  computer.reset();
+}
+
+namespace
+{
+  class EventRecorder : public OpcUa::SubscriptionHandler
+  {
+  public:
+    void Event(uint32_t, const OpcUa::Event& event) override
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      if (event.EventType == OpcUa::ObjectId::RefreshStartEventType || event.EventType == OpcUa::ObjectId::RefreshEndEventType)
+      {
+        Received.push_back(OpcUa::ToString(event.EventType));
+      }
+      else
+      {
+        Received.push_back(event.Message.Text);
+      }
+      Changed.notify_all();
+    }
+
+    std::vector<std::string> WaitFor(std::size_t count)
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      Changed.wait_for(lock, std::chrono::seconds(10), [&]() { return Received.size() >= count; });
+      std::vector<std::string> result;
+      result.swap(Received);
+      return result;
+    }
+
+    std::mutex Mutex;
+    std::condition_variable Changed;
+    std::vector<std::string> Received;
+  };
+
+  OpcUa::Event MakeConditionEvent(const OpcUa::NodeId& source, const std::string& message, bool retain)
+  {
+    OpcUa::Event event(OpcUa::ObjectId::ConditionType);
+    event.SourceNode = source;
+    event.Message = OpcUa::LocalizedText(message);
+    event.SetValue("Retain", OpcUa::Variant(retain));
+    return event;
+  }
+
+  std::vector<OpcUa::CallMethodResult> CallConditionRefresh(OpcUa::Services& services, const OpcUa::Variant& subscriptionId)
+  {
+    OpcUa::CallMethodRequest request;
+    request.ObjectId = OpcUa::ObjectId::Server;
+    request.MethodId = OpcUa::ObjectId::ConditionType_ConditionRefresh;
+    request.InputArguments.push_back(subscriptionId);
+    return services.Method()->Call(std::vector<OpcUa::CallMethodRequest>{request});
+  }
+}
+
+TEST_F(OpcUaProtocolAddonTest, RefreshesRetainedConditionsOnly)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::Services::SharedPtr computer = computerAddon->GetServices();
+  OpcUa::Server::SubscriptionService::SharedPtr server = Addons->GetAddon<OpcUa::Server::SubscriptionService>(OpcUa::Server::SubscriptionServiceAddonId);
+
+  OpcUa::CreateSubscriptionParameters params;
+  params.RequestedPublishingInterval = 10;
+  EventRecorder handler;
+  OpcUa::Subscription subscription(computer, params, handler);
+  subscription.SubscribeEvents();
+
+  OpcUa::Event plain(OpcUa::ObjectId::BaseEventType);
+  plain.Message = OpcUa::LocalizedText("plain");
+  server->TriggerEvent(OpcUa::ObjectId::Server, plain);
+  server->TriggerEvent(OpcUa::ObjectId::Server, MakeConditionEvent(OpcUa::NodeId(1, 1), "first active", true));
+  server->TriggerEvent(OpcUa::ObjectId::Server, MakeConditionEvent(OpcUa::NodeId(1, 1), "first changed", true));
+  server->TriggerEvent(OpcUa::ObjectId::Server, MakeConditionEvent(OpcUa::NodeId(2, 1), "second active", true));
+  server->TriggerEvent(OpcUa::ObjectId::Server, MakeConditionEvent(OpcUa::NodeId(2, 1), "second inactive", false));
+  EXPECT_EQ(handler.WaitFor(5).size(), 5);
+
+  const std::vector<OpcUa::CallMethodResult> results = CallConditionRefresh(*computer, OpcUa::Variant(subscription.GetId()));
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0].Status, OpcUa::StatusCode::Good);
+
+  const std::vector<std::string> expected = {
+    OpcUa::ToString(OpcUa::NodeId(OpcUa::ObjectId::RefreshStartEventType)),
+    "first changed",
+    OpcUa::ToString(OpcUa::NodeId(OpcUa::ObjectId::RefreshEndEventType))
+  };
+  EXPECT_EQ(handler.WaitFor(3), expected);
+
+  subscription.Delete();
+  computer.reset();
+}
+
+TEST_F(OpcUaProtocolAddonTest, RejectsConditionRefreshOfOtherSession)
+{
+  std::shared_ptr<OpcUa::Server::BuiltinServer> computerAddon = Addons->GetAddon<OpcUa::Server::BuiltinServer>(OpcUa::Server::OpcUaProtocolAddonId);
+  OpcUa::Services::SharedPtr computer = computerAddon->GetServices();
+  OpcUa::Server::SubscriptionService::SharedPtr server = Addons->GetAddon<OpcUa::Server::SubscriptionService>(OpcUa::Server::SubscriptionServiceAddonId);
+
+  // Subscription created directly in the server does not belong to the client session
+  OpcUa::CreateSubscriptionRequest request;
+  request.Parameters.RequestedPublishingInterval = 1000;
+  const OpcUa::SubscriptionData other = server->CreateSubscription(request, [](OpcUa::PublishResult) {});
+
+  std::vector<OpcUa::CallMethodResult> results = CallConditionRefresh(*computer, OpcUa::Variant(other.SubscriptionId));
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0].Status, OpcUa::StatusCode::BadSubscriptionIdInvalid);
+
+  results = CallConditionRefresh(*computer, OpcUa::Variant(std::string("not an id")));
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0].Status, OpcUa::StatusCode::BadSubscriptionIdInvalid);
+
+  server->DeleteSubscriptions(std::vector<uint32_t>{other.SubscriptionId});
+  computer.reset();
+}
@@ -0,0 +1,168 @@
+/// @brief Test of the server diagnostics counters and their nodes.
+/// @license GNU LGPL
+///
+/// Distributed under the GNU LGPL License
+/// (See accompanying file LICENSE or copy at
+/// http://www.gnu.org/licenses/lgpl.html)
+///
+
+#include "server_clock.h"
+#include "server_diagnostics.h"
+#include "server_object.h"
+
+#include <opc/common/addons_core/addon_manager.h>
+#include <opc/ua/node.h>
+#include <opc/ua/protocol/object_ids.h>
+#include <opc/ua/server/addons/services_registry.h>
+
+#include "address_space_registry_test.h"
+#include "services_registry_test.h"
+#include "standard_namespace_test.h"
+
+#include <boost/asio.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace testing;
+using namespace OpcUa;
+using namespace OpcUa::Server;
+
+TEST(ServerDiagnostics, SumsCountersOfAllThreads)
+{
+  const uint64_t received = Diagnostics::Get(Diagnostics::BytesReceived);
+  const int64_t sessions = Diagnostics::Get(Diagnostics::CurrentSessions);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.push_back(std::thread([]()
+    {
+      for (int j = 0; j < 1000; ++j)
+      {
+        Diagnostics::Add(Diagnostics::BytesReceived, 2);
+      }
+      Diagnostics::Change(Diagnostics::CurrentSessions, 1);
+    }));
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  // Value decreased by other thread than the one which increased it.
+  Diagnostics::Change(Diagnostics::CurrentSessions, -4);
+
+  EXPECT_EQ(Diagnostics::Get(Diagnostics::BytesReceived), received + 8000);
+  EXPECT_EQ(Diagnostics::Get(Diagnostics::CurrentSessions), sessions);
+}
+
+TEST(ServerDiagnostics, CountsServices)
+{
+  EXPECT_EQ(GetServiceType(READ_REQUEST), ServiceType::Read);
+  EXPECT_EQ(GetServiceType(PUBLISH_REQUEST), ServiceType::Publish);
+  EXPECT_EQ(GetServiceType(INVALID), ServiceType::Unsupported);
+  EXPECT_STREQ(GetCounterName(ServiceType::TranslateBrowsePathsToNodeIds), "TranslateBrowsePathsToNodeIdsCount");
+
+  const uint64_t reads = Diagnostics::GetServiceCount(ServiceType::Read);
+  const uint64_t total = Diagnostics::GetRequestCount();
+  Diagnostics::CountService(ServiceType::Read);
+  Diagnostics::CountService(ServiceType::Write);
+  EXPECT_EQ(Diagnostics::GetServiceCount(ServiceType::Read), reads + 1);
+  EXPECT_EQ(Diagnostics::GetRequestCount(), total + 2);
+}
+
+TEST(ServerDiagnostics, RecordsTimings)
+{
+  Common::Histogram before;
+  Diagnostics::Get(Diagnostics::HandlerTime, before);
+  Diagnostics::Record(Diagnostics::HandlerTime, std::chrono::microseconds(50));
+
+  Common::Histogram after;
+  Diagnostics::Get(Diagnostics::HandlerTime, after);
+  EXPECT_EQ(after.Count(), before.Count() + 1);
+  EXPECT_GE(after.Max(), 50000);
+}
+
+TEST(ServerClock, TakesCoarseTimeWhenSet)
+{
+  ServerClock::SetCoarse(true);
+  const DateTime before = DateTime::CurrentCoarse();
+  const DateTime coarse = ServerClock::Now();
+  const DateTime after = DateTime::CurrentCoarse();
+  ServerClock::SetCoarse(false);
+
+  EXPECT_LE(before.Value, coarse.Value);
+  EXPECT_LE(coarse.Value, after.Value);
+  EXPECT_FALSE(ServerClock::IsCoarse());
+  EXPECT_GE(ServerClock::Now().Value, after.Value);
+}
+
+class ServerDiagnosticsNodes : public Test
+{
+protected:
+  virtual void SetUp()
+  {
+    Addons = Common::CreateAddonsManager();
+
+    OpcUa::Test::RegisterServicesRegistry(*Addons);
+    OpcUa::Test::RegisterAddressSpace(*Addons);
+    OpcUa::Test::RegisterStandardNamespace(*Addons);
+    Addons->Start();
+
+    OpcUa::Server::ServicesRegistry::SharedPtr addon = Addons->GetAddon<OpcUa::Server::ServicesRegistry>(OpcUa::Server::ServicesRegistryAddonId);
+    Services = addon->GetServer();
+
+    // Timer of the server object is stopped only by the running io service.
+    Work.reset(new boost::asio::io_service::work(Io));
+    IoThread = std::thread([this](){ Io.run(); });
+  }
+
+  virtual void TearDown()
+  {
+    Work.reset();
+    IoThread.join();
+    Services.reset();
+    Addons->Stop();
+    Addons.reset();
+  }
+
+protected:
+  Common::AddonsManager::UniquePtr Addons;
+  OpcUa::Services::SharedPtr Services;
+  boost::asio::io_service Io;
+  std::unique_ptr<boost::asio::io_service::work> Work;
+  std::thread IoThread;
+};
+
+TEST_F(ServerDiagnosticsNodes, ExposesCounters)
+{
+  Diagnostics::Add(Diagnostics::CumulatedSessions);
+  Diagnostics::CountService(ServiceType::Browse);
+  const uint64_t browses = Diagnostics::GetServiceCount(ServiceType::Browse);
+
+  ServerObject object(Services, Io, false);
+
+  EXPECT_EQ(Node(Services, ObjectId::Server_ServerDiagnostics_EnabledFlag).GetValue(), Variant(true));
+  const Variant sessions = Node(Services, ObjectId::Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSessionCount).GetValue();
+  EXPECT_EQ(sessions, Variant(static_cast<uint32_t>(Diagnostics::Get(Diagnostics::CumulatedSessions))));
+  EXPECT_EQ(Node(Services, NodeId("Diagnostics.BrowseCount", 1)).GetValue(), Variant(browses));
+  EXPECT_EQ(Node(Services, NodeId("Diagnostics.HandlerTime.Count", 1)).GetValue().Type(), VariantType::UINT64);
+  EXPECT_EQ(Node(Services, NodeId("Diagnostics.HandlerTime.P99", 1)).GetValue().Type(), VariantType::DOUBLE);
+}
+
+TEST_F(ServerDiagnosticsNodes, TakesServerTimeFromServerClock)
+{
+  ServerClock::SetCoarse(true);
+  const DateTime before = DateTime::CurrentCoarse();
+  DataValue time;
+  {
+    ServerObject object(Services, Io, false);
+    time = Node(Services, ObjectId::Server_ServerStatus_CurrentTime).GetDataValue();
+  }
+  const DateTime after = DateTime::CurrentCoarse();
+  ServerClock::SetCoarse(false);
+
+  const DateTime current = time.Value.As<DateTime>();
+  EXPECT_LE(before.Value, current.Value);
+  EXPECT_LE(current.Value, after.Value);
+  EXPECT_LE(time.ServerTimestamp.Value, after.Value);
+}
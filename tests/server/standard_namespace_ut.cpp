@@ -14,10 +14,13 @@
 
 #include <opc/ua/server/address_space.h>
 #include <opc/ua/server/standard_address_space.h>
+#include <opc/ua/tree_walker.h>
 
+#include <algorithm>
 #include <functional>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <set>
 
 using namespace testing;
 using namespace OpcUa;
@@ -182,6 +185,85 @@ TEST_F(StandardNamespaceStructure, CanBrowseRootFolder_By_HierarchicalReferencie
   ASSERT_EQ(results[0].Referencies.size(), 3);
 }
 
+TEST_F(StandardNamespaceStructure, WalksTreeInBatches)
+{
+  TreeWalkParameters params;
+  params.NodesPerRequest = 7;
+  std::set<NodeId> seen;
+  unsigned maxDepth = 0;
+  const std::size_t count = WalkTree(*NameSpace, ObjectId::RootFolder, [&seen, &maxDepth](const NodeId&, const ReferenceDescription& ref, unsigned depth)
+    {
+      seen.insert(ref.TargetNodeId);
+      maxDepth = std::max(maxDepth, depth);
+      return true;
+    }, params);
+  EXPECT_GE(count, seen.size());
+  EXPECT_TRUE(seen.count(ObjectId::ObjectsFolder));
+  EXPECT_TRUE(seen.count(ObjectId::Server_ServerStatus_BuildInfo_BuildNumber));
+  EXPECT_GT(maxDepth, 3);
+
+  // Visitor stops descending, MaxDepth limits levels
+  params.MaxDepth = 1;
+  std::size_t levelOne = WalkTree(*NameSpace, ObjectId::RootFolder, [](const NodeId&, const ReferenceDescription&, unsigned) { return true; }, params);
+  EXPECT_EQ(levelOne, 3); // Objects, Types and Views
+  params.MaxDepth = 0;
+  levelOne = WalkTree(*NameSpace, ObjectId::RootFolder, [](const NodeId&, const ReferenceDescription&, unsigned) { return false; }, params);
+  EXPECT_EQ(levelOne, 3); // Objects, Types and Views
+}
+
+namespace
+{
+  // Browse results have continuation points which BrowseNext loses.
+  class ShortBrowse : public ViewServices
+  {
+  public:
+    virtual std::vector<BrowseResult> Browse(const OpcUa::NodesQuery&) const override
+    {
+      BrowseResult result;
+      result.ContinuationPoint = std::vector<uint8_t>{1};
+      return std::vector<BrowseResult>(1, result);
+    }
+
+    virtual std::vector<BrowseResult> BrowseNext() const override
+    {
+      ++BrowseNextCalls;
+      return std::vector<BrowseResult>();
+    }
+
+    virtual void ReleaseContinuationPoints() const override
+    {
+      ++Releases;
+    }
+
+    virtual std::vector<BrowsePathResult> TranslateBrowsePathsToNodeIds(const TranslateBrowsePathsParameters&) const override
+    {
+      return std::vector<BrowsePathResult>();
+    }
+
+    virtual std::vector<NodeId> RegisterNodes(const std::vector<NodeId>& params) const override
+    {
+      return params;
+    }
+
+    virtual void UnregisterNodes(const std::vector<NodeId>&) const override
+    {
+    }
+
+    mutable unsigned BrowseNextCalls = 0;
+    mutable unsigned Releases = 0;
+  };
+}
+
+TEST(TreeWalker, ReleasesContinuationPointsOfUnmatchedResults)
+{
+  // Browse leaves a continuation point, BrowseNext returns no result for it
+  ShortBrowse views;
+  const std::size_t count = WalkTree(views, ObjectId::RootFolder, [](const NodeId&, const ReferenceDescription&, unsigned) { return true; });
+  EXPECT_EQ(count, 0);
+  EXPECT_EQ(views.BrowseNextCalls, 1);
+  EXPECT_EQ(views.Releases, 1);
+}
+
 TEST_F(StandardNamespaceStructure, CheckRoot)
 {
   const std::vector<ReferenceDescription> refs = Browse(ObjectId::RootFolder);